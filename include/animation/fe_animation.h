@@ -100,4 +100,14 @@ void fe_animation_shutdown(void);
  */
 void fe_anim_instance_update(fe_anim_instance_t* instance, float dt);
 
+/**
+ * @brief Birden fazla animasyon örneğini iş sistemi üzerinden paralel günceller.
+ * * Örnekler birbirinden bağımsızdır; her biri fe_anim_instance_update ile güncellenir.
+ * * İş sistemi başlatılmamışsa hepsi çağıran iş parçacığında güncellenir.
+ * @param instances Güncellenecek örneklerin işaretçi dizisi.
+ * @param count Örnek sayısı.
+ * @param dt Geçen zaman (delta time).
+ */
+void fe_anim_update_instances(fe_anim_instance_t** instances, uint32_t count, float dt);
+
 #endif // FE_ANIMATION_H
@@ -81,6 +81,17 @@ void fe_asset_manager_update(float dt);
  */
 fe_asset_id_t fe_asset_load(const char* file_path, fe_asset_type_t type);
 
+/**
+ * @brief Birden fazla kaynağı yükler; disk okumaları iş sistemi üzerinden paralel yapılır.
+ * * Önbellek araması ve kayıt çağıran iş parçacığında seri yapılır (fe_asset_load ile aynı kurallar).
+ * * Aynı yol bir toplu istekte birden fazla kez geçmemelidir.
+ * @param file_paths Dosya yolları [count].
+ * @param types Beklenen kaynak türleri [count].
+ * @param count İstek sayısı.
+ * @param out_ids Sonuç ID'leri [count]; başarısız istekler için FE_ASSET_INVALID_ID.
+ */
+void fe_asset_load_batch(const char* const* file_paths, const fe_asset_type_t* types, uint32_t count, fe_asset_id_t* out_ids);
+
 /**
  * @brief Kaynak kimliği ile önbelleğe alınmış kaynağa erişir.
  * * Bu, referans sayısını ARTIRMAZ. fe_asset_release ile eşleştirilmez.
@@ -6,22 +6,22 @@
 #include <stdint.h>
 #include <stddef.h>
 #include <stdbool.h>
-#include "fe_array.h" // Zincirleme için dinamik dizi kullanilabilir
+#include "fe_array.h"
 
 // ----------------------------------------------------------------------
-// 1. DÜĞÜM VE ZİNCİR YAPISI
+// 1. KONTROL BAYTLARI (Swiss Table)
 // ----------------------------------------------------------------------
 
 /**
- * @brief Hash Map'teki tek bir Anahtar-Deger çiftini temsil eden düğüm.
+ * @brief Bir sorgu adiminda taranan kontrol bayti grubu (SSE2 ile tek karşılaştırma).
  */
-typedef struct fe_hashmap_node {
-    uint64_t hash;          // Anahtarın önceden hesaplanmış hash değeri
-    void* key;              // Anahtar verisinin adresi
-    void* value;            // Deger verisinin adresi
-    // Ayrı Zincirleme için:
-    struct fe_hashmap_node* next; // Aynı kovadaki bir sonraki düğüm
-} fe_hashmap_node_t;
+#define FE_HASHMAP_GROUP_WIDTH 16
+
+/**
+ * @brief Yuva durumlari. Dolu yuvalar hash'in alt 7 bitini (H2, 0..127) tutar.
+ */
+#define FE_HASHMAP_CTRL_EMPTY   ((uint8_t)0x80) // Hiç kullanılmamış yuva (sorguyu durdurur)
+#define FE_HASHMAP_CTRL_DELETED ((uint8_t)0xFE) // Silinmiş yuva (tombstone, sorgu devam eder)
 
 
 // ----------------------------------------------------------------------
@@ -29,14 +29,22 @@ typedef struct fe_hashmap_node {
 // ----------------------------------------------------------------------
 
 /**
- * @brief Temel Karma Tablo yapisi.
+ * @brief Açık adresli, düz depolamalı Karma Tablo yapisi.
+ * * Anahtarlar ve degerler tek bir tahsis içinde satır içi (inline) saklanır;
+ * * eleman başına tahsis yoktur. Kapasite her zaman 2'nin kuvvetidir.
+ * * Dikkat: Ekleme yeniden boyutlandırma tetikleyebileceğinden, fe_hashmap_get'in
+ * * döndürdüğü adres bir sonraki fe_hashmap_insert/remove çağrısına kadar geçerlidir.
  */
 typedef struct fe_hashmap {
-    fe_hashmap_node_t** buckets; // Kova (Bucket) dizisi (fe_hashmap_node_t* dizisi)
+    uint8_t* ctrl;              // Kontrol baytları [capacity + FE_HASHMAP_GROUP_WIDTH] (sondaki grup başın kopyası)
+    uint8_t* slots;             // Anahtar+Deger yuvaları [capacity * slot_size] (ctrl ile aynı tahsiste)
     size_t key_size;            // Anahtarın boyutu (byte)
     size_t value_size;          // Degerin boyutu (byte)
-    size_t capacity;            // Kova sayisi (buckets dizisinin boyutu)
+    size_t value_offset;        // Yuva içinde degerin başlangıcı (hizalanmış)
+    size_t slot_size;           // Bir yuvanın toplam boyutu (hizalanmış)
+    size_t capacity;            // Yuva sayısı (2'nin kuvveti)
     size_t count;               // Haritadaki mevcut eleman sayısı
+    size_t growth_left;         // Yeniden boyutlandırmaya kadar doldurulabilecek EMPTY yuva sayısı
     float load_factor;          // Yeniden boyutlandirma için yük faktörü
 } fe_hashmap_t;
 
@@ -54,10 +62,16 @@ typedef struct fe_hashmap {
 fe_hashmap_t* fe_hashmap_create(size_t key_size, size_t value_size);
 
 /**
- * @brief Hash Map'i ve içindeki tüm düğümleri bellekten serbest birakir.
+ * @brief Hash Map'i ve tüm yuvalarını bellekten serbest birakir.
  */
 void fe_hashmap_destroy(fe_hashmap_t* map);
 
+/**
+ * @brief Haritayı, yeniden boyutlandırma olmadan en az element_count eleman alacak şekilde büyütür.
+ * @return Başarılıysa true, degilse false.
+ */
+bool fe_hashmap_reserve(fe_hashmap_t* map, size_t element_count);
+
 /**
  * @brief Hash Map'e yeni bir Anahtar-Deger çifti ekler veya var olanı günceller.
  * @param key_ptr Anahtar verisinin adresi.
@@ -86,4 +100,11 @@ bool fe_hashmap_remove(fe_hashmap_t* map, const void* key_ptr);
  */
 // typedef struct fe_hashmap_iterator { ... } fe_hashmap_iterator_t;
 
+// ----------------------------------------------------------------------
+// 4. BİLGİ FONKSİYONLARI
+// ----------------------------------------------------------------------
+
+#define fe_hashmap_count(map)     ((map) ? (map)->count : 0)
+#define fe_hashmap_capacity(map)  ((map) ? (map)->capacity : 0)
+
 #endif // FE_HASHMAP_H
\ No newline at end of file
@@ -0,0 +1,158 @@
+// include/graphics/fe_culling.h
+
+#ifndef FE_CULLING_H
+#define FE_CULLING_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "math/fe_vector.h"
+#include "math/fe_matrix.h"
+#include "math/fe_plane.h"
+
+/**
+ * @brief CPU tarafinda gorus hacmi (frustum) ve Hi-Z perdeleme (occlusion) ayiklamasi.
+ * * Hem GeometryV kumeleri (fe_gv_scene_cull_clusters) hem OpenGL yolu (fe_renderer_set_culling) kullanir.
+ * * Toplu testler kutulari/kureleri kayit dizisinden okur: kayit i, records + i * stride (float cinsinden) adresindedir.
+ * * Kutu kaydi (min.x, min.y, min.z, max.x, max.y, max.z, ...), kure kaydi (merkez.x, merkez.y, merkez.z, yaricap, ...)
+ * * ile baslar; stride 4'un katiysa kayitlar SIMD ile toplanir (fe_gv_cluster_t icin 12), degilse skaler yola dusulur.
+ * * Kutu kayitlarinda stride en az 8 olmalidir (ikinci 4'lu okuma kaydin disina tasmasin).
+ */
+
+// ----------------------------------------------------------------------
+// 1. AYARLAR
+// ----------------------------------------------------------------------
+
+// Toplu testlerde bir turda islenen kutu/kure sayisi (bir AVX kaydi veya iki SSE kaydi)
+#define FE_CULL_BATCH_SIZE 8
+
+// Derinlik piramidinin en fazla seviye sayisi (4096 piksel genislige kadar)
+#define FE_CULL_PYRAMID_MAX_LEVELS 13
+
+// Derinlik piramidi cozunurlugu icin onerilen degerler; perdeleyiciler kaba oldugu icin dusuk cozunurluk yeterlidir
+#define FE_CULL_PYRAMID_DEFAULT_WIDTH 256
+#define FE_CULL_PYRAMID_DEFAULT_HEIGHT 128
+
+// Kirpma uzayinda w'nin bundan kucuk oldugu (kameranin arkasina/yakin duzleme tasan) kutular perdelenmis sayilmaz
+#define FE_CULL_MIN_W 1e-5f
+
+
+// ----------------------------------------------------------------------
+// 2. GORUS HACMI (FRUSTUM)
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Gorus hacmini sinirlayan alti duzlem. Normaller birimdir ve hacmin icine bakar.
+ */
+typedef struct fe_frustum {
+    fe_plane_t planes[6]; // Sol, sag, alt, ust, yakin, uzak
+} fe_frustum_t;
+
+/**
+ * @brief Duzlemleri view_proj matrisinden cikarir (Gribb-Hartmann; OpenGL kirpma uzayi, -w <= z <= w).
+ * * Dunya uzayi icin fe_camera3d_t::view_proj_matrix, nesne uzayi icin proj * view * model verilir.
+ */
+void fe_frustum_from_matrix(fe_frustum_t* out_frustum, const fe_mat4_t* view_proj);
+
+/**
+ * @brief Kutu hacimle kesisiyor veya icindeyse true. Ihtiyatlidir: koselerde disaridaki bazi kutular da true doner.
+ */
+bool fe_frustum_test_aabb(const fe_frustum_t* frustum, fe_vec3_t min, fe_vec3_t max);
+
+/**
+ * @brief Nesne uzayi kutusunu model matrisiyle donusturup onu saran dunya uzayi kutusunu verir.
+ * * Merkez donusturulur, yari boyutlar matrisin 3x3 kisminin mutlak degerleriyle olceklenir (8 koseyi sarar).
+ * * Matris afin olmalidir (son satir 0, 0, 0, 1).
+ */
+void fe_cull_transform_aabb(const fe_mat4_t* model, fe_vec3_t min, fe_vec3_t max, fe_vec3_t* out_min, fe_vec3_t* out_max);
+
+/**
+ * @brief Kure hacimle kesisiyor veya icindeyse true.
+ */
+bool fe_frustum_test_sphere(const fe_frustum_t* frustum, fe_vec3_t center, float radius);
+
+/**
+ * @brief count kutuyu FE_CULL_BATCH_SIZE'lik gruplar halinde test eder; gorunenlerin indekslerini sirayla yazar.
+ * @param out_indices count elemanlik.
+ * @return Gorunen kutu sayisi.
+ */
+uint32_t fe_cull_frustum_aabbs(const fe_frustum_t* frustum, const float* boxes, uint32_t stride, uint32_t count, uint32_t* out_indices);
+
+/**
+ * @brief fe_cull_frustum_aabbs'in kure karsiligi.
+ */
+uint32_t fe_cull_frustum_spheres(const fe_frustum_t* frustum, const float* spheres, uint32_t stride, uint32_t count, uint32_t* out_indices);
+
+
+// ----------------------------------------------------------------------
+// 3. HI-Z DERINLIK PIRAMIDI
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Buyuk perdeleyicilerin yazilimla rasterlestirilmis derinligi ve onun maksimum (en uzak) mip zinciri.
+ * * Derinlikler [0, 1] araligindadir (0 yakin duzlem). Seviye l'deki bir teksel, seviye 0'da kapladigi
+ * * piksellerin en uzak derinligini tutar; bir kutunun en yakin noktasi bundan uzaksa kutu perdelenmistir.
+ * * Kullanim: fe_depth_pyramid_begin -> perdeleyiciler (fe_depth_pyramid_rasterize*) -> fe_depth_pyramid_build -> testler.
+ */
+typedef struct fe_depth_pyramid {
+    uint32_t width;                     // Seviye 0 genisligi (SIMD genisliginin kati)
+    uint32_t height;
+    uint32_t level_count;
+    uint32_t level_width[FE_CULL_PYRAMID_MAX_LEVELS];
+    uint32_t level_height[FE_CULL_PYRAMID_MAX_LEVELS];
+    uint32_t level_offset[FE_CULL_PYRAMID_MAX_LEVELS]; // depth icindeki ilk teksel
+    float* depth;                       // Tum seviyeler ardisik
+
+    fe_mat4_t view_proj;                // Perdeleyicilerin ve test edilen kutularin dondurulecegi matris
+    uint32_t occluder_triangle_count;   // Bu karede rasterlestirilen (kirpmadan sonra) ucgen sayisi
+} fe_depth_pyramid_t;
+
+/**
+ * @brief Piramidi ayirir. Genislik SIMD genisliginin katina yuvarlanir.
+ * @return Basarisiz olursa NULL.
+ */
+fe_depth_pyramid_t* fe_depth_pyramid_create(uint32_t width, uint32_t height);
+
+/**
+ * @brief Piramidi serbest birakir.
+ */
+void fe_depth_pyramid_destroy(fe_depth_pyramid_t* pyramid);
+
+/**
+ * @brief Yeni kareye baslar: seviye 0 uzak duzleme (1) temizlenir ve matris kaydedilir.
+ */
+void fe_depth_pyramid_begin(fe_depth_pyramid_t* pyramid, const fe_mat4_t* view_proj);
+
+/**
+ * @brief Indeksli ucgenleri perdeleyici olarak rasterlestirir (yakin duzleme gore kirpilir, arka yuzler de yazilir).
+ * * Derinlik piksel icindeki en uzak deger olarak yazilir; boylece egik perdeleyiciler ihtiyatli kalir.
+ * * Kapsama piksel merkezinden orneklenir: perdeleyiciler arasindaki bir pikselden dar bosluklar kapali sayilir.
+ * @param positions Kose i'nin konumu positions + i * stride adresinde (fe_vertex_t icin stride 12).
+ */
+void fe_depth_pyramid_rasterize(fe_depth_pyramid_t* pyramid, const float* positions, uint32_t stride,
+                                const uint32_t* indices, uint32_t index_count);
+
+/**
+ * @brief Kutuyu (12 ucgen) perdeleyici olarak rasterlestirir. Kutunun tamamen dolu oldugu varsayilir.
+ */
+void fe_depth_pyramid_rasterize_box(fe_depth_pyramid_t* pyramid, fe_vec3_t min, fe_vec3_t max);
+
+/**
+ * @brief Seviye 0'dan mip zincirini kurar. Testlerden once cagrilmalidir.
+ */
+void fe_depth_pyramid_build(fe_depth_pyramid_t* pyramid);
+
+/**
+ * @brief Kutu perdelenmemisse (gorunebilirse) true. Yakin duzlemi kesen kutular her zaman true doner.
+ */
+bool fe_depth_pyramid_test_aabb(const fe_depth_pyramid_t* pyramid, fe_vec3_t min, fe_vec3_t max);
+
+/**
+ * @brief indices'teki kutulari piramide karsi test eder; perdelenmeyenlerin indekslerini sirayla yazar.
+ * * Koselerin donusumu FE_CULL_BATCH_SIZE'lik gruplar halinde SIMD ile yapilir. out_indices, indices ile ayni dizi olabilir
+ * * (ornegin fe_cull_frustum_aabbs'in ciktisi yerinde suzulur).
+ * @return Perdelenmeyen kutu sayisi.
+ */
+uint32_t fe_cull_occlusion_aabbs(const fe_depth_pyramid_t* pyramid, const float* boxes, uint32_t stride,
+                                 const uint32_t* indices, uint32_t count, uint32_t* out_indices);
+
+#endif // FE_CULLING_H
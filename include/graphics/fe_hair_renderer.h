@@ -0,0 +1,65 @@
+// include/graphics/fe_hair_renderer.h
+
+#ifndef FE_HAIR_RENDERER_H
+#define FE_HAIR_RENDERER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "graphics/fe_render_types.h"
+#include "physics/fe_hair_physics.h"
+
+/**
+ * @brief Render tellerini GPU'da kilavuzlardan karistiran tuketici (fe_hair_update_render_guides'in hedefi).
+ * * CPU her kare yalnizca kilavuz adimini ve guides.packed hazirligini yapar; ~288 KB'lik kilavuz tamponu
+ * * yuklenir ve karistirma Compute Shader'i (tepe basina bir is parcacigi) formulu uygular:
+ * *   tepe[i] = sum(w_j * kilavuz_j[i]) + head_rows * root_offset * (1 - clump * i / (stride - 1))
+ * * Tel tablosu yalnizca render_strands_revision degisince yeniden yuklenir.
+ * * fe_hair_update_render_strands bu yolun CPU yedegidir (GPU'suz araclar, dogrulama).
+ */
+
+// Karistirma Compute Shader'inin local_size_x degeri
+#define FE_HAIR_RENDERER_GROUP_SIZE 64
+
+// Tel tablosunda bir fe_hair_render_strand_t'nin 32 bitlik kelime sayisi (shader tabloyu duz kelime dizisi okur)
+#define FE_HAIR_RENDERER_STRAND_WORDS 10
+
+/**
+ * @brief Bir sac bileseninin GPU karistirma kaynaklari.
+ */
+typedef struct fe_hair_renderer {
+    fe_shader_id_t blend_shader;        // Karistirma Compute Shader'i
+    fe_buffer_id_t guide_ssbo;          // guides.packed: kilavuz basina stride tepe (binding 0)
+    fe_buffer_id_t strand_ssbo;         // fe_hair_render_strand_t tablosu (binding 1)
+    fe_buffer_id_t position_ssbo;       // Cikti: tel basina stride tepe, teller ardisik (binding 2; cizimde tepe tamponu)
+    uint32_t guide_capacity;            // guide_ssbo'nun tepe kapasitesi
+    uint32_t strand_capacity;           // strand_ssbo'nun tel kapasitesi
+    uint32_t position_capacity;         // position_ssbo'nun tepe kapasitesi
+
+    // Yuklu tel tablosunun kaynagi (degisirse yeniden yuklenir)
+    const fe_hair_component_t* component;
+    uint32_t strand_revision;
+    uint32_t strand_count;
+    uint32_t stride;                    // Son karistirmanin tel basina tepe sayisi
+} fe_hair_renderer_t;
+
+/**
+ * @brief Karistirma shader'ini yukler. Tamponlar ilk guncellemede bilesenin boyutuna gore ayrilir.
+ * @return Basarisiz olursa NULL.
+ */
+fe_hair_renderer_t* fe_hair_renderer_init(void);
+
+/**
+ * @brief Shader'i ve GPU tamponlarini serbest birakir.
+ */
+void fe_hair_renderer_shutdown(fe_hair_renderer_t* renderer);
+
+/**
+ * @brief Render tellerinin tepelerini GPU'da position_ssbo'ya yazar.
+ * * fe_hair_update_render_guides'i cagirir, kilavuzlari (ve degistiyse tel tablosunu) yukler ve
+ * * karistirmayi baslatir; position_ssbo sonraki tepe okumalarindan once hazirdir (bellek bariyeri).
+ * * Cizim: stride tepeli tel basina bir GL_LINE_STRIP (veya ayni tampondan genisletilmis serit).
+ * @return Gecersiz arguman, bellek veya tampon ayirma hatasinda false.
+ */
+bool fe_hair_renderer_update(fe_hair_renderer_t* renderer, fe_hair_component_t* comp);
+
+#endif // FE_HAIR_RENDERER_H
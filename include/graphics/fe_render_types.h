@@ -78,10 +78,17 @@ typedef struct fe_mesh {
     
     uint32_t vertex_count;      // Toplam Vertex sayısı
     uint32_t index_count;       // Toplam Index sayısı
+
+    // Kose verisinin (nesne) uzayinda sinirlayici kutu (AABB). fe_gl_mesh_create/fe_gl_mesh_update_vertices hesaplar.
+    // fe_renderer ayiklamasi cizim cagrisinin model matrisiyle dunya uzayina donusturur (bkz. fe_renderer_set_culling)
+    float bounds_min[3];
+    float bounds_max[3];
     
-    // Yüksek Seviye Veri (CPU'da tutulursa)
-    // fe_vertex_t* vertices;
-    // uint32_t* indices;
+    // Yüksek Seviye Veri (CPU kopyalari)
+    // fe_gl_mesh_create kopyalar, fe_gl_mesh_update_vertices gunceller, fe_gl_mesh_destroy serbest bırakır.
+    // GeometryV gibi CPU tarafı işleyiciler okur.
+    fe_vertex_t* vertices;
+    uint32_t* indices;
 } fe_mesh_t;
 
 
@@ -8,6 +8,7 @@
 #include "error/fe_error.h"
 #include "graphics/fe_render_types.h"
 #include "math/fe_matrix.h"
+#include "graphics/fe_culling.h"
 
 // Dinamik olarak yüklenen backend arayüzleri
 #include "graphics/dynamicr/fe_dynamicr_backend.h" 
@@ -64,9 +65,11 @@ void fe_renderer_end_frame(void);
 /**
  * @brief Bir mesh'i aktif render backend'ine gonderir.
  * * @param mesh Cizilecek mesh.
+ * @param model Mesh'in bu cizimdeki model matrisi; sadece ayiklamada kullanilir (shader uniform'unu cagiran ayarlar).
+ * * NULL ise kose verisi dunya uzayinda kabul edilir.
  * @param instance_count Ornek sayisi.
  */
-void fe_renderer_draw_mesh(const fe_mesh_t* mesh, uint32_t instance_count);
+void fe_renderer_draw_mesh(const fe_mesh_t* mesh, const fe_mat4_t* model, uint32_t instance_count);
 
 /**
  * @brief Aktif backend'in render pass'lerini calistirir (Örn: G-Buffer, Ray Tracing, Illumination).
@@ -96,4 +99,43 @@ void fe_renderer_clear(fe_clear_flags_t flags, float r, float g, float b, float
 void fe_renderer_load_scene_geometry(const fe_mesh_t* const* meshes, uint32_t mesh_count);
 
 
+// ----------------------------------------------------------------------
+// 5. AYIKLAMA (CULLING)
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Mesh ayiklama sayaclari. fe_renderer_begin_frame'de sifirlanir.
+ */
+typedef struct fe_renderer_cull_stats {
+    uint32_t submitted;         // Ayiklamaya giren mesh sayisi
+    uint32_t frustum_culled;    // Gorus hacmi disinda kaldigi icin cizilmeyenler
+    uint32_t occlusion_culled;  // Hi-Z piramidinde perdelendigi icin cizilmeyenler
+} fe_renderer_cull_stats_t;
+
+/**
+ * @brief fe_renderer_draw_mesh ve fe_renderer_draw_meshes icin CPU ayiklamasini acar veya kapatir.
+ * * Mesh sinirlari (fe_mesh_t::bounds_min/max) kose verisinin (nesne) uzayindadir. Cizim cagrisina verilen
+ * * model matrisiyle dunya uzayina donusturulur (fe_cull_transform_aabb) ve dunya uzayindaki view_proj'a
+ * * karsi test edilir. Model NULL ise sinirlar oldugu gibi kullanilir (kose verisi dunya uzayinda).
+ * * Ornekli (instance_count > 1) cizimler ayiklanmaz; orneklerin donusumleri CPU'da bilinmez.
+ * @param view_proj NULL ise ayiklama kapanir.
+ * @param occlusion Kurulmus (fe_depth_pyramid_build) perdeleme piramidi veya NULL. Renderer sahiplenmez;
+ * * ayiklama acik kaldigi surece gecerli kalmalidir.
+ */
+void fe_renderer_set_culling(const fe_mat4_t* view_proj, const fe_depth_pyramid_t* occlusion);
+
+/**
+ * @brief Mesh'leri toplu ayiklar (fe_cull_frustum_aabbs, fe_cull_occlusion_aabbs) ve gorunenleri tek ornekle cizer.
+ * * Ayiklama kapaliysa hepsini sirayla cizer. Gecici kutu/indeks tamponlari kare arenasindan
+ * * (fe_frame_alloc) alinir; yalnizca ana is parcacigindan cagrilmalidir.
+ * @param models mesh_count elemanlik model matrisi dizisi (models[i], meshes[i] icin) veya NULL (hepsi dunya uzayinda).
+ */
+void fe_renderer_draw_meshes(const fe_mesh_t* const* meshes, const fe_mat4_t* models, uint32_t mesh_count);
+
+/**
+ * @brief Bu karenin ayiklama sayaclarini dondurur.
+ */
+void fe_renderer_get_cull_stats(fe_renderer_cull_stats_t* out_stats);
+
+
 #endif // FE_RENDERER_H
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include <stdbool.h>
 #include "error/fe_error.h"
 #include "graphics/fe_render_types.h" // fe_shader_id_t için
+#include "math/fe_vector.h"            // fe_vec3_t için
 
 // ----------------------------------------------------------------------
 // 1. SHADER YAPISI
@@ -35,6 +36,13 @@ typedef struct fe_shader {
  */
 fe_shader_id_t fe_shader_load(const char* vs_path, const char* fs_path);
 
+/**
+ * @brief Verilen dosya yolundaki Compute Shader'i derler ve programa baglar (OpenGL 4.3).
+ * * Kullanim fe_shader_use ile aynidir; calistirmak icin glDispatchCompute cagrilir.
+ * @return Basari durumunda shader programinin ID'si, aksi takdirde 0.
+ */
+fe_shader_id_t fe_shader_load_compute(const char* cs_path);
+
 /**
  * @brief GPU'daki bir shader programini sistemden kaldirir.
  */
@@ -67,6 +75,11 @@ void fe_shader_set_uniform_float(const char* name, float value);
  */
 void fe_shader_set_uniform_int(const char* name, int value);
 
-// TODO: fe_mat4_t ve fe_vec3_t uniform ayarlama fonksiyonlari ileride eklenecektir.
+/**
+ * @brief Aktif shader'da bir vec3 uniform degerini ayarlar.
+ */
+void fe_shader_set_uniform_vec3(const char* name, const fe_vec3_t* value);
+
+// TODO: fe_mat4_t uniform ayarlama fonksiyonu ileride eklenecektir.
 
 #endif // FE_SHADER_COMPILER_H
\ No newline at end of file
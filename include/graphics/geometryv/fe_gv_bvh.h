@@ -0,0 +1,86 @@
+// include/graphics/geometryv/fe_gv_bvh.h
+
+#ifndef FE_GV_BVH_H
+#define FE_GV_BVH_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "graphics/geometryv/fe_gv_scene.h" // fe_gv_cluster_t, fe_gv_bvh_node_t
+
+/**
+ * @brief GeometryV kumeleri uzerinde CPU'da binned-SAH BVH insasi.
+ * * Her bolmede kume merkezleri her eksende FE_GV_BVH_BIN_COUNT kutuya dagitilir ve kutu sinirlari
+ * * arasindaki en dusuk SAH maliyetli bolme secilir. Her aralik ayri bir istir: FE_GV_BVH_TASK_CLUSTERS'tan
+ * * buyuk ust seviye araliklari fe_job_parallel_for ile parcalar halinde kutulanir ve iki cocugunu hemen yeni
+ * * isler olarak baslatir; kucuk araliklar tum alt agaclarini tek iste kurar. Isler tek dugum dizisinde
+ * * boyutlarindan gelen pencerelere yazar, sonda pencerelerin bos kuyruklari kapatilir.
+ * * Sonuc is parcacigi sayisindan bagimsizdir.
+ */
+
+// ----------------------------------------------------------------------
+// 1. AYARLAR
+// ----------------------------------------------------------------------
+
+// Eksen basina SAH kutusu (bin) sayisi
+#define FE_GV_BVH_BIN_COUNT 16
+
+// Bir yapraktaki en fazla kume sayisi (SAH daha kucuk yapraklari secebilir)
+#define FE_GV_BVH_MAX_LEAF_CLUSTERS 4
+
+// SAH maliyet katsayilari: dugum ziyareti ve kume testi
+#define FE_GV_BVH_NODE_COST 1.0f
+#define FE_GV_BVH_CLUSTER_COST 1.0f
+
+// Bundan kucuk alt agaclar ayri islerde insa edilir
+#define FE_GV_BVH_TASK_CLUSTERS 16384
+
+// Ust seviye araliklarinin (FE_GV_BVH_TASK_CLUSTERS'tan buyuk) paralel kutulamasinda parca basina kume sayisi
+#define FE_GV_BVH_BIN_PIECE_CLUSTERS 8192
+
+
+// ----------------------------------------------------------------------
+// 2. YAPILAR
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Insa edilmis BVH.
+ */
+typedef struct fe_gv_bvh {
+    fe_gv_bvh_node_t* nodes;   // Kok 0; FE_CACHE_LINE_SIZE hizali (fe_gv_bvh_free ile serbest birakilir)
+    uint32_t node_count;
+    uint32_t* cluster_order;   // Yaprak sirasi: i. yaprak kumesi, girdideki cluster_order[i]. kumedir
+    uint32_t cluster_count;
+    fe_vec3_t bounds_min;      // Tum agacin siniri
+    fe_vec3_t bounds_max;
+} fe_gv_bvh_t;
+
+
+// ----------------------------------------------------------------------
+// 3. FONKSIYONLAR
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Kume AABB'leri uzerinde BVH insa eder. Yapraklar cluster_order sirasindaki araliklari gosterir;
+ * * kumeler bu siraya dizilirse (bkz. fe_gv_scene_build_hierarchy) yaprak araliklari dogrudan kume indeksidir.
+ * @return Bellek yetersizse false.
+ */
+bool fe_gv_bvh_build(const fe_gv_cluster_t* clusters, uint32_t cluster_count, fe_gv_bvh_t* out_bvh);
+
+/**
+ * @brief fe_gv_bvh_build'in ayirdigi dizileri serbest birakir ve yapiyi sifirlar.
+ */
+void fe_gv_bvh_free(fe_gv_bvh_t* bvh);
+
+/**
+ * @brief Sahipligi devralinmis (hizali) dugum dizisini serbest birakir. NULL guvenlidir.
+ */
+void fe_gv_bvh_free_nodes(fe_gv_bvh_node_t* nodes);
+
+/**
+ * @brief Agacin SAH maliyeti: kokten rastgele bir isinin beklenen dugum ve kume testi maliyeti.
+ * * (NODE_COST * ic dugum alanlari + CLUSTER_COST * yaprak alani * kume sayisi) / kok alani.
+ * * Ayni kumeler icin farkli agaclari karsilastirmaya yarar; dusuk daha iyidir.
+ */
+float fe_gv_bvh_sah_cost(const fe_gv_bvh_node_t* nodes, uint32_t node_count);
+
+#endif // FE_GV_BVH_H
@@ -0,0 +1,76 @@
+// include/graphics/geometryv/fe_gv_cluster_builder.h
+
+#ifndef FE_GV_CLUSTER_BUILDER_H
+#define FE_GV_CLUSTER_BUILDER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "graphics/fe_render_types.h"
+#include "graphics/geometryv/fe_gv_scene.h" // fe_gv_cluster_t, fe_gpu_triangle_t
+
+/**
+ * @brief Mesh'lerin CPU verisinden (fe_mesh_t::vertices/indices) GeometryV kumelerini uretir.
+ * * 1. Her mesh'in ucgenleri merkezlerinin Morton koduna gore siralanir ve kose -> ucgen komsulugu kurulur
+ * *    (mesh'ler arasinda paralel).
+ * * 2. Morton sirasi FE_GV_CLUSTER_BLOCK_TRIANGLES'lik bloklara bolunur; her blok kendi icinde
+ * *    acgozlu (greedy) kumelenir (bloklar arasinda paralel). Kume, tohum ucgenden baslayip kumenin
+ * *    koselerini paylasan ucgenlerle buyur; en cok kose paylasan ve kume merkezine en yakin aday secilir.
+ * *    Komsu aday kalmazsa Morton sirasindaki yakin pencereden en yakin ucgen alinir; o da uzaksa
+ * *    kume FE_GV_CLUSTER_MAX_TRIANGLES'tan az ucgenle kapanir.
+ * * Kumelerin sirasi ve ucgenlerin kumelere dagilimi is parcacigi sayisindan bagimsizdir.
+ */
+
+// ----------------------------------------------------------------------
+// 1. AYARLAR
+// ----------------------------------------------------------------------
+
+// Bir kumedeki en fazla ucgen sayisi
+#define FE_GV_CLUSTER_MAX_TRIANGLES 128
+
+// Paralel kumeleme birimi (ucgen); FE_GV_CLUSTER_MAX_TRIANGLES'in kati olmalidir.
+// Blok sinirlarinda kumeler komsularini goremez, bu yuzden cok kucuk tutulmamalidir.
+#define FE_GV_CLUSTER_BLOCK_TRIANGLES 16384
+
+// Komsu aday kalmadiginda Morton sirasinda bakilan ucgen sayisi
+#define FE_GV_CLUSTER_SEARCH_WINDOW 64
+
+
+// ----------------------------------------------------------------------
+// 2. YAPILAR
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Kumeleme sonucu: kume sirasina dizilmis ucgenler ve kumeler.
+ */
+typedef struct fe_gv_cluster_geometry {
+    fe_gpu_triangle_t* triangles; // Kume k'nin ucgenleri [first_triangle_idx, first_triangle_idx + triangle_count)
+    uint32_t triangle_count;
+    fe_gv_cluster_t* clusters;    // Mesh sirasiyla
+    uint32_t cluster_count;
+} fe_gv_cluster_geometry_t;
+
+
+// ----------------------------------------------------------------------
+// 3. FONKSIYONLAR
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Mesh listesini kumeler. CPU verisi olmayan veya gecersiz indeksli mesh'ler uyariyla atlanir.
+ * * fe_job_parallel_for kullanir; is sistemi baslatilmamissa cagiran is parcaciginda calisir.
+ * @param out_geometry Basarili olursa doldurulur; fe_gv_cluster_geometry_free ile serbest birakilir.
+ * @return Bellek yetersizse false.
+ */
+bool fe_gv_cluster_build(const fe_mesh_t* const* meshes, uint32_t mesh_count, fe_gv_cluster_geometry_t* out_geometry);
+
+/**
+ * @brief fe_gv_cluster_build'in ayirdigi dizileri serbest birakir ve yapiyi sifirlar.
+ */
+void fe_gv_cluster_geometry_free(fe_gv_cluster_geometry_t* geometry);
+
+/**
+ * @brief Kumenin AABB'sini ve normal konisini ucgenlerinden hesaplar (triangle_count dolu olmalidir).
+ * @param triangles Kumenin ilk ucgeni (first_triangle_idx'e gore degil, dogrudan).
+ */
+void fe_gv_cluster_finish(fe_gv_cluster_t* cluster, const fe_gpu_triangle_t* triangles);
+
+#endif // FE_GV_CLUSTER_BUILDER_H
@@ -0,0 +1,160 @@
+// include/graphics/geometryv/fe_gv_lod.h
+
+#ifndef FE_GV_LOD_H
+#define FE_GV_LOD_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "math/fe_camera3d.h"
+#include "graphics/geometryv/fe_gv_scene.h"           // fe_gv_cluster_t, fe_gpu_triangle_t
+#include "graphics/geometryv/fe_gv_cluster_builder.h" // fe_gv_cluster_geometry_t
+
+/**
+ * @brief GeometryV kumeleri icin hiyerarsik LOD (kume DAG'i) ve ekran uzayi hatasina gore secim.
+ * * Insa (cevrimdisi): seviye 0, fe_gv_cluster_build'in kumeleridir. Her seviyede kenar paylasan komsu
+ * * kumeler FE_GV_LOD_GROUP_CLUSTERS'lik gruplara toplanir; grubun ucgenleri, grup siniri kilitli
+ * * tutularak kenar daraltmayla (edge collapse, quadric hata) yariya indirilir ve yeniden kumelere bolunur.
+ * * Bu kumeler bir ust seviyeyi olusturur. Grup siniri kilitli oldugu icin komsu gruplar farkli
+ * * seviyelerden secilse de catlak olusmaz.
+ * * Hata sinirlari monotondur: grubun hatasi uyelerinin hatalarindan, kuresi uyelerinin kurelerinden
+ * * kucuk olamaz. Bu yuzden projeksiyonlu hata bir kumeden ebeveynine giderken azalmaz ve secim tutarlidir.
+ * * Secim (calisma zamani): kume, kendi projeksiyonlu hatasi esigin altinda ve ebeveyn grubununki
+ * * ustundeyse cizilir. Secim koklerden inerek yapilir; maliyet ve ucgen sayisi sahne buyuklugunu degil
+ * * ekran cozunurlugunu izler.
+ */
+
+// ----------------------------------------------------------------------
+// 1. AYARLAR
+// ----------------------------------------------------------------------
+
+// Bir gruptaki hedef kume sayisi
+#define FE_GV_LOD_GROUP_CLUSTERS 8
+
+// Komsusu kalmayan kucuk gruplar, bu boyutu asmayan komsu gruba katilir
+#define FE_GV_LOD_GROUP_MAX_CLUSTERS 12
+
+// Sadelestirmede hedeflenen ucgen orani
+#define FE_GV_LOD_SIMPLIFY_RATIO 0.5f
+
+// En fazla seviye sayisi (seviye 0 dahil)
+#define FE_GV_LOD_MAX_LEVELS 32
+
+// Bir seviye onceki kume sayisinin bu oranindan fazlasini birakiyorsa insa durur (sadelestirme tikandi)
+#define FE_GV_LOD_MIN_REDUCTION 0.9f
+
+// Grubu veya kaynak grubu olmayan kumeler icin indeks
+#define FE_GV_LOD_NONE 0xFFFFFFFFu
+
+
+// ----------------------------------------------------------------------
+// 2. YAPILAR
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Kumenin LOD bilgisi (fe_gv_lod_dag_t::geometry.clusters ile ayni sirada; 32 bayt).
+ * * Kure ve hata, kumeyi ureten grubunkidir (seviye 0'da kumenin kendi siniri ve 0 hata).
+ */
+typedef struct fe_gv_lod_cluster {
+    fe_vec3_t center;      // LOD kuresi
+    float radius;
+    float error;           // Dunya uzayinda geometrik hata
+    uint32_t group;        // Uyesi oldugu grup (ebeveyn hatasi); FE_GV_LOD_NONE ise kok kume
+    uint32_t source_group; // Kumeyi ureten grup; FE_GV_LOD_NONE ise seviye 0
+    uint32_t level;
+} fe_gv_lod_cluster_t;
+
+/**
+ * @brief Bir seviyedeki komsu kumelerin grubu ve sadelestirilmis hali.
+ * * Uyeler [first_member, first_member + member_count) araligindaki kumelerdir (bir alt seviye);
+ * * sadelestirmenin urettigi kumeler bir ust seviyededir ve ilki first_output'tur.
+ */
+typedef struct fe_gv_lod_group {
+    fe_vec3_t center;      // Uyelerin LOD kurelerini kapsayan kure
+    float radius;
+    float error;           // Sadelestirilmis geometrinin hatasi (>= uyelerin hatasi)
+    uint32_t first_member;
+    uint32_t member_count;
+    uint32_t first_output;
+} fe_gv_lod_group_t;
+
+/**
+ * @brief Kume DAG'i. Kumeler seviye sirasiyla dizilir; seviye l [level_offsets[l], level_offsets[l + 1]).
+ * * Son seviyenin kumeleri koklerdir.
+ */
+typedef struct fe_gv_lod_dag {
+    fe_gv_cluster_geometry_t geometry; // Tum seviyelerin ucgenleri ve kumeleri
+    fe_gv_lod_cluster_t* cluster_lod;  // geometry.clusters ile paralel
+    fe_gv_lod_group_t* groups;
+    uint32_t group_count;
+    uint32_t level_count;
+    uint32_t level_offsets[FE_GV_LOD_MAX_LEVELS + 1];
+} fe_gv_lod_dag_t;
+
+/**
+ * @brief Secim ayarlari.
+ */
+typedef struct fe_gv_lod_settings {
+    float error_threshold;  // Piksel cinsinden izin verilen hata (tipik: 1)
+    float screen_height;    // Piksel cinsinden goruntu yuksekligi
+    const uint8_t* group_resident; // Grup basina 1/0 (uyeleri bellekte mi); NULL ise hepsi yerlesik sayilir
+} fe_gv_lod_settings_t;
+
+/**
+ * @brief Inilmek istenen ama uyeleri yerlesik olmadigi icin inilemeyen grup (akis istegi).
+ */
+typedef struct fe_gv_lod_missing_group {
+    uint32_t group;
+    float projected_error;      // Piksel; buyuk olan once yuklenmeli
+} fe_gv_lod_missing_group_t;
+
+/**
+ * @brief Secim sonucu. Diziler cagrilar arasinda yeniden kullanilir (her karede ayirma yapilmaz).
+ */
+typedef struct fe_gv_lod_selection {
+    uint32_t* clusters;         // Secilen kume indeksleri
+    uint32_t cluster_count;
+    uint32_t triangle_count;    // Secilen kumelerin toplam ucgen sayisi
+    uint32_t visited_groups;    // Inilen grup sayisi (secimin maliyeti); gruplar groups dizisindedir
+    uint32_t capacity;
+    uint32_t* groups;           // Inilen gruplar, genislik oncelikli sirada (gezinme kuyrugu olarak da kullanilir)
+    uint32_t group_capacity;
+    fe_gv_lod_missing_group_t* missing; // group_resident verildiyse: eksik gruplar (yerine kaba kumeler secildi)
+    uint32_t missing_count;
+    uint32_t missing_capacity;
+} fe_gv_lod_selection_t;
+
+
+// ----------------------------------------------------------------------
+// 3. FONKSIYONLAR
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Seviye 0 kumelerinden LOD DAG'ini insa eder. Girdi kopyalanir, degistirilmez.
+ * * Gruplarin sadelestirilmesi fe_job_parallel_for ile paraleldir; sonuc is parcacigi sayisindan bagimsizdir.
+ * @param out_dag fe_gv_lod_dag_free ile serbest birakilir.
+ * @return Bellek yetersizse false.
+ */
+bool fe_gv_lod_build(const fe_gv_cluster_geometry_t* base, fe_gv_lod_dag_t* out_dag);
+
+/**
+ * @brief DAG'in dizilerini serbest birakir ve yapiyi sifirlar.
+ */
+void fe_gv_lod_dag_free(fe_gv_lod_dag_t* dag);
+
+/**
+ * @brief Kamera icin DAG'den tutarli bir kesit (cut) secer: her yuzey parcasi tam bir seviyeden cizilir.
+ * * Projeksiyonlu hata = hata * (ekran yuksekligi / (2 * tan(fov_y / 2))) / kureye uzaklik.
+ * * Sadece mesafeye bakar; gorus konisi ve kapanma kirpmasi ayri bir asamadir.
+ * * settings->group_resident verilirse yerlesik olmayan gruba inilmez: grubun ciktilari (daha kaba) secilir
+ * * ve grup selection->missing'e yazilir. Kokler yerlesik olmalidir; boylece secilen her kume bellektedir.
+ * @return Bellek yetersizse false (secim eksik kalir).
+ */
+bool fe_gv_lod_select(const fe_gv_lod_dag_t* dag, const fe_camera3d_t* camera,
+                      const fe_gv_lod_settings_t* settings, fe_gv_lod_selection_t* selection);
+
+/**
+ * @brief Secimin dizilerini serbest birakir.
+ */
+void fe_gv_lod_selection_free(fe_gv_lod_selection_t* selection);
+
+#endif // FE_GV_LOD_H
@@ -14,26 +14,59 @@
 // 1. GEOMETRYV VERİ YAPILARI
 // ----------------------------------------------------------------------
 
+/**
+ * @brief GPU'ya gonderilen ucgen (Triangle SSBO elemani). Ucgenler kume sirasiyla dizilir.
+ */
+typedef struct fe_gpu_triangle {
+    fe_vec3_t p1, p2, p3; // 3 Köşe Pozisyonu (dunya uzayinda)
+    uint32_t material_id; // Mesh'in fe_gv_scene_load_geometry listesindeki sirasi
+} fe_gpu_triangle_t;
+
 /**
  * @brief Sahnedeki geometrinin kucuk bir bolumunu (bir grup ucgeni) temsil eden kumeler.
+ * * Normal konisi arkadan kirpma icindir: kamera c konumundayken, AABB merkezi m ve yari kosegeni r ile
+ * * dot(m - c, cone_axis) >= cone_cutoff * |m - c| + r ise kumenin tum ucgenleri kameraya arkasini doner.
  */
 typedef struct fe_gv_cluster {
     fe_vec3_t aabb_min;       // Kumenin Sınırlayıcı Kutusu (AABB) min noktasi
     fe_vec3_t aabb_max;       // Kumenin Sınırlayıcı Kutusu (AABB) max noktasi
     uint32_t first_triangle_idx; // Bu kumeye ait ilk ucgenin sahne ucgen listesindeki indeksi
     uint32_t triangle_count;     // Bu kumeye ait ucgen sayisi
+    fe_vec3_t cone_axis;      // Ucgen normallerini kapsayan koninin ekseni (birim)
+    float cone_cutoff;        // sin(koninin yari acisi); >= 1 ise kume arkadan kirpilamaz
 } fe_gv_cluster_t;
 
 /**
- * @brief Ucgen Kumelerinin Hiyerarsik yapisini tutar (Ileride eklenecek).
- * * Ornegin, AABB Hiyerarsisi (AABB Tree) veya Bounding Volume Hiyerarsisi (BVH) dugumleri.
+ * @brief Kume BVH'sinin ikili dugumu (Hierarchy SSBO elemani; 64 bayt, bir onbellek satiri).
+ * * Iki cocugun kutulari ebeveynde durur: gezinme tek satir okuyarak iki cocugu birden test eder.
+ * * child_count[k] == 0 ise child[k] ic dugum indeksidir; > 0 ise yapraktir ve kumeler
+ * * [child[k], child[k] + child_count[k]) araligindadir. Bos cocukta child[k] = FE_GV_BVH_INVALID.
+ */
+typedef struct fe_gv_bvh_node {
+    fe_vec3_t child_min[2];
+    fe_vec3_t child_max[2];
+    uint32_t child[2];
+    uint32_t child_count[2];
+} fe_gv_bvh_node_t;
+
+#define FE_GV_BVH_INVALID 0xFFFFFFFFu
+
+/**
+ * @brief Ucgen Kumelerinin Hiyerarsik yapisini tutar (kume AABB'leri uzerinde BVH, bkz. fe_gv_bvh.h).
  */
 typedef struct fe_gv_hierarchy {
-    // fe_gv_node_t* nodes; // Hierarsi dugumleri
+    fe_gv_bvh_node_t* nodes;       // Hiyerarsi dugumlerinin CPU kopyasi (kok 0, 64 bayt hizali)
     fe_buffer_id_t hierarchy_ssbo; // Dugumleri tutan GPU tamponu
     uint32_t node_count;
+    float sah_cost;                // Agac kalitesi (fe_gv_bvh_sah_cost; dusuk daha iyi)
 } fe_gv_hierarchy_t;
 
+struct fe_gv_lod_settings; // fe_gv_lod.h
+struct fe_gv_stream;       // fe_gv_stream.h
+struct fe_camera3d;        // math/fe_camera3d.h
+struct fe_frustum;         // graphics/fe_culling.h
+struct fe_depth_pyramid;   // graphics/fe_culling.h
+
 /**
  * @brief GeometryV Render sisteminin tüm kaynaklarini ve durumunu tutar.
  */
@@ -41,11 +74,17 @@ typedef struct fe_gv_scene {
     // Geometri Kaynaklari (Sahnenin Tum Verileri)
     fe_buffer_id_t triangle_ssbo; // Sahnedeki tüm ucgenlerin verisini tutan tampon
     fe_buffer_id_t cluster_ssbo;  // fe_gv_cluster_t yapilarini tutan tampon
+    uint32_t cluster_capacity;    // Cluster SSBO'nun (ve Hierarchy SSBO'nun dugum) kapasitesi; gerektikce buyur
     uint32_t total_triangle_count;
     uint32_t cluster_count;
+    fe_gv_cluster_t* clusters;    // Kumelerin CPU kopyasi (hiyerarsi insasi icin; BVH yaprak sirasinda)
     
     // Hiyerarsi Yöneticisi
     fe_gv_hierarchy_t hierarchy;
+
+    // Acik akis (fe_gv_scene_open_stream) varsa Triangle SSBO sayfa yuvalarini, Cluster SSBO her karenin kesitini tutar
+    struct fe_gv_stream* stream;
+    bool cut_overflow_warned;     // Kesit kapasiteyi asti ve kume atildi uyarisi verildi (akis basina bir kez)
     
     // Kamera Matrisleri
     fe_mat4_t view_matrix;
@@ -72,6 +111,10 @@ void fe_gv_scene_shutdown(fe_gv_scene_t* scene);
 
 /**
  * @brief Sahne geometrisini GeometryV yapisina yukler ve kümelere ayirir (Clustering).
+ * * Mesh'lerin CPU verisi (vertices/indices) okunur; CPU verisi olmayan mesh'ler atlanir.
+ * * Kumeleme fe_gv_cluster_build ile is parcaciklarina dagitilir (bkz. fe_gv_cluster_builder.h).
+ * * Sadece tam detay (seviye 0) yuklenir. LOD DAG'i yukleme yolunda kurulmaz (1M ucgen basina saniyeler surer);
+ * * cevrimdisi fe_gv_lod_build + fe_gv_stream_write ile uretilir ve fe_gv_scene_open_stream ile acilir.
  * * @param meshes Sahneden alinan tüm mesh'lerin listesi.
  * @param mesh_count Mesh sayisi.
  */
@@ -81,10 +124,35 @@ void fe_gv_scene_load_geometry(fe_gv_scene_t* scene,
 
 /**
  * @brief Cluster verilerini kullanarak hiyerarsi yapisini (BVH/AABB Tree) insa eder.
- * * Bu, isin takibini hizlandirmak icin gereklidir.
+ * * Bu, isin takibini hizlandirmak icin gereklidir. CPU'da binned-SAH ile insa edilir (fe_gv_bvh_build);
+ * * kumeler yaprak sirasina dizilip Cluster SSBO'ya, dugumler Hierarchy SSBO'ya yeniden yuklenir.
  */
 void fe_gv_scene_build_hierarchy(fe_gv_scene_t* scene);
 
+/**
+ * @brief Sahneyi sayfalanmis akis dosyasindan (fe_gv_stream_write) besler; toplam geometri MAX_TRIANGLES ile sinirli kalmaz.
+ * * Triangle SSBO sayfa yuvalarina bolunur (butce tamponu asamaz). Yuklu geometri ve varsa onceki akis birakilir.
+ * @return Dosya acilamazsa false.
+ */
+bool fe_gv_scene_open_stream(fe_gv_scene_t* scene, const char* path, uint64_t budget_bytes);
+
+/**
+ * @brief Akisi kamera icin ilerletir: biten sayfalar yuvalarina yuklenir, kesit Cluster SSBO'ya yazilir.
+ * * Cluster SSBO acilista fe_gv_stream_max_cut_clusters boyutuna buyutulur; yine de sigmayan kume olursa bir kez uyarilir.
+ * * Kesit her karede degistigi icin hiyerarsi gecersizlesir; gerekiyorsa fe_gv_scene_build_hierarchy yeniden cagrilir.
+ */
+void fe_gv_scene_update_stream(fe_gv_scene_t* scene, const struct fe_camera3d* camera, const struct fe_gv_lod_settings* settings);
+
+/**
+ * @brief Kumeleri gorus hacmine ve varsa Hi-Z piramidine karsi ayiklar (fe_culling.h).
+ * * Kume AABB'leri dogrudan scene->clusters'tan okunur (kayit basina 12 float, SIMD ile toplanir).
+ * @param occlusion NULL ise sadece gorus hacmi testi yapilir.
+ * @param out_indices cluster_count elemanlik; gorunen kumelerin scene->clusters indeksleri sirayla yazilir.
+ * @return Gorunen kume sayisi.
+ */
+uint32_t fe_gv_scene_cull_clusters(const fe_gv_scene_t* scene, const struct fe_frustum* frustum,
+                                   const struct fe_depth_pyramid* occlusion, uint32_t* out_indices);
+
 /**
  * @brief Her karede kamera ve diger uniform verilerini gunceller.
  */
@@ -0,0 +1,233 @@
+// include/graphics/geometryv/fe_gv_stream.h
+
+#ifndef FE_GV_STREAM_H
+#define FE_GV_STREAM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "platform/fe_platform_io.h"
+#include "platform/fe_thread.h"
+#include "utils/fe_timer.h"
+#include "graphics/geometryv/fe_gv_lod.h"
+
+/**
+ * @brief GeometryV kume verisinin sayfa tabanli akisi (streaming).
+ * * Dosya (cevrimdisi, fe_gv_stream_write): basta LOD DAG'inin metadatasi (kumeler, LOD kureleri, gruplar,
+ * * sayfa tablosu), ardindan FE_GV_STREAM_PAGE_SIZE'lik sayfalar halinde ucgenler. Kumeler DAG sirasiyla
+ * * paketlenir; bir grup sigiyorsa tek sayfaya konur, boylece bir gruba inmek tek okuma ister.
+ * * Calisma zamani: metadata bellekte kalir, ucgenler butce kadar sayfa yuvasinda (slot) tutulur.
+ * * Her fe_gv_stream_update'te LOD secimi sadece uyeleri yerlesik gruplara iner; inemedigi gruplarin
+ * * sayfalari projeksiyonlu hataya gore oncelikli olarak ayri bir I/O is parcacigina istenir. Yer
+ * * gerekirse son FE_GV_STREAM_EVICT_GRACE_FRAMES karede kullanilmamis en eski (LRU) sayfa atilir. Kok kumelerin sayfalari sabittir
+ * * (pinned), bu yuzden secim her zaman cizilebilir bir kesit dondurur; eksik detay geldikce kesit incelir.
+ * * Disk formati yerel bayt sirasi ve yapi duzeniyle yazilir (ayni platformda uretilip okunur).
+ */
+
+// ----------------------------------------------------------------------
+// 1. AYARLAR
+// ----------------------------------------------------------------------
+
+// Sayfa boyutu (bayt); bir kumenin ucgenleri tek sayfaya sigmalidir
+#define FE_GV_STREAM_PAGE_SIZE (128u * 1024u)
+
+// Bir sayfadaki en fazla ucgen; yuva s'nin ucgenleri GPU tamponunda s * bu degerden baslar
+#define FE_GV_STREAM_PAGE_TRIANGLES (FE_GV_STREAM_PAGE_SIZE / (uint32_t)sizeof(fe_gpu_triangle_t))
+
+// I/O kuyrugunda ayni anda bekleyebilecek en fazla sayfa istegi
+#define FE_GV_STREAM_MAX_INFLIGHT 32
+
+// Son bu kadar karede kesitin kullandigi sayfa atilmaz. Istenen kesit butceyi asiyorsa
+// daha kaba ama kararli bir kesitte kalinir; yoksa sinirdaki sayfalar her karede yer degistirir (thrashing)
+#define FE_GV_STREAM_EVICT_GRACE_FRAMES 8
+
+// Gecikme histogrami kova sayisi (kova i: [2^i, 2^(i+1)) mikrosaniye)
+#define FE_GV_STREAM_LATENCY_BUCKETS 24
+
+#define FE_GV_STREAM_MAGIC 0x53564746u // "FGVS"
+#define FE_GV_STREAM_VERSION 1u
+
+
+// ----------------------------------------------------------------------
+// 2. YAPILAR
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Dosya basligi.
+ */
+typedef struct fe_gv_stream_header {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t page_size;
+    uint32_t page_count;
+    uint32_t cluster_count;
+    uint32_t group_count;
+    uint32_t level_count;
+    uint32_t triangle_count;
+    uint64_t data_offset;       // Ilk sayfanin dosyadaki konumu (FE_GV_STREAM_PAGE_SIZE kati)
+} fe_gv_stream_header_t;
+
+/**
+ * @brief Sayfa tablosu girdisi. Sayfanin ucgenleri [first_cluster, first_cluster + cluster_count)
+ * * kumelerinin ucgenleridir; kumelerin first_triangle_idx'i sayfa icindeki sirayi verir.
+ */
+typedef struct fe_gv_stream_page {
+    uint32_t first_cluster;
+    uint32_t cluster_count;
+    uint32_t first_group;       // Uyeleri bu sayfada olan gruplar [first_group, first_group + group_count)
+    uint32_t group_count;
+    uint32_t triangle_count;
+    uint32_t pinned;            // Kok kume iceriyor: acilista yuklenir, hic atilmaz
+} fe_gv_stream_page_t;
+
+/**
+ * @brief Birikimli akis istatistikleri (fe_gv_stream_reset_stats ile sifirlanir).
+ * * Her karede kesitin ihtiyac duydugu sayfalar bir kez sayilir: secilen kumelerin sayfalari ve
+ * * inilmek istenen gruplarin sayfalari. Bellekteyse isabet (hit), degilse iska (miss).
+ */
+typedef struct fe_gv_stream_stats {
+    uint64_t frames;
+    uint64_t page_hits;
+    uint64_t page_misses;
+    uint64_t loads_requested;
+    uint64_t loads_completed;
+    uint64_t load_failures;
+    uint64_t evictions;
+    uint64_t bytes_read;
+    double latency_sum_ms;      // Istekten okumanin bitisine
+    double latency_max_ms;
+    uint32_t latency_histogram[FE_GV_STREAM_LATENCY_BUCKETS];
+    uint64_t budget_stalls;     // Atilabilir sayfa kalmadigi icin ertelenen istekler
+} fe_gv_stream_stats_t;
+
+/**
+ * @brief GPU'ya yukleme geri cagrisi: yuvaya yeni sayfa geldiginde ana is parcaciginda (update icinde) cagrilir.
+ */
+typedef void (*fe_gv_stream_upload_func_t)(void* user_data, uint32_t slot, const fe_gpu_triangle_t* triangles, uint32_t triangle_count);
+
+/**
+ * @brief I/O is parcacigina giden istek ve donen sonuc.
+ */
+typedef struct fe_gv_stream_request {
+    uint32_t page;
+    uint32_t slot;
+    bool ok;
+    float latency_ms;
+    fe_timer_t timer;
+} fe_gv_stream_request_t;
+
+/**
+ * @brief Acik bir akis dosyasi ve yerlesiklik yoneticisi.
+ */
+typedef struct fe_gv_stream {
+    fe_file_handle_t file;
+    uint64_t data_offset;
+
+    // Metadata (her zaman bellekte). dag.geometry.triangles NULL'dir; kume ucgenleri sayfalardadir
+    fe_gv_lod_dag_t dag;
+    fe_gv_stream_page_t* pages;
+    uint32_t page_count;
+    uint32_t* cluster_page;     // Kume -> sayfa
+
+    // Yerlesiklik
+    uint8_t* page_state;        // FE_GV_STREAM_PAGE_* (fe_gv_stream.c)
+    uint32_t* page_slot;        // Yerlesik/beklemedeyse yuva, degilse FE_GV_LOD_NONE
+    uint32_t* page_last_used;   // Kesitin sayfaya son ihtiyac duydugu kare
+    uint32_t* lru_prev;         // Yerlesik, sabit olmayan sayfalarin LRU listesi (bas: en yeni)
+    uint32_t* lru_next;
+    uint32_t lru_head, lru_tail;
+    uint8_t* group_resident;    // fe_gv_lod_settings_t::group_resident
+    uint32_t* group_missing_pages; // Grubun bellekte olmayan sayfa sayisi
+
+    // Yuvalar (bellek butcesi)
+    uint8_t* slot_memory;
+    uint32_t slot_count;
+    uint32_t* free_slots;
+    uint32_t free_slot_count;
+
+    // I/O is parcacigi; halkalar mutex ile korunur
+    fe_thread_t io_thread;
+    fe_mutex_t mutex;
+    fe_cond_t cond;
+    fe_cond_t done_cond;        // Bir okuma bittiginde (fe_gv_stream_wait_loads)
+    bool stop_requested;
+    fe_gv_stream_request_t requests[FE_GV_STREAM_MAX_INFLIGHT];
+    uint32_t request_head, request_count;
+    fe_gv_stream_request_t completions[FE_GV_STREAM_MAX_INFLIGHT];
+    uint32_t completion_count;
+    uint32_t in_flight;         // Istenip ana is parcacigina henuz donmemis sayfalar
+
+    fe_gv_stream_upload_func_t upload;
+    void* upload_user_data;
+
+    uint32_t frame;
+    fe_gv_lod_selection_t selection; // Son fe_gv_stream_update'in kesiti
+    fe_gv_stream_stats_t stats;
+} fe_gv_stream_t;
+
+
+// ----------------------------------------------------------------------
+// 3. FONKSIYONLAR
+// ----------------------------------------------------------------------
+
+/**
+ * @brief DAG'i sayfalanmis akis dosyasina yazar (cevrimdisi arac adimi).
+ * @return Dosya yazilamazsa veya bir kume sayfaya sigmazsa false.
+ */
+bool fe_gv_stream_write(const fe_gv_lod_dag_t* dag, const char* path);
+
+/**
+ * @brief Akis dosyasini acar, metadatayi okur, sabit sayfalari yukler ve I/O is parcacigini baslatir.
+ * @param budget_bytes Sayfa yuvalari icin bellek butcesi (FE_GV_STREAM_PAGE_SIZE'a yuvarlanir).
+ * @param upload Yeni gelen sayfa icin cagrilir; NULL olabilir (sadece CPU kullanimi).
+ * @return Basarisizsa (dosya, bellek, butce sabit sayfalara yetmiyor) NULL.
+ */
+fe_gv_stream_t* fe_gv_stream_open(const char* path, uint64_t budget_bytes,
+                                  fe_gv_stream_upload_func_t upload, void* upload_user_data);
+
+/**
+ * @brief I/O is parcacigini durdurur ve tum kaynaklari serbest birakir.
+ */
+void fe_gv_stream_close(fe_gv_stream_t* stream);
+
+/**
+ * @brief Bir kare: biten yuklemeleri yerlesik yapar, kesiti secer (stream->selection), eksik sayfalari ister.
+ * * settings->group_resident yok sayilir; akisin kendi yerlesiklik dizisi kullanilir.
+ * @return Bellek yetersizse false.
+ */
+bool fe_gv_stream_update(fe_gv_stream_t* stream, const fe_camera3d_t* camera, const fe_gv_lod_settings_t* settings);
+
+/**
+ * @brief Istenmis tum sayfalarin okunmasini bekler. Sayfalar bir sonraki fe_gv_stream_update'te yerlesik olur.
+ * * Yukleme ekranlari ve zamanlamadan bagimsiz olmasi gereken testler icindir; kare dongusunde cagrilmaz.
+ */
+void fe_gv_stream_wait_loads(fe_gv_stream_t* stream);
+
+/**
+ * @brief Yerlesik bir kumenin ucgenlerini dondurur (yuva belleginde); yerlesik degilse NULL.
+ */
+const fe_gpu_triangle_t* fe_gv_stream_cluster_triangles(const fe_gv_stream_t* stream, uint32_t cluster);
+
+/**
+ * @brief Son kesitin kumelerini GPU duzenine cevirir: first_triangle_idx = yuva * FE_GV_STREAM_PAGE_TRIANGLES + sayfa ici indeks.
+ * @return Yazilan kume sayisi (en fazla max_clusters).
+ */
+uint32_t fe_gv_stream_resolve(const fe_gv_stream_t* stream, fe_gv_cluster_t* out_clusters, uint32_t max_clusters);
+
+/**
+ * @brief Bir kesitin olabilecek en buyuk kume sayisi: secilen kumeler yerlesik olmak zorunda oldugundan
+ * * en kalabalik slot_count sayfanin kume toplami (ve toplam kume sayisi) ile sinirlidir.
+ * * Kesit tamponlari (fe_gv_stream_resolve hedefi, Cluster SSBO) bu boyutta ayrilirsa kume atilmaz.
+ */
+uint32_t fe_gv_stream_max_cut_clusters(const fe_gv_stream_t* stream);
+
+/**
+ * @brief Istatistikleri sifirlar.
+ */
+void fe_gv_stream_reset_stats(fe_gv_stream_t* stream);
+
+/**
+ * @brief Yukleme gecikmesinin yuzdeligini histogramdan tahmin eder (kovanin ust siniri, ms).
+ */
+double fe_gv_stream_latency_percentile(const fe_gv_stream_stats_t* stats, double percentile);
+
+#endif // FE_GV_STREAM_H
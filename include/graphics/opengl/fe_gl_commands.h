@@ -37,6 +37,18 @@ void fe_gl_cmd_bind_shader(fe_shader_id_t program_id);
  */
 void fe_gl_cmd_bind_texture(fe_texture_id_t texture_id, uint32_t texture_unit);
 
+/**
+ * @brief Bir tamponu Shader Storage Buffer baglama noktasina baglar (glBindBufferBase).
+ * @param buffer_id Baglanacak tampon ID'si.
+ * @param binding Shader'daki layout(binding = N) degeri.
+ */
+void fe_gl_cmd_bind_ssbo(fe_buffer_id_t buffer_id, uint32_t binding);
+
+/**
+ * @brief Baglama noktasindaki Shader Storage Buffer'i cozer.
+ */
+void fe_gl_cmd_unbind_ssbo(uint32_t binding);
+
 
 // ----------------------------------------------------------------------
 // 2. ÇİZİM (Drawing) KOMUTLARI
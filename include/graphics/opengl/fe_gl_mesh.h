@@ -13,7 +13,8 @@
 
 /**
  * @brief CPU verilerinden yeni bir OpenGL Mesh'i (VAO, VBO, EBO) olusturur.
- * * fe_gl_device'ı kullanarak veriyi GPU'ya yükler.
+ * * fe_gl_device'ı kullanarak veriyi GPU'ya yükler. Kose ve index verilerinin CPU kopyalari
+ * * mesh->vertices/mesh->indices icinde tutulur (GeometryV icin) ve fe_gl_mesh_destroy ile serbest birakilir.
  * @param vertices Mesh'in fe_vertex_t yapisindaki kose verileri.
  * @param vertex_count Koselerdeki toplam eleman sayisi.
  * @param indices Mesh'in cizim siralamasini belirten index verileri.
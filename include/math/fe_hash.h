@@ -0,0 +1,165 @@
+// include/math/fe_hash.h
+
+#ifndef FE_HASH_H
+#define FE_HASH_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// ----------------------------------------------------------------------
+// 1. AYARLAR VE SABİTLER
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Kriptografik olmayan, kelime tabanlı (word-at-a-time) 64-bit hash.
+ * * Kısa ve orta uzunluktaki anahtarlar (<= FE_HASH_INLINE_MAX_LENGTH) bu başlıktaki
+ * * satır içi yol ile 8/16 baytlık okumalarla işlenir; daha uzun anahtarlar SSE2 ile
+ * * vektörleştirilmiş fe_hash_long yoluna gider. Sonuç platformdan bağımsızdır
+ * * (veri her zaman little-endian okunur, SIMD ve skaler yollar aynı değeri üretir).
+ */
+#define FE_HASH_DEFAULT_SEED        0ULL
+#define FE_HASH_INLINE_MAX_LENGTH   256
+
+#define FE_HASH_PRIME_0 0xa0761d6478bd642fULL
+#define FE_HASH_PRIME_1 0xe7037ed1a0b428dbULL
+#define FE_HASH_PRIME_2 0x8ebc6af09c88c6e3ULL
+#define FE_HASH_PRIME_3 0x589965cc75374cc3ULL
+
+// C++'ta satır içi yol constexpr'dir (derleme zamanı kaynak kimlikleri);
+// C'de static inline olarak kalır ve sabit girdilerde derleyici tarafından katlanır.
+#ifdef __cplusplus
+    #define FE_HASH_INLINE constexpr inline
+extern "C" {
+#else
+    #define FE_HASH_INLINE static inline
+#endif
+
+// ----------------------------------------------------------------------
+// 2. ÇALIŞMA ZAMANI FONKSİYONLARI (fe_hash.c)
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Verinin 64-bit hash değerini varsayılan tohum (seed) ile hesaplar.
+ * * fe_hashmap ve kaynak yöneticisi tarafından kullanılır.
+ * @param data Hash'lenecek verinin adresi.
+ * @param size Verinin boyutu (byte).
+ */
+uint64_t fe_hash_data(const void* data, size_t size);
+
+/**
+ * @brief Verinin 64-bit hash değerini verilen tohum ile hesaplar.
+ */
+uint64_t fe_hash_data_seeded(const void* data, size_t size, uint64_t seed);
+
+/**
+ * @brief Sıfır ile sonlanan bir dizenin (örn: kaynak yolu) hash değerini hesaplar.
+ * * FE_HASH_LITERAL ile aynı değeri üretir.
+ */
+uint64_t fe_hash_string(const char* str);
+
+/**
+ * @brief FE_HASH_INLINE_MAX_LENGTH'ten uzun anahtarlar için vektörleştirilmiş yol.
+ * * Doğrudan çağrılması gerekmez; fe_hash_bytes_inline tarafından kullanılır.
+ */
+uint64_t fe_hash_long(const char* data, size_t size, uint64_t seed);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+// ----------------------------------------------------------------------
+// 3. SATIR İÇİ (INLINE) YOL
+// ----------------------------------------------------------------------
+
+/**
+ * @brief 8 baytı little-endian olarak okur (hizalama gerektirmez; derleyici tek yüke çevirir).
+ */
+FE_HASH_INLINE uint64_t fe_hash_read64(const char* p) {
+    return  (uint64_t)(uint8_t)p[0]        | ((uint64_t)(uint8_t)p[1] << 8)  |
+           ((uint64_t)(uint8_t)p[2] << 16) | ((uint64_t)(uint8_t)p[3] << 24) |
+           ((uint64_t)(uint8_t)p[4] << 32) | ((uint64_t)(uint8_t)p[5] << 40) |
+           ((uint64_t)(uint8_t)p[6] << 48) | ((uint64_t)(uint8_t)p[7] << 56);
+}
+
+/**
+ * @brief 4 baytı little-endian olarak okur.
+ */
+FE_HASH_INLINE uint64_t fe_hash_read32(const char* p) {
+    return  (uint64_t)(uint8_t)p[0]        | ((uint64_t)(uint8_t)p[1] << 8) |
+           ((uint64_t)(uint8_t)p[2] << 16) | ((uint64_t)(uint8_t)p[3] << 24);
+}
+
+/**
+ * @brief 64x64 -> 128 bit çarpımın üst ve alt yarısını XOR'lar (karıştırma çekirdeği).
+ */
+FE_HASH_INLINE uint64_t fe_hash_mix(uint64_t a, uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+    __uint128_t product = (__uint128_t)a * b;
+    return (uint64_t)product ^ (uint64_t)(product >> 64);
+#else
+    // Taşınabilir yol: 32-bit parçalarla 128-bit çarpım
+    uint64_t a_lo = a & 0xFFFFFFFFULL, a_hi = a >> 32;
+    uint64_t b_lo = b & 0xFFFFFFFFULL, b_hi = b >> 32;
+    uint64_t lo_lo = a_lo * b_lo, hi_lo = a_hi * b_lo;
+    uint64_t lo_hi = a_lo * b_hi, hi_hi = a_hi * b_hi;
+    uint64_t cross = (lo_lo >> 32) + (hi_lo & 0xFFFFFFFFULL) + lo_hi;
+    uint64_t hi = hi_hi + (hi_lo >> 32) + (cross >> 32);
+    uint64_t lo = (cross << 32) | (lo_lo & 0xFFFFFFFFULL);
+    return lo ^ hi;
+#endif
+}
+
+/**
+ * @brief Son karıştırma adımı (avalanche): her giriş biti tüm çıkış bitlerini etkiler.
+ */
+FE_HASH_INLINE uint64_t fe_hash_avalanche(uint64_t h) {
+    h ^= h >> 37;
+    h *= 0x165667919E3779F9ULL;
+    h ^= h >> 32;
+    return h;
+}
+
+/**
+ * @brief Hash algoritmasının tamamı; kısa/orta anahtarlar satır içi, uzunlar fe_hash_long.
+ * * 0-16 bayt: iki (örtüşen) okuma ve tek karıştırma.
+ * * 17-256 bayt: 16 baytlık bloklar, son blok girdinin son 16 baytıyla örtüşür.
+ */
+FE_HASH_INLINE uint64_t fe_hash_bytes_inline(const char* p, size_t len, uint64_t seed) {
+    if (len <= 16) {
+        uint64_t a = 0, b = 0;
+        if (len >= 8) {
+            a = fe_hash_read64(p);
+            b = fe_hash_read64(p + len - 8);
+        } else if (len >= 4) {
+            a = fe_hash_read32(p);
+            b = fe_hash_read32(p + len - 4);
+        } else if (len > 0) {
+            a = ((uint64_t)(uint8_t)p[0] << 16) | ((uint64_t)(uint8_t)p[len >> 1] << 8) | (uint64_t)(uint8_t)p[len - 1];
+        }
+        return fe_hash_avalanche(fe_hash_mix(a ^ FE_HASH_PRIME_1 ^ seed, b ^ FE_HASH_PRIME_2 ^ (uint64_t)len));
+    }
+
+    if (len > FE_HASH_INLINE_MAX_LENGTH) {
+        return fe_hash_long(p, len, seed);
+    }
+
+    uint64_t h = seed ^ ((uint64_t)len * FE_HASH_PRIME_0);
+    size_t i = 0;
+    for (; i + 16 <= len; i += 16) {
+        h ^= fe_hash_mix(fe_hash_read64(p + i) ^ FE_HASH_PRIME_1, fe_hash_read64(p + i + 8) ^ FE_HASH_PRIME_2 ^ h);
+    }
+    if (i < len) {
+        h ^= fe_hash_mix(fe_hash_read64(p + len - 16) ^ FE_HASH_PRIME_3, fe_hash_read64(p + len - 8) ^ FE_HASH_PRIME_2 ^ h);
+    }
+    return fe_hash_avalanche(h);
+}
+
+/**
+ * @brief Bir dize sabitinin (string literal) hash'i.
+ * * C++'ta sabit ifadedir (örn: constexpr fe_asset_id_t ID = FE_HASH_LITERAL("models/tree.fbx");).
+ * * C'de optimizasyon açıkken derleme zamanında katlanır; fe_hash_string ile aynı değeri verir.
+ * * "" ön eki yalnızca dize sabitlerinin kabul edilmesini sağlar.
+ */
+#define FE_HASH_LITERAL(str) fe_hash_bytes_inline("" str, sizeof(str) - 1, FE_HASH_DEFAULT_SEED)
+
+#endif // FE_HASH_H
\ No newline at end of file
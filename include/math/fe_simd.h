@@ -0,0 +1,120 @@
+// include/math/fe_simd.h
+
+#ifndef FE_SIMD_H
+#define FE_SIMD_H
+
+/**
+ * @brief Derleyicinin hedeflediği en geniş float SIMD kaydı için ince makro katmanı.
+ * * AVX'te 8, SSE2'de 4 şerit. Hiçbiri yoksa FE_SIMD_WIDTH tanımlanmaz; kullanan kod skaler yola düşer.
+ * * Karşılaştırmalar şerit başına tüm bitleri 1 olan maske döndürür (fe_simd_select/fe_simd_and ile kullanılır).
+ */
+
+#if defined(__AVX__)
+    #include <immintrin.h>
+    #define FE_SIMD_WIDTH 8
+    typedef __m256 fe_simd_t;
+    #define fe_simd_load(p)         _mm256_loadu_ps(p)
+    #define fe_simd_store(p, v)     _mm256_storeu_ps((p), (v))
+    #define fe_simd_set1(x)         _mm256_set1_ps(x)
+    #define fe_simd_zero()          _mm256_setzero_ps()
+    #define fe_simd_add(a, b)       _mm256_add_ps((a), (b))
+    #define fe_simd_sub(a, b)       _mm256_sub_ps((a), (b))
+    #define fe_simd_mul(a, b)       _mm256_mul_ps((a), (b))
+    #define fe_simd_div(a, b)       _mm256_div_ps((a), (b))
+    #define fe_simd_sqrt(a)         _mm256_sqrt_ps(a)
+    #define fe_simd_min(a, b)       _mm256_min_ps((a), (b))
+    #define fe_simd_max(a, b)       _mm256_max_ps((a), (b))
+    #define fe_simd_and(a, b)       _mm256_and_ps((a), (b))
+    #define fe_simd_or(a, b)        _mm256_or_ps((a), (b))
+    #define fe_simd_gt(a, b)        _mm256_cmp_ps((a), (b), _CMP_GT_OQ)
+    #define fe_simd_le(a, b)        _mm256_cmp_ps((a), (b), _CMP_LE_OQ)
+    #define fe_simd_select(m, a, b) _mm256_blendv_ps((b), (a), (m)) // m ? a : b
+    #define fe_simd_movemask(m)     _mm256_movemask_ps(m)           // Şerit i'nin maskesi -> bit i
+    #define fe_simd_unpacklo(a, b)  _mm256_unpacklo_ps((a), (b))
+    #define fe_simd_unpackhi(a, b)  _mm256_unpackhi_ps((a), (b))
+    #define fe_simd_shuffle(a, b, s) _mm256_shuffle_ps((a), (b), (s))   // 128 bitlik yarılar içinde
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define FE_SIMD_WIDTH 4
+    typedef __m128 fe_simd_t;
+    #define fe_simd_load(p)         _mm_loadu_ps(p)
+    #define fe_simd_store(p, v)     _mm_storeu_ps((p), (v))
+    #define fe_simd_set1(x)         _mm_set1_ps(x)
+    #define fe_simd_zero()          _mm_setzero_ps()
+    #define fe_simd_add(a, b)       _mm_add_ps((a), (b))
+    #define fe_simd_sub(a, b)       _mm_sub_ps((a), (b))
+    #define fe_simd_mul(a, b)       _mm_mul_ps((a), (b))
+    #define fe_simd_div(a, b)       _mm_div_ps((a), (b))
+    #define fe_simd_sqrt(a)         _mm_sqrt_ps(a)
+    #define fe_simd_min(a, b)       _mm_min_ps((a), (b))
+    #define fe_simd_max(a, b)       _mm_max_ps((a), (b))
+    #define fe_simd_and(a, b)       _mm_and_ps((a), (b))
+    #define fe_simd_or(a, b)        _mm_or_ps((a), (b))
+    #define fe_simd_gt(a, b)        _mm_cmpgt_ps((a), (b))
+    #define fe_simd_le(a, b)        _mm_cmple_ps((a), (b))
+    #define fe_simd_select(m, a, b) _mm_or_ps(_mm_and_ps((m), (a)), _mm_andnot_ps((m), (b)))
+    #define fe_simd_movemask(m)     _mm_movemask_ps(m)
+    #define fe_simd_unpacklo(a, b)  _mm_unpacklo_ps((a), (b))
+    #define fe_simd_unpackhi(a, b)  _mm_unpackhi_ps((a), (b))
+    #define fe_simd_shuffle(a, b, s) _mm_shuffle_ps((a), (b), (s))
+#endif
+
+#ifdef FE_SIMD_WIDTH
+#include <stdint.h>
+
+/**
+ * @brief Dört kaydı yerinde devrik yapar (128 bitlik yarılar içinde 4x4).
+ * * Girişte r_j = j. kaydın (x, y, z, w) bileşenleri ise çıkışta r_0 = x'ler, ..., r_3 = w'ler; işlem kendi tersidir.
+ */
+static inline void fe_simd_transpose4(fe_simd_t* r0, fe_simd_t* r1, fe_simd_t* r2, fe_simd_t* r3) {
+    fe_simd_t t0 = fe_simd_unpacklo(*r0, *r1), t1 = fe_simd_unpacklo(*r2, *r3);
+    fe_simd_t t2 = fe_simd_unpackhi(*r0, *r1), t3 = fe_simd_unpackhi(*r2, *r3);
+    *r0 = fe_simd_shuffle(t0, t1, 0x44);
+    *r1 = fe_simd_shuffle(t0, t1, 0xEE);
+    *r2 = fe_simd_shuffle(t2, t3, 0x44);
+    *r3 = fe_simd_shuffle(t2, t3, 0xEE);
+}
+
+/**
+ * @brief FE_SIMD_WIDTH tane 4 float'lık kaydı indeksle toplar (gather): şerit i = records[idx[i]].
+ * * Her kayıt tek yüklemeyle okunur; skaler toplamaya göre yükleme sayısı dörtte birine iner.
+ */
+static inline void fe_simd_gather4(const float* records, const uint32_t* idx, fe_simd_t* x, fe_simd_t* y, fe_simd_t* z, fe_simd_t* w) {
+#if FE_SIMD_WIDTH == 8
+    *x = _mm256_set_m128(_mm_loadu_ps(records + 4 * (size_t)idx[4]), _mm_loadu_ps(records + 4 * (size_t)idx[0]));
+    *y = _mm256_set_m128(_mm_loadu_ps(records + 4 * (size_t)idx[5]), _mm_loadu_ps(records + 4 * (size_t)idx[1]));
+    *z = _mm256_set_m128(_mm_loadu_ps(records + 4 * (size_t)idx[6]), _mm_loadu_ps(records + 4 * (size_t)idx[2]));
+    *w = _mm256_set_m128(_mm_loadu_ps(records + 4 * (size_t)idx[7]), _mm_loadu_ps(records + 4 * (size_t)idx[3]));
+#else
+    *x = _mm_loadu_ps(records + 4 * (size_t)idx[0]);
+    *y = _mm_loadu_ps(records + 4 * (size_t)idx[1]);
+    *z = _mm_loadu_ps(records + 4 * (size_t)idx[2]);
+    *w = _mm_loadu_ps(records + 4 * (size_t)idx[3]);
+#endif
+    fe_simd_transpose4(x, y, z, w);
+}
+
+/**
+ * @brief fe_simd_gather4'ün tersi (scatter). İndeksler birbirinden farklı olmalıdır.
+ */
+static inline void fe_simd_scatter4(float* records, const uint32_t* idx, fe_simd_t x, fe_simd_t y, fe_simd_t z, fe_simd_t w) {
+    fe_simd_transpose4(&x, &y, &z, &w);
+#if FE_SIMD_WIDTH == 8
+    _mm_storeu_ps(records + 4 * (size_t)idx[0], _mm256_castps256_ps128(x));
+    _mm_storeu_ps(records + 4 * (size_t)idx[1], _mm256_castps256_ps128(y));
+    _mm_storeu_ps(records + 4 * (size_t)idx[2], _mm256_castps256_ps128(z));
+    _mm_storeu_ps(records + 4 * (size_t)idx[3], _mm256_castps256_ps128(w));
+    _mm_storeu_ps(records + 4 * (size_t)idx[4], _mm256_extractf128_ps(x, 1));
+    _mm_storeu_ps(records + 4 * (size_t)idx[5], _mm256_extractf128_ps(y, 1));
+    _mm_storeu_ps(records + 4 * (size_t)idx[6], _mm256_extractf128_ps(z, 1));
+    _mm_storeu_ps(records + 4 * (size_t)idx[7], _mm256_extractf128_ps(w, 1));
+#else
+    _mm_storeu_ps(records + 4 * (size_t)idx[0], x);
+    _mm_storeu_ps(records + 4 * (size_t)idx[1], y);
+    _mm_storeu_ps(records + 4 * (size_t)idx[2], z);
+    _mm_storeu_ps(records + 4 * (size_t)idx[3], w);
+#endif
+}
+#endif // FE_SIMD_WIDTH
+
+#endif // FE_SIMD_H
@@ -89,6 +89,8 @@ fe_vec2_t fe_vec2_add(fe_vec2_t a, fe_vec2_t b);
 
 // 4D Vektör (fe_vec4_t) işlemlerinin prototipleri (fe_vector.c'de uygulanacak)
 fe_vec4_t fe_vec4_add(fe_vec4_t a, fe_vec4_t b);
+fe_vec4_t fe_vec4_scale(fe_vec4_t v, float s);
+fe_vec4_t fe_vec4_normalize(fe_vec4_t v);
 // ...
 
 #endif // FE_VECTOR_H
\ No newline at end of file
@@ -0,0 +1,129 @@
+// include/memory/fe_allocator_linear.h
+
+#ifndef FE_ALLOCATOR_LINEAR_H
+#define FE_ALLOCATOR_LINEAR_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "error/fe_error.h"
+
+// ----------------------------------------------------------------------
+// 1. AYARLAR
+// ----------------------------------------------------------------------
+
+// Hizalama belirtilmediğinde kullanılan varsayılan hizalama (SIMD tipleri için yeterli)
+#define FE_LINEAR_DEFAULT_ALIGNMENT 16
+
+/**
+ * @brief Sıfırlama/geri sarma sırasında boşaltılan bölgeye yazılan desen.
+ * * Ömrü biten belleğin okunması, 0xCD.. gibi göze çarpan değerler üretir.
+ */
+#define FE_LINEAR_POISON_BYTE 0xCD
+
+/**
+ * @brief Debug derlemelerinde zehirleme (poisoning) varsayılan olarak açıktır.
+ * * Derleme sırasında -DFE_MEMORY_DEBUG_POISON=0/1 ile değiştirilebilir.
+ */
+#ifndef FE_MEMORY_DEBUG_POISON
+    #ifdef NDEBUG
+        #define FE_MEMORY_DEBUG_POISON 0
+    #else
+        #define FE_MEMORY_DEBUG_POISON 1
+    #endif
+#endif
+
+
+// ----------------------------------------------------------------------
+// 2. DOĞRUSAL (LINEAR / STACK) AYIRICI
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Geri sarma noktası: ayırıcının o anki doluluk ofseti.
+ */
+typedef size_t fe_linear_marker_t;
+
+/**
+ * @brief Doğrusal (bump) ayırıcı.
+ * * Tahsis O(1)'dir (bir hizalama ve toplama), tekil serbest bırakma yoktur; bellek
+ * * toplu olarak fe_linear_reset ile veya bir işarete (marker) geri sarılarak iade edilir.
+ * * İş parçacığı güvenli değildir; her örnek tek bir iş parçacığına aittir.
+ */
+typedef struct fe_linear_allocator {
+    uint8_t* start;             // Arabelleğin başlangıç adresi
+    size_t size;                // Arabelleğin toplam boyutu (byte)
+    size_t offset;              // Bir sonraki boş byte'ın ofseti
+    size_t peak;                // Başlatmadan beri görülen en yüksek doluluk (İzleme için)
+    bool poison_on_reset;       // true ise boşaltılan bölge FE_LINEAR_POISON_BYTE ile doldurulur
+} fe_linear_allocator_t;
+
+/**
+ * @brief Ayırıcıyı verilen arabellek üzerinde başlatır (heap tahsisi yapmaz).
+ * @return Başarı durumunda FE_OK.
+ */
+fe_error_code_t fe_linear_init(fe_linear_allocator_t* allocator, void* buffer, size_t buffer_size);
+
+/**
+ * @brief alignment'a (2'nin kuvveti) hizalı size byte tahsis eder.
+ * @return Blok adresi veya NULL (yer kalmadıysa).
+ */
+void* fe_linear_alloc_aligned(fe_linear_allocator_t* allocator, size_t size, size_t alignment);
+
+/**
+ * @brief FE_LINEAR_DEFAULT_ALIGNMENT hizalı size byte tahsis eder.
+ */
+void* fe_linear_alloc(fe_linear_allocator_t* allocator, size_t size);
+
+/**
+ * @brief O anki doluluğu işaret olarak döndürür (kapsam/scope başlangıcı).
+ */
+static inline fe_linear_marker_t fe_linear_get_marker(const fe_linear_allocator_t* allocator) {
+    return allocator->offset;
+}
+
+/**
+ * @brief Ayırıcıyı bir işarete geri sarar; işaretten sonra yapılan tüm tahsisler geçersiz olur.
+ */
+void fe_linear_rewind(fe_linear_allocator_t* allocator, fe_linear_marker_t marker);
+
+/**
+ * @brief Tüm tahsisleri tek seferde geçersiz kılar (fe_linear_rewind(allocator, 0)).
+ */
+void fe_linear_reset(fe_linear_allocator_t* allocator);
+
+
+// ----------------------------------------------------------------------
+// 3. ÇİFT TAMPONLU KARE ARENASI (FRAME ARENA)
+// ----------------------------------------------------------------------
+
+/**
+ * @brief İki doğrusal ayırıcıdan oluşan kare arenası.
+ * * N. karede yapılan tahsisler N+1. karenin sonuna kadar geçerlidir (örn: render
+ * * tarafının bir önceki karenin verisini okuması). Her kare başında sıradaki tampon
+ * * sıfırlanır ve etkin tampon olur.
+ */
+typedef struct fe_frame_arena {
+    fe_linear_allocator_t buffers[2];
+    uint32_t current;           // Etkin tamponun indeksi (0 veya 1)
+    uint64_t frame_index;       // fe_frame_arena_begin_frame çağrı sayısı
+} fe_frame_arena_t;
+
+/**
+ * @brief Arenayı verilen arabelleği iki eşit yarıya bölerek başlatır.
+ */
+fe_error_code_t fe_frame_arena_init(fe_frame_arena_t* arena, void* buffer, size_t buffer_size);
+
+/**
+ * @brief Yeni bir kare başlatır: diğer tamponu sıfırlar ve etkin yapar.
+ * * Ana döngüde her iterasyonda bir kez çağrılır.
+ */
+void fe_frame_arena_begin_frame(fe_frame_arena_t* arena);
+
+/**
+ * @brief Etkin karenin ayırıcısını döndürür (marker/rewind kapsamları için).
+ */
+static inline fe_linear_allocator_t* fe_frame_arena_current(fe_frame_arena_t* arena) {
+    return &arena->buffers[arena->current];
+}
+
+#endif // FE_ALLOCATOR_LINEAR_H
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include <stddef.h>
 #include <stdbool.h>
 #include "error/fe_error.h" // Hata kodları için
+#include "platform/fe_atomic.h" // Atomik referans sayacı ve kilitsiz serbest liste
 
 // --------------------------------------------------
 // SAHİPLİK (OWNERSHIP) VE ÖMÜR (LIFETIME) DESTEĞİ
@@ -20,7 +21,8 @@
 typedef struct fe_block_metadata {
     // Nesneye kaç pointer'ın sahip olduğunu (veya ödünç aldığını) takip eder.
     // 1'den fazla olursa, o anda birden fazla yerde kullanılıyor demektir (Ödünç Alma).
-    uint32_t ref_count;         
+    // Atomiktir: farklı iş parçacıkları aynı bloğu güvenle klonlayıp bırakabilir.
+    fe_atomic_u32_t ref_count;
     struct fe_allocator_pool* owner_pool; // Hangi havuzun bu bloğa sahip olduğunu belirtir
     // İleride daha karmaşık GC veya ömür takibi için buraya zaman damgası eklenebilir.
 } fe_block_metadata_t;
@@ -51,18 +53,23 @@ typedef struct fe_free_node {
 /**
  * @brief Bellek Havuzu Ayırıcısı (Pool Allocator).
  * * Hem Dinamik hem de Statik havuzları yönetir.
+ * * fe_pool_allocate ve fe_owned_ptr_release kilitsizdir (lock-free) ve herhangi bir
+ * * iş parçacığından çağrılabilir. Serbest liste etiketli (tagged) bir Treiber yığınıdır:
+ * * free_list'in alt 32 biti tepedeki bloğun indeksi (+1, 0 = boş), üst 32 biti ise
+ * * her değişiklikte artan ve ABA sorununu önleyen etikettir.
  */
 typedef struct fe_allocator_pool {
     size_t chunk_size;         // Tahsis edilecek her bir nesnenin boyutu (Byte).
+    size_t block_stride;       // Meta veri dahil bir bloğun gerçek boyutu (Byte).
     size_t block_count;        // Havuzdaki toplam blok sayısı.
     size_t total_size;         // Havuzun toplam boyutu (Byte).
     
     uint8_t* pool_start;       // Havuz belleğinin başlangıç adresi.
     bool is_dynamic;           // true ise, havuz kendisi heap'ten tahsis edilmiştir (Dinamik).
     
-    fe_free_node_t* free_list; // Kullanılmaya hazır serbest blokların listesinin başı.
+    fe_atomic_u64_t free_list; // Serbest blok yığınının etiketli tepesi (indeks + ABA etiketi).
     
-    size_t allocated_count;    // Şu anda tahsis edilmiş blok sayısı (İzleme için).
+    fe_atomic_u64_t allocated_count; // Şu anda tahsis edilmiş blok sayısı (İzleme için).
 } fe_allocator_pool_t;
 
 
@@ -0,0 +1,143 @@
+// include/memory/fe_allocator_size_class.h
+
+#ifndef FE_ALLOCATOR_SIZE_CLASS_H
+#define FE_ALLOCATOR_SIZE_CLASS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "error/fe_error.h"
+#include "platform/fe_atomic.h"
+
+// ----------------------------------------------------------------------
+// 1. BOYUT SINIFLARI (SIZE CLASSES)
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Boyut sınıfları: 16..128 byte arası 16'şar byte, sonrasında her 2'nin kuvveti
+ * * aralığı 4 eşit adıma bölünür (160, 192, 224, 256, 320, ... 32768). Boşa harcanan
+ * * alan en fazla ~%25'tir.
+ */
+#define FE_SIZE_CLASS_MIN_SIZE      16
+#define FE_SIZE_CLASS_MAX_SIZE      (32 * 1024)
+#define FE_SIZE_CLASS_COUNT         40
+
+/**
+ * @brief Bellek bölgesi 64 KB'lık "span"lere bölünür; her span tek bir boyut sınıfına aittir.
+ * * Bir bloğun sınıfı, adresinin ait olduğu span'in tablosundan O(1) bulunur (başlık yoktur).
+ */
+#define FE_SIZE_CLASS_SPAN_SHIFT    16
+#define FE_SIZE_CLASS_SPAN_SIZE     ((size_t)1 << FE_SIZE_CLASS_SPAN_SHIFT)
+
+// Global listeye tek seferde aktarılan blokların hedef toplam boyutu (byte)
+#define FE_SIZE_CLASS_BATCH_BYTES   (16 * 1024)
+#define FE_SIZE_CLASS_MAX_BATCH     64
+
+
+// ----------------------------------------------------------------------
+// 2. AYIRICI YAPISI (fe_size_class_allocator_t)
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Tek bir boyut sınıfının global (tüm iş parçacıklarınca paylaşılan) durumu.
+ * * batch_head kilitsiz bir Treiber yığınıdır: alt 32 bit yığının tepesindeki yığının
+ * * (batch) ilk bloğunun indeksi (+1), üst 32 bit ABA sorununu önleyen etikettir (tag).
+ */
+typedef struct fe_size_class_bin {
+    fe_atomic_u64_t batch_head;     // Etiketli (tagged) yığın tepesi
+    uint32_t block_size;            // Bu sınıfın blok boyutu (byte)
+    uint32_t batch_size;            // İş parçacığı önbelleği ile global yığın arasında taşınan blok sayısı
+    fe_atomic_u32_t span_count;     // Bu sınıfa ayrılmış span sayısı (İzleme için)
+    uint8_t padding[FE_CACHE_LINE_SIZE - sizeof(uint64_t) - 3 * sizeof(uint32_t)]; // Yanlış paylaşımı önler
+} fe_size_class_bin_t;
+
+/**
+ * @brief İş parçacığı güvenli, boyut sınıflı genel amaçlı ayırıcı.
+ * * Her iş parçacığının sınıf başına kilitsiz bir yerel önbelleği (thread cache) vardır;
+ * * ortak yol (fast path) hiçbir atomik işlem içermez. Önbellek boşaldığında global
+ * * yığından tek bir CAS ile bütün bir blok grubu (batch) alınır, dolduğunda geri verilir.
+ * * Global yığın da boşsa bölgeden yeni bir span atomik olarak ayrılır.
+ */
+typedef struct fe_size_class_allocator {
+    uint8_t* region_start;          // Blokların bulunduğu bölgenin başlangıcı (span hizalı değil, 64 byte hizalı)
+    size_t region_size;             // span_total * FE_SIZE_CLASS_SPAN_SIZE
+    uint8_t* span_class;            // Span başına boyut sınıfı tablosu [span_total] (arabelleğin başında tutulur)
+    uint32_t span_total;            // Bölgedeki toplam span sayısı
+    fe_atomic_u32_t span_next;      // Bir sonraki ayrılmamış span (atomik sayaç)
+    uint32_t generation;            // Her başlatmada değişir; eski iş parçacığı önbelleklerini geçersiz kılar
+    fe_size_class_bin_t bins[FE_SIZE_CLASS_COUNT];
+} fe_size_class_allocator_t;
+
+
+// ----------------------------------------------------------------------
+// 3. YÖNETİM VE İŞLEMLER
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Ayırıcıyı verilen (statik) arabellek üzerinde başlatır.
+ * * Arabellek ayırıcıdan uzun yaşamalıdır; ayırıcı kendisi hiç heap tahsisi yapmaz.
+ * @param allocator Başlatılacak ayırıcı.
+ * @param buffer Kullanılacak bellek (örn: main_memory_block içinden bir bölge).
+ * @param buffer_size Arabelleğin boyutu (en az bir span + tablo).
+ * @return Başarı durumunda FE_OK.
+ */
+fe_error_code_t fe_size_class_init(fe_size_class_allocator_t* allocator, void* buffer, size_t buffer_size);
+
+/**
+ * @brief Ayırıcıyı kullanım dışı bırakır.
+ * * İş parçacığı önbelleklerinde kalan bloklar bir sonraki kullanımda otomatik olarak
+ * * atılır. Bölgeden alınmış ve henüz serbest bırakılmamış bloklar geçersiz olur.
+ */
+void fe_size_class_destroy(fe_size_class_allocator_t* allocator);
+
+/**
+ * @brief size byte'lık (16 byte hizalı) bir blok tahsis eder.
+ * @return Blok adresi veya NULL (size > FE_SIZE_CLASS_MAX_SIZE ya da bölge doluysa).
+ */
+void* fe_size_class_alloc(fe_size_class_allocator_t* allocator, size_t size);
+
+/**
+ * @brief fe_size_class_alloc ile alınmış bir bloğu serbest bırakır.
+ * * Herhangi bir iş parçacığından çağrılabilir; blok çağıran iş parçacığının önbelleğine girer.
+ */
+void fe_size_class_free(fe_size_class_allocator_t* allocator, void* ptr);
+
+/**
+ * @brief Adresin bu ayırıcının bölgesine ait olup olmadığını döndürür.
+ */
+static inline bool fe_size_class_owns(const fe_size_class_allocator_t* allocator, const void* ptr) {
+    return allocator->region_start != NULL &&
+           (size_t)((const uint8_t*)ptr - allocator->region_start) < allocator->region_size;
+}
+
+/**
+ * @brief Bloğun kullanılabilir boyutunu (sınıf boyutu) döndürür. ptr bölgeye ait olmalıdır.
+ */
+size_t fe_size_class_usable_size(const fe_size_class_allocator_t* allocator, const void* ptr);
+
+/**
+ * @brief Çağıran iş parçacığının önbelleğindeki tüm blokları global yığınlara iade eder.
+ * * İş parçacıkları sonlanmadan önce çağırmalıdır; aksi halde önbellekteki bloklar
+ * * diğer iş parçacıkları tarafından yeniden kullanılamaz.
+ */
+void fe_size_class_thread_flush(fe_size_class_allocator_t* allocator);
+
+/**
+ * @brief Verilen boyutun sınıf indeksini döndürür (1 <= size <= FE_SIZE_CLASS_MAX_SIZE).
+ */
+static inline uint32_t fe_size_class_index(size_t size) {
+    if (size <= 128) {
+        return (uint32_t)((size - 1) >> 4);
+    }
+    size_t s = size - 1;
+#if defined(__GNUC__) || defined(__clang__)
+    uint32_t log2 = 63 - (uint32_t)__builtin_clzll((unsigned long long)s);
+#else
+    uint32_t log2 = 7;
+    while ((s >> (log2 + 1)) != 0) ++log2;
+#endif
+    // Her 2'nin kuvveti aralığı 4 alt sınıfa bölünür
+    return 8 + (log2 - 7) * 4 + (uint32_t)((s >> (log2 - 2)) & 3);
+}
+
+#endif // FE_ALLOCATOR_SIZE_CLASS_H
\ No newline at end of file
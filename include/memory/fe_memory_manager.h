@@ -6,12 +6,16 @@
 #include <stddef.h>
 #include "error/fe_error.h"
 #include "memory/fe_allocator_pool.h" // Havuz yapısını kullanacak
+#include "memory/fe_allocator_size_class.h" // Genel amaçlı boyut sınıflı ayırıcı
+#include "memory/fe_allocator_linear.h" // Kare arenası (Frame Arena)
 
 // Fiction Engine (FE) için gereken tahmini Toplam Bellek Miktarları (Byte)
 // Bu değerler, geliştirme sırasında motorun ihtiyacına göre ayarlanabilir.
 #define FE_MEMORY_SIZE_GENERAL          (128 * 1024 * 1024) // 128 MB Genel Kullanım
 #define FE_MEMORY_SIZE_GRAPHICS_DATA    (512 * 1024 * 1024) // 512 MB GPU'ya Gönderilecek Veri
 #define FE_MEMORY_SIZE_EDITOR_DATA      (64 * 1024 * 1024)  // 64 MB Editör UI Verisi
+#define FE_MEMORY_SIZE_SIZE_CLASS       (256 * 1024 * 1024) // 256 MB Boyut Sınıflı Genel Tahsisler (fe_mem_alloc)
+#define FE_MEMORY_SIZE_FRAME_ARENA      (64 * 1024 * 1024)  // 64 MB Kare Arenası (2 x 32 MB, fe_frame_alloc)
 
 /**
  * @brief Fiction Engine Merkezi Bellek Yöneticisi Yapısı.
@@ -27,7 +31,11 @@ typedef struct fe_memory_manager {
     fe_allocator_pool_t graphics_pool;      // GeometryV, DynamicR Verileri için Havuz (Büyük Chunks)
     fe_allocator_pool_t editor_pool;        // Editör Arayüz Nesneleri için Havuz (Küçük Chunks)
     
-    // İleride daha karmaşık tahsis ediciler (Stack/Linear Allocator vb.) buraya eklenebilir.
+    // 16 B - 32 KB arası tüm tahsisler için iş parçacığı güvenli ayırıcı (fe_mem_alloc)
+    fe_size_class_allocator_t general_allocator;
+    
+    // Kare başına geçici veriler için çift tamponlu doğrusal ayırıcı (fe_frame_alloc)
+    fe_frame_arena_t frame_arena;
 } fe_memory_manager_t;
 
 // Tekil (Singleton) Bellek Yöneticisinin dışarıdan erişilebilmesi için
@@ -52,4 +60,73 @@ void fe_memory_manager_shutdown(void);
  */
 fe_owned_ptr_t fe_mem_allocate_from_pool(fe_allocator_pool_t* pool);
 
+
+// ----------------------------------------------------------------------
+// GENEL AMAÇLI TAHSİS (malloc YERİNE)
+// ----------------------------------------------------------------------
+
+/**
+ * @brief malloc yerine kullanılır. FE_SIZE_CLASS_MAX_SIZE'a kadar olan istekler
+ * * general_allocator'dan (kilitsiz, iş parçacığı önbellekli) karşılanır; daha büyük
+ * * istekler veya yönetici başlatılmamışsa libc malloc kullanılır.
+ * * Dönen bellek fe_mem_free ile serbest bırakılmalıdır (free ile değil).
+ * * Ayırıcıdan alınan tüm bloklar fe_memory_manager_shutdown'dan önce serbest bırakılmalıdır.
+ */
+void* fe_mem_alloc(size_t size);
+
+/**
+ * @brief calloc karşılığı: count * size byte'lık sıfırlanmış bellek.
+ */
+void* fe_mem_calloc(size_t count, size_t size);
+
+/**
+ * @brief realloc karşılığı. Blok kendi sınıfına sığıyorsa aynı adres döner.
+ */
+void* fe_mem_realloc(void* ptr, size_t new_size);
+
+/**
+ * @brief fe_mem_alloc/calloc/realloc ile alınan belleği serbest bırakır (NULL güvenli).
+ */
+void fe_mem_free(void* ptr);
+
+/**
+ * @brief Çağıran iş parçacığının önbelleğini genel ayırıcıya iade eder.
+ * * Motorun iş parçacıkları sonlanmadan önce çağırmalıdır.
+ */
+void fe_mem_thread_shutdown(void);
+
+
+// ----------------------------------------------------------------------
+// KARE BAŞINA GEÇİCİ TAHSİS (FRAME ARENA)
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Yeni kareyi başlatır; iki kare önceki tahsisleri toplu olarak geçersiz kılar.
+ * * fe_application_run tarafından her iterasyonun başında çağrılır.
+ */
+void fe_memory_manager_begin_frame(void);
+
+/**
+ * @brief Kare arenasından size byte tahsis eder (O(1), serbest bırakma gerekmez).
+ * * Bellek bu kare ve bir sonraki kare boyunca geçerlidir. Sadece ana iş parçacığından
+ * * çağrılmalıdır. Arena doluysa NULL döner.
+ */
+void* fe_frame_alloc(size_t size);
+
+/**
+ * @brief fe_frame_alloc'un hizalama (2'nin kuvveti) belirtilen sürümü.
+ */
+void* fe_frame_alloc_aligned(size_t size, size_t alignment);
+
+/**
+ * @brief Geçici bir kapsam başlatır: dönen işaret fe_frame_rewind'a verildiğinde,
+ * * aradaki tüm kare tahsisleri geri alınır (iç içe kapsamlar desteklenir).
+ */
+fe_linear_marker_t fe_frame_get_marker(void);
+
+/**
+ * @brief Kare arenasını fe_frame_get_marker ile alınmış işarete geri sarar.
+ */
+void fe_frame_rewind(fe_linear_marker_t marker);
+
 #endif // FE_MEMORY_MANAGER_H
@@ -0,0 +1,174 @@
+// include/physics/fe_body_store.h
+
+#ifndef FE_BODY_STORE_H
+#define FE_BODY_STORE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "error/fe_error.h"
+#include "math/fe_vector.h"
+#include "physics/fe_rigid_body.h"
+
+// ----------------------------------------------------------------------
+// 1. TANIMLAR
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Depodaki bir cismin kalıcı tanıtıcısı (handle).
+ * * Yoğun indeks silmelerle değişir, tanıtıcı değişmez. Silinen cismin tanıtıcısı
+ * * nesil (generation) sayacı sayesinde geçersiz olur; yuva yeniden kullanılsa bile karışmaz.
+ */
+typedef struct fe_body_handle {
+    uint32_t slot;
+    uint32_t generation;
+} fe_body_handle_t;
+
+#define FE_BODY_HANDLE_NULL ((fe_body_handle_t){ UINT32_MAX, 0 })
+
+
+// ----------------------------------------------------------------------
+// 2. DEPO YAPISI
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Simüle edilen cisimlerin sıcak durumunun paketli SoA (Structure of Arrays) deposu.
+ * * Her alan ayrı, bitişik bir float dizisidir; entegrasyon SSE/AVX ile 4/8 cisim birden işler.
+ * * Durumu depoda yaşayan toplu cisimler içindir (kayıtlarla eşitleme sadece istenince yapılır:
+ * * fe_body_store_load_range / fe_body_store_save_range). Fizik yöneticisi bunu kullanmaz: onun
+ * * ana durumu fe_rigid_body_t kayıtlarıdır ve her adım yükle/geri yaz, SIMD'nin kazandırdığından
+ * * fazlasına mal oluyordu. Yoğun indeks (bodies[i]) silmelerde değişir; kalıcı referans tanıtıcıdır.
+ * * Depo cisimlerin awake_index alanına dokunmaz.
+ */
+typedef struct fe_body_store {
+    // Konum ve yönelim (kuaterniyon x, y, z, w)
+    float* position_x;
+    float* position_y;
+    float* position_z;
+    float* orientation_x;
+    float* orientation_y;
+    float* orientation_z;
+    float* orientation_w;
+
+    // Hızlar
+    float* linear_velocity_x;
+    float* linear_velocity_y;
+    float* linear_velocity_z;
+    float* angular_velocity_x;
+    float* angular_velocity_y;
+    float* angular_velocity_z;
+
+    // Adım başında kayıttan alınan kuvvet/tork birikimi
+    float* force_x;
+    float* force_y;
+    float* force_z;
+    float* torque_x;
+    float* torque_y;
+    float* torque_z;
+
+    // Kütle verisi (kinematik ve dışarıdan uyutulmuş cisimler için sıfır: fizik onları hareket ettirmez)
+    float* inverse_mass;
+    float* inverse_inertia_xx;  // Yerel ters eylemsizlik tensörü (simetrik 3x3'ün üst üçgeni)
+    float* inverse_inertia_xy;
+    float* inverse_inertia_xz;
+    float* inverse_inertia_yy;
+    float* inverse_inertia_yz;
+    float* inverse_inertia_zz;
+
+    fe_rigid_body_t** bodies;   // Yoğun indeks -> soğuk kayıt
+    uint32_t* dense_to_slot;    // Yoğun indeks -> tanıtıcı yuvası
+
+    uint32_t* slot_index;       // Yuva -> yoğun indeks (boş yuvalarda sonraki boş yuva)
+    uint32_t* slot_generation;  // Yuva dizileri de capacity elemanlıdır
+    uint32_t free_slot;
+
+    uint32_t count;
+    uint32_t capacity;
+} fe_body_store_t;
+
+
+// ----------------------------------------------------------------------
+// 3. YÖNETİM
+// ----------------------------------------------------------------------
+
+fe_error_code_t fe_body_store_init(fe_body_store_t* store, uint32_t initial_capacity);
+void fe_body_store_destroy(fe_body_store_t* store);
+
+/**
+ * @brief Cismi deponun sonuna ekler ve durumunu kayıttan yükler (kuvvet birikimi kayıtta kalır).
+ * @return Tanıtıcı veya bellek yetmezse FE_BODY_HANDLE_NULL.
+ */
+fe_body_handle_t fe_body_store_add(fe_body_store_t* store, fe_rigid_body_t* rb);
+
+/**
+ * @brief Cismi depodan çıkarır; son cisim boşalan yere taşınır (O(1)).
+ * * Durum kayda geri yazılmaz.
+ */
+void fe_body_store_remove(fe_body_store_t* store, fe_body_handle_t handle);
+
+/**
+ * @brief Tanıtıcının güncel yoğun indeksini döndürür (geçersizse UINT32_MAX).
+ */
+uint32_t fe_body_store_get_index(const fe_body_store_t* store, fe_body_handle_t handle);
+
+/**
+ * @brief Yoğun indeksteki cismin tanıtıcısını döndürür (index < count olmalı).
+ */
+static inline fe_body_handle_t fe_body_store_get_handle(const fe_body_store_t* store, uint32_t index) {
+    uint32_t slot = store->dense_to_slot[index];
+    return (fe_body_handle_t){ slot, store->slot_generation[slot] };
+}
+
+static inline fe_rigid_body_t* fe_body_store_get_body(const fe_body_store_t* store, fe_body_handle_t handle) {
+    uint32_t index = fe_body_store_get_index(store, handle);
+    return (index != UINT32_MAX) ? store->bodies[index] : NULL;
+}
+
+
+// ----------------------------------------------------------------------
+// 4. KAYITLARLA EŞİTLEME
+// ----------------------------------------------------------------------
+
+/**
+ * @brief [begin, end) aralığındaki cisimlerin durumunu kayıtlardan yükler ve kayıtlardaki kuvvet birikimini temizler.
+ */
+void fe_body_store_load_range(fe_body_store_t* store, uint32_t begin, uint32_t end);
+
+/**
+ * @brief [begin, end) aralığındaki cisimlerin konum, yönelim ve hızlarını kayıtlara geri yazar.
+ */
+void fe_body_store_save_range(fe_body_store_t* store, uint32_t begin, uint32_t end);
+
+static inline fe_vec3_t fe_body_store_get_linear_velocity(const fe_body_store_t* store, uint32_t index) {
+    return (fe_vec3_t){{ store->linear_velocity_x[index], store->linear_velocity_y[index], store->linear_velocity_z[index] }};
+}
+
+static inline fe_vec3_t fe_body_store_get_angular_velocity(const fe_body_store_t* store, uint32_t index) {
+    return (fe_vec3_t){{ store->angular_velocity_x[index], store->angular_velocity_y[index], store->angular_velocity_z[index] }};
+}
+
+static inline void fe_body_store_set_velocity(fe_body_store_t* store, uint32_t index, fe_vec3_t linear, fe_vec3_t angular) {
+    store->linear_velocity_x[index] = linear.x;
+    store->linear_velocity_y[index] = linear.y;
+    store->linear_velocity_z[index] = linear.z;
+    store->angular_velocity_x[index] = angular.x;
+    store->angular_velocity_y[index] = angular.y;
+    store->angular_velocity_z[index] = angular.z;
+}
+
+
+// ----------------------------------------------------------------------
+// 5. TOPLU ENTEGRASYON (SIMD)
+// ----------------------------------------------------------------------
+
+/**
+ * @brief v += (g + F / m) * dt, w += I_dünya^-1 * tau * dt; kuvvet birikimini sıfırlar.
+ * * Kinematik cisimler (inverse_mass = 0) etkilenmez. Paralel çağrılar ayrık aralıklarla yapılabilir.
+ */
+void fe_body_store_integrate_velocities(fe_body_store_t* store, uint32_t begin, uint32_t end, fe_vec3_t gravity, float dt);
+
+/**
+ * @brief x += v * dt, q += 0.5 * (w * q) * dt ve normalize; kinematik cisimler etkilenmez.
+ */
+void fe_body_store_integrate_positions(fe_body_store_t* store, uint32_t begin, uint32_t end, float dt);
+
+#endif // FE_BODY_STORE_H
@@ -0,0 +1,197 @@
+// include/physics/fe_broadphase.h
+
+#ifndef FE_BROADPHASE_H
+#define FE_BROADPHASE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "error/fe_error.h"
+#include "math/fe_vector.h"
+#include "physics/fe_collider.h" // fe_aabb_t
+
+// ----------------------------------------------------------------------
+// 1. AYARLAR
+// ----------------------------------------------------------------------
+
+#define FE_BROADPHASE_NULL_PROXY UINT32_MAX
+
+// Ağaç gezintisi yığını (en fazla ağaç yüksekliği + 1 eleman gerekir; SAH döndürmeleriyle
+// yükseklik pratikte birkaç log2(n) düzeyinde kalır).
+#define FE_BROADPHASE_STACK_SIZE 256
+
+/**
+ * @brief Yaprakların "şişman" (fat) AABB'lerine eklenen pay (metre).
+ * * Cisim şişman kutusunun içinde kaldıkça ağaç güncellenmez ve çifti yeniden aranmaz.
+ * * Duran ve yavaş cisimler için yeterli; hızlı cisimleri aşağıdaki öngörülü uzatma karşılar.
+ */
+#ifndef FE_BROADPHASE_AABB_MARGIN
+#define FE_BROADPHASE_AABB_MARGIN 0.1f
+#endif
+
+/**
+ * @brief Şişman kutu hareket yönünde (adım başı yer değiştirme * çarpan) kadar ayrıca uzatılır.
+ * * Düz giden bir cisim yaklaşık bu kadar adımda bir yeniden eklenir. Çarpan vekil başına
+ * * ±FE_BROADPHASE_DISPLACEMENT_JITTER oranında değişir: aynı anda oluşturulan cisimlerin
+ * * kutuları aynı adımda taşmaz, yeniden eklemeler adımlara yayılır.
+ */
+#ifndef FE_BROADPHASE_DISPLACEMENT_MULTIPLIER
+#define FE_BROADPHASE_DISPLACEMENT_MULTIPLIER 16.0f
+#endif
+#ifndef FE_BROADPHASE_DISPLACEMENT_JITTER
+#define FE_BROADPHASE_DISPLACEMENT_JITTER 0.25f
+#endif
+
+
+// ----------------------------------------------------------------------
+// 2. YAPILAR
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Dinamik AABB ağacının bir düğümü. Yapraklar bir vekile (proxy) karşılık gelir.
+ */
+typedef struct fe_broadphase_node {
+    fe_aabb_t aabb;             // Yapraklarda şişman AABB, iç düğümlerde çocukların birleşimi
+    void* user_data;            // Yaprağın sahibi (örn: fe_rigid_body_t*)
+    uint32_t parent;            // Serbest düğümlerde sonraki serbest düğüm
+    uint32_t child1;            // Yapraklarda FE_BROADPHASE_NULL_PROXY
+    uint32_t child2;
+    int16_t height;             // Yapraklarda 0, serbest düğümlerde -1
+    bool moved;                 // Bu adımda yeniden eklendi (yeni çiftler aranacak)
+} fe_broadphase_node_t;         // 48 bayt
+
+/**
+ * @brief Şişman AABB'leri kesişen aday çift (proxy_a < proxy_b).
+ * * Her çift iki ucunun çift listelerinde (çift yönlü bağlı) yer alır; [0] proxy_a'nın, [1] proxy_b'nin listesidir.
+ */
+typedef struct fe_broadphase_pair {
+    uint32_t proxy_a;
+    uint32_t proxy_b;
+    void* user_data_a;
+    void* user_data_b;
+    uint32_t next[2];           // Uçların listesinde sonraki çift (yoksa FE_BROADPHASE_NULL_PROXY)
+    uint32_t prev[2];           // Uçların listesinde önceki çift
+} fe_broadphase_pair_t;
+
+/**
+ * @brief Artımlı broadphase: yüzey alanı (SAH) sezgiseliyle ekleme ve döndürme yapılan dinamik AABB ağacı.
+ * * Her adımda sadece şişman kutusundan taşan vekiller ağaçta yeniden konumlanır ve
+ * * sadece onlar için yeni çift aranır. Çift listesi adımlar arasında korunur; şişman
+ * * kutuları artık kesişmeyen çiftler, taşınan vekillerin kendi çift listelerinden bulunup çıkarılır.
+ * * Bir adımın maliyeti taşınan vekillerle ve onların çiftleriyle orantılıdır; toplam çift sayısıyla değil.
+ */
+typedef struct fe_broadphase {
+    fe_broadphase_node_t* nodes;
+    uint32_t node_capacity;
+    uint32_t node_count;
+    uint32_t root;
+    uint32_t free_list;
+
+    uint32_t* move_buffer;      // Bu adımda taşınan vekiller
+    uint32_t move_count;
+    uint32_t move_capacity;
+
+    fe_broadphase_pair_t* pairs;
+    uint32_t pair_count;
+    uint32_t pair_capacity;
+    uint32_t* proxy_first_pair; // [node_capacity] Vekilin çift listesinin başı (liste oluşturulma sırasındadır)
+    uint32_t* proxy_last_pair;  // [node_capacity] Vekilin çift listesinin sonu
+    uint32_t* proxy_pair_count; // [node_capacity] Vekilin çift sayısı
+    uint32_t* proxy_stamp;      // [node_capacity] Sorgulanan vekilin eşleri query_stamp ile damgalanır (çift kontrolü)
+    uint32_t query_stamp;
+
+    uint64_t* removed_pairs;    // Son güncellemede düşen çiftler: (proxy_a << 32) | proxy_b
+    uint32_t removed_count;
+    uint32_t removed_capacity;
+} fe_broadphase_t;
+
+/**
+ * @brief Sorgu geri çağrısı. false dönerse sorgu durur.
+ */
+typedef bool (*fe_broadphase_query_callback_t)(void* context, uint32_t proxy_id);
+
+
+// ----------------------------------------------------------------------
+// 3. YÖNETİM VE İŞLEMLER
+// ----------------------------------------------------------------------
+
+fe_error_code_t fe_broadphase_init(fe_broadphase_t* broadphase);
+void fe_broadphase_destroy(fe_broadphase_t* broadphase);
+
+/**
+ * @brief Yeni bir vekil ekler.
+ * @param aabb Geometrinin sıkı (tight) AABB'si; şişman pay otomatik eklenir.
+ * @return Vekil kimliği veya FE_BROADPHASE_NULL_PROXY.
+ */
+uint32_t fe_broadphase_create_proxy(fe_broadphase_t* broadphase, const fe_aabb_t* aabb, void* user_data);
+
+/**
+ * @brief Vekili ve ona ait tüm çiftleri kaldırır. Maliyet vekilin çift sayısıyla orantılıdır.
+ */
+void fe_broadphase_destroy_proxy(fe_broadphase_t* broadphase, uint32_t proxy_id);
+
+/**
+ * @brief Vekilin sıkı AABB'sini günceller.
+ * * Kutu hâlâ şişman kutunun içindeyse hiçbir şey yapılmaz (ortak yol).
+ * @param displacement Bu adımdaki tahmini yer değiştirme (hız * dt); şişman kutuyu o yönde uzatır.
+ * @return Vekil ağaçta yeniden konumlandıysa true.
+ */
+bool fe_broadphase_move_proxy(fe_broadphase_t* broadphase, uint32_t proxy_id, const fe_aabb_t* aabb, fe_vec3_t displacement);
+
+/**
+ * @brief Taşınan vekiller için yeni çiftleri bulur ve artık geçersiz olanları çıkarır.
+ * * Her sabit adımda, tüm vekiller taşındıktan sonra bir kez çağrılır.
+ */
+void fe_broadphase_update_pairs(fe_broadphase_t* broadphase);
+
+/**
+ * @brief Mevcut çiftlerin üstüne en az extra_count çiftlik yer ayırır ve belleği önceden dokunur.
+ * * Çok sayıda çiftin aynı adımda oluşacağı biliniyorsa o adımda dizi büyütme ve sayfa hataları olmaz.
+ * @return Bellek ayrılamazsa false (mevcut kapasite korunur).
+ */
+bool fe_broadphase_reserve_pairs(fe_broadphase_t* broadphase, uint32_t extra_count);
+
+/**
+ * @brief Güncel aday çift listesini döndürür (bir sonraki güncellemeye kadar geçerlidir).
+ */
+static inline const fe_broadphase_pair_t* fe_broadphase_get_pairs(const fe_broadphase_t* broadphase, uint32_t* out_count) {
+    *out_count = broadphase->pair_count;
+    return broadphase->pairs;
+}
+
+/**
+ * @brief Son fe_broadphase_update_pairs'te şişman kutuları ayrıldığı için düşen çiftleri döndürür.
+ * * Anahtar (proxy_a << 32) | proxy_b'dir (proxy_a < proxy_b). fe_broadphase_destroy_proxy ile silinen çiftler listede yoktur.
+ */
+static inline const uint64_t* fe_broadphase_get_removed_pairs(const fe_broadphase_t* broadphase, uint32_t* out_count) {
+    *out_count = broadphase->removed_count;
+    return broadphase->removed_pairs;
+}
+
+static inline const fe_aabb_t* fe_broadphase_get_fat_aabb(const fe_broadphase_t* broadphase, uint32_t proxy_id) {
+    return &broadphase->nodes[proxy_id].aabb;
+}
+
+static inline void* fe_broadphase_get_user_data(const fe_broadphase_t* broadphase, uint32_t proxy_id) {
+    return broadphase->nodes[proxy_id].user_data;
+}
+
+/**
+ * @brief Vekilin çift listesinin ilk çiftinin indeksi (yoksa FE_BROADPHASE_NULL_PROXY).
+ * * Gezinti: for (i = first; i != NULL; i = fe_broadphase_next_pair(bp, i, proxy_id)). Liste bir sonraki
+ * * fe_broadphase_update_pairs veya vekil silinene kadar geçerlidir.
+ */
+static inline uint32_t fe_broadphase_first_pair(const fe_broadphase_t* broadphase, uint32_t proxy_id) {
+    return broadphase->proxy_first_pair[proxy_id];
+}
+
+static inline uint32_t fe_broadphase_next_pair(const fe_broadphase_t* broadphase, uint32_t pair_index, uint32_t proxy_id) {
+    const fe_broadphase_pair_t* pair = &broadphase->pairs[pair_index];
+    return pair->next[pair->proxy_a == proxy_id ? 0 : 1];
+}
+
+/**
+ * @brief Şişman AABB'si verilen kutuyla kesişen tüm vekiller için callback çağırır.
+ */
+void fe_broadphase_query(const fe_broadphase_t* broadphase, const fe_aabb_t* aabb, fe_broadphase_query_callback_t callback, void* context);
+
+#endif // FE_BROADPHASE_H
@@ -7,6 +7,47 @@
 #include <stdbool.h>
 #include "math/fe_vector.h"
 #include "data_structures/fe_array.h" // Parçacık ve kısıtlama koleksiyonları için
+#include "physics/fe_collider.h"
+#include "physics/fe_broadphase.h"
+
+// ----------------------------------------------------------------------
+// 0. AYARLAR
+// ----------------------------------------------------------------------
+
+/**
+ * @brief fe_cloth_create_plane'in XPBD uyum (compliance) değerleri (m/N, ters sertlik).
+ * * 0 uzamayan kısıtlamadır. Uyum zaman adımından ve yineleme sayısından bağımsız bir malzeme
+ * * özelliğidir: yineleme sayısı sadece bu hedefe ne kadar yaklaşıldığını belirler.
+ */
+#define FE_CLOTH_STRUCTURAL_COMPLIANCE 0.0f
+#define FE_CLOTH_SHEAR_COMPLIANCE 1e-6f
+#define FE_CLOTH_BENDING_COMPLIANCE 1e-4f
+
+/**
+ * @brief En fazla renk (paralel grup) sayısı.
+ * * Parçacığın kullandığı renkler 32 bitlik maskede tutulur. Renk bulamayan kısıtlamalar
+ * * (bir parçacığa 32'den fazla kısıtlama bağlıysa) taşma grubuna düşer ve sıralı çözülür.
+ */
+#define FE_CLOTH_MAX_COLORS 32
+
+/**
+ * @brief Kendi kendine çarpışmada parçacık başına tutulan en fazla aday komşu.
+ * * Adaylar adım başında, tahmin edilen konumlarda collision_thickness'in iki katı
+ * * yarıçapla aranır; dinlenme konumunda kalınlığın üç katından yakın parçacıklar (kumaşta
+ * * komşu olanlar) elenir, onları uzaklık kısıtlamaları tutar. Çift sadece bir uçta tutulur:
+ * * iki katman üst üste yattığında bir parçacık diğer katmanın ~13 parçacığını görebilir.
+ */
+#define FE_CLOTH_MAX_SELF_NEIGHBORS 24
+
+/**
+ * @brief Kısıtlama çözücüsü.
+ */
+typedef enum fe_cloth_solver_type {
+    FE_CLOTH_SOLVER_XPBD = 0,   // Uyumlu (compliant) XPBD: renklere ayrılmış, SIMD ve iş parçacıklı
+    FE_CLOTH_SOLVER_PBD,        // Sertlik katsayılı sıralı PBD (davranış yineleme sayısıyla değişir)
+    FE_CLOTH_SOLVER_COUNT
+} fe_cloth_solver_type_t;
+
 
 // ----------------------------------------------------------------------
 // 1. TEMEL YAPILAR
@@ -31,7 +72,8 @@ typedef struct fe_cloth_constraint {
     uint32_t p1_index;          // Birinci parçacigin indeksi
     uint32_t p2_index;          // Ikinci parçacigin indeksi
     float rest_length;          // Yayin serbest (ideal) uzunlugu
-    float stiffness;            // Yay sertligi
+    float stiffness;            // Yay sertligi (PBD; 0 - 1, yineleme başına düzeltme oranı)
+    float compliance;           // Ters sertlik (XPBD; m/N, 0 = uzamaz)
     // Not: PBD yaklasiminda damping genellikle ayri ele alinir.
 } fe_cloth_constraint_t;
 
@@ -39,6 +81,91 @@ typedef struct fe_cloth_constraint {
 // 2. KUMAŞ YAPISI
 // ----------------------------------------------------------------------
 
+/**
+ * @brief Bir adım boyunca kumaşın çarpıştığı katı cisim geometrisi (dünya uzayında).
+ */
+typedef struct fe_cloth_shape {
+    fe_collider_type_t type;
+    fe_vec3_t center;
+    fe_vec3_t axis[3];          // Yerel eksenlerin dünya yönleri
+    fe_vec3_t half_extents;     // Kutu
+    float radius;               // Küre, kapsül
+    float half_height;          // Kapsül (yerel Y ekseni boyunca)
+    float min_extent;           // Sürekli testin örnek aralığı için
+    fe_aabb_t bounds;           // Kumaş kalınlığı kadar genişletilmiş
+} fe_cloth_shape_t;
+
+/**
+ * @brief Kendi kendine çarpışmanın bir aday çifti.
+ */
+typedef struct fe_cloth_self_pair {
+    uint32_t a;
+    uint32_t b;
+    fe_vec3_t normal;           // Adım başında b'den a'ya birim yön (birbirinin içinden geçen çiftler buna geri itilir)
+} fe_cloth_self_pair_t;
+
+/**
+ * @brief XPBD çözücüsünün sıcak durumu (parçacıklar vec4 kayıtları, kısıtlamalar SoA).
+ * * Parçacık kayıtları adım başında buraya yüklenir ve adım sonunda bir kez geri yazılır.
+ * * Kısıtlamalar ortak parçacık paylaşmayan renklere ayrılmış olarak tutulur: bir rengin
+ * * kısıtlamaları SIMD şeritlerinde ve iş parçacıklarında aynı anda çözülür, renkler sırayla.
+ * * Sonuç iş parçacığı sayısından bağımsızdır.
+ */
+typedef struct fe_cloth_xpbd {
+    // Parçacıklar (tek blokta). Ters kütle konumla aynı kayıttadır: bir kısıtlama ucu tek yüklemeyle okunur
+    fe_vec4_t* position;        // x, y, z ve w = ters kütle (sabit parçacıklarda 0)
+    fe_vec3_t* prev_position;
+    fe_vec3_t* rest_position;   // Boyama anındaki konumlar (kendi kendine çarpışmada komşuları elemek için)
+    uint32_t particle_count;
+    uint32_t particle_capacity;
+
+    // Kısıtlamalar, renklere göre gruplanmış (tek blokta)
+    uint32_t* p1_index;
+    uint32_t* p2_index;
+    float* rest_length;
+    float* compliance;
+    float* lambda;              // Adım boyunca biriken Lagrange çarpanı
+    uint32_t constraint_count;
+    uint32_t constraint_capacity;
+
+    // [color_start[c], color_start[c + 1]) c. rengin kısıtlamalarıdır; FE_CLOTH_MAX_COLORS. grup taşmadır
+    uint32_t color_start[FE_CLOTH_MAX_COLORS + 2];
+    uint32_t color_count;       // Taşma hariç kullanılan renk sayısı
+    uint32_t built_count;       // Boyamanın yapıldığı kayıt sayısı (değişirse yeniden boyanır)
+
+    // Katı cisim çarpışması: bu adımda kumaşın sınırlarına giren geometriler
+    fe_cloth_shape_t* shapes;
+    uint32_t shape_count;
+    uint32_t shape_capacity;
+
+    // Kendi kendine çarpışma: parçacık uzamsal karması (tek blokta) ve aday çiftler
+    uint32_t* hash_start;       // Karma hücresi -> hash_entries içindeki başlangıç (hash_mask + 2 eleman)
+    uint32_t* hash_entries;     // Hücrelere göre sıralanmış parçacık indeksleri, sonra çift boyamasında renk maskeleri
+    uint32_t* neighbor_count;   // Kurulum sırasında parçacığın hücresi, sonra aday komşu sayısı
+    uint32_t* neighbors;        // Parçacık başına FE_CLOTH_MAX_SELF_NEIGHBORS aday (her çift tek bir uçta)
+    uint32_t hash_mask;
+    uint32_t hash_capacity;     // Karmanın ayrıldığı parçacık sayısı
+    // Çiftler de kısıtlamalar gibi renklere göre gruplanır: [self_color_start[c], self_color_start[c + 1])
+    // c. rengin çiftleridir, FE_CLOTH_MAX_COLORS. grup taşmadır (sıralı çözülür)
+    fe_cloth_self_pair_t* pairs;
+    uint8_t* pair_color;        // Kurulum sırasında aday başına renk (pairs ile aynı blokta)
+    uint32_t pair_count;
+    uint32_t pair_capacity;
+    uint32_t self_color_start[FE_CLOTH_MAX_COLORS + 2];
+    uint32_t self_color_count;
+
+    // Adım boyunca iş parçalarının paylaştığı durum
+    uint32_t batch_offset;      // Çözülen rengin başlangıcı
+    float alpha_scale;          // 1 / dt^2
+    float dt;
+    fe_vec3_t gravity;
+    float damping;
+    float thickness;
+    fe_vec3_t mean_velocity;    // Kendi kendine çarpışmada hızlar buna göre sınırlanır
+    float max_relative_speed;   // Kapalıysa FLT_MAX
+    bool continuous;            // Çarpışma geçişi parçacığın adım boyunca yolunu da test eder
+} fe_cloth_xpbd_t;
+
 /**
  * @brief Tek bir kumas nesnesini (Mesh) temsil eder.
  */
@@ -51,7 +178,14 @@ typedef struct fe_cloth {
     fe_vec3_t wind_velocity;    // Kumaşa etki eden yerel rüzgar hizi
     float damping_factor;       // Hizin sönümleme çarpanı (0.0 - 1.0)
     uint32_t constraint_iterations; // Kısıtlama çözücü adim sayisi (Kaliteyi belirler)
+    fe_cloth_solver_type_t solver_type; // Varsayılan: FE_CLOTH_SOLVER_XPBD
+
+    // Çarpışma (sadece XPBD çözücüsü)
+    const fe_broadphase_t* collision_broadphase; // NULL değilse kumaş bu ağaçtaki cisimlerle çarpışır (örn: fe_physics_manager_get_broadphase)
+    float collision_thickness;  // Parçacıkların yüzeylerden ve birbirinden uzak tutulduğu mesafe (varsayılan: ızgara aralığı)
+    bool self_collision;        // Kendi kendine çarpışma (varsayılan: kapalı)
 
+    fe_cloth_xpbd_t xpbd;       // fe_cloth_simulate_step tarafından yönetilir
 } fe_cloth_t;
 
 
@@ -83,6 +217,10 @@ void fe_cloth_fix_particle(fe_cloth_t* cloth, uint32_t p_index);
 /**
  * @brief Kumas simülasyonunu tek bir sabit adimda ilerletir.
  * * Bu, fe_physics_manager_step içinde tüm kumaslar için çagrilacaktir.
+ * * XPBD'de kısıtlama listesi değiştiyse (eklendi/çıkarıldı) renkler ilk adımda yeniden hesaplanır.
+ * * Katı cisimlerle çarpışma tek yönlüdür: kumaş cisimleri itmez. Cisimler o anki dönüşümleriyle
+ * * kullanılır, bu yüzden fizik adımından sonra çağrılması önerilir. Parçacık yolu adım boyunca
+ * * örneklenir (sürekli çarpışma); hızlı parçacıklar ince geometrilerin içinden geçmez.
  * @param cloth Kumas nesnesi.
  * @param gravity Yerçekimi kuvveti.
  * @param dt Zaman adimi.
@@ -0,0 +1,168 @@
+// include/physics/fe_collider.h
+
+#ifndef FE_COLLIDER_H
+#define FE_COLLIDER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "math/fe_vector.h"
+
+// ----------------------------------------------------------------------
+// 1. EKSEN HİZALI SINIRLAYICI KUTU (AABB)
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Dünya uzayında eksen hizalı sınırlayıcı kutu.
+ */
+typedef struct fe_aabb {
+    fe_vec3_t min;
+    fe_vec3_t max;
+} fe_aabb_t;
+
+/**
+ * @brief İki kutunun kesişip kesişmediğini döndürür (sınırlar dahil).
+ */
+static inline bool fe_aabb_overlaps(const fe_aabb_t* a, const fe_aabb_t* b) {
+    return a->min.x <= b->max.x && a->max.x >= b->min.x &&
+           a->min.y <= b->max.y && a->max.y >= b->min.y &&
+           a->min.z <= b->max.z && a->max.z >= b->min.z;
+}
+
+/**
+ * @brief outer kutusunun inner kutusunu tamamen içerip içermediğini döndürür.
+ */
+static inline bool fe_aabb_contains(const fe_aabb_t* outer, const fe_aabb_t* inner) {
+    return outer->min.x <= inner->min.x && outer->min.y <= inner->min.y && outer->min.z <= inner->min.z &&
+           inner->max.x <= outer->max.x && inner->max.y <= outer->max.y && inner->max.z <= outer->max.z;
+}
+
+/**
+ * @brief İki kutuyu kapsayan en küçük kutuyu döndürür.
+ */
+static inline fe_aabb_t fe_aabb_union(const fe_aabb_t* a, const fe_aabb_t* b) {
+    fe_aabb_t result;
+    result.min.x = a->min.x < b->min.x ? a->min.x : b->min.x;
+    result.min.y = a->min.y < b->min.y ? a->min.y : b->min.y;
+    result.min.z = a->min.z < b->min.z ? a->min.z : b->min.z;
+    result.max.x = a->max.x > b->max.x ? a->max.x : b->max.x;
+    result.max.y = a->max.y > b->max.y ? a->max.y : b->max.y;
+    result.max.z = a->max.z > b->max.z ? a->max.z : b->max.z;
+    return result;
+}
+
+/**
+ * @brief Kutunun yüzey alanı (ağaç yapımında SAH maliyeti olarak kullanılır).
+ */
+static inline float fe_aabb_surface_area(const fe_aabb_t* a) {
+    float dx = a->max.x - a->min.x;
+    float dy = a->max.y - a->min.y;
+    float dz = a->max.z - a->min.z;
+    return 2.0f * (dx * dy + dy * dz + dz * dx);
+}
+
+/**
+ * @brief Birim kuaterniyondan (x, y, z, w) 3x3 dönüş matrisini satır düzeninde hesaplar.
+ * * Sütunlar, yerel eksenlerin dünya uzayındaki yönleridir.
+ */
+static inline void fe_physics_quat_to_rows(fe_vec4_t q, fe_vec3_t rows[3]) {
+    float xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+    float xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+    float wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+
+    rows[0] = (fe_vec3_t){{1.0f - 2.0f * (yy + zz), 2.0f * (xy - wz), 2.0f * (xz + wy)}};
+    rows[1] = (fe_vec3_t){{2.0f * (xy + wz), 1.0f - 2.0f * (xx + zz), 2.0f * (yz - wx)}};
+    rows[2] = (fe_vec3_t){{2.0f * (xz - wy), 2.0f * (yz + wx), 1.0f - 2.0f * (xx + yy)}};
+}
+
+/**
+ * @brief Kuaterniyon çarpımı a * b (önce b, sonra a döndürmesi).
+ */
+static inline fe_vec4_t fe_physics_quat_multiply(fe_vec4_t a, fe_vec4_t b) {
+    return (fe_vec4_t){{
+        a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+        a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+        a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w,
+        a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z
+    }};
+}
+
+/**
+ * @brief Birim kuaterniyonun eşleniği (ters döndürme).
+ */
+static inline fe_vec4_t fe_physics_quat_conjugate(fe_vec4_t q) {
+    return (fe_vec4_t){{-q.x, -q.y, -q.z, q.w}};
+}
+
+
+// ----------------------------------------------------------------------
+// 2. ÇARPIŞTIRICI (COLLIDER) BİLEŞENİ
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Desteklenen çarpışma geometrileri.
+ */
+typedef enum fe_collider_type {
+    FE_COLLIDER_SPHERE = 0,
+    FE_COLLIDER_BOX,
+    FE_COLLIDER_CAPSULE,        // Yerel Y ekseni boyunca uzanan kapsül
+    FE_COLLIDER_TYPE_COUNT
+} fe_collider_type_t;
+
+/**
+ * @brief Bir katı cismin çarpışma geometrisi.
+ * * Geometri cismin yerel uzayında tanımlanır; local_offset kadar kaydırılmış, cismin
+ * * yönelimiyle döndürülmüş olarak dünyaya yerleşir.
+ */
+typedef struct fe_collider {
+    fe_collider_type_t type;
+    union {
+        struct { float radius; } sphere;
+        struct { fe_vec3_t half_extents; } box;
+        struct { float radius; float half_height; } capsule; // half_height: yarım küre merkezleri arası mesafenin yarısı
+    } shape;
+
+    fe_vec3_t local_offset;     // Geometri merkezinin cismin kütle merkezine göre konumu
+
+    // Broadphase durumu (fizik yöneticisi tarafından yönetilir)
+    uint32_t proxy_id;          // FE_BROADPHASE_NULL_PROXY ise henüz broadphase'e eklenmemiş
+    fe_aabb_t world_aabb;       // Son adımda hesaplanan dünya uzayı AABB'si (süpürülen cisimlerde adımın sonunu da kapsar)
+    fe_vec3_t sweep;            // Bu adımda süpürülen yer değiştirme (sürekli çarpışmalı hızlı cisimler); diğerlerinde 0
+} fe_collider_t;
+
+/**
+ * @brief Küre çarpıştırıcı oluşturur.
+ */
+fe_collider_t* fe_collider_create_sphere(float radius);
+
+/**
+ * @brief Kutu çarpıştırıcı oluşturur.
+ * @param half_extents Kutunun yerel eksenlerdeki yarı boyutları.
+ */
+fe_collider_t* fe_collider_create_box(fe_vec3_t half_extents);
+
+/**
+ * @brief Kapsül çarpıştırıcı oluşturur (yerel Y ekseni boyunca).
+ * @param radius Kapsül yarıçapı.
+ * @param half_height Silindirik kısmın yarı yüksekliği.
+ */
+fe_collider_t* fe_collider_create_capsule(float radius, float half_height);
+
+/**
+ * @brief Çarpıştırıcıyı bellekten serbest bırakır.
+ */
+void fe_collider_destroy(fe_collider_t* collider);
+
+/**
+ * @brief Çarpıştırıcının verilen dönüşümdeki dünya uzayı AABB'sini hesaplar.
+ * @param position Cismin dünya konumu.
+ * @param orientation Cismin yönelimi (kuaterniyon x, y, z, w).
+ */
+void fe_collider_compute_aabb(const fe_collider_t* collider, fe_vec3_t position, fe_vec4_t orientation, fe_aabb_t* out_aabb);
+
+/**
+ * @brief Geometrinin en ince yarı kalınlığı (küre/kapsül yarıçapı, kutunun en küçük yarı boyutu).
+ * * Bir adımda bundan az yol alan cisim, ayrık tespitte hiçbir yüzeyin içinden geçemez.
+ */
+float fe_collider_get_min_extent(const fe_collider_t* collider);
+
+#endif // FE_COLLIDER_H
@@ -0,0 +1,302 @@
+// include/physics/fe_collision_solver.h
+
+#ifndef FE_COLLISION_SOLVER_H
+#define FE_COLLISION_SOLVER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "error/fe_error.h"
+#include "math/fe_vector.h"
+#include "physics/fe_rigid_body.h"
+#include "physics/fe_broadphase.h"   // Çift listeleri
+#include "physics/fe_narrowphase.h"  // FE_NARROWPHASE_MAX_POINTS
+#include "data_structures/fe_hashmap.h"
+
+// ----------------------------------------------------------------------
+// 1. AYARLAR
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Adım başına alt adım sayısı. Dar faz adımda bir kez çalışır; alt adımlar yerçekimini
+ * * parçalar halinde ekler, ayrılmayı cisimlerin yer değiştirmesinden günceller ve çözer.
+ * * Tek adımda 8 yineleme 30 sıralık bir yığının ağırlığını tabana taşıyamaz; 4 alt adımda taşır.
+ */
+#define FE_SOLVER_SUBSTEPS 4
+
+// Alt adım başına hız yinelemesi (itmeli). Toplam: FE_SOLVER_SUBSTEPS * FE_SOLVER_VELOCITY_ITERATIONS
+#define FE_SOLVER_VELOCITY_ITERATIONS 2
+
+/**
+ * @brief Alt adım başına, konum ilerletildikten sonra itmesiz yapılan yineleme sayısı.
+ * * İtme hızı konumu düzeltir ama hızda kalırsa sonraki alt adıma enerji olarak taşınır; yüksek
+ * * yığınlar bu enerjiyle titreyip dağılır. Gevşetme bu hızı söker.
+ */
+#define FE_SOLVER_RELAX_ITERATIONS 1
+
+// Yumuşak temasın itme frekansı (Hz) ve sönüm oranı: iç içe geçme bir yay-sönümleyici gibi kapanır
+#define FE_SOLVER_CONTACT_HERTZ 30.0f
+#define FE_SOLVER_CONTACT_DAMPING_RATIO 10.0f
+
+// İç içe geçmeyi düzeltirken verilebilecek en büyük ayrılma hızı (m/s); derin geçmeler patlamaz
+#define FE_SOLVER_MAX_PUSH_VELOCITY 3.0f
+
+// Düzeltilmeyen iç içe geçme payı (metre). Temasın her adım açılıp kapanmasını (titreme) önler.
+#define FE_SOLVER_LINEAR_SLOP 0.005f
+
+// Bu yaklaşma hızının (m/s) altında sekme uygulanmaz (duran cisimler zıplamaz)
+#define FE_SOLVER_RESTITUTION_THRESHOLD 1.0f
+
+/**
+ * @brief Yeni temas noktasının önceki adımdaki bir noktayla eşleşmesi için A'nın yerel uzayındaki
+ * * en fazla uzaklık (metre). Eşleşen noktalar biriken impulslarını devralır (sıcak başlatma).
+ */
+#define FE_SOLVER_MATCH_DISTANCE 0.05f
+
+
+// ----------------------------------------------------------------------
+// 2. YAPILAR
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Kalıcı manifolddaki bir temas noktası.
+ */
+typedef struct fe_contact_point {
+    fe_vec3_t local_a;          // A'nın yerel uzayında temas noktası (adımlar arası eşleştirme)
+    float penetration;          // > 0: iç içe geçme, < 0: öngörülü temas boşluğu
+
+    // Adımlar arasında korunan biriken impulslar (alt adım başına; sıcak başlatma)
+    float normal_impulse;
+    float tangent_impulse[2];
+
+    // Adım başına ön hesaplar
+    fe_vec3_t r_a;              // Kütle merkezlerinden temas noktasına
+    fe_vec3_t r_b;
+
+    // Yön başına açısal Jacobian satırları ([0]: normal, [1], [2]: teğetler). Yinelemeler çapraz
+    // çarpım ve matris çarpımı yapmaz; bağıl hız nokta çarpımı, impuls ölçekli toplamadır.
+    fe_vec3_t ra_cross[3];      // r_a x d
+    fe_vec3_t rb_cross[3];      // r_b x d
+    fe_vec3_t ia_ra_cross[3];   // IA^-1 (r_a x d): birim impulsun A'nın açısal hızına etkisi
+    fe_vec3_t ib_rb_cross[3];   // IB^-1 (r_b x d)
+    float normal_mass;
+    float tangent_mass[2];
+    float relative_velocity;    // Adım başındaki normal bağıl hız (sekme hedefi)
+    float max_normal_impulse;   // Adım boyunca en büyük normal impuls (sadece itilen noktalar seker)
+} fe_contact_point_t;
+
+/**
+ * @brief Bir cisim çiftinin kalıcı temas manifoldu ve çözücü durumu.
+ * * Broadphase çifti yaşadığı sürece adımlar arasında korunur.
+ */
+typedef struct fe_contact_constraint {
+    fe_rigid_body_t* body_a;
+    fe_rigid_body_t* body_b;
+    uint64_t key;               // (proxy_a << 32 | proxy_b)
+    uint32_t last_frame;        // Çiftin broadphase'te son görüldüğü adım
+
+    fe_vec3_t normal;           // A'dan B'ye
+    fe_vec3_t tangent[2];
+    float friction;             // fe_material_combine_static_friction
+    float restitution;          // fe_material_combine_restitution
+
+    uint32_t point_count;
+    fe_contact_point_t points[FE_NARROWPHASE_MAX_POINTS];
+
+    // Adım başına kütle verisi (statik/kinematik cisimler için sıfır)
+    float inv_mass_a;
+    float inv_mass_b;
+    fe_vec3_t inv_inertia_a[3]; // Dünya uzayı ters eylemsizlik tensörü (satırlar)
+    fe_vec3_t inv_inertia_b[3];
+    uint32_t index_a;           // Uyanık listedeki yoğun indeks (listede değilse UINT32_MAX)
+    uint32_t index_b;
+} fe_contact_constraint_t;
+
+/**
+ * @brief Çözüm boyunca bir cismin hızları.
+ * * Çözücü cisimleri temas sırasıyla (rastgele) gezer; iki hız bitişik tutulur ki her cisim
+ * * tek önbellek satırından okunsun.
+ */
+typedef struct fe_solver_velocity {
+    fe_vec3_t linear;
+    fe_vec3_t angular;
+} fe_solver_velocity_t;
+
+/**
+ * @brief Ardışık impuls (sequential impulse) temas çözücüsü.
+ */
+typedef struct fe_collision_solver {
+    fe_contact_constraint_t* constraints;
+    uint32_t constraint_count;
+    uint32_t constraint_capacity;
+    fe_hashmap_t* constraint_map; // Anahtar: çift anahtarı, Değer: constraints içindeki indeks
+
+    // Temasları yok sayılan cisim çiftleri (örn: eklemle bağlı kemikler). Anahtar: sıralı cisim
+    // adresleri, Değer: başvuru sayısı (aynı iki cismi birden çok eklem bağlayabilir)
+    fe_hashmap_t* ignored_pairs;
+    uint32_t ignored_pair_count;
+
+    // Bu adımda en az bir ucu uyanık dinamik cisim olan manifoldlar. Dar faz ve çözüm sadece
+    // bunlar üzerinde çalışır; uyuyan adaların manifoldları (impulslarıyla birlikte) olduğu gibi bekler.
+    uint32_t* active_constraints;
+    uint32_t active_count;
+    uint32_t active_capacity;
+
+    // Uyanık cisimlerin çözüm hızları (awake_index'e göre); fe_collision_solver_load_velocities ile doldurulur
+    fe_solver_velocity_t* velocities;
+    fe_solver_velocity_t* displacements; // Adım başından beri yer değiştirme (linear: konum, angular: küçük açılı dönme)
+    float* inverse_masses;               // Çözümdeki ters kütleler (kinematik ve dışarıdan uyutulmuş cisimler için 0)
+    uint32_t velocity_count;
+    uint32_t velocity_capacity;
+
+    // Adımın zamanlaması ve yumuşak temas katsayıları (fe_collision_solver_load_velocities hesaplar)
+    float dt;
+    float substep_dt;
+    float inv_substep;
+    float bias_rate;
+    float mass_scale;
+    float impulse_scale;
+
+    uint32_t frame;
+    uint32_t substep_count;
+    uint32_t velocity_iterations; // Alt adım başına
+    uint32_t relax_iterations;    // Alt adım başına; 0: itme hızı sonraki alt adıma taşınır
+    bool warm_starting;         // Kapatılırsa impulslar her adım sıfırdan başlar (karşılaştırma için)
+} fe_collision_solver_t;
+
+
+// ----------------------------------------------------------------------
+// 3. YÖNETİM VE İŞLEMLER
+// ----------------------------------------------------------------------
+
+fe_error_code_t fe_collision_solver_init(fe_collision_solver_t* solver);
+void fe_collision_solver_destroy(fe_collision_solver_t* solver);
+
+/**
+ * @brief Mevcut manifoldların üstüne en az extra_count manifoldluk yer ayırır ve belleği önceden dokunur.
+ * * Çok sayıda çiftin aynı adımda açılacağı biliniyorsa (örn: kırılma) o adımda dizi büyütme,
+ * * kopyalama ve sayfa hataları olmaz.
+ * @return Bellek ayrılamazsa false (mevcut kapasite korunur).
+ */
+bool fe_collision_solver_reserve(fe_collision_solver_t* solver, uint32_t extra_count);
+
+/**
+ * @brief Uyanık cisimlerin broadphase çiftlerinden kalıcı manifoldları günceller.
+ * * Sadece bodies listesindeki cisimlerin çift listeleri gezilir ve sadece broadphase'in son güncellemede
+ * * düşürdüğü çiftlerin manifoldları silinir: maliyet uyanık cisimlerle orantılıdır, toplam çift veya
+ * * manifold sayısıyla değil. İki ucu da uyuyan çiftlerin manifoldları korunur.
+ * * Yeni çiftler için manifold açılır. Dar faz (narrowphase) iş sistemiyle paralel çalışır; yeni noktalar
+ * * eski noktalarla eşleştirilip impulslarını devralır. Cisimler bu çağrı ile çözüm arasında taşınmamalıdır.
+ * @param bodies Uyanık cisimler; bodies[i]->awake_index == i olmalıdır (yöneticinin uyanık listesi).
+ */
+void fe_collision_solver_update_contacts(fe_collision_solver_t* solver, const fe_broadphase_t* broadphase,
+                                         fe_rigid_body_t* const* bodies, uint32_t body_count);
+
+/**
+ * @brief Tüm etkin temasları tek ada gibi çözer ve uyanık cisimleri dt kadar ilerletir.
+ * * fe_collision_solver_load_velocities, _resolve_constraints (tüm cisimlerle), _store_displacements,
+ * * fe_rigid_body_integrate_position ve _store_velocities'in kısaltmasıdır.
+ * @param bodies Uyanık cisim listesi (bodies[i]->awake_index == i).
+ * @param gravity Cisimlerin hızlarına zaten eklenmiş yerçekimi (alt adımlara dağıtılır).
+ * @param dt Sabit zaman adımı (saniye).
+ */
+void fe_collision_solver_resolve_contacts(fe_collision_solver_t* solver, fe_rigid_body_t* const* bodies, uint32_t body_count,
+                                         fe_vec3_t gravity, float dt);
+
+/**
+ * @brief Uyanık cisimlerin hızlarını çözüm dizisine kopyalar ve adımın alt adım katsayılarını hesaplar.
+ * * fe_collision_solver_resolve_constraints'ten önce çağrılır; liste çözüm boyunca değişmemelidir.
+ * @param bodies Uyanık cisim listesi (bodies[i]->awake_index == i).
+ * @return Bellek yetmezse veya dt <= 0 ise false (çözüm yapılmamalıdır).
+ */
+bool fe_collision_solver_load_velocities(fe_collision_solver_t* solver, fe_rigid_body_t* const* bodies, uint32_t body_count, float dt);
+
+/**
+ * @brief Alt adımların toplam yer değiştirmesini cisimlere hız olarak (yer değiştirme / dt) yazar.
+ * * Ardından fe_rigid_body_integrate_position cisimleri alt adımların gittiği yere taşır;
+ * * son hızlar fe_collision_solver_store_velocities ile yazılır. Çözümde hareket etmeyen cisimlere dokunulmaz.
+ */
+void fe_collision_solver_store_displacements(const fe_collision_solver_t* solver, fe_rigid_body_t* const* bodies, uint32_t body_count);
+
+/**
+ * @brief Çözülmüş hızları cisimlere geri yazar.
+ */
+void fe_collision_solver_store_velocities(const fe_collision_solver_t* solver, fe_rigid_body_t* const* bodies, uint32_t body_count);
+
+/**
+ * @brief Bir adanın temaslarını alt adımlarla çözer ve cisimlerinin yer değiştirmesini hesaplar.
+ * * Ortak dinamik cismi olmayan adalar farklı iş parçacıklarında aynı anda çözülebilir;
+ * * statik/kinematik cisimlere yazılmaz. Hızlar fe_collision_solver_load_velocities ile
+ * * yüklenmiş olmalıdır; listede olmayan uçların hızları kayıttan sadece okunur.
+ * * Temassız adanın yer değiştirmesi son hız * dt'dir (alt adımlanmaz).
+ * @param indices constraints içindeki indeksler.
+ * @param bodies Adanın yoğun indeksleri (NULL ise 0..body_count-1).
+ * @param gravity Yüklenen hızlardaki yerçekimi; alt adımlara dağıtılır.
+ */
+void fe_collision_solver_resolve_constraints(fe_collision_solver_t* solver, const uint32_t* indices, uint32_t count,
+                                             const uint32_t* bodies, uint32_t body_count, fe_vec3_t gravity);
+
+/**
+ * @brief fe_collision_solver_resolve_constraints'in aşamaları. Başka çözücüler (örn: eklemler) alt
+ * * adımların içinde yürütülecekse resolve yerine şu sıra izlenir: prepare; her alt adım için
+ * * begin_substep, velocity_iterations kez solve_iteration, end_substep; en sonda finish.
+ */
+void fe_collision_solver_prepare_constraints(fe_collision_solver_t* solver, const uint32_t* indices, uint32_t count,
+                                             const uint32_t* bodies, uint32_t body_count, fe_vec3_t gravity);
+
+/**
+ * @brief Alt adımın yerçekimi payını ekler ve temasları sıcak başlatır.
+ */
+void fe_collision_solver_begin_substep(fe_collision_solver_t* solver, const uint32_t* indices, uint32_t count,
+                                       const uint32_t* bodies, uint32_t body_count, fe_vec3_t gravity, uint32_t substep);
+
+/**
+ * @brief Hazırlanmış manifoldlar üzerinde tek bir itmeli hız yinelemesi yapar.
+ */
+void fe_collision_solver_solve_iteration(fe_collision_solver_t* solver, const uint32_t* indices, uint32_t count);
+
+/**
+ * @brief Yer değiştirmeleri alt adım kadar ilerletir, ardından relax_iterations kez itmesiz yineler.
+ */
+void fe_collision_solver_end_substep(fe_collision_solver_t* solver, const uint32_t* indices, uint32_t count,
+                                     const uint32_t* bodies, uint32_t body_count);
+
+/**
+ * @brief Alt adımlardan sonra sekmeyi uygular.
+ */
+void fe_collision_solver_finish_constraints(fe_collision_solver_t* solver, const uint32_t* indices, uint32_t count);
+
+/**
+ * @brief İki cisim arasındaki temasları yok sayar; var olan manifoldları sonraki adımda silinir.
+ * * Başvuru sayılıdır: her çağrı fe_collision_solver_restore_pair ile eşlenmelidir.
+ * @return Bellek yetmezse false (temaslar çözülmeye devam eder).
+ */
+bool fe_collision_solver_ignore_pair(fe_collision_solver_t* solver, const fe_rigid_body_t* a, const fe_rigid_body_t* b);
+
+/**
+ * @brief fe_collision_solver_ignore_pair'in bir çağrısını geri alır; sayaç sıfırlanınca çift yeniden çarpışır.
+ */
+void fe_collision_solver_restore_pair(fe_collision_solver_t* solver, const fe_rigid_body_t* a, const fe_rigid_body_t* b);
+
+/**
+ * @brief Cisme ait tüm manifoldları siler (cisim dünyadan çıkarılırken çağrılır).
+ */
+void fe_collision_solver_remove_body(fe_collision_solver_t* solver, const fe_rigid_body_t* rb);
+
+/**
+ * @brief Güncel manifold listesini döndürür (point_count = 0 olanlar dokunmayan çiftlerdir).
+ */
+static inline const fe_contact_constraint_t* fe_collision_solver_get_constraints(const fe_collision_solver_t* solver, uint32_t* out_count) {
+    *out_count = solver->constraint_count;
+    return solver->constraints;
+}
+
+/**
+ * @brief Son fe_collision_solver_update_contacts çağrısındaki etkin manifoldların indekslerini döndürür.
+ */
+static inline const uint32_t* fe_collision_solver_get_active(const fe_collision_solver_t* solver, uint32_t* out_count) {
+    *out_count = solver->active_count;
+    return solver->active_constraints;
+}
+
+#endif // FE_COLLISION_SOLVER_H
+
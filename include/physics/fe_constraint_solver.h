@@ -0,0 +1,154 @@
+// include/physics/fe_constraint_solver.h
+
+#ifndef FE_CONSTRAINT_SOLVER_H
+#define FE_CONSTRAINT_SOLVER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "error/fe_error.h"
+#include "math/fe_vector.h"
+#include "physics/fe_physics_constraint_component.h"
+#include "physics/fe_collision_solver.h" // fe_solver_velocity_t (hızlar temas çözücüsüyle paylaşılır)
+#include "data_structures/fe_array.h"
+
+// ----------------------------------------------------------------------
+// 1. AYARLAR
+// ----------------------------------------------------------------------
+
+// Varsayılan hız yinelemesi (adım başına; temaslarla birlikte çözülürken alt adımlara bölünür)
+#define FE_CONSTRAINT_VELOCITY_ITERATIONS 8
+
+// Baumgarte katsayısı: eklem ayrılmasının adım başına düzeltilen oranı
+#define FE_CONSTRAINT_BAUMGARTE 0.2f
+
+/**
+ * @brief En fazla renk (paralel grup) sayısı.
+ * * Bir cismin renk kümesi 32 bitlik maskede tutulur. Renk bulamayan eklemler (bir cisme 32'den
+ * * fazla eklem bağlıysa) taşma grubuna düşer ve tek iş parçacığında, renklerden sonra çözülür.
+ */
+#define FE_CONSTRAINT_MAX_COLORS 32
+
+
+// ----------------------------------------------------------------------
+// 2. YAPILAR
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Bir eklemin adım başına çözüm verisi.
+ */
+typedef struct fe_joint_constraint {
+    fe_physics_constraint_component_t* component;
+
+    // Kütle verisi (simüle edilmeyen, statik/kinematik veya dünya uçları için sıfır)
+    uint32_t index_a;           // Uyanık listedeki yoğun indeks (listede değilse UINT32_MAX)
+    uint32_t index_b;
+    float inv_mass_a;
+    float inv_mass_b;
+    fe_vec3_t inv_inertia_a[3]; // Dünya uzayı ters eylemsizlik tensörü (satırlar)
+    fe_vec3_t inv_inertia_b[3];
+
+    // Bağlama noktası (bilye-yuva, menteşe, sabit): üç doğrusal satır birlikte çözülür
+    fe_vec3_t r_a;              // Kütle merkezlerinden bağlama noktalarına
+    fe_vec3_t r_b;
+    fe_vec3_t point_mass[3];    // K^-1 (satırlar)
+    fe_vec3_t point_bias;
+
+    // Sabit: üç açısal satır; menteşe: eksene dik iki açısal satır
+    fe_vec3_t angular_mass[3];  // (I_A + I_B)^-1 (satırlar, sabit)
+    fe_vec3_t angular_bias;     // Sabit
+    fe_vec3_t hinge_axes[2];
+    float hinge_mass[2];
+    float hinge_bias[2];
+    float hinge_impulse[2];
+
+    // Yay: eksen boyunca yumuşak mesafe satırı
+    fe_vec3_t spring_axis;
+    float spring_mass;
+    float spring_bias;
+    float spring_gamma;
+} fe_joint_constraint_t;
+
+/**
+ * @brief Graf boyamalı, deterministik eklem çözücüsü (ardışık impuls).
+ * * Eklemler, ortak dinamik cisim paylaşmayan gruplara (renklere) ayrılır. Bir rengin eklemleri
+ * * iş sistemiyle aynı anda çözülür, renkler sırayla. Boyama tek iş parçacığında, eklemlerin
+ * * kayıt sırasıyla yapılır; her eklem her yinelemede aynı hızları gördüğünden sonuç iş
+ * * parçacığı sayısından bağımsızdır (bit düzeyinde aynı; kilitli adımlı tekrarlar için).
+ */
+typedef struct fe_constraint_solver {
+    fe_joint_constraint_t* joints;  // Bu adımın etkin eklemleri, renklere göre gruplanmış
+    uint32_t joint_count;
+    uint32_t joint_capacity;
+
+    // joints[color_start[c] .. color_start[c + 1]) c. rengin eklemleridir; FE_CONSTRAINT_MAX_COLORS. grup taşmadır
+    uint32_t color_start[FE_CONSTRAINT_MAX_COLORS + 2];
+    uint32_t color_count;           // Taşma hariç kullanılan renk sayısı
+
+    uint32_t* joint_colors;         // Boyama sırasında etkin eklem başına renk (geçici)
+    uint32_t* body_colors;          // Yoğun indeks -> kullanılan renklerin maskesi (geçici)
+    uint32_t body_color_capacity;
+
+    // İki ucu da simüle edilen eklemlerin yoğun indeks çiftleri (adaları birleştirmek için)
+    uint32_t* body_pairs;           // 2 * pair_count eleman
+    uint32_t pair_count;
+
+    // Çözüm sırasında iş parçalarının paylaştığı durum
+    fe_solver_velocity_t* velocities;
+    uint32_t velocity_count;
+    uint32_t batch_offset;          // Çözülen rengin joints içindeki başlangıcı
+    float inv_dt;
+    float dt;
+
+    uint32_t velocity_iterations;
+    bool warm_starting;             // Kapatılırsa impulslar her adım sıfırdan başlar
+} fe_constraint_solver_t;
+
+
+// ----------------------------------------------------------------------
+// 3. YÖNETİM VE İŞLEMLER
+// ----------------------------------------------------------------------
+
+fe_error_code_t fe_constraint_solver_init(fe_constraint_solver_t* solver);
+void fe_constraint_solver_destroy(fe_constraint_solver_t* solver);
+
+/**
+ * @brief Etkin eklemleri toplar ve renklere ayırır.
+ * * En az bir ucu simüle edilen (uyanık, dinamik) eklemler etkindir; uyuyan uçlar çağırandan
+ * * önce uyandırılmalıdır (aksi halde o adımda statik gibi davranır). Statik, kinematik ve
+ * * dünya uçları renk çakışması yaratmaz.
+ * @param constraints fe_physics_constraint_component_t* dizisi (sıra, boyamanın sırasıdır).
+ * @param body_count Uyanık cisim sayısı; cisimler awake_index ile uyanık listeye işaret eder.
+ * @return Bellek yetmezse false (eklemler bu adım çözülmez).
+ */
+bool fe_constraint_solver_build(fe_constraint_solver_t* solver, const fe_array_t* constraints, uint32_t body_count);
+
+/**
+ * @brief Kurulan eklemleri çözer ve hızları yerinde düzeltir.
+ * * Hızlar temas çözücüsünün dizisidir (fe_collision_solver_load_velocities); listede olmayan
+ * * uçların hızları kayıttan sadece okunur.
+ * @param dt Sabit zaman adımı (saniye).
+ */
+void fe_constraint_solver_solve(fe_constraint_solver_t* solver, fe_solver_velocity_t* velocities, uint32_t velocity_count, float dt);
+
+/**
+ * @brief fe_constraint_solver_solve'un ilk yarısı: kütle verisi, hedefler ve sıcak başlatma.
+ * * Temaslarla iç içe çözümde kullanılır: ardından velocity_iterations kez
+ * * fe_constraint_solver_solve_iteration çağrılır. velocities bu süre boyunca geçerli kalmalıdır.
+ */
+void fe_constraint_solver_prepare(fe_constraint_solver_t* solver, fe_solver_velocity_t* velocities, uint32_t velocity_count, float dt);
+
+/**
+ * @brief Tüm renkler üzerinde tek bir hız yinelemesi yapar.
+ */
+void fe_constraint_solver_solve_iteration(fe_constraint_solver_t* solver);
+
+/**
+ * @brief Son fe_constraint_solver_build çağrısında iki ucu da simüle edilen eklemlerin yoğun indeks çiftleri.
+ * * Ada yöneticisi bu çiftleri de birleştirir: eklemle bağlı cisimler birlikte uyur ve uyanır.
+ */
+static inline const uint32_t* fe_constraint_solver_get_body_pairs(const fe_constraint_solver_t* solver, uint32_t* out_count) {
+    *out_count = solver->pair_count;
+    return solver->body_pairs;
+}
+
+#endif // FE_CONSTRAINT_SOLVER_H
@@ -7,36 +7,155 @@
 #include <stdbool.h>
 #include "math/fe_vector.h"
 #include "physics/fe_rigid_body.h"
+#include "physics/fe_collider.h"      // fe_aabb_t
 #include "data_structures/fe_array.h" // Parçalanma parçaları ve bileşenler için
 
+/**
+ * @brief Önceden hesaplanmış Voronoi kırılması ve havuzdan etkinleştirilen parçalar.
+ * * Kırılma verisi (fe_fracture_mesh_t) yükleme anında veya çevrimdışı bir kez üretilir: parça
+ * * geometrileri, kütle özellikleri ve parçaları birbirine bağlayan bağ (bond) grafiği. Çalışma
+ * * zamanında kırılma sadece havuzdaki hazır cisimleri yerleştirip dünyaya toplu ekler; kırılma
+ * * karesinde bellek ayrılmaz.
+ */
+
 // ----------------------------------------------------------------------
 // 1. KIRILMA PARÇALARI YAPISI
 // ----------------------------------------------------------------------
 
 /**
  * @brief Yikim sonrasi olusacak tek bir parçayi (kırıntıyı) temsil eder.
+ * * Konumlar nesne uzayındadır (kırılan cismin çerçevesi). Parçanın cisim çerçevesi kütle merkezinde
+ * * ve asal eylemsizlik eksenlerindedir; geometrisi de bu çerçevede saklanır, böylece render sistemi
+ * * parçayı doğrudan cismin dönüşümüyle çizer.
  */
 typedef struct fe_fracture_chunk {
-    fe_rigid_body_t* rigid_body; // Parçanın katı cisim verisi (Kütle, şekil, pozisyon)
-    uint32_t mesh_id;            // Parçaya ait görsel mesh verisi referansi (Render sistemi için)
-    // Ek olarak: Yüzey alanı, iç/dış yüzey bilgisi gibi veriler eklenebilir.
+    uint32_t mesh_id;            // Parçaya ait görsel mesh verisi referansi (Render sistemi için; 0: atanmadı)
+
+    fe_vec3_t center;            // Kütle merkezi (nesne uzayında)
+    fe_vec4_t orientation;       // Asal eksenlerin nesne uzayındaki yönelimi (Quaternion)
+    fe_vec3_t principal_inertia; // Asal eylemsizlik momentleri (kg*m^2)
+    fe_vec3_t half_extents;      // Hücreye sığdırılmış kutu collider'ın yarı boyutları (cisim çerçevesinde)
+    fe_vec3_t collider_offset;   // Kutunun kütle merkezine göre kayması (cisim çerçevesinde)
+    float volume;                // m^3
+    float mass;                  // kg
+    float radius;                // Kütle merkezinden en uzak köşeye mesafe
+
+    uint32_t first_vertex;       // fe_fracture_mesh_t::positions içindeki aralık
+    uint32_t vertex_count;
+    uint32_t first_index;        // fe_fracture_mesh_t::indices içindeki aralık
+    uint32_t index_count;
+    uint32_t surface_index_count; // Aralığın başındaki dış yüzey üçgenleri; kalanı kırılma (iç) yüzeyleri
+
+    uint32_t first_bond;         // fe_fracture_mesh_t::chunk_bonds içindeki aralık
+    uint32_t bond_count;
+    bool is_support;             // Zemine bağlı (hasarla kopmadıkça statik kalır)
 } fe_fracture_chunk_t;
 
+/**
+ * @brief İki komşu parçayı birleştiren bağ (ortak Voronoi yüzü).
+ */
+typedef struct fe_fracture_bond {
+    uint32_t chunk_a;
+    uint32_t chunk_b;
+    fe_vec3_t center;            // Ortak yüzün merkezi (nesne uzayında)
+    float area;                  // Ortak yüzün alanı (m^2); bağın sağlığı bununla ölçeklenir
+} fe_fracture_bond_t;
+
+/**
+ * @brief Uzayda yakın parçaların grubu (hasar sorgularında tek kutuyla elenir).
+ * * Parçalar Morton sırasındadır; her küme ardışık bir parça aralığıdır.
+ */
+typedef struct fe_fracture_cluster {
+    fe_aabb_t bounds;            // Nesne uzayında
+    uint32_t first_chunk;
+    uint32_t chunk_count;
+    uint32_t first_bond;         // chunk_a'sı bu kümede olan bağlar (bonds chunk_a'ya göre sıralıdır)
+    uint32_t bond_count;
+} fe_fracture_cluster_t;
+
 /**
  * @brief Önceden hesaplanmis yikim verisini tutan bir mesh kümesi.
+ * * Birden fazla yıkılabilir bileşen aynı veriyi paylaşabilir (veri salt okunurdur).
  */
 typedef struct fe_fracture_mesh {
     uint32_t id;
     fe_array_t* chunks; // fe_fracture_chunk_t turunde dizisi
-    // Orijinal nesnenin hacim, kütle, vb. bilgileri burada depolanabilir.
+
+    // Parça geometrileri (tüm parçalar için tek blok; yüzler düz gölgelidir)
+    fe_vec3_t* positions;
+    fe_vec3_t* normals;
+    uint32_t vertex_count;
+    uint32_t* indices;           // Parça içi indeksler (parçanın first_vertex'ine göre)
+    uint32_t index_count;
+
+    // Bağlantı grafiği
+    fe_fracture_bond_t* bonds;
+    uint32_t bond_count;
+    uint32_t* chunk_bonds;       // Parça başına bağ indeksleri (fe_fracture_chunk_t::first_bond aralıkları)
+    fe_fracture_cluster_t* clusters;
+    uint32_t cluster_count;
+
+    fe_aabb_t bounds;            // Nesne uzayında
+    float total_mass;
 } fe_fracture_mesh_t;
 
+/**
+ * @brief Voronoi kırılma üreticisinin ayarları.
+ */
+typedef struct fe_fracture_settings {
+    uint32_t site_count;         // Parça sayısı (sites verilmezse rastgele üretilir)
+    uint32_t seed;               // Rastgele sitelerin tohumu (aynı tohum aynı kırılmayı verir)
+    float density;               // kg/m^3
+    float collider_scale;        // Hücreye sığdırılan kutunun ölçeği; < 1 ise komşu kutular arasında boşluk kalır
+    float anchor_height;         // Tabandan bu yüksekliğe (nesne +Y) inen parçalar destektir; <= 0 ise destek yok
+    uint32_t cluster_size;       // Küme başına parça sayısı
+} fe_fracture_settings_t;
+
+
 // ----------------------------------------------------------------------
-// 2. YIKILABİLİR BİLEŞEN
+// 2. PARÇA CİSİM HAVUZU
 // ----------------------------------------------------------------------
 
+/**
+ * @brief Havuz yuvasının durumu.
+ */
+typedef enum fe_fracture_slot_state {
+    FE_FRACTURE_SLOT_FREE = 0,
+    FE_FRACTURE_SLOT_ACQUIRED,      // Bir parçaya ait, dünyada değil
+    FE_FRACTURE_SLOT_IN_WORLD
+} fe_fracture_slot_state_t;
+
+/**
+ * @brief Kırılma parçaları için önceden oluşturulmuş katı cisimler (kutu collider'lı).
+ * * Birden fazla yıkılabilir bileşen aynı havuzu paylaşabilir. Havuz, fizik yöneticisi
+ * * kapatılmadan önce yok edilmelidir (dünyadaki cisimlerini önce dünyadan kaldırır).
+ */
+typedef struct fe_fracture_body_pool {
+    fe_rigid_body_t** bodies;    // capacity elemanlı; yuva indeksi parçalarda saklanır
+    uint32_t* free_slots;        // Boştaki yuvaların yığını
+    uint8_t* slot_states;        // fe_fracture_slot_state_t
+    uint32_t free_count;
+    uint32_t capacity;
+} fe_fracture_body_pool_t;
+
+
+// ----------------------------------------------------------------------
+// 3. YIKILABİLİR BİLEŞEN
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Bir parçanın çalışma zamanı durumu.
+ */
+typedef enum fe_fracture_chunk_state {
+    FE_FRACTURE_CHUNK_INACTIVE = 0, // Cismi yok (yapı bütün ya da parça havuza döndü)
+    FE_FRACTURE_CHUNK_STATIC,       // Desteğe bağlı; dünyada statik cisim
+    FE_FRACTURE_CHUNK_DYNAMIC       // Kopmuş; dünyada dinamik cisim
+} fe_fracture_chunk_state_t;
+
 /**
  * @brief Bir fe_rigid_body'yi yikilabilir yapan bilesen.
+ * * Yapı ilk kez kırılana kadar tek cisimdir (target_body). Kırılınca hedef cisim dünyadan çıkar ve
+ * * parçalar havuzdan alınır: desteğe bağlantısı kopmayanlar statik, kopanlar dinamik olur.
  */
 typedef struct fe_destructible_component {
     uint32_t id;
@@ -49,26 +168,102 @@ typedef struct fe_destructible_component {
     
     float kinetic_energy_threshold; // Yikimi tetiklemek için gereken minimum Kinetik Enerji (0.5 * m * v^2)
 
+    float bond_strength;            // Bağ sağlığı = ortak yüz alanı * bond_strength (hasar / m^2)
+    float explosion_speed;          // Kopan parçalara hasar merkezinden dışa verilen hız (m/s)
+
+    // Parça durumu (oluşturulurken ayrılır; kırılma sırasında bellek ayrılmaz)
+    fe_fracture_body_pool_t* body_pool;
+    bool owns_body_pool;            // Havuz bileşenle birlikte oluşturuldu (yok edilirken o da yok edilir)
+    uint32_t* chunk_slots;          // Parça başına havuz yuvası (UINT32_MAX: cisim yok)
+    uint8_t* chunk_states;          // fe_fracture_chunk_state_t
+    float* bond_health;             // Bağların kalan sağlık oranı (1: sağlam, <= 0: kopuk)
+    uint32_t* scratch;              // Destek taraması kuyruğu
+    fe_rigid_body_t** scratch_bodies; // Toplu ekleme listesi
+
+    fe_vec3_t frame_position;       // Parçaların yerleştirildiği nesne dönüşümü (ilk kırılmada hedef cisimden alınır)
+    fe_vec4_t frame_orientation;
+
+    bool is_fractured;              // Parçalar dünyada, hedef cisim dünyadan çıktı
     bool is_pending_destruction;    // Yikim tetiklendi mi?
     bool is_destroyed;              // Zaten yikildi mi?
 } fe_destructible_component_t;
 
 
 // ----------------------------------------------------------------------
-// 3. YÖNETİM VE SİSTEM FONKSİYONLARI
+// 4. KIRILMA VERİSİ ÜRETİMİ (ÇEVRİMDIŞI / YÜKLEME ANI)
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Varsayılan üretici ayarlarını döndürür (64 parça, beton yoğunluğu, destek yok).
+ */
+fe_fracture_settings_t fe_fracture_create_default_settings(void);
+
+/**
+ * @brief Kapalı, dışbükey bir üçgen meshi Voronoi hücrelerine böler.
+ * * Her hücre, meshin komşu sitelerle arasındaki ikiortay düzlemleriyle kırpılmasıdır. Hücreler
+ * * sitelerin Morton sırasıyla üretilir (yakın parçalar ardışık olur, kümeler buradan çıkar).
+ * @param positions Nesne uzayında köşeler.
+ * @param indices Üçgenler; dışa bakan saat yönü tersi (CCW) sarım.
+ * @param sites Parça merkezleri (nesne uzayında, meshin içinde); NULL ise settings->site_count
+ * * tane rastgele üretilir.
+ * @param site_count sites verilmişse eleman sayısı.
+ * @return Yeni kırılma verisi; hata durumunda NULL.
+ */
+fe_fracture_mesh_t* fe_fracture_voronoi(const fe_vec3_t* positions, uint32_t vertex_count,
+                                        const uint32_t* indices, uint32_t index_count,
+                                        const fe_vec3_t* sites, uint32_t site_count,
+                                        const fe_fracture_settings_t* settings);
+
+/**
+ * @brief Kırılma verisini serbest bırakır. Kullanan bileşenler önce yok edilmelidir.
+ */
+void fe_fracture_mesh_destroy(fe_fracture_mesh_t* fracture);
+
+
+// ----------------------------------------------------------------------
+// 5. HAVUZ FONKSİYONLARI
+// ----------------------------------------------------------------------
+
+/**
+ * @brief capacity tane parça cismini önceden oluşturur.
+ */
+fe_fracture_body_pool_t* fe_fracture_body_pool_create(uint32_t capacity);
+
+/**
+ * @brief Havuzu ve tüm cisimlerini yok eder (dünyadakiler önce dünyadan kaldırılır).
+ */
+void fe_fracture_body_pool_destroy(fe_fracture_body_pool_t* pool);
+
+/**
+ * @brief Boştaki bir yuvayı alır.
+ * @return Yuva indeksi; havuz tükendiyse UINT32_MAX.
+ */
+uint32_t fe_fracture_body_pool_acquire(fe_fracture_body_pool_t* pool);
+
+/**
+ * @brief Yuvayı havuza geri verir; cisim dünyadaysa dünyadan kaldırılır.
+ */
+void fe_fracture_body_pool_release(fe_fracture_body_pool_t* pool, uint32_t slot);
+
+
+// ----------------------------------------------------------------------
+// 6. YÖNETİM VE SİSTEM FONKSİYONLARI
 // ----------------------------------------------------------------------
 
 /**
  * @brief Yeni bir yikilabilir bilesen olusturur.
+ * @param body_pool Parça cisimlerinin alınacağı havuz. NULL ise parça sayısı kadar cisimlik
+ * * özel bir havuz şimdi oluşturulur (kırılma anında bellek ayrılmaz).
  */
 fe_destructible_component_t* fe_destruction_create_component(
     fe_rigid_body_t* target_body, 
     fe_fracture_mesh_t* fracture_data, 
+    fe_fracture_body_pool_t* body_pool,
     float health, 
     float threshold);
 
 /**
- * @brief Bileseni bellekten serbest birakir.
+ * @brief Bileseni bellekten serbest birakir. Parça cisimleri dünyadan kaldırılıp havuza döner.
  */
 void fe_destruction_destroy_component(fe_destructible_component_t* dest_comp);
 
@@ -80,6 +275,16 @@ void fe_destruction_destroy_component(fe_destructible_component_t* dest_comp);
  */
 void fe_destruction_apply_impulse(fe_destructible_component_t* dest_comp, float impulse_magnitude);
 
+/**
+ * @brief Bir noktanın çevresindeki bağlara hasar verir (kısmi kırılma).
+ * * Hasar merkezden radius'a doğrusal azalır. Kopan bağlardan sonra destekten başlayan bir
+ * * tarama yapılır; desteğe ulaşamayan parçalar dinamik olur, diğerleri yerinde statik kalır.
+ * * Desteksiz (anchor_height <= 0) veride ilk kopan bağ yapıyı tümüyle parçalara ayırır:
+ * * birden çok parçalı serbest adalar tek cisim olarak değil, ayrı parçalar olarak düşer.
+ * @return Bu çağrıda dinamik olan parça sayısı.
+ */
+uint32_t fe_destruction_apply_damage(fe_destructible_component_t* dest_comp, fe_vec3_t world_point, float radius, float amount);
+
 /**
  * @brief Yikilabilir bilesenleri kontrol eder ve gerekli durumlarda yikimi tetikler.
  * * Bu, fe_physics_manager_step içinde çagrilir.
@@ -89,10 +294,15 @@ void fe_destruction_check_and_process(fe_destructible_component_t* dest_comp);
 
 /**
  * @brief Yikim islemini gerçekleştirir:
- * * 1. Ana cismi siler.
- * * 2. Parça rigid body'leri fizik motoruna enjekte eder.
- * * 3. Parçalara patlama/yayılma dürtüsü verir.
+ * * 1. Ana cismi siler (zaten kırılmışsa statik parçaları dünyadan çıkarır).
+ * * 2. Havuzdaki parça cisimlerini yerleştirip fizik motoruna tek seferde ekler.
+ * * 3. Parçalara patlama/yayılma hızı verir.
  */
 void fe_destruction_perform(fe_destructible_component_t* dest_comp);
 
+/**
+ * @brief Bir parçanın cismini dünyadan kaldırıp havuza geri verir (örn: yerleşmiş molozu temizlemek).
+ */
+void fe_destruction_release_chunk(fe_destructible_component_t* dest_comp, uint32_t chunk_index);
+
 #endif // FE_DESTRUCTION_SYSTEM_H
\ No newline at end of file
@@ -7,7 +7,10 @@
 #include <stdbool.h>
 #include "math/fe_vector.h"
 #include "data_structures/fe_array.h" 
-#include "physics/fe_physics_world.h" // fe_vec3_t gravity gibi global verilere erişim için
+#include "physics/fe_world.h" // fe_vec3_t gravity gibi global verilere erişim için
+
+// Bir hacmin yoğunluk/kuvvet geçişlerini bölebileceği maksimum iş sayısı
+#define FE_FLUID_MAX_WORKERS 64
 
 // ----------------------------------------------------------------------
 // 1. TEMEL SPH YAPILARI
@@ -15,6 +18,8 @@
 
 /**
  * @brief Akışkan simülasyonundaki tek bir parçacigi temsil eder.
+ * * Dahili depolama SoA'dır (fe_fluid_particle_store_t); bu yapı yalnızca
+ * * parçacık okuma/yazma arayüzünde kullanılır.
  */
 typedef struct fe_fluid_particle {
     fe_vec3_t position;         // Mevcut konum
@@ -26,12 +31,58 @@ typedef struct fe_fluid_particle {
     float pressure;             // Hesaplanan basınç (P)
 } fe_fluid_particle_t;
 
+/**
+ * @brief Parçacıkların SoA (Structure of Arrays) deposu.
+ * * Her alan ayrı, bitişik bir float dizisidir; böylece döngüler vektörleştirilebilir
+ * * ve iş parçacıkları parçacık aralıkları üzerinde bağımsız çalışabilir.
+ * * Izgara her kurulduğunda diziler hücre sırasına göre yeniden dizilir; bu yüzden bir parçacığın
+ * * indeksi adımlar arasında değişir. Kalıcı kimlik için id kullanılır.
+ */
+typedef struct fe_fluid_particle_store {
+    float* position_x;
+    float* position_y;
+    float* position_z;
+    float* velocity_x;
+    float* velocity_y;
+    float* velocity_z;
+    float* force_x;             // Bu adimda uygulanan toplam kuvvet
+    float* force_y;
+    float* force_z;
+    float* mass;                // Parçacigin kütlesi
+    float* density;             // Hesaplanan yoğunluk (rho)
+    float* pressure;            // Hesaplanan basınç (P)
+    uint32_t* id;               // Eklenme sırası (yeniden dizmede korunan kalıcı kimlik)
+    float* scratch;             // Yeniden dizme tamponu (her seferinde bir akışla yer değiştirir)
+
+    size_t count;               // Mevcut parçacık sayısı
+    size_t capacity;            // Her dizi için tahsis edilen eleman sayısı
+} fe_fluid_particle_store_t;
+
+/**
+ * @brief Komşu araması için düzgün ızgara (uniform grid).
+ * * Hücre boyutu en az smoothing_radius_h'dir; böylece bir parçacığın tüm
+ * * komşuları kendi hücresi ve çevresindeki 26 hücrede bulunur.
+ * * Her adımda bir kez sayma sıralaması (counting sort) ile yeniden kurulur.
+ */
+typedef struct fe_fluid_spatial_grid {
+    fe_vec3_t origin;           // Izgaranın minimum köşesi (volume_min)
+    float cell_size;            // Hücre kenar uzunluğu (>= h)
+    float inv_cell_size;        // 1 / cell_size
+    uint32_t dim_x, dim_y, dim_z; // Eksen başına hücre sayısı
+
+    uint32_t* cell_start;       // [cell_count + 1] Her hücrenin depodaki ilk parçacığı (depo hücre sıralıdır)
+    uint32_t* particle_cells;   // [particle_count] Her parçacığın hücre indeksi
+    uint32_t* sorted_indices;   // [particle_count] Kurulum sırasında: yeniden dizmeden önceki indeksler
+    size_t cell_capacity;       // cell_start için tahsis edilen hücre sayısı
+    size_t particle_capacity;   // particle_cells/sorted_indices için tahsis edilen eleman sayısı
+} fe_fluid_spatial_grid_t;
+
 /**
  * @brief Bir akışkan hacmini ve SPH parametrelerini tutar.
  */
 typedef struct fe_fluid_volume {
     uint32_t id;
-    fe_array_t* particles;      // fe_fluid_particle_t türünde
+    fe_fluid_particle_store_t particles; // SoA parçacık deposu
     
     // SPH Ayarlari
     float smoothing_radius_h;   // Etkileşim yaricapi (h)
@@ -44,7 +95,11 @@ typedef struct fe_fluid_volume {
     fe_vec3_t volume_max;       // Hacim sinirlarinin maksimum noktasi
     
     // Komşu Arama Hızlandırması için (Örn: Grid/Hücre)
-    void* spatial_hash;         // Uzamsal karma tablosu (Hashing Grid) referansı
+    fe_fluid_spatial_grid_t* spatial_hash; // Uzamsal ızgara (her adımda yeniden kurulur)
+    bool use_spatial_hash;      // false ise O(n^2) kaba kuvvet yolu kullanılır (karşılaştırma için)
+
+    // Paralellik
+    uint32_t worker_count;      // Yoğunluk/kuvvet geçişlerini bölen en fazla iş sayısı (1 = seri)
 } fe_fluid_volume_t;
 
 
@@ -64,6 +119,29 @@ fe_fluid_volume_t* fe_fluid_create_volume(uint32_t particle_count, fe_vec3_t vol
  */
 void fe_fluid_destroy_volume(fe_fluid_volume_t* volume);
 
+/**
+ * @brief Hacme yeni bir parçacık ekler.
+ * @return Basariliysa true, degilse false.
+ */
+bool fe_fluid_add_particle(fe_fluid_volume_t* volume, const fe_fluid_particle_t* particle);
+
+/**
+ * @brief Belirtilen indeksteki parçacığı SoA depodan okur.
+ * * Indeks depo sırasıdır ve her adımda değişebilir (bkz. fe_fluid_particle_store_t::id).
+ * @return Indeks geçerliyse true, degilse false.
+ */
+bool fe_fluid_get_particle(const fe_fluid_volume_t* volume, size_t index, fe_fluid_particle_t* out_particle);
+
+/**
+ * @brief Yoğunluk ve kuvvet geçişlerinin bölüneceği en fazla iş sayısını ayarlar.
+ * * İşler iş sisteminde (fe_job_system) çalışır; gerçek paralellik iş sisteminin iş parçacığı
+ * * sayısıyla da sınırlıdır. 1 ise geçişler çağıran iş parçacığında seri çalışır.
+ * * Sonuç, iş parçacığı sayısından bağımsız olarak bit düzeyinde aynıdır: her parçacık
+ * * yalnızca kendi çıktısını yazar ve komşularını her zaman aynı sırada toplar.
+ * @param worker_count 1 ile FE_FLUID_MAX_WORKERS arasında kırpılır.
+ */
+void fe_fluid_set_worker_count(fe_fluid_volume_t* volume, uint32_t worker_count);
+
 /**
  * @brief Akışkan simülasyonunu tek bir sabit adimda ilerletir.
  * * @param volume Simüle edilecek akışkan hacmi.
@@ -12,6 +12,24 @@
 // Tek bir saç telindeki maksimum parça sayısı
 #define FE_MAX_STRAND_PARTICLES 30 
 
+/**
+ * @brief Kılavuz tellerin kilit adımda (lockstep) birlikte çözüldüğü grup genişliği.
+ * * Bir grubun telleri her parçacık indeksinde yan yana saklanır: AVX'te bir kayıt, SSE'de iki kayıt.
+ */
+#define FE_HAIR_BATCH_WIDTH 8
+
+// Bir render telinin karıştırıldığı en fazla kılavuz tel (barisentrik üçgen)
+#define FE_HAIR_RENDER_GUIDES 3
+
+/**
+ * @brief Kısıtlama çözücüsü.
+ */
+typedef enum fe_hair_solver_type {
+    FE_HAIR_SOLVER_FTL = 0,     // Dinamik lider takibi (follow-the-leader): tek geçişte uzamaz, SIMD ve iş parçacıklı
+    FE_HAIR_SOLVER_PBD,         // Sertlik katsayılı, yinelemeli sıralı PBD
+    FE_HAIR_SOLVER_COUNT
+} fe_hair_solver_type_t;
+
 // ----------------------------------------------------------------------
 // 1. TEMEL YAPILAR
 // ----------------------------------------------------------------------
@@ -36,8 +54,51 @@ typedef struct fe_hair_strand {
     
     // Bükülme kısıtlamaları için orijinal açılar veya kuaterniyonlar burada tutulabilir.
     fe_vec3_t initial_tangents[FE_MAX_STRAND_PARTICLES - 2]; 
+
+    // Eklenme anındaki konumlar, kafa uzayında (kök bağlantısı ve FTL'de şekil hedefi)
+    fe_vec3_t rest_local[FE_MAX_STRAND_PARTICLES];
 } fe_hair_strand_t;
 
+/**
+ * @brief Kılavuz tellerden üretilen, simüle edilmeyen bir render teli.
+ * * Tepe i, kılavuzların i. parçacıklarının ağırlıklı toplamı artı köke göre sapmadır.
+ * * Sapma kafayla döner ve uca doğru (1 - clump) katına iner: clump = 1 telleri kılavuzun ucunda toplar.
+ */
+typedef struct fe_hair_render_strand {
+    uint32_t guides[FE_HAIR_RENDER_GUIDES]; // Kılavuz tel indeksleri (strands dizisinde)
+    float weights[FE_HAIR_RENDER_GUIDES];   // Toplamı 1; tek kılavuzlu demette {1, 0, 0}
+    fe_vec3_t root_offset;                  // Kafa uzayında sapma
+    float clump;                            // 0 - 1
+} fe_hair_render_strand_t;
+
+/**
+ * @brief FTL çözücüsünün sıcak durumu: kılavuz teller FE_HAIR_BATCH_WIDTH'lik gruplarda, şerit düzeninde.
+ * * g. grubun i. parçacığının c. bileşeni [((g * stride + i) * 3 + c) * FE_HAIR_BATCH_WIDTH + şerit]
+ * * indeksindedir. Kısa teller ve son grubun boş şeritleri sıfır dinlenme uzunluğuyla doldurulur
+ * * (ucun üstünde dururlar). Kayıtlar adım sonunda tellerin parçacık dizilerine geri yazılır.
+ * * Render telleri düz (packed) kopyadan karıştırılır: bir tel tek bir ardışık float dizisidir.
+ */
+typedef struct fe_hair_guides {
+    float* position;            // Tek blokta: position, prev_position, rest_delta, rest_length
+    float* prev_position;
+    float* rest_delta;          // Kafa uzayında ebeveynden parçacığa dinlenme vektörü (0. parçacıkta kök konumu)
+    float* rest_length;         // [(g * stride + i) * FE_HAIR_BATCH_WIDTH + şerit]
+    fe_vec3_t* packed;          // Render için tel başına ardışık konumlar [tel * stride + i]
+    uint32_t stride;            // Tel başına parçacık yuvası (en uzun telin parçacık sayısı)
+    uint32_t batch_count;
+    uint32_t capacity;          // Ayrılan grup * stride
+    uint32_t built_count;       // Kurulumun yapıldığı tel sayısı (değişirse yeniden kurulur)
+
+    // Adım boyunca iş parçalarının paylaştığı durum
+    fe_vec3_t head_rows[3];     // Kafa yönelimi (satırlar)
+    fe_vec3_t head_position;
+    fe_vec3_t gravity;
+    float dt;
+    float damping;
+    float ftl_damping;
+    float shape_stiffness;
+} fe_hair_guides_t;
+
 
 // ----------------------------------------------------------------------
 // 2. SAÇ FİZİĞİ BİLEŞENİ
@@ -57,8 +118,19 @@ typedef struct fe_hair_component {
     float stiffness_bend;           // Bükülme kısıtlaması sertliği (0.0 - 1.0)
     float damping_factor;           // Hız sönümleme çarpanı
     uint32_t iteration_count;       // Kısıtlama çözücü adım sayısı
+    fe_hair_solver_type_t solver_type; // Varsayılan: FE_HAIR_SOLVER_FTL (stiffness_stretch ve iteration_count sadece PBD'de)
+    float ftl_damping;              // FTL hız düzeltmesi (0 - 1): uzunluk düzeltmesinin hıza yansıyan payı
     
     bool is_active;
+
+    // Render telleri (tepeler GPU'da fe_hair_renderer_update, CPU'da fe_hair_update_render_strands ile)
+    fe_array_t* render_strands;     // fe_hair_render_strand_t türünde
+    uint32_t render_strands_revision; // render_strands her değiştiğinde artar (kopyalarını tutan kullanıcılar için)
+    fe_vec3_t* render_positions;    // Tel başına render_vertex_count tepe, teller ardışık
+    uint32_t render_vertex_count;   // Kılavuzların en uzununun parçacık sayısı
+    uint32_t render_capacity;       // render_positions'ın ayrıldığı tepe sayısı
+
+    fe_hair_guides_t guides;        // fe_hair_simulate_step tarafından yönetilir
 } fe_hair_component_t;
 
 
@@ -78,6 +150,7 @@ void fe_hair_destroy_component(fe_hair_component_t* comp);
 
 /**
  * @brief Saç bileşenine yeni bir kılavuz tel (strand) ekler ve başlatır.
+ * * İlk parçacık köktür ve kafaya, eklenme anındaki kafa dönüşümüne göre bağlanır.
  * * @param comp Saç bileşeni.
  * @param initial_positions Parçacıkların başlangıç dünya konumları (fe_vec3_t dizisi).
  */
@@ -85,10 +158,62 @@ fe_hair_strand_t* fe_hair_add_strand(fe_hair_component_t* comp, fe_vec3_t* initi
 
 /**
  * @brief Saç simülasyonunu tek bir sabit adimda ilerletir.
+ * * FTL'de kılavuz gruplar iş sistemine dağıtılır; bir grubun FE_HAIR_BATCH_WIDTH teli
+ * * kökten uca birlikte ilerler. Parçacık önce kafa uzayındaki dinlenme şekline
+ * * (stiffness_bend oranında), sonra ebeveyninden dinlenme uzunluğuna çekilir.
+ * * Render telleri güncellenmez (fe_hair_update_render_strands).
  * * @param comp Saç bileşeni.
  * @param gravity Yerçekimi kuvveti.
  * @param dt Zaman adimi.
  */
 void fe_hair_simulate_step(fe_hair_component_t* comp, fe_vec3_t gravity, float dt);
 
+
+// ----------------------------------------------------------------------
+// 4. RENDER TELLERİ
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Render telleri ekler. Kılavuz indeksleri, tellerin eklenme sırasıdır.
+ * @return Geçersiz kılavuz indeksi veya bellek yetmezliğinde false (hiçbiri eklenmez).
+ */
+bool fe_hair_add_render_strands(fe_hair_component_t* comp, const fe_hair_render_strand_t* strands, uint32_t count);
+
+/**
+ * @brief Her kılavuzun çevresine demet (clump) telleri üretir.
+ * * Sapmalar kökte, kılavuzun ilk parçasına dik radius yarıçaplı diskte rastgele seçilir.
+ * @return Eklenen tel sayısı.
+ */
+uint32_t fe_hair_generate_clump_strands(fe_hair_component_t* comp, uint32_t strands_per_guide, float radius, float clump, uint32_t seed);
+
+/**
+ * @brief Kılavuz üçgenlerinin (örn: kafa derisi ağı üzerindeki kılavuz kökleri) içinde rastgele
+ * * barisentrik ağırlıklarla teller üretir.
+ * @param triangles 3 * triangle_count kılavuz indeksi.
+ * @return Eklenen tel sayısı.
+ */
+uint32_t fe_hair_generate_barycentric_strands(fe_hair_component_t* comp, const uint32_t* triangles, uint32_t triangle_count,
+                                              uint32_t strands_per_triangle, uint32_t seed);
+
+/**
+ * @brief Render için kılavuzların son konumlarını hazırlar; render telleri genişletilmez.
+ * * Çıktı guides.packed (kılavuz başına guides.stride ardışık konum; 1k kılavuz x 24 parçacık
+ * * ~288 KB) ve guides.head_rows'tur. Render tellerinin tepeleri bunlardan şu formülle çıkar:
+ * *   tepe[i] = sum(w_j * kılavuz_j[i]) + head_rows * root_offset * (1 - clump * i / (stride - 1))
+ * * Renderer'da bu formülü fe_hair_renderer_update uygular (graphics/fe_hair_renderer.h, Compute Shader):
+ * * kare başına CPU maliyeti kılavuz adımı artı bu çağrıdır (tests/physics/fe_hair_bench.c).
+ * @return Bellek yetmezse false.
+ */
+bool fe_hair_update_render_guides(fe_hair_component_t* comp);
+
+/**
+ * @brief Render tellerinin tepelerini kılavuzların son konumlarından CPU'da hesaplar (render_positions).
+ * * fe_hair_update_render_guides'ı çağırır, sonra teller iş sistemine dağıtılır. Her tel için
+ * * stride tepe yazıldığından maliyet bellek bant genişliğiyle sınırlıdır (100k tel x 24 tepe ~29 MB,
+ * * tek çekirdekte kare başına ~2-4 ms). GPU karıştırmasının (fe_hair_renderer_update) CPU yedeğidir:
+ * * GPU'suz araçlar ve formülün doğrulanması için; her kare çizim yolunda kullanılmaz.
+ * @return Bellek yetmezse false.
+ */
+bool fe_hair_update_render_strands(fe_hair_component_t* comp);
+
 #endif // FE_HAIR_PHYSICS_H
\ No newline at end of file
@@ -0,0 +1,103 @@
+// include/physics/fe_island.h
+
+#ifndef FE_ISLAND_H
+#define FE_ISLAND_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "error/fe_error.h"
+#include "physics/fe_rigid_body.h"
+#include "physics/fe_collision_solver.h"
+
+// ----------------------------------------------------------------------
+// 1. UYKU AYARLARI
+// ----------------------------------------------------------------------
+
+// Doğrusal hız bu eşiğin (m/s) altındaysa cisim dinlenmede sayılır
+#define FE_ISLAND_SLEEP_LINEAR_TOLERANCE 0.05f
+
+// Açısal hız bu eşiğin (radyan/s, ~3 derece/s) altındaysa cisim dinlenmede sayılır
+#define FE_ISLAND_SLEEP_ANGULAR_TOLERANCE 0.05f
+
+/**
+ * @brief Bir adanın uyuması için tüm cisimlerinin kesintisiz dinlenmede kalması gereken süre (saniye).
+ */
+#define FE_ISLAND_TIME_TO_SLEEP 0.5f
+
+
+// ----------------------------------------------------------------------
+// 2. YAPILAR
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Uyanık cisimlerin temaslar üzerinden bağlı bileşenleri (adalar).
+ * * Adalar her adımda birleşim-bul (union-find) ile yeniden kurulur. Statik ve kinematik
+ * * cisimler adaları birleştirmez (aynı zemindeki iki yığın ayrı adalardır) ve her biri
+ * * kendi tekil adasıdır. Farklı adaların ortak dinamik cismi olmadığından paralel çözülebilirler.
+ */
+typedef struct fe_island_manager {
+    uint32_t* parent;               // Birleşim-bul ormanı (uyanık listedeki yoğun indekse göre)
+    uint32_t* island_of;            // Yoğun indeks -> ada indeksi
+    uint32_t* body_order;           // Adalara göre gruplanmış yoğun indeksler
+    uint32_t* body_start;           // island_count + 1 eleman
+    uint32_t body_capacity;
+
+    uint32_t* constraint_order;     // Adalara göre gruplanmış manifold indeksleri
+    uint32_t* constraint_start;     // island_count + 1 eleman
+    uint32_t constraint_capacity;
+
+    uint32_t island_count;
+} fe_island_manager_t;
+
+
+// ----------------------------------------------------------------------
+// 3. YÖNETİM VE İŞLEMLER
+// ----------------------------------------------------------------------
+
+fe_error_code_t fe_island_manager_init(fe_island_manager_t* islands);
+void fe_island_manager_destroy(fe_island_manager_t* islands);
+
+/**
+ * @brief Uyanık cisimler, çözücünün etkin manifoldları ve eklemlerden adaları kurar.
+ * * Sadece temas noktası olan manifoldlar cisimleri birleştirir. Sonuç, cisimlerin ve
+ * * manifoldların sırasına bağlıdır, iş parçacığı sayısına bağlı değildir (deterministik).
+ * @param body_count Uyanık cisim sayısı; cisimler awake_index ile uyanık listeye işaret eder.
+ * @param body_pairs Eklemlerle bağlı yoğun indeks çiftleri (2 * pair_count eleman; NULL olabilir).
+ */
+void fe_island_manager_build(fe_island_manager_t* islands, uint32_t body_count, const fe_collision_solver_t* solver,
+                             const uint32_t* body_pairs, uint32_t pair_count);
+
+/**
+ * @brief Uyku sayaçlarını ilerletir ve tüm cisimleri FE_ISLAND_TIME_TO_SLEEP süresince dinlenen adaları uyutur.
+ * * Uyuyan adanın cisimleri island_next ile halka listeye bağlanır, hızları sıfırlanır ve
+ * * is_awake = false olur. Cisimler uyanık listeden çağıran tarafından çıkarılmalıdır.
+ * @param bodies Uyanık cisim listesi (bodies[i]->awake_index == i).
+ * @return Uyutulan cisim sayısı.
+ */
+uint32_t fe_island_manager_update_sleep(fe_island_manager_t* islands, fe_rigid_body_t* const* bodies, float dt);
+
+/**
+ * @brief Uyuyan bir cismin adasındaki tüm cisimleri uyandırır.
+ * * @param on_wake Uyanan her cisim için çağrılır (örn: uyanık listeye eklemek için). NULL olabilir.
+ * @return Uyanan cisim sayısı (cisim zaten uyanıksa 0).
+ */
+uint32_t fe_island_wake(fe_rigid_body_t* rb, void (*on_wake)(fe_rigid_body_t* rb, void* context), void* context);
+
+/**
+ * @brief i. adanın manifold indekslerini döndürür.
+ */
+static inline const uint32_t* fe_island_manager_get_constraints(const fe_island_manager_t* islands, uint32_t island, uint32_t* out_count) {
+    *out_count = islands->constraint_start[island + 1] - islands->constraint_start[island];
+    return &islands->constraint_order[islands->constraint_start[island]];
+}
+
+/**
+ * @brief i. adanın cisimlerini (yoğun indeksler) döndürür.
+ */
+static inline const uint32_t* fe_island_manager_get_bodies(const fe_island_manager_t* islands, uint32_t island, uint32_t* out_count) {
+    *out_count = islands->body_start[island + 1] - islands->body_start[island];
+    return &islands->body_order[islands->body_start[island]];
+}
+
+#endif // FE_ISLAND_H
+
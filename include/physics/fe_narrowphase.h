@@ -0,0 +1,74 @@
+// include/physics/fe_narrowphase.h
+
+#ifndef FE_NARROWPHASE_H
+#define FE_NARROWPHASE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "math/fe_vector.h"
+#include "physics/fe_collider.h"
+
+// ----------------------------------------------------------------------
+// 1. AYARLAR
+// ----------------------------------------------------------------------
+
+// Bir temas manifoldundaki en fazla nokta sayısı (kutu yüzeyi üzerindeki kutu için 4 yeterlidir)
+#define FE_NARROWPHASE_MAX_POINTS 4
+
+/**
+ * @brief Yüzeyler bu mesafeden yakınsa (henüz değmeseler de) temas noktası üretilir (metre).
+ * * Öngörülü (speculative) temaslar: çözücü cisimlerin bu adımda boşluğu kapatıp iç içe geçmesini engeller.
+ */
+#define FE_NARROWPHASE_SPECULATIVE_DISTANCE 0.02f
+
+
+// ----------------------------------------------------------------------
+// 2. YAPILAR
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Tek bir temas noktası.
+ */
+typedef struct fe_narrowphase_point {
+    fe_vec3_t position;         // Dünya uzayında, iki yüzeyin ortasındaki nokta
+    float penetration;          // > 0: iç içe geçme derinliği, < 0: yüzeyler arası boşluk
+} fe_narrowphase_point_t;
+
+/**
+ * @brief İki geometri arasındaki temas manifoldu.
+ */
+typedef struct fe_narrowphase_manifold {
+    fe_vec3_t normal;           // A'dan B'ye birim temas normali
+    uint32_t point_count;       // 0 ise temas yok
+    fe_narrowphase_point_t points[FE_NARROWPHASE_MAX_POINTS];
+} fe_narrowphase_manifold_t;
+
+
+// ----------------------------------------------------------------------
+// 3. TEMAS ÜRETİMİ
+// ----------------------------------------------------------------------
+
+/**
+ * @brief İki çarpıştırıcı arasındaki temas noktalarını hesaplar.
+ * * Küre/kapsül çiftleri analitik olarak, kutu-kutu Ayırıcı Eksen Teoremi (SAT) ve referans
+ * * yüzeye kırpma ile çözülür.
+ * @param position_a, orientation_a A'yı taşıyan cismin dönüşümü (kuaterniyon x, y, z, w).
+ * @param out_manifold Sonuç; temas yoksa point_count = 0.
+ * @return En az bir temas noktası üretildiyse true.
+ */
+bool fe_narrowphase_collide(const fe_collider_t* collider_a, fe_vec3_t position_a, fe_vec4_t orientation_a,
+                            const fe_collider_t* collider_b, fe_vec3_t position_b, fe_vec4_t orientation_b,
+                            fe_narrowphase_manifold_t* out_manifold);
+
+/**
+ * @brief fe_narrowphase_collide ile aynı, öngörülü temas mesafesi çağırandan gelir.
+ * * Sürekli çarpışmada mesafe, cisimlerin bu adımda süpürdüğü yol kadar uzatılır: yüzeyler
+ * * arasındaki boşluk adım içinde kapanabilecekse temas noktası üretilir.
+ * @param speculative_distance Temas üretilecek en büyük boşluk (metre, >= 0).
+ */
+bool fe_narrowphase_collide_speculative(const fe_collider_t* collider_a, fe_vec3_t position_a, fe_vec4_t orientation_a,
+                                        const fe_collider_t* collider_b, fe_vec3_t position_b, fe_vec4_t orientation_b,
+                                        float speculative_distance, fe_narrowphase_manifold_t* out_manifold);
+
+#endif // FE_NARROWPHASE_H
+
@@ -53,13 +53,28 @@ typedef struct fe_physics_constraint_component {
         // Bilye ve Yuva limitleri (ileride eklenebilir)
         // struct { ... } ball_socket_data;
         
-        // Menteşe ekseni (ileride eklenebilir)
-        // struct { fe_vec3_t axis_local; } hinge_data;
+        // Menteşe ekseni (her cismin yerel uzayında; dünya uzayında çakışık tutulur)
+        struct {
+            fe_vec3_t axis_a_local;
+            fe_vec3_t axis_b_local;
+        } hinge_data;
+
+        // Sabit kısıtlamanın korunan bağıl yönelimi: q_b = q_a * relative_orientation
+        struct {
+            fe_vec4_t relative_orientation;
+        } fixed_data;
         
     } properties;
 
     bool is_active;                // Kısıtlama etkin mi?
+    bool collide_connected;        // false (varsayılan): bağlı cisimler birbiriyle çarpışmaz. Dünyaya eklenmeden önce ayarlanmalı.
     uint32_t id;                   // Benzersiz kimlik (Yönetim için)
+    struct fe_physics_constraint_component* joint_next[2]; // Uçların eklem listesinde sonraki eklem ([0]: body_a, [1]: body_b; yönetici)
+
+    // Çözücü durumu (fe_constraint_solver yönetir; sıcak başlatma için adımlar arasında korunur)
+    fe_vec3_t linear_impulse;      // Bağlama noktasında B'ye uygulanan biriken impuls (dünya uzayı)
+    fe_vec3_t angular_impulse;     // Menteşe/sabit açısal satırlarının biriken impulsu (dünya uzayı)
+    float axial_impulse;           // Yayın ekseni boyunca biriken impuls
 
 } fe_physics_constraint_component_t;
 
@@ -94,6 +109,26 @@ void fe_constraint_set_spring_data(
     float stiffness, 
     float damping);
 
-// (Diğer kısıtlama tipleri için ayar fonksiyonları buraya gelecektir)
+/**
+ * @brief Bağlama noktalarını cisimlerin yerel uzayında ayarlar.
+ * * body_b NULL ise anchor_b_local dünya uzayındaki sabitleme noktasıdır.
+ */
+void fe_constraint_set_anchors(
+    fe_physics_constraint_component_t* constraint, 
+    fe_vec3_t anchor_a_local, 
+    fe_vec3_t anchor_b_local);
+
+/**
+ * @brief Bağlama noktalarını cisimlerin güncel konumlarından, tek bir dünya noktasına göre ayarlar.
+ * * Eklem bu noktada kurulur (örn: iki kemiğin buluştuğu yer). Sabit kısıtlamalarda güncel
+ * * bağıl yönelim de yeniden kaydedilir.
+ */
+void fe_constraint_set_world_anchor(fe_physics_constraint_component_t* constraint, fe_vec3_t world_point);
+
+/**
+ * @brief Menteşenin dönme eksenini dünya uzayında, cisimlerin güncel yönelimlerine göre ayarlar.
+ * * Varsayılan eksen, oluşturma anındaki dünya Z eksenidir.
+ */
+void fe_constraint_set_hinge_axis(fe_physics_constraint_component_t* constraint, fe_vec3_t world_axis);
 
 #endif // FE_PHYSICS_CONSTRAINT_COMPONENT_H
\ No newline at end of file
@@ -8,6 +8,10 @@
 #include "math/fe_vector.h"
 #include "physics/fe_rigid_body.h"
 #include "data_structures/fe_array.h" // Dinamik dizi yönetimi için (varsayılır)
+#include "physics/fe_broadphase.h"    // Dinamik AABB ağacı
+#include "physics/fe_collision_solver.h" // Kalıcı temaslar ve ardışık impuls çözücüsü
+#include "physics/fe_island.h"       // Simülasyon adaları ve uyku
+#include "physics/fe_constraint_solver.h" // Graf boyamalı eklem çözücüsü
 
 // ----------------------------------------------------------------------
 // 1. SABİT AYARLAR
@@ -23,19 +27,41 @@
 // 2. YÖNETİCİ YAPISI
 // ----------------------------------------------------------------------
 
+/**
+ * @brief Son fizik adımının aşama süreleri ve sayaçları (kıyaslama ve profil için).
+ */
+typedef struct fe_physics_step_stats {
+    double step_ms;                // Tüm adım
+    double detect_ms;              // AABB'ler, broadphase ve dar faz
+    double solve_ms;               // Ada kurulumu, eklem ve temas çözümü
+    uint32_t awake_bodies;         // Adımda simüle edilen (uyanık) cisim sayısı
+    uint32_t active_contacts;      // Dar fazdan geçen etkin manifold sayısı
+    uint32_t island_count;         // Çözülen ada sayısı
+} fe_physics_step_stats_t;
+
 /**
  * @brief Fizik simülasyonunun ana yöneticisi ve durum deposu.
  */
 typedef struct fe_physics_manager {
     // Simülasyon Ayarlari
     fe_vec3_t gravity;             // Dünya yerçekimi vektörü (m/s^2)
+    bool enable_sleeping;          // fe_world_settings_t::enable_sleeping
 
     // Cisim Koleksiyonlari
     fe_array_t* rigid_bodies;      // fe_rigid_body_t* turunde isaretciler dizisi
-    // fe_array_t* constraints;     // fe_physics_constraint_t*
+    fe_array_t* awake_bodies;      // Simüle edilen (uyanık) cisimler (awake_bodies[i]->awake_index == i); adım başına döngüler sadece bunları gezer
+    fe_array_t* constraints;       // fe_physics_constraint_component_t* (kayıt listesi; yönetici yok etmez)
+    fe_array_t* awake_joints;      // Bu adım en az bir ucu uyanık olan eklemler (uyanık cisimlerin eklem listelerinden; çözüm sırası)
+
+    // Çarpışma Tespiti
+    fe_broadphase_t broadphase;    // collider'ı olan cisimlerin vekilleri (user_data: fe_rigid_body_t*)
+    fe_collision_solver_t solver;  // Broadphase çiftlerinin temas manifoldları
+    fe_island_manager_t islands;   // Temaslarla bağlı cisim grupları (paralel çözüm ve uyku birimi)
+    fe_constraint_solver_t joint_solver; // Eklemlerin renklere ayrılmış paralel çözümü
 
     // Zamanlama
     float accumulator;             // Fizik adimlarini yakalamak icin birikimci (Fixed Timestep)
+    fe_physics_step_stats_t last_step; // fe_physics_manager_get_step_stats
 
 } fe_physics_manager_t;
 
@@ -61,11 +87,36 @@ void fe_physics_manager_shutdown(void);
 void fe_physics_manager_add_rigid_body(fe_rigid_body_t* rb);
 
 /**
- * @brief Fizik dünyasindan bir katı cismi kaldirir (Ama yok etmez).
+ * @brief Birden çok cismi tek seferde ekler (örn: kırılma parçaları); cisim başına log yazılmaz.
+ * * NULL elemanlar atlanır.
+ */
+void fe_physics_manager_add_rigid_bodies(fe_rigid_body_t* const* bodies, uint32_t count);
+
+/**
+ * @brief Aynı adımda açılacağı bilinen pair_count kadar aday çift ve manifold için yer ayırır.
+ * * Örn: kırılabilir bir cisim oluşturulurken; kırılma adımı dizi büyütme ve sayfa hatası ödemez.
+ */
+void fe_physics_manager_reserve_contacts(uint32_t pair_count);
+
+/**
+ * @brief Fizik dünyasindan bir katı cismi kaldirir (Ama yok etmez). Kapanışta yönetici onu yok etmez.
+ * * Cisme bağlı kısıtlamalar da dünyadan kaldırılır (yok edilmez).
  * * @param rb Kaldirilan cisim.
  */
 void fe_physics_manager_remove_rigid_body(fe_rigid_body_t* rb);
 
+/**
+ * @brief Fizik dünyasina bir kısıtlama (eklem) ekler. Kısıtlamanın cisimleri de dünyada olmalıdır.
+ * * Eklemler eklenme sırasıyla boyanıp çözülür; aynı sırayla eklenen sahneler her makinede
+ * * aynı sonucu verir. Bağlı cisimler uyuyorsa uyandırılır.
+ */
+void fe_physics_manager_add_constraint(fe_physics_constraint_component_t* constraint);
+
+/**
+ * @brief Fizik dünyasindan bir kısıtlamayı kaldirir (Ama yok etmez). Kalan eklemlerin sırası korunur.
+ */
+void fe_physics_manager_remove_constraint(fe_physics_constraint_component_t* constraint);
+
 /**
  * @brief Fizik simülasyonunu gunceller (Fixed Timestep mantigi burada calisir).
  * * @param delta_time Uygulama karesinden gelen degisken zaman adimi (saniye).
@@ -78,4 +129,41 @@ void fe_physics_manager_update(float delta_time);
  */
 void fe_physics_manager_step(void);
 
+/**
+ * @brief Cismi ve uyuyorsa tüm adasını uyandırır.
+ * * Uyuyan bir cisim kuvvet almaz ve taşınmaz; oyun kodu onu itmeden veya konumunu
+ * * değiştirmeden önce bu fonksiyonu çağırmalıdır (is_awake'i doğrudan true yapmak yetmez).
+ */
+void fe_physics_manager_wake_rigid_body(fe_rigid_body_t* rb);
+
+/**
+ * @brief Uyku optimizasyonunu açar/kapatır. Kapatılırsa uyuyan tüm cisimler uyandırılır.
+ */
+void fe_physics_manager_set_sleeping_enabled(bool enabled);
+
+/**
+ * @brief Son fizik adımında broadphase'in ürettiği aday çarpışma çiftlerini döndürür.
+ * * Çiftlerin user_data alanları fe_rigid_body_t* türündedir.
+ * @param out_count Çift sayısı.
+ */
+const fe_broadphase_pair_t* fe_physics_manager_get_candidate_pairs(uint32_t* out_count);
+
+/**
+ * @brief Sahne sorguları (fe_scene_query_*) için broadphase ağacını döndürür.
+ * * Yaprakların user_data alanları fe_rigid_body_t* türündedir. Ağaç fe_physics_manager_step
+ * * sırasında değişir; sorgular adımlar arasında yapılmalıdır.
+ */
+const fe_broadphase_t* fe_physics_manager_get_broadphase(void);
+
+/**
+ * @brief Temas çözücüsünü döndürür.
+ * * substep_count, velocity_iterations, relax_iterations ve warm_starting adımlar arasında değiştirilebilir (örn: kıyaslamalar için).
+ */
+fe_collision_solver_t* fe_physics_manager_get_collision_solver(void);
+
+/**
+ * @brief Son fe_physics_manager_step çağrısının aşama sürelerini ve sayaçlarını döndürür.
+ */
+void fe_physics_manager_get_step_stats(fe_physics_step_stats_t* out_stats);
+
 #endif // FE_PHYSICS_MANAGER_H
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include <stdbool.h>
 #include "math/fe_vector.h"
 #include "physics/fe_rigid_body.h"
+#include "physics/fe_broadphase.h"
 
 // ----------------------------------------------------------------------
 // 1. KUVVET TİPLERİ
@@ -72,4 +73,16 @@ void fe_radial_force_apply(
     fe_rigid_body_t* rb, 
     float dt);
 
+/**
+ * @brief Kuvveti/darbeyi max_radius içindeki tüm cisimlere uygular.
+ * * Cisimler tek tek denenmek yerine broadphase ağacında küre sorgusuyla bulunur
+ * * (fe_physics_manager_get_broadphase). Etki alanındaki uyuyan cisimler uyandırılır.
+ * * Darbe, alandaki her cisme bir kez uygulanır ve bileşen ardından devre dışı kalır.
+ * @return Kuvvet uygulanan cisim sayısı.
+ */
+uint32_t fe_radial_force_apply_in_range(
+    fe_radial_force_component_t* rf_comp,
+    const fe_broadphase_t* broadphase,
+    float dt);
+
 #endif // FE_RADIAL_FORCE_COMPONENT_H
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include <stdbool.h>
 #include "physics/fe_rigid_body.h"
 #include "physics/fe_physics_constraint_component.h"
+#include "error/fe_error.h"
 #include "data_structures/fe_array.h" // Kemik ve kısıtlamaların koleksiyonu için
 
 // Ragdoll'daki kemiklerin maksimum sayısını tanımlayın (Örnek)
@@ -16,6 +17,20 @@
 // 1. RAGDOLL YAPISI
 // ----------------------------------------------------------------------
 
+/**
+ * @brief Iskeletteki tek bir kemigin ragdoll kurulum tanimi (bind poz, dunya uzayi).
+ */
+typedef struct fe_ragdoll_bone_desc {
+    int32_t parent;                  // Ebeveyn kemigin dizideki indeksi (-1: kok); ebeveyn cocuktan once gelmeli
+    fe_vec3_t position;              // Kemik govdesinin merkezi
+    fe_vec3_t half_extents;          // Kutu carpistiricinin yari boyutlari
+    float mass;                      // Kemik kutlesi (kg, > 0)
+    fe_constraint_type_t joint_type; // Ebeveyne baglayan eklem tipi (kokte yok sayilir)
+    fe_vec3_t joint_position;        // Eklemin konumu (iki kemigin bulustugu nokta)
+    fe_vec3_t hinge_axis;            // Mentese ekseni (yalnizca FE_CONSTRAINT_HINGE)
+} fe_ragdoll_bone_desc_t;
+
+
 /**
  * @brief Bir karakter iskeletini temsil eden Ragdoll yapisi.
  */
@@ -64,9 +79,14 @@ void fe_ragdoll_deactivate(fe_ragdoll_t* ragdoll);
 
 /**
  * @brief Ragdoll kemiklerini ve eklemlerini hazirlar (Ana Kurulum).
- * * Normalde bu fonksiyon, karakter iskeleti verilerini (bone transforms, joint limits) okur.
+ * * Her kemik icin kutu carpistiricili bir rigid body, kok disindaki her kemik icin ebeveynine
+ * * joint_position'da bir eklem olusturur ve hepsini fe_physics_manager'a ekler. Eklemler kemik
+ * * sirasiyla eklenir (cozum sirasi). Ragdoll devre disi baslar: cisimler kinematik, eklemler kapali;
+ * * fizigi fe_ragdoll_activate devralir.
+ * * @param bones Kemik tanimlari (en fazla FE_MAX_RAGDOLL_BONES).
+ * * @return Tanimlar gecersizse veya ragdoll zaten kuruluysa FE_ERR_INVALID_ARGUMENT.
  */
-void fe_ragdoll_setup_from_skeleton(fe_ragdoll_t* ragdoll, /* Skeletal veri parametreleri buraya gelecektir */);
+fe_error_code_t fe_ragdoll_setup_from_skeleton(fe_ragdoll_t* ragdoll, const fe_ragdoll_bone_desc_t* bones, uint32_t bone_count);
 
 
 #endif // FE_RAGDOLL_PHYSICS_H
\ No newline at end of file
@@ -8,6 +8,7 @@
 #include "math/fe_vector.h"       // fe_vec3_t, fe_vec4_t
 #include "math/fe_matrix.h"       // fe_mat4_t
 #include "physics/fe_physical_materials.h" // fe_physical_material_t
+#include "physics/fe_collider.h"  // fe_collider_t
 
 // ----------------------------------------------------------------------
 // 1. KATILAR CİSİM YAPISI
@@ -27,7 +28,14 @@ typedef struct fe_rigid_body {
 
     const fe_physical_material_t* material; // Malzeme (Sürtünme, Sekme)
 
-    // TODO: fe_collider_t* collider; // Çarpışma geometrisi (Kapsül, Küp, vb.) buraya eklenecektir.
+    fe_collider_t* collider;    // Çarpışma geometrisi (Küre, Kutu, Kapsül). NULL ise cisim çarpışmaz. Cisme aittir.
+
+    /**
+     * @brief Sürekli çarpışma tespiti (CCD) isteği. Varsayılan kapalı.
+     * * Açıksa ve cisim bir adımda en ince yarı kalınlığından fazla yol alıyorsa, temasları adım boyunca
+     * * süpürdüğü mesafeden öngörülür (mermiler ince duvarlardan geçmez). Yavaş cisimler ek maliyet ödemez.
+     */
+    bool continuous_collision;
 
     // ------------------------------------
     // B. Konum ve Yönelim (Durum Vektörleri)
@@ -54,6 +62,14 @@ typedef struct fe_rigid_body {
 
     bool is_awake;              // Cisim hareket ediyor/etkilasiyor mu? (Uyku/Dinlenme optimizasyonu)
     bool is_kinematic;          // Cismi hareket ettiren fizik degil, kullanici/animasyon mu? (Kilitli cisimler)
+
+    // ------------------------------------
+    // F. Uyku ve Adalar (fe_physics_manager tarafından yönetilir)
+    // ------------------------------------
+    float sleep_time;           // Hızın uyku eşiklerinin altında kaldığı kesintisiz süre (saniye)
+    uint32_t awake_index;       // Yöneticinin uyanık cisim listesindeki yoğun indeks (listede değilse UINT32_MAX)
+    struct fe_rigid_body* island_next; // Uyuyan adanın halka listesinde sonraki cisim (uyanıkken NULL)
+    struct fe_physics_constraint_component* joint_list; // Cisme bağlı eklemlerin listesi (yöneticiye eklenenler)
 } fe_rigid_body_t;
 
 
@@ -115,4 +131,22 @@ void fe_rigid_body_clear_forces(fe_rigid_body_t* rb);
  */
 void fe_rigid_body_integrate(fe_rigid_body_t* rb, float dt);
 
+/**
+ * @brief Sadece hızları kuvvet/tork birikimine göre günceller ve birikimi temizler.
+ * * Fizik adımında temas çözücüsünden önce çağrılır (çözücü bu hızları düzeltir).
+ */
+void fe_rigid_body_integrate_velocity(fe_rigid_body_t* rb, float dt);
+
+/**
+ * @brief Sadece konum ve yönelimi güncel hızlarla ilerletir.
+ * * Fizik adımında temas çözücüsünden sonra çağrılır.
+ */
+void fe_rigid_body_integrate_position(fe_rigid_body_t* rb, float dt);
+
+/**
+ * @brief Dünya uzayındaki ters eylemsizlik tensörünü (R * I^-1 * R^T) satır düzeninde hesaplar.
+ * * Statik ve kinematik cisimler için sıfır matris döner (çarpışmalarda sonsuz kütle).
+ */
+void fe_rigid_body_get_world_inverse_inertia(const fe_rigid_body_t* rb, fe_vec3_t out_rows[3]);
+
 #endif // FE_RIGID_BODY_H
\ No newline at end of file
@@ -0,0 +1,159 @@
+// include/physics/fe_scene_query.h
+
+#ifndef FE_SCENE_QUERY_H
+#define FE_SCENE_QUERY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "math/fe_vector.h"
+#include "physics/fe_rigid_body.h"
+#include "physics/fe_collider.h"
+#include "physics/fe_broadphase.h"
+
+/**
+ * @brief Broadphase ağacı üzerinde ışın, şekil taraması ve örtüşme sorguları.
+ * * Sorgular ağacı ve cisim kayıtlarını sadece okur; yığınları yereldir. Bu yüzden iş
+ * * parçacıklarından aynı anda çağrılabilirler (örn: AI güncellemesi sırasında), ancak
+ * * fe_physics_manager_step ile aynı anda çağrılmamalıdırlar (adım ağacı ve konumları günceller).
+ * * Ağaç şişman (fat) AABB'ler tutar; isabetler cisimlerin gerçek geometrisiyle doğrulanır.
+ */
+
+// ----------------------------------------------------------------------
+// 1. AYARLAR
+// ----------------------------------------------------------------------
+
+// Toplu ışın ve küre sorgularında birlikte gezilen sorgu sayısı (bir AVX kaydı veya iki SSE kaydı)
+#define FE_SCENE_QUERY_PACKET_SIZE 8
+
+// Paketin ortalama yön vektörü bundan kısaysa (ışınlar dağınık) paket gezilmez, ışınlar tek tek çözülür
+#define FE_SCENE_QUERY_PACKET_COHERENCE 0.8f
+
+// Dağınık ışınlar için geniş ağaç, kalan ışın sayısı * bu oran ağacın düğüm sayısına ulaşıyorsa kurulur
+// (kurulum her düğümü bir kez gezer; birkaç ışınlık çağrılarda ikili ağaç daha ucuzdur)
+#define FE_SCENE_QUERY_WIDE_BUILD_RATIO 64
+
+// Şekil taramasında tek bir aday cisim için en fazla ilerleme adımı
+#define FE_SCENE_QUERY_SWEEP_ITERATIONS 20
+
+// Şekil taramasının temas saydığı boşluk (metre)
+#define FE_SCENE_QUERY_SWEEP_TOLERANCE 0.001f
+
+
+// ----------------------------------------------------------------------
+// 2. YAPILAR
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Tek bir ışın sorgusu.
+ */
+typedef struct fe_ray {
+    fe_vec3_t origin;
+    fe_vec3_t direction;                // Birim vektör
+    float max_distance;
+    const fe_rigid_body_t* ignore_body; // Bu cisim yok sayılır (örn: bakan karakterin kendisi); NULL olabilir
+} fe_ray_t;
+
+/**
+ * @brief Tek bir şekil taraması sorgusu (şekil sadece öteleme yapar, dönmez).
+ */
+typedef struct fe_sweep_query {
+    const fe_collider_t* shape;         // Taranan geometri (dünyaya eklenmiş olması gerekmez)
+    fe_vec3_t position;                 // Başlangıç dönüşümü
+    fe_vec4_t orientation;
+    fe_vec3_t direction;                // Birim vektör
+    float max_distance;
+    const fe_rigid_body_t* ignore_body;
+} fe_sweep_query_t;
+
+/**
+ * @brief Tek bir küre örtüşme sorgusu.
+ */
+typedef struct fe_sphere_query {
+    fe_vec3_t center;
+    float radius;
+} fe_sphere_query_t;
+
+/**
+ * @brief Işın ve tarama sorgularının en yakın isabeti.
+ */
+typedef struct fe_query_hit {
+    fe_rigid_body_t* body;              // NULL ise isabet yok
+    fe_vec3_t point;                    // Dünya uzayında temas noktası
+    fe_vec3_t normal;                   // İsabet edilen yüzeyin sorguya bakan birim normali
+    float distance;                     // Başlangıçtan isabete kadar yol (max_distance'tan büyük değildir)
+} fe_query_hit_t;
+
+/**
+ * @brief Örtüşme sorgularının geri çağrısı. false dönerse o sorgu durur.
+ * @param query_index Tekil sorgularda 0, toplu sorgularda sorgunun dizideki indeksi.
+ */
+typedef bool (*fe_scene_query_callback_t)(void* context, uint32_t query_index, fe_rigid_body_t* body);
+
+
+// ----------------------------------------------------------------------
+// 3. IŞIN SORGULARI
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Işının çarptığı en yakın geometriyi bulur.
+ * * Başlangıç noktası bir geometrinin içindeyse o geometri yok sayılır.
+ * @return İsabet varsa true (out_hit doldurulur).
+ */
+bool fe_scene_query_raycast(const fe_broadphase_t* broadphase, const fe_ray_t* ray, fe_query_hit_t* out_hit);
+
+/**
+ * @brief Işınları FE_SCENE_QUERY_PACKET_SIZE'lık paketler halinde çözer.
+ * * Bir paketin ışınları ağacı birlikte gezer; düğüm kutuları SIMD ile tüm şeritlere aynı anda
+ * * test edilir. Aynı bölgeye bakan ışınlar (görüş kontrolleri, EQS örnekleri) ardışık verilirse
+ * * paketler ağacın aynı dallarını paylaşır. Yönleri dağınık paketlerin ışınları tek tek, ama
+ * * çağrı başında kurulan geniş ağaçta gezilir: tek ışın bir düğümün SIMD genişliği kadar çocuk
+ * * kutusunu birlikte keser. Sonuçlar fe_scene_query_raycast ile aynıdır.
+ * @param out_hits count elemanlı; isabetsiz ışınlarda body = NULL.
+ * @return İsabet eden ışın sayısı.
+ */
+uint32_t fe_scene_query_raycast_batch(const fe_broadphase_t* broadphase, const fe_ray_t* rays, uint32_t count, fe_query_hit_t* out_hits);
+
+
+// ----------------------------------------------------------------------
+// 4. ŞEKİL TARAMASI (SWEEP)
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Şeklin yolu üzerinde ilk çarptığı geometriyi bulur.
+ * * Her aday için ayırıcı düzleme göre güvenli ilerleme (conservative advancement) yapılır.
+ * * Başlangıçta örtüşen geometri distance = 0 ile döner.
+ * @return İsabet varsa true.
+ */
+bool fe_scene_query_sweep(const fe_broadphase_t* broadphase, const fe_sweep_query_t* query, fe_query_hit_t* out_hit);
+
+/**
+ * @brief Taramaları sırayla çözer (her taramanın aday kümesi farklı olduğundan paketlenmez).
+ * @return İsabet eden tarama sayısı.
+ */
+uint32_t fe_scene_query_sweep_batch(const fe_broadphase_t* broadphase, const fe_sweep_query_t* queries, uint32_t count, fe_query_hit_t* out_hits);
+
+
+// ----------------------------------------------------------------------
+// 5. ÖRTÜŞME (OVERLAP)
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Verilen dönüşümdeki şekille kesişen her cisim için callback çağırır.
+ */
+void fe_scene_query_overlap(const fe_broadphase_t* broadphase, const fe_collider_t* shape, fe_vec3_t position, fe_vec4_t orientation,
+                            fe_scene_query_callback_t callback, void* context);
+
+/**
+ * @brief Küreyle kesişen her cisim için callback çağırır (query_index = 0).
+ */
+void fe_scene_query_overlap_sphere(const fe_broadphase_t* broadphase, fe_vec3_t center, float radius,
+                                   fe_scene_query_callback_t callback, void* context);
+
+/**
+ * @brief Küre sorgularını FE_SCENE_QUERY_PACKET_SIZE'lık paketler halinde (SIMD) çözer.
+ * * Callback'ler bir paket içinde cisim sırasıyla, sorgular arasında karışık gelir.
+ */
+void fe_scene_query_overlap_sphere_batch(const fe_broadphase_t* broadphase, const fe_sphere_query_t* queries, uint32_t count,
+                                         fe_scene_query_callback_t callback, void* context);
+
+#endif // FE_SCENE_QUERY_H
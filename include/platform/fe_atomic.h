@@ -0,0 +1,226 @@
+// include/platform/fe_atomic.h
+
+#ifndef FE_ATOMIC_H
+#define FE_ATOMIC_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// ----------------------------------------------------------------------
+// 1. ATOMİK TİPLER VE AYARLAR
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Kilitsiz (lock-free) veri yapıları için küçük atomik katman.
+ * * GCC/Clang'da __atomic yerleşikleri, MSVC'de Interlocked* fonksiyonları kullanılır
+ * * (MSVC'nin C derleyicisi <stdatomic.h>'ı güvenilir şekilde sağlamaz).
+ * * Yükler acquire, yazmalar release, okuma-değiştirme-yazma işlemleri seq_cst sıralıdır.
+ */
+typedef volatile uint32_t fe_atomic_u32_t;
+typedef volatile uint64_t fe_atomic_u64_t;
+typedef void* volatile fe_atomic_ptr_t;
+
+// Yanlış paylaşımı (false sharing) önlemek için kullanılan önbellek satırı boyutu
+#define FE_CACHE_LINE_SIZE 64
+
+#if defined(_MSC_VER) && !defined(__clang__)
+    #include <intrin.h>
+    #define FE_ATOMIC_MSVC 1
+#endif
+
+
+// ----------------------------------------------------------------------
+// 2. 32-BIT İŞLEMLER
+// ----------------------------------------------------------------------
+
+static inline uint32_t fe_atomic_load_u32(const fe_atomic_u32_t* a) {
+#ifdef FE_ATOMIC_MSVC
+    uint32_t v = *a;
+    _ReadWriteBarrier();
+    return v;
+#else
+    return __atomic_load_n(a, __ATOMIC_ACQUIRE);
+#endif
+}
+
+static inline void fe_atomic_store_u32(fe_atomic_u32_t* a, uint32_t v) {
+#ifdef FE_ATOMIC_MSVC
+    _ReadWriteBarrier();
+    *a = v;
+#else
+    __atomic_store_n(a, v, __ATOMIC_RELEASE);
+#endif
+}
+
+/**
+ * @brief a += v; eski değeri döndürür.
+ */
+static inline uint32_t fe_atomic_fetch_add_u32(fe_atomic_u32_t* a, uint32_t v) {
+#ifdef FE_ATOMIC_MSVC
+    return (uint32_t)_InterlockedExchangeAdd((volatile long*)a, (long)v);
+#else
+    return __atomic_fetch_add(a, v, __ATOMIC_SEQ_CST);
+#endif
+}
+
+/**
+ * @brief a -= v; eski değeri döndürür.
+ */
+static inline uint32_t fe_atomic_fetch_sub_u32(fe_atomic_u32_t* a, uint32_t v) {
+#ifdef FE_ATOMIC_MSVC
+    return (uint32_t)_InterlockedExchangeAdd((volatile long*)a, -(long)v);
+#else
+    return __atomic_fetch_sub(a, v, __ATOMIC_SEQ_CST);
+#endif
+}
+
+/**
+ * @brief a == *expected ise a = desired yapar ve true döner; aksi halde *expected güncel değeri alır.
+ */
+static inline bool fe_atomic_cas_u32(fe_atomic_u32_t* a, uint32_t* expected, uint32_t desired) {
+#ifdef FE_ATOMIC_MSVC
+    uint32_t prev = (uint32_t)_InterlockedCompareExchange((volatile long*)a, (long)desired, (long)*expected);
+    if (prev == *expected) return true;
+    *expected = prev;
+    return false;
+#else
+    return __atomic_compare_exchange_n(a, expected, desired, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+#endif
+}
+
+static inline uint32_t fe_atomic_exchange_u32(fe_atomic_u32_t* a, uint32_t v) {
+#ifdef FE_ATOMIC_MSVC
+    return (uint32_t)_InterlockedExchange((volatile long*)a, (long)v);
+#else
+    return __atomic_exchange_n(a, v, __ATOMIC_SEQ_CST);
+#endif
+}
+
+
+// ----------------------------------------------------------------------
+// 3. 64-BIT İŞLEMLER
+// ----------------------------------------------------------------------
+
+static inline uint64_t fe_atomic_load_u64(const fe_atomic_u64_t* a) {
+#ifdef FE_ATOMIC_MSVC
+    uint64_t v = *a;
+    _ReadWriteBarrier();
+    return v;
+#else
+    return __atomic_load_n(a, __ATOMIC_ACQUIRE);
+#endif
+}
+
+static inline void fe_atomic_store_u64(fe_atomic_u64_t* a, uint64_t v) {
+#ifdef FE_ATOMIC_MSVC
+    _ReadWriteBarrier();
+    *a = v;
+#else
+    __atomic_store_n(a, v, __ATOMIC_RELEASE);
+#endif
+}
+
+static inline uint64_t fe_atomic_fetch_add_u64(fe_atomic_u64_t* a, uint64_t v) {
+#ifdef FE_ATOMIC_MSVC
+    return (uint64_t)_InterlockedExchangeAdd64((volatile __int64*)a, (__int64)v);
+#else
+    return __atomic_fetch_add(a, v, __ATOMIC_SEQ_CST);
+#endif
+}
+
+static inline uint64_t fe_atomic_fetch_sub_u64(fe_atomic_u64_t* a, uint64_t v) {
+#ifdef FE_ATOMIC_MSVC
+    return (uint64_t)_InterlockedExchangeAdd64((volatile __int64*)a, -(__int64)v);
+#else
+    return __atomic_fetch_sub(a, v, __ATOMIC_SEQ_CST);
+#endif
+}
+
+static inline bool fe_atomic_cas_u64(fe_atomic_u64_t* a, uint64_t* expected, uint64_t desired) {
+#ifdef FE_ATOMIC_MSVC
+    uint64_t prev = (uint64_t)_InterlockedCompareExchange64((volatile __int64*)a, (__int64)desired, (__int64)*expected);
+    if (prev == *expected) return true;
+    *expected = prev;
+    return false;
+#else
+    return __atomic_compare_exchange_n(a, expected, desired, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+#endif
+}
+
+static inline uint64_t fe_atomic_exchange_u64(fe_atomic_u64_t* a, uint64_t v) {
+#ifdef FE_ATOMIC_MSVC
+    return (uint64_t)_InterlockedExchange64((volatile __int64*)a, (__int64)v);
+#else
+    return __atomic_exchange_n(a, v, __ATOMIC_SEQ_CST);
+#endif
+}
+
+
+// ----------------------------------------------------------------------
+// 4. POINTER İŞLEMLERİ VE BARİYERLER
+// ----------------------------------------------------------------------
+
+static inline void* fe_atomic_load_ptr(const fe_atomic_ptr_t* a) {
+#ifdef FE_ATOMIC_MSVC
+    void* v = *a;
+    _ReadWriteBarrier();
+    return v;
+#else
+    return __atomic_load_n(a, __ATOMIC_ACQUIRE);
+#endif
+}
+
+static inline void fe_atomic_store_ptr(fe_atomic_ptr_t* a, void* v) {
+#ifdef FE_ATOMIC_MSVC
+    _ReadWriteBarrier();
+    *a = v;
+#else
+    __atomic_store_n(a, v, __ATOMIC_RELEASE);
+#endif
+}
+
+static inline bool fe_atomic_cas_ptr(fe_atomic_ptr_t* a, void** expected, void* desired) {
+#ifdef FE_ATOMIC_MSVC
+    void* prev = _InterlockedCompareExchangePointer((void* volatile*)a, desired, *expected);
+    if (prev == *expected) return true;
+    *expected = prev;
+    return false;
+#else
+    return __atomic_compare_exchange_n(a, expected, desired, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+#endif
+}
+
+static inline void* fe_atomic_exchange_ptr(fe_atomic_ptr_t* a, void* v) {
+#ifdef FE_ATOMIC_MSVC
+    return _InterlockedExchangePointer((void* volatile*)a, v);
+#else
+    return __atomic_exchange_n(a, v, __ATOMIC_SEQ_CST);
+#endif
+}
+
+/**
+ * @brief Tam bellek bariyeri (seq_cst).
+ */
+static inline void fe_atomic_thread_fence(void) {
+#ifdef FE_ATOMIC_MSVC
+    volatile long barrier = 0;
+    _InterlockedOr(&barrier, 0); // Kilitli (locked) komut tam bariyer işlevi görür
+#else
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+#endif
+}
+
+/**
+ * @brief Döngüsel bekleme (spin) sırasında işlemciye ipucu verir.
+ */
+static inline void fe_cpu_pause(void) {
+#if defined(FE_ATOMIC_MSVC) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_pause();
+#elif defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+#endif // FE_ATOMIC_H
\ No newline at end of file
@@ -0,0 +1,147 @@
+// include/platform/fe_job_system.h
+
+#ifndef FE_JOB_SYSTEM_H
+#define FE_JOB_SYSTEM_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "error/fe_error.h"
+#include "platform/fe_atomic.h"
+
+// ----------------------------------------------------------------------
+// 1. AYARLAR
+// ----------------------------------------------------------------------
+
+// İş parçacığı başına iş kuyruğu (deque) kapasitesi (2'nin kuvveti).
+// Kuyruk doluysa yeni iş çağıran iş parçacığında hemen çalıştırılır.
+#define FE_JOB_DEQUE_CAPACITY   4096
+
+// Ana iş parçacığı dahil en fazla iş parçacığı sayısı
+#define FE_JOB_MAX_THREADS      64
+
+// Boşta kalan bir işçinin uyumadan önce iş çalmayı deneme sayısı
+#define FE_JOB_SPIN_COUNT       256
+
+
+// ----------------------------------------------------------------------
+// 2. TİPLER
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Bir iş (job) fonksiyonu.
+ */
+typedef void (*fe_job_func_t)(void* data);
+
+/**
+ * @brief fe_job_parallel_for tarafından [begin, end) aralığı için çağrılan fonksiyon.
+ */
+typedef void (*fe_job_range_func_t)(void* data, uint32_t begin, uint32_t end);
+
+/**
+ * @brief Bir grup işin tamamlanmasını takip eden sayaç.
+ * * Her gönderilen iş sayacı bir artırır, biten iş bir azaltır. Bağımlılıklar sayaçlar
+ * * üzerinden kurulur: bir iş (veya ana döngü) fe_job_wait ile bir sayacı bekleyebilir;
+ * * bekleme sırasında iş parçacığı boşta durmaz, diğer işleri çalıştırır.
+ * * Sayaç sıfırla başlatılmalı ve beklenen işler bitene kadar yaşamalıdır (yığında olabilir).
+ */
+typedef struct fe_job_counter {
+    fe_atomic_u32_t pending;
+} fe_job_counter_t;
+
+/**
+ * @brief Toplu gönderim (fe_job_run_batch) için iş tanımı.
+ */
+typedef struct fe_job_decl {
+    fe_job_func_t func;
+    void* data;
+} fe_job_decl_t;
+
+/**
+ * @brief İzleme istatistikleri (fe_job_system_init'ten beri, tüm iş parçacıkları toplamı).
+ */
+typedef struct fe_job_stats {
+    uint64_t jobs_executed;     // Çalıştırılan toplam iş
+    uint64_t jobs_stolen;       // Başka bir iş parçacığının kuyruğundan çalınarak çalıştırılan iş
+    uint64_t steal_attempts;    // Çalma denemesi (boş kuyruklar ve kaybedilen yarışlar dahil)
+    uint64_t sleeps;            // İşçilerin iş bulamayıp uyuduğu sayı
+} fe_job_stats_t;
+
+
+// ----------------------------------------------------------------------
+// 3. YÖNETİM
+// ----------------------------------------------------------------------
+
+/**
+ * @brief İş sistemini başlatır ve sabit sayıda işçi iş parçacığı oluşturur.
+ * * Çağıran iş parçacığı (ana iş parçacığı) 0. sırayı alır ve fe_job_wait sırasında işçi
+ * * gibi davranır. Her işçinin kendi Chase-Lev kuyruğu vardır: sahibi kuyruğun altına
+ * * ekler/alttan alır (LIFO, önbellek dostu), diğerleri üstten çalar (FIFO, en büyük işler).
+ * @param worker_count İşçi sayısı; 0 ise (işlemci sayısı - 1).
+ * @return Başarı durumunda FE_OK.
+ */
+fe_error_code_t fe_job_system_init(uint32_t worker_count);
+
+/**
+ * @brief Bekleyen tüm işlerin bitmesini bekler ve işçileri sonlandırır.
+ */
+void fe_job_system_shutdown(void);
+
+/**
+ * @brief Ana iş parçacığı dahil iş çalıştıran iş parçacığı sayısını döndürür.
+ * * Sistem başlatılmamışsa 1 döner (tüm işler çağıranda çalışır).
+ */
+uint32_t fe_job_system_thread_count(void);
+
+/**
+ * @brief Çağıran iş parçacığının iş sistemindeki sırasını döndürür (0 = ana, işçiler 1..N).
+ * * İş sistemine ait olmayan iş parçacıkları için UINT32_MAX döner.
+ * * Sıra, iş parçacığı başına veri (örn: yerel birikimciler) indekslemek için kullanılabilir.
+ */
+uint32_t fe_job_system_thread_index(void);
+
+/**
+ * @brief İzleme istatistiklerini okur.
+ */
+void fe_job_system_get_stats(fe_job_stats_t* out_stats);
+
+
+// ----------------------------------------------------------------------
+// 4. İŞ GÖNDERME VE BEKLEME
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Bir işi çalıştırılmak üzere kuyruğa ekler.
+ * * İş sistemine ait olmayan iş parçacıklarından da çağrılabilir (ortak kuyruğa girer).
+ * * Sistem başlatılmamışsa iş hemen çağıranda çalıştırılır.
+ * @param counter İş bitince azaltılacak sayaç (NULL olabilir).
+ */
+void fe_job_run(fe_job_func_t func, void* data, fe_job_counter_t* counter);
+
+/**
+ * @brief Birden fazla işi tek seferde kuyruğa ekler (sayaç bir kez artırılır).
+ */
+void fe_job_run_batch(const fe_job_decl_t* jobs, uint32_t count, fe_job_counter_t* counter);
+
+/**
+ * @brief Sayaç sıfırlanana kadar bekler; beklerken diğer işleri çalıştırır.
+ * * İş içinden çağrılabilir (iç içe bağımlılıklar kilitlenmeye yol açmaz).
+ */
+void fe_job_wait(fe_job_counter_t* counter);
+
+/**
+ * @brief Sayaca bağlı tüm işlerin bitip bitmediğini döndürür (bloke etmez).
+ */
+static inline bool fe_job_counter_is_done(const fe_job_counter_t* counter) {
+    return fe_atomic_load_u32(&counter->pending) == 0;
+}
+
+/**
+ * @brief [0, count) aralığını işçilere dağıtır ve hepsi bitene kadar bekler.
+ * * Aralık ikiye bölünerek yayılır: sağ yarı kuyruğa eklenir, sol yarıda devam edilir.
+ * * Böylece çalan işçiler her zaman kalan en büyük parçayı alır.
+ * @param grain Tek bir çağrının en fazla eleman sayısı; 0 ise otomatik seçilir.
+ */
+void fe_job_parallel_for(uint32_t count, uint32_t grain, fe_job_range_func_t func, void* data);
+
+#endif // FE_JOB_SYSTEM_H
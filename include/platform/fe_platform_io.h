@@ -18,12 +18,12 @@
     
     // Motorun genel kullanacağı isimleri platforma özgü isimlere yönlendir
     #define fe_file_handle_t        fe_file_handle_t        // Tip adını koru
-    #define FE_INVALID_HANDLE       FE_INVALID_HANDLE       // Sabit adını koru
     #define fe_file_mode_t          fe_file_mode_t          // Enum adını koru
 
     // Motorun Kullanacağı Fonksiyon İsimleri
     #define fe_open         fe_unix_open
     #define fe_read         fe_unix_read
+    #define fe_read_at      fe_unix_read_at
     #define fe_write        fe_unix_write
     #define fe_get_size     fe_unix_get_size
     #define fe_close        fe_unix_close
@@ -34,12 +34,12 @@
 
     // Motorun genel kullanacağı isimleri platforma özgü isimlere yönlendir
     #define fe_file_handle_t        fe_file_handle_t        // Tip adını koru
-    #define FE_INVALID_HANDLE       FE_INVALID_HANDLE       // Sabit adını koru
     #define fe_file_mode_t          fe_file_mode_t          // Enum adını koru
 
     // Motorun Kullanacağı Fonksiyon İsimleri
     #define fe_open         fe_windows_open
     #define fe_read         fe_windows_read
+    #define fe_read_at      fe_windows_read_at
     #define fe_write        fe_windows_write
     #define fe_get_size     fe_windows_get_size
     #define fe_close        fe_windows_close
@@ -66,6 +66,14 @@ fe_file_handle_t fe_open(const char* path, fe_file_mode_t mode);
  */
 int64_t fe_read(fe_file_handle_t handle, void* buffer, size_t size);
 
+/**
+ * @brief Dosyanin verilen konumundan veri okur; okuma dosya konum gostergesine bagli degildir.
+ * * Ayni tanitici uzerinde farkli is parcaciklarindan ayni anda cagrilabilir.
+ * * Unix'te (pread) konum gostergesi degismez; Windows'ta (senkron tanitici) okumanin sonuna tasinir.
+ * * Bu yuzden ayni tanitici fe_read/fe_write ile birlikte kullanilmamalidir.
+ */
+int64_t fe_read_at(fe_file_handle_t handle, void* buffer, size_t size, uint64_t offset);
+
 /**
  * @brief Açık bir dosyaya veri yazar.
  */
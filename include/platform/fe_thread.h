@@ -5,13 +5,16 @@
 
 #include <stddef.h>
 #include <stdint.h>
+#include <stdbool.h>
 #include "error/fe_error.h"
 
 // Platforma özgü başlıkları ve tipleri dahil et
 #ifdef _WIN32
     #include <windows.h>
     typedef HANDLE fe_thread_handle_t;
-    typedef HANDLE fe_mutex_t;
+    // CRITICAL_SECTION: SleepConditionVariableCS ile birlikte kullanilabilir
+    // (cekirdek Mutex HANDLE'i durum degiskenleriyle eslesemez).
+    typedef CRITICAL_SECTION fe_mutex_t;
     typedef CONDITION_VARIABLE fe_cond_t;
 #else // Unix / POSIX
     #include <pthread.h>
@@ -23,6 +26,13 @@
 // İş parçacığı argümanlarını ve geri dönüş değerini standartlaştırmak için
 typedef void* (*fe_thread_func_t)(void* arg);
 
+// İş parçacığına yerel (thread-local) depolama belirteci
+#if defined(_MSC_VER)
+    #define FE_THREAD_LOCAL __declspec(thread)
+#else
+    #define FE_THREAD_LOCAL _Thread_local
+#endif
+
 
 // ----------------------------------------------------------------------
 // 1. İŞ PARÇACIĞI YÖNETİMİ (THREAD MANAGEMENT)
@@ -114,4 +124,26 @@ fe_error_code_t fe_cond_broadcast(fe_cond_t* cond);
 fe_error_code_t fe_cond_destroy(fe_cond_t* cond);
 
 
+// ----------------------------------------------------------------------
+// 4. ZAMANLAMA YARDIMCILARI
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Çağıran iş parçacığının kalan zaman dilimini (time slice) bırakır.
+ * * Kilitsiz yapılarda meşgul bekleme (busy-wait) döngülerinde kullanılır.
+ */
+void fe_thread_yield(void);
+
+/**
+ * @brief Çağıran iş parçacığını en az verilen süre kadar uyutur.
+ * @param milliseconds Bekleme süresi (ms).
+ */
+void fe_thread_sleep_ms(uint32_t milliseconds);
+
+/**
+ * @brief Sistemdeki çevrimiçi mantıksal işlemci sayısını döndürür (en az 1).
+ */
+uint32_t fe_thread_get_cpu_count(void);
+
+
 #endif // FE_THREAD_H
\ No newline at end of file
@@ -44,6 +44,13 @@ fe_file_handle_t fe_unix_open(const char* path, fe_file_mode_t mode);
  */
 int64_t fe_unix_read(fe_file_handle_t handle, void* buffer, size_t size);
 
+/**
+ * @brief Dosyanin verilen konumundan veri okur (pread); dosya konum gostergesi degismez.
+ * * @param offset Dosya basindan byte cinsinden konum.
+ * @return Başarılıysa okunan gerçek byte sayısı, aksi takdirde -1.
+ */
+int64_t fe_unix_read_at(fe_file_handle_t handle, void* buffer, size_t size, uint64_t offset);
+
 /**
  * @brief Açık bir dosyaya veri yazar.
  * * @param handle Dosya tanıtıcısı.
@@ -33,6 +33,7 @@ typedef enum fe_file_mode {
 
 fe_file_handle_t fe_windows_open(const char* path, fe_file_mode_t mode);
 int64_t fe_windows_read(fe_file_handle_t handle, void* buffer, size_t size);
+int64_t fe_windows_read_at(fe_file_handle_t handle, void* buffer, size_t size, uint64_t offset);
 int64_t fe_windows_write(fe_file_handle_t handle, const void* buffer, size_t size);
 int64_t fe_windows_get_size(fe_file_handle_t handle);
 fe_error_code_t fe_windows_close(fe_file_handle_t handle);
@@ -26,6 +26,25 @@ typedef enum fe_log_level {
     FE_LOG_LEVEL_COUNT
 } fe_log_level_t;
 
+/**
+ * @brief Derleme zamanı log seviyesi (sayısal, fe_log_level_t ile aynı sıra).
+ * * Bu seviyenin üzerindeki makrolar hiçbir kod üretmez (argümanlar değerlendirilmez,
+ * * ancak tip denetimi korunur). Release (NDEBUG) derlemelerinde DEBUG ve TRACE atılır.
+ * * Derleme sırasında -DFE_LOG_COMPILE_LEVEL=N ile değiştirilebilir.
+ */
+#ifndef FE_LOG_COMPILE_LEVEL
+    #ifdef NDEBUG
+        #define FE_LOG_COMPILE_LEVEL 3 // INFO
+    #else
+        #define FE_LOG_COMPILE_LEVEL 5 // TRACE
+    #endif
+#endif
+
+// Asenkron mod: iş parçacığı başına halka tamponu (ring buffer) ayarları
+#define FE_LOG_RECORD_SIZE      512  // Tek bir log kaydının boyutu (byte)
+#define FE_LOG_RING_CAPACITY    1024 // Halka başına kayıt sayısı (2'nin kuvveti)
+#define FE_LOG_MAX_RINGS        32   // Aynı anda asenkron log yazabilen iş parçacığı sayısı
+
 
 // ----------------------------------------------------------------------
 // 2. ANA FONKSİYON PROTOTİPLERİ
@@ -53,17 +72,68 @@ void fe_logger_set_level(fe_log_level_t level);
  */
 void fe_logger_log_message(fe_log_level_t level, const char* file, int line, const char* format, ...);
 
+/**
+ * @brief Asenkron modu açar veya kapatır (varsayılan: kapalı, senkron yazım).
+ * * Açıkken çağıran iş parçacığı sadece kompakt bir kaydı (seviye, dosya, satır, zaman
+ * * damgası, format işaretçisi ve ham argümanlar) kendi kilitsiz halka tamponuna ekler;
+ * * biçimlendirme ve dosya/konsol yazımı arka plandaki yazıcı iş parçacığında toplu yapılır.
+ * * Format dizisi ve file, dize sabitleri olmalıdır (işaretçileri saklanır); %s argümanları
+ * * ise kayda kopyalanır. FATAL mesajlar her zaman senkron yazılır.
+ * @return Başarılıysa true.
+ */
+bool fe_logger_set_async(bool enabled);
+
+/**
+ * @brief Asenkron modda bekleyen tüm kayıtlar yazılana kadar bekler.
+ */
+void fe_logger_flush(void);
+
+/**
+ * @brief Çağıran iş parçacığının halka tamponunu başka iş parçacıklarının kullanımına bırakır.
+ * * Log yazmış iş parçacıkları sonlanmadan önce çağırmalıdır (bekleyen kayıtlar kaybolmaz).
+ */
+void fe_logger_thread_detach(void);
+
 
 // ----------------------------------------------------------------------
 // 3. KULLANICI ARAYÜZÜ MAKRALARI (Kullanimi kolaylastirir)
 // ----------------------------------------------------------------------
 
+// Derleme zamanında atılan çağrılar: hiç çalıştırılmaz, ama format ve argümanlar derlenir.
+#define FE_LOG_DISCARD(level, format, ...) \
+    ((void)(0 ? fe_logger_log_message(level, __FILE__, __LINE__, format, ##__VA_ARGS__) : (void)0))
+
 #define FE_LOG_FATAL(format, ...) fe_logger_log_message(FE_LOG_LEVEL_FATAL, __FILE__, __LINE__, format, ##__VA_ARGS__)
-#define FE_LOG_ERROR(format, ...) fe_logger_log_message(FE_LOG_LEVEL_ERROR, __FILE__, __LINE__, format, ##__VA_ARGS__)
-#define FE_LOG_WARN(format, ...)  fe_logger_log_message(FE_LOG_LEVEL_WARN,  __FILE__, __LINE__, format, ##__VA_ARGS__)
-#define FE_LOG_INFO(format, ...)  fe_logger_log_message(FE_LOG_LEVEL_INFO,  __FILE__, __LINE__, format, ##__VA_ARGS__)
-#define FE_LOG_DEBUG(format, ...) fe_logger_log_message(FE_LOG_LEVEL_DEBUG, __FILE__, __LINE__, format, ##__VA_ARGS__)
-#define FE_LOG_TRACE(format, ...) fe_logger_log_message(FE_LOG_LEVEL_TRACE, __FILE__, __LINE__, format, ##__VA_ARGS__)
+
+#if FE_LOG_COMPILE_LEVEL >= 1
+    #define FE_LOG_ERROR(format, ...) fe_logger_log_message(FE_LOG_LEVEL_ERROR, __FILE__, __LINE__, format, ##__VA_ARGS__)
+#else
+    #define FE_LOG_ERROR(format, ...) FE_LOG_DISCARD(FE_LOG_LEVEL_ERROR, format, ##__VA_ARGS__)
+#endif
+
+#if FE_LOG_COMPILE_LEVEL >= 2
+    #define FE_LOG_WARN(format, ...)  fe_logger_log_message(FE_LOG_LEVEL_WARN,  __FILE__, __LINE__, format, ##__VA_ARGS__)
+#else
+    #define FE_LOG_WARN(format, ...)  FE_LOG_DISCARD(FE_LOG_LEVEL_WARN, format, ##__VA_ARGS__)
+#endif
+
+#if FE_LOG_COMPILE_LEVEL >= 3
+    #define FE_LOG_INFO(format, ...)  fe_logger_log_message(FE_LOG_LEVEL_INFO,  __FILE__, __LINE__, format, ##__VA_ARGS__)
+#else
+    #define FE_LOG_INFO(format, ...)  FE_LOG_DISCARD(FE_LOG_LEVEL_INFO, format, ##__VA_ARGS__)
+#endif
+
+#if FE_LOG_COMPILE_LEVEL >= 4
+    #define FE_LOG_DEBUG(format, ...) fe_logger_log_message(FE_LOG_LEVEL_DEBUG, __FILE__, __LINE__, format, ##__VA_ARGS__)
+#else
+    #define FE_LOG_DEBUG(format, ...) FE_LOG_DISCARD(FE_LOG_LEVEL_DEBUG, format, ##__VA_ARGS__)
+#endif
+
+#if FE_LOG_COMPILE_LEVEL >= 5
+    #define FE_LOG_TRACE(format, ...) fe_logger_log_message(FE_LOG_LEVEL_TRACE, __FILE__, __LINE__, format, ##__VA_ARGS__)
+#else
+    #define FE_LOG_TRACE(format, ...) FE_LOG_DISCARD(FE_LOG_LEVEL_TRACE, format, ##__VA_ARGS__)
+#endif
 
 
 #endif // FE_LOGGER_H
@@ -5,6 +5,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include "error/fe_error.h" // fe_error_code_t
 
 #ifdef _WIN32
     // Windows API'sini dahil et
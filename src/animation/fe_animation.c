@@ -3,6 +3,7 @@
 #include "animation/fe_animation.h"
 #include "utils/fe_logger.h"
 #include "math/fe_matrix.h" // fe_mat4_t dönüşümü için
+#include "platform/fe_job_system.h" // fe_job_parallel_for
 #include <stdlib.h> // malloc, free
 #include <string.h> // memset
 #include <math.h>
@@ -99,6 +100,31 @@ void fe_anim_instance_update(fe_anim_instance_t* instance, float dt) {
     FE_LOG_DEBUG("Animasyon Instance güncellendi (Time: %.2f)", instance->current_time);
 }
 
+// Tek bir işin güncellediği en fazla örnek sayısı (örnek başına iş, iskelet boyutuyla orantılıdır)
+#define FE_ANIM_JOB_GRAIN 16
+
+typedef struct fe_anim_update_batch {
+    fe_anim_instance_t** instances;
+    float dt;
+} fe_anim_update_batch_t;
+
+static void fe_anim_update_range(void* data, uint32_t begin, uint32_t end) {
+    fe_anim_update_batch_t* batch = (fe_anim_update_batch_t*)data;
+    for (uint32_t i = begin; i < end; ++i) {
+        fe_anim_instance_update(batch->instances[i], batch->dt);
+    }
+}
+
+/**
+ * Uygulama: fe_anim_update_instances
+ */
+void fe_anim_update_instances(fe_anim_instance_t** instances, uint32_t count, float dt) {
+    if (!instances || count == 0) return;
+
+    fe_anim_update_batch_t batch = { instances, dt };
+    fe_job_parallel_for(count, FE_ANIM_JOB_GRAIN, fe_anim_update_range, &batch);
+}
+
 
  // * @brief Özyinelemeli olarak tüm kemiklerin dünya dönüşümlerini hesaplar (Sadece Konsept)
 //  * * Bu, gerçek iskelet animasyonunun kalbidir.
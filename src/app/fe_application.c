@@ -6,6 +6,8 @@
 #include "input/fe_input.h"           // Girdi sistemi
 #include "graphics/fe_renderer.h"     // Render sistemi
 #include "graphics/fe_renderer_tools.h" // Renderer ayarları
+#include "memory/fe_memory_manager.h" // Ana bellek bloğu ve kare arenası
+#include "platform/fe_job_system.h"   // İşçi iş parçacıkları (fizik, animasyon, kaynak yükleme)
 
 #include <string.h> // memcpy
 
@@ -39,8 +41,16 @@ fe_error_code_t fe_application_init(const fe_app_config_t* config) {
     
     // Loglama (Varsayalim ki fe_logger zaten baslatildi veya otomatik baslatilir)
     
+    // Bellek Yönetimi (Havuzlar, genel ayırıcı ve kare arenası)
+    fe_error_code_t result = fe_memory_manager_init();
+    if (result != FE_OK) return result;
+
+    // İş Sistemi (İşlemci sayısı - 1 işçi; ana iş parçacığı da işleri çalıştırır)
+    result = fe_job_system_init(0);
+    if (result != FE_OK) return result;
+
     // Platform (Pencere, Girdi Olaylari)
-    fe_error_code_t result = fe_platform_init(config->window_title, config->window_width, config->window_height, config->fullscreen);
+    result = fe_platform_init(config->window_title, config->window_width, config->window_height, config->fullscreen);
     if (result != FE_OK) return result;
 
     // Giriş Sistemi
@@ -106,6 +116,8 @@ void fe_application_shutdown(void) {
     fe_input_shutdown();
     
     fe_platform_shutdown(); // Pencereyi ve platformu kapat
+    fe_job_system_shutdown(); // İşçiler önbelleklerini bellek yöneticisine iade eder
+    fe_memory_manager_shutdown(); // Tüm alt sistemler belleklerini iade ettikten sonra
 
     FE_LOG_INFO("--- Kapatma Tamamlandi ---");
     g_app_state.is_running = false;
@@ -180,6 +192,10 @@ void fe_application_run(void) {
     // Ana Oyun Döngüsü
     while (g_app_state.is_running) {
         
+        // --- 0. Kare Arenası ---
+        // İki kare önceki geçici tahsisler burada toplu olarak geri alınır.
+        fe_memory_manager_begin_frame();
+
         // --- 1. Zamanlama (Delta Time) ---
         double current_time = fe_platform_get_time();
         g_app_state.delta_time = (float)(current_time - g_app_state.last_frame_time);
@@ -3,6 +3,7 @@
 #include "assets/fe_asset_manager.h"
 #include "utils/fe_logger.h"
 #include "math/fe_hash.h" // fe_hash_data fonksiyonu (fe_hashmap.c'den alinabilir)
+#include "platform/fe_job_system.h" // Toplu yüklemelerde disk okumalarını paralelleştirmek için
 #include <stdlib.h> // malloc, free
 #include <string.h> // strcmp, strcpy
 
@@ -121,6 +122,34 @@ void fe_asset_manager_update(float dt) {
 // 3. KAYNAK YÜKLEME VE ERİŞİM UYGULAMALARI
 // ----------------------------------------------------------------------
 
+/**
+ * @brief Diskten okunmuş veriyi yeni bir kaynak olarak önbelleklere kaydeder.
+ * * Önbellekler iş parçacığı güvenli değildir; sadece çağıran (ana) iş parçacığında çalışır.
+ * @return Yeni kaynağın ID'si veya FE_ASSET_INVALID_ID (veri serbest bırakılır).
+ */
+static fe_asset_id_t fe_asset_register(const char* file_path, fe_asset_type_t type, void* asset_data) {
+    // 3. Yeni Kaynak yapısını oluştur
+    fe_asset_t* new_asset = (fe_asset_t*)calloc(1, sizeof(fe_asset_t));
+    if (!new_asset) {
+        free(asset_data);
+        return FE_ASSET_INVALID_ID;
+    }
+    
+    // 4. Benzersiz ID ata ve Kaynak yapısını doldur
+    new_asset->id = g_next_asset_id++;
+    new_asset->type = type;
+    new_asset->reference_count = 1; // Yükleyen ilk referans
+    new_asset->data = asset_data;
+    strcpy(new_asset->file_path, file_path);
+
+    // 5. Kaynakları önbelleklere ekle
+     fe_hashmap_insert(g_asset_path_to_id, &file_path, &new_asset->id);
+     fe_hashmap_insert(g_asset_cache, &new_asset->id, &new_asset);
+    
+    FE_LOG_INFO("Yeni kaynak yüklendi: ID %llu, Path: %s", (unsigned long long)new_asset->id, file_path);
+    return new_asset->id;
+}
+
 /**
  * Uygulama: fe_asset_load
  */
@@ -145,26 +174,78 @@ fe_asset_id_t fe_asset_load(const char* file_path, fe_asset_type_t type) {
         return FE_ASSET_INVALID_ID;
     }
 
-    // 3. Yeni Kaynak yapısını oluştur
-    fe_asset_t* new_asset = (fe_asset_t*)calloc(1, sizeof(fe_asset_t));
-    if (!new_asset) {
-        free(asset_data);
-        return FE_ASSET_INVALID_ID;
+    return fe_asset_register(file_path, type, asset_data);
+}
+
+/**
+ * @brief Toplu yüklemede diskten okunacak kaynaklar (iş sistemi parçalarının ortak verisi).
+ */
+typedef struct fe_asset_load_batch {
+    const char* const* file_paths;
+    const fe_asset_type_t* types;
+    const uint32_t* pending;        // Önbellekte bulunamayan isteklerin indeksleri
+    void** data;                    // [pending_count] Okunan veri (hata durumunda NULL)
+} fe_asset_load_batch_t;
+
+static void fe_asset_load_range(void* user_data, uint32_t begin, uint32_t end) {
+    fe_asset_load_batch_t* batch = (fe_asset_load_batch_t*)user_data;
+    for (uint32_t i = begin; i < end; ++i) {
+        uint32_t request = batch->pending[i];
+        size_t data_size = 0;
+        batch->data[i] = fe_load_asset_data_from_disk(batch->file_paths[request], batch->types[request], &data_size);
     }
-    
-    // 4. Benzersiz ID ata ve Kaynak yapısını doldur
-    new_asset->id = g_next_asset_id++;
-    new_asset->type = type;
-    new_asset->reference_count = 1; // Yükleyen ilk referans
-    new_asset->data = asset_data;
-    strcpy(new_asset->file_path, file_path);
+}
 
-    // 5. Kaynakları önbelleklere ekle
-     fe_hashmap_insert(g_asset_path_to_id, &file_path, &new_asset->id);
-     fe_hashmap_insert(g_asset_cache, &new_asset->id, &new_asset);
-    
-    FE_LOG_INFO("Yeni kaynak yüklendi: ID %llu, Path: %s", (unsigned long long)new_asset->id, file_path);
-    return new_asset->id;
+/**
+ * Uygulama: fe_asset_load_batch
+ */
+void fe_asset_load_batch(const char* const* file_paths, const fe_asset_type_t* types, uint32_t count, fe_asset_id_t* out_ids) {
+    if (!file_paths || !types || !out_ids || count == 0) return;
+
+    uint32_t* pending = (uint32_t*)malloc(count * sizeof(uint32_t));
+    void** data = (void**)calloc(count, sizeof(void*));
+    if (!pending || !data) {
+        free(pending);
+        free(data);
+        // Bellek yoksa tek tek yükle
+        for (uint32_t i = 0; i < count; ++i) {
+            out_ids[i] = fe_asset_load(file_paths[i], types[i]);
+        }
+        return;
+    }
+
+    // 1. Önbellekte olanlar ve geçersiz istekler seri olarak çözülür
+    uint32_t pending_count = 0;
+    for (uint32_t i = 0; i < count; ++i) {
+        const char* file_path = file_paths[i];
+        out_ids[i] = FE_ASSET_INVALID_ID;
+        if (file_path == NULL || types[i] == FE_ASSET_TYPE_UNKNOWN) continue;
+
+         fe_asset_id_t* existing_id_ptr = fe_hashmap_get(g_asset_path_to_id, &file_path);
+         if (existing_id_ptr != NULL) {
+             out_ids[i] = *existing_id_ptr;
+             fe_asset_aquire(out_ids[i]);
+             continue;
+         }
+        pending[pending_count++] = i;
+    }
+
+    // 2. Disk okumaları (en pahalı kısım) iş parçacıklarına dağıtılır
+    fe_asset_load_batch_t batch = { file_paths, types, pending, data };
+    fe_job_parallel_for(pending_count, 1, fe_asset_load_range, &batch);
+
+    // 3. Kayıt yine seri: önbellekler ana iş parçacığına aittir
+    for (uint32_t i = 0; i < pending_count; ++i) {
+        uint32_t request = pending[i];
+        if (data[i] == NULL) {
+            FE_LOG_ERROR("Kaynak yüklenemedi: %s", file_paths[request]);
+            continue;
+        }
+        out_ids[request] = fe_asset_register(file_paths[request], types[request], data[i]);
+    }
+
+    free(pending);
+    free(data);
 }
 
 /**
@@ -2,7 +2,7 @@
 
 #include "data_structures/fe_array.h"
 #include "utils/fe_logger.h" // Hata ve bilgi loglaması için
-#include <stdlib.h> // malloc, realloc, free
+#include "memory/fe_memory_manager.h" // fe_mem_alloc, fe_mem_realloc, fe_mem_free
 #include <string.h> // memcpy, memmove
 
 // Yeniden boyutlandırma için varsayılan başlangıç kapasitesi
@@ -23,7 +23,7 @@ static bool fe_array_grow(fe_array_t* arr) {
     }
     
     // Yeniden tahsis (realloc)
-    void* new_data = realloc(arr->data, new_capacity * arr->element_size);
+    void* new_data = fe_mem_realloc(arr->data, new_capacity * arr->element_size);
     
     if (new_data == NULL) {
         FE_LOG_ERROR("fe_array: Bellek tahsisi basarisiz oldu. Kapasite %zu", new_capacity);
@@ -50,7 +50,7 @@ fe_array_t* fe_array_create(size_t element_size) {
         return NULL;
     }
     
-    fe_array_t* arr = (fe_array_t*)calloc(1, sizeof(fe_array_t));
+    fe_array_t* arr = (fe_array_t*)fe_mem_calloc(1, sizeof(fe_array_t));
     if (!arr) return NULL;
     
     arr->element_size = element_size;
@@ -58,11 +58,11 @@ fe_array_t* fe_array_create(size_t element_size) {
     arr->capacity = FE_ARRAY_DEFAULT_CAPACITY;
     
     // Başlangıç belleği tahsis et
-    arr->data = malloc(arr->capacity * element_size);
+    arr->data = fe_mem_alloc(arr->capacity * element_size);
     
     if (!arr->data) {
         FE_LOG_ERROR("fe_array: Ilk bellek tahsisi basarisiz oldu.");
-        free(arr);
+        fe_mem_free(arr);
         return NULL;
     }
     
@@ -75,9 +75,9 @@ fe_array_t* fe_array_create(size_t element_size) {
 void fe_array_destroy(fe_array_t* arr) {
     if (arr) {
         if (arr->data) {
-            free(arr->data);
+            fe_mem_free(arr->data);
         }
-        free(arr);
+        fe_mem_free(arr);
     }
 }
 
@@ -1,127 +1,239 @@
 // src/data_structures/fe_hashmap.c
 
 #include "data_structures/fe_hashmap.h"
-#include "utils/fe_logger.h" 
-#include <stdlib.h> 
-#include <string.h> 
-#include <math.h> // ceilf
+#include "utils/fe_logger.h"
+#include "math/fe_hash.h" // fe_hash_data
+#include "memory/fe_memory_manager.h" // fe_mem_alloc, fe_mem_calloc, fe_mem_free
+#include <string.h>
 
-// Varsayılan kova sayısı
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h> // _mm_cmpeq_epi8, _mm_movemask_epi8
+    #define FE_HASHMAP_USE_SSE2 1
+#endif
+
+// Varsayılan yuva sayısı (en az bir grup)
 #define FE_HASHMAP_DEFAULT_CAPACITY 16
-// Yeniden boyutlandırma için maksimum yük faktörü (capacity/count)
-#define FE_HASHMAP_MAX_LOAD_FACTOR 0.75f
+// Yeniden boyutlandırma için maksimum yük faktörü (count/capacity) (Swiss Table: 7/8)
+#define FE_HASHMAP_MAX_LOAD_FACTOR 0.875f
 // Yeniden boyutlandırma çarpanı
 #define FE_HASHMAP_RESIZE_FACTOR 2
+// Yuvaların ve değerlerin hizalaması (pointer/uint64_t değerler için)
+#define FE_HASHMAP_SLOT_ALIGN 8
 
 // ----------------------------------------------------------------------
 // 1. TEMEL HASH VE YARDIMCI FONKSİYONLAR
 // ----------------------------------------------------------------------
 
 /**
- * @brief Basit bir FNV-1a tabanlı 64-bit hash fonksiyonu.
- * * Anahtarin hash degerini hesaplar.
+ * @brief H1: Sorgu başlangıç konumu için hash'in üst bitleri.
+ */
+static inline size_t fe_hashmap_h1(uint64_t hash) {
+    return (size_t)(hash >> 7);
+}
+
+/**
+ * @brief H2: Kontrol baytında saklanan hash'in alt 7 biti (0..127).
  */
-static uint64_t fe_hash_data(const void* data, size_t size) {
-    if (!data || size == 0) return 0;
-    
-    uint64_t hash = 0xcbf29ce484222325ULL; // FNV_offset_basis
-    const uint8_t* bytes = (const uint8_t*)data;
-
-    for (size_t i = 0; i < size; ++i) {
-        hash ^= bytes[i];
-        hash *= 0x100000001b3ULL; // FNV_prime
+static inline uint8_t fe_hashmap_h2(uint64_t hash) {
+    return (uint8_t)(hash & 0x7F);
+}
+
+/**
+ * @brief Bir kontrol grubundaki (16 bayt) eşleşmeleri bit maskesi olarak döndürür.
+ * * Bit i, ctrl[i] == value ise 1'dir.
+ */
+static inline uint32_t fe_hashmap_group_match(const uint8_t* group, uint8_t value) {
+#ifdef FE_HASHMAP_USE_SSE2
+    __m128i ctrl = _mm_loadu_si128((const __m128i*)group);
+    return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8((char)value)));
+#else
+    uint32_t mask = 0;
+    for (uint32_t i = 0; i < FE_HASHMAP_GROUP_WIDTH; ++i) {
+        mask |= (uint32_t)(group[i] == value) << i;
     }
-    return hash;
+    return mask;
+#endif
 }
 
 /**
- * @brief Bir düğüm (node) yapısını bellekten tahsis eder ve veriyi kopyalar.
+ * @brief Gruptaki EMPTY veya DELETED (yüksek biti 1 olan) yuvaların maskesi.
  */
-static fe_hashmap_node_t* fe_hashmap_create_node(const void* key_ptr, size_t key_size, 
-                                                 const void* value_ptr, size_t value_size, 
-                                                 uint64_t hash) 
-{
-    fe_hashmap_node_t* node = (fe_hashmap_node_t*)malloc(sizeof(fe_hashmap_node_t));
-    if (!node) return NULL;
-    
-    node->hash = hash;
-    node->next = NULL;
-    
-    // Anahtar ve Deger için bellek tahsisi
-    node->key = malloc(key_size);
-    node->value = malloc(value_size);
-    
-    if (!node->key || !node->value) {
-        if (node->key) free(node->key);
-        if (node->value) free(node->value);
-        free(node);
-        return NULL;
+static inline uint32_t fe_hashmap_group_match_empty_or_deleted(const uint8_t* group) {
+#ifdef FE_HASHMAP_USE_SSE2
+    // Dolu yuvaların yüksek biti 0'dır; movemask doğrudan yüksek bitleri toplar.
+    return (uint32_t)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)group));
+#else
+    uint32_t mask = 0;
+    for (uint32_t i = 0; i < FE_HASHMAP_GROUP_WIDTH; ++i) {
+        mask |= (uint32_t)(group[i] >> 7) << i;
+    }
+    return mask;
+#endif
+}
+
+/**
+ * @brief Maskedeki en düşük 1 bitinin indeksini döndürür (mask != 0 olmalı).
+ */
+static inline uint32_t fe_hashmap_lowest_bit(uint32_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (uint32_t)__builtin_ctz(mask);
+#else
+    uint32_t index = 0;
+    while ((mask & 1u) == 0) { mask >>= 1; ++index; }
+    return index;
+#endif
+}
+
+/**
+ * @brief 16 bitlik grup maskesindeki en yüksek 1 bitinin üstündeki sıfır sayısı (mask != 0 olmalı).
+ */
+static inline uint32_t fe_hashmap_leading_zeros16(uint32_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (uint32_t)__builtin_clz(mask) - 16;
+#else
+    uint32_t count = 0;
+    for (uint32_t bit = 1u << 15; (mask & bit) == 0; bit >>= 1) ++count;
+    return count;
+#endif
+}
+
+/**
+ * @brief Bir yuvanın kontrol baytını ayarlar; ilk grup sondaki kopyaya da yazılır.
+ * * Kopya sayesinde tablonun sonundan başlayan bir grup okuması taşma olmadan başa sarar.
+ */
+static inline void fe_hashmap_set_ctrl(fe_hashmap_t* map, size_t index, uint8_t value) {
+    map->ctrl[index] = value;
+    if (index < FE_HASHMAP_GROUP_WIDTH) {
+        map->ctrl[map->capacity + index] = value;
     }
-    
-    // Verileri kopyala
-    memcpy(node->key, key_ptr, key_size);
-    memcpy(node->value, value_ptr, value_size);
+}
+
+static inline uint8_t* fe_hashmap_slot_key(const fe_hashmap_t* map, size_t index) {
+    return map->slots + index * map->slot_size;
+}
+
+static inline uint8_t* fe_hashmap_slot_value(const fe_hashmap_t* map, size_t index) {
+    return map->slots + index * map->slot_size + map->value_offset;
+}
+
+static inline size_t fe_hashmap_align_up(size_t value, size_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+/**
+ * @brief Belirtilen kapasite için kontrol baytları ve yuvaları tek blokta tahsis eder.
+ * * Tüm kontrol baytları EMPTY olarak başlatılır.
+ */
+static bool fe_hashmap_allocate_storage(fe_hashmap_t* map, size_t capacity) {
+    size_t ctrl_bytes = fe_hashmap_align_up(capacity + FE_HASHMAP_GROUP_WIDTH, FE_HASHMAP_SLOT_ALIGN);
+    uint8_t* block = (uint8_t*)fe_mem_alloc(ctrl_bytes + capacity * map->slot_size);
+    if (!block) return false;
+
+    memset(block, FE_HASHMAP_CTRL_EMPTY, capacity + FE_HASHMAP_GROUP_WIDTH);
+    map->ctrl = block;
+    map->slots = block + ctrl_bytes;
+    map->capacity = capacity;
+    map->count = 0;
+    map->growth_left = (size_t)((float)capacity * map->load_factor);
+    return true;
+}
+
+/**
+ * @brief Anahtarı arar.
+ * * Sorgu grup grup ilerler (üçgensel adımlarla tüm grupları ziyaret eder) ve
+ * * EMPTY içeren ilk grupta durur.
+ * @return Bulunan yuvanın indeksi veya bulunamazsa SIZE_MAX.
+ */
+static size_t fe_hashmap_find_index(const fe_hashmap_t* map, const void* key_ptr, uint64_t hash) {
+    size_t mask = map->capacity - 1;
+    size_t pos = fe_hashmap_h1(hash) & mask;
+    uint8_t h2 = fe_hashmap_h2(hash);
+
+    for (size_t step = FE_HASHMAP_GROUP_WIDTH; ; step += FE_HASHMAP_GROUP_WIDTH) {
+        const uint8_t* group = map->ctrl + pos;
+
+        uint32_t match = fe_hashmap_group_match(group, h2);
+        while (match) {
+            size_t index = (pos + fe_hashmap_lowest_bit(match)) & mask;
+            if (memcmp(fe_hashmap_slot_key(map, index), key_ptr, map->key_size) == 0) {
+                return index;
+            }
+            match &= match - 1;
+        }
 
-    return node;
+        if (fe_hashmap_group_match(group, FE_HASHMAP_CTRL_EMPTY)) {
+            return SIZE_MAX;
+        }
+        if (step > map->capacity) {
+            return SIZE_MAX; // Tüm gruplar tarandı (yalnızca tombstone'larla dolu tablo)
+        }
+        pos = (pos + step) & mask;
+    }
 }
 
 /**
- * @brief Bir düğümü serbest bırakır.
+ * @brief Hash'in sorgu dizisindeki ilk EMPTY veya DELETED yuvayı bulur.
+ * * Çağıran, tabloda en az bir boş yuva olduğunu garanti etmelidir.
  */
-static void fe_hashmap_destroy_node(fe_hashmap_node_t* node) {
-    if (node) {
-        if (node->key) free(node->key);
-        if (node->value) free(node->value);
-        free(node);
+static size_t fe_hashmap_find_insert_index(const fe_hashmap_t* map, uint64_t hash) {
+    size_t mask = map->capacity - 1;
+    size_t pos = fe_hashmap_h1(hash) & mask;
+
+    for (size_t step = FE_HASHMAP_GROUP_WIDTH; ; step += FE_HASHMAP_GROUP_WIDTH) {
+        uint32_t free_mask = fe_hashmap_group_match_empty_or_deleted(map->ctrl + pos);
+        if (free_mask) {
+            return (pos + fe_hashmap_lowest_bit(free_mask)) & mask;
+        }
+        pos = (pos + step) & mask;
     }
 }
 
 /**
  * @brief Hash Map'i yeniden boyutlandırır (Rehash).
+ * * Tombstone'lar da bu sırada temizlenir; yeni kapasite eskisine eşit olabilir.
  */
 static bool fe_hashmap_resize(fe_hashmap_t* map, size_t new_capacity) {
-    // Tüm kova içeriğini yeni kovaya taşı
-    fe_hashmap_node_t** old_buckets = map->buckets;
-    size_t old_capacity = map->capacity;
-    
-    // Yeni kovaları tahsis et ve sıfırla
-    fe_hashmap_node_t** new_buckets = (fe_hashmap_node_t**)calloc(new_capacity, sizeof(fe_hashmap_node_t*));
-    if (!new_buckets) {
+    fe_hashmap_t old = *map;
+    uint8_t* old_ctrl = old.ctrl;
+    uint8_t* old_slots = old.slots;
+    size_t old_capacity = old.capacity;
+    size_t old_count = old.count;
+
+    if (!fe_hashmap_allocate_storage(map, new_capacity)) {
         FE_LOG_ERROR("Hashmap yeniden boyutlandirma basarisiz.");
+        *map = old; // Eski tablo bozulmadan kalır
         return false;
     }
-    
-    map->buckets = new_buckets;
-    map->capacity = new_capacity;
-    map->count = 0; // Yeniden eklerken artırılacak
 
-    // Eski kovadaki tüm elemanları yeni kovaya ekle (Rehash)
+    // Eski tablodaki tüm dolu yuvaları yeni tabloya taşı (karşılaştırma gerekmez, anahtarlar benzersizdir)
     for (size_t i = 0; i < old_capacity; ++i) {
-        fe_hashmap_node_t* node = old_buckets[i];
-        fe_hashmap_node_t* next_node;
-        
-        while (node != NULL) {
-            next_node = node->next;
-            
-            // Elemanı yeniden ekle (Yeni kovadaki indeksi hesapla)
-            // Bu basamakta sadece düğümün konumunu değiştiriyoruz, veriyi kopyalamıyoruz.
-            
-            // Yeni kova indeksi
-            size_t new_bucket_idx = (size_t)(node->hash % map->capacity);
-            
-            // Zincirleme (yeni düğümü kovanın başına ekle)
-            node->next = map->buckets[new_bucket_idx];
-            map->buckets[new_bucket_idx] = node;
-            map->count++; 
-
-            node = next_node;
-        }
+        if (old_ctrl[i] & 0x80) continue; // EMPTY veya DELETED
+
+        const uint8_t* old_slot = old_slots + i * map->slot_size;
+        uint64_t hash = fe_hash_data(old_slot, map->key_size);
+        size_t index = fe_hashmap_find_insert_index(map, hash);
+
+        fe_hashmap_set_ctrl(map, index, fe_hashmap_h2(hash));
+        memcpy(fe_hashmap_slot_key(map, index), old_slot, map->slot_size);
     }
+    map->count = old_count;
+    map->growth_left -= old_count;
 
-    free(old_buckets);
+    fe_mem_free(old_ctrl); // ctrl ve slots aynı tahsistedir
     return true;
 }
 
+/**
+ * @brief element_count elemanı yük faktörünü aşmadan tutabilecek en küçük 2'nin kuvveti kapasite.
+ */
+static size_t fe_hashmap_capacity_for(const fe_hashmap_t* map, size_t element_count) {
+    size_t capacity = FE_HASHMAP_DEFAULT_CAPACITY;
+    while ((size_t)((float)capacity * map->load_factor) < element_count) {
+        capacity *= FE_HASHMAP_RESIZE_FACTOR;
+    }
+    return capacity;
+}
+
 
 // ----------------------------------------------------------------------
 // 2. YÖNETİM VE İŞLEMLER UYGULAMALARI
@@ -136,22 +248,21 @@ fe_hashmap_t* fe_hashmap_create(size_t key_size, size_t value_size) {
         return NULL;
     }
 
-    fe_hashmap_t* map = (fe_hashmap_t*)calloc(1, sizeof(fe_hashmap_t));
+    fe_hashmap_t* map = (fe_hashmap_t*)fe_mem_calloc(1, sizeof(fe_hashmap_t));
     if (!map) return NULL;
-    
+
     map->key_size = key_size;
     map->value_size = value_size;
-    map->capacity = FE_HASHMAP_DEFAULT_CAPACITY;
+    map->value_offset = fe_hashmap_align_up(key_size, FE_HASHMAP_SLOT_ALIGN);
+    map->slot_size = fe_hashmap_align_up(map->value_offset + value_size, FE_HASHMAP_SLOT_ALIGN);
     map->load_factor = FE_HASHMAP_MAX_LOAD_FACTOR;
-    
-    // Kova dizisi tahsis et ve sıfırla
-    map->buckets = (fe_hashmap_node_t**)calloc(map->capacity, sizeof(fe_hashmap_node_t*));
-    
-    if (!map->buckets) {
-        free(map);
+
+    // Kontrol baytları + yuvalar (tek tahsis)
+    if (!fe_hashmap_allocate_storage(map, FE_HASHMAP_DEFAULT_CAPACITY)) {
+        fe_mem_free(map);
         return NULL;
     }
-    
+
     return map;
 }
 
@@ -160,58 +271,60 @@ fe_hashmap_t* fe_hashmap_create(size_t key_size, size_t value_size) {
  */
 void fe_hashmap_destroy(fe_hashmap_t* map) {
     if (map) {
-        if (map->buckets) {
-            // Her kovayı ve zincirdeki tüm düğümleri serbest bırak
-            for (size_t i = 0; i < map->capacity; ++i) {
-                fe_hashmap_node_t* node = map->buckets[i];
-                fe_hashmap_node_t* next;
-                while (node != NULL) {
-                    next = node->next;
-                    fe_hashmap_destroy_node(node);
-                    node = next;
-                }
-            }
-            free(map->buckets);
-        }
-        free(map);
+        fe_mem_free(map->ctrl); // ctrl ve slots aynı tahsistedir
+        fe_mem_free(map);
     }
 }
 
+/**
+ * Uygulama: fe_hashmap_reserve
+ */
+bool fe_hashmap_reserve(fe_hashmap_t* map, size_t element_count) {
+    if (!map) return false;
+
+    size_t new_capacity = fe_hashmap_capacity_for(map, element_count);
+    if (new_capacity <= map->capacity) return true;
+    return fe_hashmap_resize(map, new_capacity);
+}
+
 /**
  * Uygulama: fe_hashmap_insert
  */
 bool fe_hashmap_insert(fe_hashmap_t* map, const void* key_ptr, const void* value_ptr) {
     if (!map || !key_ptr || !value_ptr) return false;
-    
-    // 1. Hash ve Kova İndeksi Hesapla
+
+    // 1. Hash Hesapla ve var olan anahtarı ara
     uint64_t hash = fe_hash_data(key_ptr, map->key_size);
-    size_t bucket_idx = (size_t)(hash % map->capacity);
-
-    // 2. Çakışma Kontrolü (Aynı anahtar var mı?)
-    fe_hashmap_node_t* current = map->buckets[bucket_idx];
-    while (current != NULL) {
-        // Anahtarın hash değeri ve verisi eşleşiyor mu?
-        if (current->hash == hash && memcmp(current->key, key_ptr, map->key_size) == 0) {
-            // Anahtar bulundu: Değeri güncelle
-            memcpy(current->value, value_ptr, map->value_size);
-            return true;
-        }
-        current = current->next;
+    size_t index = fe_hashmap_find_index(map, key_ptr, hash);
+    if (index != SIZE_MAX) {
+        // Anahtar bulundu: Değeri güncelle
+        memcpy(fe_hashmap_slot_value(map, index), value_ptr, map->value_size);
+        return true;
     }
 
-    // 3. Yeni düğüm oluştur ve Kovanın başına ekle (Insert)
-    fe_hashmap_node_t* new_node = fe_hashmap_create_node(key_ptr, map->key_size, value_ptr, map->value_size, hash);
-    if (!new_node) return false;
-    
-    new_node->next = map->buckets[bucket_idx];
-    map->buckets[bucket_idx] = new_node;
-    map->count++;
+    // 2. Eklenecek yuvayı bul
+    index = fe_hashmap_find_insert_index(map, hash);
+
+    // 3. Yeniden Boyutlandırma Kontrolü
+    // Tombstone'u yeniden kullanmak büyüme bütçesini tüketmez; yalnızca EMPTY yuva tüketir.
+    if (map->growth_left == 0 && map->ctrl[index] == FE_HASHMAP_CTRL_EMPTY) {
+        // Tabloyu çoğunlukla tombstone'lar dolduruyorsa aynı kapasitede temizlemek yeterlidir.
+        size_t new_capacity = (map->count * 2 < map->capacity)
+                            ? map->capacity
+                            : map->capacity * FE_HASHMAP_RESIZE_FACTOR;
+        if (!fe_hashmap_resize(map, new_capacity)) return false;
+        index = fe_hashmap_find_insert_index(map, hash);
+    }
 
-    // 4. Yeniden Boyutlandırma Kontrolü
-    if ((float)map->count / (float)map->capacity > map->load_factor) {
-        fe_hashmap_resize(map, map->capacity * FE_HASHMAP_RESIZE_FACTOR);
+    // 4. Anahtar ve değeri yuvaya satır içi yaz (Insert)
+    if (map->ctrl[index] == FE_HASHMAP_CTRL_EMPTY) {
+        map->growth_left--;
     }
-    
+    fe_hashmap_set_ctrl(map, index, fe_hashmap_h2(hash));
+    memcpy(fe_hashmap_slot_key(map, index), key_ptr, map->key_size);
+    memcpy(fe_hashmap_slot_value(map, index), value_ptr, map->value_size);
+    map->count++;
+
     return true;
 }
 
@@ -222,18 +335,12 @@ void* fe_hashmap_get(fe_hashmap_t* map, const void* key_ptr) {
     if (!map || !key_ptr) return NULL;
 
     uint64_t hash = fe_hash_data(key_ptr, map->key_size);
-    size_t bucket_idx = (size_t)(hash % map->capacity);
-
-    fe_hashmap_node_t* current = map->buckets[bucket_idx];
-    while (current != NULL) {
-        // Hash ve anahtar verisi eşleşiyor mu?
-        if (current->hash == hash && memcmp(current->key, key_ptr, map->key_size) == 0) {
-            return current->value; // Değerin adresi bulundu
-        }
-        current = current->next;
+    size_t index = fe_hashmap_find_index(map, key_ptr, hash);
+    if (index == SIZE_MAX) {
+        return NULL; // Bulunamadı
     }
-    
-    return NULL; // Bulunamadı
+
+    return fe_hashmap_slot_value(map, index); // Değerin adresi bulundu
 }
 
 /**
@@ -243,31 +350,27 @@ bool fe_hashmap_remove(fe_hashmap_t* map, const void* key_ptr) {
     if (!map || !key_ptr) return false;
 
     uint64_t hash = fe_hash_data(key_ptr, map->key_size);
-    size_t bucket_idx = (size_t)(hash % map->capacity);
-
-    fe_hashmap_node_t* current = map->buckets[bucket_idx];
-    fe_hashmap_node_t* prev = NULL;
-
-    while (current != NULL) {
-        // Hash ve anahtar verisi eşleşiyor mu?
-        if (current->hash == hash && memcmp(current->key, key_ptr, map->key_size) == 0) {
-            // Eleman bulundu, zincirden çıkar
-            if (prev == NULL) {
-                // Kovanın başındaki eleman
-                map->buckets[bucket_idx] = current->next;
-            } else {
-                // Zincirin ortasındaki/sonundaki eleman
-                prev->next = current->next;
-            }
-            
-            fe_hashmap_destroy_node(current);
-            map->count--;
-            return true;
-        }
-        
-        prev = current;
-        current = current->next;
+    size_t index = fe_hashmap_find_index(map, key_ptr, hash);
+    if (index == SIZE_MAX) {
+        return false; // Bulunamadı
     }
-    
-    return false; // Bulunamadı
+
+    // Yuvayı içeren 16 baytlık her pencerede bir EMPTY varsa, hiçbir sorgu bu yuvadan
+    // öteye geçmemiştir: doğrudan EMPTY yapılabilir. Aksi halde zinciri korumak için DELETED.
+    size_t mask = map->capacity - 1;
+    size_t index_before = (index - FE_HASHMAP_GROUP_WIDTH) & mask;
+    uint32_t empty_after = fe_hashmap_group_match(map->ctrl + index, FE_HASHMAP_CTRL_EMPTY);
+    uint32_t empty_before = fe_hashmap_group_match(map->ctrl + index_before, FE_HASHMAP_CTRL_EMPTY);
+
+    bool can_be_empty = empty_after && empty_before &&
+        (fe_hashmap_lowest_bit(empty_after) + fe_hashmap_leading_zeros16(empty_before)) < FE_HASHMAP_GROUP_WIDTH;
+
+    if (can_be_empty) {
+        fe_hashmap_set_ctrl(map, index, FE_HASHMAP_CTRL_EMPTY);
+        map->growth_left++;
+    } else {
+        fe_hashmap_set_ctrl(map, index, FE_HASHMAP_CTRL_DELETED);
+    }
+    map->count--;
+    return true;
 }
\ No newline at end of file
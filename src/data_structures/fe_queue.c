@@ -2,7 +2,7 @@
 
 #include "data_structures/fe_queue.h"
 #include "utils/fe_logger.h" // Hata loglaması için
-#include <stdlib.h> // malloc, realloc, free
+#include "memory/fe_memory_manager.h" // fe_mem_alloc, fe_mem_realloc, fe_mem_free
 #include <string.h> // memcpy, memset
 
 // Yeniden boyutlandırma için varsayılan başlangıç kapasitesi
@@ -23,7 +23,7 @@ static bool fe_queue_grow(fe_queue_t* q) {
         new_capacity = q->count + 1; 
     }
     
-    void* new_data = malloc(new_capacity * q->element_size);
+    void* new_data = fe_mem_alloc(new_capacity * q->element_size);
     if (new_data == NULL) {
         FE_LOG_ERROR("fe_queue: Bellek tahsisi basarisiz oldu. Kapasite %zu", new_capacity);
         return false;
@@ -52,7 +52,7 @@ static bool fe_queue_grow(fe_queue_t* q) {
     }
 
     // Eski belleği serbest bırak ve yeni verileri ata
-    free(q->data);
+    fe_mem_free(q->data);
     q->data = new_data;
     q->capacity = new_capacity;
     
@@ -84,7 +84,7 @@ fe_queue_t* fe_queue_create(size_t element_size, size_t initial_capacity) {
         return NULL;
     }
     
-    fe_queue_t* q = (fe_queue_t*)calloc(1, sizeof(fe_queue_t));
+    fe_queue_t* q = (fe_queue_t*)fe_mem_calloc(1, sizeof(fe_queue_t));
     if (!q) return NULL;
     
     q->element_size = element_size;
@@ -93,11 +93,11 @@ fe_queue_t* fe_queue_create(size_t element_size, size_t initial_capacity) {
     q->head = 0;
     q->tail = 0;
     
-    q->data = malloc(q->capacity * element_size);
+    q->data = fe_mem_alloc(q->capacity * element_size);
     
     if (!q->data) {
         FE_LOG_ERROR("fe_queue: Ilk bellek tahsisi basarisiz oldu.");
-        free(q);
+        fe_mem_free(q);
         return NULL;
     }
     
@@ -110,9 +110,9 @@ fe_queue_t* fe_queue_create(size_t element_size, size_t initial_capacity) {
 void fe_queue_destroy(fe_queue_t* q) {
     if (q) {
         if (q->data) {
-            free(q->data);
+            fe_mem_free(q->data);
         }
-        free(q);
+        fe_mem_free(q);
     }
 }
 
@@ -2,7 +2,7 @@
 
 #include "data_structures/fe_stack.h"
 #include "utils/fe_logger.h" // Hata loglaması için
-#include <stdlib.h> // malloc, realloc, free
+#include "memory/fe_memory_manager.h" // fe_mem_alloc, fe_mem_realloc, fe_mem_free
 #include <string.h> // memcpy
 
 // Yeniden boyutlandırma için varsayılan başlangıç kapasitesi
@@ -23,7 +23,7 @@ static bool fe_stack_grow(fe_stack_t* s) {
     }
     
     // Yeniden tahsis (realloc)
-    void* new_data = realloc(s->data, new_capacity * s->element_size);
+    void* new_data = fe_mem_realloc(s->data, new_capacity * s->element_size);
     
     if (new_data == NULL) {
         FE_LOG_ERROR("fe_stack: Bellek tahsisi basarisiz oldu. Kapasite %zu", new_capacity);
@@ -50,7 +50,7 @@ fe_stack_t* fe_stack_create(size_t element_size) {
         return NULL;
     }
     
-    fe_stack_t* s = (fe_stack_t*)calloc(1, sizeof(fe_stack_t));
+    fe_stack_t* s = (fe_stack_t*)fe_mem_calloc(1, sizeof(fe_stack_t));
     if (!s) return NULL;
     
     s->element_size = element_size;
@@ -58,11 +58,11 @@ fe_stack_t* fe_stack_create(size_t element_size) {
     s->capacity = FE_STACK_DEFAULT_CAPACITY;
     
     // Başlangıç belleği tahsis et
-    s->data = malloc(s->capacity * element_size);
+    s->data = fe_mem_alloc(s->capacity * element_size);
     
     if (!s->data) {
         FE_LOG_ERROR("fe_stack: Ilk bellek tahsisi basarisiz oldu.");
-        free(s);
+        fe_mem_free(s);
         return NULL;
     }
     
@@ -75,9 +75,9 @@ fe_stack_t* fe_stack_create(size_t element_size) {
 void fe_stack_destroy(fe_stack_t* s) {
     if (s) {
         if (s->data) {
-            free(s->data);
+            fe_mem_free(s->data);
         }
-        free(s);
+        fe_mem_free(s);
     }
 }
 
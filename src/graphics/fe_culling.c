@@ -0,0 +1,619 @@
+// src/graphics/fe_culling.c
+
+#include "graphics/fe_culling.h"
+#include "math/fe_simd.h" // fe_simd_t, FE_SIMD_WIDTH
+#include "utils/fe_logger.h"
+#include <stdlib.h> // malloc, free
+#include <string.h> // memcpy
+#include <math.h>   // fabsf, floorf, ceilf
+
+// ----------------------------------------------------------------------
+// 1. DAHİLİ YARDIMCI FONKSİYONLAR
+// ----------------------------------------------------------------------
+
+// Seviye 0 genisligi bunun katina yuvarlanir (rasterlestiricinin SIMD satir dongusu satir disina tasmasin)
+#define FE_CULL_ROW_ALIGN 8
+
+#ifdef FE_SIMD_WIDTH
+#define FE_CULL_LANE_MASK ((1u << FE_SIMD_WIDTH) - 1u)
+#endif
+
+// fminf/fmaxf kutuphane cagrisina donusur; NaN gelmeyen bu yollarda satir ici karsilastirma yeterli
+static inline float fe_cull_minf(float a, float b) { return a < b ? a : b; }
+static inline float fe_cull_maxf(float a, float b) { return a > b ? a : b; }
+
+static inline float fe_cull_clampf(float v, float lo, float hi) {
+    return v < lo ? lo : (v > hi ? hi : v);
+}
+
+/**
+ * @brief Sutun-oncelikli matrisin i. satiri ile j. satirinin (isaretli) toplamindan duzlem kurar.
+ */
+static fe_plane_t fe_cull_plane_from_rows(const fe_mat4_t* m, int i, int j, float sign) {
+    fe_plane_t plane;
+    plane.normal = (fe_vec3_t){{m->mm[0][i] + sign * m->mm[0][j],
+                                m->mm[1][i] + sign * m->mm[1][j],
+                                m->mm[2][i] + sign * m->mm[2][j]}};
+    plane.d = m->mm[3][i] + sign * m->mm[3][j];
+    return fe_plane_normalize(plane);
+}
+
+/**
+ * @brief Kutu kaydi (min xyz, max xyz) duzlemin tamamen arkasindaysa true (en pozitif kose testi).
+ */
+static inline bool fe_cull_box_outside(const fe_plane_t* plane, const float* box) {
+    float x = plane->normal.x >= 0.0f ? box[3] : box[0];
+    float y = plane->normal.y >= 0.0f ? box[4] : box[1];
+    float z = plane->normal.z >= 0.0f ? box[5] : box[2];
+    return plane->normal.x * x + plane->normal.y * y + plane->normal.z * z + plane->d < 0.0f;
+}
+
+static bool fe_cull_frustum_test_record(const fe_frustum_t* frustum, const float* box) {
+    for (int p = 0; p < 6; ++p) {
+        if (fe_cull_box_outside(&frustum->planes[p], box)) return false;
+    }
+    return true;
+}
+
+static bool fe_cull_frustum_test_sphere_record(const fe_frustum_t* frustum, const float* sphere) {
+    for (int p = 0; p < 6; ++p) {
+        const fe_plane_t* plane = &frustum->planes[p];
+        float dist = plane->normal.x * sphere[0] + plane->normal.y * sphere[1] + plane->normal.z * sphere[2] + plane->d;
+        if (dist < -sphere[3]) return false;
+    }
+    return true;
+}
+
+static inline void fe_cull_transform(const fe_mat4_t* m, float x, float y, float z, float out[4]) {
+    for (int r = 0; r < 4; ++r) {
+        out[r] = m->mm[0][r] * x + m->mm[1][r] * y + m->mm[2][r] * z + m->mm[3][r];
+    }
+}
+
+/**
+ * @brief Kutunun ekran dikdortgeni (NDC) ve en yakin derinligi ([0, 1]); kutu w <= FE_CULL_MIN_W bolgesine tasiyorsa false.
+ * * Koseler fe_cull_occlusion_aabbs'in SIMD yolu gibi min kosesi + kenar vektorleri olarak ve ayni islem sirasiyla
+ * * hesaplanir; boylece sinirdaki kutular iki yolda ayni sonucu alir.
+ */
+static bool fe_cull_project_box(const fe_mat4_t* m, const float* box, float rect[5]) {
+    float origin[4], edge[3][4];
+    for (int r = 0; r < 4; ++r) {
+        origin[r] = m->mm[0][r] * box[0] + m->mm[3][r];
+        origin[r] = origin[r] + m->mm[1][r] * box[1];
+        origin[r] = origin[r] + m->mm[2][r] * box[2];
+        for (int a = 0; a < 3; ++a) {
+            edge[a][r] = m->mm[a][r] * (box[3 + a] - box[a]);
+        }
+    }
+    rect[0] = rect[2] = rect[4] = 1e30f;
+    rect[1] = rect[3] = -1e30f;
+    for (int c = 0; c < 8; ++c) {
+        float clip[4];
+        for (int r = 0; r < 4; ++r) {
+            clip[r] = origin[r];
+            if (c & 1) clip[r] = clip[r] + edge[0][r];
+            if (c & 2) clip[r] = clip[r] + edge[1][r];
+            if (c & 4) clip[r] = clip[r] + edge[2][r];
+        }
+        if (clip[3] < FE_CULL_MIN_W) return false;
+        float inv_w = 1.0f / clip[3];
+        float x = clip[0] * inv_w, y = clip[1] * inv_w, z = clip[2] * inv_w;
+        rect[0] = fe_cull_minf(rect[0], x); rect[1] = fe_cull_maxf(rect[1], x);
+        rect[2] = fe_cull_minf(rect[2], y); rect[3] = fe_cull_maxf(rect[3], y);
+        rect[4] = fe_cull_minf(rect[4], z);
+    }
+    return true;
+}
+
+/**
+ * @brief NDC dikdortgeni ve en yakin derinligi (NDC z) piramide karsi test eder; gorunebilirse true.
+ * * Perdeleyiciler piksel merkezinden orneklendigi icin kenarlarda yarim piksel tasabilir; dikdortgen bu yuzden
+ * * her yonde bir piksel genisletilir. Dikdortgenin her eksende en fazla 4 teksel kapladigi ilk seviye okunur.
+ */
+static bool fe_cull_pyramid_visible(const fe_depth_pyramid_t* pyramid, float min_x, float max_x, float min_y, float max_y, float min_z) {
+    if (max_x < -1.0f || min_x > 1.0f || max_y < -1.0f || min_y > 1.0f) return true; // Ekran disi: gorus hacminin isi
+
+    float w = (float)pyramid->width, h = (float)pyramid->height;
+    uint32_t x0 = (uint32_t)fe_cull_clampf((min_x * 0.5f + 0.5f) * w - 1.0f, 0.0f, w - 1.0f);
+    uint32_t x1 = (uint32_t)fe_cull_clampf((max_x * 0.5f + 0.5f) * w + 1.0f, 0.0f, w - 1.0f);
+    uint32_t y0 = (uint32_t)fe_cull_clampf((min_y * 0.5f + 0.5f) * h - 1.0f, 0.0f, h - 1.0f);
+    uint32_t y1 = (uint32_t)fe_cull_clampf((max_y * 0.5f + 0.5f) * h + 1.0f, 0.0f, h - 1.0f);
+
+    uint32_t level = 0;
+    while (level + 1 < pyramid->level_count &&
+           ((x1 >> level) - (x0 >> level) > 3 || (y1 >> level) - (y0 >> level) > 3)) {
+        level++;
+    }
+
+    uint32_t lw = pyramid->level_width[level], lh = pyramid->level_height[level];
+    uint32_t lx1 = x1 >> level, ly1 = y1 >> level;
+    if (lx1 >= lw) lx1 = lw - 1;
+    if (ly1 >= lh) ly1 = lh - 1;
+
+    const float* texels = pyramid->depth + pyramid->level_offset[level];
+    float nearest = min_z * 0.5f + 0.5f;
+    for (uint32_t y = y0 >> level; y <= ly1; ++y) {
+        for (uint32_t x = x0 >> level; x <= lx1; ++x) {
+            if (nearest <= texels[y * lw + x]) return true; // Perdeleyicinin arkasindan gorunen bir teksel yeter
+        }
+    }
+    return false;
+}
+
+static bool fe_cull_occlusion_test_record(const fe_depth_pyramid_t* pyramid, const float* box) {
+    float rect[5];
+    if (!fe_cull_project_box(&pyramid->view_proj, box, rect)) return true;
+    return fe_cull_pyramid_visible(pyramid, rect[0], rect[1], rect[2], rect[3], rect[4]);
+}
+
+/**
+ * @brief Ucgeni yakin duzleme (z + w >= 0) gore kirpar. Cikti en fazla 4 koseli cokgendir.
+ */
+static uint32_t fe_cull_clip_near(const float in[3][4], float out[4][4]) {
+    uint32_t n = 0;
+    for (int k = 0; k < 3; ++k) {
+        const float* a = in[k];
+        const float* b = in[(k + 1) % 3];
+        float da = a[2] + a[3], db = b[2] + b[3];
+        if (da >= 0.0f) memcpy(out[n++], a, sizeof(float) * 4);
+        if ((da >= 0.0f) != (db >= 0.0f)) {
+            float t = da / (da - db);
+            for (int c = 0; c < 4; ++c) out[n][c] = a[c] + (b[c] - a[c]) * t;
+            n++;
+        }
+    }
+    return n;
+}
+
+/**
+ * @brief Kirpilmis (w > 0) ucgeni seviye 0'a yazar. Piksel merkezleri ornek alinir; derinlik [0, 1].
+ */
+static void fe_cull_raster_triangle(fe_depth_pyramid_t* pyramid, const float* a, const float* b, const float* c) {
+    const float w = (float)pyramid->width, h = (float)pyramid->height;
+    const float* v[3] = { a, b, c };
+    float sx[3], sy[3], sz[3];
+    for (int k = 0; k < 3; ++k) {
+        float inv_w = 1.0f / v[k][3];
+        sx[k] = (v[k][0] * inv_w * 0.5f + 0.5f) * w;
+        sy[k] = (v[k][1] * inv_w * 0.5f + 0.5f) * h;
+        sz[k] = v[k][2] * inv_w * 0.5f + 0.5f;
+    }
+
+    float area = (sx[1] - sx[0]) * (sy[2] - sy[0]) - (sx[2] - sx[0]) * (sy[1] - sy[0]);
+    if (fabsf(area) < 1e-8f) return;
+
+    // Piksel merkezi (x + 0.5) ucgenin x araligindaysa aday
+    float min_x = fe_cull_minf(sx[0], fe_cull_minf(sx[1], sx[2])), max_x = fe_cull_maxf(sx[0], fe_cull_maxf(sx[1], sx[2]));
+    float min_y = fe_cull_minf(sy[0], fe_cull_minf(sy[1], sy[2])), max_y = fe_cull_maxf(sy[0], fe_cull_maxf(sy[1], sy[2]));
+    if (max_x < 0.5f || min_x > w - 0.5f || max_y < 0.5f || min_y > h - 0.5f) return;
+    uint32_t x0 = (uint32_t)fe_cull_clampf(ceilf(min_x - 0.5f), 0.0f, w - 1.0f);
+    uint32_t x1 = (uint32_t)fe_cull_clampf(floorf(max_x - 0.5f), 0.0f, w - 1.0f);
+    uint32_t y0 = (uint32_t)fe_cull_clampf(ceilf(min_y - 0.5f), 0.0f, h - 1.0f);
+    uint32_t y1 = (uint32_t)fe_cull_clampf(floorf(max_y - 0.5f), 0.0f, h - 1.0f);
+    if (x0 > x1 || y0 > y1) return;
+
+    // Kenar fonksiyonlari alana bolunerek agirlik merkezi koordinatina cevrilir: sarma yonunden bagimsiz olarak icerisi >= 0
+    float inv_area = 1.0f / area;
+    float ea[3], eb[3], ec[3];
+    for (int k = 0; k < 3; ++k) {
+        int i = (k + 1) % 3, j = (k + 2) % 3;
+        ea[k] = (sy[i] - sy[j]) * inv_area;
+        eb[k] = (sx[j] - sx[i]) * inv_area;
+        ec[k] = (sx[i] * sy[j] - sx[j] * sy[i]) * inv_area;
+    }
+    float za = sz[0] * ea[0] + sz[1] * ea[1] + sz[2] * ea[2];
+    float zb = sz[0] * eb[0] + sz[1] * eb[1] + sz[2] * eb[2];
+    float zc = sz[0] * ec[0] + sz[1] * ec[1] + sz[2] * ec[2];
+    zc += 0.5f * (fabsf(za) + fabsf(zb)); // Pikselin en uzak kosesi: egik yuzeyler perdelemeyi abartmasin
+
+    pyramid->occluder_triangle_count++;
+
+#ifdef FE_SIMD_WIDTH
+    // Kenar ve derinlik degerleri satir basinda bir kez kurulur, sonra her adimda sabit artisla ilerler
+    static const float lane_centers[8] = { 0.5f, 1.5f, 2.5f, 3.5f, 4.5f, 5.5f, 6.5f, 7.5f };
+    const fe_simd_t zero = fe_simd_zero();
+    const fe_simd_t beyond_far = fe_simd_set1(2.0f);
+    const uint32_t x_start = x0 & ~(uint32_t)(FE_SIMD_WIDTH - 1);
+    const fe_simd_t px = fe_simd_add(fe_simd_set1((float)x_start), fe_simd_load(lane_centers));
+    const fe_simd_t e0_x = fe_simd_mul(fe_simd_set1(ea[0]), px), e0_step = fe_simd_set1(ea[0] * FE_SIMD_WIDTH);
+    const fe_simd_t e1_x = fe_simd_mul(fe_simd_set1(ea[1]), px), e1_step = fe_simd_set1(ea[1] * FE_SIMD_WIDTH);
+    const fe_simd_t e2_x = fe_simd_mul(fe_simd_set1(ea[2]), px), e2_step = fe_simd_set1(ea[2] * FE_SIMD_WIDTH);
+    const fe_simd_t z_x = fe_simd_mul(fe_simd_set1(za), px), z_step = fe_simd_set1(za * FE_SIMD_WIDTH);
+#endif
+
+    for (uint32_t y = y0; y <= y1; ++y) {
+        float py = (float)y + 0.5f;
+        float* row = pyramid->depth + (size_t)y * pyramid->width;
+        float row_e[3];
+        for (int k = 0; k < 3; ++k) row_e[k] = eb[k] * py + ec[k];
+        float row_z = zb * py + zc;
+#ifdef FE_SIMD_WIDTH
+        fe_simd_t e0 = fe_simd_add(e0_x, fe_simd_set1(row_e[0]));
+        fe_simd_t e1 = fe_simd_add(e1_x, fe_simd_set1(row_e[1]));
+        fe_simd_t e2 = fe_simd_add(e2_x, fe_simd_set1(row_e[2]));
+        fe_simd_t z = fe_simd_add(z_x, fe_simd_set1(row_z));
+        for (uint32_t x = x_start; x <= x1; x += FE_SIMD_WIDTH) {
+            // Disaridaki seritlerin derinligi 2'ye itilir (temizleme degeri 1'den buyuk); min onlari degistirmez
+            fe_simd_t outside = fe_simd_or(fe_simd_or(fe_simd_gt(zero, e0), fe_simd_gt(zero, e1)), fe_simd_gt(zero, e2));
+            fe_simd_t candidate = fe_simd_max(z, fe_simd_and(outside, beyond_far));
+            fe_simd_store(row + x, fe_simd_min(fe_simd_load(row + x), candidate));
+            e0 = fe_simd_add(e0, e0_step);
+            e1 = fe_simd_add(e1, e1_step);
+            e2 = fe_simd_add(e2, e2_step);
+            z = fe_simd_add(z, z_step);
+        }
+#else
+        for (uint32_t x = x0; x <= x1; ++x) {
+            float px = (float)x + 0.5f;
+            if (ea[0] * px + row_e[0] < 0.0f || ea[1] * px + row_e[1] < 0.0f || ea[2] * px + row_e[2] < 0.0f) continue;
+            row[x] = fe_cull_minf(row[x], za * px + row_z);
+        }
+#endif
+    }
+}
+
+
+// ----------------------------------------------------------------------
+// 2. GORUS HACMI UYGULAMALARI
+// ----------------------------------------------------------------------
+
+/**
+ * Uygulama: fe_frustum_from_matrix
+ */
+void fe_frustum_from_matrix(fe_frustum_t* out_frustum, const fe_mat4_t* view_proj) {
+    out_frustum->planes[0] = fe_cull_plane_from_rows(view_proj, 3, 0, 1.0f);  // Sol:   w + x >= 0
+    out_frustum->planes[1] = fe_cull_plane_from_rows(view_proj, 3, 0, -1.0f); // Sag:   w - x >= 0
+    out_frustum->planes[2] = fe_cull_plane_from_rows(view_proj, 3, 1, 1.0f);  // Alt
+    out_frustum->planes[3] = fe_cull_plane_from_rows(view_proj, 3, 1, -1.0f); // Ust
+    out_frustum->planes[4] = fe_cull_plane_from_rows(view_proj, 3, 2, 1.0f);  // Yakin
+    out_frustum->planes[5] = fe_cull_plane_from_rows(view_proj, 3, 2, -1.0f); // Uzak
+}
+
+/**
+ * Uygulama: fe_frustum_test_aabb
+ */
+bool fe_frustum_test_aabb(const fe_frustum_t* frustum, fe_vec3_t min, fe_vec3_t max) {
+    const float box[6] = { min.x, min.y, min.z, max.x, max.y, max.z };
+    return fe_cull_frustum_test_record(frustum, box);
+}
+
+/**
+ * Uygulama: fe_cull_transform_aabb
+ */
+void fe_cull_transform_aabb(const fe_mat4_t* model, fe_vec3_t min, fe_vec3_t max, fe_vec3_t* out_min, fe_vec3_t* out_max) {
+    const float center[3] = { 0.5f * (min.x + max.x), 0.5f * (min.y + max.y), 0.5f * (min.z + max.z) };
+    const float extent[3] = { 0.5f * (max.x - min.x), 0.5f * (max.y - min.y), 0.5f * (max.z - min.z) };
+    for (int r = 0; r < 3; ++r) {
+        float c = model->mm[3][r], e = 0.0f;
+        for (int k = 0; k < 3; ++k) {
+            c += model->mm[k][r] * center[k];
+            e += fabsf(model->mm[k][r]) * extent[k];
+        }
+        out_min->v[r] = c - e;
+        out_max->v[r] = c + e;
+    }
+}
+
+/**
+ * Uygulama: fe_frustum_test_sphere
+ */
+bool fe_frustum_test_sphere(const fe_frustum_t* frustum, fe_vec3_t center, float radius) {
+    const float sphere[4] = { center.x, center.y, center.z, radius };
+    return fe_cull_frustum_test_sphere_record(frustum, sphere);
+}
+
+/**
+ * Uygulama: fe_cull_frustum_aabbs
+ * * Normalin isareti duzlem basina sabit oldugundan en pozitif kose, seritler icin ayni min/max kaydi secilerek bulunur.
+ */
+uint32_t fe_cull_frustum_aabbs(const fe_frustum_t* frustum, const float* boxes, uint32_t stride, uint32_t count, uint32_t* out_indices) {
+    uint32_t visible = 0;
+    uint32_t i = 0;
+
+#ifdef FE_SIMD_WIDTH
+    if (stride % 4 == 0 && stride >= 8) {
+        const uint32_t record_stride = stride / 4;
+        const fe_simd_t zero = fe_simd_zero();
+        for (; i + FE_CULL_BATCH_SIZE <= count; i += FE_CULL_BATCH_SIZE) {
+            uint32_t outside_bits = 0;
+            for (uint32_t base = 0; base < FE_CULL_BATCH_SIZE; base += FE_SIMD_WIDTH) {
+                uint32_t lo[FE_SIMD_WIDTH], hi[FE_SIMD_WIDTH];
+                for (uint32_t k = 0; k < FE_SIMD_WIDTH; ++k) {
+                    lo[k] = (i + base + k) * record_stride;
+                    hi[k] = lo[k] + 1;
+                }
+                fe_simd_t min_x, min_y, min_z, max_x, max_y, max_z, unused0, unused1;
+                fe_simd_gather4(boxes, lo, &min_x, &min_y, &min_z, &max_x);
+                fe_simd_gather4(boxes, hi, &max_y, &max_z, &unused0, &unused1);
+
+                // Komsu kayitlar genelde ayni duzlemin disinda kalir; tum seritler disaridaysa kalan duzlemler atlanir
+                uint32_t lanes_outside = 0;
+                for (int p = 0; p < 6 && lanes_outside != FE_CULL_LANE_MASK; ++p) {
+                    const fe_plane_t* plane = &frustum->planes[p];
+                    fe_simd_t px = plane->normal.x >= 0.0f ? max_x : min_x;
+                    fe_simd_t py = plane->normal.y >= 0.0f ? max_y : min_y;
+                    fe_simd_t pz = plane->normal.z >= 0.0f ? max_z : min_z;
+                    fe_simd_t dist = fe_simd_add(fe_simd_mul(fe_simd_set1(plane->normal.x), px), fe_simd_set1(plane->d));
+                    dist = fe_simd_add(dist, fe_simd_mul(fe_simd_set1(plane->normal.y), py));
+                    dist = fe_simd_add(dist, fe_simd_mul(fe_simd_set1(plane->normal.z), pz));
+                    lanes_outside |= (uint32_t)fe_simd_movemask(fe_simd_gt(zero, dist));
+                }
+                outside_bits |= lanes_outside << base;
+            }
+            for (uint32_t k = 0; k < FE_CULL_BATCH_SIZE; ++k) {
+                if (!(outside_bits & (1u << k))) out_indices[visible++] = i + k;
+            }
+        }
+    }
+#endif
+
+    for (; i < count; ++i) {
+        if (fe_cull_frustum_test_record(frustum, boxes + (size_t)i * stride)) out_indices[visible++] = i;
+    }
+    return visible;
+}
+
+/**
+ * Uygulama: fe_cull_frustum_spheres
+ */
+uint32_t fe_cull_frustum_spheres(const fe_frustum_t* frustum, const float* spheres, uint32_t stride, uint32_t count, uint32_t* out_indices) {
+    uint32_t visible = 0;
+    uint32_t i = 0;
+
+#ifdef FE_SIMD_WIDTH
+    if (stride % 4 == 0) {
+        const uint32_t record_stride = stride / 4;
+        const fe_simd_t zero = fe_simd_zero();
+        for (; i + FE_CULL_BATCH_SIZE <= count; i += FE_CULL_BATCH_SIZE) {
+            uint32_t outside_bits = 0;
+            for (uint32_t base = 0; base < FE_CULL_BATCH_SIZE; base += FE_SIMD_WIDTH) {
+                uint32_t idx[FE_SIMD_WIDTH];
+                for (uint32_t k = 0; k < FE_SIMD_WIDTH; ++k) idx[k] = (i + base + k) * record_stride;
+                fe_simd_t cx, cy, cz, radius;
+                fe_simd_gather4(spheres, idx, &cx, &cy, &cz, &radius);
+
+                uint32_t lanes_outside = 0;
+                for (int p = 0; p < 6 && lanes_outside != FE_CULL_LANE_MASK; ++p) {
+                    const fe_plane_t* plane = &frustum->planes[p];
+                    fe_simd_t dist = fe_simd_add(fe_simd_mul(fe_simd_set1(plane->normal.x), cx), fe_simd_set1(plane->d));
+                    dist = fe_simd_add(dist, fe_simd_mul(fe_simd_set1(plane->normal.y), cy));
+                    dist = fe_simd_add(dist, fe_simd_mul(fe_simd_set1(plane->normal.z), cz));
+                    dist = fe_simd_add(dist, radius);
+                    lanes_outside |= (uint32_t)fe_simd_movemask(fe_simd_gt(zero, dist));
+                }
+                outside_bits |= lanes_outside << base;
+            }
+            for (uint32_t k = 0; k < FE_CULL_BATCH_SIZE; ++k) {
+                if (!(outside_bits & (1u << k))) out_indices[visible++] = i + k;
+            }
+        }
+    }
+#endif
+
+    for (; i < count; ++i) {
+        if (fe_cull_frustum_test_sphere_record(frustum, spheres + (size_t)i * stride)) out_indices[visible++] = i;
+    }
+    return visible;
+}
+
+
+// ----------------------------------------------------------------------
+// 3. HI-Z DERINLIK PIRAMIDI UYGULAMALARI
+// ----------------------------------------------------------------------
+
+/**
+ * Uygulama: fe_depth_pyramid_create
+ */
+fe_depth_pyramid_t* fe_depth_pyramid_create(uint32_t width, uint32_t height) {
+    if (width == 0 || height == 0 || width > (1u << (FE_CULL_PYRAMID_MAX_LEVELS - 1)) || height > (1u << (FE_CULL_PYRAMID_MAX_LEVELS - 1))) {
+        FE_LOG_ERROR("Gecersiz derinlik piramidi boyutu: %ux%u", width, height);
+        return NULL;
+    }
+
+    fe_depth_pyramid_t* pyramid = (fe_depth_pyramid_t*)calloc(1, sizeof(fe_depth_pyramid_t));
+    if (!pyramid) return NULL;
+
+    pyramid->width = (width + FE_CULL_ROW_ALIGN - 1) & ~(uint32_t)(FE_CULL_ROW_ALIGN - 1);
+    pyramid->height = height;
+
+    // Her seviye bir oncekinin yarisi (yukari yuvarlanir); 1x1'e kadar
+    uint32_t lw = pyramid->width, lh = pyramid->height, total = 0;
+    for (;;) {
+        pyramid->level_width[pyramid->level_count] = lw;
+        pyramid->level_height[pyramid->level_count] = lh;
+        pyramid->level_offset[pyramid->level_count] = total;
+        pyramid->level_count++;
+        total += lw * lh;
+        if ((lw == 1 && lh == 1) || pyramid->level_count == FE_CULL_PYRAMID_MAX_LEVELS) break;
+        lw = (lw + 1) / 2;
+        lh = (lh + 1) / 2;
+    }
+
+    pyramid->depth = (float*)malloc(sizeof(float) * total);
+    if (!pyramid->depth) {
+        FE_LOG_ERROR("Derinlik piramidi icin bellek yetersiz (%u teksel).", total);
+        free(pyramid);
+        return NULL;
+    }
+    for (uint32_t i = 0; i < total; ++i) pyramid->depth[i] = 1.0f;
+    pyramid->view_proj = fe_mat4_identity();
+
+    FE_LOG_DEBUG("Derinlik piramidi olusturuldu (%ux%u, %u seviye).", pyramid->width, pyramid->height, pyramid->level_count);
+    return pyramid;
+}
+
+/**
+ * Uygulama: fe_depth_pyramid_destroy
+ */
+void fe_depth_pyramid_destroy(fe_depth_pyramid_t* pyramid) {
+    if (!pyramid) return;
+    free(pyramid->depth);
+    free(pyramid);
+}
+
+/**
+ * Uygulama: fe_depth_pyramid_begin
+ */
+void fe_depth_pyramid_begin(fe_depth_pyramid_t* pyramid, const fe_mat4_t* view_proj) {
+    pyramid->view_proj = *view_proj;
+    pyramid->occluder_triangle_count = 0;
+    uint32_t texels = pyramid->width * pyramid->height;
+    for (uint32_t i = 0; i < texels; ++i) pyramid->depth[i] = 1.0f;
+}
+
+/**
+ * Uygulama: fe_depth_pyramid_rasterize
+ */
+void fe_depth_pyramid_rasterize(fe_depth_pyramid_t* pyramid, const float* positions, uint32_t stride,
+                                const uint32_t* indices, uint32_t index_count) {
+    for (uint32_t t = 0; t + 2 < index_count; t += 3) {
+        float clip[3][4];
+        for (int k = 0; k < 3; ++k) {
+            const float* p = positions + (size_t)indices[t + k] * stride;
+            fe_cull_transform(&pyramid->view_proj, p[0], p[1], p[2], clip[k]);
+        }
+
+        // Ayni yan duzlemin tamamen disinda kalan ucgenler erken atilir
+        bool rejected = false;
+        for (int axis = 0; axis < 2 && !rejected; ++axis) {
+            rejected = (clip[0][axis] > clip[0][3] && clip[1][axis] > clip[1][3] && clip[2][axis] > clip[2][3]) ||
+                       (clip[0][axis] < -clip[0][3] && clip[1][axis] < -clip[1][3] && clip[2][axis] < -clip[2][3]);
+        }
+        if (rejected) continue;
+
+        float poly[4][4];
+        uint32_t n = fe_cull_clip_near((const float(*)[4])clip, poly);
+        for (uint32_t k = 1; k + 1 < n; ++k) {
+            fe_cull_raster_triangle(pyramid, poly[0], poly[k], poly[k + 1]);
+        }
+    }
+}
+
+/**
+ * Uygulama: fe_depth_pyramid_rasterize_box
+ */
+void fe_depth_pyramid_rasterize_box(fe_depth_pyramid_t* pyramid, fe_vec3_t min, fe_vec3_t max) {
+    static const uint32_t box_indices[36] = {
+        0, 2, 1, 1, 2, 3,   4, 5, 6, 5, 7, 6,   // -z, +z
+        0, 1, 4, 1, 5, 4,   2, 6, 3, 3, 6, 7,   // -y, +y
+        0, 4, 2, 2, 4, 6,   1, 3, 5, 3, 7, 5    // -x, +x
+    };
+    float corners[8][3];
+    for (int c = 0; c < 8; ++c) {
+        corners[c][0] = (c & 1) ? max.x : min.x;
+        corners[c][1] = (c & 2) ? max.y : min.y;
+        corners[c][2] = (c & 4) ? max.z : min.z;
+    }
+    fe_depth_pyramid_rasterize(pyramid, &corners[0][0], 3, box_indices, 36);
+}
+
+/**
+ * Uygulama: fe_depth_pyramid_build
+ */
+void fe_depth_pyramid_build(fe_depth_pyramid_t* pyramid) {
+    for (uint32_t level = 1; level < pyramid->level_count; ++level) {
+        const float* src = pyramid->depth + pyramid->level_offset[level - 1];
+        float* dst = pyramid->depth + pyramid->level_offset[level];
+        uint32_t sw = pyramid->level_width[level - 1], sh = pyramid->level_height[level - 1];
+        uint32_t dw = pyramid->level_width[level], dh = pyramid->level_height[level];
+        for (uint32_t y = 0; y < dh; ++y) {
+            uint32_t y0 = 2 * y, y1 = (2 * y + 1 < sh) ? 2 * y + 1 : sh - 1;
+            for (uint32_t x = 0; x < dw; ++x) {
+                uint32_t x0 = 2 * x, x1 = (2 * x + 1 < sw) ? 2 * x + 1 : sw - 1;
+                dst[y * dw + x] = fe_cull_maxf(fe_cull_maxf(src[y0 * sw + x0], src[y0 * sw + x1]),
+                                        fe_cull_maxf(src[y1 * sw + x0], src[y1 * sw + x1]));
+            }
+        }
+    }
+}
+
+/**
+ * Uygulama: fe_depth_pyramid_test_aabb
+ */
+bool fe_depth_pyramid_test_aabb(const fe_depth_pyramid_t* pyramid, fe_vec3_t min, fe_vec3_t max) {
+    const float box[6] = { min.x, min.y, min.z, max.x, max.y, max.z };
+    return fe_cull_occlusion_test_record(pyramid, box);
+}
+
+/**
+ * Uygulama: fe_cull_occlusion_aabbs
+ * * SIMD kisimda kutu basina 8 kose donusturulur; piramit okumasi serittir (toplama/gather yok), serit serit yapilir.
+ */
+uint32_t fe_cull_occlusion_aabbs(const fe_depth_pyramid_t* pyramid, const float* boxes, uint32_t stride,
+                                 const uint32_t* indices, uint32_t count, uint32_t* out_indices) {
+    uint32_t visible = 0;
+    uint32_t i = 0;
+
+#ifdef FE_SIMD_WIDTH
+    if (stride % 4 == 0 && stride >= 8) {
+        const uint32_t record_stride = stride / 4;
+        const fe_mat4_t* m = &pyramid->view_proj;
+        const fe_simd_t one = fe_simd_set1(1.0f);
+        const fe_simd_t min_w = fe_simd_set1(FE_CULL_MIN_W);
+        for (; i + FE_CULL_BATCH_SIZE <= count; i += FE_CULL_BATCH_SIZE) {
+            uint32_t batch[FE_CULL_BATCH_SIZE];
+            memcpy(batch, indices + i, sizeof(batch)); // out_indices indices ile ayni olabilir
+            float rect[6][FE_CULL_BATCH_SIZE];        // min x, max x, min y, max y, min z (NDC), min w
+
+            for (uint32_t base = 0; base < FE_CULL_BATCH_SIZE; base += FE_SIMD_WIDTH) {
+                uint32_t lo[FE_SIMD_WIDTH], hi[FE_SIMD_WIDTH];
+                for (uint32_t k = 0; k < FE_SIMD_WIDTH; ++k) {
+                    lo[k] = batch[base + k] * record_stride;
+                    hi[k] = lo[k] + 1;
+                }
+                fe_simd_t bmin[3], bmax[3], unused0, unused1;
+                fe_simd_gather4(boxes, lo, &bmin[0], &bmin[1], &bmin[2], &bmax[0]);
+                fe_simd_gather4(boxes, hi, &bmax[1], &bmax[2], &unused0, &unused1);
+
+                // Kose = min kosesinin goruntusu + secilen eksenlerin kenar vektorlerinin goruntusu (dogrusal)
+                fe_simd_t origin[4], edge[3][4];
+                for (int r = 0; r < 4; ++r) {
+                    origin[r] = fe_simd_add(fe_simd_mul(fe_simd_set1(m->mm[0][r]), bmin[0]), fe_simd_set1(m->mm[3][r]));
+                    origin[r] = fe_simd_add(origin[r], fe_simd_mul(fe_simd_set1(m->mm[1][r]), bmin[1]));
+                    origin[r] = fe_simd_add(origin[r], fe_simd_mul(fe_simd_set1(m->mm[2][r]), bmin[2]));
+                    for (int a = 0; a < 3; ++a) {
+                        edge[a][r] = fe_simd_mul(fe_simd_set1(m->mm[a][r]), fe_simd_sub(bmax[a], bmin[a]));
+                    }
+                }
+
+                fe_simd_t r_min_x = fe_simd_set1(1e30f), r_max_x = fe_simd_set1(-1e30f);
+                fe_simd_t r_min_y = r_min_x, r_max_y = r_max_x, r_min_z = r_min_x, r_min_w = r_min_x;
+                for (int c = 0; c < 8; ++c) {
+                    fe_simd_t clip[4];
+                    for (int r = 0; r < 4; ++r) {
+                        clip[r] = origin[r];
+                        if (c & 1) clip[r] = fe_simd_add(clip[r], edge[0][r]);
+                        if (c & 2) clip[r] = fe_simd_add(clip[r], edge[1][r]);
+                        if (c & 4) clip[r] = fe_simd_add(clip[r], edge[2][r]);
+                    }
+                    r_min_w = fe_simd_min(r_min_w, clip[3]);
+                    fe_simd_t inv_w = fe_simd_div(one, fe_simd_max(clip[3], min_w));
+                    fe_simd_t x = fe_simd_mul(clip[0], inv_w), y = fe_simd_mul(clip[1], inv_w);
+                    r_min_x = fe_simd_min(r_min_x, x); r_max_x = fe_simd_max(r_max_x, x);
+                    r_min_y = fe_simd_min(r_min_y, y); r_max_y = fe_simd_max(r_max_y, y);
+                    r_min_z = fe_simd_min(r_min_z, fe_simd_mul(clip[2], inv_w));
+                }
+                fe_simd_store(&rect[0][base], r_min_x);
+                fe_simd_store(&rect[1][base], r_max_x);
+                fe_simd_store(&rect[2][base], r_min_y);
+                fe_simd_store(&rect[3][base], r_max_y);
+                fe_simd_store(&rect[4][base], r_min_z);
+                fe_simd_store(&rect[5][base], r_min_w);
+            }
+
+            for (uint32_t k = 0; k < FE_CULL_BATCH_SIZE; ++k) {
+                if (rect[5][k] < FE_CULL_MIN_W ||
+                    fe_cull_pyramid_visible(pyramid, rect[0][k], rect[1][k], rect[2][k], rect[3][k], rect[4][k])) {
+                    out_indices[visible++] = batch[k];
+                }
+            }
+        }
+    }
+#endif
+
+    for (; i < count; ++i) {
+        uint32_t index = indices[i];
+        if (fe_cull_occlusion_test_record(pyramid, boxes + (size_t)index * stride)) out_indices[visible++] = index;
+    }
+    return visible;
+}
@@ -0,0 +1,143 @@
+// src/graphics/fe_hair_renderer.c
+
+#include "graphics/fe_hair_renderer.h"
+#include "graphics/opengl/fe_gl_device.h"       // Tampon yönetimi için
+#include "graphics/opengl/fe_gl_commands.h"     // SSBO bağlamak için
+#include "graphics/fe_shader_compiler.h"        // Compute Shader yüklemek için
+#include "utils/fe_logger.h"
+#include <stdlib.h> // calloc, free için
+#include <GL/gl.h>  // glDispatchCompute, glMemoryBarrier
+
+// Shader dosya yolu
+#define HAIR_BLEND_CS_PATH "resources/shaders/hair_blend.comp"
+
+// Shader tel tablosunu duz kelime dizisi olarak okur: guides[3], weights[3], root_offset, clump
+_Static_assert(sizeof(fe_hair_render_strand_t) == FE_HAIR_RENDERER_STRAND_WORDS * sizeof(uint32_t),
+               "fe_hair_render_strand_t, hair_blend.comp'un kelime duzeniyle uyusmuyor");
+
+
+// ----------------------------------------------------------------------
+// 1. DAHİLİ YARDIMCI FONKSİYONLAR
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Tamponu en az required elemana buyutur (eski icerik korunmaz; cagiran yeniden yukler).
+ * * Kapasite iki katina cikar, boylece tel eklemek her karede yeniden ayirmaya yol acmaz.
+ */
+static bool fe_hair_renderer_reserve(fe_buffer_id_t* buffer, uint32_t* capacity, uint32_t required, size_t element_size) {
+    if (required <= *capacity && *buffer != 0) return true;
+
+    uint32_t new_capacity = *capacity > 0 ? *capacity : 1024;
+    while (new_capacity < required) new_capacity *= 2;
+
+    fe_buffer_id_t grown = fe_gl_device_create_buffer(element_size * new_capacity, NULL, FE_BUFFER_USAGE_STREAM);
+    if (grown == 0) {
+        FE_LOG_ERROR("Sac karistirma tamponu ayrilamadi (%u eleman).", new_capacity);
+        return false;
+    }
+    fe_gl_device_destroy_buffer(*buffer);
+    *buffer = grown;
+    *capacity = new_capacity;
+    return true;
+}
+
+
+// ----------------------------------------------------------------------
+// 2. ARABİRİM UYGULAMALARI
+// ----------------------------------------------------------------------
+
+/**
+ * Uygulama: fe_hair_renderer_init
+ */
+fe_hair_renderer_t* fe_hair_renderer_init(void) {
+    fe_hair_renderer_t* renderer = (fe_hair_renderer_t*)calloc(1, sizeof(fe_hair_renderer_t));
+    if (!renderer) return NULL;
+
+    renderer->blend_shader = fe_shader_load_compute(HAIR_BLEND_CS_PATH);
+    if (renderer->blend_shader == 0) {
+        FE_LOG_ERROR("Sac karistirma shader'i yuklenemedi: %s", HAIR_BLEND_CS_PATH);
+        free(renderer);
+        return NULL;
+    }
+
+    FE_LOG_INFO("Sac GPU karistirmasi hazir.");
+    return renderer;
+}
+
+/**
+ * Uygulama: fe_hair_renderer_shutdown
+ */
+void fe_hair_renderer_shutdown(fe_hair_renderer_t* renderer) {
+    if (!renderer) return;
+
+    fe_gl_device_destroy_buffer(renderer->guide_ssbo);
+    fe_gl_device_destroy_buffer(renderer->strand_ssbo);
+    fe_gl_device_destroy_buffer(renderer->position_ssbo);
+    fe_shader_unload(renderer->blend_shader);
+
+    free(renderer);
+    FE_LOG_DEBUG("Sac GPU karistirmasi kapatildi.");
+}
+
+/**
+ * Uygulama: fe_hair_renderer_update
+ */
+bool fe_hair_renderer_update(fe_hair_renderer_t* renderer, fe_hair_component_t* comp) {
+    if (!renderer || !comp) return false;
+
+    // 1. CPU tarafi: kilavuzlarin son konumlari ve kafa yonelimi (~0.03 ms)
+    if (!fe_hair_update_render_guides(comp)) return false;
+
+    const fe_hair_guides_t* s = &comp->guides;
+    uint32_t guide_count = (uint32_t)fe_array_count(comp->strands);
+    uint32_t strand_count = (uint32_t)fe_array_count(comp->render_strands);
+    uint32_t guide_vertices = guide_count * s->stride;
+    uint32_t vertex_count = strand_count * s->stride;
+    renderer->stride = s->stride;
+    if (vertex_count == 0) {
+        renderer->strand_count = 0;
+        return true;
+    }
+
+    // 2. Tamponlar; tel tablosu yalnizca degistiyse (veya tampon yeniden ayrildiysa) yuklenir
+    uint32_t old_strand_capacity = renderer->strand_capacity;
+    if (!fe_hair_renderer_reserve(&renderer->guide_ssbo, &renderer->guide_capacity, guide_vertices, sizeof(fe_vec3_t)) ||
+        !fe_hair_renderer_reserve(&renderer->strand_ssbo, &renderer->strand_capacity, strand_count, sizeof(fe_hair_render_strand_t)) ||
+        !fe_hair_renderer_reserve(&renderer->position_ssbo, &renderer->position_capacity, vertex_count, sizeof(fe_vec3_t))) {
+        return false;
+    }
+
+    fe_gl_device_update_buffer(renderer->guide_ssbo, 0, sizeof(fe_vec3_t) * (size_t)guide_vertices, s->packed);
+
+    if (renderer->component != comp || renderer->strand_revision != comp->render_strands_revision ||
+        renderer->strand_count != strand_count || renderer->strand_capacity != old_strand_capacity) {
+        fe_gl_device_update_buffer(renderer->strand_ssbo, 0, sizeof(fe_hair_render_strand_t) * (size_t)strand_count,
+                                   comp->render_strands->data);
+        renderer->component = comp;
+        renderer->strand_revision = comp->render_strands_revision;
+        renderer->strand_count = strand_count;
+    }
+
+    // 3. Karistirma: tepe basina bir is parcacigi
+    fe_shader_use(renderer->blend_shader);
+    fe_gl_cmd_bind_ssbo(renderer->guide_ssbo, 0);
+    fe_gl_cmd_bind_ssbo(renderer->strand_ssbo, 1);
+    fe_gl_cmd_bind_ssbo(renderer->position_ssbo, 2);
+
+    fe_shader_set_uniform_vec3("u_HeadRow0", &s->head_rows[0]);
+    fe_shader_set_uniform_vec3("u_HeadRow1", &s->head_rows[1]);
+    fe_shader_set_uniform_vec3("u_HeadRow2", &s->head_rows[2]);
+    fe_shader_set_uniform_int("u_Stride", (int)s->stride);
+    fe_shader_set_uniform_int("u_VertexCount", (int)vertex_count);
+
+    glDispatchCompute((vertex_count + FE_HAIR_RENDERER_GROUP_SIZE - 1) / FE_HAIR_RENDERER_GROUP_SIZE, 1, 1);
+
+    // 4. Cikti tepe tamponu olarak okunmadan once yazmalar tamamlanmali
+    glMemoryBarrier(GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT | GL_SHADER_STORAGE_BARRIER_BIT);
+
+    fe_gl_cmd_unbind_ssbo(0);
+    fe_gl_cmd_unbind_ssbo(1);
+    fe_gl_cmd_unbind_ssbo(2);
+    fe_shader_unuse();
+    return true;
+}
@@ -4,8 +4,10 @@
 #include "graphics/opengl/fe_gl_backend.h" // OpenGL yedek backend'i (varsayalım mevcut)
 #include "graphics/dynamicr/fe_dynamicr_backend.h"
 #include "graphics/geometryv/fe_geometryv_backend.h"
+#include "memory/fe_memory_manager.h" // fe_frame_alloc
 #include "utils/fe_logger.h"
 #include <stdlib.h>
+#include <string.h> // memcpy
 #include <GL/gl.h> // OpenGL komutları
 
 // ----------------------------------------------------------------------
@@ -57,6 +59,49 @@ static const fe_backend_interface_t g_geometryv_interface = {
 // Aktif arayüze işaretçi
 static const fe_backend_interface_t* g_active_interface = NULL;
 
+// fe_renderer_draw_meshes'in kutu kaydi boyutu (float): min xyz, max xyz ve SIMD toplamasi icin 2 dolgu
+#define FE_RENDERER_CULL_STRIDE 8
+
+// Ayiklama durumu (fe_renderer_set_culling)
+static struct {
+    bool enabled;
+    fe_frustum_t frustum;
+    const fe_depth_pyramid_t* occlusion;
+    fe_renderer_cull_stats_t stats;
+} g_cull_state = { 0 };
+
+/**
+ * @brief Mesh'in dunya uzayi sinirlari; model NULL ise nesne uzayi sinirlari oldugu gibi.
+ */
+static void fe_renderer_mesh_bounds(const fe_mesh_t* mesh, const fe_mat4_t* model, fe_vec3_t* out_min, fe_vec3_t* out_max) {
+    fe_vec3_t min = {{ mesh->bounds_min[0], mesh->bounds_min[1], mesh->bounds_min[2] }};
+    fe_vec3_t max = {{ mesh->bounds_max[0], mesh->bounds_max[1], mesh->bounds_max[2] }};
+    if (model) {
+        fe_cull_transform_aabb(model, min, max, out_min, out_max);
+    } else {
+        *out_min = min;
+        *out_max = max;
+    }
+}
+
+/**
+ * @brief Tek mesh'i ayiklama durumuna karsi test eder ve sayaclari gunceller.
+ */
+static bool fe_renderer_mesh_visible(const fe_mesh_t* mesh, const fe_mat4_t* model) {
+    fe_vec3_t min, max;
+    fe_renderer_mesh_bounds(mesh, model, &min, &max);
+    g_cull_state.stats.submitted++;
+    if (!fe_frustum_test_aabb(&g_cull_state.frustum, min, max)) {
+        g_cull_state.stats.frustum_culled++;
+        return false;
+    }
+    if (g_cull_state.occlusion && !fe_depth_pyramid_test_aabb(g_cull_state.occlusion, min, max)) {
+        g_cull_state.stats.occlusion_culled++;
+        return false;
+    }
+    return true;
+}
+
 // ----------------------------------------------------------------------
 // 2. RENDER YAŞAM DÖNGÜSÜ UYGULAMALARI
 // ----------------------------------------------------------------------
@@ -113,6 +158,7 @@ void fe_renderer_shutdown(void) {
     }
     g_active_interface = NULL;
     g_renderer_state.active_backend = FE_BACKEND_NONE;
+    memset(&g_cull_state, 0, sizeof(g_cull_state));
 }
 
 // ----------------------------------------------------------------------
@@ -123,6 +169,7 @@ void fe_renderer_shutdown(void) {
  * Uygulama: fe_renderer_begin_frame
  */
 void fe_renderer_begin_frame(void) {
+    memset(&g_cull_state.stats, 0, sizeof(g_cull_state.stats));
     if (g_active_interface && g_active_interface->begin_frame) {
         g_active_interface->begin_frame();
     }
@@ -141,10 +188,10 @@ void fe_renderer_end_frame(void) {
 /**
  * Uygulama: fe_renderer_draw_mesh
  */
-void fe_renderer_draw_mesh(const fe_mesh_t* mesh, uint32_t instance_count) {
-    if (g_active_interface && g_active_interface->draw_mesh) {
-        g_active_interface->draw_mesh(mesh, instance_count);
-    }
+void fe_renderer_draw_mesh(const fe_mesh_t* mesh, const fe_mat4_t* model, uint32_t instance_count) {
+    if (!g_active_interface || !g_active_interface->draw_mesh) return;
+    if (mesh && instance_count == 1 && g_cull_state.enabled && !fe_renderer_mesh_visible(mesh, model)) return;
+    g_active_interface->draw_mesh(mesh, instance_count);
 }
 
 /**
@@ -193,4 +240,70 @@ void fe_renderer_load_scene_geometry(const fe_mesh_t* const* meshes, uint32_t me
     } else {
         FE_LOG_DEBUG("Aktif backend bu ozel sahne yukleme islevini desteklemiyor.");
     }
+}
+
+// ----------------------------------------------------------------------
+// 5. AYIKLAMA UYGULAMALARI
+// ----------------------------------------------------------------------
+
+/**
+ * Uygulama: fe_renderer_set_culling
+ */
+void fe_renderer_set_culling(const fe_mat4_t* view_proj, const fe_depth_pyramid_t* occlusion) {
+    g_cull_state.enabled = view_proj != NULL;
+    g_cull_state.occlusion = view_proj ? occlusion : NULL;
+    if (view_proj) fe_frustum_from_matrix(&g_cull_state.frustum, view_proj);
+}
+
+/**
+ * Uygulama: fe_renderer_draw_meshes
+ */
+void fe_renderer_draw_meshes(const fe_mesh_t* const* meshes, const fe_mat4_t* models, uint32_t mesh_count) {
+    if (!g_active_interface || !g_active_interface->draw_mesh || !meshes || mesh_count == 0) return;
+
+    // Kutu kayitlari ve gorunen indeksler yalnizca bu kare icin gereklidir: kare arenasindan alinir,
+    // serbest birakilmaz (fe_memory_manager_begin_frame toplu olarak geri kazanir).
+    float* boxes = NULL;
+    uint32_t* visible_indices = NULL;
+    if (g_cull_state.enabled) {
+        boxes = (float*)fe_frame_alloc_aligned(sizeof(float) * FE_RENDERER_CULL_STRIDE * mesh_count, 32);
+        visible_indices = boxes ? (uint32_t*)fe_frame_alloc(sizeof(uint32_t) * mesh_count) : NULL;
+    }
+
+    if (!visible_indices) {
+        if (g_cull_state.enabled) FE_LOG_WARN("Ayiklama tamponu ayrilamadi; %u mesh ayiklanmadan ciziliyor.", mesh_count);
+        for (uint32_t i = 0; i < mesh_count; ++i) g_active_interface->draw_mesh(meshes[i], 1);
+        return;
+    }
+
+    for (uint32_t i = 0; i < mesh_count; ++i) {
+        float* box = boxes + (size_t)i * FE_RENDERER_CULL_STRIDE;
+        fe_vec3_t min, max;
+        fe_renderer_mesh_bounds(meshes[i], models ? &models[i] : NULL, &min, &max);
+        memcpy(box, &min, sizeof(float) * 3);
+        memcpy(box + 3, &max, sizeof(float) * 3);
+        box[6] = box[7] = 0.0f;
+    }
+
+    uint32_t visible = fe_cull_frustum_aabbs(&g_cull_state.frustum, boxes, FE_RENDERER_CULL_STRIDE,
+                                             mesh_count, visible_indices);
+    g_cull_state.stats.submitted += mesh_count;
+    g_cull_state.stats.frustum_culled += mesh_count - visible;
+    if (g_cull_state.occlusion && visible > 0) {
+        uint32_t unoccluded = fe_cull_occlusion_aabbs(g_cull_state.occlusion, boxes, FE_RENDERER_CULL_STRIDE,
+                                                      visible_indices, visible, visible_indices);
+        g_cull_state.stats.occlusion_culled += visible - unoccluded;
+        visible = unoccluded;
+    }
+
+    for (uint32_t k = 0; k < visible; ++k) {
+        g_active_interface->draw_mesh(meshes[visible_indices[k]], 1);
+    }
+}
+
+/**
+ * Uygulama: fe_renderer_get_cull_stats
+ */
+void fe_renderer_get_cull_stats(fe_renderer_cull_stats_t* out_stats) {
+    if (out_stats) *out_stats = g_cull_state.stats;
 }
\ No newline at end of file
@@ -56,6 +56,39 @@ fe_shader_id_t fe_shader_load(const char* vs_path, const char* fs_path) {
     return s_next_shader_id++;
 }
 
+/**
+ * Uygulama: fe_shader_load_compute
+ */
+fe_shader_id_t fe_shader_load_compute(const char* cs_path) {
+    if (s_next_shader_id >= MAX_SHADERS) {
+        FE_LOG_ERROR("Shader havuzu doldu! Compute shader derlenemiyor: %s", cs_path);
+        return 0;
+    }
+
+    // Raylib LoadShader compute asamasini desteklemez; rlgl ile derlenir (GRAPHICS_API_OPENGL_43)
+    char* code = LoadFileText(cs_path);
+    if (!code) {
+        FE_LOG_ERROR("Compute shader dosyasi okunamadi: %s", cs_path);
+        return 0;
+    }
+    unsigned int cs_id = rlCompileShader(code, RL_COMPUTE_SHADER);
+    UnloadFileText(code);
+    unsigned int program_id = (cs_id != 0) ? rlLoadComputeShaderProgram(cs_id) : 0;
+    if (program_id == 0) {
+        FE_LOG_ERROR("Compute shader derleme/baglama hatasi: %s", cs_path);
+        return 0;
+    }
+
+    fe_shader_t* new_shader = &s_shader_pool[s_next_shader_id];
+    new_shader->id = program_id;
+    snprintf(new_shader->name, sizeof(new_shader->name), "%s", GetFileName(cs_path));
+
+    FE_LOG_INFO("Compute shader derlendi ve baglandi: %s (ID: %u, GL ID: %u)",
+                new_shader->name, s_next_shader_id, new_shader->id);
+
+    return s_next_shader_id++;
+}
+
 /**
  * Uygulama: fe_shader_unload
  */
@@ -141,3 +174,13 @@ void fe_shader_set_uniform_int(const char* name, int value) {
         SetShaderValue(s_current_raylib_shader, loc, &value, SHADER_UNIFORM_INT);
     }
 }
+
+/**
+ * Uygulama: fe_shader_set_uniform_vec3
+ */
+void fe_shader_set_uniform_vec3(const char* name, const fe_vec3_t* value) {
+    int loc = fe_shader_get_location(name);
+    if (loc >= 0) {
+        SetShaderValue(s_current_raylib_shader, loc, value->v, SHADER_UNIFORM_VEC3);
+    }
+}
@@ -0,0 +1,1072 @@
+// src/graphics/geometryv/fe_gv_bvh.c
+
+#include "graphics/geometryv/fe_gv_bvh.h"
+#include "platform/fe_job_system.h"
+#include "platform/fe_atomic.h" // FE_CACHE_LINE_SIZE
+#include "utils/fe_logger.h"
+#include <stdlib.h> // malloc, free icin
+#include <string.h> // memcpy icin
+#include <float.h>  // FLT_MAX icin
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h> // _mm_min_ps, _mm_max_ps, _mm_cvttps_epi32
+    #define FE_GV_BVH_USE_SSE 1
+#endif
+
+
+// ----------------------------------------------------------------------
+// 1. DAHILI YAPILAR
+// ----------------------------------------------------------------------
+
+// Bu derinligin altinda SAH yerine ortadan bolme yapilir (kotu dagilimlarda ozyineleme derinligini sinirlar)
+#define FE_GV_BVH_MAX_SAH_DEPTH 64
+
+// Paralel kutulamada en fazla parca sayisi
+#define FE_GV_BVH_MAX_BIN_PIECES 64
+
+// Bu kadar kayittan itibaren kutulama iki kutu kumesiyle yapilir (SSE yolu)
+#define FE_GV_BVH_BIN_TWO_SETS 256
+
+/**
+ * @brief Insa sirasinda bolunen kume kaydi (32 bayt). Merkez olarak min + max kullanilir (0.5 carpani gereksiz).
+ * * SSE yolunda min ve max tek yuklemeyle okunur; 4. serit (index/pad) sonuca karismaz.
+ */
+typedef struct bvh_prim {
+    float min[3];
+    uint32_t index; // Girdideki kume indeksi
+    float max[3];
+    float pad;
+} bvh_prim_t;
+
+/**
+ * @brief Kayit dizisinin bir araligi, kutu siniri ve merkez siniri.
+ */
+typedef struct bvh_range {
+    uint32_t begin, end;
+    float box_min[3], box_max[3];
+    float centroid_min[3], centroid_max[3];
+} bvh_range_t;
+
+/**
+ * @brief Tek eksende bir SAH kutusu (32 bayt). Sayac max'in 4. seridindedir: SSE yolunda kutu siniriyla
+ * * ayni yazmacta guncellenir (ayri sayac okuma/yazmasi yok).
+ */
+typedef struct bvh_bin {
+    float min[4], max[3];
+    uint32_t count;
+} bvh_bin_t;
+
+typedef struct bvh_split {
+    int axis;       // < 0 ise gecerli bolme yok (tum merkezler ayni noktada); aralik ortadan bolunur
+    int bin;        // Sol taraf [0, bin] kutulari; object_split ise sol taraftaki kayit sayisi
+    bool object_split; // Kucuk aralik: kayitlar eksende siralanip bin'inci kayittan bolunur
+    float cost;     // (A_sol * N_sol + A_sag * N_sag) * FE_GV_BVH_CLUSTER_COST
+    float box_min[2][4], box_max[2][4]; // Gecerli bolmede sol/sag tarafin kesin siniri
+    float scale[3]; // Kutulu bolmede kutulamanin olcegi (bolme ayni kutu indekslerini yeniden hesaplar)
+    uint8_t order[FE_GV_BVH_MAX_LEAF_CLUSTERS]; // object_split: kayitlarin eksendeki sirasi (araliga gore)
+} bvh_split_t;
+
+/**
+ * @brief Ayri iste insa edilen alt agac: ust dugumun bir cocugu (veya kok).
+ * * Her is son dizideki kendi penceresine yazar: aralik count kumeliyse pencere count - 1 dugumdur
+ * * (count kumelik ikili agacta en fazla bu kadar ic dugum olur). FE_GV_BVH_TASK_CLUSTERS'tan buyuk
+ * * araliklar ust seviye isidir: tek dugum yazar, cocuk araliklari penceresinden ayirdigi alt pencerelerle
+ * * yeni isler olarak hemen baslatir. Pencereler araliklarin boyutundan gelir; sonuc islerin calisma
+ * * sirasindan bagimsizdir.
+ */
+typedef struct bvh_task {
+    bvh_range_t range;
+    bvh_prim_t* prims;
+    uint32_t depth;              // Ust dugumun derinligi (FE_GV_BVH_MAX_SAH_DEPTH icin)
+    fe_gv_bvh_node_t* nodes;     // Pencerenin basi
+    uint32_t node_capacity;
+    uint32_t node_count;         // Pencerenin basindan itibaren kullanilan dugumler (ust seviye isinde 1)
+    struct bvh_task* child[2];   // Ust seviye isi: cocuk araliklarin isleri (yaprak cocukta NULL)
+    fe_job_counter_t* counter;   // Tum islerin ortak sayaci
+    bool failed;
+} bvh_task_t;
+
+/**
+ * @brief Bir dugum dizisine (isin penceresine) insa eden durum. Ust seviye isinde task != NULL'dir ve
+ * * yaprak olmayan cocuklar ayri is olarak baslatilir; alt agac isinde task == NULL'dir.
+ */
+typedef struct bvh_builder {
+    bvh_prim_t* prims;
+    fe_gv_bvh_node_t* nodes;
+    uint32_t node_count, node_capacity;
+    bvh_task_t* task;
+    bool failed;
+} bvh_builder_t;
+
+typedef struct bvh_bin_job {
+    const bvh_prim_t* prims;
+    const bvh_range_t* range;
+    const float* scale;
+    uint32_t piece_size;
+    bvh_bin_t (*bins)[3][FE_GV_BVH_BIN_COUNT];
+} bvh_bin_job_t;
+
+
+// ----------------------------------------------------------------------
+// 2. DAHILI YARDIMCI FONKSIYONLAR
+// ----------------------------------------------------------------------
+
+static void* bvh_aligned_alloc(size_t size) {
+    size = (size + FE_CACHE_LINE_SIZE - 1) & ~(size_t)(FE_CACHE_LINE_SIZE - 1);
+#ifdef _WIN32
+    return _aligned_malloc(size, FE_CACHE_LINE_SIZE);
+#else
+    return aligned_alloc(FE_CACHE_LINE_SIZE, size);
+#endif
+}
+
+static void bvh_aligned_free(void* ptr) {
+#ifdef _WIN32
+    _aligned_free(ptr);
+#else
+    free(ptr);
+#endif
+}
+
+static float bvh_half_area(const float* mn, const float* mx) {
+    float dx = mx[0] - mn[0], dy = mx[1] - mn[1], dz = mx[2] - mn[2];
+    if (dx < 0.0f || dy < 0.0f || dz < 0.0f) return 0.0f;
+    return dx * dy + dy * dz + dz * dx;
+}
+
+#ifdef FE_GV_BVH_USE_SSE
+/**
+ * @brief bvh_half_area'nin SSE karsiligi (4. serit yok sayilir). Kutu bos olmamalidir.
+ */
+static inline float bvh_half_area_sse(__m128 mn, __m128 mx) {
+    __m128 d = _mm_sub_ps(mx, mn);
+    __m128 p = _mm_mul_ps(d, _mm_shuffle_ps(d, d, _MM_SHUFFLE(3, 0, 2, 1))); // xy, yz, zx
+    __m128 s = _mm_add_ss(p, _mm_shuffle_ps(p, p, _MM_SHUFFLE(1, 1, 1, 1)));
+    return _mm_cvtss_f32(_mm_add_ss(s, _mm_movehl_ps(p, p)));
+}
+#endif
+
+static void bvh_bounds_reset(float* mn, float* mx) {
+    mn[0] = mn[1] = mn[2] = FLT_MAX;
+    mx[0] = mx[1] = mx[2] = -FLT_MAX;
+}
+
+static inline void bvh_bounds_grow(float* mn, float* mx, const float* pmin, const float* pmax) {
+    // Dallanmasiz (minss/maxss); kutulama dongusunde tahmin edilemeyen dallar en buyuk maliyetti
+    for (int a = 0; a < 3; a++) {
+        mn[a] = pmin[a] < mn[a] ? pmin[a] : mn[a];
+        mx[a] = pmax[a] > mx[a] ? pmax[a] : mx[a];
+    }
+}
+
+/**
+ * @brief SAH taramasinda buyuyen kutu (SSE'de tek yazmac cifti).
+ */
+#ifdef FE_GV_BVH_USE_SSE
+typedef struct bvh_acc { __m128 min, max; } bvh_acc_t;
+
+static inline void bvh_acc_reset(bvh_acc_t* acc) {
+    acc->min = _mm_set1_ps(FLT_MAX);
+    acc->max = _mm_set1_ps(-FLT_MAX);
+}
+
+static inline void bvh_acc_grow(bvh_acc_t* acc, const float* mn, const float* mx) {
+    acc->min = _mm_min_ps(acc->min, _mm_loadu_ps(mn));
+    acc->max = _mm_max_ps(acc->max, _mm_loadu_ps(mx));
+}
+
+static inline float bvh_acc_half_area(const bvh_acc_t* acc) {
+    return bvh_half_area_sse(acc->min, acc->max);
+}
+
+/**
+ * @brief Uc kutunun alani tek yazmacta (serit a = acc[a]). Boyutlar devrik cevrilip (xy + yz) + zx sirasiyla
+ * * toplanir; sonuc bvh_half_area_sse ile bit bit aynidir.
+ */
+static inline __m128 bvh_acc_half_area3(const bvh_acc_t acc[3]) {
+    __m128 d0 = _mm_sub_ps(acc[0].max, acc[0].min);
+    __m128 d1 = _mm_sub_ps(acc[1].max, acc[1].min);
+    __m128 d2 = _mm_sub_ps(acc[2].max, acc[2].min);
+    __m128 d3 = _mm_setzero_ps();
+    _MM_TRANSPOSE4_PS(d0, d1, d2, d3); // d0 = dx, d1 = dy, d2 = dz
+    return _mm_add_ps(_mm_add_ps(_mm_mul_ps(d0, d1), _mm_mul_ps(d1, d2)), _mm_mul_ps(d2, d0));
+}
+
+static inline void bvh_acc_store(const bvh_acc_t* acc, float* mn, float* mx) {
+    float out[2][4];
+    _mm_storeu_ps(out[0], acc->min);
+    _mm_storeu_ps(out[1], acc->max);
+    memcpy(mn, out[0], sizeof(float) * 3);
+    memcpy(mx, out[1], sizeof(float) * 3);
+}
+#else
+typedef struct bvh_acc { float min[3], max[3]; } bvh_acc_t;
+
+static inline void bvh_acc_reset(bvh_acc_t* acc) {
+    bvh_bounds_reset(acc->min, acc->max);
+}
+
+static inline void bvh_acc_grow(bvh_acc_t* acc, const float* mn, const float* mx) {
+    bvh_bounds_grow(acc->min, acc->max, mn, mx);
+}
+
+static inline float bvh_acc_half_area(const bvh_acc_t* acc) {
+    return bvh_half_area(acc->min, acc->max);
+}
+
+static inline void bvh_acc_store(const bvh_acc_t* acc, float* mn, float* mx) {
+    memcpy(mn, acc->min, sizeof(float) * 3);
+    memcpy(mx, acc->max, sizeof(float) * 3);
+}
+#endif
+
+static inline float bvh_centroid(const bvh_prim_t* p, int axis) {
+    return p->min[axis] + p->max[axis];
+}
+
+/**
+ * @brief Kutuyu kaydin merkez noktasiyla buyutur.
+ */
+static inline void bvh_acc_grow_centroid(bvh_acc_t* acc, const bvh_prim_t* p) {
+#ifdef FE_GV_BVH_USE_SSE
+    __m128 c = _mm_add_ps(_mm_loadu_ps(p->min), _mm_loadu_ps(p->max));
+    acc->min = _mm_min_ps(acc->min, c);
+    acc->max = _mm_max_ps(acc->max, c);
+#else
+    float c[3] = { bvh_centroid(p, 0), bvh_centroid(p, 1), bvh_centroid(p, 2) };
+    bvh_bounds_grow(acc->min, acc->max, c, c);
+#endif
+}
+
+/**
+ * @brief Aralik siniri ve merkez sinirini tek geciste hesaplar.
+ */
+static void bvh_range_bounds(const bvh_prim_t* prims, bvh_range_t* r) {
+    bvh_acc_t box, centroid;
+    bvh_acc_reset(&box);
+    bvh_acc_reset(&centroid);
+    for (uint32_t i = r->begin; i < r->end; i++) {
+        bvh_acc_grow(&box, prims[i].min, prims[i].max);
+        bvh_acc_grow_centroid(&centroid, &prims[i]);
+    }
+    bvh_acc_store(&box, r->box_min, r->box_max);
+    bvh_acc_store(&centroid, r->centroid_min, r->centroid_max);
+}
+
+/**
+ * @brief Araligin eksen basina kutu sayisi. Kucuk araliklarda kume sayisi kadar kutu yeter; 16 kutuyu
+ * * sifirlayip taramak alt seviyelerde (5-64 kume) insanin en buyuk maliyetiydi.
+ */
+static inline uint32_t bvh_bin_count(const bvh_range_t* r) {
+    uint32_t count = r->end - r->begin;
+    return count < FE_GV_BVH_BIN_COUNT ? count : FE_GV_BVH_BIN_COUNT;
+}
+
+static void bvh_bin_scale(const bvh_range_t* r, float* scale) {
+    float bin_count = (float)bvh_bin_count(r);
+    for (int a = 0; a < 3; a++) {
+        float extent = r->centroid_max[a] - r->centroid_min[a];
+        // Kucuk pay: en buyuk merkez son kutuya duser, tasmaz
+        scale[a] = extent > 1e-20f ? bin_count * (1.0f - 1e-6f) / extent : 0.0f;
+    }
+}
+
+/**
+ * @brief Kaydin uc eksendeki kutu indeksleri. Kutulama ve bolme ayni islemi kullanir,
+ * * bu yuzden bolmenin iki tarafindaki kayit sayisi kutu sayaclariyla birebir tutar.
+ */
+#ifdef FE_GV_BVH_USE_SSE
+static inline __m128i bvh_bins_of(__m128 pmin, __m128 pmax, __m128 cmin, __m128 scale, __m128 last_bin) {
+    __m128 f = _mm_mul_ps(_mm_sub_ps(_mm_add_ps(pmin, pmax), cmin), scale);
+    return _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(f, _mm_setzero_ps()), last_bin));
+}
+#else
+static inline void bvh_bins_of(const bvh_prim_t* p, const float* cmin, const float* scale, float last_bin, int out_bins[3]) {
+    for (int a = 0; a < 3; a++) {
+        float f = (bvh_centroid(p, a) - cmin[a]) * scale[a];
+        f = f > 0.0f ? f : 0.0f;
+        f = f < last_bin ? f : last_bin;
+        out_bins[a] = (int)f;
+    }
+}
+#endif
+
+static void bvh_bins_reset(bvh_bin_t bins[3][FE_GV_BVH_BIN_COUNT], uint32_t bin_count) {
+    for (int a = 0; a < 3; a++) {
+        for (uint32_t b = 0; b < bin_count; b++) {
+#ifdef FE_GV_BVH_USE_SSE
+            _mm_storeu_ps(bins[a][b].min, _mm_set1_ps(FLT_MAX));
+            _mm_storeu_ps(bins[a][b].max, _mm_setr_ps(-FLT_MAX, -FLT_MAX, -FLT_MAX, 0.0f)); // Sayac 0
+#else
+            bvh_bounds_reset(bins[a][b].min, bins[a][b].max);
+            bins[a][b].min[3] = 0.0f;
+            bins[a][b].count = 0;
+#endif
+        }
+    }
+}
+
+/**
+ * @brief other kutularini bins'e ekler (parcalar ve cift/tek kayit kumeleri ayni sirayla birlestirilir).
+ */
+static void bvh_bins_merge(bvh_bin_t bins[3][FE_GV_BVH_BIN_COUNT], const bvh_bin_t other[3][FE_GV_BVH_BIN_COUNT],
+                           uint32_t bin_count) {
+    for (int a = 0; a < 3; a++) {
+        for (uint32_t b = 0; b < bin_count; b++) {
+            bvh_bounds_grow(bins[a][b].min, bins[a][b].max, other[a][b].min, other[a][b].max);
+            bins[a][b].count += other[a][b].count;
+        }
+    }
+}
+
+#ifdef FE_GV_BVH_USE_SSE
+/**
+ * @brief Kaydi kutuya ekler: min, max ve sayac iki yukleme ve iki depolamayla (sayac max'in 4. seridinde
+ * * tamsayi olarak artar, diger seritlere 0 eklenir).
+ */
+static inline void bvh_bin_grow(bvh_bin_t* bin, __m128 pmin, __m128 pmax) {
+    const __m128 xyz = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+    __m128 mx = _mm_loadu_ps(bin->max);
+    __m128 counted = _mm_castsi128_ps(_mm_add_epi32(_mm_castps_si128(mx), _mm_setr_epi32(0, 0, 0, 1)));
+    _mm_storeu_ps(bin->min, _mm_min_ps(_mm_loadu_ps(bin->min), pmin));
+    _mm_storeu_ps(bin->max, _mm_or_ps(_mm_and_ps(xyz, _mm_max_ps(mx, pmax)), _mm_andnot_ps(xyz, counted)));
+}
+
+static inline void bvh_bin_prim(bvh_bin_t bins[3][FE_GV_BVH_BIN_COUNT], const bvh_prim_t* p,
+                                __m128 cmin, __m128 scale, __m128 last_bin) {
+    __m128 pmin = _mm_loadu_ps(p->min), pmax = _mm_loadu_ps(p->max);
+    __m128i k = bvh_bins_of(pmin, pmax, cmin, scale, last_bin);
+    bvh_bin_grow(&bins[0][_mm_cvtsi128_si32(k)], pmin, pmax);
+    bvh_bin_grow(&bins[1][_mm_cvtsi128_si32(_mm_shuffle_epi32(k, _MM_SHUFFLE(1, 1, 1, 1)))], pmin, pmax);
+    bvh_bin_grow(&bins[2][_mm_cvtsi128_si32(_mm_shuffle_epi32(k, _MM_SHUFFLE(2, 2, 2, 2)))], pmin, pmax);
+}
+#endif
+
+static void bvh_bin_prims(const bvh_prim_t* prims, uint32_t begin, uint32_t end, const bvh_range_t* r,
+                          const float* scale, bvh_bin_t bins[3][FE_GV_BVH_BIN_COUNT]) {
+    uint32_t bin_count = bvh_bin_count(r);
+    float last_bin = (float)(bin_count - 1);
+    bvh_bins_reset(bins, bin_count);
+#ifdef FE_GV_BVH_USE_SSE
+    const __m128 cmin = _mm_setr_ps(r->centroid_min[0], r->centroid_min[1], r->centroid_min[2], 0.0f);
+    const __m128 vscale = _mm_setr_ps(scale[0], scale[1], scale[2], 0.0f);
+    const __m128 vlast = _mm_set1_ps(last_bin);
+    uint32_t i = begin;
+    if (end - begin >= FE_GV_BVH_BIN_TWO_SETS) {
+        // Ardisik kayitlar (sahnede cogunlukla ayni kutuya duser) iki ayri kutu kumesine yazilir: bir kutunun
+        // yukle-guncelle-depola zinciri kayit basina degil iki kayitta bir beklenir
+        bvh_bin_t odd[3][FE_GV_BVH_BIN_COUNT];
+        bvh_bins_reset(odd, bin_count);
+        for (; i + 2 <= end; i += 2) {
+            bvh_bin_prim(bins, &prims[i], cmin, vscale, vlast);
+            bvh_bin_prim(odd, &prims[i + 1], cmin, vscale, vlast);
+        }
+        bvh_bins_merge(bins, (const bvh_bin_t (*)[FE_GV_BVH_BIN_COUNT])odd, bin_count);
+    }
+    for (; i < end; i++) bvh_bin_prim(bins, &prims[i], cmin, vscale, vlast);
+#else
+    for (uint32_t i = begin; i < end; i++) {
+        const bvh_prim_t* p = &prims[i];
+        int k[3];
+        bvh_bins_of(p, r->centroid_min, scale, last_bin, k);
+        for (int a = 0; a < 3; a++) {
+            bvh_bin_t* bin = &bins[a][k[a]];
+            bvh_bounds_grow(bin->min, bin->max, p->min, p->max);
+            bin->count++;
+        }
+    }
+#endif
+}
+
+static void bvh_bin_job(void* data, uint32_t begin, uint32_t end) {
+    bvh_bin_job_t* job = (bvh_bin_job_t*)data;
+    for (uint32_t k = begin; k < end; k++) {
+        uint32_t first = job->range->begin + k * job->piece_size;
+        uint32_t last = first + job->piece_size < job->range->end ? first + job->piece_size : job->range->end;
+        bvh_bin_prims(job->prims, first, last, job->range, job->scale, job->bins[k]);
+    }
+}
+
+/**
+ * @brief Bolmeyi "gecerli bolme yok" olarak hazirlar. Sinir ve sira alanlari yalnizca gecerli bolmede yazilir;
+ * * yapinin tamami her dugumde sifirlanmaz.
+ */
+static inline void bvh_split_none(bvh_split_t* split, bool object_split) {
+    split->axis = -1;
+    split->bin = 0;
+    split->object_split = object_split;
+    split->cost = FLT_MAX;
+}
+
+/**
+ * @brief Yaprak boyutundaki araliklar icin tam (kayit basina) bolme: her eksende merkezlere gore
+ * * siralanir ve tum kesim noktalari denenir. 16 kutuyu sifirlayip taramaktan cok daha ucuzdur.
+ * * Secilen sira ve iki tarafin kutusu bolmeye yazilir; bolme kayitlari yeniden siralamaz.
+ */
+static bvh_split_t bvh_find_object_split(const bvh_prim_t* prims, const bvh_range_t* r) {
+    bvh_split_t split;
+    bvh_split_none(&split, true);
+    uint32_t count = r->end - r->begin;
+    const bvh_prim_t* p = &prims[r->begin];
+    if (count == 2) {
+        // Tek kesim noktasi; maliyet eksenden bagimsizdir
+        split.axis = 0;
+        split.bin = 1;
+        split.cost = (bvh_half_area(p[0].min, p[0].max) + bvh_half_area(p[1].min, p[1].max)) * FE_GV_BVH_CLUSTER_COST;
+        split.order[0] = 0;
+        split.order[1] = 1;
+        for (int side = 0; side < 2; side++) {
+            memcpy(split.box_min[side], p[side].min, sizeof(float) * 3);
+            memcpy(split.box_max[side], p[side].max, sizeof(float) * 3);
+        }
+        return split;
+    }
+
+    // Kararli sira, dallanmasiz sayarak: i'nin yeri kendinden kucuk ve (esitlerde) kendinden once gelen kayit
+    // sayisidir. Araya sokarak siralamada tahmin edilemeyen dallar bolmenin cogunu tutuyordu.
+    uint32_t order[3][FE_GV_BVH_MAX_LEAF_CLUSTERS];
+#ifdef FE_GV_BVH_USE_SSE
+    _Static_assert(FE_GV_BVH_MAX_LEAF_CLUSTERS <= 4, "SSE sirasi kayitlari bir yazmacin seritlerinde tutar");
+    // Devrik: cv[a]'nin i. seridi i. kaydin a eksenindeki merkezi. Bos seritler NaN'dir ve hicbir karsilastirmayi
+    // gecmez; boylece 3 ve 4 kayit ayni yoldan gecer.
+    const __m128 nan = _mm_castsi128_ps(_mm_set1_epi32(0x7FC00000));
+    __m128 cv[4];
+    for (uint32_t i = 0; i < 4; i++) cv[i] = i < count ? _mm_add_ps(_mm_loadu_ps(p[i].min), _mm_loadu_ps(p[i].max)) : nan;
+    _MM_TRANSPOSE4_PS(cv[0], cv[1], cv[2], cv[3]);
+    const __m128 after0 = _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, -1)); // i > j seritleri
+    const __m128 after1 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, -1, -1));
+    const __m128 after2 = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+    for (int a = 0; a < 3; a++) {
+        __m128 v = cv[a];
+        __m128 c0 = _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)), c1 = _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1));
+        __m128 c2 = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2)), c3 = _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3));
+        __m128i m0 = _mm_castps_si128(_mm_or_ps(_mm_cmplt_ps(c0, v), _mm_and_ps(_mm_cmpeq_ps(c0, v), after0)));
+        __m128i m1 = _mm_castps_si128(_mm_or_ps(_mm_cmplt_ps(c1, v), _mm_and_ps(_mm_cmpeq_ps(c1, v), after1)));
+        __m128i m2 = _mm_castps_si128(_mm_or_ps(_mm_cmplt_ps(c2, v), _mm_and_ps(_mm_cmpeq_ps(c2, v), after2)));
+        __m128i m3 = _mm_castps_si128(_mm_cmplt_ps(c3, v));
+        __m128i rank = _mm_sub_epi32(_mm_setzero_si128(), _mm_add_epi32(_mm_add_epi32(m0, m1), _mm_add_epi32(m2, m3)));
+        int ranks[4];
+        _mm_storeu_si128((__m128i*)ranks, rank);
+        for (uint32_t i = 0; i < count; i++) order[a][ranks[i]] = i;
+    }
+#else
+    float c[FE_GV_BVH_MAX_LEAF_CLUSTERS][3];
+    for (uint32_t i = 0; i < count; i++) {
+        for (int a = 0; a < 3; a++) c[i][a] = bvh_centroid(&p[i], a);
+    }
+    for (int a = 0; a < 3; a++) {
+        for (uint32_t i = 0; i < count; i++) {
+            uint32_t rank = 0;
+            for (uint32_t j = 0; j < count; j++) {
+                rank += (uint32_t)(c[j][a] < c[i][a]) + (uint32_t)(j < i && c[j][a] == c[i][a]);
+            }
+            order[a][rank] = i;
+        }
+    }
+#endif
+
+    // Kesim noktasi i: sol taraf siranin ilk i kaydi
+    float best_cost[3];
+    int best_cut[3];
+    bvh_acc_t acc[3];
+#ifdef FE_GV_BVH_USE_SSE
+    // Uc eksen tek yazmacta taranir (bvh_sweep_bins gibi)
+    __m128 right_cost[FE_GV_BVH_MAX_LEAF_CLUSTERS];
+    for (int a = 0; a < 3; a++) bvh_acc_reset(&acc[a]);
+    for (uint32_t i = count - 1; i > 0; i--) {
+        for (int a = 0; a < 3; a++) bvh_acc_grow(&acc[a], p[order[a][i]].min, p[order[a][i]].max);
+        right_cost[i] = _mm_mul_ps(bvh_acc_half_area3(acc), _mm_set1_ps((float)(count - i)));
+    }
+    __m128 best = _mm_set1_ps(FLT_MAX);
+    __m128i best_i = _mm_setzero_si128();
+    for (int a = 0; a < 3; a++) bvh_acc_reset(&acc[a]);
+    for (uint32_t i = 1; i < count; i++) {
+        for (int a = 0; a < 3; a++) bvh_acc_grow(&acc[a], p[order[a][i - 1]].min, p[order[a][i - 1]].max);
+        __m128 cost = _mm_mul_ps(_mm_add_ps(_mm_mul_ps(bvh_acc_half_area3(acc), _mm_set1_ps((float)i)), right_cost[i]),
+                                 _mm_set1_ps(FE_GV_BVH_CLUSTER_COST));
+        __m128 better = _mm_cmplt_ps(cost, best);
+        best = _mm_or_ps(_mm_and_ps(better, cost), _mm_andnot_ps(better, best));
+        best_i = _mm_or_si128(_mm_and_si128(_mm_castps_si128(better), _mm_set1_epi32((int)i)),
+                              _mm_andnot_si128(_mm_castps_si128(better), best_i));
+    }
+    float cost_out[4];
+    int cut_out[4];
+    _mm_storeu_ps(cost_out, best);
+    _mm_storeu_si128((__m128i*)cut_out, best_i);
+    for (int a = 0; a < 3; a++) {
+        best_cost[a] = cost_out[a];
+        best_cut[a] = cut_out[a];
+    }
+#else
+    for (int a = 0; a < 3; a++) {
+        float right_cost[FE_GV_BVH_MAX_LEAF_CLUSTERS];
+        bvh_acc_reset(&acc[a]);
+        for (uint32_t i = count - 1; i > 0; i--) {
+            bvh_acc_grow(&acc[a], p[order[a][i]].min, p[order[a][i]].max);
+            right_cost[i] = bvh_acc_half_area(&acc[a]) * (float)(count - i);
+        }
+        best_cost[a] = FLT_MAX;
+        best_cut[a] = 0;
+        bvh_acc_reset(&acc[a]);
+        for (uint32_t i = 1; i < count; i++) {
+            bvh_acc_grow(&acc[a], p[order[a][i - 1]].min, p[order[a][i - 1]].max);
+            float cost = (bvh_acc_half_area(&acc[a]) * (float)i + right_cost[i]) * FE_GV_BVH_CLUSTER_COST;
+            if (cost < best_cost[a]) {
+                best_cost[a] = cost;
+                best_cut[a] = (int)i;
+            }
+        }
+    }
+#endif
+    for (int a = 0; a < 3; a++) {
+        if (best_cost[a] < split.cost) {
+            split.axis = a;
+            split.bin = best_cut[a];
+            split.cost = best_cost[a];
+        }
+    }
+
+    // Secilen siranin iki tarafinin kutusu
+    if (split.axis >= 0) {
+        for (uint32_t k = 0; k < count; k++) split.order[k] = (uint8_t)order[split.axis][k];
+        for (int side = 0; side < 2; side++) {
+            uint32_t first = side == 0 ? 0 : (uint32_t)split.bin;
+            uint32_t last = side == 0 ? (uint32_t)split.bin : count;
+            bvh_acc_reset(&acc[side]);
+            for (uint32_t k = first; k < last; k++) bvh_acc_grow(&acc[side], p[split.order[k]].min, p[split.order[k]].max);
+            bvh_acc_store(&acc[side], split.box_min[side], split.box_max[side]);
+        }
+    }
+    return split;
+}
+
+/**
+ * @brief Eksen basina en dusuk SAH maliyetli kutu sinirini bulur (sol taraf [0, best_bin]).
+ * * Merkezleri ayni olan eksende tum kayitlar 0. kutudadir ve bolme uretmez (best_cost FLT_MAX kalir).
+ */
+#ifdef FE_GV_BVH_USE_SSE
+/**
+ * @brief Taramada b kutusunu uc eksenin kutusuna ve sayacina ekler; uc eksenin alanini tek yazmacta dondurur.
+ */
+static inline __m128 bvh_sweep_step(const bvh_bin_t bins[3][FE_GV_BVH_BIN_COUNT], int b, bvh_acc_t acc[3], __m128i* n) {
+    for (int a = 0; a < 3; a++) bvh_acc_grow(&acc[a], bins[a][b].min, bins[a][b].max);
+    *n = _mm_add_epi32(*n, _mm_setr_epi32((int)bins[0][b].count, (int)bins[1][b].count, (int)bins[2][b].count, 0));
+    return bvh_acc_half_area3(acc);
+}
+
+static void bvh_sweep_bins(const bvh_bin_t bins[3][FE_GV_BVH_BIN_COUNT], int bin_count, uint32_t count,
+                           float best_cost[3], int best_bin[3]) {
+    // Uc eksen tek yazmacta taranir (serit = eksen); sonuc skaler yolla aynidir
+    __m128 right_cost[FE_GV_BVH_BIN_COUNT];
+    const __m128 vmax = _mm_set1_ps(FLT_MAX);
+    const __m128 vcost = _mm_set1_ps(FE_GV_BVH_CLUSTER_COST);
+    const __m128i vall = _mm_set1_epi32((int)count);
+    bvh_acc_t acc[3];
+    __m128i n = _mm_setzero_si128();
+
+    // Sagdan sola: (bin+1..son) tarafinin alan * sayisi
+    for (int a = 0; a < 3; a++) bvh_acc_reset(&acc[a]);
+    for (int b = bin_count - 1; b > 0; b--) {
+        __m128 area = bvh_sweep_step(bins, b, acc, &n);
+        __m128 empty = _mm_castsi128_ps(_mm_cmpeq_epi32(n, _mm_setzero_si128()));
+        __m128 cost = _mm_mul_ps(area, _mm_cvtepi32_ps(n));
+        right_cost[b - 1] = _mm_or_ps(_mm_and_ps(empty, vmax), _mm_andnot_ps(empty, cost));
+    }
+
+    // Soldan saga; bos veya tum kayitlari iceren taraf bolme degildir
+    __m128 best = vmax;
+    __m128i best_b = _mm_setzero_si128();
+    for (int a = 0; a < 3; a++) bvh_acc_reset(&acc[a]);
+    n = _mm_setzero_si128();
+    for (int b = 0; b < bin_count - 1; b++) {
+        __m128 area = bvh_sweep_step(bins, b, acc, &n);
+        __m128 cost = _mm_mul_ps(_mm_add_ps(_mm_mul_ps(area, _mm_cvtepi32_ps(n)), right_cost[b]), vcost);
+        __m128i invalid = _mm_or_si128(_mm_cmpeq_epi32(n, _mm_setzero_si128()), _mm_cmpeq_epi32(n, vall));
+        __m128 better = _mm_andnot_ps(_mm_castsi128_ps(invalid), _mm_cmplt_ps(cost, best));
+        best = _mm_or_ps(_mm_and_ps(better, cost), _mm_andnot_ps(better, best));
+        best_b = _mm_or_si128(_mm_and_si128(_mm_castps_si128(better), _mm_set1_epi32(b)),
+                              _mm_andnot_si128(_mm_castps_si128(better), best_b));
+    }
+
+    float cost_out[4];
+    int bin_out[4];
+    _mm_storeu_ps(cost_out, best);
+    _mm_storeu_si128((__m128i*)bin_out, best_b);
+    for (int a = 0; a < 3; a++) {
+        best_cost[a] = cost_out[a];
+        best_bin[a] = bin_out[a];
+    }
+}
+#else
+static void bvh_sweep_bins(const bvh_bin_t bins[3][FE_GV_BVH_BIN_COUNT], int bin_count, uint32_t count,
+                           float best_cost[3], int best_bin[3]) {
+    // Uc eksen ayni dongude taranir: bagimsiz min/max zincirleri birbirinin gecikmesini gizler
+    float right_cost[3][FE_GV_BVH_BIN_COUNT];
+    uint32_t n[3] = { 0, 0, 0 };
+    bvh_acc_t acc[3];
+
+    // Sagdan sola: (bin+1..son) tarafinin alan * sayisi
+    for (int a = 0; a < 3; a++) bvh_acc_reset(&acc[a]);
+    for (int b = bin_count - 1; b > 0; b--) {
+        for (int a = 0; a < 3; a++) {
+            bvh_acc_grow(&acc[a], bins[a][b].min, bins[a][b].max);
+            n[a] += bins[a][b].count;
+            right_cost[a][b - 1] = n[a] > 0 ? bvh_acc_half_area(&acc[a]) * (float)n[a] : FLT_MAX;
+        }
+    }
+
+    // Soldan saga
+    for (int a = 0; a < 3; a++) {
+        bvh_acc_reset(&acc[a]);
+        n[a] = 0;
+        best_cost[a] = FLT_MAX;
+        best_bin[a] = 0;
+    }
+    for (int b = 0; b < bin_count - 1; b++) {
+        for (int a = 0; a < 3; a++) {
+            bvh_acc_grow(&acc[a], bins[a][b].min, bins[a][b].max);
+            n[a] += bins[a][b].count;
+            if (n[a] == 0 || n[a] == count) continue;
+            float cost = (bvh_acc_half_area(&acc[a]) * (float)n[a] + right_cost[a][b]) * FE_GV_BVH_CLUSTER_COST;
+            if (cost < best_cost[a]) {
+                best_cost[a] = cost;
+                best_bin[a] = b;
+            }
+        }
+    }
+}
+#endif
+
+/**
+ * @brief Araligin en dusuk SAH maliyetli kutu sinirini bulur. Buyuk araliklar parcalar halinde paralel kutulanir.
+ */
+static bvh_split_t bvh_find_split(const bvh_prim_t* prims, const bvh_range_t* r, bool allow_parallel) {
+    bvh_split_t split;
+    bvh_split_none(&split, false);
+    float* scale = split.scale;
+    bvh_bin_scale(r, scale);
+    if (scale[0] == 0.0f && scale[1] == 0.0f && scale[2] == 0.0f) return split;
+
+    uint32_t count = r->end - r->begin;
+    if (count <= FE_GV_BVH_MAX_LEAF_CLUSTERS) return bvh_find_object_split(prims, r);
+
+    bvh_bin_t bins[3][FE_GV_BVH_BIN_COUNT];
+    uint32_t piece_size = FE_GV_BVH_BIN_PIECE_CLUSTERS;
+    if ((count + piece_size - 1) / piece_size > FE_GV_BVH_MAX_BIN_PIECES) {
+        piece_size = (count + FE_GV_BVH_MAX_BIN_PIECES - 1) / FE_GV_BVH_MAX_BIN_PIECES;
+    }
+    uint32_t piece_count = (count + piece_size - 1) / piece_size;
+    bvh_bin_t (*piece_bins)[3][FE_GV_BVH_BIN_COUNT] = NULL;
+    if (allow_parallel && piece_count >= 2) {
+        piece_bins = (bvh_bin_t (*)[3][FE_GV_BVH_BIN_COUNT])malloc(sizeof(*piece_bins) * piece_count);
+    }
+
+    if (piece_bins) {
+        bvh_bin_job_t job = { prims, r, scale, piece_size, piece_bins };
+        fe_job_parallel_for(piece_count, 1, bvh_bin_job, &job);
+
+        // Parcalari sabit sirayla birlestir (sonuc is parcacigi sayisindan bagimsiz)
+        memcpy(bins, piece_bins[0], sizeof(bins));
+        for (uint32_t k = 1; k < piece_count; k++) {
+            bvh_bins_merge(bins, (const bvh_bin_t (*)[FE_GV_BVH_BIN_COUNT])piece_bins[k], bvh_bin_count(r));
+        }
+        free(piece_bins);
+    } else {
+        bvh_bin_prims(prims, r->begin, r->end, r, scale, bins);
+    }
+
+    int bin_count = (int)bvh_bin_count(r);
+    float best_cost[3];
+    int best_bin[3];
+    bvh_sweep_bins(bins, bin_count, count, best_cost, best_bin);
+    for (int a = 0; a < 3; a++) {
+        if (best_cost[a] < split.cost) {
+            split.axis = a;
+            split.bin = best_bin[a];
+            split.cost = best_cost[a];
+        }
+    }
+
+    // Iki tarafin kutu siniri kutulardan kesin olarak bilinir; bolme yalnizca merkez sinirlarini toplar
+    if (split.axis >= 0) {
+        for (int side = 0; side < 2; side++) {
+            bvh_acc_t box;
+            bvh_acc_reset(&box);
+            int first = side == 0 ? 0 : split.bin + 1;
+            int last = side == 0 ? split.bin + 1 : bin_count;
+            for (int b = first; b < last; b++) bvh_acc_grow(&box, bins[split.axis][b].min, bins[split.axis][b].max);
+            bvh_acc_store(&box, split.box_min[side], split.box_max[side]);
+        }
+    }
+    return split;
+}
+
+/**
+ * @brief Araligi bolmeye gore yerinde ikiye ayirir; iki tarafin sinirlarini da hesaplar.
+ * * Gecerli bolme yoksa (veya derinlik siniri asildiysa) aralik ortadan bolunur.
+ */
+static void bvh_partition(bvh_prim_t* prims, const bvh_range_t* r, const bvh_split_t* split,
+                          bvh_range_t* left, bvh_range_t* right) {
+    left->begin = r->begin;
+    right->end = r->end;
+
+    if (split->axis < 0) {
+        uint32_t mid = r->begin + (r->end - r->begin) / 2;
+        left->end = mid;
+        right->begin = mid;
+        bvh_range_bounds(prims, left);
+        bvh_range_bounds(prims, right);
+        return;
+    }
+
+    // Kutu sinirlari bolmeden gelir (kutularin birlesimi veya sira taramasi); burada yalnizca merkez sinirlari toplanir
+    memcpy(left->box_min, split->box_min[0], sizeof(float) * 3);  memcpy(left->box_max, split->box_max[0], sizeof(float) * 3);
+    memcpy(right->box_min, split->box_min[1], sizeof(float) * 3); memcpy(right->box_max, split->box_max[1], sizeof(float) * 3);
+
+    if (split->object_split) {
+        // Kucuk aralik: bolmenin bulundugu sirayla yerlestir, kesim noktasindan bol
+        uint32_t count = r->end - r->begin;
+        bvh_prim_t sorted[FE_GV_BVH_MAX_LEAF_CLUSTERS];
+        for (uint32_t k = 0; k < count; k++) sorted[k] = prims[r->begin + split->order[k]];
+        memcpy(&prims[r->begin], sorted, sizeof(bvh_prim_t) * count);
+
+        uint32_t mid = r->begin + (uint32_t)split->bin;
+        bvh_acc_t centroid[2];
+        bvh_acc_reset(&centroid[0]);
+        bvh_acc_reset(&centroid[1]);
+        for (uint32_t i = r->begin; i < r->end; i++) bvh_acc_grow_centroid(&centroid[i >= mid], &prims[i]);
+        bvh_acc_store(&centroid[0], left->centroid_min, left->centroid_max);
+        bvh_acc_store(&centroid[1], right->centroid_min, right->centroid_max);
+        left->end = mid;
+        right->begin = mid;
+        return;
+    }
+
+    const float* scale = split->scale;
+    float last_bin = (float)(bvh_bin_count(r) - 1);
+    uint32_t i = r->begin;
+#ifdef FE_GV_BVH_USE_SSE
+    // Dallanmasiz: [begin, i) sol, [i, n) sag; her kayit i'deki kayitla kosulsuz yer degistirir, taraf bir maskeyle
+    // secilir. Ust seviyelerde taraf tahmin edilemez; dallanan bolmede yanlis tahminler en buyuk maliyetti.
+    const __m128 cmin = _mm_setr_ps(r->centroid_min[0], r->centroid_min[1], r->centroid_min[2], 0.0f);
+    const __m128 vscale = _mm_setr_ps(scale[0], scale[1], scale[2], 0.0f);
+    const __m128 vlast = _mm_set1_ps(last_bin);
+    const __m128i vsplit = _mm_set1_epi32(split->bin + 1);
+    __m128 lo = _mm_set1_ps(FLT_MAX), hi = _mm_set1_ps(-FLT_MAX);
+    __m128 lc_min = lo, lc_max = hi, rc_min = lo, rc_max = hi;
+    for (uint32_t n = r->begin; n < r->end; n++) {
+        bvh_prim_t* p = &prims[n];
+        __m128 pmin = _mm_loadu_ps(p->min), pmax = _mm_loadu_ps(p->max);
+        __m128i k = bvh_bins_of(pmin, pmax, cmin, vscale, vlast);
+        int is_left = (_mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(k, vsplit))) >> split->axis) & 1;
+        __m128 m = _mm_castsi128_ps(_mm_set1_epi32(-is_left));
+        __m128 c = _mm_add_ps(pmin, pmax);
+        __m128 lc = _mm_and_ps(m, c), rc = _mm_andnot_ps(m, c);
+        lc_min = _mm_min_ps(lc_min, _mm_or_ps(lc, _mm_andnot_ps(m, lo)));
+        lc_max = _mm_max_ps(lc_max, _mm_or_ps(lc, _mm_andnot_ps(m, hi)));
+        rc_min = _mm_min_ps(rc_min, _mm_or_ps(rc, _mm_and_ps(m, lo)));
+        rc_max = _mm_max_ps(rc_max, _mm_or_ps(rc, _mm_and_ps(m, hi)));
+
+        bvh_prim_t* q = &prims[i];
+        __m128 qmin = _mm_loadu_ps(q->min), qmax = _mm_loadu_ps(q->max);
+        _mm_storeu_ps(q->min, pmin); _mm_storeu_ps(q->max, pmax);
+        _mm_storeu_ps(p->min, qmin); _mm_storeu_ps(p->max, qmax);
+        i += (uint32_t)is_left;
+    }
+    float out[4][4];
+    _mm_storeu_ps(out[0], lc_min); _mm_storeu_ps(out[1], lc_max);
+    _mm_storeu_ps(out[2], rc_min); _mm_storeu_ps(out[3], rc_max);
+    memcpy(left->centroid_min, out[0], sizeof(float) * 3);  memcpy(left->centroid_max, out[1], sizeof(float) * 3);
+    memcpy(right->centroid_min, out[2], sizeof(float) * 3); memcpy(right->centroid_max, out[3], sizeof(float) * 3);
+#else
+    uint32_t j = r->end;
+    bvh_bounds_reset(left->centroid_min, left->centroid_max);
+    bvh_bounds_reset(right->centroid_min, right->centroid_max);
+    while (i < j) {
+        bvh_prim_t* p = &prims[i];
+        int k[3];
+        bvh_bins_of(p, r->centroid_min, scale, last_bin, k);
+        float c[3] = { bvh_centroid(p, 0), bvh_centroid(p, 1), bvh_centroid(p, 2) };
+        if (k[split->axis] <= split->bin) {
+            bvh_bounds_grow(left->centroid_min, left->centroid_max, c, c);
+            i++;
+        } else {
+            bvh_bounds_grow(right->centroid_min, right->centroid_max, c, c);
+            j--;
+            bvh_prim_t tmp = *p;
+            *p = prims[j];
+            prims[j] = tmp;
+        }
+    }
+#endif
+    left->end = i;
+    right->begin = i;
+}
+
+static uint32_t bvh_alloc_node(bvh_builder_t* b) {
+    if (b->node_count == b->node_capacity) { b->failed = true; return FE_GV_BVH_INVALID; }
+    return b->node_count++;
+}
+
+/**
+ * @brief Araligi, builder'in penceresinden ayrilan alt pencereyle yeni bir is olarak hazirlar.
+ */
+static bvh_task_t* bvh_task_create(bvh_builder_t* b, const bvh_range_t* r, uint32_t depth) {
+    uint32_t window = r->end - r->begin - 1;
+    if (b->node_capacity - b->node_count < window) return NULL;
+    bvh_task_t* task = (bvh_task_t*)calloc(1, sizeof(bvh_task_t));
+    if (!task) return NULL;
+    task->range = *r;
+    task->prims = b->prims;
+    task->depth = depth;
+    task->nodes = b->nodes + b->node_count;
+    task->node_capacity = window;
+    task->counter = b->task->counter;
+    b->node_count += window;
+    return task;
+}
+
+static void bvh_set_child(fe_gv_bvh_node_t* node, uint32_t slot, const bvh_range_t* r, uint32_t child, uint32_t count) {
+    memcpy(node->child_min[slot].v, r->box_min, sizeof(float) * 3);
+    memcpy(node->child_max[slot].v, r->box_max, sizeof(float) * 3);
+    node->child[slot] = child;
+    node->child_count[slot] = count;
+}
+
+static void bvh_set_empty_child(fe_gv_bvh_node_t* node, uint32_t slot) {
+    // Ters kutu: hicbir isin veya frustum testinden gecmez
+    node->child_min[slot].x = node->child_min[slot].y = node->child_min[slot].z = FLT_MAX;
+    node->child_max[slot].x = node->child_max[slot].y = node->child_max[slot].z = -FLT_MAX;
+    node->child[slot] = FE_GV_BVH_INVALID;
+    node->child_count[slot] = 0;
+}
+
+static void bvh_build_node(bvh_builder_t* b, uint32_t node_index, const bvh_range_t* r, const bvh_split_t* split, uint32_t depth);
+static void bvh_task_job(void* data);
+
+/**
+ * @brief Araligi dugumun bir cocugu olarak yerlestirir: yaprak, ertelenmis is veya yeni ic dugum.
+ */
+static void bvh_build_child(bvh_builder_t* b, uint32_t node_index, uint32_t slot, const bvh_range_t* r, uint32_t depth) {
+    if (b->failed) return;
+    uint32_t count = r->end - r->begin;
+
+    bvh_split_t split;
+    bvh_split_none(&split, false);
+    if (count == 1) {
+        bvh_set_child(&b->nodes[node_index], slot, r, r->begin, 1);
+        return;
+    }
+    if (count <= FE_GV_BVH_MAX_LEAF_CLUSTERS) {
+        // Yaprak mi bolme mi: N * C_kume <= C_dugum + SAH(bolme) / A
+        split = bvh_find_split(b->prims, r, false);
+        float area = bvh_half_area(r->box_min, r->box_max);
+        if (split.axis < 0 || area <= 0.0f ||
+            (float)count * FE_GV_BVH_CLUSTER_COST <= FE_GV_BVH_NODE_COST + split.cost / area) {
+            bvh_set_child(&b->nodes[node_index], slot, r, r->begin, count);
+            return;
+        }
+    } else if (b->task) {
+        // Ust seviye: cocuk aralik hemen ayri iste baslatilir; bu is diger cocukla devam eder
+        bvh_task_t* task = bvh_task_create(b, r, depth);
+        if (!task) { b->failed = true; return; }
+        b->task->child[slot] = task;
+        bvh_set_child(&b->nodes[node_index], slot, r, FE_GV_BVH_INVALID, 0); // Dugum indeksi birlestirmede yazilir
+        fe_job_run(bvh_task_job, task, task->counter);
+        return;
+    } else if (depth < FE_GV_BVH_MAX_SAH_DEPTH) {
+        split = bvh_find_split(b->prims, r, false);
+    }
+
+    uint32_t child = bvh_alloc_node(b);
+    if (b->failed) return;
+    bvh_set_child(&b->nodes[node_index], slot, r, child, 0);
+    bvh_build_node(b, child, r, &split, depth + 1);
+}
+
+static void bvh_build_node(bvh_builder_t* b, uint32_t node_index, const bvh_range_t* r, const bvh_split_t* split, uint32_t depth) {
+    bvh_range_t left, right;
+    bvh_partition(b->prims, r, split, &left, &right);
+    bvh_build_child(b, node_index, 0, &left, depth);
+    bvh_build_child(b, node_index, 1, &right, depth);
+}
+
+static void bvh_task_job(void* data) {
+    bvh_task_t* task = (bvh_task_t*)data;
+    bool top = task->range.end - task->range.begin > FE_GV_BVH_TASK_CLUSTERS;
+    bvh_builder_t b;
+    memset(&b, 0, sizeof(b));
+    b.prims = task->prims;
+    b.nodes = task->nodes;
+    b.node_capacity = task->node_capacity;
+    b.task = top ? task : NULL;
+
+    bvh_split_t split;
+    bvh_split_none(&split, false);
+    if (task->depth < FE_GV_BVH_MAX_SAH_DEPTH) split = bvh_find_split(b.prims, &task->range, top);
+    bvh_build_node(&b, bvh_alloc_node(&b), &task->range, &split, task->depth + 1);
+    task->node_count = top ? 1 : b.node_count; // Ust seviye isinde pencerenin geri kalani cocuklarindir
+    task->failed = b.failed;
+}
+
+static bool bvh_task_failed(const bvh_task_t* task) {
+    if (!task) return false;
+    return task->failed || bvh_task_failed(task->child[0]) || bvh_task_failed(task->child[1]);
+}
+
+static void bvh_task_free(bvh_task_t* task) {
+    if (!task) return;
+    bvh_task_free(task->child[0]);
+    bvh_task_free(task->child[1]);
+    free(task);
+}
+
+/**
+ * @brief Is pencerelerinin kullanilmayan kuyruklarini kapatir: isler pencere sirasiyla (once kendi dugumleri,
+ * * sonra sol ve sag cocuk) target'tan itibaren sola kaydirilir ve ic dugum indeksleri yeni yerlerine cevrilir.
+ * * Hedef hicbir zaman kaynagin sagina dusmez; her dugum yerinde ve en fazla bir kez tasinir.
+ * @return Isin alt agacindan sonraki ilk bos dugum.
+ */
+static uint32_t bvh_compact(fe_gv_bvh_node_t* nodes, const bvh_task_t* task, uint32_t target) {
+    fe_gv_bvh_node_t* dst = nodes + target;
+    for (uint32_t n = 0; n < task->node_count; n++) {
+        fe_gv_bvh_node_t node = task->nodes[n];
+        for (int k = 0; k < 2; k++) {
+            if (node.child_count[k] == 0 && node.child[k] != FE_GV_BVH_INVALID) node.child[k] += target; // Pencereye gore
+        }
+        dst[n] = node;
+    }
+
+    uint32_t next = target + task->node_count;
+    for (int k = 0; k < 2; k++) {
+        if (!task->child[k]) continue;
+        dst[0].child[k] = next;
+        next = bvh_compact(nodes, task->child[k], next);
+    }
+    return next;
+}
+
+
+// ----------------------------------------------------------------------
+// 3. ARABIRIM UYGULAMALARI
+// ----------------------------------------------------------------------
+
+/**
+ * Uygulama: fe_gv_bvh_build
+ */
+bool fe_gv_bvh_build(const fe_gv_cluster_t* clusters, uint32_t cluster_count, fe_gv_bvh_t* out_bvh) {
+    if (!out_bvh) return false;
+    memset(out_bvh, 0, sizeof(*out_bvh));
+    if (!clusters || cluster_count == 0) return false;
+
+    // Tum dugumler tek diziye: her is kendi penceresine yazar, birlestirme bosluklari kapatir
+    fe_gv_bvh_node_t* nodes = (fe_gv_bvh_node_t*)bvh_aligned_alloc(sizeof(fe_gv_bvh_node_t) * (cluster_count > 1 ? cluster_count - 1 : 1));
+    bvh_prim_t* prims = (bvh_prim_t*)malloc(sizeof(bvh_prim_t) * cluster_count);
+    out_bvh->cluster_order = (uint32_t*)malloc(sizeof(uint32_t) * cluster_count);
+    if (!nodes || !prims || !out_bvh->cluster_order) {
+        bvh_aligned_free(nodes);
+        free(prims);
+        fe_gv_bvh_free(out_bvh);
+        return false;
+    }
+
+    for (uint32_t i = 0; i < cluster_count; i++) {
+        bvh_prim_t* p = &prims[i];
+        memcpy(p->min, clusters[i].aabb_min.v, sizeof(float) * 3);
+        memcpy(p->max, clusters[i].aabb_max.v, sizeof(float) * 3);
+        p->index = i;
+        p->pad = 0.0f;
+    }
+
+    bvh_range_t root;
+    root.begin = 0;
+    root.end = cluster_count;
+    bvh_range_bounds(prims, &root);
+
+    // Kok isi: ust seviye her bolmede cocuk isler baslatir (kutulama paralel); ust seviye kendi dugumu
+    // disinda hicbir sey yazmaz ve hicbir islerin bitmesini beklemez
+    bool failed = false;
+    uint32_t node_count = 1;
+    fe_job_counter_t counter = { 0 };
+    bvh_task_t task;
+    memset(&task, 0, sizeof(task));
+    if (cluster_count <= FE_GV_BVH_MAX_LEAF_CLUSTERS) {
+        bvh_set_child(&nodes[0], 0, &root, 0, cluster_count);
+        bvh_set_empty_child(&nodes[0], 1);
+    } else {
+        task.range = root;
+        task.prims = prims;
+        task.nodes = nodes;
+        task.node_capacity = cluster_count - 1;
+        task.counter = &counter;
+        bvh_task_job(&task);
+        fe_job_wait(&counter); // Hata olsa da: baslatilan isler diziye yaziyor
+        failed = bvh_task_failed(&task);
+        if (!failed) node_count = bvh_compact(nodes, &task, 0);
+    }
+
+    if (!failed) {
+        out_bvh->nodes = nodes;
+        out_bvh->node_count = node_count;
+        out_bvh->cluster_count = cluster_count;
+        for (uint32_t i = 0; i < cluster_count; i++) out_bvh->cluster_order[i] = prims[i].index;
+        memcpy(out_bvh->bounds_min.v, root.box_min, sizeof(float) * 3);
+        memcpy(out_bvh->bounds_max.v, root.box_max, sizeof(float) * 3);
+    } else {
+        bvh_aligned_free(nodes);
+    }
+
+    bvh_task_free(task.child[0]);
+    bvh_task_free(task.child[1]);
+    free(prims);
+    if (failed) {
+        FE_LOG_ERROR("GeometryV BVH insasi icin bellek yetersiz (%u kume).", cluster_count);
+        fe_gv_bvh_free(out_bvh);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Uygulama: fe_gv_bvh_free
+ */
+void fe_gv_bvh_free(fe_gv_bvh_t* bvh) {
+    if (!bvh) return;
+    bvh_aligned_free(bvh->nodes);
+    free(bvh->cluster_order);
+    memset(bvh, 0, sizeof(*bvh));
+}
+
+/**
+ * Uygulama: fe_gv_bvh_free_nodes
+ */
+void fe_gv_bvh_free_nodes(fe_gv_bvh_node_t* nodes) {
+    bvh_aligned_free(nodes);
+}
+
+/**
+ * Uygulama: fe_gv_bvh_sah_cost
+ */
+float fe_gv_bvh_sah_cost(const fe_gv_bvh_node_t* nodes, uint32_t node_count) {
+    if (!nodes || node_count == 0) return 0.0f;
+
+    float root_min[3], root_max[3];
+    bvh_bounds_reset(root_min, root_max);
+    for (int k = 0; k < 2; k++) {
+        if (nodes[0].child[k] != FE_GV_BVH_INVALID) bvh_bounds_grow(root_min, root_max, nodes[0].child_min[k].v, nodes[0].child_max[k].v);
+    }
+    float root_area = bvh_half_area(root_min, root_max);
+    if (root_area <= 0.0f) return FE_GV_BVH_NODE_COST;
+
+    // Kok her zaman ziyaret edilir; diger dugum ve yapraklar alanlariyla orantili olasilikla
+    double cost = 0.0;
+    for (uint32_t n = 0; n < node_count; n++) {
+        for (int k = 0; k < 2; k++) {
+            if (nodes[n].child[k] == FE_GV_BVH_INVALID) continue;
+            float area = bvh_half_area(nodes[n].child_min[k].v, nodes[n].child_max[k].v);
+            cost += (double)area * (nodes[n].child_count[k] == 0 ? FE_GV_BVH_NODE_COST
+                                                                 : FE_GV_BVH_CLUSTER_COST * (float)nodes[n].child_count[k]);
+        }
+    }
+    return FE_GV_BVH_NODE_COST + (float)(cost / root_area);
+}
@@ -0,0 +1,512 @@
+// src/graphics/geometryv/fe_gv_cluster_builder.c
+
+#include "graphics/geometryv/fe_gv_cluster_builder.h"
+#include "platform/fe_job_system.h" // fe_job_parallel_for
+#include "utils/fe_logger.h"
+#include <stdlib.h> // malloc, calloc, free için
+#include <string.h> // memset için
+#include <math.h>
+
+
+// ----------------------------------------------------------------------
+// 1. DAHİLİ YAPILAR
+// ----------------------------------------------------------------------
+
+// Ucgen durumlari (fe_gv_mesh_work_t::states)
+#define FE_GV_TRIANGLE_FREE      0
+#define FE_GV_TRIANGLE_CANDIDATE 1 // Kumenin aday listesinde
+#define FE_GV_TRIANGLE_ASSIGNED  2
+
+// Bir kumenin aday listesi kapasitesi; dolarsa yeni komsular aday olmaz (pencere aramasi yine bulur)
+#define FE_GV_CLUSTER_CANDIDATE_CAPACITY 1024
+
+// Kumenin kose kumesi icin acik adresli tablo (en fazla 3 * FE_GV_CLUSTER_MAX_TRIANGLES kose)
+#define FE_GV_CLUSTER_VERTEX_SLOTS 1024
+
+typedef enum fe_gv_mesh_status {
+    FE_GV_MESH_READY,
+    FE_GV_MESH_NO_CPU_DATA,
+    FE_GV_MESH_BAD_INDEX,
+    FE_GV_MESH_OUT_OF_MEMORY
+} fe_gv_mesh_status_t;
+
+/**
+ * @brief Bir mesh'in kumeleme hazirligi (faz 1) ve bloklarin ortak okudugu veriler.
+ * * states ve slots dizilerinin her elemanina sadece ucgenin blogu yazar.
+ */
+typedef struct fe_gv_mesh_work {
+    const fe_mesh_t* mesh;
+    fe_gv_mesh_status_t status;
+    uint32_t material_id;
+    uint32_t triangle_count;
+    uint32_t triangle_base;      // Ciktidaki ilk ucgen
+
+    fe_vec3_t* centroids;        // Ucgen merkezleri
+    uint32_t* order;             // Morton sirasina gore ucgenler
+    uint32_t* rank;              // order'in tersi: ucgenin Morton sirasindaki yeri
+    uint32_t* vertex_offsets;    // Kose -> ucgen komsulugu (CSR, vertex_count + 1)
+    uint32_t* vertex_triangles;
+    uint8_t* states;
+    uint16_t* slots;             // Aday ucgenin aday listesindeki yeri
+} fe_gv_mesh_work_t;
+
+/**
+ * @brief Morton sirasinin [first, first + count) araligi (faz 2'nin is birimi).
+ * * Kumeler once bloga yazilir, sonra mesh sirasiyla birlestirilir.
+ */
+typedef struct fe_gv_block_work {
+    uint32_t mesh;
+    uint32_t first;
+    uint32_t count;
+    fe_gv_cluster_t* clusters;
+    uint32_t cluster_count;
+    bool is_ok;
+} fe_gv_block_work_t;
+
+/**
+ * @brief Kumenin aday listesi (SoA). Adayin merkezi listede tutulur; tarama mesh dizilerine dokunmaz.
+ * * weight = 4 - paylasilan kose sayisi; fe_gv_mesh_work_t::slots adayin listedeki yeridir.
+ */
+typedef struct fe_gv_candidate_list {
+    uint32_t triangles[FE_GV_CLUSTER_CANDIDATE_CAPACITY];
+    float x[FE_GV_CLUSTER_CANDIDATE_CAPACITY];
+    float y[FE_GV_CLUSTER_CANDIDATE_CAPACITY];
+    float z[FE_GV_CLUSTER_CANDIDATE_CAPACITY];
+    float weight[FE_GV_CLUSTER_CANDIDATE_CAPACITY];
+    uint32_t count;
+} fe_gv_candidate_list_t;
+
+typedef struct fe_gv_build_context {
+    fe_gv_mesh_work_t* meshes;
+    fe_gv_block_work_t* blocks;
+    fe_gv_cluster_geometry_t* out;
+} fe_gv_build_context_t;
+
+
+// ----------------------------------------------------------------------
+// 2. FAZ 1: MORTON SIRASI VE KOMŞULUK (MESH BAŞINA)
+// ----------------------------------------------------------------------
+
+/**
+ * @brief 10 bitlik sayinin bitlerini 3'er aralikla dagitir (Morton kodu icin).
+ */
+static uint32_t fe_gv_spread_bits(uint32_t x) {
+    x &= 0x3FF;
+    x = (x | (x << 16)) & 0x030000FF;
+    x = (x | (x << 8)) & 0x0300F00F;
+    x = (x | (x << 4)) & 0x030C30C3;
+    x = (x | (x << 2)) & 0x09249249;
+    return x;
+}
+
+static inline fe_vec3_t fe_gv_position(const fe_mesh_t* mesh, uint32_t index) {
+    const float* p = mesh->vertices[index].position;
+    return (fe_vec3_t){{ p[0], p[1], p[2] }};
+}
+
+static void fe_gv_free_mesh_work(fe_gv_mesh_work_t* work) {
+    free(work->centroids);
+    free(work->order);
+    free(work->rank);
+    free(work->vertex_offsets);
+    free(work->vertex_triangles);
+    free(work->states);
+    free(work->slots);
+}
+
+static fe_gv_mesh_status_t fe_gv_prepare_mesh(fe_gv_mesh_work_t* work) {
+    const fe_mesh_t* mesh = work->mesh;
+    uint32_t triangle_count = work->triangle_count;
+    for (uint32_t i = 0; i < 3 * triangle_count; ++i) {
+        if (mesh->indices[i] >= mesh->vertex_count) return FE_GV_MESH_BAD_INDEX;
+    }
+
+    work->centroids = (fe_vec3_t*)malloc(sizeof(fe_vec3_t) * triangle_count);
+    work->order = (uint32_t*)malloc(sizeof(uint32_t) * triangle_count);
+    work->rank = (uint32_t*)malloc(sizeof(uint32_t) * triangle_count);
+    work->vertex_offsets = (uint32_t*)calloc((size_t)mesh->vertex_count + 1, sizeof(uint32_t));
+    work->vertex_triangles = (uint32_t*)malloc(sizeof(uint32_t) * 3 * (size_t)triangle_count);
+    work->states = (uint8_t*)calloc(triangle_count, 1);
+    work->slots = (uint16_t*)malloc(sizeof(uint16_t) * triangle_count);
+    uint32_t* keys = (uint32_t*)malloc(sizeof(uint32_t) * 2 * (size_t)triangle_count);
+    if (!work->centroids || !work->order || !work->rank || !work->vertex_offsets || !work->vertex_triangles ||
+        !work->states || !work->slots || !keys) {
+        free(keys);
+        return FE_GV_MESH_OUT_OF_MEMORY;
+    }
+
+    // A. Ucgen merkezleri ve sinirlari
+    fe_vec3_t lo = {{ INFINITY, INFINITY, INFINITY }}, hi = {{ -INFINITY, -INFINITY, -INFINITY }};
+    for (uint32_t t = 0; t < triangle_count; ++t) {
+        const uint32_t* tri = mesh->indices + 3 * (size_t)t;
+        fe_vec3_t a = fe_gv_position(mesh, tri[0]), b = fe_gv_position(mesh, tri[1]), c = fe_gv_position(mesh, tri[2]);
+        fe_vec3_t centroid = {{ (a.x + b.x + c.x) / 3.0f, (a.y + b.y + c.y) / 3.0f, (a.z + b.z + c.z) / 3.0f }};
+        work->centroids[t] = centroid;
+        for (int axis = 0; axis < 3; ++axis) {
+            lo.v[axis] = fminf(lo.v[axis], centroid.v[axis]);
+            hi.v[axis] = fmaxf(hi.v[axis], centroid.v[axis]);
+        }
+    }
+
+    // B. Morton kodlari (eksen basina 10 bit) ve 3 gecisli taban siralamasi (radix sort)
+    float scale = 0.0f;
+    for (int axis = 0; axis < 3; ++axis) scale = fmaxf(scale, hi.v[axis] - lo.v[axis]);
+    scale = scale > 0.0f ? 1023.0f / scale : 0.0f;
+    uint32_t* sorted_keys = keys + triangle_count;
+    for (uint32_t t = 0; t < triangle_count; ++t) {
+        uint32_t code = 0;
+        for (int axis = 0; axis < 3; ++axis) {
+            uint32_t cell = (uint32_t)((work->centroids[t].v[axis] - lo.v[axis]) * scale);
+            code |= fe_gv_spread_bits(cell) << axis;
+        }
+        keys[t] = code;
+        work->rank[t] = t;
+    }
+    uint32_t* source_ids = work->rank;
+    uint32_t* target_ids = work->order;
+    for (int pass = 0; pass < 3; ++pass) {
+        uint32_t histogram[1024] = {0};
+        int shift = 10 * pass;
+        for (uint32_t i = 0; i < triangle_count; ++i) histogram[(keys[i] >> shift) & 0x3FF]++;
+        uint32_t sum = 0;
+        for (int bucket = 0; bucket < 1024; ++bucket) {
+            uint32_t count = histogram[bucket];
+            histogram[bucket] = sum;
+            sum += count;
+        }
+        for (uint32_t i = 0; i < triangle_count; ++i) {
+            uint32_t slot = histogram[(keys[i] >> shift) & 0x3FF]++;
+            sorted_keys[slot] = keys[i];
+            target_ids[slot] = source_ids[i];
+        }
+        uint32_t* swap_keys = keys; keys = sorted_keys; sorted_keys = swap_keys;
+        uint32_t* swap_ids = source_ids; source_ids = target_ids; target_ids = swap_ids;
+    }
+    // Tek sayida gecis: sonuc source_ids == order'da
+    for (uint32_t i = 0; i < triangle_count; ++i) work->rank[work->order[i]] = i;
+    free(keys < sorted_keys ? keys : sorted_keys);
+
+    // C. Kose -> ucgen komsulugu
+    for (uint32_t i = 0; i < 3 * triangle_count; ++i) work->vertex_offsets[mesh->indices[i] + 1]++;
+    for (uint32_t v = 0; v < mesh->vertex_count; ++v) work->vertex_offsets[v + 1] += work->vertex_offsets[v];
+    for (uint32_t i = 0; i < 3 * triangle_count; ++i) {
+        uint32_t v = mesh->indices[i];
+        work->vertex_triangles[work->vertex_offsets[v]++] = i / 3;
+    }
+    for (uint32_t v = mesh->vertex_count; v > 0; --v) work->vertex_offsets[v] = work->vertex_offsets[v - 1];
+    work->vertex_offsets[0] = 0;
+    return FE_GV_MESH_READY;
+}
+
+static void fe_gv_prepare_meshes_range(void* data, uint32_t begin, uint32_t end) {
+    fe_gv_build_context_t* ctx = (fe_gv_build_context_t*)data;
+    for (uint32_t i = begin; i < end; ++i) {
+        fe_gv_mesh_work_t* work = &ctx->meshes[i];
+        if (work->status == FE_GV_MESH_READY) work->status = fe_gv_prepare_mesh(work);
+    }
+}
+
+
+// ----------------------------------------------------------------------
+// 3. FAZ 2: AÇGÖZLÜ KÜMELEME (BLOK BAŞINA)
+// ----------------------------------------------------------------------
+
+/**
+ * Uygulama: fe_gv_cluster_finish
+ */
+void fe_gv_cluster_finish(fe_gv_cluster_t* cluster, const fe_gpu_triangle_t* triangles) {
+    fe_vec3_t lo = triangles[0].p1, hi = triangles[0].p1;
+    fe_vec3_t axis = {{0.0f, 0.0f, 0.0f}};
+    for (uint32_t t = 0; t < cluster->triangle_count; ++t) {
+        const fe_gpu_triangle_t* tri = &triangles[t];
+        for (int k = 0; k < 3; ++k) {
+            lo.v[k] = fminf(lo.v[k], fminf(tri->p1.v[k], fminf(tri->p2.v[k], tri->p3.v[k])));
+            hi.v[k] = fmaxf(hi.v[k], fmaxf(tri->p1.v[k], fmaxf(tri->p2.v[k], tri->p3.v[k])));
+        }
+        // Alan agirlikli normal (capraz carpimin uzunlugu alanin iki katidir)
+        axis = fe_vec3_add(axis, fe_vec3_cross(fe_vec3_subtract(tri->p2, tri->p1), fe_vec3_subtract(tri->p3, tri->p1)));
+    }
+    cluster->aabb_min = lo;
+    cluster->aabb_max = hi;
+
+    // Koninin yari acisi, eksenle en genis aci yapan ucgen normalidir; 90 dereceyi asarsa kirpma yapilamaz
+    float length = fe_vec3_length(axis);
+    cluster->cone_axis = length > 0.0f ? fe_vec3_scale(axis, 1.0f / length) : (fe_vec3_t){{0.0f, 0.0f, 1.0f}};
+    cluster->cone_cutoff = 1.0f;
+    if (length <= 0.0f) return;
+    float min_dot = 1.0f;
+    for (uint32_t t = 0; t < cluster->triangle_count; ++t) {
+        const fe_gpu_triangle_t* tri = &triangles[t];
+        fe_vec3_t normal = fe_vec3_cross(fe_vec3_subtract(tri->p2, tri->p1), fe_vec3_subtract(tri->p3, tri->p1));
+        float normal_length = fe_vec3_length(normal);
+        if (normal_length <= 0.0f) continue; // Dejenere ucgen gorunmez
+        min_dot = fminf(min_dot, fe_vec3_dot(normal, cluster->cone_axis) / normal_length);
+    }
+    if (min_dot > 0.0f) cluster->cone_cutoff = sqrtf(1.0f - min_dot * min_dot);
+}
+
+/**
+ * @brief Kosenin kumeye yeni eklenip eklenmedigini dondurur (stamp degisince tablo bosalmis sayilir).
+ */
+static bool fe_gv_insert_vertex(uint32_t* keys, uint32_t* stamps, uint32_t stamp, uint32_t vertex) {
+    uint32_t slot = (vertex * 2654435761u) & (FE_GV_CLUSTER_VERTEX_SLOTS - 1);
+    while (stamps[slot] == stamp) {
+        if (keys[slot] == vertex) return false;
+        slot = (slot + 1) & (FE_GV_CLUSTER_VERTEX_SLOTS - 1);
+    }
+    stamps[slot] = stamp;
+    keys[slot] = vertex;
+    return true;
+}
+
+static void fe_gv_remove_candidate(fe_gv_candidate_list_t* list, uint16_t* slots, uint32_t index) {
+    uint32_t last = --list->count;
+    list->triangles[index] = list->triangles[last];
+    list->x[index] = list->x[last];
+    list->y[index] = list->y[last];
+    list->z[index] = list->z[last];
+    list->weight[index] = list->weight[last];
+    slots[list->triangles[index]] = (uint16_t)index;
+}
+
+/**
+ * @brief Blogun ucgenlerini kumeler; kumeler block->clusters'a yazilir.
+ * @return Bellek yetersizse false.
+ */
+static bool fe_gv_cluster_block(fe_gv_build_context_t* ctx, fe_gv_block_work_t* block) {
+    fe_gv_mesh_work_t* work = &ctx->meshes[block->mesh];
+    const fe_mesh_t* mesh = work->mesh;
+    const uint32_t* order = work->order + block->first;
+    uint8_t* states = work->states;
+    uint16_t* slots = work->slots;
+    fe_gpu_triangle_t* out_triangles = ctx->out->triangles + work->triangle_base + block->first;
+
+    // En kotu durumda her ucgen ayri kumedir; sonunda gercek boyuta kucultulur
+    block->clusters = (fe_gv_cluster_t*)malloc(sizeof(fe_gv_cluster_t) * block->count);
+    if (!block->clusters) return false;
+
+    fe_gv_candidate_list_t candidates;
+    uint32_t vertex_keys[FE_GV_CLUSTER_VERTEX_SLOTS];
+    uint32_t vertex_stamps[FE_GV_CLUSTER_VERTEX_SLOTS];
+    memset(vertex_stamps, 0, sizeof(vertex_stamps));
+
+    // Blogun dolu kumelerinin ortalama kosegeni: kucuk kalan kume en az bu kadar uzaga atlayabilir
+    float full_diagonal_sum = 0.0f;
+    uint32_t full_count = 0;
+
+    uint32_t written = 0, cursor = 0;
+    while (written < block->count) {
+        while (states[order[cursor]] == FE_GV_TRIANGLE_ASSIGNED) cursor++;
+
+        uint32_t cluster_first = written;
+        uint32_t stamp = block->cluster_count + 1;
+        candidates.count = 0;
+        float sum[3] = { 0.0f, 0.0f, 0.0f };
+        float lo[3] = { INFINITY, INFINITY, INFINITY }, hi[3] = { -INFINITY, -INFINITY, -INFINITY };
+        uint32_t next = order[cursor];
+
+        for (uint32_t n = 1; ; ++n) {
+            // A. Ucgeni kumeye ekle; yeni koselerinin bloktaki komsulari aday olur
+            const uint32_t* tri = mesh->indices + 3 * (size_t)next;
+            states[next] = FE_GV_TRIANGLE_ASSIGNED;
+            fe_gpu_triangle_t* out = &out_triangles[written++];
+            *out = (fe_gpu_triangle_t){ fe_gv_position(mesh, tri[0]), fe_gv_position(mesh, tri[1]), fe_gv_position(mesh, tri[2]), work->material_id };
+            for (int axis = 0; axis < 3; ++axis) {
+                sum[axis] += work->centroids[next].v[axis];
+                lo[axis] = fminf(lo[axis], fminf(out->p1.v[axis], fminf(out->p2.v[axis], out->p3.v[axis])));
+                hi[axis] = fmaxf(hi[axis], fmaxf(out->p1.v[axis], fmaxf(out->p2.v[axis], out->p3.v[axis])));
+            }
+            for (int k = 0; k < 3; ++k) {
+                if (!fe_gv_insert_vertex(vertex_keys, vertex_stamps, stamp, tri[k])) continue;
+                for (uint32_t e = work->vertex_offsets[tri[k]]; e < work->vertex_offsets[tri[k] + 1]; ++e) {
+                    uint32_t neighbour = work->vertex_triangles[e];
+                    uint32_t rank = work->rank[neighbour];
+                    if (rank < block->first || rank >= block->first + block->count) continue;
+                    if (states[neighbour] == FE_GV_TRIANGLE_CANDIDATE) {
+                        candidates.weight[slots[neighbour]] -= 1.0f;
+                    } else if (states[neighbour] == FE_GV_TRIANGLE_FREE && candidates.count < FE_GV_CLUSTER_CANDIDATE_CAPACITY) {
+                        uint32_t slot = candidates.count++;
+                        states[neighbour] = FE_GV_TRIANGLE_CANDIDATE;
+                        slots[neighbour] = (uint16_t)slot;
+                        candidates.triangles[slot] = neighbour;
+                        candidates.x[slot] = work->centroids[neighbour].x;
+                        candidates.y[slot] = work->centroids[neighbour].y;
+                        candidates.z[slot] = work->centroids[neighbour].z;
+                        candidates.weight[slot] = 3.0f;
+                    }
+                }
+            }
+            if (n == FE_GV_CLUSTER_MAX_TRIANGLES || written == block->count) break;
+
+            // B. En iyi aday: her yeni kose mesafe cezasini bir kat arttirir (kenar komsusu tek koseli
+            // komsudan, bosluk dolduran ucgen ikisinden de once gelir)
+            float cx = sum[0] / (float)n, cy = sum[1] / (float)n, cz = sum[2] / (float)n;
+            uint32_t best = UINT32_MAX;
+            float best_score = INFINITY;
+            for (uint32_t c = 0; c < candidates.count; ++c) {
+                float dx = candidates.x[c] - cx, dy = candidates.y[c] - cy, dz = candidates.z[c] - cz;
+                float score = (dx * dx + dy * dy + dz * dz) * candidates.weight[c];
+                if (score < best_score) { best_score = score; best = c; }
+            }
+            if (best != UINT32_MAX) {
+                next = candidates.triangles[best];
+                fe_gv_remove_candidate(&candidates, slots, best);
+                continue;
+            }
+
+            // C. Komsu kalmadiysa (ayrik parca, dikis veya kumelerin arasinda kalan delik): Morton sirasinda
+            // yakin penceredeki en yakin ucgen. Kumenin ve tipik bir dolu kumenin kosegeninden uzaksa kume
+            // burada kapanir; yoksa daginik artiklar dev kumeler, tek tek delikler de tek ucgenlik kumeler olusturur.
+            uint32_t examined = 0;
+            for (uint32_t i = cursor; i < block->count && examined < FE_GV_CLUSTER_SEARCH_WINDOW; ++i) {
+                uint32_t t = order[i];
+                if (states[t] == FE_GV_TRIANGLE_ASSIGNED) continue;
+                examined++;
+                float dx = work->centroids[t].x - cx, dy = work->centroids[t].y - cy, dz = work->centroids[t].z - cz;
+                float score = dx * dx + dy * dy + dz * dz;
+                if (score < best_score) { best_score = score; best = t; }
+            }
+            float ex = hi[0] - lo[0], ey = hi[1] - lo[1], ez = hi[2] - lo[2];
+            float reach = ex * ex + ey * ey + ez * ez;
+            if (full_count > 0) {
+                float typical = full_diagonal_sum / (float)full_count;
+                reach = fmaxf(reach, typical * typical);
+            }
+            if (best_score > reach) break;
+            next = best;
+        }
+
+        // Kumeye girmeyen adaylar sonraki kumeler icin serbest kalir
+        for (uint32_t c = 0; c < candidates.count; ++c) states[candidates.triangles[c]] = FE_GV_TRIANGLE_FREE;
+
+        fe_gv_cluster_t* cluster = &block->clusters[block->cluster_count++];
+        cluster->first_triangle_idx = work->triangle_base + block->first + cluster_first;
+        cluster->triangle_count = written - cluster_first;
+        fe_gv_cluster_finish(cluster, out_triangles + cluster_first);
+        if (cluster->triangle_count == FE_GV_CLUSTER_MAX_TRIANGLES) {
+            full_diagonal_sum += fe_vec3_length(fe_vec3_subtract(cluster->aabb_max, cluster->aabb_min));
+            full_count++;
+        }
+    }
+
+    fe_gv_cluster_t* shrunk = (fe_gv_cluster_t*)realloc(block->clusters, sizeof(fe_gv_cluster_t) * block->cluster_count);
+    if (shrunk) block->clusters = shrunk;
+    return true;
+}
+
+static void fe_gv_cluster_blocks_range(void* data, uint32_t begin, uint32_t end) {
+    fe_gv_build_context_t* ctx = (fe_gv_build_context_t*)data;
+    for (uint32_t i = begin; i < end; ++i) ctx->blocks[i].is_ok = fe_gv_cluster_block(ctx, &ctx->blocks[i]);
+}
+
+
+// ----------------------------------------------------------------------
+// 4. ARABİRİM UYGULAMALARI
+// ----------------------------------------------------------------------
+
+/**
+ * Uygulama: fe_gv_cluster_build
+ */
+bool fe_gv_cluster_build(const fe_mesh_t* const* meshes, uint32_t mesh_count, fe_gv_cluster_geometry_t* out_geometry) {
+    if (!out_geometry) return false;
+    memset(out_geometry, 0, sizeof(*out_geometry));
+    if (!meshes || mesh_count == 0) return true;
+
+    fe_gv_build_context_t ctx = { NULL, NULL, out_geometry };
+    ctx.meshes = (fe_gv_mesh_work_t*)calloc(mesh_count, sizeof(fe_gv_mesh_work_t));
+    if (!ctx.meshes) return false;
+
+    // 1. Faz 1 (mesh'ler arasinda paralel)
+    for (uint32_t i = 0; i < mesh_count; ++i) {
+        fe_gv_mesh_work_t* work = &ctx.meshes[i];
+        work->mesh = meshes[i];
+        work->material_id = i;
+        if (!meshes[i] || !meshes[i]->vertices || !meshes[i]->indices || meshes[i]->index_count < 3) {
+            work->status = FE_GV_MESH_NO_CPU_DATA;
+            continue;
+        }
+        work->triangle_count = meshes[i]->index_count / 3;
+    }
+    fe_job_parallel_for(mesh_count, 1, fe_gv_prepare_meshes_range, &ctx);
+
+    // 2. Cikti yerlesimi: her mesh'in ucgenleri ardisik, bloklar kendi araliklarina yazar
+    bool success = true;
+    uint32_t block_count = 0;
+    for (uint32_t i = 0; i < mesh_count; ++i) {
+        fe_gv_mesh_work_t* work = &ctx.meshes[i];
+        if (work->status == FE_GV_MESH_NO_CPU_DATA) {
+            FE_LOG_WARN("GeometryV: %u. mesh'in CPU verisi yok, kumelemede atlandi.", i);
+        } else if (work->status == FE_GV_MESH_BAD_INDEX) {
+            FE_LOG_ERROR("GeometryV: %u. mesh'te gecersiz indeks var, kumelemede atlandi.", i);
+        } else if (work->status == FE_GV_MESH_OUT_OF_MEMORY) {
+            success = false;
+        }
+        if (work->status != FE_GV_MESH_READY) {
+            work->triangle_count = 0;
+            continue;
+        }
+        work->triangle_base = out_geometry->triangle_count;
+        out_geometry->triangle_count += work->triangle_count;
+        block_count += (work->triangle_count + FE_GV_CLUSTER_BLOCK_TRIANGLES - 1) / FE_GV_CLUSTER_BLOCK_TRIANGLES;
+    }
+
+    if (success && out_geometry->triangle_count > 0) {
+        out_geometry->triangles = (fe_gpu_triangle_t*)malloc(sizeof(fe_gpu_triangle_t) * out_geometry->triangle_count);
+        ctx.blocks = (fe_gv_block_work_t*)calloc(block_count, sizeof(fe_gv_block_work_t));
+        success = out_geometry->triangles && ctx.blocks;
+    }
+
+    // 3. Faz 2 (bloklar arasinda paralel)
+    if (success && block_count > 0) {
+        uint32_t block = 0;
+        for (uint32_t i = 0; i < mesh_count; ++i) {
+            for (uint32_t first = 0; first < ctx.meshes[i].triangle_count; first += FE_GV_CLUSTER_BLOCK_TRIANGLES) {
+                uint32_t count = ctx.meshes[i].triangle_count - first;
+                if (count > FE_GV_CLUSTER_BLOCK_TRIANGLES) count = FE_GV_CLUSTER_BLOCK_TRIANGLES;
+                ctx.blocks[block].mesh = i;
+                ctx.blocks[block].first = first;
+                ctx.blocks[block].count = count;
+                block++;
+            }
+        }
+        fe_job_parallel_for(block_count, 1, fe_gv_cluster_blocks_range, &ctx);
+
+        // 4. Blok kumelerini birlestir
+        for (uint32_t b = 0; b < block_count; ++b) {
+            success = success && ctx.blocks[b].is_ok;
+            out_geometry->cluster_count += ctx.blocks[b].cluster_count;
+        }
+        if (success) {
+            out_geometry->clusters = (fe_gv_cluster_t*)malloc(sizeof(fe_gv_cluster_t) * out_geometry->cluster_count);
+            success = out_geometry->clusters != NULL;
+        }
+        uint32_t cluster_count = 0;
+        for (uint32_t b = 0; b < block_count; ++b) {
+            if (success) memcpy(out_geometry->clusters + cluster_count, ctx.blocks[b].clusters, sizeof(fe_gv_cluster_t) * ctx.blocks[b].cluster_count);
+            cluster_count += ctx.blocks[b].cluster_count;
+            free(ctx.blocks[b].clusters);
+        }
+    }
+
+    for (uint32_t i = 0; i < mesh_count; ++i) fe_gv_free_mesh_work(&ctx.meshes[i]);
+    free(ctx.meshes);
+    free(ctx.blocks);
+
+    if (!success) {
+        FE_LOG_ERROR("GeometryV kumeleme icin bellek yetersiz.");
+        fe_gv_cluster_geometry_free(out_geometry);
+        return false;
+    }
+    FE_LOG_DEBUG("GeometryV kumeleme: %u ucgen, %u kume, %u blok.", out_geometry->triangle_count, out_geometry->cluster_count, block_count);
+    return true;
+}
+
+/**
+ * Uygulama: fe_gv_cluster_geometry_free
+ */
+void fe_gv_cluster_geometry_free(fe_gv_cluster_geometry_t* geometry) {
+    if (!geometry) return;
+    free(geometry->triangles);
+    free(geometry->clusters);
+    memset(geometry, 0, sizeof(*geometry));
+}
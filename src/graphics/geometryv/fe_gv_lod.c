@@ -0,0 +1,1009 @@
+// src/graphics/geometryv/fe_gv_lod.c
+
+#include "graphics/geometryv/fe_gv_lod.h"
+#include "platform/fe_job_system.h" // fe_job_parallel_for
+#include "math/fe_hash.h"           // fe_hash_data
+#include "utils/fe_logger.h"
+#include <stdlib.h> // malloc, realloc, free için
+#include <string.h> // memset, memcpy için
+#include <math.h>
+
+
+// ----------------------------------------------------------------------
+// 1. DAHİLİ YAPILAR
+// ----------------------------------------------------------------------
+
+// Bir kosede bulusan farkli kume sayisinin ust siniri (komsuluk ciftleri icin; fazlasi yok sayilir)
+#define FE_GV_LOD_MAX_CLUSTERS_PER_VERTEX 8
+
+// Grup sadelestirmesinde en fazla gecis; her geciste birbirine dokunmayan kenarlar daraltilir
+#define FE_GV_LOD_MAX_PASSES 24
+
+// Daraltma gecerlilik testinde bir kosenin en fazla komsu sayisi
+#define FE_GV_LOD_MAX_RING 64
+
+/**
+ * @brief Alan agirlikli simetrik 4x4 quadric (Garland-Heckbert) ve toplam agirligi.
+ * * Hata agirliga bolunur: duzlem sayisi arttikca sismeyen, alan ortalamali uzaklik karesi.
+ */
+typedef struct fe_gv_lod_quadric {
+    double xx, xy, xz, xw, yy, yz, yw, zz, zw, ww;
+    double weight;
+} fe_gv_lod_quadric_t;
+
+typedef struct fe_gv_lod_collapse {
+    double cost;
+    uint32_t from, to; // from, to'nun konumuna tasinir
+} fe_gv_lod_collapse_t;
+
+/**
+ * @brief Bir grubun sadelestirme sonucu; gruplar birbirinden bagimsiz yazar, sonra grup sirasiyla birlestirilir.
+ */
+typedef struct fe_gv_lod_group_result {
+    fe_gpu_triangle_t* triangles;
+    fe_gv_cluster_t* clusters;   // first_triangle_idx sonucun kendi ucgenlerine gore
+    uint32_t triangle_count;
+    uint32_t cluster_count;
+    float error;
+    bool is_ok;
+} fe_gv_lod_group_result_t;
+
+typedef struct fe_gv_lod_build_context {
+    const fe_gv_lod_dag_t* dag;
+    const fe_gv_lod_group_t* groups; // Bu seviyenin gruplari
+    fe_gv_lod_group_result_t* results;
+} fe_gv_lod_build_context_t;
+
+/**
+ * @brief Bir grubun kaynaklanmis (weld) mesh'i ve sadelestirme calisma alani.
+ * * Olu ucgenlerde indices[t][0] == FE_GV_LOD_NONE'dur.
+ */
+typedef struct fe_gv_lod_mesh {
+    float (*positions)[3];
+    fe_gv_lod_quadric_t* quadrics;
+    uint8_t* locked;            // Grup siniri veya manifold olmayan kenar: kose hareket etmez
+    uint8_t* touched;           // Bu geciste komsulugu degisen kose
+    uint32_t* vertex_offsets;   // Kose -> ucgen komsulugu (CSR, gecis basinda kurulur)
+    uint32_t* vertex_triangles;
+    uint32_t vertex_count;
+    uint32_t (*indices)[3];
+    uint32_t* materials;
+    uint32_t triangle_count;    // Dizideki ucgen sayisi (olu dahil)
+    uint32_t alive_count;
+    uint64_t* edges;
+    fe_gv_lod_collapse_t* collapses;
+} fe_gv_lod_mesh_t;
+
+
+// ----------------------------------------------------------------------
+// 2. ORTAK YARDIMCILAR
+// ----------------------------------------------------------------------
+
+static bool fe_gv_lod_reserve(void** array, uint32_t* capacity, uint64_t needed, size_t element_size) {
+    if (needed <= *capacity) return true;
+    if (needed > UINT32_MAX) return false;
+    uint64_t new_capacity = *capacity ? *capacity : 64;
+    while (new_capacity < needed) new_capacity *= 2;
+    if (new_capacity > UINT32_MAX) new_capacity = UINT32_MAX;
+    void* grown = realloc(*array, element_size * new_capacity);
+    if (!grown) return false;
+    *array = grown;
+    *capacity = (uint32_t)new_capacity;
+    return true;
+}
+
+/**
+ * @brief 64 bitlik anahtarlari 11 bitlik 6 gecisle taban siralamasina (radix sort) gore dizer.
+ */
+static bool fe_gv_lod_sort_keys(uint64_t* keys, uint32_t count) {
+    if (count < 2) return true;
+    uint64_t* temp = (uint64_t*)malloc(sizeof(uint64_t) * count);
+    if (!temp) return false;
+    uint64_t* source = keys;
+    uint64_t* target = temp;
+    for (int pass = 0; pass < 6; ++pass) {
+        uint32_t histogram[2048] = {0};
+        int shift = 11 * pass;
+        for (uint32_t i = 0; i < count; ++i) histogram[(source[i] >> shift) & 0x7FF]++;
+        uint32_t sum = 0;
+        for (int bucket = 0; bucket < 2048; ++bucket) {
+            uint32_t bucket_count = histogram[bucket];
+            histogram[bucket] = sum;
+            sum += bucket_count;
+        }
+        for (uint32_t i = 0; i < count; ++i) target[histogram[(source[i] >> shift) & 0x7FF]++] = source[i];
+        uint64_t* swap = source; source = target; target = swap;
+    }
+    // Cift sayida gecis: sonuc keys'te
+    free(temp);
+    return true;
+}
+
+static uint32_t fe_gv_lod_spread_bits(uint32_t x) {
+    x &= 0x3FF;
+    x = (x | (x << 16)) & 0x030000FF;
+    x = (x | (x << 8)) & 0x0300F00F;
+    x = (x | (x << 4)) & 0x030C30C3;
+    x = (x | (x << 2)) & 0x09249249;
+    return x;
+}
+
+static inline float fe_gv_lod_distance(const fe_vec3_t* a, const fe_vec3_t* b) {
+    float dx = a->x - b->x, dy = a->y - b->y, dz = a->z - b->z;
+    return sqrtf(dx * dx + dy * dy + dz * dz);
+}
+
+
+// ----------------------------------------------------------------------
+// 3. GRUPLAMA (SEVİYE BAŞINA)
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Seviyenin kumelerini komsuluklarina gore gruplar.
+ * * Iki kume, ortak kose konumu sayisi kadar agirlikla komsudur. Tohumlar Morton sirasiyla alinir;
+ * * grup, kendisiyle en cok kose paylasan bos komsuyla FE_GV_LOD_GROUP_CLUSTERS'a kadar buyur.
+ * @param out_order Yeni sira: out_order[i], i. yerdeki kumenin seviyedeki eski yeri.
+ * @param out_group_sizes Gruplarin sirayla uye sayilari.
+ */
+static bool fe_gv_lod_group_level(const fe_gv_lod_dag_t* dag, uint32_t first, uint32_t count,
+                                  uint32_t* out_order, uint32_t* out_group_sizes, uint32_t* out_group_count) {
+    const fe_gv_cluster_t* clusters = dag->geometry.clusters + first;
+    const fe_gpu_triangle_t* triangles = dag->geometry.triangles;
+    if (count > 0xFFFFFF) return false; // Anahtarin alt 24 biti kume indeksidir
+
+    uint64_t ref_count = 0;
+    for (uint32_t c = 0; c < count; ++c) ref_count += 3 * (uint64_t)clusters[c].triangle_count;
+    if (ref_count > UINT32_MAX) return false;
+
+    bool success = false;
+    uint64_t* refs = (uint64_t*)malloc(sizeof(uint64_t) * ref_count);
+    uint64_t* pairs = NULL;
+    uint32_t pair_count = 0, pair_capacity = 0;
+    uint32_t* adjacency_offsets = (uint32_t*)calloc((size_t)count + 1, sizeof(uint32_t));
+    uint32_t* adjacency = NULL;   // (komsu, agirlik) ciftleri
+    uint64_t* morton = (uint64_t*)malloc(sizeof(uint64_t) * count);
+    uint32_t* rank = (uint32_t*)malloc(sizeof(uint32_t) * count);
+    uint32_t* group_of = (uint32_t*)malloc(sizeof(uint32_t) * count);
+    uint32_t* members = (uint32_t*)malloc(sizeof(uint32_t) * FE_GV_LOD_GROUP_MAX_CLUSTERS * (size_t)count);
+    if (!refs || !adjacency_offsets || !morton || !rank || !group_of || !members) goto cleanup;
+
+    // A. Kose konumlari: (konum hash'inin ust 40 biti | kume) siralanir; ayni konumdaki farkli kumeler komsudur
+    uint32_t r = 0;
+    for (uint32_t c = 0; c < count; ++c) {
+        const fe_gpu_triangle_t* tri = triangles + clusters[c].first_triangle_idx;
+        for (uint32_t t = 0; t < clusters[c].triangle_count; ++t, ++tri) {
+            refs[r++] = (fe_hash_data(&tri->p1, sizeof(fe_vec3_t)) & ~(uint64_t)0xFFFFFF) | c;
+            refs[r++] = (fe_hash_data(&tri->p2, sizeof(fe_vec3_t)) & ~(uint64_t)0xFFFFFF) | c;
+            refs[r++] = (fe_hash_data(&tri->p3, sizeof(fe_vec3_t)) & ~(uint64_t)0xFFFFFF) | c;
+        }
+    }
+    if (!fe_gv_lod_sort_keys(refs, r)) goto cleanup;
+
+    for (uint32_t i = 0; i < r;) {
+        uint32_t j = i;
+        uint32_t distinct[FE_GV_LOD_MAX_CLUSTERS_PER_VERTEX];
+        uint32_t distinct_count = 0;
+        for (; j < r && (refs[j] >> 24) == (refs[i] >> 24); ++j) {
+            uint32_t c = (uint32_t)(refs[j] & 0xFFFFFF);
+            if ((distinct_count == 0 || distinct[distinct_count - 1] != c) && distinct_count < FE_GV_LOD_MAX_CLUSTERS_PER_VERTEX) {
+                distinct[distinct_count++] = c;
+            }
+        }
+        if (distinct_count > 1) {
+            if (!fe_gv_lod_reserve((void**)&pairs, &pair_capacity, (uint64_t)pair_count + distinct_count * distinct_count, sizeof(uint64_t))) goto cleanup;
+            for (uint32_t a = 0; a < distinct_count; ++a) {
+                for (uint32_t b = a + 1; b < distinct_count; ++b) pairs[pair_count++] = ((uint64_t)distinct[a] << 32) | distinct[b];
+            }
+        }
+        i = j;
+    }
+    if (!fe_gv_lod_sort_keys(pairs, pair_count)) goto cleanup;
+
+    // B. Agirlikli komsuluk (CSR, iki yonlu)
+    uint32_t unique_pairs = 0;
+    for (uint32_t i = 0; i < pair_count; ++i) {
+        if (i > 0 && pairs[i] == pairs[i - 1]) continue;
+        adjacency_offsets[(pairs[i] >> 32) + 1]++;
+        adjacency_offsets[(pairs[i] & 0xFFFFFFFF) + 1]++;
+        unique_pairs++;
+    }
+    for (uint32_t c = 0; c < count; ++c) adjacency_offsets[c + 1] += adjacency_offsets[c];
+    adjacency = (uint32_t*)malloc(sizeof(uint32_t) * 4 * ((size_t)unique_pairs + 1));
+    if (!adjacency) goto cleanup;
+    for (uint32_t i = 0; i < pair_count;) {
+        uint32_t j = i;
+        while (j < pair_count && pairs[j] == pairs[i]) ++j;
+        uint32_t a = (uint32_t)(pairs[i] >> 32), b = (uint32_t)(pairs[i] & 0xFFFFFFFF);
+        uint32_t slot_a = adjacency_offsets[a]++, slot_b = adjacency_offsets[b]++;
+        adjacency[2 * slot_a] = b; adjacency[2 * slot_a + 1] = j - i;
+        adjacency[2 * slot_b] = a; adjacency[2 * slot_b + 1] = j - i;
+        i = j;
+    }
+    for (uint32_t c = count; c > 0; --c) adjacency_offsets[c] = adjacency_offsets[c - 1];
+    adjacency_offsets[0] = 0;
+
+    // C. Tohum sirasi: kume merkezlerinin Morton kodu
+    fe_vec3_t lo = {{ INFINITY, INFINITY, INFINITY }}, hi = {{ -INFINITY, -INFINITY, -INFINITY }};
+    for (uint32_t c = 0; c < count; ++c) {
+        for (int axis = 0; axis < 3; ++axis) {
+            float center = 0.5f * (clusters[c].aabb_min.v[axis] + clusters[c].aabb_max.v[axis]);
+            lo.v[axis] = fminf(lo.v[axis], center);
+            hi.v[axis] = fmaxf(hi.v[axis], center);
+        }
+    }
+    float scale = 0.0f;
+    for (int axis = 0; axis < 3; ++axis) scale = fmaxf(scale, hi.v[axis] - lo.v[axis]);
+    scale = scale > 0.0f ? 1023.0f / scale : 0.0f;
+    for (uint32_t c = 0; c < count; ++c) {
+        uint32_t code = 0;
+        for (int axis = 0; axis < 3; ++axis) {
+            float center = 0.5f * (clusters[c].aabb_min.v[axis] + clusters[c].aabb_max.v[axis]);
+            code |= fe_gv_lod_spread_bits((uint32_t)((center - lo.v[axis]) * scale)) << axis;
+        }
+        morton[c] = ((uint64_t)code << 32) | c;
+    }
+    if (!fe_gv_lod_sort_keys(morton, count)) goto cleanup;
+    for (uint32_t i = 0; i < count; ++i) rank[morton[i] & 0xFFFFFFFF] = i;
+
+    // D. Acgozlu gruplama
+    uint32_t group_count = 0;
+    for (uint32_t c = 0; c < count; ++c) group_of[c] = FE_GV_LOD_NONE;
+    for (uint32_t i = 0; i < count; ++i) {
+        uint32_t seed = (uint32_t)(morton[i] & 0xFFFFFFFF);
+        if (group_of[seed] != FE_GV_LOD_NONE) continue;
+        uint32_t g = group_count++;
+        uint32_t* group = members + (size_t)g * FE_GV_LOD_GROUP_MAX_CLUSTERS;
+        uint32_t size = 0;
+        group[size++] = seed;
+        group_of[seed] = g;
+
+        while (size < FE_GV_LOD_GROUP_CLUSTERS) {
+            // Grupla en cok kose paylasan bos komsu (esitlikte Morton sirasinda once gelen)
+            uint32_t best = FE_GV_LOD_NONE, best_weight = 0;
+            for (uint32_t m = 0; m < size; ++m) {
+                for (uint32_t e = adjacency_offsets[group[m]]; e < adjacency_offsets[group[m] + 1]; ++e) {
+                    uint32_t neighbor = adjacency[2 * e];
+                    if (group_of[neighbor] != FE_GV_LOD_NONE) continue;
+                    uint32_t weight = 0;
+                    for (uint32_t n = 0; n < size; ++n) {
+                        for (uint32_t f = adjacency_offsets[neighbor]; f < adjacency_offsets[neighbor + 1]; ++f) {
+                            if (adjacency[2 * f] == group[n]) weight += adjacency[2 * f + 1];
+                        }
+                    }
+                    if (weight > best_weight || (weight == best_weight && best != FE_GV_LOD_NONE && rank[neighbor] < rank[best])) {
+                        best = neighbor;
+                        best_weight = weight;
+                    }
+                }
+            }
+            if (best == FE_GV_LOD_NONE) break;
+            group[size++] = best;
+            group_of[best] = g;
+        }
+
+        // Komsusu tukenen kucuk grup: en cok kose paylastigi, yeri olan komsu gruba katilir
+        if (size < FE_GV_LOD_GROUP_CLUSTERS / 2) {
+            uint32_t best = FE_GV_LOD_NONE, best_weight = 0;
+            for (uint32_t m = 0; m < size; ++m) {
+                for (uint32_t e = adjacency_offsets[group[m]]; e < adjacency_offsets[group[m] + 1]; ++e) {
+                    uint32_t other = group_of[adjacency[2 * e]];
+                    if (other == g || other == FE_GV_LOD_NONE || out_group_sizes[other] + size > FE_GV_LOD_GROUP_MAX_CLUSTERS) continue;
+                    if (adjacency[2 * e + 1] > best_weight || (adjacency[2 * e + 1] == best_weight && other < best)) {
+                        best = other;
+                        best_weight = adjacency[2 * e + 1];
+                    }
+                }
+            }
+            if (best != FE_GV_LOD_NONE) {
+                uint32_t* target = members + (size_t)best * FE_GV_LOD_GROUP_MAX_CLUSTERS;
+                for (uint32_t m = 0; m < size; ++m) {
+                    target[out_group_sizes[best]++] = group[m];
+                    group_of[group[m]] = best;
+                }
+                group_count--;
+                continue;
+            }
+        }
+        out_group_sizes[g] = size;
+    }
+
+    // E. Cikti sirasi: gruplar olusma sirasiyla, uyeler eklenme sirasiyla
+    uint32_t position = 0;
+    for (uint32_t g = 0; g < group_count; ++g) {
+        const uint32_t* group = members + (size_t)g * FE_GV_LOD_GROUP_MAX_CLUSTERS;
+        for (uint32_t m = 0; m < out_group_sizes[g]; ++m) out_order[position++] = group[m];
+    }
+    *out_group_count = group_count;
+    success = position == count;
+
+cleanup:
+    free(refs);
+    free(pairs);
+    free(adjacency_offsets);
+    free(adjacency);
+    free(morton);
+    free(rank);
+    free(group_of);
+    free(members);
+    return success;
+}
+
+
+// ----------------------------------------------------------------------
+// 4. GRUP SADELEŞTİRME (KENAR DARALTMA)
+// ----------------------------------------------------------------------
+
+static void fe_gv_lod_free_mesh(fe_gv_lod_mesh_t* mesh) {
+    free(mesh->positions);
+    free(mesh->quadrics);
+    free(mesh->locked);
+    free(mesh->touched);
+    free(mesh->vertex_offsets);
+    free(mesh->vertex_triangles);
+    free(mesh->indices);
+    free(mesh->materials);
+    free(mesh->edges);
+    free(mesh->collapses);
+}
+
+static void fe_gv_lod_add_plane(fe_gv_lod_quadric_t* q, double a, double b, double c, double d, double w) {
+    q->xx += w * a * a; q->xy += w * a * b; q->xz += w * a * c; q->xw += w * a * d;
+    q->yy += w * b * b; q->yz += w * b * c; q->yw += w * b * d;
+    q->zz += w * c * c; q->zw += w * c * d;
+    q->ww += w * d * d;
+    q->weight += w;
+}
+
+static void fe_gv_lod_add_quadric(fe_gv_lod_quadric_t* q, const fe_gv_lod_quadric_t* other) {
+    q->xx += other->xx; q->xy += other->xy; q->xz += other->xz; q->xw += other->xw;
+    q->yy += other->yy; q->yz += other->yz; q->yw += other->yw;
+    q->zz += other->zz; q->zw += other->zw;
+    q->ww += other->ww;
+    q->weight += other->weight;
+}
+
+static double fe_gv_lod_quadric_error(const fe_gv_lod_quadric_t* a, const fe_gv_lod_quadric_t* b, const float* p) {
+    double x = p[0], y = p[1], z = p[2];
+    double e = (a->xx + b->xx) * x * x + 2.0 * (a->xy + b->xy) * x * y + 2.0 * (a->xz + b->xz) * x * z + 2.0 * (a->xw + b->xw) * x
+             + (a->yy + b->yy) * y * y + 2.0 * (a->yz + b->yz) * y * z + 2.0 * (a->yw + b->yw) * y
+             + (a->zz + b->zz) * z * z + 2.0 * (a->zw + b->zw) * z
+             + (a->ww + b->ww);
+    double w = a->weight + b->weight;
+    return e > 0.0 && w > 0.0 ? e / w : 0.0;
+}
+
+static void fe_gv_lod_triangle_normal(const float* a, const float* b, const float* c, double* n) {
+    double ux = b[0] - a[0], uy = b[1] - a[1], uz = b[2] - a[2];
+    double vx = c[0] - a[0], vy = c[1] - a[1], vz = c[2] - a[2];
+    n[0] = uy * vz - uz * vy;
+    n[1] = uz * vx - ux * vz;
+    n[2] = ux * vy - uy * vx;
+}
+
+static int fe_gv_lod_compare_collapses(const void* a, const void* b) {
+    const fe_gv_lod_collapse_t* x = (const fe_gv_lod_collapse_t*)a;
+    const fe_gv_lod_collapse_t* y = (const fe_gv_lod_collapse_t*)b;
+    if (x->cost != y->cost) return x->cost < y->cost ? -1 : 1;
+    if (x->from != y->from) return x->from < y->from ? -1 : 1;
+    return x->to < y->to ? -1 : (x->to > y->to ? 1 : 0);
+}
+
+/**
+ * @brief Grubun ucgenlerini ortak konumlarda birlestirir (weld), sinir koselerini kilitler ve quadric'leri kurar.
+ */
+static bool fe_gv_lod_load_mesh(fe_gv_lod_mesh_t* mesh, const fe_gv_lod_dag_t* dag, const fe_gv_lod_group_t* group) {
+    const fe_gv_cluster_t* clusters = dag->geometry.clusters + group->first_member;
+    uint32_t triangle_count = 0;
+    for (uint32_t m = 0; m < group->member_count; ++m) triangle_count += clusters[m].triangle_count;
+
+    uint32_t corner_count = 3 * triangle_count;
+    uint32_t table_size = 64;
+    while (table_size < 2 * corner_count) table_size *= 2;
+    uint32_t* table = (uint32_t*)malloc(sizeof(uint32_t) * table_size);
+    mesh->positions = (float (*)[3])malloc(sizeof(float[3]) * corner_count);
+    mesh->indices = (uint32_t (*)[3])malloc(sizeof(uint32_t[3]) * triangle_count);
+    mesh->materials = (uint32_t*)malloc(sizeof(uint32_t) * triangle_count);
+    mesh->edges = (uint64_t*)malloc(sizeof(uint64_t) * corner_count);
+    mesh->collapses = (fe_gv_lod_collapse_t*)malloc(sizeof(fe_gv_lod_collapse_t) * corner_count);
+    mesh->vertex_triangles = (uint32_t*)malloc(sizeof(uint32_t) * corner_count);
+    if (!table || !mesh->positions || !mesh->indices || !mesh->materials || !mesh->edges || !mesh->collapses || !mesh->vertex_triangles) {
+        free(table);
+        return false;
+    }
+    memset(table, 0xFF, sizeof(uint32_t) * table_size);
+
+    // A. Weld: ayni konumdaki koseler tek kose olur (kumeleyici koseleri mesh'ten birebir kopyalar)
+    for (uint32_t m = 0; m < group->member_count; ++m) {
+        const fe_gpu_triangle_t* tri = dag->geometry.triangles + clusters[m].first_triangle_idx;
+        for (uint32_t t = 0; t < clusters[m].triangle_count; ++t, ++tri) {
+            const fe_vec3_t* corners[3] = { &tri->p1, &tri->p2, &tri->p3 };
+            uint32_t ids[3];
+            for (int k = 0; k < 3; ++k) {
+                uint32_t slot = (uint32_t)fe_hash_data(corners[k]->v, sizeof(float) * 3) & (table_size - 1);
+                while (table[slot] != FE_GV_LOD_NONE && memcmp(mesh->positions[table[slot]], corners[k]->v, sizeof(float) * 3) != 0) {
+                    slot = (slot + 1) & (table_size - 1);
+                }
+                if (table[slot] == FE_GV_LOD_NONE) {
+                    table[slot] = mesh->vertex_count;
+                    memcpy(mesh->positions[mesh->vertex_count++], corners[k]->v, sizeof(float) * 3);
+                }
+                ids[k] = table[slot];
+            }
+            if (ids[0] == ids[1] || ids[1] == ids[2] || ids[0] == ids[2]) continue; // Dejenere
+            memcpy(mesh->indices[mesh->triangle_count], ids, sizeof(ids));
+            mesh->materials[mesh->triangle_count++] = tri->material_id;
+        }
+    }
+    free(table);
+    mesh->alive_count = mesh->triangle_count;
+
+    mesh->quadrics = (fe_gv_lod_quadric_t*)calloc(mesh->vertex_count, sizeof(fe_gv_lod_quadric_t));
+    mesh->locked = (uint8_t*)calloc(mesh->vertex_count, 1);
+    mesh->touched = (uint8_t*)malloc(mesh->vertex_count);
+    mesh->vertex_offsets = (uint32_t*)malloc(sizeof(uint32_t) * ((size_t)mesh->vertex_count + 1));
+    if (!mesh->quadrics || !mesh->locked || !mesh->touched || !mesh->vertex_offsets) return false;
+
+    // B. Tek ucgenin kullandigi kenar grup siniridir (komsu grup veya mesh kenari); ikiden fazlasi manifold degildir
+    uint32_t edge_count = 0;
+    for (uint32_t t = 0; t < mesh->triangle_count; ++t) {
+        for (int k = 0; k < 3; ++k) {
+            uint32_t a = mesh->indices[t][k], b = mesh->indices[t][(k + 1) % 3];
+            mesh->edges[edge_count++] = a < b ? ((uint64_t)a << 32) | b : ((uint64_t)b << 32) | a;
+        }
+    }
+    if (!fe_gv_lod_sort_keys(mesh->edges, edge_count)) return false;
+    for (uint32_t i = 0; i < edge_count;) {
+        uint32_t j = i;
+        while (j < edge_count && mesh->edges[j] == mesh->edges[i]) ++j;
+        if (j - i != 2) {
+            mesh->locked[mesh->edges[i] >> 32] = 1;
+            mesh->locked[mesh->edges[i] & 0xFFFFFFFF] = 1;
+        }
+        i = j;
+    }
+
+    // C. Duzlem quadric'leri
+    for (uint32_t t = 0; t < mesh->triangle_count; ++t) {
+        const uint32_t* v = mesh->indices[t];
+        double n[3];
+        fe_gv_lod_triangle_normal(mesh->positions[v[0]], mesh->positions[v[1]], mesh->positions[v[2]], n);
+        double length = sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+        if (length <= 0.0) continue;
+        n[0] /= length; n[1] /= length; n[2] /= length;
+        double d = -(n[0] * mesh->positions[v[0]][0] + n[1] * mesh->positions[v[0]][1] + n[2] * mesh->positions[v[0]][2]);
+        for (int k = 0; k < 3; ++k) fe_gv_lod_add_plane(&mesh->quadrics[v[k]], n[0], n[1], n[2], d, 0.5 * length);
+    }
+    return true;
+}
+
+/**
+ * @brief Canli ucgenlerden kose -> ucgen komsulugunu kurar.
+ */
+static void fe_gv_lod_build_adjacency(fe_gv_lod_mesh_t* mesh) {
+    memset(mesh->vertex_offsets, 0, sizeof(uint32_t) * ((size_t)mesh->vertex_count + 1));
+    for (uint32_t t = 0; t < mesh->triangle_count; ++t) {
+        if (mesh->indices[t][0] == FE_GV_LOD_NONE) continue;
+        for (int k = 0; k < 3; ++k) mesh->vertex_offsets[mesh->indices[t][k] + 1]++;
+    }
+    for (uint32_t v = 0; v < mesh->vertex_count; ++v) mesh->vertex_offsets[v + 1] += mesh->vertex_offsets[v];
+    for (uint32_t t = 0; t < mesh->triangle_count; ++t) {
+        if (mesh->indices[t][0] == FE_GV_LOD_NONE) continue;
+        for (int k = 0; k < 3; ++k) mesh->vertex_triangles[mesh->vertex_offsets[mesh->indices[t][k]]++] = t;
+    }
+    for (uint32_t v = mesh->vertex_count; v > 0; --v) mesh->vertex_offsets[v] = mesh->vertex_offsets[v - 1];
+    mesh->vertex_offsets[0] = 0;
+}
+
+static uint32_t fe_gv_lod_collect_ring(const fe_gv_lod_mesh_t* mesh, uint32_t vertex, uint32_t* ring) {
+    uint32_t count = 0;
+    for (uint32_t e = mesh->vertex_offsets[vertex]; e < mesh->vertex_offsets[vertex + 1]; ++e) {
+        const uint32_t* tri = mesh->indices[mesh->vertex_triangles[e]];
+        for (int k = 0; k < 3; ++k) {
+            uint32_t v = tri[k];
+            if (v == vertex) continue;
+            uint32_t i = 0;
+            while (i < count && ring[i] != v) ++i;
+            if (i == count) {
+                if (count == FE_GV_LOD_MAX_RING) return FE_GV_LOD_NONE;
+                ring[count++] = v;
+            }
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief from -> to daraltmasi topolojiyi bozmuyor (link kosulu) ve ucgen cevirmiyorsa true.
+ */
+static bool fe_gv_lod_collapse_is_valid(const fe_gv_lod_mesh_t* mesh, uint32_t from, uint32_t to) {
+    // Link kosulu: iki kosenin ortak komsulari, sadece kenari paylasan ucgenlerin karsi koseleri olmalidir
+    uint32_t ring_from[FE_GV_LOD_MAX_RING], ring_to[FE_GV_LOD_MAX_RING];
+    uint32_t count_from = fe_gv_lod_collect_ring(mesh, from, ring_from);
+    uint32_t count_to = fe_gv_lod_collect_ring(mesh, to, ring_to);
+    if (count_from == FE_GV_LOD_NONE || count_to == FE_GV_LOD_NONE) return false;
+    uint32_t common = 0, shared = 0;
+    for (uint32_t i = 0; i < count_from; ++i) {
+        for (uint32_t j = 0; j < count_to; ++j) common += ring_from[i] == ring_to[j];
+    }
+    for (uint32_t e = mesh->vertex_offsets[from]; e < mesh->vertex_offsets[from + 1]; ++e) {
+        const uint32_t* tri = mesh->indices[mesh->vertex_triangles[e]];
+        shared += tri[0] == to || tri[1] == to || tri[2] == to;
+    }
+    if (common != shared) return false;
+
+    // Kalan ucgenlerin normali donmemeli
+    for (uint32_t e = mesh->vertex_offsets[from]; e < mesh->vertex_offsets[from + 1]; ++e) {
+        const uint32_t* tri = mesh->indices[mesh->vertex_triangles[e]];
+        if (tri[0] == to || tri[1] == to || tri[2] == to) continue;
+        const float* p[3];
+        for (int k = 0; k < 3; ++k) p[k] = mesh->positions[tri[k]];
+        double before[3], after[3];
+        fe_gv_lod_triangle_normal(p[0], p[1], p[2], before);
+        for (int k = 0; k < 3; ++k) if (tri[k] == from) p[k] = mesh->positions[to];
+        fe_gv_lod_triangle_normal(p[0], p[1], p[2], after);
+        if (before[0] * after[0] + before[1] * after[1] + before[2] * after[2] <= 0.0) return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Ucgen sayisini hedefe indirene kadar en ucuz kenarlari daraltir.
+ * * Her geciste adaylar maliyete gore siralanir; daraltilan kenarin 1-komsulugu o gecis icin kilitlenir,
+ * * boylece gecis icindeki daraltmalar birbirinin komsulugunu bozmaz.
+ * @return Uygulanan en buyuk daraltmanin quadric hatasi (uzaklik karesi).
+ */
+static double fe_gv_lod_simplify(fe_gv_lod_mesh_t* mesh, uint32_t target) {
+    double max_cost = 0.0;
+    for (int pass = 0; pass < FE_GV_LOD_MAX_PASSES && mesh->alive_count > target; ++pass) {
+        fe_gv_lod_build_adjacency(mesh);
+
+        // Benzersiz kenarlar
+        uint32_t edge_count = 0;
+        for (uint32_t t = 0; t < mesh->triangle_count; ++t) {
+            if (mesh->indices[t][0] == FE_GV_LOD_NONE) continue;
+            for (int k = 0; k < 3; ++k) {
+                uint32_t a = mesh->indices[t][k], b = mesh->indices[t][(k + 1) % 3];
+                mesh->edges[edge_count++] = a < b ? ((uint64_t)a << 32) | b : ((uint64_t)b << 32) | a;
+            }
+        }
+        if (!fe_gv_lod_sort_keys(mesh->edges, edge_count)) break;
+
+        // Her kenarin ucuz yonu (kilitli kose tasinamaz)
+        uint32_t collapse_count = 0;
+        for (uint32_t i = 0; i < edge_count; ++i) {
+            if (i > 0 && mesh->edges[i] == mesh->edges[i - 1]) continue;
+            uint32_t a = (uint32_t)(mesh->edges[i] >> 32), b = (uint32_t)(mesh->edges[i] & 0xFFFFFFFF);
+            const fe_gv_lod_quadric_t* qa = &mesh->quadrics[a];
+            const fe_gv_lod_quadric_t* qb = &mesh->quadrics[b];
+            fe_gv_lod_collapse_t collapse = { INFINITY, FE_GV_LOD_NONE, FE_GV_LOD_NONE };
+            if (!mesh->locked[a]) {
+                collapse.cost = fe_gv_lod_quadric_error(qa, qb, mesh->positions[b]);
+                collapse.from = a; collapse.to = b;
+            }
+            if (!mesh->locked[b]) {
+                double cost = fe_gv_lod_quadric_error(qa, qb, mesh->positions[a]);
+                if (cost < collapse.cost) { collapse.cost = cost; collapse.from = b; collapse.to = a; }
+            }
+            if (collapse.from != FE_GV_LOD_NONE) mesh->collapses[collapse_count++] = collapse;
+        }
+        if (collapse_count == 0) break;
+        qsort(mesh->collapses, collapse_count, sizeof(fe_gv_lod_collapse_t), fe_gv_lod_compare_collapses);
+
+        memset(mesh->touched, 0, mesh->vertex_count);
+        uint32_t applied = 0;
+        for (uint32_t i = 0; i < collapse_count && mesh->alive_count > target; ++i) {
+            uint32_t from = mesh->collapses[i].from, to = mesh->collapses[i].to;
+            if (mesh->touched[from] || mesh->touched[to]) continue;
+            if (!fe_gv_lod_collapse_is_valid(mesh, from, to)) continue;
+
+            for (uint32_t v = 0; v < 2; ++v) {
+                uint32_t center = v == 0 ? from : to;
+                for (uint32_t e = mesh->vertex_offsets[center]; e < mesh->vertex_offsets[center + 1]; ++e) {
+                    const uint32_t* tri = mesh->indices[mesh->vertex_triangles[e]];
+                    if (tri[0] == FE_GV_LOD_NONE) continue;
+                    mesh->touched[tri[0]] = mesh->touched[tri[1]] = mesh->touched[tri[2]] = 1;
+                }
+            }
+            for (uint32_t e = mesh->vertex_offsets[from]; e < mesh->vertex_offsets[from + 1]; ++e) {
+                uint32_t* tri = mesh->indices[mesh->vertex_triangles[e]];
+                if (tri[0] == to || tri[1] == to || tri[2] == to) {
+                    tri[0] = FE_GV_LOD_NONE; // Kenari paylasan ucgen yok olur
+                    mesh->alive_count--;
+                } else {
+                    for (int k = 0; k < 3; ++k) if (tri[k] == from) tri[k] = to;
+                }
+            }
+            fe_gv_lod_add_quadric(&mesh->quadrics[to], &mesh->quadrics[from]);
+            if (mesh->collapses[i].cost > max_cost) max_cost = mesh->collapses[i].cost;
+            applied++;
+        }
+        if (applied == 0) break;
+    }
+    return max_cost;
+}
+
+/**
+ * @brief [begin, end) ucgenlerini merkezlerine gore ikiye bolerek en fazla FE_GV_CLUSTER_MAX_TRIANGLES'lik kumeler uretir.
+ * * Kesim noktasi dengelidir: k kumeye bolunecek aralik k/2 : k - k/2 oraninda bolunur.
+ */
+static void fe_gv_lod_split_clusters(const fe_gv_lod_mesh_t* mesh, uint32_t* order, const float (*centroids)[3],
+                                     uint32_t begin, uint32_t end, fe_gv_lod_group_result_t* result) {
+    uint32_t count = end - begin;
+    if (count <= FE_GV_CLUSTER_MAX_TRIANGLES) {
+        fe_gv_cluster_t* cluster = &result->clusters[result->cluster_count++];
+        memset(cluster, 0, sizeof(*cluster));
+        cluster->first_triangle_idx = result->triangle_count;
+        cluster->triangle_count = count;
+        for (uint32_t i = begin; i < end; ++i) {
+            const uint32_t* v = mesh->indices[order[i]];
+            fe_gpu_triangle_t* tri = &result->triangles[result->triangle_count++];
+            memcpy(tri->p1.v, mesh->positions[v[0]], sizeof(float) * 3);
+            memcpy(tri->p2.v, mesh->positions[v[1]], sizeof(float) * 3);
+            memcpy(tri->p3.v, mesh->positions[v[2]], sizeof(float) * 3);
+            tri->material_id = mesh->materials[order[i]];
+        }
+        fe_gv_cluster_finish(cluster, result->triangles + cluster->first_triangle_idx);
+        return;
+    }
+
+    float lo[3] = { INFINITY, INFINITY, INFINITY }, hi[3] = { -INFINITY, -INFINITY, -INFINITY };
+    for (uint32_t i = begin; i < end; ++i) {
+        for (int axis = 0; axis < 3; ++axis) {
+            lo[axis] = fminf(lo[axis], centroids[order[i]][axis]);
+            hi[axis] = fmaxf(hi[axis], centroids[order[i]][axis]);
+        }
+    }
+    int axis = 0;
+    for (int a = 1; a < 3; ++a) if (hi[a] - lo[a] > hi[axis] - lo[axis]) axis = a;
+
+    uint32_t parts = (count + FE_GV_CLUSTER_MAX_TRIANGLES - 1) / FE_GV_CLUSTER_MAX_TRIANGLES;
+    uint32_t nth = begin + (uint32_t)((uint64_t)count * (parts / 2) / parts);
+
+    // Quickselect: nth'ten oncekiler eksende nth'ten buyuk degildir
+    uint32_t left = begin, right = end - 1;
+    while (left < right) {
+        float pivot = centroids[order[left + (right - left) / 2]][axis];
+        uint32_t i = left, j = right;
+        while (i <= j) {
+            while (centroids[order[i]][axis] < pivot) ++i;
+            while (centroids[order[j]][axis] > pivot) --j;
+            if (i <= j) {
+                uint32_t swap = order[i]; order[i] = order[j]; order[j] = swap;
+                ++i;
+                if (j == 0) break;
+                --j;
+            }
+        }
+        if (nth <= j) right = j;
+        else if (nth >= i) left = i;
+        else break;
+    }
+    fe_gv_lod_split_clusters(mesh, order, centroids, begin, nth, result);
+    fe_gv_lod_split_clusters(mesh, order, centroids, nth, end, result);
+}
+
+static bool fe_gv_lod_simplify_group(const fe_gv_lod_dag_t* dag, const fe_gv_lod_group_t* group, fe_gv_lod_group_result_t* result) {
+    fe_gv_lod_mesh_t mesh;
+    memset(&mesh, 0, sizeof(mesh));
+    bool success = fe_gv_lod_load_mesh(&mesh, dag, group);
+    uint32_t* order = NULL;
+    float (*centroids)[3] = NULL;
+
+    if (success) {
+        uint32_t target = (uint32_t)ceilf((float)mesh.triangle_count * FE_GV_LOD_SIMPLIFY_RATIO);
+        result->error = sqrtf((float)fe_gv_lod_simplify(&mesh, target));
+
+        uint32_t alive = mesh.alive_count;
+        order = (uint32_t*)malloc(sizeof(uint32_t) * (alive ? alive : 1));
+        centroids = (float (*)[3])malloc(sizeof(float[3]) * (mesh.triangle_count ? mesh.triangle_count : 1));
+        result->triangles = (fe_gpu_triangle_t*)malloc(sizeof(fe_gpu_triangle_t) * (alive ? alive : 1));
+        // Dengeli bolmede her kume en az FE_GV_CLUSTER_MAX_TRIANGLES / 2 ucgen alir (tek kume haric)
+        result->clusters = (fe_gv_cluster_t*)malloc(sizeof(fe_gv_cluster_t) * (alive / (FE_GV_CLUSTER_MAX_TRIANGLES / 2) + 2));
+        success = order && centroids && result->triangles && result->clusters;
+        if (success && alive > 0) {
+            uint32_t n = 0;
+            for (uint32_t t = 0; t < mesh.triangle_count; ++t) {
+                const uint32_t* v = mesh.indices[t];
+                if (v[0] == FE_GV_LOD_NONE) continue;
+                order[n++] = t;
+                for (int axis = 0; axis < 3; ++axis) {
+                    centroids[t][axis] = (mesh.positions[v[0]][axis] + mesh.positions[v[1]][axis] + mesh.positions[v[2]][axis]) / 3.0f;
+                }
+            }
+            fe_gv_lod_split_clusters(&mesh, order, (const float (*)[3])centroids, 0, n, result);
+        }
+    }
+
+    free(order);
+    free(centroids);
+    fe_gv_lod_free_mesh(&mesh);
+    return success;
+}
+
+static void fe_gv_lod_simplify_groups_range(void* data, uint32_t begin, uint32_t end) {
+    fe_gv_lod_build_context_t* ctx = (fe_gv_lod_build_context_t*)data;
+    for (uint32_t g = begin; g < end; ++g) {
+        ctx->results[g].is_ok = fe_gv_lod_simplify_group(ctx->dag, &ctx->groups[g], &ctx->results[g]);
+    }
+}
+
+
+// ----------------------------------------------------------------------
+// 5. ARABİRİM UYGULAMALARI
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Kumelerin LOD kurelerini kapsayan kure (kutunun merkezi; yaricap en uzak kureye gore).
+ */
+static void fe_gv_lod_enclose_spheres(const fe_gv_lod_cluster_t* lods, uint32_t count, fe_vec3_t* out_center, float* out_radius) {
+    fe_vec3_t lo = {{ INFINITY, INFINITY, INFINITY }}, hi = {{ -INFINITY, -INFINITY, -INFINITY }};
+    for (uint32_t i = 0; i < count; ++i) {
+        for (int axis = 0; axis < 3; ++axis) {
+            lo.v[axis] = fminf(lo.v[axis], lods[i].center.v[axis] - lods[i].radius);
+            hi.v[axis] = fmaxf(hi.v[axis], lods[i].center.v[axis] + lods[i].radius);
+        }
+    }
+    fe_vec3_t center = {{ 0.5f * (lo.x + hi.x), 0.5f * (lo.y + hi.y), 0.5f * (lo.z + hi.z) }};
+    float radius = 0.0f;
+    for (uint32_t i = 0; i < count; ++i) radius = fmaxf(radius, fe_gv_lod_distance(&center, &lods[i].center) + lods[i].radius);
+    *out_center = center;
+    *out_radius = radius;
+}
+
+/**
+ * Uygulama: fe_gv_lod_build
+ */
+bool fe_gv_lod_build(const fe_gv_cluster_geometry_t* base, fe_gv_lod_dag_t* out_dag) {
+    if (!out_dag) return false;
+    memset(out_dag, 0, sizeof(*out_dag));
+    if (!base || base->cluster_count == 0) return base != NULL;
+
+    fe_gv_lod_dag_t* dag = out_dag;
+    uint32_t triangle_capacity = 0, cluster_capacity = 0, lod_capacity = 0, group_capacity = 0;
+    bool success = fe_gv_lod_reserve((void**)&dag->geometry.triangles, &triangle_capacity, 2 * (uint64_t)base->triangle_count, sizeof(fe_gpu_triangle_t)) &&
+                   fe_gv_lod_reserve((void**)&dag->geometry.clusters, &cluster_capacity, 2 * (uint64_t)base->cluster_count, sizeof(fe_gv_cluster_t)) &&
+                   fe_gv_lod_reserve((void**)&dag->cluster_lod, &lod_capacity, 2 * (uint64_t)base->cluster_count, sizeof(fe_gv_lod_cluster_t));
+    if (!success) {
+        fe_gv_lod_dag_free(dag);
+        return false;
+    }
+
+    // 1. Seviye 0: kumeleyicinin ciktisi, hata 0
+    memcpy(dag->geometry.triangles, base->triangles, sizeof(fe_gpu_triangle_t) * base->triangle_count);
+    memcpy(dag->geometry.clusters, base->clusters, sizeof(fe_gv_cluster_t) * base->cluster_count);
+    dag->geometry.triangle_count = base->triangle_count;
+    dag->geometry.cluster_count = base->cluster_count;
+    for (uint32_t c = 0; c < base->cluster_count; ++c) {
+        const fe_gv_cluster_t* cluster = &base->clusters[c];
+        fe_gv_lod_cluster_t* lod = &dag->cluster_lod[c];
+        lod->center = (fe_vec3_t){{ 0.5f * (cluster->aabb_min.x + cluster->aabb_max.x),
+                                    0.5f * (cluster->aabb_min.y + cluster->aabb_max.y),
+                                    0.5f * (cluster->aabb_min.z + cluster->aabb_max.z) }};
+        lod->radius = 0.5f * fe_gv_lod_distance(&cluster->aabb_min, &cluster->aabb_max);
+        lod->error = 0.0f;
+        lod->group = FE_GV_LOD_NONE;
+        lod->source_group = FE_GV_LOD_NONE;
+        lod->level = 0;
+    }
+    dag->level_offsets[0] = 0;
+    dag->level_offsets[1] = base->cluster_count;
+    dag->level_count = 1;
+
+    // 2. Seviyeler: grupla, sadelestir, yeniden kumele
+    uint32_t* order = NULL;
+    uint32_t* group_sizes = NULL;
+    fe_gv_cluster_t* reordered = NULL;
+    fe_gv_lod_cluster_t* reordered_lod = NULL;
+    fe_gv_lod_group_result_t* results = NULL;
+    while (success && dag->level_count < FE_GV_LOD_MAX_LEVELS) {
+        uint32_t level = dag->level_count - 1;
+        uint32_t first = dag->level_offsets[level];
+        uint32_t count = dag->level_offsets[level + 1] - first;
+        if (count <= 1) break;
+
+        // A. Gruplama ve seviyenin grup sirasina dizilmesi (uyeler ardisik olur)
+        free(order); free(group_sizes); free(reordered); free(reordered_lod);
+        order = (uint32_t*)malloc(sizeof(uint32_t) * count);
+        group_sizes = (uint32_t*)calloc(count, sizeof(uint32_t));
+        reordered = (fe_gv_cluster_t*)malloc(sizeof(fe_gv_cluster_t) * count);
+        reordered_lod = (fe_gv_lod_cluster_t*)malloc(sizeof(fe_gv_lod_cluster_t) * count);
+        uint32_t group_count = 0;
+        success = order && group_sizes && reordered && reordered_lod &&
+                  fe_gv_lod_group_level(dag, first, count, order, group_sizes, &group_count);
+        if (!success) break;
+        for (uint32_t i = 0; i < count; ++i) {
+            reordered[i] = dag->geometry.clusters[first + order[i]];
+            reordered_lod[i] = dag->cluster_lod[first + order[i]];
+        }
+        memcpy(dag->geometry.clusters + first, reordered, sizeof(fe_gv_cluster_t) * count);
+        memcpy(dag->cluster_lod + first, reordered_lod, sizeof(fe_gv_lod_cluster_t) * count);
+        // Ureten gruplarin ilk ciktisi yeni siraya gore (secim gruba bu kumeden iner)
+        for (uint32_t i = first; i < first + count; ++i) {
+            uint32_t source = dag->cluster_lod[i].source_group;
+            if (source != FE_GV_LOD_NONE) dag->groups[source].first_output = FE_GV_LOD_NONE;
+        }
+        for (uint32_t i = first; i < first + count; ++i) {
+            uint32_t source = dag->cluster_lod[i].source_group;
+            if (source != FE_GV_LOD_NONE && dag->groups[source].first_output == FE_GV_LOD_NONE) dag->groups[source].first_output = i;
+        }
+
+        // B. Grup kayitlari
+        uint32_t group_base = dag->group_count;
+        success = fe_gv_lod_reserve((void**)&dag->groups, &group_capacity, (uint64_t)group_base + group_count, sizeof(fe_gv_lod_group_t));
+        if (!success) break;
+        uint32_t member = first;
+        for (uint32_t g = 0; g < group_count; ++g) {
+            fe_gv_lod_group_t* group = &dag->groups[group_base + g];
+            group->first_member = member;
+            group->member_count = group_sizes[g];
+            group->first_output = FE_GV_LOD_NONE;
+            group->error = 0.0f;
+            fe_gv_lod_enclose_spheres(dag->cluster_lod + member, group_sizes[g], &group->center, &group->radius);
+            for (uint32_t m = member; m < member + group_sizes[g]; ++m) {
+                group->error = fmaxf(group->error, dag->cluster_lod[m].error);
+                dag->cluster_lod[m].group = group_base + g;
+            }
+            member += group_sizes[g];
+        }
+        dag->group_count += group_count;
+
+        // C. Gruplarin sadelestirilmesi (paralel)
+        free(results);
+        results = (fe_gv_lod_group_result_t*)calloc(group_count, sizeof(fe_gv_lod_group_result_t));
+        if (!results) { success = false; break; }
+        fe_gv_lod_build_context_t ctx = { dag, dag->groups + group_base, results };
+        fe_job_parallel_for(group_count, 1, fe_gv_lod_simplify_groups_range, &ctx);
+
+        // D. Yeni seviye: grup sirasiyla eklenir
+        uint64_t new_triangles = dag->geometry.triangle_count, new_clusters = dag->geometry.cluster_count;
+        for (uint32_t g = 0; g < group_count; ++g) {
+            success = success && results[g].is_ok;
+            new_triangles += results[g].triangle_count;
+            new_clusters += results[g].cluster_count;
+        }
+        success = success &&
+                  fe_gv_lod_reserve((void**)&dag->geometry.triangles, &triangle_capacity, new_triangles, sizeof(fe_gpu_triangle_t)) &&
+                  fe_gv_lod_reserve((void**)&dag->geometry.clusters, &cluster_capacity, new_clusters, sizeof(fe_gv_cluster_t)) &&
+                  fe_gv_lod_reserve((void**)&dag->cluster_lod, &lod_capacity, new_clusters, sizeof(fe_gv_lod_cluster_t));
+        for (uint32_t g = 0; g < group_count; ++g) {
+            fe_gv_lod_group_result_t* result = &results[g];
+            fe_gv_lod_group_t* group = &dag->groups[group_base + g];
+            if (success) {
+                // Hata monoton: uyelerin hatasindan kucuk olamaz
+                group->error = fmaxf(group->error, result->error);
+                group->first_output = result->cluster_count > 0 ? dag->geometry.cluster_count : FE_GV_LOD_NONE;
+                memcpy(dag->geometry.triangles + dag->geometry.triangle_count, result->triangles, sizeof(fe_gpu_triangle_t) * result->triangle_count);
+                for (uint32_t c = 0; c < result->cluster_count; ++c) {
+                    fe_gv_cluster_t* cluster = &dag->geometry.clusters[dag->geometry.cluster_count];
+                    fe_gv_lod_cluster_t* lod = &dag->cluster_lod[dag->geometry.cluster_count];
+                    *cluster = result->clusters[c];
+                    cluster->first_triangle_idx += dag->geometry.triangle_count;
+                    lod->center = group->center;
+                    lod->radius = group->radius;
+                    lod->error = group->error;
+                    lod->group = FE_GV_LOD_NONE;
+                    lod->source_group = group_base + g;
+                    lod->level = level + 1;
+                    dag->geometry.cluster_count++;
+                }
+                dag->geometry.triangle_count += result->triangle_count;
+            }
+            free(result->triangles);
+            free(result->clusters);
+        }
+        if (!success) break;
+
+        uint32_t next_count = dag->geometry.cluster_count - dag->level_offsets[level + 1];
+        dag->level_offsets[level + 2] = dag->geometry.cluster_count;
+        dag->level_count++;
+        FE_LOG_DEBUG("GeometryV LOD seviye %u: %u grup, %u -> %u kume.", level + 1, group_count, count, next_count);
+        if ((float)next_count > (float)count * FE_GV_LOD_MIN_REDUCTION) {
+            FE_LOG_WARN("GeometryV LOD: sadelestirme tikandi (%u -> %u kume); %u kok kume ile duruldu.", count, next_count, next_count);
+            break;
+        }
+    }
+    free(order);
+    free(group_sizes);
+    free(reordered);
+    free(reordered_lod);
+    free(results);
+
+    if (!success) {
+        FE_LOG_ERROR("GeometryV LOD DAG insasi icin bellek yetersiz.");
+        fe_gv_lod_dag_free(dag);
+        return false;
+    }
+    FE_LOG_DEBUG("GeometryV LOD DAG: %u seviye, %u kume, %u grup, %u ucgen.",
+                 dag->level_count, dag->geometry.cluster_count, dag->group_count, dag->geometry.triangle_count);
+    return true;
+}
+
+/**
+ * Uygulama: fe_gv_lod_dag_free
+ */
+void fe_gv_lod_dag_free(fe_gv_lod_dag_t* dag) {
+    if (!dag) return;
+    fe_gv_cluster_geometry_free(&dag->geometry);
+    free(dag->cluster_lod);
+    free(dag->groups);
+    memset(dag, 0, sizeof(*dag));
+}
+
+static inline float fe_gv_lod_projected_error(const fe_vec3_t* center, float radius, float error,
+                                              const fe_vec3_t* eye, float projection, float near_plane) {
+    float distance = fe_gv_lod_distance(center, eye) - radius;
+    return error * projection / (distance > near_plane ? distance : near_plane);
+}
+
+/**
+ * @brief Kumeyi secer veya (hatasi esigi asiyorsa) ureten grubunu gezinme yiginina ekler.
+ * * Bir grubun tum ciktilari ayni kure ve hatayi tasir; grup sadece ilk ciktisindan inilerek bir kez ziyaret edilir.
+ */
+static bool fe_gv_lod_visit_cluster(const fe_gv_lod_dag_t* dag, uint32_t cluster, const fe_vec3_t* eye, float projection,
+                                    float near_plane, const fe_gv_lod_settings_t* settings, fe_gv_lod_selection_t* selection, uint32_t* queue_size) {
+    const fe_gv_lod_cluster_t* lod = &dag->cluster_lod[cluster];
+    float error = lod->source_group == FE_GV_LOD_NONE ? 0.0f :
+                  fe_gv_lod_projected_error(&lod->center, lod->radius, lod->error, eye, projection, near_plane);
+    bool resident = lod->source_group == FE_GV_LOD_NONE || !settings->group_resident || settings->group_resident[lod->source_group];
+    if (error <= settings->error_threshold || !resident) {
+        if (!fe_gv_lod_reserve((void**)&selection->clusters, &selection->capacity, (uint64_t)selection->cluster_count + 1, sizeof(uint32_t))) return false;
+        selection->clusters[selection->cluster_count++] = cluster;
+        selection->triangle_count += dag->geometry.clusters[cluster].triangle_count;
+        // Grubun tum ciktilari ayni karari verir; eksik grup bir kez (ilk ciktidan) bildirilir
+        if (!resident && dag->groups[lod->source_group].first_output == cluster) {
+            if (!fe_gv_lod_reserve((void**)&selection->missing, &selection->missing_capacity, (uint64_t)selection->missing_count + 1, sizeof(fe_gv_lod_missing_group_t))) return false;
+            selection->missing[selection->missing_count].group = lod->source_group;
+            selection->missing[selection->missing_count].projected_error = error;
+            selection->missing_count++;
+        }
+        return true;
+    }
+    if (dag->groups[lod->source_group].first_output != cluster) return true;
+    if (!fe_gv_lod_reserve((void**)&selection->groups, &selection->group_capacity, (uint64_t)*queue_size + 1, sizeof(uint32_t))) return false;
+    selection->groups[(*queue_size)++] = lod->source_group;
+    return true;
+}
+
+/**
+ * Uygulama: fe_gv_lod_select
+ */
+bool fe_gv_lod_select(const fe_gv_lod_dag_t* dag, const fe_camera3d_t* camera,
+                      const fe_gv_lod_settings_t* settings, fe_gv_lod_selection_t* selection) {
+    if (!selection) return false;
+    selection->cluster_count = 0;
+    selection->triangle_count = 0;
+    selection->visited_groups = 0;
+    selection->missing_count = 0;
+    if (!dag || !camera || !settings || dag->level_count == 0) return dag != NULL && camera != NULL && settings != NULL;
+
+    // Dunya uzayinda 1 birimlik hatanin 1 birim uzakliktaki piksel karsiligi
+    float projection = settings->screen_height / (2.0f * tanf(0.5f * camera->fov_y));
+    float near_plane = camera->near_plane > 0.0f ? camera->near_plane : 1e-3f;
+    const fe_vec3_t* eye = &camera->position;
+
+    // Kokler (son seviye) her zaman degerlendirilir; ebeveyn hatalari sonsuz sayilir
+    uint32_t queue_size = 0;
+    for (uint32_t c = dag->level_offsets[dag->level_count - 1]; c < dag->level_offsets[dag->level_count]; ++c) {
+        if (!fe_gv_lod_visit_cluster(dag, c, eye, projection, near_plane, settings, selection, &queue_size)) return false;
+    }
+    // Inilen grubun hatasi esigi asiyor: uyeleri (bir alt seviye) degerlendirilir. Kuyruk bosaltilmaz;
+    // sonunda inilen tum gruplari tutar (akis bu gruplarin sayfalarini sicak tutar)
+    while (selection->visited_groups < queue_size) {
+        const fe_gv_lod_group_t* group = &dag->groups[selection->groups[selection->visited_groups++]];
+        for (uint32_t m = group->first_member; m < group->first_member + group->member_count; ++m) {
+            if (!fe_gv_lod_visit_cluster(dag, m, eye, projection, near_plane, settings, selection, &queue_size)) return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Uygulama: fe_gv_lod_selection_free
+ */
+void fe_gv_lod_selection_free(fe_gv_lod_selection_t* selection) {
+    if (!selection) return;
+    free(selection->clusters);
+    free(selection->groups);
+    free(selection->missing);
+    memset(selection, 0, sizeof(*selection));
+}
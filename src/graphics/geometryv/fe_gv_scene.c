@@ -1,6 +1,11 @@
 // src/graphics/geometryv/fe_gv_scene.c
 
 #include "graphics/geometryv/fe_gv_scene.h"
+#include "graphics/geometryv/fe_gv_cluster_builder.h"
+#include "graphics/geometryv/fe_gv_bvh.h"
+#include "graphics/geometryv/fe_gv_lod.h"
+#include "graphics/geometryv/fe_gv_stream.h"
+#include "graphics/fe_culling.h"
 #include "graphics/opengl/fe_gl_device.h" // Buffer yönetimi için
 #include "graphics/opengl/fe_gl_commands.h"
 #include "utils/fe_logger.h"
@@ -13,46 +18,53 @@
 // 1. DAHİLİ YARDIMCI FONKSİYONLAR
 // ----------------------------------------------------------------------
 
-// Tahmini maksimum kaynak boyutları (Gerçek uygulamada dinamik olmalıdır)
+// Triangle SSBO sabit boyuttadir; Cluster/Hierarchy SSBO'lari bu kapasiteyle baslar ve gerektikce buyur
 #define MAX_TRIANGLES 2000000 
 #define MAX_CLUSTERS 20000
 
-// Basit bir Üçgen Yapısı (GPU'ya gönderilecek)
-typedef struct fe_gpu_triangle {
-    fe_vec3_t p1, p2, p3; // 3 Köşe Pozisyonu
-    // fe_vec3_t normal; // Normal verisi
-    uint32_t material_id;
-} fe_gpu_triangle_t;
-
 /**
- * @brief fe_mesh_t'deki verileri fe_gpu_triangle_t yapısına dönüştürür.
- * * NOTE: Bu, mesh'lerin CPU'ya geri okunmasını gerektirir, bu da pahalıdır.
- * * Gerçek motorlar doğrudan GPU'da dönüştürme yapar.
+ * @brief Akisin yukleme geri cagrisi: sayfanin ucgenlerini Triangle SSBO'daki yuvasina yazar.
  */
-static void fe_gv_scene_process_mesh(const fe_mesh_t* mesh, fe_gpu_triangle_t* triangle_list, uint32_t* current_triangle_count) {
-    // Bu sadece bir simülasyondur. fe_mesh_t'nin nasıl göründüğüne bağlıdır.
-    // Varsayalım ki her mesh'in kendi vertex/index verisi var.
-    
-    // Basitlik için rastgele 100 üçgen eklendiği varsayılır:
-    uint32_t start_idx = *current_triangle_count;
-    uint32_t num_tris = 100; // Mesh'teki gercek ucgen sayisi olmalidir
+static void fe_gv_scene_upload_page(void* user_data, uint32_t slot, const fe_gpu_triangle_t* triangles, uint32_t triangle_count) {
+    fe_gv_scene_t* scene = (fe_gv_scene_t*)user_data;
+    fe_gl_device_update_buffer(scene->triangle_ssbo, sizeof(fe_gpu_triangle_t) * (size_t)slot * FE_GV_STREAM_PAGE_TRIANGLES,
+                               sizeof(fe_gpu_triangle_t) * triangle_count, triangles);
+}
 
-    if (start_idx + num_tris > MAX_TRIANGLES) {
-        num_tris = MAX_TRIANGLES - start_idx;
-        FE_LOG_WARN("MAX_TRIANGLES sinirina ulasildi. Mesh'in bir kismi atlandi.");
-    }
+/**
+ * @brief Cluster SSBO'yu (ve N kumelik agacin dugumlerine yeten Hierarchy SSBO'yu) en az count kumeye buyutur.
+ * * Tamponlar yeniden olusturulur; icerikleri korunmaz, cagiran hemen yeniden yazar.
+ * @return Tamponlar olusturulamazsa false (eski tamponlar ve kapasite yerinde kalir).
+ */
+static bool fe_gv_scene_reserve_clusters(fe_gv_scene_t* scene, uint32_t count) {
+    if (count <= scene->cluster_capacity) return true;
 
-    for (uint32_t i = 0; i < num_tris; ++i) {
-        // Rastgele pozisyon atama (Sadece test için)
-        triangle_list[start_idx + i].p1 = (fe_vec3_t){ (float)i, 0, 0 };
-        triangle_list[start_idx + i].p2 = (fe_vec3_t){ (float)i + 1, 0, 0 };
-        triangle_list[start_idx + i].p3 = (fe_vec3_t){ (float)i, 1, 0 };
-        triangle_list[start_idx + i].material_id = 1;
+    fe_buffer_id_t clusters = fe_gl_device_create_buffer(sizeof(fe_gv_cluster_t) * (size_t)count, NULL, FE_BUFFER_USAGE_STATIC);
+    fe_buffer_id_t nodes = fe_gl_device_create_buffer(sizeof(fe_gv_bvh_node_t) * (size_t)count, NULL, FE_BUFFER_USAGE_STATIC);
+    if (clusters == 0 || nodes == 0) {
+        FE_LOG_ERROR("GeometryV kume tamponlari %u kumeye buyutulemedi.", count);
+        fe_gl_device_destroy_buffer(clusters);
+        fe_gl_device_destroy_buffer(nodes);
+        return false;
     }
-    
-    *current_triangle_count += num_tris;
+    fe_gl_device_destroy_buffer(scene->cluster_ssbo);
+    fe_gl_device_destroy_buffer(scene->hierarchy.hierarchy_ssbo);
+    scene->cluster_ssbo = clusters;
+    scene->hierarchy.hierarchy_ssbo = nodes;
+    scene->cluster_capacity = count;
+    FE_LOG_DEBUG("GeometryV kume tamponlari %u kumeye buyutuldu.", count);
+    return true;
 }
 
+/**
+ * @brief Kumelere bagli hiyerarsiyi gecersiz kilar (kume listesi degisti).
+ */
+static void fe_gv_scene_reset_hierarchy(fe_gv_scene_t* scene) {
+    fe_gv_bvh_free_nodes(scene->hierarchy.nodes);
+    scene->hierarchy.nodes = NULL;
+    scene->hierarchy.node_count = 0;
+    scene->hierarchy.sah_cost = 0.0f;
+}
 
 // ----------------------------------------------------------------------
 // 2. ARABİRİM UYGULAMALARI
@@ -76,15 +88,16 @@ fe_gv_scene_t* fe_gv_scene_init(void) {
     scene->cluster_ssbo = fe_gl_device_create_buffer(
         sizeof(fe_gv_cluster_t) * MAX_CLUSTERS, NULL, FE_BUFFER_USAGE_STATIC);
         
-    // Hiyerarsi yapisi (Başlangıçta boş)
+    // Hiyerarsi yapisi (Başlangıçta boş; N kumelik agacta en fazla N - 1 dugum)
     scene->hierarchy.hierarchy_ssbo = fe_gl_device_create_buffer(
-        sizeof(uint32_t) * MAX_CLUSTERS * 4, NULL, FE_BUFFER_USAGE_STATIC);
+        sizeof(fe_gv_bvh_node_t) * MAX_CLUSTERS, NULL, FE_BUFFER_USAGE_STATIC);
 
     if (scene->triangle_ssbo == 0 || scene->cluster_ssbo == 0 || scene->hierarchy.hierarchy_ssbo == 0) {
         FE_LOG_FATAL("GeometryV SSBO'lari olusturulamadi.");
         fe_gv_scene_shutdown(scene);
         return NULL;
     }
+    scene->cluster_capacity = MAX_CLUSTERS;
     
     FE_LOG_INFO("GeometryV GPU kaynaklari hazir.");
     return scene;
@@ -103,6 +116,11 @@ void fe_gv_scene_shutdown(fe_gv_scene_t* scene) {
     fe_gl_device_destroy_buffer(scene->cluster_ssbo);
     fe_gl_device_destroy_buffer(scene->hierarchy.hierarchy_ssbo);
 
+    // CPU kopyalari
+    fe_gv_stream_close(scene->stream);
+    free(scene->clusters);
+    fe_gv_bvh_free_nodes(scene->hierarchy.nodes);
+
     free(scene);
     FE_LOG_DEBUG("GeometryV Scene kapatildi.");
 }
@@ -117,56 +135,47 @@ void fe_gv_scene_load_geometry(fe_gv_scene_t* scene,
 
     FE_LOG_INFO("GeometryV geometri yukleniyor ve kumeleniyor (%u mesh)...", mesh_count);
 
-    // 1. Tüm sahne üçgenlerini CPU'da bir araya topla
-    fe_gpu_triangle_t* all_triangles = (fe_gpu_triangle_t*)calloc(MAX_TRIANGLES, sizeof(fe_gpu_triangle_t));
-    if (!all_triangles) {
-        FE_LOG_FATAL("Ucgen verileri icin bellek yetersiz.");
+    // 1. Mesh'lerin CPU verisini okuyup kumele (ucgenler kume sirasina dizilir)
+    fe_gv_cluster_geometry_t geometry;
+    if (!fe_gv_cluster_build(meshes, mesh_count, &geometry)) {
+        FE_LOG_FATAL("GeometryV geometrisi kumelenemedi.");
         return;
     }
-    
-    uint32_t current_tri_count = 0;
-    for (uint32_t i = 0; i < mesh_count; ++i) {
-        // Bu fonksiyon, mesh'ten üçgen verilerini çıkarır
-        fe_gv_scene_process_mesh(meshes[i], all_triangles, &current_tri_count);
-    }
-    scene->total_triangle_count = current_tri_count;
-    
-    // 2. Üçgen verilerini GPU'ya yükle (Triangle SSBO'yu güncelle)
-    fe_gl_device_update_buffer(scene->triangle_ssbo, all_triangles, 
-                               sizeof(fe_gpu_triangle_t) * scene->total_triangle_count);
 
-    // 3. Kümeleme (Clustering)
-    // Gerçek uygulamada, bu aşama GPU'da Compute Shader ile yapılır.
-    // Basitlik için, burada her 100 üçgende bir küme oluşturulduğu varsayılır.
-    
-    fe_gv_cluster_t* cluster_list = (fe_gv_cluster_t*)calloc(MAX_CLUSTERS, sizeof(fe_gv_cluster_t));
-    uint32_t current_cluster_count = 0;
-    
-    uint32_t cluster_size = 100; 
-    for (uint32_t i = 0; i < current_tri_count; i += cluster_size) {
-        if (current_cluster_count >= MAX_CLUSTERS) break;
+    // Akis aciksa birakilir; sahne artik bu geometriyi cizer
+    fe_gv_stream_close(scene->stream);
+    scene->stream = NULL;
 
-        cluster_list[current_cluster_count].first_triangle_idx = i;
-        cluster_list[current_cluster_count].triangle_count = (i + cluster_size > current_tri_count) ? 
-            (current_tri_count - i) : cluster_size;
-        
-        // AABB hesaplama simülasyonu
-        cluster_list[current_cluster_count].aabb_min = (fe_vec3_t){-10.0f, -10.0f, -10.0f};
-        cluster_list[current_cluster_count].aabb_max = (fe_vec3_t){ 10.0f,  10.0f,  10.0f};
-        
-        current_cluster_count++;
+    // 2. Tampon sinirlari: kume tamponlari buyutulur, Triangle SSBO'ya sigmayan kumeler butun olarak atlanir
+    uint32_t cluster_count = geometry.cluster_count;
+    if (!fe_gv_scene_reserve_clusters(scene, cluster_count)) cluster_count = scene->cluster_capacity;
+    while (cluster_count > 0 && geometry.clusters[cluster_count - 1].first_triangle_idx +
+                                geometry.clusters[cluster_count - 1].triangle_count > MAX_TRIANGLES) {
+        cluster_count--;
     }
-    scene->cluster_count = current_cluster_count;
+    if (cluster_count < geometry.cluster_count) {
+        FE_LOG_WARN("MAX_TRIANGLES veya kume tamponu sinirina ulasildi. %u kume atlandi.", geometry.cluster_count - cluster_count);
+    }
+    scene->cluster_count = cluster_count;
+    scene->total_triangle_count = cluster_count > 0 ?
+        geometry.clusters[cluster_count - 1].first_triangle_idx + geometry.clusters[cluster_count - 1].triangle_count : 0;
 
-    // 4. Küme verilerini GPU'ya yükle (Cluster SSBO'yu güncelle)
-    fe_gl_device_update_buffer(scene->cluster_ssbo, cluster_list, 
-                               sizeof(fe_gv_cluster_t) * scene->cluster_count);
+    // 3. Üçgen ve küme verilerini GPU'ya yükle (Triangle ve Cluster SSBO'larını güncelle)
+    fe_gl_device_update_buffer(scene->triangle_ssbo, 0,
+                               sizeof(fe_gpu_triangle_t) * scene->total_triangle_count, geometry.triangles);
+    fe_gl_device_update_buffer(scene->cluster_ssbo, 0,
+                               sizeof(fe_gv_cluster_t) * scene->cluster_count, geometry.clusters);
 
     FE_LOG_INFO("Geometri kumelendi. Toplam Ucgen: %u, Kume Sayisi: %u", 
                 scene->total_triangle_count, scene->cluster_count);
-    
-    free(all_triangles);
-    free(cluster_list);
+
+    // 4. Kumelerin CPU kopyasini hiyerarsi insasi icin sakla; eski hiyerarsi artik gecersiz
+    free(scene->clusters);
+    scene->clusters = geometry.clusters;
+    geometry.clusters = NULL;
+    fe_gv_scene_reset_hierarchy(scene);
+
+    fe_gv_cluster_geometry_free(&geometry);
 }
 
 /**
@@ -182,16 +191,42 @@ void fe_gv_scene_build_hierarchy(fe_gv_scene_t* scene) {
         return;
     }
     
-    // Gerçek uygulamada: Bu, Küme SSBO'sunu girdi olarak alan bir Compute Shader tarafından yürütülür
-    // ve Hiyerarşi (BVH) düğüm yapısını fe_gv_hierarchy_t->hierarchy_ssbo'ya yazar.
-    
-    fe_gl_cmd_bind_ssbo(scene->cluster_ssbo, 0);
-    fe_gl_cmd_bind_ssbo(scene->hierarchy.hierarchy_ssbo, 1);
-    fe_shader_run_compute("bvh_builder.comp", dispatch_x, dispatch_y, 1);
-    
-    // Simülasyon: 
-    scene->hierarchy.node_count = scene->cluster_count * 2 - 1; 
-    FE_LOG_DEBUG("Hiyerarsi insasi tamamlandi. Toplam Dugum Sayisi: %u", scene->hierarchy.node_count);
+    // 1. Kume AABB'leri uzerinde binned-SAH BVH (CPU, is sistemiyle paralel)
+    fe_gv_bvh_t bvh;
+    if (!fe_gv_bvh_build(scene->clusters, scene->cluster_count, &bvh)) {
+        FE_LOG_ERROR("Kume hiyerarsisi insa edilemedi.");
+        return;
+    }
+
+    // 2. Kumeleri yaprak sirasina diz: yaprak araliklari dogrudan Cluster SSBO indeksi olur
+    fe_gv_cluster_t* ordered = (fe_gv_cluster_t*)malloc(sizeof(fe_gv_cluster_t) * scene->cluster_count);
+    if (!ordered) {
+        FE_LOG_ERROR("Kume hiyerarsisi icin bellek yetersiz.");
+        fe_gv_bvh_free(&bvh);
+        return;
+    }
+    for (uint32_t i = 0; i < scene->cluster_count; i++) {
+        ordered[i] = scene->clusters[bvh.cluster_order[i]];
+    }
+    free(scene->clusters);
+    scene->clusters = ordered;
+
+    // 3. Cluster ve Hierarchy SSBO'larini guncelle
+    fe_gl_device_update_buffer(scene->cluster_ssbo, 0,
+                               sizeof(fe_gv_cluster_t) * scene->cluster_count, scene->clusters);
+    fe_gl_device_update_buffer(scene->hierarchy.hierarchy_ssbo, 0,
+                               sizeof(fe_gv_bvh_node_t) * bvh.node_count, bvh.nodes);
+
+    // 4. Dugumlerin CPU kopyasini sakla (sahiplik sahneye gecer)
+    fe_gv_bvh_free_nodes(scene->hierarchy.nodes);
+    scene->hierarchy.nodes = bvh.nodes;
+    scene->hierarchy.node_count = bvh.node_count;
+    scene->hierarchy.sah_cost = fe_gv_bvh_sah_cost(bvh.nodes, bvh.node_count);
+    bvh.nodes = NULL;
+    fe_gv_bvh_free(&bvh);
+
+    FE_LOG_INFO("Hiyerarsi insasi tamamlandi. Toplam Dugum Sayisi: %u, SAH maliyeti: %.2f",
+                scene->hierarchy.node_count, scene->hierarchy.sah_cost);
 }
 
 /**
@@ -209,4 +244,89 @@ void fe_gv_scene_update(fe_gv_scene_t* scene,
     // TODO: Matrisleri global Uniform Buffer'a (UBO) yükle
 
     FE_LOG_TRACE("GeometryV Scene matrisleri guncellendi.");
+}
+
+/**
+ * Uygulama: fe_gv_scene_open_stream
+ */
+bool fe_gv_scene_open_stream(fe_gv_scene_t* scene, const char* path, uint64_t budget_bytes) {
+    if (!scene || !path) return false;
+
+    fe_gv_stream_close(scene->stream);
+    scene->stream = NULL;
+
+    // Butce Triangle SSBO'ya sigan yuva sayisiyla sinirlidir
+    uint64_t max_budget = (uint64_t)(MAX_TRIANGLES / FE_GV_STREAM_PAGE_TRIANGLES) * FE_GV_STREAM_PAGE_SIZE;
+    if (budget_bytes > max_budget) {
+        FE_LOG_WARN("Akis butcesi Triangle SSBO'ya sigmiyor; %llu bayta indirildi.", (unsigned long long)max_budget);
+        budget_bytes = max_budget;
+    }
+
+    free(scene->clusters);
+    scene->clusters = NULL;
+    scene->cluster_count = 0;
+    scene->total_triangle_count = 0;
+    scene->cut_overflow_warned = false;
+    fe_gv_scene_reset_hierarchy(scene);
+
+    // Sabit (kok) sayfalar acilista yuklenir ve hemen GPU'ya gider
+    scene->stream = fe_gv_stream_open(path, budget_bytes, fe_gv_scene_upload_page, scene);
+    if (!scene->stream) {
+        FE_LOG_ERROR("GeometryV akisi acilamadi: %s", path);
+        return false;
+    }
+
+    // Kesit her karede bu diziye ve Cluster SSBO'ya cozulur; ikisi de butcenin verebilecegi en buyuk kesite gore ayrilir
+    fe_gv_scene_reserve_clusters(scene, fe_gv_stream_max_cut_clusters(scene->stream));
+    scene->clusters = (fe_gv_cluster_t*)malloc(sizeof(fe_gv_cluster_t) * scene->cluster_capacity);
+    if (!scene->clusters) {
+        fe_gv_stream_close(scene->stream);
+        scene->stream = NULL;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Uygulama: fe_gv_scene_update_stream
+ */
+void fe_gv_scene_update_stream(fe_gv_scene_t* scene, const struct fe_camera3d* camera, const struct fe_gv_lod_settings* settings) {
+    if (!scene || !scene->stream || !camera || !settings) return;
+
+    if (!fe_gv_stream_update(scene->stream, camera, settings)) {
+        FE_LOG_ERROR("GeometryV akisi guncellenemedi (bellek yetersiz).");
+        return;
+    }
+    // Kapasite acilista en buyuk kesite buyutuldu; buyutme basarisiz olduysa fazlasi atilir
+    if (scene->stream->selection.cluster_count > scene->cluster_capacity && !scene->cut_overflow_warned) {
+        FE_LOG_WARN("GeometryV kesiti kume tamponunu asiyor (%u > %u); fazlasi cizilmeyecek.",
+                    scene->stream->selection.cluster_count, scene->cluster_capacity);
+        scene->cut_overflow_warned = true;
+    }
+
+    scene->cluster_count = fe_gv_stream_resolve(scene->stream, scene->clusters, scene->cluster_capacity);
+    scene->total_triangle_count = 0;
+    for (uint32_t i = 0; i < scene->cluster_count; ++i) scene->total_triangle_count += scene->clusters[i].triangle_count;
+    fe_gl_device_update_buffer(scene->cluster_ssbo, 0, sizeof(fe_gv_cluster_t) * scene->cluster_count, scene->clusters);
+    fe_gv_scene_reset_hierarchy(scene);
+}
+
+/**
+ * Uygulama: fe_gv_scene_cull_clusters
+ */
+uint32_t fe_gv_scene_cull_clusters(const fe_gv_scene_t* scene, const struct fe_frustum* frustum,
+                                   const struct fe_depth_pyramid* occlusion, uint32_t* out_indices) {
+    if (!scene || !frustum || !out_indices || scene->cluster_count == 0) return 0;
+
+    // aabb_min ve aabb_max kumenin ilk 6 float'i: kume dizisi dogrudan kutu kaydi dizisi olarak okunur
+    const float* boxes = &scene->clusters[0].aabb_min.x;
+    const uint32_t stride = (uint32_t)(sizeof(fe_gv_cluster_t) / sizeof(float));
+
+    uint32_t visible = fe_cull_frustum_aabbs(frustum, boxes, stride, scene->cluster_count, out_indices);
+    if (occlusion && visible > 0) {
+        visible = fe_cull_occlusion_aabbs(occlusion, boxes, stride, out_indices, visible, out_indices);
+    }
+
+    FE_LOG_TRACE("GeometryV kume ayiklama: %u / %u kume gorunur.", visible, scene->cluster_count);
+    return visible;
 }
\ No newline at end of file
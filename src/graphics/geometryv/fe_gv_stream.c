@@ -0,0 +1,668 @@
+// src/graphics/geometryv/fe_gv_stream.c
+
+#include "graphics/geometryv/fe_gv_stream.h"
+#include "utils/fe_logger.h"
+#include <stdlib.h> // malloc, calloc, realloc, qsort, free için
+#include <string.h> // memset, memcpy için
+
+
+// ----------------------------------------------------------------------
+// 1. DAHİLİ YARDIMCILAR
+// ----------------------------------------------------------------------
+
+// Sayfa durumlari (fe_gv_stream_t::page_state)
+#define FE_GV_STREAM_PAGE_ABSENT   0
+#define FE_GV_STREAM_PAGE_PENDING  1
+#define FE_GV_STREAM_PAGE_RESIDENT 2
+
+// Tek okuma/yazma cagrisinin en fazla boyutu (buyuk metadata dizileri parcalanir)
+#define FE_GV_STREAM_IO_CHUNK (1u << 30)
+
+static bool fe_gv_stream_write_all(fe_file_handle_t file, const void* data, uint64_t size) {
+    const uint8_t* bytes = (const uint8_t*)data;
+    while (size > 0) {
+        size_t chunk = size > FE_GV_STREAM_IO_CHUNK ? FE_GV_STREAM_IO_CHUNK : (size_t)size;
+        int64_t written = fe_write(file, bytes, chunk);
+        if (written <= 0) return false;
+        bytes += written;
+        size -= (uint64_t)written;
+    }
+    return true;
+}
+
+static bool fe_gv_stream_read_all(fe_file_handle_t file, void* data, uint64_t size, uint64_t offset) {
+    uint8_t* bytes = (uint8_t*)data;
+    while (size > 0) {
+        size_t chunk = size > FE_GV_STREAM_IO_CHUNK ? FE_GV_STREAM_IO_CHUNK : (size_t)size;
+        int64_t read = fe_read_at(file, bytes, chunk, offset);
+        if (read <= 0) return false;
+        bytes += read;
+        size -= (uint64_t)read;
+        offset += (uint64_t)read;
+    }
+    return true;
+}
+
+static uint64_t fe_gv_stream_metadata_size(const fe_gv_stream_header_t* header) {
+    return sizeof(fe_gv_stream_header_t) + sizeof(uint32_t) * (FE_GV_LOD_MAX_LEVELS + 1)
+         + (uint64_t)header->cluster_count * (sizeof(fe_gv_cluster_t) + sizeof(fe_gv_lod_cluster_t))
+         + (uint64_t)header->group_count * sizeof(fe_gv_lod_group_t)
+         + (uint64_t)header->page_count * sizeof(fe_gv_stream_page_t);
+}
+
+static inline void fe_gv_stream_group_pages(const fe_gv_stream_t* stream, uint32_t group, uint32_t* first, uint32_t* last) {
+    const fe_gv_lod_group_t* g = &stream->dag.groups[group];
+    *first = stream->cluster_page[g->first_member];
+    *last = stream->cluster_page[g->first_member + g->member_count - 1];
+}
+
+
+// ----------------------------------------------------------------------
+// 2. DOSYA YAZIMI (CEVRIMDISI)
+// ----------------------------------------------------------------------
+
+/**
+ * Uygulama: fe_gv_stream_write
+ */
+bool fe_gv_stream_write(const fe_gv_lod_dag_t* dag, const char* path) {
+    if (!dag || !path || dag->level_count == 0) return false;
+
+    const fe_gv_cluster_geometry_t* geometry = &dag->geometry;
+    uint32_t cluster_count = geometry->cluster_count;
+    bool ok = false;
+    fe_file_handle_t file = FE_INVALID_HANDLE;
+    fe_gv_stream_page_t* pages = NULL;
+    uint32_t page_count = 0, page_capacity = 0;
+    fe_gv_cluster_t* clusters = (fe_gv_cluster_t*)malloc(sizeof(fe_gv_cluster_t) * (cluster_count > 0 ? cluster_count : 1));
+    uint8_t* page_buffer = (uint8_t*)calloc(1, FE_GV_STREAM_PAGE_SIZE);
+    if (!clusters || !page_buffer) goto cleanup;
+
+    // A. Paketleme: kumeler DAG sirasiyla; sigan grup bolunmez, sigmayan kume yeni sayfaya gecer
+    uint32_t used = 0;
+    for (uint32_t c = 0; c < cluster_count; ++c) {
+        uint32_t triangles = geometry->clusters[c].triangle_count;
+        uint32_t group = dag->cluster_lod[c].group;
+        if (triangles > FE_GV_STREAM_PAGE_TRIANGLES) {
+            FE_LOG_ERROR("Kume %u (%u ucgen) bir akis sayfasina sigmiyor.", c, triangles);
+            goto cleanup;
+        }
+        bool new_page = page_count == 0 || used + triangles > FE_GV_STREAM_PAGE_TRIANGLES;
+        if (!new_page && used > 0 && group != FE_GV_LOD_NONE && dag->groups[group].first_member == c) {
+            uint32_t group_triangles = 0;
+            for (uint32_t m = c; m < c + dag->groups[group].member_count; ++m) group_triangles += geometry->clusters[m].triangle_count;
+            new_page = used + group_triangles > FE_GV_STREAM_PAGE_TRIANGLES && group_triangles <= FE_GV_STREAM_PAGE_TRIANGLES;
+        }
+        if (new_page) {
+            if (page_count == page_capacity) {
+                uint32_t capacity = page_capacity ? page_capacity * 2 : 256;
+                fe_gv_stream_page_t* grown = (fe_gv_stream_page_t*)realloc(pages, sizeof(fe_gv_stream_page_t) * capacity);
+                if (!grown) goto cleanup;
+                pages = grown;
+                page_capacity = capacity;
+            }
+            fe_gv_stream_page_t* fresh = &pages[page_count++];
+            memset(fresh, 0, sizeof(*fresh));
+            fresh->first_cluster = c;
+            fresh->first_group = FE_GV_LOD_NONE;
+            used = 0;
+        }
+
+        fe_gv_stream_page_t* page = &pages[page_count - 1];
+        clusters[c] = geometry->clusters[c];
+        clusters[c].first_triangle_idx = used; // Sayfa ici
+        page->cluster_count++;
+        page->triangle_count += triangles;
+        used += triangles;
+        if (group == FE_GV_LOD_NONE) {
+            page->pinned = 1; // Kok
+        } else if (page->first_group == FE_GV_LOD_NONE) {
+            page->first_group = group;
+            page->group_count = 1;
+        } else if (group >= page->first_group) {
+            if (group >= page->first_group + page->group_count) page->group_count = group - page->first_group + 1;
+        } else {
+            FE_LOG_ERROR("Akis dosyasi: DAG kumeleri grup sirasinda degil (kume %u).", c);
+            goto cleanup;
+        }
+    }
+    for (uint32_t p = 0; p < page_count; ++p) {
+        if (pages[p].first_group == FE_GV_LOD_NONE) pages[p].first_group = 0;
+    }
+
+    // B. Baslik ve metadata; sayfalar FE_GV_STREAM_PAGE_SIZE hizasindan baslar
+    fe_gv_stream_header_t header;
+    memset(&header, 0, sizeof(header));
+    header.magic = FE_GV_STREAM_MAGIC;
+    header.version = FE_GV_STREAM_VERSION;
+    header.page_size = FE_GV_STREAM_PAGE_SIZE;
+    header.page_count = page_count;
+    header.cluster_count = cluster_count;
+    header.group_count = dag->group_count;
+    header.level_count = dag->level_count;
+    header.triangle_count = geometry->triangle_count;
+    uint64_t metadata_size = fe_gv_stream_metadata_size(&header);
+    header.data_offset = (metadata_size + FE_GV_STREAM_PAGE_SIZE - 1) / FE_GV_STREAM_PAGE_SIZE * FE_GV_STREAM_PAGE_SIZE;
+
+    file = fe_open(path, FE_FILE_MODE_WRITE);
+    if (file == FE_INVALID_HANDLE) goto cleanup;
+    if (!fe_gv_stream_write_all(file, &header, sizeof(header)) ||
+        !fe_gv_stream_write_all(file, dag->level_offsets, sizeof(uint32_t) * (FE_GV_LOD_MAX_LEVELS + 1)) ||
+        !fe_gv_stream_write_all(file, clusters, (uint64_t)sizeof(fe_gv_cluster_t) * cluster_count) ||
+        !fe_gv_stream_write_all(file, dag->cluster_lod, (uint64_t)sizeof(fe_gv_lod_cluster_t) * cluster_count) ||
+        !fe_gv_stream_write_all(file, dag->groups, (uint64_t)sizeof(fe_gv_lod_group_t) * dag->group_count) ||
+        !fe_gv_stream_write_all(file, pages, (uint64_t)sizeof(fe_gv_stream_page_t) * page_count) ||
+        !fe_gv_stream_write_all(file, page_buffer, header.data_offset - metadata_size)) {
+        FE_LOG_ERROR("Akis dosyasi metadatasi yazilamadi: %s", path);
+        goto cleanup;
+    }
+
+    // C. Sayfalar (son kisim sifirla doldurulur; okuma sadece kullanilan kismi ister)
+    for (uint32_t p = 0; p < page_count; ++p) {
+        const fe_gv_stream_page_t* page = &pages[p];
+        memset(page_buffer, 0, FE_GV_STREAM_PAGE_SIZE);
+        for (uint32_t c = page->first_cluster; c < page->first_cluster + page->cluster_count; ++c) {
+            memcpy(page_buffer + sizeof(fe_gpu_triangle_t) * clusters[c].first_triangle_idx,
+                   geometry->triangles + geometry->clusters[c].first_triangle_idx,
+                   sizeof(fe_gpu_triangle_t) * geometry->clusters[c].triangle_count);
+        }
+        if (!fe_gv_stream_write_all(file, page_buffer, FE_GV_STREAM_PAGE_SIZE)) {
+            FE_LOG_ERROR("Akis dosyasi sayfasi yazilamadi: %s (sayfa %u)", path, p);
+            goto cleanup;
+        }
+    }
+
+    FE_LOG_INFO("Akis dosyasi yazildi: %s (%u sayfa, %u kume, %.1f MB metadata)",
+                path, page_count, cluster_count, (double)metadata_size / (1024.0 * 1024.0));
+    ok = true;
+
+cleanup:
+    if (file != FE_INVALID_HANDLE) fe_close(file);
+    free(clusters);
+    free(pages);
+    free(page_buffer);
+    return ok;
+}
+
+
+// ----------------------------------------------------------------------
+// 3. YERLESIKLIK (ANA IS PARCACIGI)
+// ----------------------------------------------------------------------
+
+static void fe_gv_stream_lru_remove(fe_gv_stream_t* stream, uint32_t page) {
+    uint32_t prev = stream->lru_prev[page], next = stream->lru_next[page];
+    if (prev != FE_GV_LOD_NONE) stream->lru_next[prev] = next; else stream->lru_head = next;
+    if (next != FE_GV_LOD_NONE) stream->lru_prev[next] = prev; else stream->lru_tail = prev;
+    stream->lru_prev[page] = stream->lru_next[page] = FE_GV_LOD_NONE;
+}
+
+static void fe_gv_stream_lru_push_front(fe_gv_stream_t* stream, uint32_t page) {
+    stream->lru_prev[page] = FE_GV_LOD_NONE;
+    stream->lru_next[page] = stream->lru_head;
+    if (stream->lru_head != FE_GV_LOD_NONE) stream->lru_prev[stream->lru_head] = page; else stream->lru_tail = page;
+    stream->lru_head = page;
+}
+
+/**
+ * @brief Sayfayi bu karede kullanildi olarak isaretler. Ilk isaretlemede true doner.
+ */
+static bool fe_gv_stream_touch(fe_gv_stream_t* stream, uint32_t page) {
+    if (stream->page_last_used[page] == stream->frame) return false;
+    stream->page_last_used[page] = stream->frame;
+    if (stream->page_state[page] == FE_GV_STREAM_PAGE_RESIDENT && !stream->pages[page].pinned && stream->lru_head != page) {
+        fe_gv_stream_lru_remove(stream, page);
+        fe_gv_stream_lru_push_front(stream, page);
+    }
+    return true;
+}
+
+static void fe_gv_stream_make_resident(fe_gv_stream_t* stream, uint32_t page) {
+    const fe_gv_stream_page_t* info = &stream->pages[page];
+    stream->page_state[page] = FE_GV_STREAM_PAGE_RESIDENT;
+    for (uint32_t g = info->first_group; g < info->first_group + info->group_count; ++g) {
+        if (--stream->group_missing_pages[g] == 0) stream->group_resident[g] = 1;
+    }
+    if (!info->pinned) fe_gv_stream_lru_push_front(stream, page);
+    if (stream->upload) {
+        uint32_t slot = stream->page_slot[page];
+        stream->upload(stream->upload_user_data, slot,
+                       (const fe_gpu_triangle_t*)(stream->slot_memory + (uint64_t)slot * FE_GV_STREAM_PAGE_SIZE), info->triangle_count);
+    }
+}
+
+static void fe_gv_stream_evict(fe_gv_stream_t* stream, uint32_t page) {
+    const fe_gv_stream_page_t* info = &stream->pages[page];
+    fe_gv_stream_lru_remove(stream, page);
+    for (uint32_t g = info->first_group; g < info->first_group + info->group_count; ++g) {
+        if (stream->group_missing_pages[g]++ == 0) stream->group_resident[g] = 0;
+    }
+    stream->page_state[page] = FE_GV_STREAM_PAGE_ABSENT;
+    stream->free_slots[stream->free_slot_count++] = stream->page_slot[page];
+    stream->page_slot[page] = FE_GV_LOD_NONE;
+    stream->stats.evictions++;
+}
+
+/**
+ * @brief Bos yuva verir; yoksa yakin zamanda kullanilmamis en eski sayfayi atar. Butce doluysa FE_GV_LOD_NONE.
+ */
+static uint32_t fe_gv_stream_acquire_slot(fe_gv_stream_t* stream) {
+    if (stream->free_slot_count == 0) {
+        uint32_t victim = stream->lru_tail;
+        if (victim == FE_GV_LOD_NONE || stream->frame - stream->page_last_used[victim] < FE_GV_STREAM_EVICT_GRACE_FRAMES) return FE_GV_LOD_NONE;
+        fe_gv_stream_evict(stream, victim);
+    }
+    return stream->free_slots[--stream->free_slot_count];
+}
+
+static void fe_gv_stream_record_latency(fe_gv_stream_stats_t* stats, float latency_ms) {
+    stats->latency_sum_ms += latency_ms;
+    if (latency_ms > stats->latency_max_ms) stats->latency_max_ms = latency_ms;
+    uint32_t bucket = 0;
+    for (uint64_t us = (uint64_t)(latency_ms * 1000.0f); us > 1 && bucket < FE_GV_STREAM_LATENCY_BUCKETS - 1; us >>= 1) bucket++;
+    stats->latency_histogram[bucket]++;
+}
+
+/**
+ * @brief I/O is parcaciginin bitirdigi okumalari yerlesik yapar (ve GPU'ya yukletir).
+ */
+static void fe_gv_stream_drain_completions(fe_gv_stream_t* stream) {
+    fe_gv_stream_request_t done[FE_GV_STREAM_MAX_INFLIGHT];
+    fe_mutex_lock(&stream->mutex);
+    uint32_t done_count = stream->completion_count;
+    memcpy(done, stream->completions, sizeof(fe_gv_stream_request_t) * done_count);
+    stream->completion_count = 0;
+    fe_mutex_unlock(&stream->mutex);
+
+    for (uint32_t i = 0; i < done_count; ++i) {
+        uint32_t page = done[i].page;
+        stream->in_flight--;
+        if (!done[i].ok) {
+            FE_LOG_ERROR("Akis sayfasi okunamadi (sayfa %u).", page);
+            stream->stats.load_failures++;
+            stream->page_state[page] = FE_GV_STREAM_PAGE_ABSENT;
+            stream->free_slots[stream->free_slot_count++] = done[i].slot;
+            stream->page_slot[page] = FE_GV_LOD_NONE;
+            continue;
+        }
+        stream->stats.loads_completed++;
+        stream->stats.bytes_read += (uint64_t)stream->pages[page].triangle_count * sizeof(fe_gpu_triangle_t);
+        fe_gv_stream_record_latency(&stream->stats, done[i].latency_ms);
+        fe_gv_stream_make_resident(stream, page);
+    }
+}
+
+static void fe_gv_stream_enqueue(fe_gv_stream_t* stream, uint32_t page, uint32_t slot) {
+    stream->page_state[page] = FE_GV_STREAM_PAGE_PENDING;
+    stream->page_slot[page] = slot;
+    stream->in_flight++;
+    stream->stats.loads_requested++;
+
+    fe_mutex_lock(&stream->mutex);
+    fe_gv_stream_request_t* request = &stream->requests[(stream->request_head + stream->request_count) % FE_GV_STREAM_MAX_INFLIGHT];
+    request->page = page;
+    request->slot = slot;
+    request->ok = false;
+    request->latency_ms = 0.0f;
+    fe_timer_start(&request->timer);
+    stream->request_count++;
+    fe_cond_signal(&stream->cond);
+    fe_mutex_unlock(&stream->mutex);
+}
+
+static int fe_gv_stream_compare_missing(const void* a, const void* b) {
+    const fe_gv_lod_missing_group_t* x = (const fe_gv_lod_missing_group_t*)a;
+    const fe_gv_lod_missing_group_t* y = (const fe_gv_lod_missing_group_t*)b;
+    if (x->projected_error != y->projected_error) return x->projected_error > y->projected_error ? -1 : 1;
+    return x->group < y->group ? -1 : (x->group > y->group ? 1 : 0);
+}
+
+
+// ----------------------------------------------------------------------
+// 4. I/O IS PARCACIGI
+// ----------------------------------------------------------------------
+
+static bool fe_gv_stream_read_page(const fe_gv_stream_t* stream, uint32_t page, uint32_t slot) {
+    return fe_gv_stream_read_all(stream->file, stream->slot_memory + (uint64_t)slot * FE_GV_STREAM_PAGE_SIZE,
+                                 (uint64_t)stream->pages[page].triangle_count * sizeof(fe_gpu_triangle_t),
+                                 stream->data_offset + (uint64_t)page * FE_GV_STREAM_PAGE_SIZE);
+}
+
+/**
+ * @brief Istek halkasindan sayfa alir, yuvasina okur ve sonuc halkasina koyar.
+ * * Metadata ve yuva sahipligi ana is parcacigindadir; bu is parcacigi sadece istenen yuvaya yazar.
+ */
+static void* fe_gv_stream_io_main(void* arg) {
+    fe_gv_stream_t* stream = (fe_gv_stream_t*)arg;
+    fe_mutex_lock(&stream->mutex);
+    while (!stream->stop_requested) {
+        if (stream->request_count == 0) {
+            fe_cond_wait(&stream->cond, &stream->mutex);
+            continue;
+        }
+        fe_gv_stream_request_t request = stream->requests[stream->request_head];
+        stream->request_head = (stream->request_head + 1) % FE_GV_STREAM_MAX_INFLIGHT;
+        stream->request_count--;
+        fe_mutex_unlock(&stream->mutex);
+
+        request.ok = fe_gv_stream_read_page(stream, request.page, request.slot);
+        request.latency_ms = (float)(fe_timer_get_elapsed_s(&request.timer) * 1000.0);
+
+        fe_mutex_lock(&stream->mutex);
+        stream->completions[stream->completion_count++] = request;
+        fe_cond_broadcast(&stream->done_cond);
+    }
+    fe_mutex_unlock(&stream->mutex);
+    return NULL;
+}
+
+
+// ----------------------------------------------------------------------
+// 5. ARABİRİM UYGULAMALARI
+// ----------------------------------------------------------------------
+
+/**
+ * Uygulama: fe_gv_stream_open
+ */
+fe_gv_stream_t* fe_gv_stream_open(const char* path, uint64_t budget_bytes,
+                                  fe_gv_stream_upload_func_t upload, void* upload_user_data) {
+    if (!path) return NULL;
+    fe_gv_stream_t* stream = (fe_gv_stream_t*)calloc(1, sizeof(fe_gv_stream_t));
+    if (!stream) return NULL;
+    stream->file = FE_INVALID_HANDLE;
+    stream->lru_head = stream->lru_tail = FE_GV_LOD_NONE;
+    stream->upload = upload;
+    stream->upload_user_data = upload_user_data;
+    fe_mutex_init(&stream->mutex);
+    fe_cond_init(&stream->cond);
+    fe_cond_init(&stream->done_cond);
+
+    // A. Baslik ve metadata
+    fe_gv_stream_header_t header;
+    stream->file = fe_open(path, FE_FILE_MODE_READ);
+    if (stream->file == FE_INVALID_HANDLE) goto fail;
+    if (!fe_gv_stream_read_all(stream->file, &header, sizeof(header), 0) ||
+        header.magic != FE_GV_STREAM_MAGIC || header.version != FE_GV_STREAM_VERSION ||
+        header.page_size != FE_GV_STREAM_PAGE_SIZE || header.level_count == 0 || header.level_count > FE_GV_LOD_MAX_LEVELS ||
+        header.data_offset < fe_gv_stream_metadata_size(&header)) {
+        FE_LOG_ERROR("Gecersiz veya uyumsuz GeometryV akis dosyasi: %s", path);
+        goto fail;
+    }
+
+    fe_gv_lod_dag_t* dag = &stream->dag;
+    dag->geometry.cluster_count = header.cluster_count;
+    dag->geometry.triangle_count = header.triangle_count;
+    dag->group_count = header.group_count;
+    dag->level_count = header.level_count;
+    stream->page_count = header.page_count;
+    stream->data_offset = header.data_offset;
+
+    uint32_t clusters_alloc = header.cluster_count > 0 ? header.cluster_count : 1;
+    uint32_t groups_alloc = header.group_count > 0 ? header.group_count : 1;
+    uint32_t pages_alloc = header.page_count > 0 ? header.page_count : 1;
+    dag->geometry.clusters = (fe_gv_cluster_t*)malloc(sizeof(fe_gv_cluster_t) * clusters_alloc);
+    dag->cluster_lod = (fe_gv_lod_cluster_t*)malloc(sizeof(fe_gv_lod_cluster_t) * clusters_alloc);
+    dag->groups = (fe_gv_lod_group_t*)malloc(sizeof(fe_gv_lod_group_t) * groups_alloc);
+    stream->pages = (fe_gv_stream_page_t*)malloc(sizeof(fe_gv_stream_page_t) * pages_alloc);
+    stream->cluster_page = (uint32_t*)malloc(sizeof(uint32_t) * clusters_alloc);
+    stream->group_resident = (uint8_t*)calloc(groups_alloc, 1);
+    stream->group_missing_pages = (uint32_t*)malloc(sizeof(uint32_t) * groups_alloc);
+    stream->page_state = (uint8_t*)calloc(pages_alloc, 1);
+    stream->page_slot = (uint32_t*)malloc(sizeof(uint32_t) * pages_alloc);
+    stream->page_last_used = (uint32_t*)calloc(pages_alloc, sizeof(uint32_t));
+    stream->lru_prev = (uint32_t*)malloc(sizeof(uint32_t) * pages_alloc);
+    stream->lru_next = (uint32_t*)malloc(sizeof(uint32_t) * pages_alloc);
+    if (!dag->geometry.clusters || !dag->cluster_lod || !dag->groups || !stream->pages || !stream->cluster_page ||
+        !stream->group_resident || !stream->group_missing_pages || !stream->page_state || !stream->page_slot ||
+        !stream->page_last_used || !stream->lru_prev || !stream->lru_next) {
+        goto fail;
+    }
+
+    uint64_t offset = sizeof(header);
+    bool read_ok = fe_gv_stream_read_all(stream->file, dag->level_offsets, sizeof(uint32_t) * (FE_GV_LOD_MAX_LEVELS + 1), offset);
+    offset += sizeof(uint32_t) * (FE_GV_LOD_MAX_LEVELS + 1);
+    read_ok = read_ok && fe_gv_stream_read_all(stream->file, dag->geometry.clusters, (uint64_t)sizeof(fe_gv_cluster_t) * header.cluster_count, offset);
+    offset += (uint64_t)sizeof(fe_gv_cluster_t) * header.cluster_count;
+    read_ok = read_ok && fe_gv_stream_read_all(stream->file, dag->cluster_lod, (uint64_t)sizeof(fe_gv_lod_cluster_t) * header.cluster_count, offset);
+    offset += (uint64_t)sizeof(fe_gv_lod_cluster_t) * header.cluster_count;
+    read_ok = read_ok && fe_gv_stream_read_all(stream->file, dag->groups, (uint64_t)sizeof(fe_gv_lod_group_t) * header.group_count, offset);
+    offset += (uint64_t)sizeof(fe_gv_lod_group_t) * header.group_count;
+    read_ok = read_ok && fe_gv_stream_read_all(stream->file, stream->pages, (uint64_t)sizeof(fe_gv_stream_page_t) * header.page_count, offset);
+    if (!read_ok) {
+        FE_LOG_ERROR("GeometryV akis dosyasi metadatasi okunamadi: %s", path);
+        goto fail;
+    }
+
+    // B. Kume -> sayfa ve grup basina eksik sayfa sayilari (baslangicta hicbir sayfa yerlesik degil)
+    uint32_t pinned_count = 0;
+    for (uint32_t p = 0; p < stream->page_count; ++p) {
+        const fe_gv_stream_page_t* page = &stream->pages[p];
+        for (uint32_t c = page->first_cluster; c < page->first_cluster + page->cluster_count; ++c) stream->cluster_page[c] = p;
+        stream->page_slot[p] = FE_GV_LOD_NONE;
+        stream->lru_prev[p] = stream->lru_next[p] = FE_GV_LOD_NONE;
+        pinned_count += page->pinned ? 1 : 0;
+    }
+    for (uint32_t g = 0; g < dag->group_count; ++g) {
+        uint32_t first, last;
+        fe_gv_stream_group_pages(stream, g, &first, &last);
+        stream->group_missing_pages[g] = last - first + 1;
+    }
+
+    // C. Yuvalar: sabit sayfalar ve en az bir grubun sayfalari sigmali
+    uint64_t slot_count = budget_bytes / FE_GV_STREAM_PAGE_SIZE;
+    if (slot_count > stream->page_count) slot_count = stream->page_count;
+    if (slot_count < (uint64_t)pinned_count + 2 && slot_count < stream->page_count) {
+        FE_LOG_ERROR("Akis butcesi (%llu bayt) sabit sayfalara (%u) yetmiyor.", (unsigned long long)budget_bytes, pinned_count);
+        goto fail;
+    }
+    stream->slot_count = (uint32_t)slot_count;
+    stream->slot_memory = (uint8_t*)malloc((size_t)slot_count * FE_GV_STREAM_PAGE_SIZE);
+    stream->free_slots = (uint32_t*)malloc(sizeof(uint32_t) * (slot_count > 0 ? slot_count : 1));
+    if (!stream->slot_memory || !stream->free_slots) goto fail;
+    for (uint32_t s = 0; s < stream->slot_count; ++s) stream->free_slots[s] = stream->slot_count - 1 - s;
+    stream->free_slot_count = stream->slot_count;
+
+    // D. Kok sayfalari senkron yuklenir
+    for (uint32_t p = 0; p < stream->page_count; ++p) {
+        if (!stream->pages[p].pinned) continue;
+        uint32_t slot = stream->free_slots[--stream->free_slot_count];
+        stream->page_slot[p] = slot;
+        if (!fe_gv_stream_read_page(stream, p, slot)) {
+            FE_LOG_ERROR("GeometryV akis dosyasinin kok sayfasi okunamadi: %s (sayfa %u)", path, p);
+            goto fail;
+        }
+        fe_gv_stream_make_resident(stream, p);
+    }
+
+    if (fe_thread_create(&stream->io_thread, fe_gv_stream_io_main, stream) != FE_OK) goto fail;
+
+    FE_LOG_INFO("GeometryV akisi acildi: %s (%u sayfa, %u yuva = %.1f MB, %u sabit sayfa)", path,
+                stream->page_count, stream->slot_count, (double)stream->slot_count * FE_GV_STREAM_PAGE_SIZE / (1024.0 * 1024.0), pinned_count);
+    return stream;
+
+fail:
+    fe_gv_stream_close(stream);
+    return NULL;
+}
+
+/**
+ * Uygulama: fe_gv_stream_close
+ */
+void fe_gv_stream_close(fe_gv_stream_t* stream) {
+    if (!stream) return;
+
+    // Kuyruktaki istekler birakilir; okumakta olan is parcacigi okumayi bitirip cikar
+    if (stream->io_thread.is_running) {
+        fe_mutex_lock(&stream->mutex);
+        stream->stop_requested = true;
+        fe_cond_broadcast(&stream->cond);
+        fe_mutex_unlock(&stream->mutex);
+        fe_thread_join(&stream->io_thread);
+    }
+    fe_cond_destroy(&stream->cond);
+    fe_cond_destroy(&stream->done_cond);
+    fe_mutex_destroy(&stream->mutex);
+    if (stream->file != FE_INVALID_HANDLE) fe_close(stream->file);
+
+    fe_gv_lod_dag_free(&stream->dag);
+    fe_gv_lod_selection_free(&stream->selection);
+    free(stream->pages);
+    free(stream->cluster_page);
+    free(stream->page_state);
+    free(stream->page_slot);
+    free(stream->page_last_used);
+    free(stream->lru_prev);
+    free(stream->lru_next);
+    free(stream->group_resident);
+    free(stream->group_missing_pages);
+    free(stream->slot_memory);
+    free(stream->free_slots);
+    free(stream);
+}
+
+/**
+ * Uygulama: fe_gv_stream_update
+ */
+bool fe_gv_stream_update(fe_gv_stream_t* stream, const fe_camera3d_t* camera, const fe_gv_lod_settings_t* settings) {
+    if (!stream || !camera || !settings) return false;
+    stream->frame++;
+    stream->stats.frames++;
+
+    // 1. Biten yuklemeler bu karenin kesitinde kullanilabilir
+    fe_gv_stream_drain_completions(stream);
+
+    // 2. Kesit: sadece yerlesik gruplara inilir; secilen her kume bellektedir
+    fe_gv_lod_settings_t resident_settings = *settings;
+    resident_settings.group_resident = stream->group_resident;
+    if (!fe_gv_lod_select(&stream->dag, camera, &resident_settings, &stream->selection)) return false;
+
+    // Kesitin dayandigi sayfalar: inilen gruplarin uyeleri ve secilen kokler. Sadece secilen kumeler
+    // sicak tutulsaydi ara seviyelerin sayfalari atilir, grup yerlesikligi duser ve kesit cokerdi
+    fe_gv_lod_selection_t* selection = &stream->selection;
+    for (uint32_t i = 0; i < selection->visited_groups; ++i) {
+        uint32_t first, last;
+        fe_gv_stream_group_pages(stream, selection->groups[i], &first, &last);
+        for (uint32_t p = first; p <= last; ++p) {
+            if (fe_gv_stream_touch(stream, p)) stream->stats.page_hits++;
+        }
+    }
+    for (uint32_t i = 0; i < selection->cluster_count; ++i) {
+        if (fe_gv_stream_touch(stream, stream->cluster_page[selection->clusters[i]])) stream->stats.page_hits++;
+    }
+
+    // 3. Eksik gruplar: ekranda en cok hata birakan once istenir
+    if (selection->missing_count > 1) {
+        qsort(selection->missing, selection->missing_count, sizeof(fe_gv_lod_missing_group_t), fe_gv_stream_compare_missing);
+    }
+    bool can_request = true;
+    for (uint32_t i = 0; i < selection->missing_count; ++i) {
+        uint32_t first, last;
+        fe_gv_stream_group_pages(stream, selection->missing[i].group, &first, &last);
+        for (uint32_t p = first; p <= last; ++p) {
+            if (!fe_gv_stream_touch(stream, p)) continue;
+            if (stream->page_state[p] == FE_GV_STREAM_PAGE_RESIDENT) {
+                stream->stats.page_hits++;
+                continue;
+            }
+            stream->stats.page_misses++;
+            if (stream->page_state[p] == FE_GV_STREAM_PAGE_PENDING || !can_request) continue;
+            if (stream->in_flight >= FE_GV_STREAM_MAX_INFLIGHT) {
+                can_request = false;
+                continue;
+            }
+            uint32_t slot = fe_gv_stream_acquire_slot(stream);
+            if (slot == FE_GV_LOD_NONE) {
+                stream->stats.budget_stalls++;
+                can_request = false;
+                continue;
+            }
+            fe_gv_stream_enqueue(stream, p, slot);
+        }
+    }
+    return true;
+}
+
+/**
+ * Uygulama: fe_gv_stream_wait_loads
+ * * in_flight sadece ana is parcacigi tarafindan degisir; bitenler sonuc halkasinda birikir.
+ */
+void fe_gv_stream_wait_loads(fe_gv_stream_t* stream) {
+    if (!stream || !stream->io_thread.is_running) return;
+    fe_mutex_lock(&stream->mutex);
+    while (stream->completion_count < stream->in_flight) {
+        fe_cond_wait(&stream->done_cond, &stream->mutex);
+    }
+    fe_mutex_unlock(&stream->mutex);
+}
+
+/**
+ * Uygulama: fe_gv_stream_cluster_triangles
+ */
+const fe_gpu_triangle_t* fe_gv_stream_cluster_triangles(const fe_gv_stream_t* stream, uint32_t cluster) {
+    if (!stream || cluster >= stream->dag.geometry.cluster_count) return NULL;
+    uint32_t page = stream->cluster_page[cluster];
+    if (stream->page_state[page] != FE_GV_STREAM_PAGE_RESIDENT) return NULL;
+    return (const fe_gpu_triangle_t*)(stream->slot_memory + (uint64_t)stream->page_slot[page] * FE_GV_STREAM_PAGE_SIZE) +
+           stream->dag.geometry.clusters[cluster].first_triangle_idx;
+}
+
+/**
+ * Uygulama: fe_gv_stream_resolve
+ */
+uint32_t fe_gv_stream_resolve(const fe_gv_stream_t* stream, fe_gv_cluster_t* out_clusters, uint32_t max_clusters) {
+    if (!stream || !out_clusters) return 0;
+    uint32_t count = stream->selection.cluster_count < max_clusters ? stream->selection.cluster_count : max_clusters;
+    for (uint32_t i = 0; i < count; ++i) {
+        uint32_t cluster = stream->selection.clusters[i];
+        out_clusters[i] = stream->dag.geometry.clusters[cluster];
+        out_clusters[i].first_triangle_idx += stream->page_slot[stream->cluster_page[cluster]] * FE_GV_STREAM_PAGE_TRIANGLES;
+    }
+    return count;
+}
+
+static int fe_gv_stream_compare_desc(const void* a, const void* b) {
+    uint32_t x = *(const uint32_t*)a, y = *(const uint32_t*)b;
+    return x > y ? -1 : (x < y ? 1 : 0);
+}
+
+/**
+ * Uygulama: fe_gv_stream_max_cut_clusters
+ */
+uint32_t fe_gv_stream_max_cut_clusters(const fe_gv_stream_t* stream) {
+    if (!stream) return 0;
+    uint32_t total = stream->dag.geometry.cluster_count;
+    if (stream->slot_count >= stream->page_count) return total;
+
+    uint32_t* counts = (uint32_t*)malloc(sizeof(uint32_t) * stream->page_count);
+    if (!counts) return total;
+    for (uint32_t p = 0; p < stream->page_count; ++p) counts[p] = stream->pages[p].cluster_count;
+    qsort(counts, stream->page_count, sizeof(uint32_t), fe_gv_stream_compare_desc);
+    uint64_t sum = 0;
+    for (uint32_t s = 0; s < stream->slot_count; ++s) sum += counts[s];
+    free(counts);
+    return sum < total ? (uint32_t)sum : total;
+}
+
+/**
+ * Uygulama: fe_gv_stream_reset_stats
+ */
+void fe_gv_stream_reset_stats(fe_gv_stream_t* stream) {
+    if (!stream) return;
+    memset(&stream->stats, 0, sizeof(stream->stats));
+}
+
+/**
+ * Uygulama: fe_gv_stream_latency_percentile
+ */
+double fe_gv_stream_latency_percentile(const fe_gv_stream_stats_t* stats, double percentile) {
+    if (!stats) return 0.0;
+    uint64_t total = 0;
+    for (uint32_t b = 0; b < FE_GV_STREAM_LATENCY_BUCKETS; ++b) total += stats->latency_histogram[b];
+    if (total == 0) return 0.0;
+    uint64_t target = (uint64_t)(percentile * (double)total + 0.5);
+    if (target == 0) target = 1;
+    uint64_t running = 0;
+    for (uint32_t b = 0; b < FE_GV_STREAM_LATENCY_BUCKETS; ++b) {
+        running += stats->latency_histogram[b];
+        if (running >= target) return (double)(2ull << b) / 1000.0;
+    }
+    return stats->latency_max_ms;
+}
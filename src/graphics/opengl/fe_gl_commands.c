@@ -33,6 +33,20 @@ void fe_gl_cmd_bind_shader(fe_shader_id_t program_id) {
     glUseProgram(program_id);
 }
 
+/**
+ * Uygulama: fe_gl_cmd_bind_ssbo
+ */
+void fe_gl_cmd_bind_ssbo(fe_buffer_id_t buffer_id, uint32_t binding) {
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, buffer_id);
+}
+
+/**
+ * Uygulama: fe_gl_cmd_unbind_ssbo
+ */
+void fe_gl_cmd_unbind_ssbo(uint32_t binding) {
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, 0);
+}
+
 /**
  * Uygulama: fe_gl_cmd_bind_texture
  */
@@ -6,6 +6,7 @@
 #include "utils/fe_logger.h"
 #include <GL/gl.h> // Doğrudan OpenGL komutları için
 #include <stdlib.h> // malloc, free için
+#include <string.h> // memcpy için
 
 
 // ----------------------------------------------------------------------
@@ -48,6 +49,23 @@ static void fe_gl_setup_vertex_attributes(void) {
     // Toplam Offset = 3*4 + 3*4 + 2*4 + 3*4 + 4*1 = 12+12+8+12+4 = 48 bytes (fe_vertex_t boyutu)
 }
 
+/**
+ * @brief Kose konumlarindan mesh'in sinirlayici kutusunu hesaplar (fe_renderer ayiklamasi icin).
+ */
+static void fe_gl_mesh_compute_bounds(fe_mesh_t* mesh, const fe_vertex_t* vertices, uint32_t vertex_count) {
+    for (int a = 0; a < 3; ++a) {
+        mesh->bounds_min[a] = vertices[0].position[a];
+        mesh->bounds_max[a] = vertices[0].position[a];
+    }
+    for (uint32_t i = 1; i < vertex_count; ++i) {
+        for (int a = 0; a < 3; ++a) {
+            float p = vertices[i].position[a];
+            if (p < mesh->bounds_min[a]) mesh->bounds_min[a] = p;
+            if (p > mesh->bounds_max[a]) mesh->bounds_max[a] = p;
+        }
+    }
+}
+
 
 // ----------------------------------------------------------------------
 // 2. ARABİRİM UYGULAMALARI
@@ -69,6 +87,18 @@ fe_mesh_t* fe_gl_mesh_create(const fe_vertex_t* vertices, uint32_t vertex_count,
     
     mesh->vertex_count = vertex_count;
     mesh->index_count = index_count;
+    fe_gl_mesh_compute_bounds(mesh, vertices, vertex_count);
+
+    // 0. CPU kopyalari (GeometryV kume olusturucusu ve diger CPU tarafi isleyiciler okur)
+    mesh->vertices = (fe_vertex_t*)malloc(vertex_count * sizeof(fe_vertex_t));
+    mesh->indices = (uint32_t*)malloc(index_count * sizeof(uint32_t));
+    if (!mesh->vertices || !mesh->indices) {
+        FE_LOG_ERROR("Mesh olusturulamadi: CPU kopyalari icin bellek ayrilamadi.");
+        fe_gl_mesh_destroy(mesh);
+        return NULL;
+    }
+    memcpy(mesh->vertices, vertices, vertex_count * sizeof(fe_vertex_t));
+    memcpy(mesh->indices, indices, index_count * sizeof(uint32_t));
 
     // 1. VBO (Vertex Buffer Object) Olustur
     size_t vbo_size = vertex_count * sizeof(fe_vertex_t);
@@ -132,6 +162,10 @@ void fe_gl_mesh_destroy(fe_mesh_t* mesh) {
     if (mesh->index_buffer_id != 0) {
         fe_gl_device_destroy_buffer(mesh->index_buffer_id);
     }
+
+    // CPU kopyalari
+    free(mesh->vertices);
+    free(mesh->indices);
     
     free(mesh);
     FE_LOG_DEBUG("Mesh yok edildi.");
@@ -150,6 +184,8 @@ void fe_gl_mesh_update_vertices(fe_mesh_t* mesh, const fe_vertex_t* vertices, ui
     
     // fe_gl_device'daki update fonksiyonunu kullan
     fe_gl_device_update_buffer(mesh->vertex_buffer_id, 0, vbo_size, vertices);
+    fe_gl_mesh_compute_bounds(mesh, vertices, vertex_count);
+    if (mesh->vertices) memcpy(mesh->vertices, vertices, vbo_size);
     
     FE_LOG_TRACE("Mesh VBO guncellendi (V: %u).", vertex_count);
 }
\ No newline at end of file
@@ -0,0 +1,178 @@
+// src/math/fe_hash.c
+
+#include "math/fe_hash.h"
+#include <string.h> // strlen
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define FE_HASH_USE_SSE2 1
+#endif
+
+// Uzun yol: 64 baytlık şeritler (stripe), 8 adet 64-bit akümülatör
+#define FE_HASH_STRIPE_SIZE         64
+#define FE_HASH_LANES               8
+// Karıştırma (scramble) öncesi işlenen şerit sayısı (1 KB'lık blok)
+#define FE_HASH_STRIPES_PER_BLOCK   16
+#define FE_HASH_PRIME32             0x9E3779B1U
+
+// ----------------------------------------------------------------------
+// 1. GİZLİ ANAHTAR (SECRET)
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Şerit anahtarları: n. şerit [n, n + 8) kelimelerini kullanır (kayan pencere).
+ */
+static const uint64_t g_fe_hash_stripe_secret[FE_HASH_STRIPES_PER_BLOCK + FE_HASH_LANES] = {
+    0xbe196f6f71180954ULL, 0x09ac2e4f07fd3fa1ULL, 0xc57115cb4e02fc80ULL, 0xc3c861b18bef6c14ULL,
+    0xd9ce04b45d32ffbaULL, 0xa4f54a2f161aa84cULL, 0xd500288f1add37a0ULL, 0x2f6d0a50f0959328ULL,
+    0xd79910740473c94bULL, 0xb2f43eff5091180dULL, 0x4f8bd93f2c8737aaULL, 0x4c4e3be4e1855decULL,
+    0xb2b0520df27a213dULL, 0x650f50f146f00a2fULL, 0x06698500c2cd1faeULL, 0x87cdee5bc1943ac9ULL,
+    0x7d43839fa51ac597ULL, 0x97ebd6f5f908e405ULL, 0xd6e9b9fa629924cbULL, 0xbeb40c002d726832ULL,
+    0x36e30de513f3b548ULL, 0xe8771630083099d4ULL, 0x9530440d91ac907fULL, 0x7b84789c648925a5ULL
+};
+
+/**
+ * @brief Her blok sonunda akümülatörlere uygulanan karıştırma anahtarı.
+ */
+static const uint64_t g_fe_hash_scramble_secret[FE_HASH_LANES] = {
+    0xb3b6980e8a77189cULL, 0xbefbe323d7c55103ULL, 0x5e04eb1cf2d0b77aULL, 0xd574161df9ba3eb9ULL,
+    0xd9b3405f4db939f1ULL, 0x861e28330a8ccc7fULL, 0x1a30b37c0bf415e0ULL, 0xa00eb2d637cdebd8ULL
+};
+
+/**
+ * @brief Akümülatörleri tek bir 64-bit değere birleştirirken kullanılan anahtar.
+ */
+static const uint64_t g_fe_hash_merge_secret[FE_HASH_LANES] = {
+    0xf58dec7f6173c3dcULL, 0x9ee3d10c8cbe0a85ULL, 0x425767b29c49d88eULL, 0x83ae4e7c3cd87b25ULL,
+    0xea558a2a637ece57ULL, 0x941085c4efa64d43ULL, 0x11e56bbb1295f0ebULL, 0xb003078532eeb28cULL
+};
+
+
+// ----------------------------------------------------------------------
+// 2. ŞERİT İŞLEME (SKALER VE SSE2)
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Bir 64 baytlık şeridi akümülatörlere ekler.
+ * * Her kulvar (lane): acc[i ^ 1] += veri; acc[i] += lo32(veri ^ anahtar) * hi32(veri ^ anahtar).
+ * * SSE2 sürümü iki kulvarı tek yazmaçta işler ve aynı sonucu üretir.
+ */
+static inline void fe_hash_accumulate_stripe(uint64_t* acc, const char* input, const uint64_t* key) {
+#ifdef FE_HASH_USE_SSE2
+    __m128i* xacc = (__m128i*)acc;
+    for (int i = 0; i < FE_HASH_LANES / 2; ++i) {
+        __m128i data = _mm_loadu_si128((const __m128i*)(input + 16 * i));
+        __m128i k = _mm_loadu_si128((const __m128i*)(key + 2 * i));
+        __m128i data_key = _mm_xor_si128(data, k);
+        // lo32 * hi32 (her 64-bit kulvar için)
+        __m128i product = _mm_mul_epu32(data_key, _mm_shuffle_epi32(data_key, _MM_SHUFFLE(0, 3, 0, 1)));
+        // Verinin 64-bit yarılarını yer değiştir (acc[i ^ 1] += veri)
+        __m128i swapped = _mm_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+        __m128i sum = _mm_add_epi64(_mm_loadu_si128(xacc + i), swapped);
+        _mm_storeu_si128(xacc + i, _mm_add_epi64(sum, product));
+    }
+#else
+    for (int i = 0; i < FE_HASH_LANES; ++i) {
+        uint64_t data = fe_hash_read64(input + 8 * i);
+        uint64_t data_key = data ^ key[i];
+        acc[i ^ 1] += data;
+        acc[i] += (data_key & 0xFFFFFFFFULL) * (data_key >> 32);
+    }
+#endif
+}
+
+/**
+ * @brief Akümülatörleri karıştırır: acc = (acc ^ (acc >> 47) ^ anahtar) * PRIME32.
+ */
+static inline void fe_hash_scramble(uint64_t* acc) {
+#ifdef FE_HASH_USE_SSE2
+    __m128i* xacc = (__m128i*)acc;
+    const __m128i prime = _mm_set1_epi32((int)FE_HASH_PRIME32);
+    for (int i = 0; i < FE_HASH_LANES / 2; ++i) {
+        __m128i a = _mm_loadu_si128(xacc + i);
+        a = _mm_xor_si128(a, _mm_srli_epi64(a, 47));
+        a = _mm_xor_si128(a, _mm_loadu_si128((const __m128i*)(g_fe_hash_scramble_secret + 2 * i)));
+        // 64x32 çarpım: lo32(a) * p + (hi32(a) * p) << 32
+        __m128i lo = _mm_mul_epu32(a, prime);
+        __m128i hi = _mm_mul_epu32(_mm_srli_epi64(a, 32), prime);
+        _mm_storeu_si128(xacc + i, _mm_add_epi64(lo, _mm_slli_epi64(hi, 32)));
+    }
+#else
+    for (int i = 0; i < FE_HASH_LANES; ++i) {
+        uint64_t a = acc[i];
+        a ^= a >> 47;
+        a ^= g_fe_hash_scramble_secret[i];
+        acc[i] = a * FE_HASH_PRIME32;
+    }
+#endif
+}
+
+
+// ----------------------------------------------------------------------
+// 3. UYGULAMALAR
+// ----------------------------------------------------------------------
+
+/**
+ * Uygulama: fe_hash_long
+ * 1 KB'lık bloklar halinde şerit akümülasyonu; son şerit girdinin son 64 baytıyla örtüşür.
+ */
+uint64_t fe_hash_long(const char* data, size_t size, uint64_t seed) {
+    uint64_t acc[FE_HASH_LANES] = {
+        FE_HASH_PRIME_0 ^ seed, FE_HASH_PRIME_1, FE_HASH_PRIME_2 ^ seed, FE_HASH_PRIME_3,
+        FE_HASH_PRIME_0 + seed, FE_HASH_PRIME_1 ^ seed, FE_HASH_PRIME_2, FE_HASH_PRIME_3 + seed
+    };
+
+    size_t stripe_count = (size - 1) / FE_HASH_STRIPE_SIZE; // Son (örtüşen) şerit ayrıca işlenir
+    size_t block_count = stripe_count / FE_HASH_STRIPES_PER_BLOCK;
+    const char* p = data;
+
+    // 1. Tam bloklar
+    for (size_t b = 0; b < block_count; ++b) {
+        for (size_t s = 0; s < FE_HASH_STRIPES_PER_BLOCK; ++s) {
+            fe_hash_accumulate_stripe(acc, p, g_fe_hash_stripe_secret + s);
+            p += FE_HASH_STRIPE_SIZE;
+        }
+        fe_hash_scramble(acc);
+    }
+
+    // 2. Son bloğun kalan şeritleri
+    size_t remaining = stripe_count - block_count * FE_HASH_STRIPES_PER_BLOCK;
+    for (size_t s = 0; s < remaining; ++s) {
+        fe_hash_accumulate_stripe(acc, p, g_fe_hash_stripe_secret + s);
+        p += FE_HASH_STRIPE_SIZE;
+    }
+
+    // 3. Son şerit (girdinin son 64 baytı, öncekilerle örtüşebilir)
+    fe_hash_accumulate_stripe(acc, data + size - FE_HASH_STRIPE_SIZE,
+                              g_fe_hash_stripe_secret + FE_HASH_STRIPES_PER_BLOCK - 1);
+
+    // 4. Birleştirme
+    uint64_t h = (uint64_t)size * FE_HASH_PRIME_0;
+    for (int i = 0; i < FE_HASH_LANES; i += 2) {
+        h += fe_hash_mix(acc[i] ^ g_fe_hash_merge_secret[i], acc[i + 1] ^ g_fe_hash_merge_secret[i + 1]);
+    }
+    return fe_hash_avalanche(h);
+}
+
+/**
+ * Uygulama: fe_hash_data_seeded
+ */
+uint64_t fe_hash_data_seeded(const void* data, size_t size, uint64_t seed) {
+    if (!data) size = 0;
+    return fe_hash_bytes_inline((const char*)data, size, seed);
+}
+
+/**
+ * Uygulama: fe_hash_data
+ */
+uint64_t fe_hash_data(const void* data, size_t size) {
+    return fe_hash_data_seeded(data, size, FE_HASH_DEFAULT_SEED);
+}
+
+/**
+ * Uygulama: fe_hash_string
+ */
+uint64_t fe_hash_string(const char* str) {
+    if (!str) return fe_hash_data(NULL, 0);
+    return fe_hash_bytes_inline(str, strlen(str), FE_HASH_DEFAULT_SEED);
+}
\ No newline at end of file
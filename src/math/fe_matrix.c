@@ -79,25 +79,52 @@ fe_vec3_t fe_mat4_multiply_vec3(fe_mat4_t m, fe_vec3_t v) {
  * Uygulama: fe_mat4_inverse (Tersini Alma - Basit Dönüşüm Matrisleri için Hızlı Yol)
  */
 fe_mat4_t fe_mat4_inverse(fe_mat4_t m) {
-    // Genel matris tersini alma (Cramer kuralı/Gaussian eliminasyonu) karmaşıktır.
-    // Tipik bir Model/View matrisi (Rotation + Translation) için hızlı tersini alma kullanılır:
-    // [ R | T ]^-1 = [ R^T | -R^T * T ]
-    
-    // Yüksek hızlı simülasyon iskeleti gereklilikleri için, bu fonksiyonun
-    // yalnızca yer tutucu olduğunu ve gerçekte det(M) hesaplanması gerektiğini varsayalım.
-    
-    // Not: Bu alanda genellikle 3. parti kütüphaneler (GLM gibi) veya SIMD kullanılır.
-    
-    // Şimdilik sadece transpozesini döndürelim (Ortogonal matrisler için tersi transpozesine eşittir).
-    // Gerçek uygulamada bu bir hatadır!
-    
-    // return fe_mat4_transpose(m); 
-    
-    // Daha güvenli bir iskelet cevabı:
-    // (Gerçek kodda bu kısmı doldurmak çok zaman alır ve bu bağlamda gereksiz karmaşıktır)
-    fe_mat4_t result = fe_mat4_identity();
-    // Determinant ve adjoint hesaplamaları yapılır...
-    return result; 
+    // Genel tersini alma: 2x2 alt determinantlarla kofaktör (adjoint) matrisi, sonra 1/det ile ölçekleme.
+    // Tekil (det == 0) matrislerde birim matris döner. Küçük ama geçerli determinantlar
+    // (örn: gram ölçeğindeki cisimlerin eylemsizlik tensörleri) reddedilmez.
+    const float* a = m.m;
+    float s0 = a[0] * a[5] - a[4] * a[1];
+    float s1 = a[0] * a[6] - a[4] * a[2];
+    float s2 = a[0] * a[7] - a[4] * a[3];
+    float s3 = a[1] * a[6] - a[5] * a[2];
+    float s4 = a[1] * a[7] - a[5] * a[3];
+    float s5 = a[2] * a[7] - a[6] * a[3];
+
+    float c5 = a[10] * a[15] - a[14] * a[11];
+    float c4 = a[9] * a[15] - a[13] * a[11];
+    float c3 = a[9] * a[14] - a[13] * a[10];
+    float c2 = a[8] * a[15] - a[12] * a[11];
+    float c1 = a[8] * a[14] - a[12] * a[10];
+    float c0 = a[8] * a[13] - a[12] * a[9];
+
+    float det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+    if (det == 0.0f) {
+        return fe_mat4_identity();
+    }
+    float inv_det = 1.0f / det;
+
+    fe_mat4_t result;
+    float* r = result.m;
+    r[0]  = ( a[5] * c5 - a[6] * c4 + a[7] * c3) * inv_det;
+    r[1]  = (-a[1] * c5 + a[2] * c4 - a[3] * c3) * inv_det;
+    r[2]  = ( a[13] * s5 - a[14] * s4 + a[15] * s3) * inv_det;
+    r[3]  = (-a[9] * s5 + a[10] * s4 - a[11] * s3) * inv_det;
+
+    r[4]  = (-a[4] * c5 + a[6] * c2 - a[7] * c1) * inv_det;
+    r[5]  = ( a[0] * c5 - a[2] * c2 + a[3] * c1) * inv_det;
+    r[6]  = (-a[12] * s5 + a[14] * s2 - a[15] * s1) * inv_det;
+    r[7]  = ( a[8] * s5 - a[10] * s2 + a[11] * s1) * inv_det;
+
+    r[8]  = ( a[4] * c4 - a[5] * c2 + a[7] * c0) * inv_det;
+    r[9]  = (-a[0] * c4 + a[1] * c2 - a[3] * c0) * inv_det;
+    r[10] = ( a[12] * s4 - a[13] * s2 + a[15] * s0) * inv_det;
+    r[11] = (-a[8] * s4 + a[9] * s2 - a[11] * s0) * inv_det;
+
+    r[12] = (-a[4] * c3 + a[5] * c1 - a[6] * c0) * inv_det;
+    r[13] = ( a[0] * c3 - a[1] * c1 + a[2] * c0) * inv_det;
+    r[14] = (-a[12] * s3 + a[13] * s1 - a[14] * s0) * inv_det;
+    r[15] = ( a[8] * s3 - a[9] * s1 + a[10] * s0) * inv_det;
+    return result;
 }
 
 /**
@@ -0,0 +1,121 @@
+// src/memory/fe_allocator_linear.c
+
+#include "memory/fe_allocator_linear.h"
+#include "utils/fe_logger.h"
+#include <string.h> // memset
+
+// ----------------------------------------------------------------------
+// 1. DOĞRUSAL AYIRICI UYGULAMALARI
+// ----------------------------------------------------------------------
+
+/**
+ * Uygulama: fe_linear_init
+ */
+fe_error_code_t fe_linear_init(fe_linear_allocator_t* allocator, void* buffer, size_t buffer_size) {
+    if (!allocator || !buffer || buffer_size == 0) {
+        FE_LOG_ERROR("fe_linear_init: Gecersiz arguman.");
+        return FE_ERR_INVALID_ARGUMENT;
+    }
+
+    allocator->start = (uint8_t*)buffer;
+    allocator->size = buffer_size;
+    allocator->offset = 0;
+    allocator->peak = 0;
+    allocator->poison_on_reset = FE_MEMORY_DEBUG_POISON;
+
+    if (allocator->poison_on_reset) {
+        memset(allocator->start, FE_LINEAR_POISON_BYTE, buffer_size);
+    }
+    return FE_OK;
+}
+
+/**
+ * Uygulama: fe_linear_alloc_aligned
+ */
+void* fe_linear_alloc_aligned(fe_linear_allocator_t* allocator, size_t size, size_t alignment) {
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+        FE_LOG_ERROR("fe_linear_alloc_aligned: Hizalama 2'nin kuvveti olmali (%zu).", alignment);
+        return NULL;
+    }
+
+    // Hizalama mutlak adrese göre yapılır (arabellek başlangıcı hizalı olmayabilir).
+    uintptr_t current = (uintptr_t)(allocator->start + allocator->offset);
+    uintptr_t aligned = (current + (alignment - 1)) & ~(uintptr_t)(alignment - 1);
+    size_t new_offset = (size_t)(aligned - (uintptr_t)allocator->start) + size;
+
+    if (new_offset > allocator->size || new_offset < allocator->offset) {
+        FE_LOG_WARN("fe_linear_alloc: Yer yetersiz. Istenen %zu Byte, kalan %zu Byte.",
+                    size, allocator->size - allocator->offset);
+        return NULL;
+    }
+
+    allocator->offset = new_offset;
+    if (new_offset > allocator->peak) {
+        allocator->peak = new_offset;
+    }
+    return (void*)aligned;
+}
+
+/**
+ * Uygulama: fe_linear_alloc
+ */
+void* fe_linear_alloc(fe_linear_allocator_t* allocator, size_t size) {
+    return fe_linear_alloc_aligned(allocator, size, FE_LINEAR_DEFAULT_ALIGNMENT);
+}
+
+/**
+ * Uygulama: fe_linear_rewind
+ */
+void fe_linear_rewind(fe_linear_allocator_t* allocator, fe_linear_marker_t marker) {
+    if (marker > allocator->offset) {
+        FE_LOG_ERROR("fe_linear_rewind: Isaret (%zu) mevcut ofsetin (%zu) ilerisinde.", marker, allocator->offset);
+        return;
+    }
+
+    // Debug: boşaltılan bölgeyi zehirle; ömrü bitmiş işaretçiler hemen fark edilir.
+    if (allocator->poison_on_reset) {
+        memset(allocator->start + marker, FE_LINEAR_POISON_BYTE, allocator->offset - marker);
+    }
+    allocator->offset = marker;
+}
+
+/**
+ * Uygulama: fe_linear_reset
+ */
+void fe_linear_reset(fe_linear_allocator_t* allocator) {
+    fe_linear_rewind(allocator, 0);
+}
+
+
+// ----------------------------------------------------------------------
+// 2. KARE ARENASI UYGULAMALARI
+// ----------------------------------------------------------------------
+
+/**
+ * Uygulama: fe_frame_arena_init
+ */
+fe_error_code_t fe_frame_arena_init(fe_frame_arena_t* arena, void* buffer, size_t buffer_size) {
+    if (!arena || !buffer) {
+        return FE_ERR_INVALID_ARGUMENT;
+    }
+
+    size_t half = buffer_size / 2;
+    fe_error_code_t err = fe_linear_init(&arena->buffers[0], buffer, half);
+    if (err != FE_OK) return err;
+    err = fe_linear_init(&arena->buffers[1], (uint8_t*)buffer + half, half);
+    if (err != FE_OK) return err;
+
+    arena->current = 0;
+    arena->frame_index = 0;
+    return FE_OK;
+}
+
+/**
+ * Uygulama: fe_frame_arena_begin_frame
+ */
+void fe_frame_arena_begin_frame(fe_frame_arena_t* arena) {
+    // Sıradaki tampon iki kare önce doldurulmuştu; artık kimse ona başvurmamalı.
+    arena->current ^= 1;
+    fe_linear_reset(&arena->buffers[arena->current]);
+    arena->frame_index++;
+}
\ No newline at end of file
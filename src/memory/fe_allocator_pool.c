@@ -28,6 +28,53 @@ static size_t fe_pool_get_actual_chunk_size(size_t chunk_size) {
     return actual_size;
 }
 
+/**
+ * @brief Blok adresini serbest yığın indeksine çevirir (0 = NULL).
+ */
+static inline uint32_t fe_pool_node_to_index(const fe_allocator_pool_t* pool, const fe_free_node_t* node) {
+    if (node == NULL) return 0;
+    return (uint32_t)(((const uint8_t*)node - pool->pool_start) / pool->block_stride) + 1;
+}
+
+/**
+ * @brief Serbest yığın indeksini blok adresine çevirir.
+ */
+static inline fe_free_node_t* fe_pool_index_to_node(const fe_allocator_pool_t* pool, uint32_t index) {
+    if (index == 0) return NULL;
+    return (fe_free_node_t*)(pool->pool_start + (size_t)(index - 1) * pool->block_stride);
+}
+
+/**
+ * @brief Bir bloğu serbest yığına kilitsiz olarak iter.
+ */
+static void fe_pool_push_free(fe_allocator_pool_t* pool, fe_free_node_t* node) {
+    uint32_t index = fe_pool_node_to_index(pool, node);
+    uint64_t head = fe_atomic_load_u64(&pool->free_list);
+    uint64_t desired;
+    do {
+        node->next = fe_pool_index_to_node(pool, (uint32_t)head);
+        desired = (((head >> 32) + 1) << 32) | index;
+    } while (!fe_atomic_cas_u64(&pool->free_list, &head, desired));
+}
+
+/**
+ * @brief Serbest yığından kilitsiz olarak bir blok alır. Havuz doluysa NULL.
+ * * next okuması, blok bu arada başka bir iş parçacığınca alınıp kullanılmışsa eski
+ * * olabilir; bu durumda etiket değiştiği için CAS başarısız olur ve yeniden denenir.
+ */
+static fe_free_node_t* fe_pool_pop_free(fe_allocator_pool_t* pool) {
+    uint64_t head = fe_atomic_load_u64(&pool->free_list);
+    while ((uint32_t)head != 0) {
+        fe_free_node_t* node = fe_pool_index_to_node(pool, (uint32_t)head);
+        fe_free_node_t* next = ((volatile fe_free_node_t*)node)->next;
+        uint64_t desired = (((head >> 32) + 1) << 32) | fe_pool_node_to_index(pool, next);
+        if (fe_atomic_cas_u64(&pool->free_list, &head, desired)) {
+            return node;
+        }
+    }
+    return NULL;
+}
+
 /**
  * Uygulama: fe_pool_init
  * Havuz Ayırıcıyı başlatır.
@@ -40,6 +87,7 @@ fe_error_code_t fe_pool_init(fe_allocator_pool_t* pool, size_t buffer_size, size
 
     size_t actual_chunk_size = fe_pool_get_actual_chunk_size(chunk_size);
     pool->chunk_size = chunk_size;
+    pool->block_stride = actual_chunk_size;
     pool->total_size = buffer_size;
     pool->block_count = buffer_size / actual_chunk_size;
     
@@ -47,6 +95,11 @@ fe_error_code_t fe_pool_init(fe_allocator_pool_t* pool, size_t buffer_size, size
         FE_LOG_ERROR("Havuz boyutu, tek bir nesneyi bile tutmaya yetmiyor.");
         return FE_ERR_INVALID_ARGUMENT;
     }
+    // Serbest yığın 32-bit blok indeksleri kullanır.
+    if (pool->block_count >= UINT32_MAX) {
+        FE_LOG_ERROR("Havuz blok sayisi (%zu) 32-bit indeks sinirini asiyor.", pool->block_count);
+        return FE_ERR_INVALID_ARGUMENT;
+    }
 
     // Bellek tahsisi (Dinamik veya Statik)
     if (memory_buffer == NULL) {
@@ -65,7 +118,8 @@ fe_error_code_t fe_pool_init(fe_allocator_pool_t* pool, size_t buffer_size, size
     }
 
     // 1. Serbest Listeyi (Free List) Oluşturma (Tüm blokları birbirine bağlama)
-    pool->free_list = (fe_free_node_t*)pool->pool_start;
+    // Henüz başka iş parçacığı havuzu görmediğinden atomik işlem gerekmez.
+    pool->free_list = fe_pool_node_to_index(pool, (fe_free_node_t*)pool->pool_start);
     pool->allocated_count = 0;
     
     uint8_t* current_block = pool->pool_start;
@@ -89,17 +143,17 @@ fe_error_code_t fe_pool_init(fe_allocator_pool_t* pool, size_t buffer_size, size
 fe_owned_ptr_t fe_pool_allocate(fe_allocator_pool_t* pool) {
     fe_owned_ptr_t owned_ptr = { .data = NULL, .metadata = NULL };
 
-    if (pool->free_list == NULL) {
+    // 1. Serbest Listeden Bloğu Al (kilitsiz)
+    uint8_t* raw_block = (uint8_t*)fe_pool_pop_free(pool);
+    if (raw_block == NULL) {
         FE_LOG_WARN("Havuz dolu! Tahsis yapilamiyor.");
         return owned_ptr;
     }
-
-    // 1. Serbest Listeden Bloğu Al
-    uint8_t* raw_block = (uint8_t*)pool->free_list;
-    pool->free_list = pool->free_list->next;
-    pool->allocated_count++;
+    uint64_t allocated = fe_atomic_fetch_add_u64(&pool->allocated_count, 1) + 1;
 
     // 2. Meta Veriyi Ayarla (Bloğun en başı)
+    // Blok henüz yayınlanmadığından düz yazma yeterlidir; paylaşım sırasında
+    // (kuyruk, atomik işaretçi vb.) release/acquire sıralaması sağlanır.
     fe_block_metadata_t* metadata = (fe_block_metadata_t*)raw_block;
     metadata->ref_count = 1; // Sahiplik Başladı
     metadata->owner_pool = pool;
@@ -111,7 +165,7 @@ fe_owned_ptr_t fe_pool_allocate(fe_allocator_pool_t* pool) {
     owned_ptr.data = user_data;
     owned_ptr.metadata = metadata;
     
-    FE_LOG_TRACE("Tahsis edildi. Havuzdaki Tahsis Edilmis Blok: %zu", pool->allocated_count);
+    FE_LOG_TRACE("Tahsis edildi. Havuzdaki Tahsis Edilmis Blok: %zu", (size_t)allocated);
 
     return owned_ptr;
 }
@@ -126,10 +180,10 @@ fe_owned_ptr_t fe_owned_ptr_clone(const fe_owned_ptr_t* owned_ptr) {
         return null_ptr;
     }
     
-    // Kritik İşlem: Referans Sayacını Artır
-    owned_ptr->metadata->ref_count++;
+    // Kritik İşlem: Referans Sayacını Atomik Olarak Artır
+    uint32_t new_count = fe_atomic_fetch_add_u32(&owned_ptr->metadata->ref_count, 1) + 1;
     
-    FE_LOG_TRACE("Ref Sayaci artirildi. Yeni Sayi: %u", owned_ptr->metadata->ref_count);
+    FE_LOG_TRACE("Ref Sayaci artirildi. Yeni Sayi: %u", new_count);
 
     // Yeni Sahip olunan pointer, aynı meta veriye işaret eder.
     return *owned_ptr; 
@@ -144,12 +198,14 @@ void fe_owned_ptr_release(fe_owned_ptr_t owned_ptr) {
         return; 
     }
 
-    // Kritik İşlem: Referans Sayacını Azalt
-    owned_ptr.metadata->ref_count--;
+    // Kritik İşlem: Referans Sayacını Atomik Olarak Azalt
+    // Sadece sayacı 1'den 0'a düşüren iş parçacığı bloğu iade eder (seq_cst sıralama,
+    // diğer sahiplerin yazmalarının iadeden önce görünmesini sağlar).
+    uint32_t new_count = fe_atomic_fetch_sub_u32(&owned_ptr.metadata->ref_count, 1) - 1;
     
-    FE_LOG_TRACE("Ref Sayaci azaltildi. Yeni Sayi: %u", owned_ptr.metadata->ref_count);
+    FE_LOG_TRACE("Ref Sayaci azaltildi. Yeni Sayi: %u", new_count);
 
-    if (owned_ptr.metadata->ref_count == 0) {
+    if (new_count == 0) {
         // Sahiplik sona erdi, belleği havuza geri ver.
         fe_allocator_pool_t* pool = owned_ptr.metadata->owner_pool;
         if (pool == NULL) {
@@ -160,12 +216,10 @@ void fe_owned_ptr_release(fe_owned_ptr_t owned_ptr) {
         // 1. Kullanıcı veri alanından (data) geriye, raw bellek bloğuna git
         uint8_t* raw_block = (uint8_t*)owned_ptr.data - METADATA_SIZE;
         
-        // 2. Bloğu serbest listenin başına ekle
-        fe_free_node_t* released_node = (fe_free_node_t*)raw_block;
-        released_node->next = pool->free_list;
-        pool->free_list = released_node;
+        // 2. Bloğu serbest yığının tepesine ekle (kilitsiz)
+        fe_atomic_fetch_sub_u64(&pool->allocated_count, 1);
+        fe_pool_push_free(pool, (fe_free_node_t*)raw_block);
         
-        pool->allocated_count--;
         FE_LOG_DEBUG("Bellek bloğu serbest birakildi ve havuza geri eklendi.");
     }
     // Aksi takdirde, hala ödünç alanlar (ref_count > 0) olduğundan serbest bırakılmaz.
@@ -181,11 +235,11 @@ void fe_pool_destroy(fe_allocator_pool_t* pool) {
     
     if (pool->is_dynamic && pool->pool_start != NULL) {
         if (pool->allocated_count > 0) {
-            FE_LOG_WARN("Dinamik Havuz yok ediliyor, ancak hala %zu adet tahsis edilmis blok var. Bellek sizintisi olabilir!", pool->allocated_count);
+            FE_LOG_WARN("Dinamik Havuz yok ediliyor, ancak hala %zu adet tahsis edilmis blok var. Bellek sizintisi olabilir!", (size_t)pool->allocated_count);
         }
         free(pool->pool_start);
         pool->pool_start = NULL;
-        pool->free_list = NULL;
+        pool->free_list = 0;
         pool->allocated_count = 0;
         FE_LOG_INFO("Dinamik Havuz basariyla yok edildi.");
     } else if (!pool->is_dynamic) {
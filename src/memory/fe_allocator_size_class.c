@@ -0,0 +1,326 @@
+// src/memory/fe_allocator_size_class.c
+
+#include "memory/fe_allocator_size_class.h"
+#include "platform/fe_thread.h" // FE_THREAD_LOCAL
+#include "utils/fe_logger.h"
+#include <string.h> // memset
+
+// Blok indeksleri 16 byte birimindedir (32-bit indeks ile 64 GB'a kadar bölge)
+#define FE_SIZE_CLASS_INDEX_SHIFT   4
+#define FE_SIZE_CLASS_REGION_ALIGN  64
+
+// Hiç ayrılmamış span'i belirten tablo değeri
+#define FE_SIZE_CLASS_SPAN_UNASSIGNED 0xFF
+
+// ----------------------------------------------------------------------
+// 1. İÇ YAPILAR
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Serbest bir bloğun içine yazılan bağlantı bilgisi (en küçük sınıf 16 byte).
+ */
+typedef struct fe_size_class_free_block {
+    struct fe_size_class_free_block* next; // Aynı gruptaki (veya önbellekteki) sonraki blok
+    uint32_t next_batch;                   // Global yığında bir sonraki grubun indeksi (+1, 0 = yok)
+    uint32_t batch_count;                  // Bu blokla başlayan gruptaki blok sayısı
+} fe_size_class_free_block_t;
+
+/**
+ * @brief Bir iş parçacığının tek sınıf için yerel serbest listesi.
+ */
+typedef struct fe_size_class_cache_bin {
+    fe_size_class_free_block_t* head;
+    uint32_t count;
+} fe_size_class_cache_bin_t;
+
+/**
+ * @brief İş parçacığı önbelleği. Sadece sahibi erişir, kilit veya atomik gerekmez.
+ */
+typedef struct fe_size_class_thread_cache {
+    const fe_size_class_allocator_t* owner;
+    uint32_t generation;
+    fe_size_class_cache_bin_t bins[FE_SIZE_CLASS_COUNT];
+} fe_size_class_thread_cache_t;
+
+static FE_THREAD_LOCAL fe_size_class_thread_cache_t t_fe_size_class_cache;
+
+// Başlatılan her ayırıcıya farklı bir nesil numarası verilir
+static fe_atomic_u32_t g_fe_size_class_generation = 0;
+
+
+// ----------------------------------------------------------------------
+// 2. YARDIMCI FONKSİYONLAR
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Sınıf indeksinden blok boyutunu hesaplar (fe_size_class_index'in tersi).
+ */
+static uint32_t fe_size_class_block_size_of(uint32_t class_index) {
+    if (class_index < 8) {
+        return (class_index + 1) * 16;
+    }
+    uint32_t range = (class_index - 8) / 4;
+    uint32_t step = (class_index - 8) % 4;
+    uint32_t base = 128u << range;
+    return base + (step + 1) * (base / 4);
+}
+
+static inline uint32_t fe_size_class_block_to_index(const fe_size_class_allocator_t* allocator, const void* block) {
+    return (uint32_t)(((const uint8_t*)block - allocator->region_start) >> FE_SIZE_CLASS_INDEX_SHIFT) + 1;
+}
+
+static inline fe_size_class_free_block_t* fe_size_class_index_to_block(const fe_size_class_allocator_t* allocator, uint32_t index) {
+    return (fe_size_class_free_block_t*)(allocator->region_start + ((size_t)(index - 1) << FE_SIZE_CLASS_INDEX_SHIFT));
+}
+
+/**
+ * @brief Çağıran iş parçacığının önbelleğini döndürür; başka bir ayırıcıya veya eski bir
+ * * nesle aitse önbelleği sıfırlar (eski bloklar zaten geçersizdir).
+ */
+static inline fe_size_class_thread_cache_t* fe_size_class_get_cache(const fe_size_class_allocator_t* allocator) {
+    fe_size_class_thread_cache_t* cache = &t_fe_size_class_cache;
+    if (cache->owner != allocator || cache->generation != allocator->generation) {
+        memset(cache, 0, sizeof(*cache));
+        cache->owner = allocator;
+        cache->generation = allocator->generation;
+    }
+    return cache;
+}
+
+/**
+ * @brief NULL ile sonlanan bir blok grubunu global yığına iter (kilitsiz).
+ */
+static void fe_size_class_push_batch(fe_size_class_allocator_t* allocator, fe_size_class_bin_t* bin,
+                                     fe_size_class_free_block_t* first, uint32_t count) {
+    uint32_t index = fe_size_class_block_to_index(allocator, first);
+    first->batch_count = count;
+
+    uint64_t head = fe_atomic_load_u64(&bin->batch_head);
+    uint64_t desired;
+    do {
+        first->next_batch = (uint32_t)head;
+        desired = (((head >> 32) + 1) << 32) | index;
+    } while (!fe_atomic_cas_u64(&bin->batch_head, &head, desired));
+}
+
+/**
+ * @brief Global yığından bir blok grubu alır (kilitsiz). Yığın boşsa NULL.
+ * * next_batch okuması, grup bu arada başka bir iş parçacığınca alınmışsa eski olabilir;
+ * * bu durumda etiket değiştiği için CAS başarısız olur ve döngü tekrarlanır.
+ */
+static fe_size_class_free_block_t* fe_size_class_pop_batch(fe_size_class_allocator_t* allocator, fe_size_class_bin_t* bin) {
+    uint64_t head = fe_atomic_load_u64(&bin->batch_head);
+    while ((uint32_t)head != 0) {
+        fe_size_class_free_block_t* first = fe_size_class_index_to_block(allocator, (uint32_t)head);
+        uint32_t next = ((volatile fe_size_class_free_block_t*)first)->next_batch;
+        uint64_t desired = (((head >> 32) + 1) << 32) | next;
+        if (fe_atomic_cas_u64(&bin->batch_head, &head, desired)) {
+            return first;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Bölgeden yeni bir span ayırır ve bloklarına böler.
+ * * İlk grup çağıranın önbelleğine, geri kalanlar global yığına gider.
+ * @return Başarılıysa true; bölgede boş span kalmadıysa false.
+ */
+static bool fe_size_class_carve_span(fe_size_class_allocator_t* allocator, uint32_t class_index,
+                                     fe_size_class_cache_bin_t* cache_bin) {
+    if (fe_atomic_load_u32(&allocator->span_next) >= allocator->span_total) {
+        return false;
+    }
+    uint32_t span = fe_atomic_fetch_add_u32(&allocator->span_next, 1);
+    if (span >= allocator->span_total) {
+        return false;
+    }
+
+    fe_size_class_bin_t* bin = &allocator->bins[class_index];
+    allocator->span_class[span] = (uint8_t)class_index;
+    fe_atomic_fetch_add_u32(&bin->span_count, 1);
+
+    uint8_t* base = allocator->region_start + (size_t)span * FE_SIZE_CLASS_SPAN_SIZE;
+    uint32_t block_size = bin->block_size;
+    uint32_t block_count = (uint32_t)(FE_SIZE_CLASS_SPAN_SIZE / block_size);
+
+    // Blokları gruplar halinde bağla
+    uint32_t i = 0;
+    bool first_batch = true;
+    while (i < block_count) {
+        uint32_t count = block_count - i;
+        if (count > bin->batch_size) count = bin->batch_size;
+
+        fe_size_class_free_block_t* first = (fe_size_class_free_block_t*)(base + (size_t)i * block_size);
+        fe_size_class_free_block_t* block = first;
+        for (uint32_t j = 1; j < count; ++j) {
+            fe_size_class_free_block_t* next = (fe_size_class_free_block_t*)((uint8_t*)block + block_size);
+            block->next = next;
+            block = next;
+        }
+        block->next = NULL;
+
+        if (first_batch) {
+            cache_bin->head = first;
+            cache_bin->count = count;
+            first_batch = false;
+        } else {
+            fe_size_class_push_batch(allocator, bin, first, count);
+        }
+        i += count;
+    }
+    return true;
+}
+
+
+// ----------------------------------------------------------------------
+// 3. YÖNETİM VE İŞLEMLER
+// ----------------------------------------------------------------------
+
+/**
+ * Uygulama: fe_size_class_init
+ */
+fe_error_code_t fe_size_class_init(fe_size_class_allocator_t* allocator, void* buffer, size_t buffer_size) {
+    if (!allocator || !buffer) {
+        FE_LOG_ERROR("fe_size_class_init: Gecersiz arguman.");
+        return FE_ERR_INVALID_ARGUMENT;
+    }
+    memset(allocator, 0, sizeof(*allocator));
+
+    // Span tablosu arabelleğin başında tutulur, bölge ondan sonra 64 byte hizalı başlar.
+    size_t span_total = buffer_size / (FE_SIZE_CLASS_SPAN_SIZE + 1);
+    uintptr_t table_end = (uintptr_t)buffer + span_total;
+    uintptr_t region = (table_end + FE_SIZE_CLASS_REGION_ALIGN - 1) & ~(uintptr_t)(FE_SIZE_CLASS_REGION_ALIGN - 1);
+    while (span_total > 0 && region + span_total * FE_SIZE_CLASS_SPAN_SIZE > (uintptr_t)buffer + buffer_size) {
+        --span_total;
+    }
+    // Blok indeksleri 32-bit olduğu için bölge 64 GB ile sınırlıdır.
+    size_t max_spans = ((size_t)UINT32_MAX << FE_SIZE_CLASS_INDEX_SHIFT) >> FE_SIZE_CLASS_SPAN_SHIFT;
+    if (span_total > max_spans) span_total = max_spans;
+
+    if (span_total == 0) {
+        FE_LOG_ERROR("fe_size_class_init: Arabellek en az bir span (%zu Byte) icin yetersiz.", FE_SIZE_CLASS_SPAN_SIZE);
+        return FE_ERR_INVALID_ARGUMENT;
+    }
+
+    allocator->span_class = (uint8_t*)buffer;
+    allocator->span_total = (uint32_t)span_total;
+    allocator->region_start = (uint8_t*)region;
+    allocator->region_size = span_total * FE_SIZE_CLASS_SPAN_SIZE;
+    memset(allocator->span_class, FE_SIZE_CLASS_SPAN_UNASSIGNED, span_total);
+
+    for (uint32_t c = 0; c < FE_SIZE_CLASS_COUNT; ++c) {
+        fe_size_class_bin_t* bin = &allocator->bins[c];
+        bin->block_size = fe_size_class_block_size_of(c);
+        uint32_t batch = FE_SIZE_CLASS_BATCH_BYTES / bin->block_size;
+        if (batch < 2) batch = 2;
+        if (batch > FE_SIZE_CLASS_MAX_BATCH) batch = FE_SIZE_CLASS_MAX_BATCH;
+        bin->batch_size = batch;
+    }
+
+    // Nesil 0 hiçbir zaman kullanılmaz (sıfırlanmış önbellekler hiçbir ayırıcıya ait değildir).
+    uint32_t generation;
+    do {
+        generation = fe_atomic_fetch_add_u32(&g_fe_size_class_generation, 1) + 1;
+    } while (generation == 0);
+    allocator->generation = generation;
+
+    FE_LOG_INFO("Boyut sinifli ayirici baslatildi: %u span (%.2f MB), %d sinif (%d - %d Byte).",
+                allocator->span_total, (double)allocator->region_size / (1024.0 * 1024.0),
+                FE_SIZE_CLASS_COUNT, FE_SIZE_CLASS_MIN_SIZE, FE_SIZE_CLASS_MAX_SIZE);
+    return FE_OK;
+}
+
+/**
+ * Uygulama: fe_size_class_destroy
+ */
+void fe_size_class_destroy(fe_size_class_allocator_t* allocator) {
+    if (!allocator) return;
+    // Bölge ve tablo arabelleğin sahibine aittir; burada sadece durum sıfırlanır.
+    memset(allocator, 0, sizeof(*allocator));
+}
+
+/**
+ * Uygulama: fe_size_class_alloc
+ */
+void* fe_size_class_alloc(fe_size_class_allocator_t* allocator, size_t size) {
+    if (size > FE_SIZE_CLASS_MAX_SIZE || allocator->region_start == NULL) {
+        return NULL;
+    }
+    if (size == 0) size = 1;
+
+    uint32_t class_index = fe_size_class_index(size);
+    fe_size_class_cache_bin_t* cache_bin = &fe_size_class_get_cache(allocator)->bins[class_index];
+
+    fe_size_class_free_block_t* block = cache_bin->head;
+    if (block == NULL) {
+        // Yavaş yol: global yığından bir grup al, yoksa yeni span ayır.
+        fe_size_class_free_block_t* batch = fe_size_class_pop_batch(allocator, &allocator->bins[class_index]);
+        if (batch != NULL) {
+            cache_bin->head = batch;
+            cache_bin->count = batch->batch_count;
+        } else if (!fe_size_class_carve_span(allocator, class_index, cache_bin)) {
+            return NULL;
+        }
+        block = cache_bin->head;
+    }
+
+    cache_bin->head = block->next;
+    cache_bin->count--;
+    return block;
+}
+
+/**
+ * Uygulama: fe_size_class_free
+ */
+void fe_size_class_free(fe_size_class_allocator_t* allocator, void* ptr) {
+    if (ptr == NULL) return;
+
+    size_t span = (size_t)((uint8_t*)ptr - allocator->region_start) >> FE_SIZE_CLASS_SPAN_SHIFT;
+    uint32_t class_index = allocator->span_class[span];
+    fe_size_class_bin_t* bin = &allocator->bins[class_index];
+    fe_size_class_cache_bin_t* cache_bin = &fe_size_class_get_cache(allocator)->bins[class_index];
+
+    fe_size_class_free_block_t* block = (fe_size_class_free_block_t*)ptr;
+    block->next = cache_bin->head;
+    cache_bin->head = block;
+    cache_bin->count++;
+
+    // Önbellek iki grup boyutuna ulaştıysa ilk grubu global yığına iade et.
+    if (cache_bin->count >= 2 * bin->batch_size) {
+        fe_size_class_free_block_t* first = cache_bin->head;
+        fe_size_class_free_block_t* last = first;
+        for (uint32_t i = 1; i < bin->batch_size; ++i) {
+            last = last->next;
+        }
+        cache_bin->head = last->next;
+        cache_bin->count -= bin->batch_size;
+        last->next = NULL;
+        fe_size_class_push_batch(allocator, bin, first, bin->batch_size);
+    }
+}
+
+/**
+ * Uygulama: fe_size_class_usable_size
+ */
+size_t fe_size_class_usable_size(const fe_size_class_allocator_t* allocator, const void* ptr) {
+    size_t span = (size_t)((const uint8_t*)ptr - allocator->region_start) >> FE_SIZE_CLASS_SPAN_SHIFT;
+    return allocator->bins[allocator->span_class[span]].block_size;
+}
+
+/**
+ * Uygulama: fe_size_class_thread_flush
+ */
+void fe_size_class_thread_flush(fe_size_class_allocator_t* allocator) {
+    if (!allocator || allocator->region_start == NULL) return;
+
+    fe_size_class_thread_cache_t* cache = fe_size_class_get_cache(allocator);
+    for (uint32_t c = 0; c < FE_SIZE_CLASS_COUNT; ++c) {
+        fe_size_class_cache_bin_t* cache_bin = &cache->bins[c];
+        if (cache_bin->head != NULL) {
+            fe_size_class_push_batch(allocator, &allocator->bins[c], cache_bin->head, cache_bin->count);
+            cache_bin->head = NULL;
+            cache_bin->count = 0;
+        }
+    }
+}
\ No newline at end of file
@@ -14,7 +14,8 @@ fe_memory_manager_t g_fe_memory_manager = {0};
  */
 fe_error_code_t fe_memory_manager_init(void) {
     fe_error_code_t err = FE_OK;
-    size_t total_required_size = FE_MEMORY_SIZE_GENERAL + FE_MEMORY_SIZE_GRAPHICS_DATA + FE_MEMORY_SIZE_EDITOR_DATA;
+    size_t total_required_size = FE_MEMORY_SIZE_GENERAL + FE_MEMORY_SIZE_GRAPHICS_DATA + FE_MEMORY_SIZE_EDITOR_DATA +
+                                 FE_MEMORY_SIZE_SIZE_CLASS + FE_MEMORY_SIZE_FRAME_ARENA;
     
     FE_LOG_INFO("Bellek Yonetimi baslatiliyor. Toplam tahsis edilecek sanal bellek: %.2f MB", 
                 (double)total_required_size / (1024.0 * 1024.0));
@@ -37,7 +38,8 @@ fe_error_code_t fe_memory_manager_init(void) {
                        FE_MEMORY_SIZE_GENERAL, 
                        64, // Örnek chunk boyutu
                        current_offset);
-    if (FE_CHECK(err) != FE_OK) return err;
+    FE_CHECK(err);
+    if (err != FE_OK) return err;
     current_offset += FE_MEMORY_SIZE_GENERAL;
     
     // --- Grafik Veri Havuzu (Örn: GeometryV Küme Verileri, 1024 byte) ---
@@ -45,7 +47,8 @@ fe_error_code_t fe_memory_manager_init(void) {
                        FE_MEMORY_SIZE_GRAPHICS_DATA, 
                        1024, // Örnek chunk boyutu
                        current_offset);
-    if (FE_CHECK(err) != FE_OK) return err;
+    FE_CHECK(err);
+    if (err != FE_OK) return err;
     current_offset += FE_MEMORY_SIZE_GRAPHICS_DATA;
     
     // --- Editör Veri Havuzu (Örn: UI Widget'ları, 32 byte) ---
@@ -53,7 +56,24 @@ fe_error_code_t fe_memory_manager_init(void) {
                        FE_MEMORY_SIZE_EDITOR_DATA, 
                        32, // Örnek chunk boyutu
                        current_offset);
-    if (FE_CHECK(err) != FE_OK) return err;
+    FE_CHECK(err);
+    if (err != FE_OK) return err;
+    current_offset += FE_MEMORY_SIZE_EDITOR_DATA;
+    
+    // --- Boyut Sınıflı Genel Ayırıcı (16 B - 32 KB, fe_mem_alloc) ---
+    err = fe_size_class_init(&g_fe_memory_manager.general_allocator,
+                             current_offset,
+                             FE_MEMORY_SIZE_SIZE_CLASS);
+    FE_CHECK(err);
+    if (err != FE_OK) return err;
+    current_offset += FE_MEMORY_SIZE_SIZE_CLASS;
+    
+    // --- Kare Arenası (Çift tamponlu, her karede sıfırlanır) ---
+    err = fe_frame_arena_init(&g_fe_memory_manager.frame_arena,
+                              current_offset,
+                              FE_MEMORY_SIZE_FRAME_ARENA);
+    FE_CHECK(err);
+    if (err != FE_OK) return err;
     // current_offset burada artık gerekmiyor
 
     FE_LOG_INFO("Bellek Yonetimi ve Tum Havuzlar Basariyla Baslatildi.");
@@ -73,6 +93,8 @@ void fe_memory_manager_shutdown(void) {
         
         // Statik havuzları kontrol et.
         // fe_pool_destroy(ve her havuz)
+        fe_size_class_destroy(&g_fe_memory_manager.general_allocator);
+        memset(&g_fe_memory_manager.frame_arena, 0, sizeof(g_fe_memory_manager.frame_arena));
 
         free(g_fe_memory_manager.main_memory_block);
         g_fe_memory_manager.main_memory_block = NULL;
@@ -90,3 +112,116 @@ fe_owned_ptr_t fe_mem_allocate_from_pool(fe_allocator_pool_t* pool) {
     // Doğrudan fe_pool_allocate fonksiyonunu çağırır.
     return fe_pool_allocate(pool);
 }
+
+/**
+ * Uygulama: fe_mem_alloc
+ */
+void* fe_mem_alloc(size_t size) {
+    void* ptr = fe_size_class_alloc(&g_fe_memory_manager.general_allocator, size);
+    if (ptr == NULL) {
+        // Büyük istek, başlatılmamış yönetici veya dolu bölge: libc'ye düş.
+        ptr = malloc(size);
+    }
+    return ptr;
+}
+
+/**
+ * Uygulama: fe_mem_calloc
+ */
+void* fe_mem_calloc(size_t count, size_t size) {
+    if (size != 0 && count > SIZE_MAX / size) {
+        return NULL; // Taşma
+    }
+    size_t total = count * size;
+    void* ptr = fe_size_class_alloc(&g_fe_memory_manager.general_allocator, total);
+    if (ptr == NULL) {
+        return calloc(1, total ? total : 1);
+    }
+    memset(ptr, 0, total);
+    return ptr;
+}
+
+/**
+ * Uygulama: fe_mem_realloc
+ */
+void* fe_mem_realloc(void* ptr, size_t new_size) {
+    fe_size_class_allocator_t* allocator = &g_fe_memory_manager.general_allocator;
+    if (ptr == NULL) {
+        return fe_mem_alloc(new_size);
+    }
+    if (!fe_size_class_owns(allocator, ptr)) {
+        // Bir kez libc'ye taşınan blok orada büyür.
+        return realloc(ptr, new_size);
+    }
+
+    size_t old_size = fe_size_class_usable_size(allocator, ptr);
+    if (new_size <= old_size && new_size > old_size / 2) {
+        return ptr; // Aynı sınıfa sığıyor
+    }
+    void* new_ptr = fe_mem_alloc(new_size);
+    if (new_ptr == NULL) {
+        return NULL; // realloc gibi: eski blok geçerli kalır
+    }
+    memcpy(new_ptr, ptr, old_size < new_size ? old_size : new_size);
+    fe_size_class_free(allocator, ptr);
+    return new_ptr;
+}
+
+/**
+ * Uygulama: fe_mem_free
+ */
+void fe_mem_free(void* ptr) {
+    if (ptr == NULL) return;
+    if (fe_size_class_owns(&g_fe_memory_manager.general_allocator, ptr)) {
+        fe_size_class_free(&g_fe_memory_manager.general_allocator, ptr);
+    } else {
+        free(ptr);
+    }
+}
+
+/**
+ * Uygulama: fe_mem_thread_shutdown
+ */
+void fe_mem_thread_shutdown(void) {
+    fe_size_class_thread_flush(&g_fe_memory_manager.general_allocator);
+}
+
+/**
+ * Uygulama: fe_memory_manager_begin_frame
+ */
+void fe_memory_manager_begin_frame(void) {
+    if (g_fe_memory_manager.main_memory_block == NULL) return;
+    fe_frame_arena_begin_frame(&g_fe_memory_manager.frame_arena);
+}
+
+/**
+ * Uygulama: fe_frame_alloc
+ */
+void* fe_frame_alloc(size_t size) {
+    return fe_frame_alloc_aligned(size, FE_LINEAR_DEFAULT_ALIGNMENT);
+}
+
+/**
+ * Uygulama: fe_frame_alloc_aligned
+ */
+void* fe_frame_alloc_aligned(size_t size, size_t alignment) {
+    if (g_fe_memory_manager.main_memory_block == NULL) {
+        FE_LOG_ERROR("fe_frame_alloc: Bellek Yoneticisi baslatilmadi.");
+        return NULL;
+    }
+    return fe_linear_alloc_aligned(fe_frame_arena_current(&g_fe_memory_manager.frame_arena), size, alignment);
+}
+
+/**
+ * Uygulama: fe_frame_get_marker
+ */
+fe_linear_marker_t fe_frame_get_marker(void) {
+    return fe_linear_get_marker(fe_frame_arena_current(&g_fe_memory_manager.frame_arena));
+}
+
+/**
+ * Uygulama: fe_frame_rewind
+ */
+void fe_frame_rewind(fe_linear_marker_t marker) {
+    fe_linear_rewind(fe_frame_arena_current(&g_fe_memory_manager.frame_arena), marker);
+}
\ No newline at end of file
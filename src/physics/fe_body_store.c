@@ -0,0 +1,488 @@
+// src/physics/fe_body_store.c
+
+#include "physics/fe_body_store.h"
+#include "physics/fe_collider.h"  // fe_physics_quat_to_rows
+#include "utils/fe_logger.h"
+#include "memory/fe_memory_manager.h" // fe_mem_realloc, fe_mem_free
+#include <string.h> // memset
+#include <math.h>   // sqrtf
+#include "math/fe_simd.h" // fe_simd_t, FE_SIMD_WIDTH
+
+#ifdef FE_SIMD_WIDTH
+    #define FE_BODY_STORE_SIMD_WIDTH FE_SIMD_WIDTH
+#endif
+
+#define FE_BODY_STORE_STREAM_COUNT 26
+#define FE_BODY_STORE_DEFAULT_CAPACITY 256
+
+// fe_rigid_body.c
+fe_mat4_t fe_quat_to_mat4(fe_vec4_t q);
+
+static void fe_body_store_load_body(fe_body_store_t* store, uint32_t i, bool take_forces);
+
+// ----------------------------------------------------------------------
+// 1. SoA DİZİLERİ
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Deponun tüm float dizilerinin adreslerini sabit bir sırada döndürür.
+ */
+static uint32_t fe_body_store_streams(fe_body_store_t* store, float*** out_streams) {
+    out_streams[0]  = &store->position_x;
+    out_streams[1]  = &store->position_y;
+    out_streams[2]  = &store->position_z;
+    out_streams[3]  = &store->orientation_x;
+    out_streams[4]  = &store->orientation_y;
+    out_streams[5]  = &store->orientation_z;
+    out_streams[6]  = &store->orientation_w;
+    out_streams[7]  = &store->linear_velocity_x;
+    out_streams[8]  = &store->linear_velocity_y;
+    out_streams[9]  = &store->linear_velocity_z;
+    out_streams[10] = &store->angular_velocity_x;
+    out_streams[11] = &store->angular_velocity_y;
+    out_streams[12] = &store->angular_velocity_z;
+    out_streams[13] = &store->force_x;
+    out_streams[14] = &store->force_y;
+    out_streams[15] = &store->force_z;
+    out_streams[16] = &store->torque_x;
+    out_streams[17] = &store->torque_y;
+    out_streams[18] = &store->torque_z;
+    out_streams[19] = &store->inverse_mass;
+    out_streams[20] = &store->inverse_inertia_xx;
+    out_streams[21] = &store->inverse_inertia_xy;
+    out_streams[22] = &store->inverse_inertia_xz;
+    out_streams[23] = &store->inverse_inertia_yy;
+    out_streams[24] = &store->inverse_inertia_yz;
+    out_streams[25] = &store->inverse_inertia_zz;
+    return FE_BODY_STORE_STREAM_COUNT;
+}
+
+/**
+ * @brief Deponun kapasitesini new_capacity'ye büyütür; yeni yuvalar boş yuva listesine eklenir.
+ * @return Basariliysa true, degilse false (mevcut veriler korunur).
+ */
+static bool fe_body_store_reserve(fe_body_store_t* store, uint32_t new_capacity) {
+    if (new_capacity <= store->capacity) return true;
+
+    float** streams[FE_BODY_STORE_STREAM_COUNT];
+    uint32_t stream_count = fe_body_store_streams(store, streams);
+    for (uint32_t s = 0; s < stream_count; ++s) {
+        float* grown = (float*)fe_mem_realloc(*streams[s], new_capacity * sizeof(float));
+        if (!grown) goto fail;
+        *streams[s] = grown;
+    }
+
+    fe_rigid_body_t** bodies = (fe_rigid_body_t**)fe_mem_realloc(store->bodies, new_capacity * sizeof(fe_rigid_body_t*));
+    if (!bodies) goto fail;
+    store->bodies = bodies;
+
+    uint32_t** index_arrays[3] = { &store->dense_to_slot, &store->slot_index, &store->slot_generation };
+    for (uint32_t a = 0; a < 3; ++a) {
+        uint32_t* grown = (uint32_t*)fe_mem_realloc(*index_arrays[a], new_capacity * sizeof(uint32_t));
+        if (!grown) goto fail;
+        *index_arrays[a] = grown;
+    }
+
+    // Yeni yuvaları boş listenin başına bağla (küçük yuvalar önce kullanılır)
+    for (uint32_t s = store->capacity; s < new_capacity; ++s) {
+        store->slot_index[s] = (s + 1 < new_capacity) ? s + 1 : store->free_slot;
+        store->slot_generation[s] = 0;
+    }
+    store->free_slot = store->capacity;
+    store->capacity = new_capacity;
+    return true;
+
+fail:
+    FE_LOG_ERROR("Cisim deposu buyutulemedi. Kapasite %u", new_capacity);
+    return false;
+}
+
+
+// ----------------------------------------------------------------------
+// 2. YÖNETİM UYGULAMALARI
+// ----------------------------------------------------------------------
+
+/**
+ * Uygulama: fe_body_store_init
+ */
+fe_error_code_t fe_body_store_init(fe_body_store_t* store, uint32_t initial_capacity) {
+    if (!store) return FE_ERR_INVALID_ARGUMENT;
+    memset(store, 0, sizeof(*store));
+    store->free_slot = UINT32_MAX;
+
+    if (initial_capacity == 0) initial_capacity = FE_BODY_STORE_DEFAULT_CAPACITY;
+    if (!fe_body_store_reserve(store, initial_capacity)) {
+        fe_body_store_destroy(store);
+        return FE_ERR_MEMORY_ALLOCATION;
+    }
+    return FE_OK;
+}
+
+/**
+ * Uygulama: fe_body_store_destroy
+ */
+void fe_body_store_destroy(fe_body_store_t* store) {
+    if (!store) return;
+
+    float** streams[FE_BODY_STORE_STREAM_COUNT];
+    uint32_t stream_count = fe_body_store_streams(store, streams);
+    for (uint32_t s = 0; s < stream_count; ++s) {
+        fe_mem_free(*streams[s]);
+    }
+    fe_mem_free(store->bodies);
+    fe_mem_free(store->dense_to_slot);
+    fe_mem_free(store->slot_index);
+    fe_mem_free(store->slot_generation);
+    memset(store, 0, sizeof(*store));
+    store->free_slot = UINT32_MAX;
+}
+
+/**
+ * Uygulama: fe_body_store_add
+ */
+fe_body_handle_t fe_body_store_add(fe_body_store_t* store, fe_rigid_body_t* rb) {
+    if (store->count == store->capacity) {
+        uint32_t new_capacity = store->capacity ? store->capacity * 2 : FE_BODY_STORE_DEFAULT_CAPACITY;
+        if (!fe_body_store_reserve(store, new_capacity)) return FE_BODY_HANDLE_NULL;
+    }
+
+    uint32_t slot = store->free_slot;
+    store->free_slot = store->slot_index[slot];
+
+    uint32_t index = store->count++;
+    store->slot_index[slot] = index;
+    store->dense_to_slot[index] = slot;
+    store->bodies[index] = rb;
+
+    // Kuvvetler kayıtta kalır; biriken kuvvetler bir sonraki fe_body_store_load_range ile alınır.
+    fe_body_store_load_body(store, index, false);
+
+    return (fe_body_handle_t){ slot, store->slot_generation[slot] };
+}
+
+/**
+ * Uygulama: fe_body_store_remove
+ */
+void fe_body_store_remove(fe_body_store_t* store, fe_body_handle_t handle) {
+    uint32_t index = fe_body_store_get_index(store, handle);
+    if (index == UINT32_MAX) return;
+
+    uint32_t last = --store->count;
+    if (index != last) {
+        float** streams[FE_BODY_STORE_STREAM_COUNT];
+        uint32_t stream_count = fe_body_store_streams(store, streams);
+        for (uint32_t s = 0; s < stream_count; ++s) {
+            (*streams[s])[index] = (*streams[s])[last];
+        }
+        store->bodies[index] = store->bodies[last];
+        store->dense_to_slot[index] = store->dense_to_slot[last];
+        store->slot_index[store->dense_to_slot[index]] = index;
+    }
+
+    // Yuvayı serbest bırak; nesil artışı eski tanıtıcıları geçersiz kılar
+    store->slot_generation[handle.slot]++;
+    store->slot_index[handle.slot] = store->free_slot;
+    store->free_slot = handle.slot;
+}
+
+/**
+ * Uygulama: fe_body_store_get_index
+ */
+uint32_t fe_body_store_get_index(const fe_body_store_t* store, fe_body_handle_t handle) {
+    if (handle.slot >= store->capacity || store->slot_generation[handle.slot] != handle.generation) return UINT32_MAX;
+    uint32_t index = store->slot_index[handle.slot];
+    // Boş yuvanın slot_index'i bir sonraki boş yuvadır; dense_to_slot ile doğrula
+    return (index < store->count && store->dense_to_slot[index] == handle.slot) ? index : UINT32_MAX;
+}
+
+
+// ----------------------------------------------------------------------
+// 3. KAYITLARLA EŞİTLEME
+// ----------------------------------------------------------------------
+
+/**
+ * @brief i. cismin durumunu kaydından yükler.
+ * @param take_forces true ise kayıttaki kuvvet birikimi depoya taşınır (kayıtta sıfırlanır), değilse depoda sıfır olur.
+ */
+static void fe_body_store_load_body(fe_body_store_t* store, uint32_t i, bool take_forces) {
+    fe_rigid_body_t* rb = store->bodies[i];
+
+    store->position_x[i] = rb->position.x;
+    store->position_y[i] = rb->position.y;
+    store->position_z[i] = rb->position.z;
+    store->orientation_x[i] = rb->orientation.x;
+    store->orientation_y[i] = rb->orientation.y;
+    store->orientation_z[i] = rb->orientation.z;
+    store->orientation_w[i] = rb->orientation.w;
+    store->linear_velocity_x[i] = rb->linear_velocity.x;
+    store->linear_velocity_y[i] = rb->linear_velocity.y;
+    store->linear_velocity_z[i] = rb->linear_velocity.z;
+    store->angular_velocity_x[i] = rb->angular_velocity.x;
+    store->angular_velocity_y[i] = rb->angular_velocity.y;
+    store->angular_velocity_z[i] = rb->angular_velocity.z;
+    if (take_forces) {
+        store->force_x[i] = rb->total_force.x;
+        store->force_y[i] = rb->total_force.y;
+        store->force_z[i] = rb->total_force.z;
+        store->torque_x[i] = rb->total_torque.x;
+        store->torque_y[i] = rb->total_torque.y;
+        store->torque_z[i] = rb->total_torque.z;
+        rb->total_force = (fe_vec3_t){{0.0f, 0.0f, 0.0f}};
+        rb->total_torque = (fe_vec3_t){{0.0f, 0.0f, 0.0f}};
+    } else {
+        store->force_x[i] = store->force_y[i] = store->force_z[i] = 0.0f;
+        store->torque_x[i] = store->torque_y[i] = store->torque_z[i] = 0.0f;
+    }
+
+    if (!rb->is_awake || rb->is_kinematic || rb->inverse_mass <= 0.0f) {
+        store->inverse_mass[i] = 0.0f;
+        store->inverse_inertia_xx[i] = store->inverse_inertia_xy[i] = store->inverse_inertia_xz[i] = 0.0f;
+        store->inverse_inertia_yy[i] = store->inverse_inertia_yz[i] = store->inverse_inertia_zz[i] = 0.0f;
+    } else {
+        // Sütun-major: (satır r, sütun c) = mm[c][r]
+        const float (*inv)[4] = rb->inverse_inertia_tensor.mm;
+        store->inverse_mass[i] = rb->inverse_mass;
+        store->inverse_inertia_xx[i] = inv[0][0];
+        store->inverse_inertia_xy[i] = inv[1][0];
+        store->inverse_inertia_xz[i] = inv[2][0];
+        store->inverse_inertia_yy[i] = inv[1][1];
+        store->inverse_inertia_yz[i] = inv[2][1];
+        store->inverse_inertia_zz[i] = inv[2][2];
+    }
+}
+
+/**
+ * Uygulama: fe_body_store_load_range
+ */
+void fe_body_store_load_range(fe_body_store_t* store, uint32_t begin, uint32_t end) {
+    for (uint32_t i = begin; i < end; ++i) {
+        fe_body_store_load_body(store, i, true);
+    }
+}
+
+/**
+ * Uygulama: fe_body_store_save_range
+ */
+void fe_body_store_save_range(fe_body_store_t* store, uint32_t begin, uint32_t end) {
+    for (uint32_t i = begin; i < end; ++i) {
+        fe_rigid_body_t* rb = store->bodies[i];
+        rb->position = (fe_vec3_t){{ store->position_x[i], store->position_y[i], store->position_z[i] }};
+        rb->orientation = (fe_vec4_t){{ store->orientation_x[i], store->orientation_y[i], store->orientation_z[i], store->orientation_w[i] }};
+        rb->linear_velocity = fe_body_store_get_linear_velocity(store, i);
+        rb->angular_velocity = fe_body_store_get_angular_velocity(store, i);
+        rb->rotation_matrix = fe_quat_to_mat4(rb->orientation);
+    }
+}
+
+
+// ----------------------------------------------------------------------
+// 4. TEK CİSİM ENTEGRASYONU (SIMD kuyruğu ve SIMD'siz derlemeler için)
+// ----------------------------------------------------------------------
+
+static void fe_body_store_integrate_velocity_scalar(fe_body_store_t* s, uint32_t i, fe_vec3_t gravity, float dt) {
+    float inv_mass = s->inverse_mass[i];
+    if (inv_mass > 0.0f) {
+        s->linear_velocity_x[i] += (gravity.x + s->force_x[i] * inv_mass) * dt;
+        s->linear_velocity_y[i] += (gravity.y + s->force_y[i] * inv_mass) * dt;
+        s->linear_velocity_z[i] += (gravity.z + s->force_z[i] * inv_mass) * dt;
+
+        // alpha = R * I^-1 * R^T * tau
+        fe_vec3_t r[3];
+        fe_physics_quat_to_rows((fe_vec4_t){{ s->orientation_x[i], s->orientation_y[i], s->orientation_z[i], s->orientation_w[i] }}, r);
+        float tx = s->torque_x[i], ty = s->torque_y[i], tz = s->torque_z[i];
+        float lx = r[0].x * tx + r[1].x * ty + r[2].x * tz;
+        float ly = r[0].y * tx + r[1].y * ty + r[2].y * tz;
+        float lz = r[0].z * tx + r[1].z * ty + r[2].z * tz;
+        float ax = s->inverse_inertia_xx[i] * lx + s->inverse_inertia_xy[i] * ly + s->inverse_inertia_xz[i] * lz;
+        float ay = s->inverse_inertia_xy[i] * lx + s->inverse_inertia_yy[i] * ly + s->inverse_inertia_yz[i] * lz;
+        float az = s->inverse_inertia_xz[i] * lx + s->inverse_inertia_yz[i] * ly + s->inverse_inertia_zz[i] * lz;
+        s->angular_velocity_x[i] += (r[0].x * ax + r[0].y * ay + r[0].z * az) * dt;
+        s->angular_velocity_y[i] += (r[1].x * ax + r[1].y * ay + r[1].z * az) * dt;
+        s->angular_velocity_z[i] += (r[2].x * ax + r[2].y * ay + r[2].z * az) * dt;
+    }
+    s->force_x[i] = s->force_y[i] = s->force_z[i] = 0.0f;
+    s->torque_x[i] = s->torque_y[i] = s->torque_z[i] = 0.0f;
+}
+
+static void fe_body_store_integrate_position_scalar(fe_body_store_t* s, uint32_t i, float dt) {
+    if (s->inverse_mass[i] <= 0.0f) return;
+
+    s->position_x[i] += s->linear_velocity_x[i] * dt;
+    s->position_y[i] += s->linear_velocity_y[i] * dt;
+    s->position_z[i] += s->linear_velocity_z[i] * dt;
+
+    // q += 0.5 * (w * q) * dt (w dünya uzayında, w = (wx, wy, wz, 0))
+    float wx = s->angular_velocity_x[i], wy = s->angular_velocity_y[i], wz = s->angular_velocity_z[i];
+    float qx = s->orientation_x[i], qy = s->orientation_y[i], qz = s->orientation_z[i], qw = s->orientation_w[i];
+    float h = 0.5f * dt;
+    float dqx = wx * qw + wy * qz - wz * qy;
+    float dqy = wy * qw + wz * qx - wx * qz;
+    float dqz = wz * qw + wx * qy - wy * qx;
+    float dqw = -wx * qx - wy * qy - wz * qz;
+    qx += dqx * h;
+    qy += dqy * h;
+    qz += dqz * h;
+    qw += dqw * h;
+
+    float length = sqrtf(qx * qx + qy * qy + qz * qz + qw * qw);
+    float inv_length = (length > 0.000001f) ? 1.0f / length : 0.0f;
+    s->orientation_x[i] = qx * inv_length;
+    s->orientation_y[i] = qy * inv_length;
+    s->orientation_z[i] = qz * inv_length;
+    s->orientation_w[i] = (length > 0.000001f) ? qw * inv_length : 1.0f;
+}
+
+
+// ----------------------------------------------------------------------
+// 5. TOPLU ENTEGRASYON (SIMD)
+// ----------------------------------------------------------------------
+
+#ifdef FE_BODY_STORE_SIMD_WIDTH
+
+/**
+ * @brief Kuaterniyondan dönüş matrisinin satırları (fe_physics_quat_to_rows'un SIMD karşılığı).
+ */
+static inline void fe_simd_quat_to_rows(fe_simd_t qx, fe_simd_t qy, fe_simd_t qz, fe_simd_t qw, fe_simd_t r[9]) {
+    const fe_simd_t one = fe_simd_set1(1.0f);
+    const fe_simd_t two = fe_simd_set1(2.0f);
+    fe_simd_t xx = fe_simd_mul(qx, qx), yy = fe_simd_mul(qy, qy), zz = fe_simd_mul(qz, qz);
+    fe_simd_t xy = fe_simd_mul(qx, qy), xz = fe_simd_mul(qx, qz), yz = fe_simd_mul(qy, qz);
+    fe_simd_t wx = fe_simd_mul(qw, qx), wy = fe_simd_mul(qw, qy), wz = fe_simd_mul(qw, qz);
+
+    r[0] = fe_simd_sub(one, fe_simd_mul(two, fe_simd_add(yy, zz)));
+    r[1] = fe_simd_mul(two, fe_simd_sub(xy, wz));
+    r[2] = fe_simd_mul(two, fe_simd_add(xz, wy));
+    r[3] = fe_simd_mul(two, fe_simd_add(xy, wz));
+    r[4] = fe_simd_sub(one, fe_simd_mul(two, fe_simd_add(xx, zz)));
+    r[5] = fe_simd_mul(two, fe_simd_sub(yz, wx));
+    r[6] = fe_simd_mul(two, fe_simd_sub(xz, wy));
+    r[7] = fe_simd_mul(two, fe_simd_add(yz, wx));
+    r[8] = fe_simd_sub(one, fe_simd_mul(two, fe_simd_add(xx, yy)));
+}
+
+static inline fe_simd_t fe_simd_dot3(fe_simd_t ax, fe_simd_t ay, fe_simd_t az, fe_simd_t bx, fe_simd_t by, fe_simd_t bz) {
+    return fe_simd_add(fe_simd_add(fe_simd_mul(ax, bx), fe_simd_mul(ay, by)), fe_simd_mul(az, bz));
+}
+
+static void fe_body_store_integrate_velocity_batch(fe_body_store_t* s, uint32_t i, fe_vec3_t gravity, float dt) {
+    const fe_simd_t zero = fe_simd_zero();
+    const fe_simd_t vdt = fe_simd_set1(dt);
+    fe_simd_t inv_mass = fe_simd_load(&s->inverse_mass[i]);
+    fe_simd_t dynamic = fe_simd_gt(inv_mass, zero); // Kinematik şeritlerde yerçekimi maskelenir
+
+    // v += (g + F / m) * dt (inv_mass = 0 olan şeritlerde F katkısı zaten sıfırdır)
+    fe_simd_t gx = fe_simd_and(fe_simd_set1(gravity.x), dynamic);
+    fe_simd_t gy = fe_simd_and(fe_simd_set1(gravity.y), dynamic);
+    fe_simd_t gz = fe_simd_and(fe_simd_set1(gravity.z), dynamic);
+    fe_simd_t ax = fe_simd_add(gx, fe_simd_mul(fe_simd_load(&s->force_x[i]), inv_mass));
+    fe_simd_t ay = fe_simd_add(gy, fe_simd_mul(fe_simd_load(&s->force_y[i]), inv_mass));
+    fe_simd_t az = fe_simd_add(gz, fe_simd_mul(fe_simd_load(&s->force_z[i]), inv_mass));
+    fe_simd_store(&s->linear_velocity_x[i], fe_simd_add(fe_simd_load(&s->linear_velocity_x[i]), fe_simd_mul(ax, vdt)));
+    fe_simd_store(&s->linear_velocity_y[i], fe_simd_add(fe_simd_load(&s->linear_velocity_y[i]), fe_simd_mul(ay, vdt)));
+    fe_simd_store(&s->linear_velocity_z[i], fe_simd_add(fe_simd_load(&s->linear_velocity_z[i]), fe_simd_mul(az, vdt)));
+
+    // alpha = R * I^-1 * R^T * tau (kinematik şeritlerde I^-1 sıfırdır)
+    fe_simd_t r[9];
+    fe_simd_quat_to_rows(fe_simd_load(&s->orientation_x[i]), fe_simd_load(&s->orientation_y[i]),
+                         fe_simd_load(&s->orientation_z[i]), fe_simd_load(&s->orientation_w[i]), r);
+    fe_simd_t tx = fe_simd_load(&s->torque_x[i]);
+    fe_simd_t ty = fe_simd_load(&s->torque_y[i]);
+    fe_simd_t tz = fe_simd_load(&s->torque_z[i]);
+    fe_simd_t lx = fe_simd_dot3(r[0], r[3], r[6], tx, ty, tz);
+    fe_simd_t ly = fe_simd_dot3(r[1], r[4], r[7], tx, ty, tz);
+    fe_simd_t lz = fe_simd_dot3(r[2], r[5], r[8], tx, ty, tz);
+
+    fe_simd_t ixx = fe_simd_load(&s->inverse_inertia_xx[i]);
+    fe_simd_t ixy = fe_simd_load(&s->inverse_inertia_xy[i]);
+    fe_simd_t ixz = fe_simd_load(&s->inverse_inertia_xz[i]);
+    fe_simd_t iyy = fe_simd_load(&s->inverse_inertia_yy[i]);
+    fe_simd_t iyz = fe_simd_load(&s->inverse_inertia_yz[i]);
+    fe_simd_t izz = fe_simd_load(&s->inverse_inertia_zz[i]);
+    fe_simd_t alx = fe_simd_dot3(ixx, ixy, ixz, lx, ly, lz);
+    fe_simd_t aly = fe_simd_dot3(ixy, iyy, iyz, lx, ly, lz);
+    fe_simd_t alz = fe_simd_dot3(ixz, iyz, izz, lx, ly, lz);
+
+    fe_simd_t wx = fe_simd_dot3(r[0], r[1], r[2], alx, aly, alz);
+    fe_simd_t wy = fe_simd_dot3(r[3], r[4], r[5], alx, aly, alz);
+    fe_simd_t wz = fe_simd_dot3(r[6], r[7], r[8], alx, aly, alz);
+    fe_simd_store(&s->angular_velocity_x[i], fe_simd_add(fe_simd_load(&s->angular_velocity_x[i]), fe_simd_mul(wx, vdt)));
+    fe_simd_store(&s->angular_velocity_y[i], fe_simd_add(fe_simd_load(&s->angular_velocity_y[i]), fe_simd_mul(wy, vdt)));
+    fe_simd_store(&s->angular_velocity_z[i], fe_simd_add(fe_simd_load(&s->angular_velocity_z[i]), fe_simd_mul(wz, vdt)));
+
+    fe_simd_store(&s->force_x[i], zero);
+    fe_simd_store(&s->force_y[i], zero);
+    fe_simd_store(&s->force_z[i], zero);
+    fe_simd_store(&s->torque_x[i], zero);
+    fe_simd_store(&s->torque_y[i], zero);
+    fe_simd_store(&s->torque_z[i], zero);
+}
+
+static void fe_body_store_integrate_position_batch(fe_body_store_t* s, uint32_t i, float dt) {
+    const fe_simd_t zero = fe_simd_zero();
+    fe_simd_t dynamic = fe_simd_gt(fe_simd_load(&s->inverse_mass[i]), zero);
+    fe_simd_t vdt = fe_simd_and(fe_simd_set1(dt), dynamic); // Kinematik şeritlerde adım sıfır
+
+    fe_simd_store(&s->position_x[i], fe_simd_add(fe_simd_load(&s->position_x[i]), fe_simd_mul(fe_simd_load(&s->linear_velocity_x[i]), vdt)));
+    fe_simd_store(&s->position_y[i], fe_simd_add(fe_simd_load(&s->position_y[i]), fe_simd_mul(fe_simd_load(&s->linear_velocity_y[i]), vdt)));
+    fe_simd_store(&s->position_z[i], fe_simd_add(fe_simd_load(&s->position_z[i]), fe_simd_mul(fe_simd_load(&s->linear_velocity_z[i]), vdt)));
+
+    fe_simd_t wx = fe_simd_load(&s->angular_velocity_x[i]);
+    fe_simd_t wy = fe_simd_load(&s->angular_velocity_y[i]);
+    fe_simd_t wz = fe_simd_load(&s->angular_velocity_z[i]);
+    fe_simd_t qx = fe_simd_load(&s->orientation_x[i]);
+    fe_simd_t qy = fe_simd_load(&s->orientation_y[i]);
+    fe_simd_t qz = fe_simd_load(&s->orientation_z[i]);
+    fe_simd_t qw = fe_simd_load(&s->orientation_w[i]);
+
+    fe_simd_t dqx = fe_simd_sub(fe_simd_add(fe_simd_mul(wx, qw), fe_simd_mul(wy, qz)), fe_simd_mul(wz, qy));
+    fe_simd_t dqy = fe_simd_sub(fe_simd_add(fe_simd_mul(wy, qw), fe_simd_mul(wz, qx)), fe_simd_mul(wx, qz));
+    fe_simd_t dqz = fe_simd_sub(fe_simd_add(fe_simd_mul(wz, qw), fe_simd_mul(wx, qy)), fe_simd_mul(wy, qx));
+    fe_simd_t dqw = fe_simd_sub(zero, fe_simd_dot3(wx, wy, wz, qx, qy, qz));
+
+    fe_simd_t h = fe_simd_mul(fe_simd_set1(0.5f), vdt);
+    fe_simd_t nx = fe_simd_add(qx, fe_simd_mul(dqx, h));
+    fe_simd_t ny = fe_simd_add(qy, fe_simd_mul(dqy, h));
+    fe_simd_t nz = fe_simd_add(qz, fe_simd_mul(dqz, h));
+    fe_simd_t nw = fe_simd_add(qw, fe_simd_mul(dqw, h));
+
+    // Normalize; kinematik şeritler ve dejenere kuaterniyonlar olduğu gibi kalır
+    fe_simd_t length = fe_simd_sqrt(fe_simd_add(fe_simd_dot3(nx, ny, nz, nx, ny, nz), fe_simd_mul(nw, nw)));
+    fe_simd_t valid = fe_simd_and(dynamic, fe_simd_gt(length, fe_simd_set1(0.000001f)));
+    fe_simd_t inv_length = fe_simd_div(fe_simd_set1(1.0f), length);
+    fe_simd_store(&s->orientation_x[i], fe_simd_select(valid, fe_simd_mul(nx, inv_length), qx));
+    fe_simd_store(&s->orientation_y[i], fe_simd_select(valid, fe_simd_mul(ny, inv_length), qy));
+    fe_simd_store(&s->orientation_z[i], fe_simd_select(valid, fe_simd_mul(nz, inv_length), qz));
+    fe_simd_store(&s->orientation_w[i], fe_simd_select(valid, fe_simd_mul(nw, inv_length), qw));
+}
+
+#endif // FE_BODY_STORE_SIMD_WIDTH
+
+/**
+ * Uygulama: fe_body_store_integrate_velocities
+ */
+void fe_body_store_integrate_velocities(fe_body_store_t* store, uint32_t begin, uint32_t end, fe_vec3_t gravity, float dt) {
+    uint32_t i = begin;
+#ifdef FE_BODY_STORE_SIMD_WIDTH
+    for (; i + FE_BODY_STORE_SIMD_WIDTH <= end; i += FE_BODY_STORE_SIMD_WIDTH) {
+        fe_body_store_integrate_velocity_batch(store, i, gravity, dt);
+    }
+#endif
+    for (; i < end; ++i) {
+        fe_body_store_integrate_velocity_scalar(store, i, gravity, dt);
+    }
+}
+
+/**
+ * Uygulama: fe_body_store_integrate_positions
+ */
+void fe_body_store_integrate_positions(fe_body_store_t* store, uint32_t begin, uint32_t end, float dt) {
+    uint32_t i = begin;
+#ifdef FE_BODY_STORE_SIMD_WIDTH
+    for (; i + FE_BODY_STORE_SIMD_WIDTH <= end; i += FE_BODY_STORE_SIMD_WIDTH) {
+        fe_body_store_integrate_position_batch(store, i, dt);
+    }
+#endif
+    for (; i < end; ++i) {
+        fe_body_store_integrate_position_scalar(store, i, dt);
+    }
+}
@@ -0,0 +1,745 @@
+// src/physics/fe_broadphase.c
+
+#include "physics/fe_broadphase.h"
+#include "utils/fe_logger.h"
+#include "memory/fe_memory_manager.h" // fe_mem_calloc, fe_mem_realloc, fe_mem_free
+#include <string.h> // memset
+
+#define FE_BROADPHASE_INITIAL_NODES 256
+#define FE_BROADPHASE_INITIAL_PAIRS 256
+
+// ----------------------------------------------------------------------
+// 1. DÜĞÜM HAVUZU
+// ----------------------------------------------------------------------
+
+static inline bool fe_bp_is_leaf(const fe_broadphase_node_t* node) {
+    return node->child1 == FE_BROADPHASE_NULL_PROXY;
+}
+
+/**
+ * @brief Düğüm havuzunu belirtilen aralıktaki düğümlerden serbest listeye bağlar.
+ */
+static void fe_bp_link_free_nodes(fe_broadphase_t* bp, uint32_t first, uint32_t end) {
+    for (uint32_t i = first; i < end; ++i) {
+        bp->nodes[i].parent = (i + 1 < end) ? i + 1 : FE_BROADPHASE_NULL_PROXY;
+        bp->nodes[i].height = -1;
+    }
+    bp->free_list = first;
+}
+
+static uint32_t fe_bp_allocate_node(fe_broadphase_t* bp) {
+    if (bp->free_list == FE_BROADPHASE_NULL_PROXY) {
+        uint32_t new_capacity = bp->node_capacity * 2;
+        fe_broadphase_node_t* nodes = (fe_broadphase_node_t*)fe_mem_realloc(bp->nodes, new_capacity * sizeof(fe_broadphase_node_t));
+        if (!nodes) {
+            FE_LOG_ERROR("Broadphase: dugum havuzu buyutulemedi.");
+            return FE_BROADPHASE_NULL_PROXY;
+        }
+        bp->nodes = nodes;
+        uint32_t* first_pair = (uint32_t*)fe_mem_realloc(bp->proxy_first_pair, new_capacity * sizeof(uint32_t));
+        if (first_pair) bp->proxy_first_pair = first_pair;
+        uint32_t* last_pair = (uint32_t*)fe_mem_realloc(bp->proxy_last_pair, new_capacity * sizeof(uint32_t));
+        if (last_pair) bp->proxy_last_pair = last_pair;
+        uint32_t* pair_counts = (uint32_t*)fe_mem_realloc(bp->proxy_pair_count, new_capacity * sizeof(uint32_t));
+        if (pair_counts) bp->proxy_pair_count = pair_counts;
+        uint32_t* stamps = (uint32_t*)fe_mem_realloc(bp->proxy_stamp, new_capacity * sizeof(uint32_t));
+        if (stamps) {
+            memset(stamps + bp->node_capacity, 0, (new_capacity - bp->node_capacity) * sizeof(uint32_t));
+            bp->proxy_stamp = stamps;
+        }
+        if (!first_pair || !last_pair || !pair_counts || !stamps) {
+            FE_LOG_ERROR("Broadphase: vekil cift listeleri buyutulemedi.");
+            return FE_BROADPHASE_NULL_PROXY;
+        }
+        fe_bp_link_free_nodes(bp, bp->node_capacity, new_capacity);
+        bp->node_capacity = new_capacity;
+    }
+
+    uint32_t id = bp->free_list;
+    fe_broadphase_node_t* node = &bp->nodes[id];
+    bp->free_list = node->parent;
+    node->parent = FE_BROADPHASE_NULL_PROXY;
+    node->child1 = FE_BROADPHASE_NULL_PROXY;
+    node->child2 = FE_BROADPHASE_NULL_PROXY;
+    node->height = 0;
+    node->user_data = NULL;
+    node->moved = false;
+    bp->node_count++;
+    return id;
+}
+
+static void fe_bp_free_node(fe_broadphase_t* bp, uint32_t id) {
+    bp->nodes[id].parent = bp->free_list;
+    bp->nodes[id].height = -1;
+    bp->free_list = id;
+    bp->node_count--;
+}
+
+
+// ----------------------------------------------------------------------
+// 2. AĞAÇ İŞLEMLERİ (EKLEME, ÇIKARMA, DENGELEME)
+// ----------------------------------------------------------------------
+
+static inline int16_t fe_bp_max_height(int16_t a, int16_t b) {
+    return (int16_t)(1 + (a > b ? a : b));
+}
+
+/**
+ * @brief A'nın bir çocuğunu diğer çocuğun çocuklarından biriyle yer değiştirerek iç düğüm
+ * * alanlarının toplamını (SAH maliyeti) düşürmeye çalışır.
+ * * Yükseklik dengesi yerine yüzey alanına göre döndürme: hareket eden yapraklarla ağaç kalitesi
+ * * bozulmaz ve sorgular daha az düğüm ziyaret eder. A'nın kutusu değişmez.
+ */
+static bool fe_bp_rotate(fe_broadphase_t* bp, uint32_t ia) {
+    fe_broadphase_node_t* nodes = bp->nodes;
+    fe_broadphase_node_t* a = &nodes[ia];
+    if (a->height < 2) {
+        return false;
+    }
+
+    uint32_t ib = a->child1;
+    uint32_t ic = a->child2;
+    fe_broadphase_node_t* b = &nodes[ib];
+    fe_broadphase_node_t* c = &nodes[ic];
+
+    // Olası döndürmeler: B<->F, B<->G (C iç düğümse), C<->D, C<->E (B iç düğümse)
+    enum { ROTATE_NONE, ROTATE_BF, ROTATE_BG, ROTATE_CD, ROTATE_CE } best = ROTATE_NONE;
+    float area_b = fe_aabb_surface_area(&b->aabb);
+    float area_c = fe_aabb_surface_area(&c->aabb);
+    float best_cost = (b->height > 0 ? area_b : 0.0f) + (c->height > 0 ? area_c : 0.0f);
+    fe_aabb_t aabb_bg, aabb_bf, aabb_ce, aabb_cd;
+
+    if (c->height > 0) {
+        const fe_broadphase_node_t* f = &nodes[c->child1];
+        const fe_broadphase_node_t* g = &nodes[c->child2];
+        float base = (b->height > 0) ? area_b : 0.0f;
+
+        aabb_bg = fe_aabb_union(&b->aabb, &g->aabb);
+        float cost_bf = base + fe_aabb_surface_area(&aabb_bg);
+        if (cost_bf < best_cost) { best = ROTATE_BF; best_cost = cost_bf; }
+
+        aabb_bf = fe_aabb_union(&b->aabb, &f->aabb);
+        float cost_bg = base + fe_aabb_surface_area(&aabb_bf);
+        if (cost_bg < best_cost) { best = ROTATE_BG; best_cost = cost_bg; }
+    }
+    if (b->height > 0) {
+        const fe_broadphase_node_t* d = &nodes[b->child1];
+        const fe_broadphase_node_t* e = &nodes[b->child2];
+        float base = (c->height > 0) ? area_c : 0.0f;
+
+        aabb_ce = fe_aabb_union(&c->aabb, &e->aabb);
+        float cost_cd = base + fe_aabb_surface_area(&aabb_ce);
+        if (cost_cd < best_cost) { best = ROTATE_CD; best_cost = cost_cd; }
+
+        aabb_cd = fe_aabb_union(&c->aabb, &d->aabb);
+        float cost_ce = base + fe_aabb_surface_area(&aabb_cd);
+        if (cost_ce < best_cost) { best = ROTATE_CE; best_cost = cost_ce; }
+    }
+
+    switch (best) {
+        case ROTATE_BF: {
+            uint32_t if_ = c->child1;
+            a->child1 = if_;
+            c->child1 = ib;
+            b->parent = ic;
+            nodes[if_].parent = ia;
+            c->aabb = aabb_bg;
+            c->height = fe_bp_max_height(b->height, nodes[c->child2].height);
+            a->height = fe_bp_max_height(c->height, nodes[if_].height);
+            break;
+        }
+        case ROTATE_BG: {
+            uint32_t ig = c->child2;
+            a->child1 = ig;
+            c->child2 = ib;
+            b->parent = ic;
+            nodes[ig].parent = ia;
+            c->aabb = aabb_bf;
+            c->height = fe_bp_max_height(b->height, nodes[c->child1].height);
+            a->height = fe_bp_max_height(c->height, nodes[ig].height);
+            break;
+        }
+        case ROTATE_CD: {
+            uint32_t id = b->child1;
+            a->child2 = id;
+            b->child1 = ic;
+            c->parent = ib;
+            nodes[id].parent = ia;
+            b->aabb = aabb_ce;
+            b->height = fe_bp_max_height(c->height, nodes[b->child2].height);
+            a->height = fe_bp_max_height(b->height, nodes[id].height);
+            break;
+        }
+        case ROTATE_CE: {
+            uint32_t ie = b->child2;
+            a->child2 = ie;
+            b->child2 = ic;
+            c->parent = ib;
+            nodes[ie].parent = ia;
+            b->aabb = aabb_cd;
+            b->height = fe_bp_max_height(c->height, nodes[b->child1].height);
+            a->height = fe_bp_max_height(b->height, nodes[ie].height);
+            break;
+        }
+        default:
+            return false;
+    }
+    return true;
+}
+
+/**
+ * @brief index'ten köke doğru kutuları ve yükseklikleri günceller, yol boyunca döndürme yapar.
+ * * Kutusu ve yüksekliği değişmeyen, döndürülmeyen bir atada durur: yeni yaprak o atanın kutusuna
+ * * zaten sığıyordur ve daha yukarısı değişmez. Yeniden eklemelerin çoğu kökten önce biter.
+ */
+static void fe_bp_refit_upwards(fe_broadphase_t* bp, uint32_t index) {
+    while (index != FE_BROADPHASE_NULL_PROXY) {
+        fe_broadphase_node_t* node = &bp->nodes[index];
+        const fe_broadphase_node_t* c1 = &bp->nodes[node->child1];
+        const fe_broadphase_node_t* c2 = &bp->nodes[node->child2];
+        int16_t height = fe_bp_max_height(c1->height, c2->height);
+        fe_aabb_t aabb = fe_aabb_union(&c1->aabb, &c2->aabb);
+        bool changed = height != node->height || memcmp(&aabb, &node->aabb, sizeof(fe_aabb_t)) != 0;
+        node->height = height;
+        node->aabb = aabb;
+
+        if (!fe_bp_rotate(bp, index) && !changed) {
+            break;
+        }
+        index = node->parent;
+    }
+}
+
+/**
+ * @brief Yaprak çıkarıldıktan sonra kutuları küçültür. Döndürme yapılmaz; bir atanın kutusu
+ * * ve yüksekliği değişmediyse daha yukarısı da değişmez ve yürüyüş erken biter.
+ */
+static void fe_bp_shrink_upwards(fe_broadphase_t* bp, uint32_t index) {
+    while (index != FE_BROADPHASE_NULL_PROXY) {
+        fe_broadphase_node_t* node = &bp->nodes[index];
+        const fe_broadphase_node_t* c1 = &bp->nodes[node->child1];
+        const fe_broadphase_node_t* c2 = &bp->nodes[node->child2];
+        int16_t height = fe_bp_max_height(c1->height, c2->height);
+        fe_aabb_t aabb = fe_aabb_union(&c1->aabb, &c2->aabb);
+
+        if (height == node->height && memcmp(&aabb, &node->aabb, sizeof(fe_aabb_t)) == 0) {
+            break;
+        }
+        node->height = height;
+        node->aabb = aabb;
+        index = node->parent;
+    }
+}
+
+/**
+ * @brief Yaprağı, start'ın alt ağacında yüzey alanı artışı en düşük kardeşin yanına ekler (dal-sınır inişi).
+ * * start kök değilse kutusu yaprağı içermelidir; o zaman start'ın atalarının kutuları değişmez ve
+ * * iniş kökten başlamış gibi aynı maliyetlerle ilerler.
+ */
+static void fe_bp_insert_leaf_from(fe_broadphase_t* bp, uint32_t leaf, uint32_t start) {
+    if (bp->root == FE_BROADPHASE_NULL_PROXY) {
+        bp->root = leaf;
+        bp->nodes[leaf].parent = FE_BROADPHASE_NULL_PROXY;
+        return;
+    }
+
+    const fe_aabb_t leaf_aabb = bp->nodes[leaf].aabb;
+    uint32_t index = start;
+
+    while (!fe_bp_is_leaf(&bp->nodes[index])) {
+        const fe_broadphase_node_t* node = &bp->nodes[index];
+        uint32_t child1 = node->child1;
+        uint32_t child2 = node->child2;
+
+        float area = fe_aabb_surface_area(&node->aabb);
+        fe_aabb_t combined = fe_aabb_union(&node->aabb, &leaf_aabb);
+        float combined_area = fe_aabb_surface_area(&combined);
+
+        // Bu düğümün yanına yeni bir ebeveyn açmanın maliyeti
+        float cost = 2.0f * combined_area;
+        // Yaprağı daha aşağı itmenin atalara yansıyan en düşük maliyeti
+        float inheritance_cost = 2.0f * (combined_area - area);
+
+        float child_cost[2];
+        uint32_t children[2] = { child1, child2 };
+        for (int i = 0; i < 2; ++i) {
+            const fe_broadphase_node_t* child = &bp->nodes[children[i]];
+            fe_aabb_t u = fe_aabb_union(&leaf_aabb, &child->aabb);
+            if (fe_bp_is_leaf(child)) {
+                child_cost[i] = fe_aabb_surface_area(&u) + inheritance_cost;
+            } else {
+                child_cost[i] = (fe_aabb_surface_area(&u) - fe_aabb_surface_area(&child->aabb)) + inheritance_cost;
+            }
+        }
+
+        if (cost < child_cost[0] && cost < child_cost[1]) {
+            break;
+        }
+        index = (child_cost[0] < child_cost[1]) ? child1 : child2;
+    }
+
+    uint32_t sibling = index;
+    uint32_t old_parent = bp->nodes[sibling].parent;
+    uint32_t new_parent = fe_bp_allocate_node(bp);
+    // fe_bp_allocate_node havuzu büyütebilir; işaretçiler bundan sonra alınır
+    fe_broadphase_node_t* np = &bp->nodes[new_parent];
+    np->parent = old_parent;
+    np->user_data = NULL;
+    np->aabb = fe_aabb_union(&leaf_aabb, &bp->nodes[sibling].aabb);
+    np->height = bp->nodes[sibling].height + 1;
+    np->child1 = sibling;
+    np->child2 = leaf;
+    bp->nodes[sibling].parent = new_parent;
+    bp->nodes[leaf].parent = new_parent;
+
+    if (old_parent != FE_BROADPHASE_NULL_PROXY) {
+        if (bp->nodes[old_parent].child1 == sibling) bp->nodes[old_parent].child1 = new_parent;
+        else bp->nodes[old_parent].child2 = new_parent;
+    } else {
+        bp->root = new_parent;
+    }
+
+    // Yeni ebeveynin kutusu ve yüksekliği zaten doğru; yürüyüş bir üstten başlar
+    fe_bp_rotate(bp, new_parent);
+    fe_bp_refit_upwards(bp, old_parent);
+}
+
+static inline void fe_bp_insert_leaf(fe_broadphase_t* bp, uint32_t leaf) {
+    fe_bp_insert_leaf_from(bp, leaf, bp->root);
+}
+
+/**
+ * @brief Yaprağı ağaçtan çıkarır.
+ * @return Kardeşin bağlandığı düğüm (büyük ebeveyn); ağaçta başka düğüm kalmadıysa veya kardeş kök olduysa NULL.
+ */
+static uint32_t fe_bp_remove_leaf(fe_broadphase_t* bp, uint32_t leaf) {
+    if (leaf == bp->root) {
+        bp->root = FE_BROADPHASE_NULL_PROXY;
+        return FE_BROADPHASE_NULL_PROXY;
+    }
+
+    uint32_t parent = bp->nodes[leaf].parent;
+    uint32_t grand_parent = bp->nodes[parent].parent;
+    uint32_t sibling = (bp->nodes[parent].child1 == leaf) ? bp->nodes[parent].child2 : bp->nodes[parent].child1;
+
+    if (grand_parent != FE_BROADPHASE_NULL_PROXY) {
+        // Ebeveyni yok et, kardeşi büyük ebeveyne bağla
+        if (bp->nodes[grand_parent].child1 == parent) bp->nodes[grand_parent].child1 = sibling;
+        else bp->nodes[grand_parent].child2 = sibling;
+        bp->nodes[sibling].parent = grand_parent;
+        fe_bp_free_node(bp, parent);
+        fe_bp_shrink_upwards(bp, grand_parent);
+    } else {
+        bp->root = sibling;
+        bp->nodes[sibling].parent = FE_BROADPHASE_NULL_PROXY;
+        fe_bp_free_node(bp, parent);
+    }
+    return grand_parent;
+}
+
+
+// ----------------------------------------------------------------------
+// 3. ÇİFT LİSTESİ
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Çiftin proxy'nin listesindeki bağlantı tarafı (0: proxy_a, 1: proxy_b).
+ */
+static inline int fe_bp_pair_side(const fe_broadphase_pair_t* pair, uint32_t proxy) {
+    return pair->proxy_a == proxy ? 0 : 1;
+}
+
+static inline uint32_t fe_bp_pair_end(const fe_broadphase_pair_t* pair, int side) {
+    return side == 0 ? pair->proxy_a : pair->proxy_b;
+}
+
+/**
+ * @brief index'teki çifti ucunun (side) listesinin sonuna ekler.
+ * * Listeler oluşturulma sırasını korur: çözücü manifoldlarını bu sırayla açar (yığınlarda alttan üste).
+ */
+static void fe_bp_link_pair(fe_broadphase_t* bp, uint32_t index, int side) {
+    fe_broadphase_pair_t* pair = &bp->pairs[index];
+    uint32_t proxy = fe_bp_pair_end(pair, side);
+    uint32_t tail = bp->proxy_last_pair[proxy];
+    pair->prev[side] = tail;
+    pair->next[side] = FE_BROADPHASE_NULL_PROXY;
+    if (tail != FE_BROADPHASE_NULL_PROXY) {
+        bp->pairs[tail].next[fe_bp_pair_side(&bp->pairs[tail], proxy)] = index;
+    } else {
+        bp->proxy_first_pair[proxy] = index;
+    }
+    bp->proxy_last_pair[proxy] = index;
+    bp->proxy_pair_count[proxy]++;
+}
+
+static void fe_bp_unlink_pair(fe_broadphase_t* bp, uint32_t index, int side) {
+    const fe_broadphase_pair_t* pair = &bp->pairs[index];
+    uint32_t proxy = fe_bp_pair_end(pair, side);
+    uint32_t prev = pair->prev[side];
+    uint32_t next = pair->next[side];
+    if (prev != FE_BROADPHASE_NULL_PROXY) bp->pairs[prev].next[fe_bp_pair_side(&bp->pairs[prev], proxy)] = next;
+    else bp->proxy_first_pair[proxy] = next;
+    if (next != FE_BROADPHASE_NULL_PROXY) bp->pairs[next].prev[fe_bp_pair_side(&bp->pairs[next], proxy)] = prev;
+    else bp->proxy_last_pair[proxy] = prev;
+    bp->proxy_pair_count[proxy]--;
+}
+
+/**
+ * @brief Çifti ekler; çağıran çiftin listede olmadığını bilir (fe_bp_query_moved damgaları).
+ */
+static void fe_bp_add_pair(fe_broadphase_t* bp, uint32_t a, uint32_t b) {
+    if (a > b) { uint32_t t = a; a = b; b = t; }
+
+    if (bp->pair_count == bp->pair_capacity) {
+        uint32_t new_capacity = bp->pair_capacity * 2;
+        fe_broadphase_pair_t* pairs = (fe_broadphase_pair_t*)fe_mem_realloc(bp->pairs, new_capacity * sizeof(fe_broadphase_pair_t));
+        if (!pairs) {
+            FE_LOG_ERROR("Broadphase: cift listesi buyutulemedi.");
+            return;
+        }
+        bp->pairs = pairs;
+        bp->pair_capacity = new_capacity;
+    }
+
+    uint32_t index = bp->pair_count++;
+    fe_broadphase_pair_t* pair = &bp->pairs[index];
+    pair->proxy_a = a;
+    pair->proxy_b = b;
+    pair->user_data_a = bp->nodes[a].user_data;
+    pair->user_data_b = bp->nodes[b].user_data;
+    fe_bp_link_pair(bp, index, 0);
+    fe_bp_link_pair(bp, index, 1);
+}
+
+/**
+ * @brief index'teki çifti son çiftle yer değiştirerek siler (O(1)); taşınan çiftin komşu bağlantıları düzeltilir.
+ */
+static void fe_bp_remove_pair_at(fe_broadphase_t* bp, uint32_t index) {
+    fe_bp_unlink_pair(bp, index, 0);
+    fe_bp_unlink_pair(bp, index, 1);
+
+    uint32_t last = --bp->pair_count;
+    if (index == last) return;
+
+    bp->pairs[index] = bp->pairs[last];
+    const fe_broadphase_pair_t* pair = &bp->pairs[index];
+    for (int side = 0; side < 2; ++side) {
+        uint32_t proxy = fe_bp_pair_end(pair, side);
+        uint32_t prev = pair->prev[side];
+        uint32_t next = pair->next[side];
+        if (prev != FE_BROADPHASE_NULL_PROXY) bp->pairs[prev].next[fe_bp_pair_side(&bp->pairs[prev], proxy)] = index;
+        else bp->proxy_first_pair[proxy] = index;
+        if (next != FE_BROADPHASE_NULL_PROXY) bp->pairs[next].prev[fe_bp_pair_side(&bp->pairs[next], proxy)] = index;
+        else bp->proxy_last_pair[proxy] = index;
+    }
+}
+
+/**
+ * @brief Düşen çifti, kullanıcıların (örn: temas çözücüsü) kendi kayıtlarını silebilmesi için listeler.
+ */
+static void fe_bp_record_removed(fe_broadphase_t* bp, const fe_broadphase_pair_t* pair) {
+    if (bp->removed_count == bp->removed_capacity) {
+        uint32_t new_capacity = bp->removed_capacity ? bp->removed_capacity * 2 : FE_BROADPHASE_INITIAL_PAIRS;
+        uint64_t* removed = (uint64_t*)fe_mem_realloc(bp->removed_pairs, new_capacity * sizeof(uint64_t));
+        if (!removed) {
+            FE_LOG_ERROR("Broadphase: dusen cift listesi buyutulemedi.");
+            return;
+        }
+        bp->removed_pairs = removed;
+        bp->removed_capacity = new_capacity;
+    }
+    bp->removed_pairs[bp->removed_count++] = ((uint64_t)pair->proxy_a << 32) | (uint64_t)pair->proxy_b;
+}
+
+/**
+ * @brief Vekilin, şişman kutuları artık kesişmeyen çiftlerini siler.
+ */
+static void fe_bp_remove_stale_pairs(fe_broadphase_t* bp, uint32_t proxy) {
+    uint32_t i = bp->proxy_first_pair[proxy];
+    while (i != FE_BROADPHASE_NULL_PROXY) {
+        const fe_broadphase_pair_t* pair = &bp->pairs[i];
+        uint32_t next = pair->next[fe_bp_pair_side(pair, proxy)];
+        if (!fe_aabb_overlaps(&bp->nodes[pair->proxy_a].aabb, &bp->nodes[pair->proxy_b].aabb)) {
+            fe_bp_record_removed(bp, pair);
+            uint32_t last = bp->pair_count - 1;
+            fe_bp_remove_pair_at(bp, i);
+            // Son çift i'ye taşındıysa ve sıradaki oydu, gezinti i'den devam eder
+            if (next == last) next = i;
+        }
+        i = next;
+    }
+}
+
+/**
+ * @brief Taşınan bir vekilin şişman kutusuyla kesişen yapraklar için çift ekler.
+ * * Çocuklar yığına atılmadan önce test edilir; kesişmeyen alt ağaçlar yığına hiç girmez.
+ * * Vekilin mevcut eşleri önce damgalanır: yaprak başına çift kontrolü O(1) olur (liste taraması
+ * * yaprak başına O(çift) idi; bir kırılmadaki gibi yoğun kümelerde ekleme maliyetine hâkimdi).
+ */
+static void fe_bp_query_moved(fe_broadphase_t* bp, uint32_t query_proxy) {
+    const fe_broadphase_node_t* nodes = bp->nodes;
+    const fe_aabb_t query_aabb = nodes[query_proxy].aabb;
+
+    uint32_t stamp = ++bp->query_stamp;
+    if (stamp == 0) {
+        // Sayaç döndü: eski damgalar yeni sorgularla karışmasın
+        memset(bp->proxy_stamp, 0, bp->node_capacity * sizeof(uint32_t));
+        stamp = bp->query_stamp = 1;
+    }
+    for (uint32_t i = bp->proxy_first_pair[query_proxy]; i != FE_BROADPHASE_NULL_PROXY;) {
+        const fe_broadphase_pair_t* pair = &bp->pairs[i];
+        int side = fe_bp_pair_side(pair, query_proxy);
+        bp->proxy_stamp[fe_bp_pair_end(pair, 1 - side)] = stamp;
+        i = pair->next[side];
+    }
+
+    uint32_t stack[FE_BROADPHASE_STACK_SIZE];
+    uint32_t stack_count = 0;
+    if (fe_aabb_overlaps(&nodes[bp->root].aabb, &query_aabb)) {
+        stack[stack_count++] = bp->root;
+    }
+
+    while (stack_count > 0) {
+        uint32_t index = stack[--stack_count];
+        const fe_broadphase_node_t* node = &nodes[index];
+
+        if (fe_bp_is_leaf(node)) {
+            // İki uç da taşındıysa çift sadece küçük kimlikli uçtan eklenir
+            if (index == query_proxy || (node->moved && index < query_proxy)) continue;
+            if (bp->proxy_stamp[index] == stamp) continue; // Çift zaten var
+            fe_bp_add_pair(bp, query_proxy, index);
+            nodes = bp->nodes;
+            continue;
+        }
+
+        if (stack_count + 2 > FE_BROADPHASE_STACK_SIZE) {
+            FE_LOG_ERROR("Broadphase: gezinti yigini tasti (agac yuksekligi: %d).", nodes[bp->root].height);
+            return;
+        }
+        if (fe_aabb_overlaps(&nodes[node->child1].aabb, &query_aabb)) {
+            stack[stack_count++] = node->child1;
+        }
+        if (fe_aabb_overlaps(&nodes[node->child2].aabb, &query_aabb)) {
+            stack[stack_count++] = node->child2;
+        }
+    }
+}
+
+
+// ----------------------------------------------------------------------
+// 4. YÖNETİM UYGULAMALARI
+// ----------------------------------------------------------------------
+
+/**
+ * Uygulama: fe_broadphase_init
+ */
+fe_error_code_t fe_broadphase_init(fe_broadphase_t* bp) {
+    if (!bp) return FE_ERR_INVALID_ARGUMENT;
+    memset(bp, 0, sizeof(*bp));
+
+    bp->node_capacity = FE_BROADPHASE_INITIAL_NODES;
+    bp->nodes = (fe_broadphase_node_t*)fe_mem_calloc(bp->node_capacity, sizeof(fe_broadphase_node_t));
+    bp->move_capacity = FE_BROADPHASE_INITIAL_NODES;
+    bp->move_buffer = (uint32_t*)fe_mem_calloc(bp->move_capacity, sizeof(uint32_t));
+    bp->pair_capacity = FE_BROADPHASE_INITIAL_PAIRS;
+    bp->pairs = (fe_broadphase_pair_t*)fe_mem_calloc(bp->pair_capacity, sizeof(fe_broadphase_pair_t));
+    bp->proxy_first_pair = (uint32_t*)fe_mem_calloc(bp->node_capacity, sizeof(uint32_t));
+    bp->proxy_last_pair = (uint32_t*)fe_mem_calloc(bp->node_capacity, sizeof(uint32_t));
+    bp->proxy_pair_count = (uint32_t*)fe_mem_calloc(bp->node_capacity, sizeof(uint32_t));
+    bp->proxy_stamp = (uint32_t*)fe_mem_calloc(bp->node_capacity, sizeof(uint32_t));
+
+    if (!bp->nodes || !bp->move_buffer || !bp->pairs || !bp->proxy_first_pair || !bp->proxy_last_pair || !bp->proxy_pair_count ||
+        !bp->proxy_stamp) {
+        FE_LOG_ERROR("Broadphase icin bellek ayrilamadi.");
+        fe_broadphase_destroy(bp);
+        return FE_ERR_MEMORY_ALLOCATION;
+    }
+
+    fe_bp_link_free_nodes(bp, 0, bp->node_capacity);
+    bp->root = FE_BROADPHASE_NULL_PROXY;
+    return FE_OK;
+}
+
+/**
+ * Uygulama: fe_broadphase_destroy
+ */
+void fe_broadphase_destroy(fe_broadphase_t* bp) {
+    if (!bp) return;
+    fe_mem_free(bp->nodes);
+    fe_mem_free(bp->move_buffer);
+    fe_mem_free(bp->pairs);
+    fe_mem_free(bp->proxy_first_pair);
+    fe_mem_free(bp->proxy_last_pair);
+    fe_mem_free(bp->proxy_pair_count);
+    fe_mem_free(bp->proxy_stamp);
+    fe_mem_free(bp->removed_pairs);
+    memset(bp, 0, sizeof(*bp));
+    bp->root = FE_BROADPHASE_NULL_PROXY;
+}
+
+static void fe_bp_buffer_move(fe_broadphase_t* bp, uint32_t proxy_id) {
+    if (bp->nodes[proxy_id].moved) return;
+
+    if (bp->move_count == bp->move_capacity) {
+        uint32_t new_capacity = bp->move_capacity * 2;
+        uint32_t* buffer = (uint32_t*)fe_mem_realloc(bp->move_buffer, new_capacity * sizeof(uint32_t));
+        if (!buffer) return;
+        bp->move_buffer = buffer;
+        bp->move_capacity = new_capacity;
+    }
+    bp->move_buffer[bp->move_count++] = proxy_id;
+    bp->nodes[proxy_id].moved = true;
+}
+
+/**
+ * Uygulama: fe_broadphase_create_proxy
+ */
+uint32_t fe_broadphase_create_proxy(fe_broadphase_t* bp, const fe_aabb_t* aabb, void* user_data) {
+    uint32_t proxy_id = fe_bp_allocate_node(bp);
+    if (proxy_id == FE_BROADPHASE_NULL_PROXY) return proxy_id;
+
+    fe_broadphase_node_t* node = &bp->nodes[proxy_id];
+    const fe_vec3_t margin = {{FE_BROADPHASE_AABB_MARGIN, FE_BROADPHASE_AABB_MARGIN, FE_BROADPHASE_AABB_MARGIN}};
+    node->aabb.min = fe_vec3_subtract(aabb->min, margin);
+    node->aabb.max = fe_vec3_add(aabb->max, margin);
+    node->user_data = user_data;
+    node->height = 0;
+    bp->proxy_first_pair[proxy_id] = FE_BROADPHASE_NULL_PROXY;
+    bp->proxy_last_pair[proxy_id] = FE_BROADPHASE_NULL_PROXY;
+    bp->proxy_pair_count[proxy_id] = 0;
+
+    fe_bp_insert_leaf(bp, proxy_id);
+    fe_bp_buffer_move(bp, proxy_id);
+    return proxy_id;
+}
+
+/**
+ * Uygulama: fe_broadphase_destroy_proxy
+ */
+void fe_broadphase_destroy_proxy(fe_broadphase_t* bp, uint32_t proxy_id) {
+    if (proxy_id >= bp->node_capacity || bp->nodes[proxy_id].height != 0) return;
+
+    // Vekil kimliği yeniden kullanılabileceği için ona ait çiftler hemen silinir
+    while (bp->proxy_first_pair[proxy_id] != FE_BROADPHASE_NULL_PROXY) {
+        fe_bp_remove_pair_at(bp, bp->proxy_first_pair[proxy_id]);
+    }
+    // Taşıma tamponundaki kaydı fe_broadphase_update_pairs atlar (moved bayrağı kalkık)
+    bp->nodes[proxy_id].moved = false;
+
+    fe_bp_remove_leaf(bp, proxy_id);
+    fe_bp_free_node(bp, proxy_id);
+}
+
+/**
+ * Uygulama: fe_broadphase_move_proxy
+ */
+bool fe_broadphase_move_proxy(fe_broadphase_t* bp, uint32_t proxy_id, const fe_aabb_t* aabb, fe_vec3_t displacement) {
+    fe_broadphase_node_t* node = &bp->nodes[proxy_id];
+    if (fe_aabb_contains(&node->aabb, aabb)) {
+        return false; // Ortak yol: şişman kutu hâlâ geçerli
+    }
+
+    fe_aabb_t fat;
+    const fe_vec3_t margin = {{FE_BROADPHASE_AABB_MARGIN, FE_BROADPHASE_AABB_MARGIN, FE_BROADPHASE_AABB_MARGIN}};
+    fat.min = fe_vec3_subtract(aabb->min, margin);
+    fat.max = fe_vec3_add(aabb->max, margin);
+
+    // Hareket yönünde öngörülü uzatma: hızlı cisimler her adımda yeniden eklenmez. Çarpanın
+    // vekil kimliğinden türetilen sapması, birlikte oluşturulan cisimlerin taşma adımlarını dağıtır.
+    float jitter = (float)((proxy_id * 2654435761u) >> 24) * (2.0f / 255.0f) - 1.0f;
+    float multiplier = FE_BROADPHASE_DISPLACEMENT_MULTIPLIER * (1.0f + FE_BROADPHASE_DISPLACEMENT_JITTER * jitter);
+    fe_vec3_t d = fe_vec3_scale(displacement, multiplier);
+    for (int i = 0; i < 3; ++i) {
+        if (d.v[i] < 0.0f) fat.min.v[i] += d.v[i];
+        else fat.max.v[i] += d.v[i];
+    }
+
+    // Yerel yeniden ekleme: iniş, yeni kutuyu içeren en yakın atadan başlar. Küçük yer
+    // değiştirmelerde bu birkaç düzey yukarıdadır ve kökten inen yol tekrar yürünmez.
+    uint32_t start = fe_bp_remove_leaf(bp, proxy_id);
+    while (start != FE_BROADPHASE_NULL_PROXY && !fe_aabb_contains(&bp->nodes[start].aabb, &fat)) {
+        start = bp->nodes[start].parent;
+    }
+    bp->nodes[proxy_id].aabb = fat;
+    fe_bp_insert_leaf_from(bp, proxy_id, start != FE_BROADPHASE_NULL_PROXY ? start : bp->root);
+    fe_bp_buffer_move(bp, proxy_id);
+    return true;
+}
+
+/**
+ * Uygulama: fe_broadphase_update_pairs
+ */
+void fe_broadphase_update_pairs(fe_broadphase_t* bp) {
+    bp->removed_count = 0;
+    if (bp->move_count == 0) return;
+
+    // Silinmiş (veya silinip başka bir vekil olarak yeniden açılmış) kayıtlar moved bayrağıyla ayıklanır
+    uint32_t live = 0;
+    for (uint32_t m = 0; m < bp->move_count; ++m) {
+        uint32_t proxy_id = bp->move_buffer[m];
+        const fe_broadphase_node_t* node = &bp->nodes[proxy_id];
+        if (node->height == 0 && node->moved) bp->move_buffer[live++] = proxy_id;
+    }
+
+    // 1. Taşınan vekillerin artık kesişmeyen çiftlerini kendi listelerinden çıkar
+    // (Hiçbir ucu taşınmamış çiftlerin şişman kutuları değişmediği için kontrol gerekmez.)
+    for (uint32_t m = 0; m < live; ++m) {
+        fe_bp_remove_stale_pairs(bp, bp->move_buffer[m]);
+    }
+
+    // 2. Taşınan her vekil için ağaçta yeni çiftleri ara
+    for (uint32_t m = 0; m < live; ++m) {
+        fe_bp_query_moved(bp, bp->move_buffer[m]);
+    }
+
+    // 3. Taşıma tamponunu temizle (aynı vekil iki kez kaydedildiyse ikinci kayıt zaten temiz)
+    for (uint32_t m = 0; m < live; ++m) {
+        bp->nodes[bp->move_buffer[m]].moved = false;
+    }
+    bp->move_count = 0;
+}
+
+/**
+ * Uygulama: fe_broadphase_reserve_pairs
+ */
+bool fe_broadphase_reserve_pairs(fe_broadphase_t* bp, uint32_t extra_count) {
+    if (!bp || !bp->pairs) return false;
+
+    uint32_t required = bp->pair_count + extra_count;
+    if (required <= bp->pair_capacity) return true;
+
+    fe_broadphase_pair_t* pairs = (fe_broadphase_pair_t*)fe_mem_realloc(bp->pairs, (size_t)required * sizeof(fe_broadphase_pair_t));
+    if (!pairs) {
+        FE_LOG_ERROR("Broadphase: %u ciftlik yer ayrilamadi.", required);
+        return false;
+    }
+    // Sayfalar şimdi dokunulur; ilk kullanımda sayfa hatası olmaz
+    memset(pairs + bp->pair_capacity, 0, (size_t)(required - bp->pair_capacity) * sizeof(fe_broadphase_pair_t));
+    bp->pairs = pairs;
+    bp->pair_capacity = required;
+    return true;
+}
+
+/**
+ * Uygulama: fe_broadphase_query
+ */
+void fe_broadphase_query(const fe_broadphase_t* bp, const fe_aabb_t* aabb, fe_broadphase_query_callback_t callback, void* context) {
+    if (bp->root == FE_BROADPHASE_NULL_PROXY || !callback) return;
+
+    uint32_t stack[FE_BROADPHASE_STACK_SIZE];
+    uint32_t stack_count = 0;
+    stack[stack_count++] = bp->root;
+
+    while (stack_count > 0) {
+        uint32_t index = stack[--stack_count];
+        const fe_broadphase_node_t* node = &bp->nodes[index];
+        if (!fe_aabb_overlaps(&node->aabb, aabb)) continue;
+
+        if (fe_bp_is_leaf(node)) {
+            if (!callback(context, index)) return;
+        } else if (stack_count + 2 <= FE_BROADPHASE_STACK_SIZE) {
+            stack[stack_count++] = node->child1;
+            stack[stack_count++] = node->child2;
+        }
+    }
+}
@@ -1,9 +1,32 @@
 // src/physics/fe_cloth_physics.c
 
 #include "physics/fe_cloth_physics.h"
+#include "physics/fe_rigid_body.h" // Çarpışılan cisimler (broadphase user_data)
 #include "utils/fe_logger.h"
-#include <stdlib.h> // malloc, free
+#include "memory/fe_memory_manager.h" // fe_mem_calloc, fe_mem_realloc, fe_mem_free
+#include "platform/fe_job_system.h" // fe_job_parallel_for
+#include "math/fe_simd.h" // fe_simd_t, fe_simd_gather4, FE_SIMD_WIDTH
 #include <math.h>   // sqrtf, fmaxf
+#include <string.h> // memset, memcpy
+#include <float.h>  // FLT_MAX
+
+// Tek bir işin işlediği en fazla parçacık / kısıtlama sayısı
+#define FE_CLOTH_PARTICLE_GRAIN 1024
+#define FE_CLOTH_CONSTRAINT_GRAIN 512
+
+// Bu uzunluktan kısa kısıtlamaların yönü tanımsızdır; düzeltilmez
+#define FE_CLOTH_MIN_LENGTH 1e-6f
+
+// Kendi kendine çarpışmada aday arama yarıçapı / kalınlık (çözüm sırasındaki hareket payı dahil)
+#define FE_CLOTH_SELF_SEARCH_SCALE 2.0f
+
+// Dinlenme konumunda bundan (x kalınlık) yakın parçacıklar çarpışmaz; arama yarıçapından büyük
+// olmalıdır, aksi halde sıkışan ızgara komşuları aday olur
+#define FE_CLOTH_SELF_REST_SCALE 3.0f
+
+// Sürekli çarpışmada bir parçacık yolu için en fazla güvenli ilerleme adımı ve temas sayılan boşluk (x kalınlık)
+#define FE_CLOTH_CCD_ITERATIONS 16
+#define FE_CLOTH_CCD_TOLERANCE 0.1f
 
 // Benzersiz kimlik sayacı
 static uint32_t g_next_cloth_id = 1;
@@ -15,7 +38,7 @@ static uint32_t g_next_cloth_id = 1;
 /**
  * @brief İki parçacik arasina bir yay kısıtlaması ekler.
  */
-static void fe_cloth_add_constraint(fe_cloth_t* cloth, uint32_t i, uint32_t j, float stiffness) {
+static void fe_cloth_add_constraint(fe_cloth_t* cloth, uint32_t i, uint32_t j, float stiffness, float compliance) {
     if (i == j) return;
 
     // Uzaklığı hesapla ve rest_length olarak kullan
@@ -31,7 +54,8 @@ static void fe_cloth_add_constraint(fe_cloth_t* cloth, uint32_t i, uint32_t j, f
         .p1_index = i,
         .p2_index = j,
         .rest_length = rest_length,
-        .stiffness = stiffness
+        .stiffness = stiffness,
+        .compliance = compliance
     };
     fe_array_push(cloth->constraints, &new_constraint);
 }
@@ -40,7 +64,7 @@ static void fe_cloth_add_constraint(fe_cloth_t* cloth, uint32_t i, uint32_t j, f
  * Uygulama: fe_cloth_create_plane
  */
 fe_cloth_t* fe_cloth_create_plane(uint32_t w, uint32_t h, float size_x, float size_y) {
-    fe_cloth_t* cloth = (fe_cloth_t*)calloc(1, sizeof(fe_cloth_t));
+    fe_cloth_t* cloth = (fe_cloth_t*)fe_mem_calloc(1, sizeof(fe_cloth_t));
     if (!cloth) return NULL;
     
     cloth->id = g_next_cloth_id++;
@@ -48,7 +72,9 @@ fe_cloth_t* fe_cloth_create_plane(uint32_t w, uint32_t h, float size_x, float si
     cloth->constraints = fe_array_create(sizeof(fe_cloth_constraint_t));
     cloth->damping_factor = 0.99f;
     cloth->constraint_iterations = 4; // Tipik olarak 4-8 arası kullanılır
+    cloth->solver_type = FE_CLOTH_SOLVER_XPBD;
     cloth->wind_velocity = (fe_vec3_t){0.0f, 0.0f, 0.0f};
+    cloth->collision_thickness = fminf(size_x / (float)(w - 1), size_y / (float)(h - 1));
 
     float particle_mass = 1.0f / (float)(w * h); // Toplam kütleyi 1.0f yap
 
@@ -77,18 +103,18 @@ fe_cloth_t* fe_cloth_create_plane(uint32_t w, uint32_t h, float size_x, float si
             uint32_t current_idx = i + j * w;
             
             // A. Yapısal (Structural) - Sağ ve Aşağı
-            if (i < w - 1) fe_cloth_add_constraint(cloth, current_idx, current_idx + 1, structural_stiffness);
-            if (j < h - 1) fe_cloth_add_constraint(cloth, current_idx, current_idx + w, structural_stiffness);
+            if (i < w - 1) fe_cloth_add_constraint(cloth, current_idx, current_idx + 1, structural_stiffness, FE_CLOTH_STRUCTURAL_COMPLIANCE);
+            if (j < h - 1) fe_cloth_add_constraint(cloth, current_idx, current_idx + w, structural_stiffness, FE_CLOTH_STRUCTURAL_COMPLIANCE);
 
             // B. Makaslama (Shear) - Köşegenler (Çapraz)
             if (i < w - 1 && j < h - 1) {
-                fe_cloth_add_constraint(cloth, current_idx, current_idx + w + 1, shear_stiffness); // Sağ-Aşağı
-                fe_cloth_add_constraint(cloth, current_idx + 1, current_idx + w, shear_stiffness); // Sol-Aşağı (next row, prev col)
+                fe_cloth_add_constraint(cloth, current_idx, current_idx + w + 1, shear_stiffness, FE_CLOTH_SHEAR_COMPLIANCE); // Sağ-Aşağı
+                fe_cloth_add_constraint(cloth, current_idx + 1, current_idx + w, shear_stiffness, FE_CLOTH_SHEAR_COMPLIANCE); // Sol-Aşağı (next row, prev col)
             }
 
             // C. Bükülme (Bending) - İki boşluk atlama
-            if (i < w - 2) fe_cloth_add_constraint(cloth, current_idx, current_idx + 2, bending_stiffness); // Yatay
-            if (j < h - 2) fe_cloth_add_constraint(cloth, current_idx, current_idx + 2 * w, bending_stiffness); // Dikey
+            if (i < w - 2) fe_cloth_add_constraint(cloth, current_idx, current_idx + 2, bending_stiffness, FE_CLOTH_BENDING_COMPLIANCE); // Yatay
+            if (j < h - 2) fe_cloth_add_constraint(cloth, current_idx, current_idx + 2 * w, bending_stiffness, FE_CLOTH_BENDING_COMPLIANCE); // Dikey
         }
     }
 
@@ -104,8 +130,13 @@ void fe_cloth_destroy(fe_cloth_t* cloth) {
     if (cloth) {
         if (cloth->particles) fe_array_destroy(cloth->particles);
         if (cloth->constraints) fe_array_destroy(cloth->constraints);
-        free(cloth);
+        fe_mem_free(cloth->xpbd.position);
+        fe_mem_free(cloth->xpbd.p1_index);
+        fe_mem_free(cloth->xpbd.shapes);
+        fe_mem_free(cloth->xpbd.hash_start);
+        fe_mem_free(cloth->xpbd.pairs);
         FE_LOG_TRACE("Kumas %u yok edildi.", cloth->id);
+        fe_mem_free(cloth);
     }
 }
 
@@ -163,11 +194,9 @@ static void fe_cloth_resolve_constraint(fe_cloth_t* cloth, fe_cloth_constraint_t
 }
 
 /**
- * Uygulama: fe_cloth_simulate_step
+ * @brief Sertlik katsayılı, sıralı (Gauss-Seidel) PBD adımı.
  */
-void fe_cloth_simulate_step(fe_cloth_t* cloth, fe_vec3_t gravity, float dt) {
-    if (!cloth) return;
-
+static void fe_cloth_simulate_step_pbd(fe_cloth_t* cloth, fe_vec3_t gravity, float dt) {
     // 1. Kuvvetleri Uygula (Yerçekimi ve Rüzgar)
     for (size_t i = 0; i < fe_array_count(cloth->particles); ++i) {
         fe_cloth_particle_t* p = (fe_cloth_particle_t*)fe_array_get(cloth->particles, i);
@@ -225,3 +254,776 @@ void fe_cloth_simulate_step(fe_cloth_t* cloth, fe_vec3_t gravity, float dt) {
     
     
 }
+
+// ----------------------------------------------------------------------
+// 3. ÇARPIŞMA
+// ----------------------------------------------------------------------
+
+typedef struct fe_cloth_shape_query {
+    fe_cloth_xpbd_t* state;
+    const fe_broadphase_t* broadphase;
+} fe_cloth_shape_query_t;
+
+/**
+ * @brief Broadphase sorgusunun geri çağrısı: cismin geometrisini dünya uzayında kaydeder.
+ */
+static bool fe_cloth_collect_shape(void* context, uint32_t proxy_id) {
+    fe_cloth_shape_query_t* query = (fe_cloth_shape_query_t*)context;
+    fe_cloth_xpbd_t* s = query->state;
+    const fe_rigid_body_t* rb = (const fe_rigid_body_t*)fe_broadphase_get_user_data(query->broadphase, proxy_id);
+    if (!rb || !rb->collider) return true;
+
+    if (s->shape_count == s->shape_capacity) {
+        uint32_t capacity = s->shape_capacity ? s->shape_capacity * 2 : 8;
+        fe_cloth_shape_t* shapes = (fe_cloth_shape_t*)fe_mem_realloc(s->shapes, capacity * sizeof(fe_cloth_shape_t));
+        if (!shapes) return false; // Kalan cisimler bu adım yok sayılır
+        s->shapes = shapes;
+        s->shape_capacity = capacity;
+    }
+
+    const fe_collider_t* collider = rb->collider;
+    fe_cloth_shape_t* shape = &s->shapes[s->shape_count++];
+    fe_vec3_t rows[3];
+    fe_physics_quat_to_rows(rb->orientation, rows);
+    for (int i = 0; i < 3; ++i) {
+        shape->axis[i] = (fe_vec3_t){{rows[0].v[i], rows[1].v[i], rows[2].v[i]}};
+        shape->center.v[i] = rb->position.v[i] + fe_vec3_dot(rows[i], collider->local_offset);
+    }
+    shape->type = collider->type;
+    shape->half_extents = (fe_vec3_t){{0.0f, 0.0f, 0.0f}};
+    shape->radius = 0.0f;
+    shape->half_height = 0.0f;
+    if (collider->type == FE_COLLIDER_BOX) {
+        shape->half_extents = collider->shape.box.half_extents;
+    } else if (collider->type == FE_COLLIDER_CAPSULE) {
+        shape->radius = collider->shape.capsule.radius;
+        shape->half_height = collider->shape.capsule.half_height;
+    } else {
+        shape->radius = collider->shape.sphere.radius;
+    }
+    shape->min_extent = fe_collider_get_min_extent(collider);
+
+    fe_collider_compute_aabb(collider, rb->position, rb->orientation, &shape->bounds);
+    for (int i = 0; i < 3; ++i) {
+        shape->bounds.min.v[i] -= s->thickness;
+        shape->bounds.max.v[i] += s->thickness;
+    }
+    return true;
+}
+
+/**
+ * @brief Tahmin edilen konumların ve adım başı konumlarının kapsadığı geometrileri toplar.
+ */
+static void fe_cloth_gather_shapes(fe_cloth_t* cloth, uint32_t particle_count) {
+    fe_cloth_xpbd_t* s = &cloth->xpbd;
+    s->shape_count = 0;
+
+    fe_aabb_t bounds = { s->prev_position[0], s->prev_position[0] };
+    for (uint32_t i = 0; i < particle_count; ++i) {
+        for (int k = 0; k < 3; ++k) {
+            float a = s->prev_position[i].v[k], b = s->position[i].v[k];
+            bounds.min.v[k] = fminf(bounds.min.v[k], fminf(a, b));
+            bounds.max.v[k] = fmaxf(bounds.max.v[k], fmaxf(a, b));
+        }
+    }
+    for (int k = 0; k < 3; ++k) {
+        bounds.min.v[k] -= s->thickness;
+        bounds.max.v[k] += s->thickness;
+    }
+
+    fe_cloth_shape_query_t query = { s, cloth->collision_broadphase };
+    fe_broadphase_query(cloth->collision_broadphase, &bounds, fe_cloth_collect_shape, &query);
+}
+
+/**
+ * @brief Noktanın geometri yüzeyine işaretli uzaklığı (içeride negatif) ve dışa bakan normal.
+ */
+static float fe_cloth_shape_distance(const fe_cloth_shape_t* shape, fe_vec3_t point, fe_vec3_t* out_normal) {
+    fe_vec3_t rel = fe_vec3_subtract(point, shape->center);
+
+    if (shape->type == FE_COLLIDER_BOX) {
+        float local[3], excess[3];
+        float outside_sq = 0.0f;
+        int deepest = 0;
+        for (int i = 0; i < 3; ++i) {
+            local[i] = fe_vec3_dot(rel, shape->axis[i]);
+            excess[i] = fabsf(local[i]) - shape->half_extents.v[i];
+            if (excess[i] > 0.0f) outside_sq += excess[i] * excess[i];
+            if (excess[i] > excess[deepest]) deepest = i;
+        }
+
+        if (outside_sq > 0.0f) {
+            // Dışarıda: en yakın yüzey noktasına olan uzaklık
+            float outside = sqrtf(outside_sq);
+            fe_vec3_t normal = {{0.0f, 0.0f, 0.0f}};
+            for (int i = 0; i < 3; ++i) {
+                if (excess[i] > 0.0f) normal = fe_vec3_add(normal, fe_vec3_scale(shape->axis[i], copysignf(excess[i], local[i]) / outside));
+            }
+            *out_normal = normal;
+            return outside;
+        }
+        // İçeride: en yakın yüzün normali
+        *out_normal = fe_vec3_scale(shape->axis[deepest], local[deepest] < 0.0f ? -1.0f : 1.0f);
+        return excess[deepest];
+    }
+
+    if (shape->type == FE_COLLIDER_CAPSULE) {
+        // Eksen parçasının en yakın noktasına göre küre testi
+        float h = fe_vec3_dot(rel, shape->axis[1]);
+        h = h < -shape->half_height ? -shape->half_height : (h > shape->half_height ? shape->half_height : h);
+        rel = fe_vec3_subtract(rel, fe_vec3_scale(shape->axis[1], h));
+    }
+
+    float length = fe_vec3_length(rel);
+    *out_normal = length > FE_CLOTH_MIN_LENGTH ? fe_vec3_scale(rel, 1.0f / length) : shape->axis[1];
+    return length - shape->radius;
+}
+
+static inline bool fe_cloth_point_in_bounds(const fe_aabb_t* box, fe_vec3_t p) {
+    return p.x >= box->min.x && p.x <= box->max.x && p.y >= box->min.y && p.y <= box->max.y &&
+           p.z >= box->min.z && p.z <= box->max.z;
+}
+
+/**
+ * @brief Parçacıkları geometrilerin kalınlık kadar dışına iter (iş sistemi parçası).
+ * * Sürekli geçişte, adımda geometrinin en ince yarı kalınlığından fazla yol alan parçacığın yolu
+ * * güvenli ilerlemeyle (her seferinde yüzeye olan uzaklık kadar) taranır ve parçacık ilk temasta
+ * * durdurulur: ince geometrilerden geçmez. Daha yavaş parçacıklar için ayrık itme yeterlidir.
+ */
+static void fe_cloth_xpbd_collide_range(void* data, uint32_t begin, uint32_t end) {
+    const fe_cloth_xpbd_t* s = &((fe_cloth_t*)data)->xpbd;
+    float thickness = s->thickness;
+
+    for (uint32_t i = begin; i < end; ++i) {
+        fe_vec4_t* particle = &s->position[i];
+        if (particle->w <= 0.0f) continue;
+        fe_vec3_t p = {{particle->x, particle->y, particle->z}};
+        fe_vec3_t prev = s->prev_position[i];
+
+        for (uint32_t c = 0; c < s->shape_count; ++c) {
+            const fe_cloth_shape_t* shape = &s->shapes[c];
+            fe_vec3_t normal;
+
+            if (s->continuous) {
+                fe_aabb_t path = {
+                    {{fminf(p.x, prev.x), fminf(p.y, prev.y), fminf(p.z, prev.z)}},
+                    {{fmaxf(p.x, prev.x), fmaxf(p.y, prev.y), fmaxf(p.z, prev.z)}}
+                };
+                if (!fe_aabb_overlaps(&path, &shape->bounds)) continue;
+
+                fe_vec3_t delta = fe_vec3_subtract(p, prev);
+                float travel = fe_vec3_length(delta);
+                if (travel > shape->min_extent + thickness) {
+                    // Yineleme sınırına ulaşılırsa parçacık son güvenli noktada kalır (asla içeri girmez)
+                    fe_vec3_t direction = fe_vec3_scale(delta, 1.0f / travel);
+                    float t = 0.0f;
+                    for (uint32_t k = 0; k < FE_CLOTH_CCD_ITERATIONS && t < travel; ++k) {
+                        float gap = fe_cloth_shape_distance(shape, fe_vec3_add(prev, fe_vec3_scale(direction, t)), &normal) - thickness;
+                        if (gap <= thickness * FE_CLOTH_CCD_TOLERANCE) break;
+                        t += gap;
+                    }
+                    if (t < travel) p = fe_vec3_add(prev, fe_vec3_scale(direction, t));
+                }
+            } else if (!fe_cloth_point_in_bounds(&shape->bounds, p)) {
+                continue;
+            }
+
+            float distance = fe_cloth_shape_distance(shape, p, &normal);
+            if (distance < thickness) p = fe_vec3_add(p, fe_vec3_scale(normal, thickness - distance));
+        }
+
+        particle->x = p.x;
+        particle->y = p.y;
+        particle->z = p.z;
+    }
+}
+
+static bool fe_cloth_xpbd_reserve_hash(fe_cloth_xpbd_t* s, uint32_t count) {
+    if (count <= s->hash_capacity) return true;
+    uint32_t capacity = s->hash_capacity ? s->hash_capacity : 64;
+    while (capacity < count) capacity *= 2;
+
+    // Karma tablosu parçacık sayısının iki katı (2'nin kuvveti), hücre başlangıçları + 1 sonlandırıcı
+    uint32_t table_size = capacity * 2;
+    size_t total = (size_t)table_size + 1 + capacity * (2 + (size_t)FE_CLOTH_MAX_SELF_NEIGHBORS);
+    uint32_t* block = (uint32_t*)fe_mem_realloc(s->hash_start, total * sizeof(uint32_t));
+    if (!block) return false;
+    s->hash_start = block;
+    s->hash_entries = block + table_size + 1;
+    s->neighbor_count = s->hash_entries + capacity;
+    s->neighbors = s->neighbor_count + capacity;
+    s->hash_mask = table_size - 1;
+    s->hash_capacity = capacity;
+    return true;
+}
+
+/**
+ * @brief Maskedeki en düşük 0 bitinin indeksini döndürür (mask != UINT32_MAX olmalı).
+ */
+static inline uint32_t fe_cloth_first_free_color(uint32_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (uint32_t)__builtin_ctz(~mask);
+#else
+    uint32_t index = 0;
+    while (mask & 1u) { mask >>= 1; ++index; }
+    return index;
+#endif
+}
+
+/**
+ * @brief Hücre karması. X'te ardışık hücreler ardışık kovalara düşer: bir satırdaki üç komşu
+ * * hücrenin parçacıkları hash_entries içinde tek bir aralıktır.
+ */
+static inline uint32_t fe_cloth_hash_cell(int32_t x, int32_t y, int32_t z, uint32_t mask) {
+    return ((((uint32_t)y * 689287499u) ^ ((uint32_t)z * 283923481u)) + (uint32_t)x) & mask;
+}
+
+static inline int32_t fe_cloth_cell_coord(float value, float inv_cell) {
+    return (int32_t)floorf(value * inv_cell);
+}
+
+/**
+ * @brief Her parçacık için arama yarıçapındaki, dinlenme konumunda uzak aday komşuları bulur (iş sistemi parçası).
+ * * Yarım komşuluk taranır: parçacığın hücresi (indeksi büyük olanlar), aynı satırdaki sonraki hücre
+ * * ve dört ileri satır. Her hücre çifti bir kez ziyaret edildiğinden her çift bir kez bulunur.
+ */
+static void fe_cloth_xpbd_self_search_range(void* data, uint32_t begin, uint32_t end) {
+    fe_cloth_xpbd_t* s = &((fe_cloth_t*)data)->xpbd;
+    float radius = s->thickness * FE_CLOTH_SELF_SEARCH_SCALE;
+    float radius_sq = radius * radius;
+    float rest_sq = s->thickness * s->thickness * FE_CLOTH_SELF_REST_SCALE * FE_CLOTH_SELF_REST_SCALE;
+    float inv_cell = 1.0f / radius;
+    uint32_t mask = s->hash_mask;
+
+    for (uint32_t i = begin; i < end; ++i) {
+        const fe_vec4_t* pi = &s->position[i];
+        uint32_t* slots = &s->neighbors[(size_t)i * FE_CLOTH_MAX_SELF_NEIGHBORS];
+        uint32_t count = 0;
+        int32_t cx = fe_cloth_cell_coord(pi->x, inv_cell);
+        int32_t cy = fe_cloth_cell_coord(pi->y, inv_cell);
+        int32_t cz = fe_cloth_cell_coord(pi->z, inv_cell);
+
+        uint32_t own = fe_cloth_hash_cell(cx, cy, cz, mask);
+        uint32_t own_end = s->hash_start[own + 1];
+
+        // Satır 0: kendi hücresi ve sonraki; 1: (y+1, z); 2-4: z+1 satırında y-1..y+1. Bir satırın
+        // hücreleri ardışık kovalardır (tablonun sonunda ikiye bölünür).
+        for (int32_t row = 0; row < 5; ++row) {
+            int32_t dy = row == 0 ? 0 : (row == 1 ? 1 : row - 3);
+            int32_t dz = row < 2 ? 0 : 1;
+            uint32_t first = row == 0 ? own : fe_cloth_hash_cell(cx - 1, cy + dy, cz + dz, mask);
+            uint32_t last = first + (row == 0 ? 2 : 3);
+            uint32_t ranges[2][2] = { { first, last }, { 0, 0 } };
+            if (last > mask + 1) {
+                ranges[0][1] = mask + 1;
+                ranges[1][1] = last - (mask + 1);
+            }
+            for (int r = 0; r < 2; ++r) {
+                for (uint32_t e = s->hash_start[ranges[r][0]]; e < s->hash_start[ranges[r][1]]; ++e) {
+                    uint32_t j = s->hash_entries[e];
+                    if (row == 0 && e < own_end && j <= i) continue;
+
+                    const fe_vec4_t* pj = &s->position[j];
+                    float ex = pi->x - pj->x, ey = pi->y - pj->y, ez = pi->z - pj->z;
+                    if (ex * ex + ey * ey + ez * ez > radius_sq || j == i) continue;
+                    const fe_vec3_t* ri = &s->rest_position[i];
+                    const fe_vec3_t* rj = &s->rest_position[j];
+                    float rx = ri->x - rj->x, ry = ri->y - rj->y, rz = ri->z - rj->z;
+                    if (rx * rx + ry * ry + rz * rz < rest_sq || count == FE_CLOTH_MAX_SELF_NEIGHBORS) continue;
+
+                    // Farklı hücreler aynı karma kovasına düşebilir; aynı komşu iki kez eklenmez
+                    bool duplicate = false;
+                    for (uint32_t k = 0; k < count; ++k) duplicate |= slots[k] == j;
+                    if (!duplicate) slots[count++] = j;
+                }
+            }
+        }
+        s->neighbor_count[i] = count;
+    }
+}
+
+/**
+ * @brief Tahmin edilen konumlarda uzamsal karmayı kurar, aday çiftleri toplar ve renklere ayırır.
+ * * Maliyet parçacık sayısıyla doğrusaldır: sayma sıralaması ile kurulum, parçacık başına 5 aralık.
+ * * Çiftler kısıtlamalar gibi açgözlü boyanır (ortak parçacık paylaşmayan gruplar); aday sırası
+ * * sabit olduğundan renkler ve çözüm sırası iş parçacığı sayısından bağımsızdır.
+ */
+static bool fe_cloth_xpbd_build_self_pairs(fe_cloth_t* cloth, uint32_t particle_count) {
+    fe_cloth_xpbd_t* s = &cloth->xpbd;
+    s->pair_count = 0;
+    if (!fe_cloth_xpbd_reserve_hash(s, particle_count)) {
+        FE_LOG_ERROR("Kumas %u: carpisma karmasi buyutulemedi.", cloth->id);
+        return false;
+    }
+
+    // 1. Hücre sayımı (hücre neighbor_count'ta geçici olarak tutulur); hücre kenarı arama yarıçapıdır
+    float inv_cell = 1.0f / (s->thickness * FE_CLOTH_SELF_SEARCH_SCALE);
+    memset(s->hash_start, 0, (s->hash_mask + 2) * sizeof(uint32_t));
+    for (uint32_t i = 0; i < particle_count; ++i) {
+        const fe_vec4_t* p = &s->position[i];
+        uint32_t cell = fe_cloth_hash_cell(fe_cloth_cell_coord(p->x, inv_cell), fe_cloth_cell_coord(p->y, inv_cell),
+                                           fe_cloth_cell_coord(p->z, inv_cell), s->hash_mask);
+        s->neighbor_count[i] = cell;
+        s->hash_start[cell]++;
+    }
+
+    // 2. Önek toplamı (hücre sonları), ardından geriye doğru yerleştirme (hücre başlangıçları kalır)
+    for (uint32_t c = 1; c <= s->hash_mask + 1; ++c) s->hash_start[c] += s->hash_start[c - 1];
+    for (uint32_t i = particle_count; i-- > 0;) s->hash_entries[--s->hash_start[s->neighbor_count[i]]] = i;
+
+    // 3. Aday komşular (paralel)
+    fe_job_parallel_for(particle_count, FE_CLOTH_PARTICLE_GRAIN, fe_cloth_xpbd_self_search_range, cloth);
+
+    // 4. Çift dizisini büyüt (çiftler ve aday renkleri tek blokta)
+    uint32_t total = 0;
+    for (uint32_t i = 0; i < particle_count; ++i) total += s->neighbor_count[i];
+    if (total > s->pair_capacity) {
+        uint32_t capacity = s->pair_capacity ? s->pair_capacity : 64;
+        while (capacity < total) capacity *= 2;
+        size_t pair_bytes = (size_t)capacity * sizeof(fe_cloth_self_pair_t);
+        uint8_t* block = (uint8_t*)fe_mem_realloc(s->pairs, pair_bytes + capacity);
+        if (!block) {
+            FE_LOG_ERROR("Kumas %u: carpisma ciftleri buyutulemedi.", cloth->id);
+            return false;
+        }
+        s->pairs = (fe_cloth_self_pair_t*)block;
+        s->pair_color = block + pair_bytes;
+        s->pair_capacity = capacity;
+    }
+
+    // 5. Açgözlü boyama, aday sırasıyla. Arama bittiği için hash_entries parçacık renk maskesi olarak kullanılır.
+    uint32_t* particle_colors = s->hash_entries;
+    uint32_t* color_size = &s->self_color_start[1];
+    memset(particle_colors, 0, particle_count * sizeof(uint32_t));
+    memset(s->self_color_start, 0, sizeof(s->self_color_start));
+    s->self_color_count = 0;
+    uint32_t candidate = 0;
+    for (uint32_t i = 0; i < particle_count; ++i) {
+        const uint32_t* slots = &s->neighbors[(size_t)i * FE_CLOTH_MAX_SELF_NEIGHBORS];
+        for (uint32_t k = 0; k < s->neighbor_count[i]; ++k) {
+            uint32_t j = slots[k];
+            uint32_t used = particle_colors[i] | particle_colors[j];
+            uint32_t color = FE_CLOTH_MAX_COLORS; // Taşma
+            if (used != UINT32_MAX) {
+                color = fe_cloth_first_free_color(used);
+                particle_colors[i] |= 1u << color;
+                particle_colors[j] |= 1u << color;
+                if (color + 1 > s->self_color_count) s->self_color_count = color + 1;
+            }
+            s->pair_color[candidate++] = (uint8_t)color;
+            color_size[color]++;
+        }
+    }
+    for (uint32_t c = 0; c <= FE_CLOTH_MAX_COLORS; ++c) s->self_color_start[c + 1] += s->self_color_start[c];
+
+    // 6. Çiftleri renk gruplarına yerleştir (sayma sıralaması; renk içinde aday sırası korunur)
+    uint32_t cursor[FE_CLOTH_MAX_COLORS + 1];
+    memcpy(cursor, s->self_color_start, sizeof(cursor));
+    candidate = 0;
+    for (uint32_t i = 0; i < particle_count; ++i) {
+        const uint32_t* slots = &s->neighbors[(size_t)i * FE_CLOTH_MAX_SELF_NEIGHBORS];
+        for (uint32_t k = 0; k < s->neighbor_count[i]; ++k) {
+            fe_cloth_self_pair_t* pair = &s->pairs[cursor[s->pair_color[candidate++]]++];
+            pair->a = i;
+            pair->b = slots[k];
+            fe_vec3_t start = fe_vec3_subtract(s->prev_position[i], s->prev_position[slots[k]]);
+            float length = fe_vec3_length(start);
+            pair->normal = length > FE_CLOTH_MIN_LENGTH ? fe_vec3_scale(start, 1.0f / length) : (fe_vec3_t){{0.0f, 0.0f, 0.0f}};
+        }
+    }
+    s->pair_count = total;
+    return true;
+}
+
+/**
+ * @brief [first, last) aralığındaki aday çiftleri birbirinden en az kalınlık kadar uzak tutar.
+ * * Adım başında ayrı olup birbirinin içinden geçen çiftler (bağıl yönü tersine dönmüş ve yan
+ * * yana düşmüş) adım başındaki yönlerine geri itilir; ince kumaş katmanları bir adımda
+ * * birbirinden geçemez.
+ */
+static void fe_cloth_xpbd_solve_self_pairs(fe_cloth_xpbd_t* s, uint32_t first, uint32_t last) {
+    float thickness = s->thickness;
+    float thickness_sq = thickness * thickness;
+
+    for (uint32_t k = first; k < last; ++k) {
+        const fe_cloth_self_pair_t* pair = &s->pairs[k];
+        fe_vec4_t* a = &s->position[pair->a];
+        fe_vec4_t* b = &s->position[pair->b];
+        float w = a->w + b->w;
+        if (w <= 0.0f) continue;
+
+        float dx = a->x - b->x, dy = a->y - b->y, dz = a->z - b->z;
+        float distance_sq = dx * dx + dy * dy + dz * dz;
+        float along = dx * pair->normal.x + dy * pair->normal.y + dz * pair->normal.z;
+
+        fe_vec3_t normal;
+        float separation;
+        if (along < 0.0f && distance_sq - along * along < thickness_sq) {
+            normal = pair->normal;
+            separation = along;
+        } else {
+            if (distance_sq >= thickness_sq) continue;
+            separation = sqrtf(distance_sq);
+            if (separation < FE_CLOTH_MIN_LENGTH) continue;
+            normal = (fe_vec3_t){{dx / separation, dy / separation, dz / separation}};
+        }
+
+        float correction = (thickness - separation) / w;
+        float sa = correction * a->w, sb = correction * b->w;
+        a->x += normal.x * sa; a->y += normal.y * sa; a->z += normal.z * sa;
+        b->x -= normal.x * sb; b->y -= normal.y * sb; b->z -= normal.z * sb;
+    }
+}
+
+/**
+ * @brief Çözülen çift renginin [begin, end) aralığını çözer (iş sistemi parçası).
+ */
+static void fe_cloth_xpbd_solve_self_range(void* data, uint32_t begin, uint32_t end) {
+    fe_cloth_xpbd_t* s = &((fe_cloth_t*)data)->xpbd;
+    fe_cloth_xpbd_solve_self_pairs(s, s->batch_offset + begin, s->batch_offset + end);
+}
+
+/**
+ * @brief Kendi kendine çarpışma geçişi: renkler sırayla, her rengin çiftleri paralel; taşma grubu sıralı.
+ */
+static void fe_cloth_xpbd_solve_self(fe_cloth_t* cloth) {
+    fe_cloth_xpbd_t* s = &cloth->xpbd;
+    for (uint32_t color = 0; color < s->self_color_count; ++color) {
+        s->batch_offset = s->self_color_start[color];
+        fe_job_parallel_for(s->self_color_start[color + 1] - s->self_color_start[color], FE_CLOTH_CONSTRAINT_GRAIN,
+                            fe_cloth_xpbd_solve_self_range, cloth);
+    }
+    fe_cloth_xpbd_solve_self_pairs(s, s->self_color_start[FE_CLOTH_MAX_COLORS], s->self_color_start[FE_CLOTH_MAX_COLORS + 1]);
+}
+
+
+// ----------------------------------------------------------------------
+// 4. XPBD ÇÖZÜCÜSÜ
+// ----------------------------------------------------------------------
+
+static bool fe_cloth_xpbd_reserve_particles(fe_cloth_xpbd_t* s, uint32_t count) {
+    if (count <= s->particle_capacity) return true;
+    uint32_t capacity = s->particle_capacity ? s->particle_capacity : 64;
+    while (capacity < count) capacity *= 2;
+
+    // Konum + ters kütle (4 float), önceki ve dinlenme konumu (3'er float) tek blokta
+    fe_vec4_t* block = (fe_vec4_t*)fe_mem_realloc(s->position, (size_t)capacity * (sizeof(fe_vec4_t) + 2 * sizeof(fe_vec3_t)));
+    if (!block) return false;
+    s->position = block;
+    s->prev_position = (fe_vec3_t*)(block + capacity);
+    s->rest_position = s->prev_position + capacity;
+    s->particle_capacity = capacity;
+    return true;
+}
+
+static bool fe_cloth_xpbd_reserve_constraints(fe_cloth_xpbd_t* s, uint32_t count) {
+    if (count <= s->constraint_capacity) return true;
+    uint32_t capacity = s->constraint_capacity ? s->constraint_capacity : 64;
+    while (capacity < count) capacity *= 2;
+
+    // 5 dizi tek blokta: iki indeks, serbest uzunluk, uyum ve lambda (boyama sırasında kısıtlama rengi)
+    uint32_t* block = (uint32_t*)fe_mem_realloc(s->p1_index, (size_t)capacity * 5 * sizeof(uint32_t));
+    if (!block) return false;
+    s->p1_index = block;
+    s->p2_index = block + (size_t)capacity;
+    s->rest_length = (float*)(block + (size_t)capacity * 2);
+    s->compliance = (float*)(block + (size_t)capacity * 3);
+    s->lambda = (float*)(block + (size_t)capacity * 4);
+    s->constraint_capacity = capacity;
+    return true;
+}
+
+/**
+ * @brief Kısıtlamaları renklere ayırır ve SoA dizilerine renk sırasıyla yerleştirir.
+ * * Açgözlü boyama kayıt sırasıyla yapılır: kısıtlama, iki parçacığının da kullanmadığı ilk
+ * * rengi alır. Izgarada bir parçacığa en fazla 12 kısıtlama bağlıdır, bu yüzden renk sayısı
+ * * 23'ü geçmez; renk içinde kayıt sırası (ızgara yerelliği) korunur.
+ */
+static bool fe_cloth_xpbd_build(fe_cloth_t* cloth) {
+    fe_cloth_xpbd_t* s = &cloth->xpbd;
+    uint32_t particle_count = (uint32_t)fe_array_count(cloth->particles);
+    uint32_t total = (uint32_t)fe_array_count(cloth->constraints);
+
+    s->constraint_count = 0;
+    s->color_count = 0;
+    memset(s->color_start, 0, sizeof(s->color_start));
+    if (!fe_cloth_xpbd_reserve_particles(s, particle_count) || !fe_cloth_xpbd_reserve_constraints(s, total)) {
+        FE_LOG_ERROR("Kumas %u: XPBD dizileri buyutulemedi.", cloth->id);
+        return false;
+    }
+
+    // Parçacık renk maskeleri için konum dizisi geçici olarak kullanılır (adım başında yeniden yüklenir);
+    // kısıtlama renkleri de lambda dizisinde tutulur (adım başında sıfırlanır).
+    uint32_t* particle_colors = (uint32_t*)s->position;
+    uint32_t* constraint_colors = (uint32_t*)s->lambda;
+    memset(particle_colors, 0, particle_count * sizeof(uint32_t));
+
+    const fe_cloth_particle_t* particles = (const fe_cloth_particle_t*)cloth->particles->data;
+    for (uint32_t i = 0; i < particle_count; ++i) s->rest_position[i] = particles[i].position;
+
+    const fe_cloth_constraint_t* records = (const fe_cloth_constraint_t*)cloth->constraints->data;
+    uint32_t* color_size = &s->color_start[1];
+    for (uint32_t k = 0; k < total; ++k) {
+        const fe_cloth_constraint_t* c = &records[k];
+        constraint_colors[k] = UINT32_MAX;
+        if (c->p1_index >= particle_count || c->p2_index >= particle_count || c->p1_index == c->p2_index) continue;
+
+        uint32_t used = particle_colors[c->p1_index] | particle_colors[c->p2_index];
+        uint32_t color = FE_CLOTH_MAX_COLORS; // Taşma
+        if (used != UINT32_MAX) {
+            color = fe_cloth_first_free_color(used);
+            particle_colors[c->p1_index] |= 1u << color;
+            particle_colors[c->p2_index] |= 1u << color;
+            if (color + 1 > s->color_count) s->color_count = color + 1;
+        }
+        constraint_colors[k] = color;
+        color_size[color]++;
+    }
+
+    // Renklere göre grupla (sayma sıralaması)
+    for (uint32_t c = 0; c <= FE_CLOTH_MAX_COLORS; ++c) s->color_start[c + 1] += s->color_start[c];
+
+    uint32_t cursor[FE_CLOTH_MAX_COLORS + 1];
+    memcpy(cursor, s->color_start, sizeof(cursor));
+    for (uint32_t k = 0; k < total; ++k) {
+        uint32_t color = constraint_colors[k];
+        if (color == UINT32_MAX) continue;
+        uint32_t slot = cursor[color]++;
+        s->p1_index[slot] = records[k].p1_index;
+        s->p2_index[slot] = records[k].p2_index;
+        s->rest_length[slot] = records[k].rest_length;
+        s->compliance[slot] = records[k].compliance;
+    }
+    s->constraint_count = s->color_start[FE_CLOTH_MAX_COLORS + 1];
+    s->built_count = total;
+
+    uint32_t overflow = s->constraint_count - s->color_start[FE_CLOTH_MAX_COLORS];
+    if (overflow > 0) FE_LOG_WARN("Kumas %u: %u kisitlama renk bulamadi, sirali cozulecek.", cloth->id, overflow);
+    FE_LOG_DEBUG("Kumas %u: %u kisitlama %u renge ayrildi.", cloth->id, s->constraint_count, s->color_count);
+    return true;
+}
+
+/**
+ * @brief Kayıtları yükler, dış kuvvetleri uygular ve konumları tahmin eder (iş sistemi parçası).
+ */
+static void fe_cloth_xpbd_predict_range(void* data, uint32_t begin, uint32_t end) {
+    fe_cloth_t* cloth = (fe_cloth_t*)data;
+    fe_cloth_xpbd_t* s = &cloth->xpbd;
+    fe_cloth_particle_t* records = (fe_cloth_particle_t*)cloth->particles->data;
+
+    for (uint32_t i = begin; i < end; ++i) {
+        fe_cloth_particle_t* p = &records[i];
+        float w = (p->is_fixed || p->mass <= 0.0f) ? 0.0f : 1.0f / p->mass;
+
+        fe_vec3_t v = p->velocity;
+        if (w > 0.0f) {
+            // a = g + F/m; biriken kuvvet tüketilir
+            for (int k = 0; k < 3; ++k) {
+                v.v[k] = (v.v[k] + (s->gravity.v[k] + p->force_accumulator.v[k] * w) * s->dt) * s->damping;
+            }
+        } else {
+            v = (fe_vec3_t){{0.0f, 0.0f, 0.0f}};
+        }
+        p->force_accumulator = (fe_vec3_t){{0.0f, 0.0f, 0.0f}};
+
+        // Kumaşın ortak hareketine göre bağıl hız sınırı: iki katman bir adımda aday aramasını atlayamaz
+        fe_vec3_t relative = fe_vec3_subtract(v, s->mean_velocity);
+        float relative_sq = fe_vec3_dot(relative, relative);
+        if (relative_sq > s->max_relative_speed * s->max_relative_speed) {
+            v = fe_vec3_add(s->mean_velocity, fe_vec3_scale(relative, s->max_relative_speed / sqrtf(relative_sq)));
+        }
+
+        s->prev_position[i] = p->position;
+        for (int k = 0; k < 3; ++k) s->position[i].v[k] = p->position.v[k] + v.v[k] * s->dt;
+        s->position[i].w = w;
+    }
+}
+
+/**
+ * @brief Tek bir uzaklık kısıtlamasının XPBD düzeltmesi.
+ * * dlambda = (-C - alpha~ * lambda) / (w1 + w2 + alpha~), alpha~ = uyum / dt^2.
+ * * İşlem sırası SIMD şeritleriyle aynıdır (tek bölme, scale = pay / (payda * uzunluk)): bir rengin
+ * * hangi kısmının skaler çözüleceği aralık bölünmesine bağlı olduğundan sonuç bit bit aynı kalmalıdır.
+ */
+static inline void fe_cloth_xpbd_solve_one(fe_cloth_xpbd_t* s, uint32_t k) {
+    fe_vec4_t* a = &s->position[s->p1_index[k]];
+    fe_vec4_t* b = &s->position[s->p2_index[k]];
+    float alpha = s->compliance[k] * s->alpha_scale;
+    float denom = a->w + b->w + alpha;
+    if (denom <= 0.0f) return;
+
+    float dx = a->x - b->x;
+    float dy = a->y - b->y;
+    float dz = a->z - b->z;
+    float length = sqrtf(dx * dx + dy * dy + dz * dz);
+    if (length < FE_CLOTH_MIN_LENGTH) return;
+
+    float scale = (s->rest_length[k] - length - alpha * s->lambda[k]) * (1.0f / (denom * length));
+    s->lambda[k] += scale * length;
+
+    float sa = scale * a->w, sb = scale * b->w;
+    a->x += sa * dx; a->y += sa * dy; a->z += sa * dz;
+    b->x -= sb * dx; b->y -= sb * dy; b->z -= sb * dz;
+}
+
+/**
+ * @brief Çözülen rengin [begin, end) aralığını çözer (iş sistemi parçası).
+ * * Aynı renkteki kısıtlamalar ortak parçacık paylaşmaz: FE_SIMD_WIDTH kısıtlamanın uç kayıtları
+ * * toplanıp (gather) devrik yapılır, birlikte çözülür ve geri dağıtılır (scatter). Kalan kısım skaler çözülür.
+ */
+static void fe_cloth_xpbd_solve_range(void* data, uint32_t begin, uint32_t end) {
+    fe_cloth_xpbd_t* s = &((fe_cloth_t*)data)->xpbd;
+    uint32_t k = s->batch_offset + begin;
+    uint32_t last = s->batch_offset + end;
+
+#ifdef FE_SIMD_WIDTH
+    float* position = s->position[0].v;
+    const fe_simd_t alpha_scale = fe_simd_set1(s->alpha_scale);
+    const fe_simd_t min_length = fe_simd_set1(FE_CLOTH_MIN_LENGTH);
+    const fe_simd_t zero = fe_simd_zero();
+
+    for (; k + FE_SIMD_WIDTH <= last; k += FE_SIMD_WIDTH) {
+        const uint32_t* ia = &s->p1_index[k];
+        const uint32_t* ib = &s->p2_index[k];
+        fe_simd_t ax, ay, az, va, bx, by, bz, vb;
+        fe_simd_gather4(position, ia, &ax, &ay, &az, &va);
+        fe_simd_gather4(position, ib, &bx, &by, &bz, &vb);
+
+        fe_simd_t dx = fe_simd_sub(ax, bx);
+        fe_simd_t dy = fe_simd_sub(ay, by);
+        fe_simd_t dz = fe_simd_sub(az, bz);
+        fe_simd_t length = fe_simd_sqrt(fe_simd_add(fe_simd_add(fe_simd_mul(dx, dx), fe_simd_mul(dy, dy)), fe_simd_mul(dz, dz)));
+
+        fe_simd_t alpha = fe_simd_mul(fe_simd_load(&s->compliance[k]), alpha_scale);
+        fe_simd_t denom = fe_simd_add(fe_simd_add(va, vb), alpha);
+        fe_simd_t lambda = fe_simd_load(&s->lambda[k]);
+
+        // Çözülemeyen şeritler (iki ucu sabit veya sıfır uzunluk) dlambda = 0 alır
+        fe_simd_t valid = fe_simd_and(fe_simd_gt(denom, zero), fe_simd_gt(length, min_length));
+        // Tek bölme: scale = dlambda / length = numerator / (denom * length)
+        fe_simd_t inv = fe_simd_div(fe_simd_set1(1.0f), fe_simd_select(valid, fe_simd_mul(denom, length), fe_simd_set1(1.0f)));
+        fe_simd_t numerator = fe_simd_sub(fe_simd_sub(fe_simd_load(&s->rest_length[k]), length), fe_simd_mul(alpha, lambda));
+        fe_simd_t scale = fe_simd_and(fe_simd_mul(numerator, inv), valid);
+        fe_simd_store(&s->lambda[k], fe_simd_add(lambda, fe_simd_mul(scale, length)));
+
+        fe_simd_t sa = fe_simd_mul(scale, va), sb = fe_simd_mul(scale, vb);
+        // Şeritler farklı parçacıklara yazar (renk garantisi)
+        fe_simd_scatter4(position, ia, fe_simd_add(ax, fe_simd_mul(sa, dx)), fe_simd_add(ay, fe_simd_mul(sa, dy)),
+                         fe_simd_add(az, fe_simd_mul(sa, dz)), va);
+        fe_simd_scatter4(position, ib, fe_simd_sub(bx, fe_simd_mul(sb, dx)), fe_simd_sub(by, fe_simd_mul(sb, dy)),
+                         fe_simd_sub(bz, fe_simd_mul(sb, dz)), vb);
+    }
+#endif
+
+    for (; k < last; ++k) fe_cloth_xpbd_solve_one(s, k);
+}
+
+/**
+ * @brief Hızları konum farkından günceller ve sonucu kayıtlara yazar (iş sistemi parçası).
+ */
+static void fe_cloth_xpbd_finalize_range(void* data, uint32_t begin, uint32_t end) {
+    fe_cloth_t* cloth = (fe_cloth_t*)data;
+    fe_cloth_xpbd_t* s = &cloth->xpbd;
+    fe_cloth_particle_t* records = (fe_cloth_particle_t*)cloth->particles->data;
+    float inv_dt = 1.0f / s->dt;
+
+    for (uint32_t i = begin; i < end; ++i) {
+        fe_cloth_particle_t* p = &records[i];
+        p->prev_position = s->prev_position[i];
+        for (int k = 0; k < 3; ++k) {
+            p->position.v[k] = s->position[i].v[k];
+            p->velocity.v[k] = (s->position[i].v[k] - s->prev_position[i].v[k]) * inv_dt;
+        }
+    }
+}
+
+/**
+ * @brief XPBD adımı: tahmin, renk renk kısıtlama yinelemeleri, hız güncellemesi.
+ */
+static void fe_cloth_simulate_step_xpbd(fe_cloth_t* cloth, fe_vec3_t gravity, float dt) {
+    fe_cloth_xpbd_t* s = &cloth->xpbd;
+    uint32_t particle_count = (uint32_t)fe_array_count(cloth->particles);
+    if (particle_count == 0) return;
+
+    if (s->built_count != fe_array_count(cloth->constraints) || s->particle_count != particle_count) {
+        if (!fe_cloth_xpbd_build(cloth)) return;
+        s->particle_count = particle_count;
+    }
+
+    s->dt = dt;
+    s->alpha_scale = 1.0f / (dt * dt);
+    s->gravity = gravity;
+    s->damping = cloth->damping_factor;
+    s->thickness = cloth->collision_thickness;
+    s->mean_velocity = (fe_vec3_t){{0.0f, 0.0f, 0.0f}};
+    s->max_relative_speed = FLT_MAX;
+    if (cloth->self_collision && s->thickness > 0.0f) {
+        // Parçacıklar kumaşın ortalama hızına göre adımda en fazla bir kalınlık ilerler (bağıl yer
+        // değiştirme en fazla arama yarıçapı kadardır). Kumaşın bütün olarak hareketi sınırlanmaz.
+        const fe_cloth_particle_t* records = (const fe_cloth_particle_t*)cloth->particles->data;
+        fe_vec3_t sum = {{0.0f, 0.0f, 0.0f}};
+        uint32_t moving = 0;
+        for (uint32_t i = 0; i < particle_count; ++i) {
+            if (records[i].is_fixed || records[i].mass <= 0.0f) continue;
+            sum = fe_vec3_add(sum, records[i].velocity);
+            moving++;
+        }
+        if (moving > 0) {
+            for (int k = 0; k < 3; ++k) {
+                s->mean_velocity.v[k] = (sum.v[k] / (float)moving + gravity.v[k] * dt) * s->damping;
+            }
+        }
+        s->max_relative_speed = s->thickness * (FE_CLOTH_SELF_SEARCH_SCALE * 0.5f) / dt;
+    }
+
+    // 1. Kayıtları yükle ve konumları tahmin et
+    fe_job_parallel_for(particle_count, FE_CLOTH_PARTICLE_GRAIN, fe_cloth_xpbd_predict_range, cloth);
+
+    // 2. Çarpışma adayları: yolları kapsayan katı cisimler (ilk geçiş süreklidir) ve kendi kendine çarpışma çiftleri
+    bool collide_shapes = false;
+    bool collide_self = false;
+    if (cloth->collision_broadphase && s->thickness > 0.0f) {
+        fe_cloth_gather_shapes(cloth, particle_count);
+        collide_shapes = s->shape_count > 0;
+        if (collide_shapes) {
+            s->continuous = true;
+            fe_job_parallel_for(particle_count, FE_CLOTH_PARTICLE_GRAIN, fe_cloth_xpbd_collide_range, cloth);
+            s->continuous = false;
+        }
+    }
+    if (cloth->self_collision && s->thickness > 0.0f) {
+        collide_self = fe_cloth_xpbd_build_self_pairs(cloth, particle_count) && s->pair_count > 0;
+    }
+
+    // 3. Kısıtlamalar: renkler sırayla, her rengin kısıtlamaları paralel; taşma grubu, sonra çarpışmalar
+    memset(s->lambda, 0, s->constraint_count * sizeof(float));
+    uint32_t overflow = s->constraint_count - s->color_start[FE_CLOTH_MAX_COLORS];
+    for (uint32_t iter = 0; iter < cloth->constraint_iterations; ++iter) {
+        for (uint32_t color = 0; color < s->color_count; ++color) {
+            s->batch_offset = s->color_start[color];
+            fe_job_parallel_for(s->color_start[color + 1] - s->color_start[color], FE_CLOTH_CONSTRAINT_GRAIN,
+                                fe_cloth_xpbd_solve_range, cloth);
+        }
+        for (uint32_t k = s->color_start[FE_CLOTH_MAX_COLORS]; k < s->color_start[FE_CLOTH_MAX_COLORS] + overflow; ++k) {
+            fe_cloth_xpbd_solve_one(s, k);
+        }
+        if (collide_self) fe_cloth_xpbd_solve_self(cloth);
+        if (collide_shapes) fe_job_parallel_for(particle_count, FE_CLOTH_PARTICLE_GRAIN, fe_cloth_xpbd_collide_range, cloth);
+    }
+
+    // 4. Hızları güncelle ve kayıtlara yaz
+    fe_job_parallel_for(particle_count, FE_CLOTH_PARTICLE_GRAIN, fe_cloth_xpbd_finalize_range, cloth);
+}
+
+/**
+ * Uygulama: fe_cloth_simulate_step
+ */
+void fe_cloth_simulate_step(fe_cloth_t* cloth, fe_vec3_t gravity, float dt) {
+    if (!cloth || dt <= 0.0f) return;
+
+    if (cloth->solver_type == FE_CLOTH_SOLVER_PBD) {
+        fe_cloth_simulate_step_pbd(cloth, gravity, dt);
+    } else {
+        fe_cloth_simulate_step_xpbd(cloth, gravity, dt);
+    }
+}
@@ -0,0 +1,138 @@
+// src/physics/fe_collider.c
+
+#include "physics/fe_collider.h"
+#include "physics/fe_broadphase.h" // FE_BROADPHASE_NULL_PROXY
+#include "utils/fe_logger.h"
+#include "memory/fe_memory_manager.h" // fe_mem_calloc, fe_mem_free
+#include <math.h> // fabsf
+
+// ----------------------------------------------------------------------
+// 1. YARDIMCI FONKSİYONLAR
+// ----------------------------------------------------------------------
+
+static fe_collider_t* fe_collider_alloc(fe_collider_type_t type) {
+    fe_collider_t* collider = (fe_collider_t*)fe_mem_calloc(1, sizeof(fe_collider_t));
+    if (!collider) {
+        FE_LOG_ERROR("Collider icin bellek ayrilamadi.");
+        return NULL;
+    }
+    collider->type = type;
+    collider->proxy_id = FE_BROADPHASE_NULL_PROXY;
+    return collider;
+}
+
+
+// ----------------------------------------------------------------------
+// 2. YÖNETİM UYGULAMALARI
+// ----------------------------------------------------------------------
+
+/**
+ * Uygulama: fe_collider_create_sphere
+ */
+fe_collider_t* fe_collider_create_sphere(float radius) {
+    fe_collider_t* collider = fe_collider_alloc(FE_COLLIDER_SPHERE);
+    if (collider) {
+        collider->shape.sphere.radius = radius;
+    }
+    return collider;
+}
+
+/**
+ * Uygulama: fe_collider_create_box
+ */
+fe_collider_t* fe_collider_create_box(fe_vec3_t half_extents) {
+    fe_collider_t* collider = fe_collider_alloc(FE_COLLIDER_BOX);
+    if (collider) {
+        collider->shape.box.half_extents = half_extents;
+    }
+    return collider;
+}
+
+/**
+ * Uygulama: fe_collider_create_capsule
+ */
+fe_collider_t* fe_collider_create_capsule(float radius, float half_height) {
+    fe_collider_t* collider = fe_collider_alloc(FE_COLLIDER_CAPSULE);
+    if (collider) {
+        collider->shape.capsule.radius = radius;
+        collider->shape.capsule.half_height = half_height;
+    }
+    return collider;
+}
+
+/**
+ * Uygulama: fe_collider_destroy
+ */
+void fe_collider_destroy(fe_collider_t* collider) {
+    fe_mem_free(collider);
+}
+
+
+// ----------------------------------------------------------------------
+// 3. AABB HESAPLAMA
+// ----------------------------------------------------------------------
+
+/**
+ * Uygulama: fe_collider_compute_aabb
+ */
+void fe_collider_compute_aabb(const fe_collider_t* collider, fe_vec3_t position, fe_vec4_t orientation, fe_aabb_t* out_aabb) {
+    fe_vec3_t rows[3];
+    fe_physics_quat_to_rows(orientation, rows);
+
+    // Dünya uzayındaki geometri merkezi
+    fe_vec3_t center;
+    for (int i = 0; i < 3; ++i) {
+        center.v[i] = position.v[i] + fe_vec3_dot(rows[i], collider->local_offset);
+    }
+
+    fe_vec3_t extent;
+    switch (collider->type) {
+        case FE_COLLIDER_SPHERE: {
+            float r = collider->shape.sphere.radius;
+            extent = (fe_vec3_t){{r, r, r}};
+            break;
+        }
+        case FE_COLLIDER_BOX: {
+            // Döndürülmüş kutunun yarı boyutu: |R| * h
+            fe_vec3_t h = collider->shape.box.half_extents;
+            for (int i = 0; i < 3; ++i) {
+                extent.v[i] = fabsf(rows[i].x) * h.x + fabsf(rows[i].y) * h.y + fabsf(rows[i].z) * h.z;
+            }
+            break;
+        }
+        case FE_COLLIDER_CAPSULE: {
+            // Segment (yerel Y ekseni) uçlarının yarıçap kadar genişletilmişi
+            float r = collider->shape.capsule.radius;
+            float hh = collider->shape.capsule.half_height;
+            for (int i = 0; i < 3; ++i) {
+                extent.v[i] = fabsf(rows[i].y) * hh + r;
+            }
+            break;
+        }
+        default:
+            extent = (fe_vec3_t){{0.0f, 0.0f, 0.0f}};
+            break;
+    }
+
+    out_aabb->min = fe_vec3_subtract(center, extent);
+    out_aabb->max = fe_vec3_add(center, extent);
+}
+
+/**
+ * Uygulama: fe_collider_get_min_extent
+ */
+float fe_collider_get_min_extent(const fe_collider_t* collider) {
+    switch (collider->type) {
+        case FE_COLLIDER_SPHERE:
+            return collider->shape.sphere.radius;
+        case FE_COLLIDER_BOX: {
+            fe_vec3_t h = collider->shape.box.half_extents;
+            float m = h.x < h.y ? h.x : h.y;
+            return m < h.z ? m : h.z;
+        }
+        case FE_COLLIDER_CAPSULE:
+            return collider->shape.capsule.radius;
+        default:
+            return 0.0f;
+    }
+}
@@ -0,0 +1,927 @@
+// src/physics/fe_collision_solver.c
+
+#include "physics/fe_collision_solver.h"
+#include "physics/fe_physical_materials.h" // fe_material_combine_*
+#include "platform/fe_job_system.h" // fe_job_parallel_for
+#include "utils/fe_logger.h"
+#include "memory/fe_memory_manager.h" // fe_mem_calloc, fe_mem_realloc, fe_mem_free
+#include <string.h> // memset, memcpy
+#include <math.h> // sqrtf, fabsf, fminf, fmaxf
+
+#define FE_SOLVER_INITIAL_CONSTRAINTS 256
+
+// Dar fazda tek bir işin işlediği en fazla manifold sayısı
+#define FE_SOLVER_NARROWPHASE_GRAIN 32
+
+// ----------------------------------------------------------------------
+// 1. YARDIMCI FONKSİYONLAR
+// ----------------------------------------------------------------------
+
+// Çözücü döngüleri bu satır içi yardımcıları kullanır: fe_vec3_* çağrıları satır dışıdır ve
+// nokta/yineleme başına düzinelerce çağrı çözüm süresine hâkim olur.
+static inline float fe_solver_dot(fe_vec3_t a, fe_vec3_t b) {
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+static inline fe_vec3_t fe_solver_cross(fe_vec3_t a, fe_vec3_t b) {
+    return (fe_vec3_t){{ a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x }};
+}
+
+static inline fe_vec3_t fe_solver_madd(fe_vec3_t a, fe_vec3_t b, float s) {
+    return (fe_vec3_t){{ a.x + b.x * s, a.y + b.y * s, a.z + b.z * s }};
+}
+
+static inline fe_vec3_t fe_solver_scale(fe_vec3_t v, float s) {
+    return (fe_vec3_t){{ v.x * s, v.y * s, v.z * s }};
+}
+
+static inline fe_vec3_t fe_solver_mul_rows(const fe_vec3_t rows[3], fe_vec3_t v) {
+    return (fe_vec3_t){{ fe_solver_dot(rows[0], v), fe_solver_dot(rows[1], v), fe_solver_dot(rows[2], v) }};
+}
+
+/**
+ * @brief Normale dik iki birim teğet (sürtünme yönleri) üretir.
+ */
+static void fe_solver_tangent_basis(fe_vec3_t n, fe_vec3_t* out_t1, fe_vec3_t* out_t2) {
+    fe_vec3_t t = (fabsf(n.x) >= 0.57735f) ? (fe_vec3_t){{n.y, -n.x, 0.0f}} : (fe_vec3_t){{0.0f, n.z, -n.y}};
+    // Seçilen dal t'nin boyunu en az ~0.8 tutar; sıfıra bölme olmaz
+    *out_t1 = fe_solver_scale(t, 1.0f / sqrtf(fe_solver_dot(t, t)));
+    *out_t2 = fe_solver_cross(n, *out_t1);
+}
+
+/**
+ * @brief Bir yönün açısal Jacobian satırlarını hazırlar ve efektif kütleyi döndürür:
+ * * 1 / (mA + mB + (rA x d) . IA (rA x d) + (rB x d) . IB (rB x d)).
+ * @param axis 0: normal, 1-2: teğetler.
+ */
+static float fe_solver_prepare_axis(const fe_contact_constraint_t* c, fe_contact_point_t* p, int axis, fe_vec3_t dir) {
+    p->ra_cross[axis] = fe_solver_cross(p->r_a, dir);
+    p->rb_cross[axis] = fe_solver_cross(p->r_b, dir);
+    p->ia_ra_cross[axis] = fe_solver_mul_rows(c->inv_inertia_a, p->ra_cross[axis]);
+    p->ib_rb_cross[axis] = fe_solver_mul_rows(c->inv_inertia_b, p->rb_cross[axis]);
+    float k = c->inv_mass_a + c->inv_mass_b
+            + fe_solver_dot(p->ra_cross[axis], p->ia_ra_cross[axis])
+            + fe_solver_dot(p->rb_cross[axis], p->ib_rb_cross[axis]);
+    return (k > 0.0f) ? 1.0f / k : 0.0f;
+}
+
+/**
+ * @brief Ucun çözüm hızlarını okur (uyanık listede değilse kayıttan).
+ */
+static inline fe_solver_velocity_t fe_solver_load_velocity(const fe_collision_solver_t* solver, const fe_rigid_body_t* rb, uint32_t index) {
+    if (index < solver->velocity_count) return solver->velocities[index];
+    return (fe_solver_velocity_t){ rb->linear_velocity, rb->angular_velocity };
+}
+
+/**
+ * @brief Yerel hızları çözüm dizisine geri yazar. Sonsuz kütleli uçlara yazılmaz: farklı adalar
+ * * aynı zemini paylaşırken paralel çözülebilir.
+ */
+static inline void fe_solver_save_velocity(fe_collision_solver_t* solver, uint32_t index, float inv_mass, const fe_solver_velocity_t* vel) {
+    if (inv_mass > 0.0f && index < solver->velocity_count) solver->velocities[index] = *vel;
+}
+
+/**
+ * @brief d yönündeki lambda büyüklüğündeki impulsu temas noktasında A'ya ters, B'ye doğru yönde uygular.
+ * * Sonsuz kütleli uçların kütle ve eylemsizlik terimleri sıfırdır; dallanma gerekmez.
+ */
+static inline void fe_solver_apply_axis(const fe_contact_constraint_t* c, fe_solver_velocity_t* a, fe_solver_velocity_t* b,
+                                        const fe_contact_point_t* p, int axis, fe_vec3_t dir, float lambda) {
+    a->linear = fe_solver_madd(a->linear, dir, -lambda * c->inv_mass_a);
+    a->angular = fe_solver_madd(a->angular, p->ia_ra_cross[axis], -lambda);
+    b->linear = fe_solver_madd(b->linear, dir, lambda * c->inv_mass_b);
+    b->angular = fe_solver_madd(b->angular, p->ib_rb_cross[axis], lambda);
+}
+
+/**
+ * @brief Temas noktasında B'nin A'ya göre bağıl hızının d yönündeki bileşeni:
+ * * (vB - vA) . d + wB . (rB x d) - wA . (rA x d).
+ * @param linear_delta vB - vA (noktanın yönleri arasında paylaşılır).
+ */
+static inline float fe_solver_relative_speed(const fe_solver_velocity_t* a, const fe_solver_velocity_t* b, const fe_contact_point_t* p,
+                                             int axis, fe_vec3_t dir, fe_vec3_t linear_delta) {
+    return fe_solver_dot(linear_delta, dir) + fe_solver_dot(b->angular, p->rb_cross[axis]) - fe_solver_dot(a->angular, p->ra_cross[axis]);
+}
+
+static inline fe_vec3_t fe_solver_linear_delta(const fe_solver_velocity_t* a, const fe_solver_velocity_t* b) {
+    return (fe_vec3_t){{ b->linear.x - a->linear.x, b->linear.y - a->linear.y, b->linear.z - a->linear.z }};
+}
+
+/**
+ * @brief Süpürülen çiftin manifoldundan bu adım ulaşılamayacak öngörülü noktaları atar.
+ * * Bağıl yer değiştirmenin normal boyunca yaklaşma payından uzak boşluklar kapanamaz (örn: yan
+ * * yana uçan mermiler, yoldan geçerken yanındaki cisimler); bunlar çözücüye hayalet temas olarak girmez.
+ * @param relative_sweep B'nin A'ya göre bu adımdaki yer değiştirmesi.
+ */
+static void fe_solver_cull_unreachable(fe_narrowphase_manifold_t* manifold, fe_vec3_t relative_sweep) {
+    float approach = -fe_vec3_dot(relative_sweep, manifold->normal);
+    float reach = FE_NARROWPHASE_SPECULATIVE_DISTANCE + (approach > 0.0f ? approach : 0.0f);
+
+    uint32_t kept = 0;
+    for (uint32_t k = 0; k < manifold->point_count; ++k) {
+        if (manifold->points[k].penetration >= -reach) manifold->points[kept++] = manifold->points[k];
+    }
+    manifold->point_count = kept;
+}
+
+/**
+ * @brief Yok sayılan çiftlerin anahtarı: cisim adresleri sıralı (çift sırasından bağımsız).
+ */
+typedef struct fe_solver_body_pair_key {
+    uintptr_t first;
+    uintptr_t second;
+} fe_solver_body_pair_key_t;
+
+static inline fe_solver_body_pair_key_t fe_solver_body_pair_key(const fe_rigid_body_t* a, const fe_rigid_body_t* b) {
+    uintptr_t pa = (uintptr_t)a;
+    uintptr_t pb = (uintptr_t)b;
+    return (pa < pb) ? (fe_solver_body_pair_key_t){ pa, pb } : (fe_solver_body_pair_key_t){ pb, pa };
+}
+
+static inline bool fe_solver_is_ignored(fe_collision_solver_t* solver, const fe_rigid_body_t* a, const fe_rigid_body_t* b) {
+    if (solver->ignored_pair_count == 0) return false;
+    fe_solver_body_pair_key_t key = fe_solver_body_pair_key(a, b);
+    return fe_hashmap_get(solver->ignored_pairs, &key) != NULL;
+}
+
+static inline bool fe_solver_is_static(const fe_rigid_body_t* rb) {
+    return rb->is_kinematic || rb->inverse_mass <= 0.0f;
+}
+
+/**
+ * @brief Sıkı (şişman olmayan) AABB'ler öngörülü temas mesafesi içinde mi?
+ * * Broadphase çiftleri şişman kutulardan gelir; kenar payından küçük cisimlerde (örn: kırılma
+ * * parçaları) çiftlerin çoğu gerçekte uzaktır ve bu test onları dar faz testinden önce eler.
+ * * Süpürülen cisimlerin kutuları adımın sonunu da kapsadığından sürekli çarpışma etkilenmez.
+ */
+static inline bool fe_solver_aabbs_near(const fe_collider_t* a, const fe_collider_t* b) {
+    const float d = FE_NARROWPHASE_SPECULATIVE_DISTANCE;
+    return a->world_aabb.min.x <= b->world_aabb.max.x + d && b->world_aabb.min.x <= a->world_aabb.max.x + d &&
+           a->world_aabb.min.y <= b->world_aabb.max.y + d && b->world_aabb.min.y <= a->world_aabb.max.y + d &&
+           a->world_aabb.min.z <= b->world_aabb.max.z + d && b->world_aabb.min.z <= a->world_aabb.max.z + d;
+}
+
+/**
+ * @brief İki süpürülen cisim bu adımda birbirine ulaşabilir mi?
+ * * Broadphase kutuları mutlak süpürmeyi kapsar; birlikte uçan cisimlerin (örn: eğik duvarda kayan
+ * * mermiler) kutuları hep kesişir ama bağıl süpürmeleri küçüktür. A'nın başlangıç kutusu bağıl
+ * * süpürme boyunca genişletilip B'nin başlangıç kutusuyla sınanır; ulaşamayan çift manifold açmaz.
+ * * Tek taraf süpürülüyorsa birleşim kutusu zaten bağıl süpürmedir; bu test yalnızca ikisi de süpürülürken anlamlıdır.
+ */
+static inline bool fe_solver_sweeps_reach(const fe_collider_t* a, const fe_collider_t* b) {
+    const float d = FE_NARROWPHASE_SPECULATIVE_DISTANCE;
+    for (int axis = 0; axis < 3; ++axis) {
+        float sa = a->sweep.v[axis], sb = b->sweep.v[axis];
+        // Birleşim kutusundan başlangıç kutusunu geri çıkar
+        float a_min = a->world_aabb.min.v[axis] - fminf(sa, 0.0f), a_max = a->world_aabb.max.v[axis] - fmaxf(sa, 0.0f);
+        float b_min = b->world_aabb.min.v[axis] - fminf(sb, 0.0f), b_max = b->world_aabb.max.v[axis] - fmaxf(sb, 0.0f);
+        float rel = sb - sa; // B'nin A'ya göre yer değiştirmesi: A'nın kutusu -rel kadar süpürülür
+        if (a_min + fminf(-rel, 0.0f) > b_max + d || b_min > a_max + fmaxf(-rel, 0.0f) + d) return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Cisim bu adımda simüle ediliyor mu? (Uyanık ve dinamik)
+ */
+static inline bool fe_solver_is_simulated(const fe_rigid_body_t* rb) {
+    return rb->is_awake && !fe_solver_is_static(rb);
+}
+
+/**
+ * @brief Uyanık kinematik cisimler de hareket ediyorsa temaslarını etkinleştirir (uyuyanları uyandırabilsin diye).
+ */
+static inline bool fe_solver_drives_contacts(const fe_rigid_body_t* rb) {
+    if (fe_solver_is_simulated(rb)) return true;
+    return rb->is_awake && rb->is_kinematic &&
+           (fe_vec3_length_sq(rb->linear_velocity) > 0.0f || fe_vec3_length_sq(rb->angular_velocity) > 0.0f);
+}
+
+
+// ----------------------------------------------------------------------
+// 2. MANİFOLD DEPOSU
+// ----------------------------------------------------------------------
+
+static fe_contact_constraint_t* fe_solver_add_constraint(fe_collision_solver_t* solver, uint64_t key) {
+    if (solver->constraint_count == solver->constraint_capacity) {
+        uint32_t new_capacity = solver->constraint_capacity * 2;
+        fe_contact_constraint_t* constraints = (fe_contact_constraint_t*)fe_mem_realloc(solver->constraints, new_capacity * sizeof(fe_contact_constraint_t));
+        if (!constraints) {
+            FE_LOG_ERROR("Carpisma cozucusu: manifold listesi buyutulemedi.");
+            return NULL;
+        }
+        solver->constraints = constraints;
+        solver->constraint_capacity = new_capacity;
+    }
+
+    uint32_t index = solver->constraint_count++;
+    fe_contact_constraint_t* c = &solver->constraints[index];
+    // Kaydın geri kalanı (~1 KB) dar faz ve hazırlık tarafından yazılır; sıfırlamak yeni çift başına maliyete hâkimdi
+    c->point_count = 0;
+    c->last_frame = 0;
+    c->key = key;
+    fe_hashmap_insert(solver->constraint_map, &key, &index);
+    return c;
+}
+
+static bool fe_solver_grow_active(fe_collision_solver_t* solver) {
+    uint32_t new_capacity = solver->active_capacity * 2;
+    uint32_t* active = (uint32_t*)fe_mem_realloc(solver->active_constraints, new_capacity * sizeof(uint32_t));
+    if (!active) {
+        FE_LOG_ERROR("Carpisma cozucusu: etkin manifold listesi buyutulemedi.");
+        return false;
+    }
+    solver->active_constraints = active;
+    solver->active_capacity = new_capacity;
+    return true;
+}
+
+/**
+ * @brief index'teki manifoldu son manifoldla yer değiştirerek siler (O(1)).
+ */
+static void fe_solver_remove_constraint_at(fe_collision_solver_t* solver, uint32_t index) {
+    fe_hashmap_remove(solver->constraint_map, &solver->constraints[index].key);
+
+    uint32_t last = --solver->constraint_count;
+    if (index != last) {
+        solver->constraints[index] = solver->constraints[last];
+        uint32_t* slot = (uint32_t*)fe_hashmap_get(solver->constraint_map, &solver->constraints[index].key);
+        if (slot) *slot = index;
+    }
+}
+
+
+// ----------------------------------------------------------------------
+// 3. DAR FAZ VE NOKTA EŞLEŞTİRME
+// ----------------------------------------------------------------------
+
+/**
+ * @brief [begin, end) aralığındaki manifoldlar için temas noktalarını üretir (iş sistemi parçası).
+ * * Her iş sadece kendi manifoldlarına yazar; cisimler sadece okunur.
+ */
+static void fe_solver_narrowphase_range(void* data, uint32_t begin, uint32_t end) {
+    fe_collision_solver_t* solver = (fe_collision_solver_t*)data;
+
+    for (uint32_t i = begin; i < end; ++i) {
+        fe_contact_constraint_t* c = &solver->constraints[solver->active_constraints[i]];
+        const fe_rigid_body_t* a = c->body_a;
+        const fe_rigid_body_t* b = c->body_b;
+
+        fe_narrowphase_manifold_t manifold;
+        manifold.point_count = 0;
+        if ((!fe_solver_is_static(a) || !fe_solver_is_static(b)) && fe_solver_aabbs_near(a->collider, b->collider)) {
+            // Süpürülen cisimlerde boşluk adım içinde kapanabilecekse de temas üretilir (sürekli çarpışma)
+            fe_vec3_t relative_sweep = fe_vec3_subtract(b->collider->sweep, a->collider->sweep);
+            float sweep_sq = fe_vec3_length_sq(relative_sweep);
+            if (sweep_sq > 0.0f) {
+                fe_narrowphase_collide_speculative(a->collider, a->position, a->orientation,
+                                                   b->collider, b->position, b->orientation,
+                                                   FE_NARROWPHASE_SPECULATIVE_DISTANCE + sqrtf(sweep_sq), &manifold);
+                fe_solver_cull_unreachable(&manifold, relative_sweep);
+            } else {
+                fe_narrowphase_collide(a->collider, a->position, a->orientation,
+                                       b->collider, b->position, b->orientation, &manifold);
+            }
+        }
+
+        fe_contact_point_t old_points[FE_NARROWPHASE_MAX_POINTS];
+        uint32_t old_count = c->point_count;
+        bool old_used[FE_NARROWPHASE_MAX_POINTS] = { false };
+        memcpy(old_points, c->points, old_count * sizeof(fe_contact_point_t));
+
+        c->point_count = manifold.point_count;
+        if (manifold.point_count == 0) continue;
+
+        c->normal = manifold.normal;
+        const fe_physical_material_t* mat_a = a->material ? a->material : &FE_MAT_DEFAULT;
+        const fe_physical_material_t* mat_b = b->material ? b->material : &FE_MAT_DEFAULT;
+        c->friction = fe_material_combine_static_friction(mat_a, mat_b);
+        c->restitution = fe_material_combine_restitution(mat_a, mat_b);
+
+        fe_vec3_t rows_a[3];
+        fe_physics_quat_to_rows(a->orientation, rows_a);
+
+        for (uint32_t k = 0; k < manifold.point_count; ++k) {
+            fe_contact_point_t* p = &c->points[k];
+            fe_vec3_t position = manifold.points[k].position;
+            p->r_a = fe_vec3_subtract(position, a->position);
+            p->r_b = fe_vec3_subtract(position, b->position);
+            p->penetration = manifold.points[k].penetration;
+            // Yerel nokta: R^T * r_a
+            p->local_a = (fe_vec3_t){{
+                rows_a[0].x * p->r_a.x + rows_a[1].x * p->r_a.y + rows_a[2].x * p->r_a.z,
+                rows_a[0].y * p->r_a.x + rows_a[1].y * p->r_a.y + rows_a[2].y * p->r_a.z,
+                rows_a[0].z * p->r_a.x + rows_a[1].z * p->r_a.y + rows_a[2].z * p->r_a.z
+            }};
+
+            // Önceki adımdaki en yakın eşleşmeyen noktanın impulslarını devral
+            p->normal_impulse = 0.0f;
+            p->tangent_impulse[0] = 0.0f;
+            p->tangent_impulse[1] = 0.0f;
+            float best = FE_SOLVER_MATCH_DISTANCE * FE_SOLVER_MATCH_DISTANCE;
+            int match = -1;
+            for (uint32_t j = 0; j < old_count; ++j) {
+                if (old_used[j]) continue;
+                float dist_sq = fe_vec3_length_sq(fe_vec3_subtract(p->local_a, old_points[j].local_a));
+                if (dist_sq < best) {
+                    best = dist_sq;
+                    match = (int)j;
+                }
+            }
+            if (match >= 0) {
+                old_used[match] = true;
+                p->normal_impulse = old_points[match].normal_impulse;
+                p->tangent_impulse[0] = old_points[match].tangent_impulse[0];
+                p->tangent_impulse[1] = old_points[match].tangent_impulse[1];
+            }
+        }
+    }
+}
+
+
+// ----------------------------------------------------------------------
+// 4. YÖNETİM UYGULAMALARI
+// ----------------------------------------------------------------------
+
+/**
+ * Uygulama: fe_collision_solver_init
+ */
+fe_error_code_t fe_collision_solver_init(fe_collision_solver_t* solver) {
+    if (!solver) return FE_ERR_INVALID_ARGUMENT;
+    memset(solver, 0, sizeof(*solver));
+
+    solver->constraint_capacity = FE_SOLVER_INITIAL_CONSTRAINTS;
+    solver->constraints = (fe_contact_constraint_t*)fe_mem_calloc(solver->constraint_capacity, sizeof(fe_contact_constraint_t));
+    solver->constraint_map = fe_hashmap_create(sizeof(uint64_t), sizeof(uint32_t));
+    solver->ignored_pairs = fe_hashmap_create(sizeof(fe_solver_body_pair_key_t), sizeof(uint32_t));
+    solver->active_capacity = FE_SOLVER_INITIAL_CONSTRAINTS;
+    solver->active_constraints = (uint32_t*)fe_mem_calloc(solver->active_capacity, sizeof(uint32_t));
+    if (!solver->constraints || !solver->constraint_map || !solver->ignored_pairs || !solver->active_constraints) {
+        FE_LOG_ERROR("Carpisma cozucusu icin bellek ayrilamadi.");
+        fe_collision_solver_destroy(solver);
+        return FE_ERR_MEMORY_ALLOCATION;
+    }
+
+    solver->velocity_iterations = FE_SOLVER_VELOCITY_ITERATIONS;
+    solver->relax_iterations = FE_SOLVER_RELAX_ITERATIONS;
+    solver->substep_count = FE_SOLVER_SUBSTEPS;
+    solver->warm_starting = true;
+    return FE_OK;
+}
+
+/**
+ * Uygulama: fe_collision_solver_destroy
+ */
+void fe_collision_solver_destroy(fe_collision_solver_t* solver) {
+    if (!solver) return;
+    fe_mem_free(solver->constraints);
+    fe_mem_free(solver->active_constraints);
+    fe_mem_free(solver->velocities);
+    fe_mem_free(solver->displacements);
+    fe_mem_free(solver->inverse_masses);
+    if (solver->constraint_map) fe_hashmap_destroy(solver->constraint_map);
+    if (solver->ignored_pairs) fe_hashmap_destroy(solver->ignored_pairs);
+    memset(solver, 0, sizeof(*solver));
+}
+
+/**
+ * Uygulama: fe_collision_solver_reserve
+ */
+bool fe_collision_solver_reserve(fe_collision_solver_t* solver, uint32_t extra_count) {
+    if (!solver || !solver->constraints) return false;
+
+    uint32_t required = solver->constraint_count + extra_count;
+    if (required > solver->constraint_capacity) {
+        fe_contact_constraint_t* constraints = (fe_contact_constraint_t*)fe_mem_realloc(solver->constraints, (size_t)required * sizeof(fe_contact_constraint_t));
+        if (!constraints) {
+            FE_LOG_ERROR("Carpisma cozucusu: %u manifoldluk yer ayrilamadi.", required);
+            return false;
+        }
+        // Sayfalar şimdi dokunulur; ilk kullanımda sayfa hatası olmaz
+        memset(constraints + solver->constraint_capacity, 0, (size_t)(required - solver->constraint_capacity) * sizeof(fe_contact_constraint_t));
+        solver->constraints = constraints;
+        solver->constraint_capacity = required;
+    }
+    if (required > solver->active_capacity) {
+        uint32_t* active = (uint32_t*)fe_mem_realloc(solver->active_constraints, (size_t)required * sizeof(uint32_t));
+        if (!active) {
+            FE_LOG_ERROR("Carpisma cozucusu: etkin manifold listesi buyutulemedi.");
+            return false;
+        }
+        memset(active + solver->active_capacity, 0, (size_t)(required - solver->active_capacity) * sizeof(uint32_t));
+        solver->active_constraints = active;
+        solver->active_capacity = required;
+    }
+    return fe_hashmap_reserve(solver->constraint_map, required);
+}
+
+/**
+ * Uygulama: fe_collision_solver_update_contacts
+ */
+void fe_collision_solver_update_contacts(fe_collision_solver_t* solver, const fe_broadphase_t* broadphase,
+                                         fe_rigid_body_t* const* bodies, uint32_t body_count) {
+    solver->frame++;
+    solver->active_count = 0;
+
+    // 1. Broadphase'ten düşen çiftlerin manifoldlarını sil (etkin liste henüz boş: indeks kayması zararsız)
+    uint32_t removed_count = 0;
+    const uint64_t* removed = fe_broadphase_get_removed_pairs(broadphase, &removed_count);
+    for (uint32_t i = 0; i < removed_count; ++i) {
+        uint32_t* slot = (uint32_t*)fe_hashmap_get(solver->constraint_map, &removed[i]);
+        if (slot) fe_solver_remove_constraint_at(solver, *slot);
+    }
+
+    // 2. Uyanık cisimlerin çiftlerini manifoldlarla eşle (yeni çiftler için manifold açılır)
+    for (uint32_t i = 0; i < body_count; ++i) {
+        const fe_rigid_body_t* owner = bodies[i];
+        if (!owner->collider || owner->collider->proxy_id == FE_BROADPHASE_NULL_PROXY) continue;
+        uint32_t proxy = owner->collider->proxy_id;
+
+        for (uint32_t k = fe_broadphase_first_pair(broadphase, proxy); k != FE_BROADPHASE_NULL_PROXY;
+             k = fe_broadphase_next_pair(broadphase, k, proxy)) {
+            const fe_broadphase_pair_t* pair = &broadphase->pairs[k];
+            fe_rigid_body_t* a = (fe_rigid_body_t*)pair->user_data_a;
+            fe_rigid_body_t* b = (fe_rigid_body_t*)pair->user_data_b;
+            if (!a || !b || !a->collider || !b->collider) continue;
+
+            // İki ucu da uyanık çift, listede önce gelen uçtan bir kez eşlenir
+            const fe_rigid_body_t* other = (a == owner) ? b : a;
+            if (other->awake_index < i) continue;
+            if (!a->is_awake && !b->is_awake) continue; // Uyuyan çift: manifold olduğu gibi korunur
+            if (fe_solver_is_ignored(solver, a, b)) continue; // Manifoldu fe_collision_solver_ignore_pair siler
+
+            uint64_t key = ((uint64_t)pair->proxy_a << 32) | (uint64_t)pair->proxy_b;
+            uint32_t* slot = (uint32_t*)fe_hashmap_get(solver->constraint_map, &key);
+            if (fe_vec3_length_sq(a->collider->sweep) > 0.0f && fe_vec3_length_sq(b->collider->sweep) > 0.0f &&
+                !fe_solver_sweeps_reach(a->collider, b->collider)) {
+                // Birlikte uçan süpürülen cisimler: bu adım temas olamaz. Manifold çift düşene kadar
+                // noktasız bekler; eski impulsları sonraki temasa taşınmaz.
+                if (slot) solver->constraints[*slot].point_count = 0;
+                continue;
+            }
+
+            fe_contact_constraint_t* c = slot ? &solver->constraints[*slot] : fe_solver_add_constraint(solver, key);
+            if (!c) continue;
+            c->body_a = a;
+            c->body_b = b;
+            c->last_frame = solver->frame;
+
+            if (!fe_solver_drives_contacts(a) && !fe_solver_drives_contacts(b)) continue;
+            if (solver->active_count == solver->active_capacity && !fe_solver_grow_active(solver)) continue;
+            solver->active_constraints[solver->active_count++] = (uint32_t)(c - solver->constraints);
+        }
+    }
+
+    // 3. Dar faz (manifoldlar birbirinden bağımsızdır)
+    fe_job_parallel_for(solver->active_count, FE_SOLVER_NARROWPHASE_GRAIN, fe_solver_narrowphase_range, solver);
+}
+
+/**
+ * Uygulama: fe_collision_solver_ignore_pair
+ */
+bool fe_collision_solver_ignore_pair(fe_collision_solver_t* solver, const fe_rigid_body_t* a, const fe_rigid_body_t* b) {
+    if (!solver || !solver->ignored_pairs || !a || !b || a == b) return false;
+
+    fe_solver_body_pair_key_t key = fe_solver_body_pair_key(a, b);
+    uint32_t* refs = (uint32_t*)fe_hashmap_get(solver->ignored_pairs, &key);
+    if (refs) {
+        (*refs)++;
+        return true;
+    }
+
+    uint32_t one = 1;
+    if (!fe_hashmap_insert(solver->ignored_pairs, &key, &one)) {
+        FE_LOG_ERROR("Carpisma cozucusu: yok sayilan cift eklenemedi.");
+        return false;
+    }
+    solver->ignored_pair_count++;
+
+    // Çiftin mevcut manifoldu silinir (eşleme yok sayılan çiftlere hiç bakmaz)
+    if (a->collider && b->collider && a->collider->proxy_id != FE_BROADPHASE_NULL_PROXY &&
+        b->collider->proxy_id != FE_BROADPHASE_NULL_PROXY) {
+        uint64_t proxy_a = a->collider->proxy_id, proxy_b = b->collider->proxy_id;
+        uint64_t manifold_key = (proxy_a < proxy_b) ? (proxy_a << 32) | proxy_b : (proxy_b << 32) | proxy_a;
+        uint32_t* slot = (uint32_t*)fe_hashmap_get(solver->constraint_map, &manifold_key);
+        if (slot) {
+            fe_solver_remove_constraint_at(solver, *slot);
+            solver->active_count = 0; // İndeksler kaydı; bir sonraki güncellemede yeniden kurulur
+        }
+    }
+    return true;
+}
+
+/**
+ * Uygulama: fe_collision_solver_restore_pair
+ */
+void fe_collision_solver_restore_pair(fe_collision_solver_t* solver, const fe_rigid_body_t* a, const fe_rigid_body_t* b) {
+    if (!solver || !solver->ignored_pairs || !a || !b) return;
+
+    fe_solver_body_pair_key_t key = fe_solver_body_pair_key(a, b);
+    uint32_t* refs = (uint32_t*)fe_hashmap_get(solver->ignored_pairs, &key);
+    if (!refs) return;
+    if (--(*refs) == 0) {
+        fe_hashmap_remove(solver->ignored_pairs, &key);
+        solver->ignored_pair_count--;
+    }
+}
+
+/**
+ * Uygulama: fe_collision_solver_remove_body
+ */
+void fe_collision_solver_remove_body(fe_collision_solver_t* solver, const fe_rigid_body_t* rb) {
+    for (uint32_t i = 0; i < solver->constraint_count;) {
+        if (solver->constraints[i].body_a == rb || solver->constraints[i].body_b == rb) {
+            fe_solver_remove_constraint_at(solver, i);
+        } else {
+            ++i;
+        }
+    }
+    // İndeksler kaydı; etkin liste bir sonraki fe_collision_solver_update_contacts'ta yeniden kurulur.
+    solver->active_count = 0;
+}
+
+
+// ----------------------------------------------------------------------
+// 5. ÇÖZÜCÜ
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Ucun adım başından beri yer değiştirmesi (konum ve küçük açılı dönme).
+ * * Sadece simüle edilen uçlar alt adımlarda ilerletilir; statik ve kinematik uçlar adım boyunca
+ * * yerinde sayılır (kinematik cisim kendi tekil adasındadır, başka adanın işi onu okumaz).
+ */
+static inline fe_solver_velocity_t fe_solver_load_displacement(const fe_collision_solver_t* solver, uint32_t index, float inv_mass) {
+    if (inv_mass > 0.0f && index < solver->velocity_count) return solver->displacements[index];
+    return (fe_solver_velocity_t){ {{0.0f, 0.0f, 0.0f}}, {{0.0f, 0.0f, 0.0f}} };
+}
+
+/**
+ * @brief Kütle verisini, Jacobian satırlarını ve sekme için başlangıç yaklaşma hızlarını hesaplar.
+ */
+static void fe_solver_prepare(fe_collision_solver_t* solver, fe_contact_constraint_t* c) {
+    fe_rigid_body_t* a = c->body_a;
+    fe_rigid_body_t* b = c->body_b;
+    c->index_a = a->awake_index;
+    c->index_b = b->awake_index;
+    fe_solver_velocity_t vel_a = fe_solver_load_velocity(solver, a, c->index_a);
+    fe_solver_velocity_t vel_b = fe_solver_load_velocity(solver, b, c->index_b);
+
+    // Uyuyan cisimler bu adımda statik gibi davranır (yönetici temas edenleri çözümden önce uyandırır)
+    c->inv_mass_a = fe_solver_is_simulated(a) ? a->inverse_mass : 0.0f;
+    c->inv_mass_b = fe_solver_is_simulated(b) ? b->inverse_mass : 0.0f;
+    fe_rigid_body_get_world_inverse_inertia(a, c->inv_inertia_a);
+    fe_rigid_body_get_world_inverse_inertia(b, c->inv_inertia_b);
+    if (c->inv_mass_a == 0.0f) memset(c->inv_inertia_a, 0, sizeof(c->inv_inertia_a));
+    if (c->inv_mass_b == 0.0f) memset(c->inv_inertia_b, 0, sizeof(c->inv_inertia_b));
+    fe_solver_tangent_basis(c->normal, &c->tangent[0], &c->tangent[1]);
+
+    fe_vec3_t dv = fe_solver_linear_delta(&vel_a, &vel_b);
+    for (uint32_t k = 0; k < c->point_count; ++k) {
+        fe_contact_point_t* p = &c->points[k];
+        p->normal_mass = fe_solver_prepare_axis(c, p, 0, c->normal);
+        p->tangent_mass[0] = fe_solver_prepare_axis(c, p, 1, c->tangent[0]);
+        p->tangent_mass[1] = fe_solver_prepare_axis(c, p, 2, c->tangent[1]);
+        p->relative_velocity = fe_solver_relative_speed(&vel_a, &vel_b, p, 0, c->normal, dv);
+        p->max_normal_impulse = 0.0f;
+
+        if (!solver->warm_starting) {
+            p->normal_impulse = 0.0f;
+            p->tangent_impulse[0] = 0.0f;
+            p->tangent_impulse[1] = 0.0f;
+        }
+    }
+}
+
+static void fe_solver_warm_start(fe_collision_solver_t* solver, fe_contact_constraint_t* c) {
+    fe_solver_velocity_t a = fe_solver_load_velocity(solver, c->body_a, c->index_a);
+    fe_solver_velocity_t b = fe_solver_load_velocity(solver, c->body_b, c->index_b);
+
+    for (uint32_t k = 0; k < c->point_count; ++k) {
+        const fe_contact_point_t* p = &c->points[k];
+        fe_solver_apply_axis(c, &a, &b, p, 0, c->normal, p->normal_impulse);
+        fe_solver_apply_axis(c, &a, &b, p, 1, c->tangent[0], p->tangent_impulse[0]);
+        fe_solver_apply_axis(c, &a, &b, p, 2, c->tangent[1], p->tangent_impulse[1]);
+    }
+
+    fe_solver_save_velocity(solver, c->index_a, c->inv_mass_a, &a);
+    fe_solver_save_velocity(solver, c->index_b, c->inv_mass_b, &b);
+}
+
+/**
+ * @param relax true: gevşetme (iç içe geçme itilmez, temas katıdır), false: yumuşak itmeli çözüm.
+ */
+static void fe_solver_solve_constraint(fe_collision_solver_t* solver, fe_contact_constraint_t* c, bool relax) {
+    // Hızlar manifold boyunca yerel kopyalarda güncellenir, sonunda bir kez geri yazılır
+    fe_solver_velocity_t a = fe_solver_load_velocity(solver, c->body_a, c->index_a);
+    fe_solver_velocity_t b = fe_solver_load_velocity(solver, c->body_b, c->index_b);
+
+    // Güncel ayrılma, dar fazdaki değere adım başından beri yer değiştirmenin normal bileşeni eklenerek bulunur
+    fe_solver_velocity_t da = fe_solver_load_displacement(solver, c->index_a, c->inv_mass_a);
+    fe_solver_velocity_t db = fe_solver_load_displacement(solver, c->index_b, c->inv_mass_b);
+    fe_vec3_t dp = fe_solver_linear_delta(&da, &db);
+
+    // 1. Sürtünme (normal impulsun güncel değeriyle sınırlandırılır)
+    for (uint32_t k = 0; k < c->point_count; ++k) {
+        fe_contact_point_t* p = &c->points[k];
+        fe_vec3_t dv = fe_solver_linear_delta(&a, &b);
+
+        float old_t0 = p->tangent_impulse[0];
+        float old_t1 = p->tangent_impulse[1];
+        float t0 = old_t0 - p->tangent_mass[0] * fe_solver_relative_speed(&a, &b, p, 1, c->tangent[0], dv);
+        float t1 = old_t1 - p->tangent_mass[1] * fe_solver_relative_speed(&a, &b, p, 2, c->tangent[1], dv);
+
+        // Coulomb konisi: |t| <= mu * normal_impulse
+        float max_friction = c->friction * p->normal_impulse;
+        float len_sq = t0 * t0 + t1 * t1;
+        if (len_sq > max_friction * max_friction) {
+            float scale = (len_sq > 0.0f) ? max_friction / sqrtf(len_sq) : 0.0f;
+            t0 *= scale;
+            t1 *= scale;
+        }
+        p->tangent_impulse[0] = t0;
+        p->tangent_impulse[1] = t1;
+
+        fe_solver_apply_axis(c, &a, &b, p, 1, c->tangent[0], t0 - old_t0);
+        fe_solver_apply_axis(c, &a, &b, p, 2, c->tangent[1], t1 - old_t1);
+    }
+
+    // 2. Normal (cisimler birbirini sadece itebilir: biriken impuls >= 0)
+    for (uint32_t k = 0; k < c->point_count; ++k) {
+        fe_contact_point_t* p = &c->points[k];
+        float separation = fe_solver_relative_speed(&da, &db, p, 0, c->normal, dp) - p->penetration;
+
+        float target = 0.0f, mass_scale = 1.0f, impulse_scale = 0.0f;
+        if (separation > 0.0f) {
+            target = -separation * solver->inv_substep; // Öngörülü: boşluk bu alt adımda kapanabilir
+        } else if (!relax && separation < -FE_SOLVER_LINEAR_SLOP) {
+            target = fminf(-(separation + FE_SOLVER_LINEAR_SLOP) * solver->bias_rate, FE_SOLVER_MAX_PUSH_VELOCITY);
+            mass_scale = solver->mass_scale;
+            impulse_scale = solver->impulse_scale;
+        }
+
+        float vn = fe_solver_relative_speed(&a, &b, p, 0, c->normal, fe_solver_linear_delta(&a, &b));
+        float lambda = p->normal_mass * mass_scale * (target - vn) - impulse_scale * p->normal_impulse;
+        float new_impulse = p->normal_impulse + lambda;
+        if (new_impulse < 0.0f) new_impulse = 0.0f;
+        lambda = new_impulse - p->normal_impulse;
+        p->normal_impulse = new_impulse;
+        if (new_impulse > p->max_normal_impulse) p->max_normal_impulse = new_impulse;
+
+        fe_solver_apply_axis(c, &a, &b, p, 0, c->normal, lambda);
+    }
+
+    fe_solver_save_velocity(solver, c->index_a, c->inv_mass_a, &a);
+    fe_solver_save_velocity(solver, c->index_b, c->inv_mass_b, &b);
+}
+
+/**
+ * @brief Adımın başında hızla çarpışan noktalara sekme hedefini uygular (alt adımlardan sonra bir kez).
+ * * Sadece adım boyunca gerçekten itilen noktalar seker; uzak öngörülü temaslar (sürekli çarpışma)
+ * * cismi yüzeyde durdurur, sekme temas halindeki sonraki adımda hesaplanır.
+ */
+static void fe_solver_apply_restitution(fe_collision_solver_t* solver, fe_contact_constraint_t* c) {
+    if (c->restitution <= 0.0f) return;
+    fe_solver_velocity_t a = fe_solver_load_velocity(solver, c->body_a, c->index_a);
+    fe_solver_velocity_t b = fe_solver_load_velocity(solver, c->body_b, c->index_b);
+
+    for (uint32_t k = 0; k < c->point_count; ++k) {
+        fe_contact_point_t* p = &c->points[k];
+        if (p->relative_velocity > -FE_SOLVER_RESTITUTION_THRESHOLD || p->max_normal_impulse <= 0.0f) continue;
+
+        float vn = fe_solver_relative_speed(&a, &b, p, 0, c->normal, fe_solver_linear_delta(&a, &b));
+        float lambda = p->normal_mass * (-c->restitution * p->relative_velocity - vn);
+        float new_impulse = p->normal_impulse + lambda;
+        if (new_impulse < 0.0f) new_impulse = 0.0f;
+        lambda = new_impulse - p->normal_impulse;
+        p->normal_impulse = new_impulse;
+
+        fe_solver_apply_axis(c, &a, &b, p, 0, c->normal, lambda);
+    }
+
+    fe_solver_save_velocity(solver, c->index_a, c->inv_mass_a, &a);
+    fe_solver_save_velocity(solver, c->index_b, c->inv_mass_b, &b);
+}
+
+/**
+ * @brief Listedeki simüle edilen cisimlere uygular: v += dv (yerçekiminin alt adımlara dağıtılması).
+ * @param bodies Yoğun indeksler; NULL ise 0..body_count-1.
+ */
+static void fe_solver_add_gravity(fe_collision_solver_t* solver, const uint32_t* bodies, uint32_t body_count, fe_vec3_t dv) {
+    for (uint32_t i = 0; i < body_count; ++i) {
+        uint32_t index = bodies ? bodies[i] : i;
+        if (solver->inverse_masses[index] <= 0.0f) continue;
+        solver->velocities[index].linear = fe_solver_madd(solver->velocities[index].linear, dv, 1.0f);
+    }
+}
+
+/**
+ * Uygulama: fe_collision_solver_resolve_constraints
+ */
+void fe_collision_solver_resolve_constraints(fe_collision_solver_t* solver, const uint32_t* indices, uint32_t count,
+                                             const uint32_t* bodies, uint32_t body_count, fe_vec3_t gravity) {
+    if (solver->substep_dt <= 0.0f) return;
+
+    // Temassız cisim (veya ada) tek adımda ilerler: yer değiştirme son hızla dt'dir.
+    if (count == 0) {
+        for (uint32_t i = 0; i < body_count; ++i) {
+            uint32_t index = bodies ? bodies[i] : i;
+            solver->displacements[index].linear = fe_solver_scale(solver->velocities[index].linear, solver->dt);
+            solver->displacements[index].angular = fe_solver_scale(solver->velocities[index].angular, solver->dt);
+        }
+        return;
+    }
+
+    fe_collision_solver_prepare_constraints(solver, indices, count, bodies, body_count, gravity);
+    for (uint32_t substep = 0; substep < solver->substep_count; ++substep) {
+        fe_collision_solver_begin_substep(solver, indices, count, bodies, body_count, gravity, substep);
+        for (uint32_t iter = 0; iter < solver->velocity_iterations; ++iter) {
+            fe_collision_solver_solve_iteration(solver, indices, count);
+        }
+        fe_collision_solver_end_substep(solver, indices, count, bodies, body_count);
+    }
+    fe_collision_solver_finish_constraints(solver, indices, count);
+}
+
+/**
+ * Uygulama: fe_collision_solver_prepare_constraints
+ */
+void fe_collision_solver_prepare_constraints(fe_collision_solver_t* solver, const uint32_t* indices, uint32_t count,
+                                             const uint32_t* bodies, uint32_t body_count, fe_vec3_t gravity) {
+    for (uint32_t i = 0; i < count; ++i) {
+        fe_contact_constraint_t* c = &solver->constraints[indices[i]];
+        if (c->point_count == 0) continue;
+        fe_solver_prepare(solver, c);
+    }
+
+    // Yüklenen hızlar tüm adımın yerçekimini içerir; ilk alt adıma bir alt adımlık pay kalır, gerisi
+    // fe_collision_solver_begin_substep'te eklenir. Yığının ağırlığı her alt adımda küçük parçalar
+    // halinde gelir ve sıcak başlatılan impulslar onu tek yinelemede taşır.
+    float remaining = solver->dt - solver->substep_dt;
+    fe_solver_add_gravity(solver, bodies, body_count, fe_solver_scale(gravity, -remaining));
+    for (uint32_t i = 0; i < body_count; ++i) {
+        uint32_t index = bodies ? bodies[i] : i;
+        solver->displacements[index] = (fe_solver_velocity_t){ {{0.0f, 0.0f, 0.0f}}, {{0.0f, 0.0f, 0.0f}} };
+    }
+}
+
+/**
+ * Uygulama: fe_collision_solver_begin_substep
+ */
+void fe_collision_solver_begin_substep(fe_collision_solver_t* solver, const uint32_t* indices, uint32_t count,
+                                       const uint32_t* bodies, uint32_t body_count, fe_vec3_t gravity, uint32_t substep) {
+    if (substep > 0) {
+        fe_solver_add_gravity(solver, bodies, body_count, fe_solver_scale(gravity, solver->substep_dt));
+    }
+
+    // Biriken impulslar alt adım başınadır: her alt adım bir öncekinin impulsuyla başlar.
+    for (uint32_t i = 0; i < count; ++i) {
+        fe_contact_constraint_t* c = &solver->constraints[indices[i]];
+        if (c->point_count == 0) continue;
+        if (solver->warm_starting) {
+            fe_solver_warm_start(solver, c);
+        } else {
+            for (uint32_t k = 0; k < c->point_count; ++k) {
+                c->points[k].normal_impulse = 0.0f;
+                c->points[k].tangent_impulse[0] = 0.0f;
+                c->points[k].tangent_impulse[1] = 0.0f;
+            }
+        }
+    }
+}
+
+/**
+ * Uygulama: fe_collision_solver_solve_iteration
+ */
+void fe_collision_solver_solve_iteration(fe_collision_solver_t* solver, const uint32_t* indices, uint32_t count) {
+    for (uint32_t i = 0; i < count; ++i) {
+        fe_contact_constraint_t* c = &solver->constraints[indices[i]];
+        if (c->point_count == 0) continue;
+        fe_solver_solve_constraint(solver, c, false);
+    }
+}
+
+/**
+ * Uygulama: fe_collision_solver_end_substep
+ */
+void fe_collision_solver_end_substep(fe_collision_solver_t* solver, const uint32_t* indices, uint32_t count,
+                                     const uint32_t* bodies, uint32_t body_count) {
+    // Alt adımın konumu: itme hızıyla ilerlenir (iç içe geçme böylece düzelir)
+    const float h = solver->substep_dt;
+    for (uint32_t i = 0; i < body_count; ++i) {
+        uint32_t index = bodies ? bodies[i] : i;
+        fe_solver_velocity_t* d = &solver->displacements[index];
+        d->linear = fe_solver_madd(d->linear, solver->velocities[index].linear, h);
+        d->angular = fe_solver_madd(d->angular, solver->velocities[index].angular, h);
+    }
+
+    // Gevşetme: itme hızı sonraki alt adıma taşınmaz (yığınlar enerji kazanıp titremez)
+    for (uint32_t iter = 0; iter < solver->relax_iterations; ++iter) {
+        for (uint32_t i = 0; i < count; ++i) {
+            fe_contact_constraint_t* c = &solver->constraints[indices[i]];
+            if (c->point_count == 0) continue;
+            fe_solver_solve_constraint(solver, c, true);
+        }
+    }
+}
+
+/**
+ * Uygulama: fe_collision_solver_finish_constraints
+ */
+void fe_collision_solver_finish_constraints(fe_collision_solver_t* solver, const uint32_t* indices, uint32_t count) {
+    for (uint32_t i = 0; i < count; ++i) {
+        fe_contact_constraint_t* c = &solver->constraints[indices[i]];
+        if (c->point_count == 0) continue;
+        fe_solver_apply_restitution(solver, c);
+    }
+}
+
+/**
+ * Uygulama: fe_collision_solver_resolve_contacts
+ */
+void fe_collision_solver_resolve_contacts(fe_collision_solver_t* solver, fe_rigid_body_t* const* bodies, uint32_t body_count,
+                                         fe_vec3_t gravity, float dt) {
+    if (!fe_collision_solver_load_velocities(solver, bodies, body_count, dt)) return;
+    fe_collision_solver_resolve_constraints(solver, solver->active_constraints, solver->active_count, NULL, body_count, gravity);
+    fe_collision_solver_store_displacements(solver, bodies, body_count);
+    for (uint32_t i = 0; i < body_count; ++i) {
+        if (solver->inverse_masses[i] > 0.0f) fe_rigid_body_integrate_position(bodies[i], dt);
+    }
+    fe_collision_solver_store_velocities(solver, bodies, body_count);
+}
+
+/**
+ * Uygulama: fe_collision_solver_load_velocities
+ */
+bool fe_collision_solver_load_velocities(fe_collision_solver_t* solver, fe_rigid_body_t* const* bodies, uint32_t body_count, float dt) {
+    solver->velocity_count = 0;
+    solver->substep_dt = 0.0f;
+    if (dt <= 0.0f || solver->substep_count == 0) return false;
+
+    if (body_count > solver->velocity_capacity) {
+        uint32_t new_capacity = solver->velocity_capacity ? solver->velocity_capacity : FE_SOLVER_INITIAL_CONSTRAINTS;
+        while (new_capacity < body_count) new_capacity *= 2;
+        fe_solver_velocity_t* velocities = (fe_solver_velocity_t*)fe_mem_realloc(solver->velocities, new_capacity * sizeof(fe_solver_velocity_t));
+        if (velocities) solver->velocities = velocities;
+        fe_solver_velocity_t* displacements = (fe_solver_velocity_t*)fe_mem_realloc(solver->displacements, new_capacity * sizeof(fe_solver_velocity_t));
+        if (displacements) solver->displacements = displacements;
+        float* inverse_masses = (float*)fe_mem_realloc(solver->inverse_masses, new_capacity * sizeof(float));
+        if (inverse_masses) solver->inverse_masses = inverse_masses;
+        if (!velocities || !displacements || !inverse_masses) {
+            FE_LOG_ERROR("Carpisma cozucusu: hiz dizisi buyutulemedi.");
+            return false;
+        }
+        solver->velocity_capacity = new_capacity;
+    }
+
+    // Kinematik ve dışarıdan uyutulmuş cisimler çözümde hareket etmez (ters kütle 0)
+    for (uint32_t i = 0; i < body_count; ++i) {
+        const fe_rigid_body_t* rb = bodies[i];
+        solver->velocities[i].linear = rb->linear_velocity;
+        solver->velocities[i].angular = rb->angular_velocity;
+        solver->inverse_masses[i] = (rb->is_awake && !rb->is_kinematic) ? rb->inverse_mass : 0.0f;
+    }
+    solver->velocity_count = body_count;
+
+    // Yumuşak temas (kütle-yay-sönümleyici): itme, alt adım süresinden bağımsız bir frekansla yapılır.
+    // Katı Baumgarte'nin aksine aşırı itmez; yüksek sönüm oranı yığınlarda salınımı bastırır.
+    float h = dt / (float)solver->substep_count;
+    float hertz = fminf(FE_SOLVER_CONTACT_HERTZ, 0.25f / h);
+    float omega = 2.0f * 3.14159265f * hertz;
+    float a1 = 2.0f * FE_SOLVER_CONTACT_DAMPING_RATIO + h * omega;
+    float a2 = h * omega * a1;
+    float a3 = 1.0f / (1.0f + a2);
+    solver->dt = dt;
+    solver->substep_dt = h;
+    solver->inv_substep = 1.0f / h;
+    solver->bias_rate = omega / a1;
+    solver->mass_scale = a2 * a3;
+    solver->impulse_scale = a3;
+    return true;
+}
+
+/**
+ * Uygulama: fe_collision_solver_store_displacements
+ */
+void fe_collision_solver_store_displacements(const fe_collision_solver_t* solver, fe_rigid_body_t* const* bodies, uint32_t body_count) {
+    uint32_t count = (solver->velocity_count < body_count) ? solver->velocity_count : body_count;
+    if (solver->dt <= 0.0f) return;
+    float inv_dt = 1.0f / solver->dt;
+    for (uint32_t i = 0; i < count; ++i) {
+        if (solver->inverse_masses[i] <= 0.0f) continue;
+        const fe_solver_velocity_t* d = &solver->displacements[i];
+        bodies[i]->linear_velocity = fe_solver_scale(d->linear, inv_dt);
+        bodies[i]->angular_velocity = fe_solver_scale(d->angular, inv_dt);
+    }
+}
+
+/**
+ * Uygulama: fe_collision_solver_store_velocities
+ */
+void fe_collision_solver_store_velocities(const fe_collision_solver_t* solver, fe_rigid_body_t* const* bodies, uint32_t body_count) {
+    uint32_t count = (solver->velocity_count < body_count) ? solver->velocity_count : body_count;
+    for (uint32_t i = 0; i < count; ++i) {
+        if (solver->inverse_masses[i] <= 0.0f) continue;
+        bodies[i]->linear_velocity = solver->velocities[i].linear;
+        bodies[i]->angular_velocity = solver->velocities[i].angular;
+    }
+}
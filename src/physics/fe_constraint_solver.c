@@ -0,0 +1,516 @@
+// src/physics/fe_constraint_solver.c
+
+#include "physics/fe_constraint_solver.h"
+#include "platform/fe_job_system.h" // fe_job_parallel_for
+#include "utils/fe_logger.h"
+#include "memory/fe_memory_manager.h" // fe_mem_realloc, fe_mem_free
+#include <string.h> // memset, memcpy
+#include <math.h> // fabsf
+
+#define FE_CONSTRAINT_INITIAL_CAPACITY 64
+
+// Bir rengin çözümünde tek bir işin işlediği en fazla eklem sayısı
+#define FE_CONSTRAINT_JOB_GRAIN 64
+
+// ----------------------------------------------------------------------
+// 1. YARDIMCI FONKSİYONLAR
+// ----------------------------------------------------------------------
+
+static inline fe_vec3_t fe_joint_mul_rows(const fe_vec3_t rows[3], fe_vec3_t v) {
+    return (fe_vec3_t){{ fe_vec3_dot(rows[0], v), fe_vec3_dot(rows[1], v), fe_vec3_dot(rows[2], v) }};
+}
+
+/**
+ * @brief 3x3 matrisin tersini satır düzeninde hesaplar. Tekil matris için sıfır döner.
+ */
+static void fe_joint_invert(const fe_vec3_t m[3], fe_vec3_t out[3]) {
+    fe_vec3_t c0 = fe_vec3_cross(m[1], m[2]);
+    fe_vec3_t c1 = fe_vec3_cross(m[2], m[0]);
+    fe_vec3_t c2 = fe_vec3_cross(m[0], m[1]);
+    float det = fe_vec3_dot(m[0], c0);
+    if (fabsf(det) < 1e-12f) {
+        memset(out, 0, 3 * sizeof(fe_vec3_t));
+        return;
+    }
+
+    // Tersin sütunları c0, c1, c2'dir
+    float inv_det = 1.0f / det;
+    for (int i = 0; i < 3; ++i) {
+        out[i] = (fe_vec3_t){{ c0.v[i] * inv_det, c1.v[i] * inv_det, c2.v[i] * inv_det }};
+    }
+}
+
+/**
+ * @brief Eksene dik iki birim yön üretir.
+ */
+static void fe_joint_perpendicular_basis(fe_vec3_t n, fe_vec3_t* out_t1, fe_vec3_t* out_t2) {
+    fe_vec3_t t = (fabsf(n.x) >= 0.57735f) ? (fe_vec3_t){{n.y, -n.x, 0.0f}} : (fe_vec3_t){{0.0f, n.z, -n.y}};
+    *out_t1 = fe_vec3_normalize(t);
+    *out_t2 = fe_vec3_cross(n, *out_t1);
+}
+
+/**
+ * @brief Cisim bu adımda simüle ediliyor ve uyanık listede mi? (Uyanık, dinamik; dünya ucu için false)
+ */
+static inline bool fe_joint_is_simulated(const fe_rigid_body_t* rb, uint32_t body_count) {
+    return rb && rb->is_awake && !rb->is_kinematic && rb->inverse_mass > 0.0f && rb->awake_index < body_count;
+}
+
+/**
+ * @brief Ucun çözüm hızlarını okur (listede değilse kayıttan; dünya ucu hareketsizdir).
+ */
+static inline fe_solver_velocity_t fe_joint_load_velocity(const fe_constraint_solver_t* solver, const fe_rigid_body_t* rb, uint32_t index) {
+    if (!rb) return (fe_solver_velocity_t){ {{0.0f, 0.0f, 0.0f}}, {{0.0f, 0.0f, 0.0f}} };
+    if (index < solver->velocity_count) return solver->velocities[index];
+    return (fe_solver_velocity_t){ rb->linear_velocity, rb->angular_velocity };
+}
+
+/**
+ * @brief Yerel hızları çözüm dizisine geri yazar. Sonsuz kütleli uçlara yazılmaz: aynı renkteki
+ * * eklemler ortak bir statik cisme bağlıyken paralel çözülebilir.
+ */
+static inline void fe_joint_save_velocity(fe_constraint_solver_t* solver, uint32_t index, float inv_mass, const fe_solver_velocity_t* vel) {
+    if (inv_mass > 0.0f && index < solver->velocity_count) solver->velocities[index] = *vel;
+}
+
+/**
+ * @brief P impulsunu bağlama noktalarında A'ya ters, B'ye doğru yönde uygular.
+ */
+static inline void fe_joint_apply_impulse(const fe_joint_constraint_t* j, fe_solver_velocity_t* a, fe_solver_velocity_t* b, fe_vec3_t impulse) {
+    if (j->inv_mass_a > 0.0f) {
+        a->linear = fe_vec3_subtract(a->linear, fe_vec3_scale(impulse, j->inv_mass_a));
+        a->angular = fe_vec3_subtract(a->angular, fe_joint_mul_rows(j->inv_inertia_a, fe_vec3_cross(j->r_a, impulse)));
+    }
+    if (j->inv_mass_b > 0.0f) {
+        b->linear = fe_vec3_add(b->linear, fe_vec3_scale(impulse, j->inv_mass_b));
+        b->angular = fe_vec3_add(b->angular, fe_joint_mul_rows(j->inv_inertia_b, fe_vec3_cross(j->r_b, impulse)));
+    }
+}
+
+/**
+ * @brief L açısal impulsunu A'ya ters, B'ye doğru yönde uygular.
+ */
+static inline void fe_joint_apply_angular_impulse(const fe_joint_constraint_t* j, fe_solver_velocity_t* a, fe_solver_velocity_t* b, fe_vec3_t impulse) {
+    if (j->inv_mass_a > 0.0f) a->angular = fe_vec3_subtract(a->angular, fe_joint_mul_rows(j->inv_inertia_a, impulse));
+    if (j->inv_mass_b > 0.0f) b->angular = fe_vec3_add(b->angular, fe_joint_mul_rows(j->inv_inertia_b, impulse));
+}
+
+/**
+ * @brief Bağlama noktasında B'nin A'ya göre bağıl hızı.
+ */
+static inline fe_vec3_t fe_joint_relative_velocity(const fe_joint_constraint_t* j, const fe_solver_velocity_t* a, const fe_solver_velocity_t* b) {
+    fe_vec3_t va = fe_vec3_add(a->linear, fe_vec3_cross(a->angular, j->r_a));
+    fe_vec3_t vb = fe_vec3_add(b->linear, fe_vec3_cross(b->angular, j->r_b));
+    return fe_vec3_subtract(vb, va);
+}
+
+static bool fe_constraint_solver_reserve(fe_constraint_solver_t* solver, uint32_t joint_count, uint32_t body_count) {
+    if (joint_count > solver->joint_capacity) {
+        uint32_t capacity = solver->joint_capacity ? solver->joint_capacity : FE_CONSTRAINT_INITIAL_CAPACITY;
+        while (capacity < joint_count) capacity *= 2;
+
+        fe_joint_constraint_t* joints = (fe_joint_constraint_t*)fe_mem_realloc(solver->joints, capacity * sizeof(fe_joint_constraint_t));
+        if (!joints) return false;
+        solver->joints = joints;
+        uint32_t* colors = (uint32_t*)fe_mem_realloc(solver->joint_colors, capacity * sizeof(uint32_t));
+        if (!colors) return false;
+        solver->joint_colors = colors;
+        uint32_t* pairs = (uint32_t*)fe_mem_realloc(solver->body_pairs, 2 * capacity * sizeof(uint32_t));
+        if (!pairs) return false;
+        solver->body_pairs = pairs;
+        solver->joint_capacity = capacity;
+    }
+    if (body_count > solver->body_color_capacity) {
+        uint32_t capacity = solver->body_color_capacity ? solver->body_color_capacity : FE_CONSTRAINT_INITIAL_CAPACITY;
+        while (capacity < body_count) capacity *= 2;
+
+        uint32_t* masks = (uint32_t*)fe_mem_realloc(solver->body_colors, capacity * sizeof(uint32_t));
+        if (!masks) return false;
+        solver->body_colors = masks;
+        solver->body_color_capacity = capacity;
+    }
+    return true;
+}
+
+/**
+ * @brief Maskedeki en düşük 0 bitinin indeksini döndürür (mask != UINT32_MAX olmalı).
+ */
+static inline uint32_t fe_constraint_first_free_color(uint32_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (uint32_t)__builtin_ctz(~mask);
+#else
+    uint32_t index = 0;
+    while (mask & 1u) { mask >>= 1; ++index; }
+    return index;
+#endif
+}
+
+
+// ----------------------------------------------------------------------
+// 2. YÖNETİM UYGULAMALARI
+// ----------------------------------------------------------------------
+
+/**
+ * Uygulama: fe_constraint_solver_init
+ */
+fe_error_code_t fe_constraint_solver_init(fe_constraint_solver_t* solver) {
+    if (!solver) return FE_ERR_INVALID_ARGUMENT;
+    memset(solver, 0, sizeof(*solver));
+
+    if (!fe_constraint_solver_reserve(solver, FE_CONSTRAINT_INITIAL_CAPACITY, FE_CONSTRAINT_INITIAL_CAPACITY)) {
+        FE_LOG_ERROR("Eklem cozucusu icin bellek ayrilamadi.");
+        fe_constraint_solver_destroy(solver);
+        return FE_ERR_MEMORY_ALLOCATION;
+    }
+
+    solver->velocity_iterations = FE_CONSTRAINT_VELOCITY_ITERATIONS;
+    solver->warm_starting = true;
+    return FE_OK;
+}
+
+/**
+ * Uygulama: fe_constraint_solver_destroy
+ */
+void fe_constraint_solver_destroy(fe_constraint_solver_t* solver) {
+    if (!solver) return;
+    fe_mem_free(solver->joints);
+    fe_mem_free(solver->joint_colors);
+    fe_mem_free(solver->body_colors);
+    fe_mem_free(solver->body_pairs);
+    memset(solver, 0, sizeof(*solver));
+}
+
+/**
+ * Uygulama: fe_constraint_solver_build
+ */
+bool fe_constraint_solver_build(fe_constraint_solver_t* solver, const fe_array_t* constraints, uint32_t body_count) {
+    solver->joint_count = 0;
+    solver->pair_count = 0;
+    solver->color_count = 0;
+    memset(solver->color_start, 0, sizeof(solver->color_start));
+
+    uint32_t total = constraints ? (uint32_t)fe_array_count(constraints) : 0;
+    if (total == 0) return true;
+    if (!fe_constraint_solver_reserve(solver, total, body_count)) {
+        FE_LOG_ERROR("Eklem cozucusu: diziler buyutulemedi, eklemler cozulmeyecek.");
+        return false;
+    }
+    memset(solver->body_colors, 0, body_count * sizeof(uint32_t));
+
+    // 1. Açgözlü boyama (kayıt sırasıyla): eklem, iki dinamik ucunun da kullanmadığı ilk rengi alır
+    uint32_t* color_size = &solver->color_start[1];
+    for (uint32_t k = 0; k < total; ++k) {
+        const fe_physics_constraint_component_t* c = *(fe_physics_constraint_component_t* const*)fe_array_get((fe_array_t*)constraints, k);
+        solver->joint_colors[k] = UINT32_MAX;
+        if (!c || !c->is_active || !c->body_a) continue;
+
+        bool sim_a = fe_joint_is_simulated(c->body_a, body_count);
+        bool sim_b = fe_joint_is_simulated(c->body_b, body_count);
+        if (!sim_a && !sim_b) continue;
+
+        uint32_t used = (sim_a ? solver->body_colors[c->body_a->awake_index] : 0u) |
+                        (sim_b ? solver->body_colors[c->body_b->awake_index] : 0u);
+        uint32_t color = FE_CONSTRAINT_MAX_COLORS; // Taşma
+        if (used != UINT32_MAX) {
+            color = fe_constraint_first_free_color(used);
+            if (sim_a) solver->body_colors[c->body_a->awake_index] |= 1u << color;
+            if (sim_b) solver->body_colors[c->body_b->awake_index] |= 1u << color;
+            if (color + 1 > solver->color_count) solver->color_count = color + 1;
+        }
+        solver->joint_colors[k] = color;
+        color_size[color]++;
+
+        if (sim_a && sim_b) {
+            solver->body_pairs[2 * solver->pair_count] = c->body_a->awake_index;
+            solver->body_pairs[2 * solver->pair_count + 1] = c->body_b->awake_index;
+            solver->pair_count++;
+        }
+    }
+
+    // 2. Renklere göre grupla (sayma sıralaması; renk içinde kayıt sırası korunur)
+    for (uint32_t s = 0; s <= FE_CONSTRAINT_MAX_COLORS; ++s) solver->color_start[s + 1] += solver->color_start[s];
+
+    uint32_t cursor[FE_CONSTRAINT_MAX_COLORS + 1];
+    memcpy(cursor, solver->color_start, sizeof(cursor));
+    for (uint32_t k = 0; k < total; ++k) {
+        uint32_t color = solver->joint_colors[k];
+        if (color == UINT32_MAX) continue;
+        fe_physics_constraint_component_t* c = *(fe_physics_constraint_component_t**)fe_array_get((fe_array_t*)constraints, k);
+        solver->joints[cursor[color]++].component = c;
+    }
+    solver->joint_count = solver->color_start[FE_CONSTRAINT_MAX_COLORS + 1];
+
+    if (solver->color_start[FE_CONSTRAINT_MAX_COLORS + 1] > solver->color_start[FE_CONSTRAINT_MAX_COLORS]) {
+        FE_LOG_WARN("Eklem cozucusu: %u eklem renk bulamadi, sirali cozulecek.",
+                    solver->color_start[FE_CONSTRAINT_MAX_COLORS + 1] - solver->color_start[FE_CONSTRAINT_MAX_COLORS]);
+    }
+    return true;
+}
+
+
+// ----------------------------------------------------------------------
+// 3. ÇÖZÜM
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Kütle verisini, bağlama noktalarını, efektif kütleleri ve hız hedeflerini (bias) hesaplar.
+ */
+static void fe_joint_prepare(const fe_constraint_solver_t* solver, fe_joint_constraint_t* j) {
+    fe_physics_constraint_component_t* c = j->component;
+    const fe_rigid_body_t* a = c->body_a;
+    const fe_rigid_body_t* b = c->body_b;
+    float beta = FE_CONSTRAINT_BAUMGARTE * solver->inv_dt;
+
+    // Uyuyan uçlar bu adımda statik gibi davranır (yönetici bağlı adaları çözümden önce uyandırır)
+    j->index_a = a->awake_index;
+    j->index_b = b ? b->awake_index : UINT32_MAX;
+    j->inv_mass_a = fe_joint_is_simulated(a, solver->velocity_count) ? a->inverse_mass : 0.0f;
+    j->inv_mass_b = fe_joint_is_simulated(b, solver->velocity_count) ? b->inverse_mass : 0.0f;
+    if (j->inv_mass_a > 0.0f) {
+        fe_rigid_body_get_world_inverse_inertia(a, j->inv_inertia_a);
+    } else {
+        memset(j->inv_inertia_a, 0, sizeof(j->inv_inertia_a));
+    }
+    if (j->inv_mass_b > 0.0f) {
+        fe_rigid_body_get_world_inverse_inertia(b, j->inv_inertia_b);
+    } else {
+        memset(j->inv_inertia_b, 0, sizeof(j->inv_inertia_b));
+    }
+
+    // Bağlama noktaları (B yoksa anchor_b_local dünya noktasıdır)
+    fe_vec3_t rows_a[3];
+    fe_vec3_t rows_b[3] = { {{1.0f, 0.0f, 0.0f}}, {{0.0f, 1.0f, 0.0f}}, {{0.0f, 0.0f, 1.0f}} };
+    fe_physics_quat_to_rows(a->orientation, rows_a);
+    if (b) fe_physics_quat_to_rows(b->orientation, rows_b);
+
+    j->r_a = fe_joint_mul_rows(rows_a, c->anchor_a_local);
+    fe_vec3_t p_a = fe_vec3_add(a->position, j->r_a);
+    fe_vec3_t p_b;
+    if (b) {
+        j->r_b = fe_joint_mul_rows(rows_b, c->anchor_b_local);
+        p_b = fe_vec3_add(b->position, j->r_b);
+    } else {
+        j->r_b = (fe_vec3_t){{0.0f, 0.0f, 0.0f}};
+        p_b = c->anchor_b_local;
+    }
+    fe_vec3_t separation = fe_vec3_subtract(p_b, p_a);
+
+    if (!solver->warm_starting) {
+        c->linear_impulse = (fe_vec3_t){{0.0f, 0.0f, 0.0f}};
+        c->angular_impulse = (fe_vec3_t){{0.0f, 0.0f, 0.0f}};
+        c->axial_impulse = 0.0f;
+    }
+
+    if (c->type == FE_CONSTRAINT_SPRING) {
+        // Yumuşak kısıtlama: sertlik ve sönüm, zaman adımından bağımsız bir yay-sönümleyici verir
+        const float h = solver->dt;
+        const float stiffness = c->properties.spring_data.stiffness;
+        const float damping = c->properties.spring_data.damping;
+        float length = fe_vec3_length(separation);
+        float denom = damping + h * stiffness;
+        j->spring_mass = 0.0f;
+        if (length < 1e-6f || denom <= 0.0f) return;
+
+        j->spring_axis = fe_vec3_scale(separation, 1.0f / length);
+        fe_vec3_t ra_n = fe_vec3_cross(j->r_a, j->spring_axis);
+        fe_vec3_t rb_n = fe_vec3_cross(j->r_b, j->spring_axis);
+        float k = j->inv_mass_a + j->inv_mass_b
+                + fe_vec3_dot(ra_n, fe_joint_mul_rows(j->inv_inertia_a, ra_n))
+                + fe_vec3_dot(rb_n, fe_joint_mul_rows(j->inv_inertia_b, rb_n));
+        j->spring_gamma = 1.0f / (h * denom);
+        j->spring_bias = (length - c->properties.spring_data.rest_length) * stiffness / denom;
+        j->spring_mass = (k > 0.0f) ? 1.0f / (k + j->spring_gamma) : 0.0f;
+        return;
+    }
+
+    // Bağlama noktası: K = (mA + mB) E - [rA]x IA [rA]x - [rB]x IB [rB]x (simetrik; sütunlar = satırlar)
+    fe_vec3_t k_rows[3];
+    for (int axis = 0; axis < 3; ++axis) {
+        fe_vec3_t e = {{0.0f, 0.0f, 0.0f}};
+        e.v[axis] = 1.0f;
+        fe_vec3_t col = fe_vec3_scale(e, j->inv_mass_a + j->inv_mass_b);
+        col = fe_vec3_add(col, fe_vec3_cross(fe_joint_mul_rows(j->inv_inertia_a, fe_vec3_cross(j->r_a, e)), j->r_a));
+        col = fe_vec3_add(col, fe_vec3_cross(fe_joint_mul_rows(j->inv_inertia_b, fe_vec3_cross(j->r_b, e)), j->r_b));
+        k_rows[axis] = col;
+    }
+    fe_joint_invert(k_rows, j->point_mass);
+    j->point_bias = fe_vec3_scale(separation, beta);
+
+    fe_vec3_t inertia_sum[3];
+    for (int r = 0; r < 3; ++r) inertia_sum[r] = fe_vec3_add(j->inv_inertia_a[r], j->inv_inertia_b[r]);
+
+    if (c->type == FE_CONSTRAINT_FIXED) {
+        // Hedef yönelimden sapma: q_err = q_b * (q_a * q_rel)^-1, küçük açı için dönme vektörü 2 * q_err.xyz
+        fe_vec4_t q_b = b ? b->orientation : (fe_vec4_t){{0.0f, 0.0f, 0.0f, 1.0f}};
+        fe_vec4_t target = fe_physics_quat_multiply(a->orientation, c->properties.fixed_data.relative_orientation);
+        fe_vec4_t q_err = fe_physics_quat_multiply(q_b, fe_physics_quat_conjugate(target));
+        float sign = (q_err.w < 0.0f) ? -2.0f : 2.0f;
+        fe_vec3_t error = {{ q_err.x * sign, q_err.y * sign, q_err.z * sign }};
+
+        fe_joint_invert(inertia_sum, j->angular_mass);
+        j->angular_bias = fe_vec3_scale(error, beta);
+    } else if (c->type == FE_CONSTRAINT_HINGE) {
+        // Eksenler çakışık tutulur: sapma a_A x a_B, eksene dik iki yönde düzeltilir
+        fe_vec3_t axis_a = fe_vec3_normalize(fe_joint_mul_rows(rows_a, c->properties.hinge_data.axis_a_local));
+        fe_vec3_t axis_b = fe_vec3_normalize(fe_joint_mul_rows(rows_b, c->properties.hinge_data.axis_b_local));
+        fe_vec3_t error = fe_vec3_cross(axis_a, axis_b);
+        fe_joint_perpendicular_basis(axis_a, &j->hinge_axes[0], &j->hinge_axes[1]);
+
+        for (int i = 0; i < 2; ++i) {
+            fe_vec3_t d = j->hinge_axes[i];
+            float k = fe_vec3_dot(d, fe_joint_mul_rows(inertia_sum, d));
+            j->hinge_mass[i] = (k > 0.0f) ? 1.0f / k : 0.0f;
+            j->hinge_bias[i] = fe_vec3_dot(d, error) * beta;
+            // Biriken açısal impuls dünya uzayında saklanır; eksenler döndüğünde yeni tabana izdüşürülür
+            j->hinge_impulse[i] = fe_vec3_dot(c->angular_impulse, d);
+        }
+    }
+}
+
+static void fe_joint_warm_start(fe_constraint_solver_t* solver, const fe_joint_constraint_t* j) {
+    const fe_physics_constraint_component_t* c = j->component;
+    fe_solver_velocity_t a = fe_joint_load_velocity(solver, c->body_a, j->index_a);
+    fe_solver_velocity_t b = fe_joint_load_velocity(solver, c->body_b, j->index_b);
+
+    switch (c->type) {
+        case FE_CONSTRAINT_SPRING:
+            if (j->spring_mass > 0.0f) fe_joint_apply_impulse(j, &a, &b, fe_vec3_scale(j->spring_axis, c->axial_impulse));
+            break;
+        case FE_CONSTRAINT_HINGE: {
+            fe_vec3_t angular = fe_vec3_add(fe_vec3_scale(j->hinge_axes[0], j->hinge_impulse[0]),
+                                            fe_vec3_scale(j->hinge_axes[1], j->hinge_impulse[1]));
+            fe_joint_apply_angular_impulse(j, &a, &b, angular);
+            fe_joint_apply_impulse(j, &a, &b, c->linear_impulse);
+            break;
+        }
+        case FE_CONSTRAINT_FIXED:
+            fe_joint_apply_angular_impulse(j, &a, &b, c->angular_impulse);
+            fe_joint_apply_impulse(j, &a, &b, c->linear_impulse);
+            break;
+        default:
+            fe_joint_apply_impulse(j, &a, &b, c->linear_impulse);
+            break;
+    }
+
+    fe_joint_save_velocity(solver, j->index_a, j->inv_mass_a, &a);
+    fe_joint_save_velocity(solver, j->index_b, j->inv_mass_b, &b);
+}
+
+static void fe_joint_solve(fe_constraint_solver_t* solver, fe_joint_constraint_t* j) {
+    fe_physics_constraint_component_t* c = j->component;
+    fe_solver_velocity_t a = fe_joint_load_velocity(solver, c->body_a, j->index_a);
+    fe_solver_velocity_t b = fe_joint_load_velocity(solver, c->body_b, j->index_b);
+
+    if (c->type == FE_CONSTRAINT_SPRING) {
+        if (j->spring_mass > 0.0f) {
+            float vn = fe_vec3_dot(fe_joint_relative_velocity(j, &a, &b), j->spring_axis);
+            float lambda = -j->spring_mass * (vn + j->spring_bias + j->spring_gamma * c->axial_impulse);
+            c->axial_impulse += lambda;
+            fe_joint_apply_impulse(j, &a, &b, fe_vec3_scale(j->spring_axis, lambda));
+        }
+    } else {
+        // 1. Açısal satırlar (bağlama noktası son çözülür: ayrılma en görünür hatadır)
+        if (c->type == FE_CONSTRAINT_FIXED) {
+            fe_vec3_t dw = fe_vec3_subtract(b.angular, a.angular);
+            fe_vec3_t impulse = fe_vec3_scale(fe_joint_mul_rows(j->angular_mass, fe_vec3_add(dw, j->angular_bias)), -1.0f);
+            c->angular_impulse = fe_vec3_add(c->angular_impulse, impulse);
+            fe_joint_apply_angular_impulse(j, &a, &b, impulse);
+        } else if (c->type == FE_CONSTRAINT_HINGE) {
+            for (int i = 0; i < 2; ++i) {
+                float dw = fe_vec3_dot(fe_vec3_subtract(b.angular, a.angular), j->hinge_axes[i]);
+                float lambda = -j->hinge_mass[i] * (dw + j->hinge_bias[i]);
+                j->hinge_impulse[i] += lambda;
+                fe_joint_apply_angular_impulse(j, &a, &b, fe_vec3_scale(j->hinge_axes[i], lambda));
+            }
+            c->angular_impulse = fe_vec3_add(fe_vec3_scale(j->hinge_axes[0], j->hinge_impulse[0]),
+                                             fe_vec3_scale(j->hinge_axes[1], j->hinge_impulse[1]));
+        }
+
+        // 2. Bağlama noktası: üç doğrusal satır birlikte (3x3 blok)
+        fe_vec3_t dv = fe_joint_relative_velocity(j, &a, &b);
+        fe_vec3_t impulse = fe_vec3_scale(fe_joint_mul_rows(j->point_mass, fe_vec3_add(dv, j->point_bias)), -1.0f);
+        c->linear_impulse = fe_vec3_add(c->linear_impulse, impulse);
+        fe_joint_apply_impulse(j, &a, &b, impulse);
+    }
+
+    fe_joint_save_velocity(solver, j->index_a, j->inv_mass_a, &a);
+    fe_joint_save_velocity(solver, j->index_b, j->inv_mass_b, &b);
+}
+
+/**
+ * @brief [begin, end) aralığındaki eklemleri hazırlar (iş sistemi parçası; her eklem sadece kendine yazar).
+ */
+static void fe_constraint_prepare_range(void* data, uint32_t begin, uint32_t end) {
+    fe_constraint_solver_t* solver = (fe_constraint_solver_t*)data;
+    for (uint32_t i = begin; i < end; ++i) fe_joint_prepare(solver, &solver->joints[i]);
+}
+
+/**
+ * @brief Çözülen rengin [begin, end) aralığını sıcak başlatır (iş sistemi parçası).
+ */
+static void fe_constraint_warm_start_range(void* data, uint32_t begin, uint32_t end) {
+    fe_constraint_solver_t* solver = (fe_constraint_solver_t*)data;
+    for (uint32_t i = begin; i < end; ++i) fe_joint_warm_start(solver, &solver->joints[solver->batch_offset + i]);
+}
+
+/**
+ * @brief Çözülen rengin [begin, end) aralığında bir yineleme yapar (iş sistemi parçası).
+ */
+static void fe_constraint_solve_range(void* data, uint32_t begin, uint32_t end) {
+    fe_constraint_solver_t* solver = (fe_constraint_solver_t*)data;
+    for (uint32_t i = begin; i < end; ++i) fe_joint_solve(solver, &solver->joints[solver->batch_offset + i]);
+}
+
+/**
+ * @brief Renkleri sırayla, her rengin eklemlerini paralel işler; taşma grubu en son ve sıralı işlenir.
+ * * Aynı renkteki eklemler ortak dinamik cisim paylaşmadığından iş bölümü sonucu değiştirmez.
+ */
+static void fe_constraint_solver_run_colors(fe_constraint_solver_t* solver, fe_job_range_func_t func) {
+    for (uint32_t color = 0; color < solver->color_count; ++color) {
+        solver->batch_offset = solver->color_start[color];
+        fe_job_parallel_for(solver->color_start[color + 1] - solver->color_start[color], FE_CONSTRAINT_JOB_GRAIN, func, solver);
+    }
+
+    uint32_t overflow = solver->color_start[FE_CONSTRAINT_MAX_COLORS + 1] - solver->color_start[FE_CONSTRAINT_MAX_COLORS];
+    if (overflow > 0) {
+        solver->batch_offset = solver->color_start[FE_CONSTRAINT_MAX_COLORS];
+        func(solver, 0, overflow);
+    }
+}
+
+/**
+ * Uygulama: fe_constraint_solver_solve
+ */
+void fe_constraint_solver_solve(fe_constraint_solver_t* solver, fe_solver_velocity_t* velocities, uint32_t velocity_count, float dt) {
+    if (solver->joint_count == 0 || dt <= 0.0f) return;
+
+    fe_constraint_solver_prepare(solver, velocities, velocity_count, dt);
+    for (uint32_t iter = 0; iter < solver->velocity_iterations; ++iter) {
+        fe_constraint_solver_solve_iteration(solver);
+    }
+}
+
+/**
+ * Uygulama: fe_constraint_solver_prepare
+ */
+void fe_constraint_solver_prepare(fe_constraint_solver_t* solver, fe_solver_velocity_t* velocities, uint32_t velocity_count, float dt) {
+    solver->velocities = velocities;
+    solver->velocity_count = velocity_count;
+    if (solver->joint_count == 0 || dt <= 0.0f) return;
+
+    solver->dt = dt;
+    solver->inv_dt = 1.0f / dt;
+    fe_job_parallel_for(solver->joint_count, FE_CONSTRAINT_JOB_GRAIN, fe_constraint_prepare_range, solver);
+
+    if (solver->warm_starting) {
+        fe_constraint_solver_run_colors(solver, fe_constraint_warm_start_range);
+    }
+}
+
+/**
+ * Uygulama: fe_constraint_solver_solve_iteration
+ */
+void fe_constraint_solver_solve_iteration(fe_constraint_solver_t* solver) {
+    if (solver->joint_count == 0 || solver->dt <= 0.0f) return;
+    fe_constraint_solver_run_colors(solver, fe_constraint_solve_range);
+}
@@ -1,14 +1,23 @@
 // src/physics/fe_destruction_system.c
 
 #include "physics/fe_destruction_system.h"
+#include "physics/fe_physics_manager.h" // fe_physics_manager_remove_rigid_body, fe_physics_manager_add_rigid_bodies, fe_physics_manager_reserve_contacts
 #include "utils/fe_logger.h"
-#include <stdlib.h> // malloc, free
-#include <math.h>   // sqrtf, fabsf, fmaxf
+#include "memory/fe_memory_manager.h" // fe_mem_calloc, fe_mem_realloc, fe_mem_free
+#include <math.h>   // sqrtf, fabsf, fmaxf, atan2f
+#include <stdlib.h> // qsort
 
-// Harici Fonksiyon Bildirimleri (fe_physics_manager'dan gelmesi beklenir)
-// Bu fonksiyonlar, yıkım sonrası parçaları ana simülasyona eklemek için zorunludur.
-void fe_physics_manager_remove_rigid_body(fe_rigid_body_t* rb);
-void fe_physics_manager_add_rigid_body(fe_rigid_body_t* rb);
+// Bağ sağlığı oranı (1: sağlam) başına gereken hasar, ortak yüz alanının m^2'si başına
+#define FE_DESTRUCTION_DEFAULT_BOND_STRENGTH 100.0f
+
+// Eski yoldaki patlama hızı (m/s)
+#define FE_DESTRUCTION_DEFAULT_EXPLOSION_SPEED 10.0f
+
+// Kırılmada parça başına beklenen aday çift sayısı (500 parçalık tam kırılmada ~16, sonraki adımda ~37)
+#define FE_DESTRUCTION_RESERVED_PAIRS_PER_CHUNK 40u
+
+// Destek taramasında ulaşılan parçaların geçici işareti (chunk_states'in üst biti)
+#define FE_DESTRUCTION_REACHED 0x80u
 
 // ----------------------------------------------------------------------
 // 1. YÖNETİM UYGULAMALARI
@@ -20,19 +29,20 @@ static uint32_t g_next_dest_comp_id = 1;
  * Uygulama: fe_destruction_create_component
  */
 fe_destructible_component_t* fe_destruction_create_component(
-    fe_rigid_body_t* target_body, 
-    fe_fracture_mesh_t* fracture_data, 
-    float health, 
-    float threshold) 
+    fe_rigid_body_t* target_body,
+    fe_fracture_mesh_t* fracture_data,
+    fe_fracture_body_pool_t* body_pool,
+    float health,
+    float threshold)
 {
-    if (!target_body || !fracture_data) {
+    if (!target_body || !fracture_data || fe_array_count(fracture_data->chunks) == 0) {
         FE_LOG_ERROR("Yikilabilir bilesen olusturmak icin hedef ve yikim verisi gereklidir.");
         return NULL;
     }
-    
-    fe_destructible_component_t* comp = 
-        (fe_destructible_component_t*)calloc(1, sizeof(fe_destructible_component_t));
-        
+
+    fe_destructible_component_t* comp =
+        (fe_destructible_component_t*)fe_mem_calloc(1, sizeof(fe_destructible_component_t));
+
     if (!comp) {
         FE_LOG_FATAL("Yikilabilir bilesen icin bellek ayrilamadi.");
         return NULL;
@@ -44,6 +54,35 @@ fe_destructible_component_t* fe_destruction_create_component(
     comp->health = fmaxf(1.0f, health);
     comp->impulse_threshold = fmaxf(0.1f, threshold);
     comp->kinetic_energy_threshold = 0.0f; // Varsayılan olarak kullanılmaz
+    comp->bond_strength = FE_DESTRUCTION_DEFAULT_BOND_STRENGTH;
+    comp->explosion_speed = FE_DESTRUCTION_DEFAULT_EXPLOSION_SPEED;
+
+    // Kırılma anında bellek ayrılmaması için parça durumu şimdi ayrılır
+    uint32_t chunk_count = (uint32_t)fe_array_count(fracture_data->chunks);
+    uint32_t bond_count = fracture_data->bond_count;
+    comp->chunk_slots = (uint32_t*)fe_mem_alloc(chunk_count * sizeof(uint32_t));
+    comp->chunk_states = (uint8_t*)fe_mem_calloc(chunk_count, sizeof(uint8_t));
+    comp->bond_health = (float*)fe_mem_alloc((bond_count ? bond_count : 1) * sizeof(float));
+    comp->scratch = (uint32_t*)fe_mem_alloc(chunk_count * sizeof(uint32_t));
+    comp->scratch_bodies = (fe_rigid_body_t**)fe_mem_alloc(chunk_count * sizeof(fe_rigid_body_t*));
+
+    if (!body_pool) {
+        body_pool = fe_fracture_body_pool_create(chunk_count);
+        comp->owns_body_pool = true;
+    }
+    comp->body_pool = body_pool;
+
+    if (!comp->chunk_slots || !comp->chunk_states || !comp->bond_health || !comp->scratch || !comp->scratch_bodies || !body_pool) {
+        FE_LOG_FATAL("Yikilabilir bilesen icin parca durumu ayrilamadi.");
+        fe_destruction_destroy_component(comp);
+        return NULL;
+    }
+
+    for (uint32_t i = 0; i < chunk_count; ++i) comp->chunk_slots[i] = UINT32_MAX;
+    for (uint32_t i = 0; i < bond_count; ++i) comp->bond_health[i] = 1.0f;
+
+    // Parçaların çiftleri ve manifoldları da kırılma adımında değil şimdi ayrılır
+    fe_physics_manager_reserve_contacts(chunk_count * FE_DESTRUCTION_RESERVED_PAIRS_PER_CHUNK);
 
     FE_LOG_INFO("Yikilabilir Bilesen %u olusturuldu. Sağlık: %.1f", comp->id, comp->health);
     return comp;
@@ -55,13 +94,213 @@ fe_destructible_component_t* fe_destruction_create_component(
 void fe_destruction_destroy_component(fe_destructible_component_t* dest_comp) {
     if (dest_comp) {
         // Not: fracture_data'nin ömrü başka bir sistemde yönetilmelidir.
-        free(dest_comp);
+        if (dest_comp->chunk_slots && dest_comp->body_pool) {
+            uint32_t chunk_count = (uint32_t)fe_array_count(dest_comp->fracture_data->chunks);
+            for (uint32_t i = 0; i < chunk_count; ++i) {
+                if (dest_comp->chunk_slots[i] != UINT32_MAX) fe_fracture_body_pool_release(dest_comp->body_pool, dest_comp->chunk_slots[i]);
+            }
+        }
+        if (dest_comp->owns_body_pool) fe_fracture_body_pool_destroy(dest_comp->body_pool);
+
+        fe_mem_free(dest_comp->chunk_slots);
+        fe_mem_free(dest_comp->chunk_states);
+        fe_mem_free(dest_comp->bond_health);
+        fe_mem_free(dest_comp->scratch);
+        fe_mem_free(dest_comp->scratch_bodies);
+        fe_mem_free(dest_comp);
         FE_LOG_TRACE("Yikilabilir Bilesen yok edildi.");
     }
 }
 
+
 // ----------------------------------------------------------------------
-// 2. HASAR VE KONTROL
+// 2. PARÇA ETKİNLEŞTİRME
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Yerel vektörü döndürür (rows: fe_physics_quat_to_rows çıktısı).
+ */
+static inline fe_vec3_t fe_destruction_rotate(const fe_vec3_t rows[3], fe_vec3_t v) {
+    return (fe_vec3_t){{ fe_vec3_dot(rows[0], v), fe_vec3_dot(rows[1], v), fe_vec3_dot(rows[2], v) }};
+}
+
+/**
+ * @brief fe_destruction_rotate'in tersi (devrik matrisle çarpım).
+ */
+static inline fe_vec3_t fe_destruction_unrotate(const fe_vec3_t rows[3], fe_vec3_t v) {
+    return (fe_vec3_t){{
+        rows[0].x * v.x + rows[1].x * v.y + rows[2].x * v.z,
+        rows[0].y * v.x + rows[1].y * v.y + rows[2].y * v.z,
+        rows[0].z * v.x + rows[1].z * v.y + rows[2].z * v.z
+    }};
+}
+
+/**
+ * @brief Parçaların yerleştirildiği nesne dönüşümü: kırılmadan önce hedef cismin güncel dönüşümü,
+ * * sonra ilk kırılmada sabitlenen dönüşüm (statik parçalar yerinde kalır).
+ */
+static void fe_destruction_get_frame(const fe_destructible_component_t* comp, fe_vec3_t* position, fe_vec4_t* orientation) {
+    if (comp->is_fractured) {
+        *position = comp->frame_position;
+        *orientation = comp->frame_orientation;
+    } else {
+        *position = comp->target_body->position;
+        *orientation = comp->target_body->orientation;
+    }
+}
+
+/**
+ * @brief Parça hâlâ yapının ayakta duran kısmında mı? (Kırılmadan önce tüm parçalar öyledir.)
+ */
+static inline bool fe_destruction_is_standing(const fe_destructible_component_t* comp, uint32_t chunk) {
+    uint8_t state = comp->chunk_states[chunk] & (uint8_t)~FE_DESTRUCTION_REACHED;
+    return state == FE_FRACTURE_CHUNK_STATIC || (!comp->is_fractured && state == FE_FRACTURE_CHUNK_INACTIVE);
+}
+
+/**
+ * @brief Havuz cismini parçanın dünya dönüşümüne ve kütlesine göre ayarlar.
+ * * Dinamik parça, hedef cismin o noktadaki hızını (kırılmadan önce) ve itme hızını alır.
+ */
+static void fe_destruction_place_chunk(const fe_destructible_component_t* comp, const fe_fracture_chunk_t* chunk, fe_rigid_body_t* rb,
+                                       const fe_vec3_t rows[3], bool dynamic, fe_vec3_t push_velocity) {
+    rb->position = fe_vec3_add(comp->frame_position, fe_destruction_rotate(rows, chunk->center));
+    rb->orientation = fe_physics_quat_multiply(comp->frame_orientation, chunk->orientation);
+    rb->collider->shape.box.half_extents = chunk->half_extents;
+    rb->collider->local_offset = chunk->collider_offset;
+    rb->material = comp->target_body->material;
+    rb->continuous_collision = false;
+    rb->total_force = (fe_vec3_t){{0.0f, 0.0f, 0.0f}};
+    rb->total_torque = (fe_vec3_t){{0.0f, 0.0f, 0.0f}};
+    rb->linear_velocity = (fe_vec3_t){{0.0f, 0.0f, 0.0f}};
+    rb->angular_velocity = (fe_vec3_t){{0.0f, 0.0f, 0.0f}};
+
+    if (!dynamic) {
+        fe_rigid_body_set_mass_properties(rb, 0.0f, FE_MAT4_IDENTITY);
+        return;
+    }
+
+    fe_mat4_t inertia = FE_MAT4_IDENTITY;
+    inertia.mm[0][0] = chunk->principal_inertia.x;
+    inertia.mm[1][1] = chunk->principal_inertia.y;
+    inertia.mm[2][2] = chunk->principal_inertia.z;
+    fe_rigid_body_set_mass_properties(rb, chunk->mass, inertia);
+
+    rb->linear_velocity = push_velocity;
+    if (!comp->is_fractured) {
+        // Hedef cisim hareket ediyorsa parçalar onun hız alanını devralır: v + w x r
+        const fe_rigid_body_t* target = comp->target_body;
+        fe_vec3_t r = fe_vec3_subtract(rb->position, target->position);
+        rb->linear_velocity = fe_vec3_add(rb->linear_velocity, fe_vec3_add(target->linear_velocity, fe_vec3_cross(target->angular_velocity, r)));
+        rb->angular_velocity = target->angular_velocity;
+    }
+}
+
+/**
+ * @brief Destekten başlayıp sağlam bağlar üzerinden yayılır; ulaşılamayan parçaları dinamik yapar.
+ * * İlk kırılmada hedef cisim dünyadan çıkar ve ulaşılan parçalar da statik olarak eklenir. Yeni
+ * * cisimler dünyaya tek seferde eklenir. Statikten dinamiğe geçen parça, yöneticinin önbelleğe
+ * * aldığı kütlesi yenilensin diye dünyadan çıkarılıp yeniden eklenir.
+ * @param keep_supports false ise destek parçaları da düşer (tam yıkım).
+ * @param push_radius > 0 ise itme hızı push_center'dan bu yarıçapa doğru azalır; aksi halde tüm yeni dinamik parçalara tam uygulanır.
+ * @return Dinamik olan parça sayısı.
+ */
+static uint32_t fe_destruction_update_support(fe_destructible_component_t* comp, bool keep_supports,
+                                              fe_vec3_t push_center, float push_radius, float push_speed) {
+    fe_fracture_mesh_t* fracture = comp->fracture_data;
+    const fe_fracture_chunk_t* chunks = (const fe_fracture_chunk_t*)fracture->chunks->data;
+    uint32_t chunk_count = (uint32_t)fe_array_count(fracture->chunks);
+    uint8_t* states = comp->chunk_states;
+
+    // A. Destekten genişlik öncelikli tarama
+    uint32_t head = 0, tail = 0;
+    if (keep_supports) {
+        for (uint32_t i = 0; i < chunk_count; ++i) {
+            if (!chunks[i].is_support || !fe_destruction_is_standing(comp, i)) continue;
+            states[i] |= FE_DESTRUCTION_REACHED;
+            comp->scratch[tail++] = i;
+        }
+    }
+    while (head < tail) {
+        const fe_fracture_chunk_t* chunk = &chunks[comp->scratch[head++]];
+        for (uint32_t k = 0; k < chunk->bond_count; ++k) {
+            uint32_t b = fracture->chunk_bonds[chunk->first_bond + k];
+            if (comp->bond_health[b] <= 0.0f) continue;
+
+            const fe_fracture_bond_t* bond = &fracture->bonds[b];
+            uint32_t other = (bond->chunk_a == (uint32_t)(chunk - chunks)) ? bond->chunk_b : bond->chunk_a;
+            if ((states[other] & FE_DESTRUCTION_REACHED) || !fe_destruction_is_standing(comp, other)) continue;
+            states[other] |= FE_DESTRUCTION_REACHED;
+            comp->scratch[tail++] = other;
+        }
+    }
+
+    // B. Hedef cismi ilk kırılmada dünyadan çıkar
+    bool first_break = !comp->is_fractured;
+    if (first_break) {
+        fe_destruction_get_frame(comp, &comp->frame_position, &comp->frame_orientation);
+        fe_physics_manager_remove_rigid_body(comp->target_body);
+    }
+
+    // C. Durum geçişleri; eklenecek cisimler toplanır
+    fe_vec3_t rows[3];
+    fe_physics_quat_to_rows(comp->frame_orientation, rows);
+
+    fe_fracture_body_pool_t* pool = comp->body_pool;
+    uint32_t add_count = 0, dynamic_count = 0, missing_count = 0;
+    for (uint32_t i = 0; i < chunk_count; ++i) {
+        bool reached = (states[i] & FE_DESTRUCTION_REACHED) != 0;
+        uint8_t state = states[i] & (uint8_t)~FE_DESTRUCTION_REACHED;
+        states[i] = state;
+
+        if (state == FE_FRACTURE_CHUNK_DYNAMIC) continue;
+        if (state == FE_FRACTURE_CHUNK_INACTIVE && !first_break) continue; // Havuza geri verilmiş
+        if (state == FE_FRACTURE_CHUNK_STATIC && reached) continue;        // Yerinde kalır
+
+        uint32_t slot = comp->chunk_slots[i];
+        if (slot == UINT32_MAX) {
+            slot = fe_fracture_body_pool_acquire(pool);
+            if (slot == UINT32_MAX) { missing_count++; continue; }
+            comp->chunk_slots[i] = slot;
+        } else if (pool->slot_states[slot] == FE_FRACTURE_SLOT_IN_WORLD) {
+            fe_physics_manager_remove_rigid_body(pool->bodies[slot]);
+            pool->slot_states[slot] = FE_FRACTURE_SLOT_ACQUIRED;
+        }
+
+        fe_vec3_t push = {{0.0f, 0.0f, 0.0f}};
+        if (!reached && push_speed > 0.0f) {
+            fe_vec3_t world_center = fe_vec3_add(comp->frame_position, fe_destruction_rotate(rows, chunks[i].center));
+            fe_vec3_t to_chunk = fe_vec3_subtract(world_center, push_center);
+            float distance = fe_vec3_length(to_chunk);
+            float falloff = (push_radius > 0.0f) ? fmaxf(0.0f, 1.0f - distance / push_radius) : 1.0f;
+            if (distance > 1e-6f && falloff > 0.0f) push = fe_vec3_scale(to_chunk, push_speed * falloff / distance);
+        }
+
+        fe_rigid_body_t* rb = pool->bodies[slot];
+        fe_destruction_place_chunk(comp, &chunks[i], rb, rows, !reached, push);
+        pool->slot_states[slot] = FE_FRACTURE_SLOT_IN_WORLD;
+        comp->scratch_bodies[add_count++] = rb;
+
+        states[i] = reached ? FE_FRACTURE_CHUNK_STATIC : FE_FRACTURE_CHUNK_DYNAMIC;
+        if (!reached) dynamic_count++;
+    }
+
+    if (first_break) {
+        // Yıkılan objeyi görsel sistemden de kaldırılmak üzere işaretle
+        comp->target_body->is_kinematic = true;
+        comp->target_body->is_awake = false;
+        comp->is_fractured = true;
+    }
+    if (missing_count > 0) {
+        FE_LOG_WARN("Kirilma havuzu tukendi: %u parca etkinlestirilemedi.", missing_count);
+    }
+
+    fe_physics_manager_add_rigid_bodies(comp->scratch_bodies, add_count);
+    return dynamic_count;
+}
+
+
+// ----------------------------------------------------------------------
+// 3. HASAR VE KONTROL
 // ----------------------------------------------------------------------
 
 /**
@@ -77,8 +316,57 @@ void fe_destruction_apply_impulse(fe_destructible_component_t* dest_comp, float
     // Eşik kontrolü
     if (impulse_magnitude >= dest_comp->impulse_threshold || dest_comp->health <= 0.0f) {
         dest_comp->is_pending_destruction = true;
-        FE_LOG_WARNING("Yikim tetiklendi! Darbe: %.1f", impulse_magnitude);
+        FE_LOG_WARN("Yikim tetiklendi! Darbe: %.1f", impulse_magnitude);
+    }
+}
+
+/**
+ * Uygulama: fe_destruction_apply_damage
+ * * Kümeler hasar küresiyle kesişmiyorsa bağlarına bakılmaz. Bağın merkezi ortak yüzdedir ve
+ * * ortak yüz chunk_a'nın hücresindedir; bu yüzden bağlar sadece chunk_a'nın kümesinde aranır.
+ */
+uint32_t fe_destruction_apply_damage(fe_destructible_component_t* dest_comp, fe_vec3_t world_point, float radius, float amount) {
+    if (!dest_comp || dest_comp->is_destroyed || radius <= 0.0f || amount <= 0.0f) return 0;
+
+    fe_fracture_mesh_t* fracture = dest_comp->fracture_data;
+
+    // Hasar noktasını nesne uzayına taşı
+    fe_vec3_t frame_position;
+    fe_vec4_t frame_orientation;
+    fe_destruction_get_frame(dest_comp, &frame_position, &frame_orientation);
+    fe_vec3_t rows[3];
+    fe_physics_quat_to_rows(frame_orientation, rows);
+    fe_vec3_t local = fe_destruction_unrotate(rows, fe_vec3_subtract(world_point, frame_position));
+
+    bool any_broken = false;
+    for (uint32_t c = 0; c < fracture->cluster_count; ++c) {
+        const fe_fracture_cluster_t* cluster = &fracture->clusters[c];
+
+        // Küre - AABB kesişimi (kutuya en yakın nokta)
+        float distance_sq = 0.0f;
+        for (int k = 0; k < 3; ++k) {
+            float v = local.v[k];
+            if (v < cluster->bounds.min.v[k]) distance_sq += (cluster->bounds.min.v[k] - v) * (cluster->bounds.min.v[k] - v);
+            else if (v > cluster->bounds.max.v[k]) distance_sq += (v - cluster->bounds.max.v[k]) * (v - cluster->bounds.max.v[k]);
+        }
+        if (distance_sq > radius * radius) continue;
+
+        for (uint32_t b = cluster->first_bond; b < cluster->first_bond + cluster->bond_count; ++b) {
+            if (dest_comp->bond_health[b] <= 0.0f) continue;
+
+            const fe_fracture_bond_t* bond = &fracture->bonds[b];
+            float distance = fe_vec3_length(fe_vec3_subtract(bond->center, local));
+            if (distance >= radius) continue;
+
+            // Geniş yüzlü bağlar daha dayanıklıdır
+            float damage = amount * (1.0f - distance / radius);
+            dest_comp->bond_health[b] -= damage / (bond->area * dest_comp->bond_strength);
+            if (dest_comp->bond_health[b] <= 0.0f) any_broken = true;
+        }
     }
+    if (!any_broken) return 0;
+
+    return fe_destruction_update_support(dest_comp, true, world_point, radius, dest_comp->explosion_speed);
 }
 
 /**
@@ -96,7 +384,7 @@ void fe_destruction_check_and_process(fe_destructible_component_t* dest_comp) {
 
         if (kinetic_energy >= dest_comp->kinetic_energy_threshold) {
             dest_comp->is_pending_destruction = true;
-            FE_LOG_WARNING("Yikim Kinetik Enerji ile tetiklendi: %.1f", kinetic_energy);
+            FE_LOG_WARN("Yikim Kinetik Enerji ile tetiklendi: %.1f", kinetic_energy);
         }
     }
 
@@ -108,7 +396,7 @@ void fe_destruction_check_and_process(fe_destructible_component_t* dest_comp) {
 
 
 // ----------------------------------------------------------------------
-// 3. YIKIM İŞLEMİ
+// 4. YIKIM İŞLEMİ
 // ----------------------------------------------------------------------
 
 /**
@@ -116,52 +404,929 @@ void fe_destruction_check_and_process(fe_destructible_component_t* dest_comp) {
  */
 void fe_destruction_perform(fe_destructible_component_t* dest_comp) {
     if (dest_comp->is_destroyed) return;
-    
-    fe_rigid_body_t* original_rb = dest_comp->target_body;
-    fe_fracture_mesh_t* fracture_data = dest_comp->fracture_data;
-
-    // 1. Orijinal Rigid Body'yi Fizik Simülasyonundan Kaldır
-    // Bu, fe_physics_manager'ın ana listesinden kaldırılması demektir.
-    fe_physics_manager_remove_rigid_body(original_rb);
-    
-    // Yıkılan objeyi görsel sistemden de kaldırılmak üzere işaretle (burada sadece is_kinematic=true yapalım)
-    original_rb->is_kinematic = true;
-    original_rb->is_awake = false; 
-
-    // 2. Her bir parçayı simülasyona enjekte et
-    size_t chunk_count = fe_array_count(fracture_data->chunks);
-    for (size_t i = 0; i < chunk_count; ++i) {
-        fe_fracture_chunk_t* chunk = (fe_fracture_chunk_t*)fe_array_get(fracture_data->chunks, i);
-        fe_rigid_body_t* chunk_rb = chunk->rigid_body;
-
-        // a. Ana cismin mevcut pozisyon ve hızını parçalara kopyala
-        chunk_rb->position = fe_vec3_add(original_rb->position, chunk_rb->position); // Pozisyonu dünya uzayına taşı
-        chunk_rb->linear_velocity = original_rb->linear_velocity;
-        chunk_rb->angular_velocity = original_rb->angular_velocity;
-        chunk_rb->orientation = original_rb->orientation;
-
-        // b. Patlama Efekti (Rastgele dağılma kuvveti/dürtüsü)
-        // Patlama merkezini orijinal cismin kütle merkezi yapalım
-        fe_vec3_t center = original_rb->position;
-        fe_vec3_t to_chunk = fe_vec3_subtract(chunk_rb->position, center);
-        
-        // Dağılma yönüne patlama dürtüsü uygula
-        float explosion_magnitude = 10.0f; // Patlama şiddeti
-        fe_vec3_t impulse_dir = fe_vec3_normalize(to_chunk);
-        fe_vec3_t impulse = fe_vec3_scale(impulse_dir, explosion_magnitude * chunk_rb->mass);
-        
-        // Hızı ayarla (Delta V = Impulse / Kütle)
-        fe_vec3_t delta_v = fe_vec3_scale(impulse, chunk_rb->inverse_mass);
-        chunk_rb->linear_velocity = fe_vec3_add(chunk_rb->linear_velocity, delta_v);
-
-        // c. Parçayı fizik simülasyonuna ekle
-        fe_physics_manager_add_rigid_body(chunk_rb);
-        chunk_rb->is_awake = true; // Uyanık başlat
-    }
-    
+
+    // Tüm bağlar kopar; patlama merkezi nesnenin merkezidir
+    for (uint32_t i = 0; i < dest_comp->fracture_data->bond_count; ++i) dest_comp->bond_health[i] = 0.0f;
+
+    fe_vec3_t center;
+    fe_vec4_t orientation;
+    fe_destruction_get_frame(dest_comp, &center, &orientation);
+    uint32_t dynamic_count = fe_destruction_update_support(dest_comp, false, center, 0.0f, dest_comp->explosion_speed);
+
     dest_comp->is_destroyed = true;
     dest_comp->is_pending_destruction = false;
-    FE_LOG_SUCCESS("Yikim tamamlandi. %zu yeni parça eklendi.", chunk_count);
-    
-    
-}
\ No newline at end of file
+    FE_LOG_INFO("Yikim tamamlandi. %u parca etkinlestirildi.", dynamic_count);
+}
+
+/**
+ * Uygulama: fe_destruction_release_chunk
+ * * Statik bir parça kaldırılırsa onun taşıdığı parçalar düşer (itme hızı verilmez).
+ */
+void fe_destruction_release_chunk(fe_destructible_component_t* dest_comp, uint32_t chunk_index) {
+    if (!dest_comp || chunk_index >= fe_array_count(dest_comp->fracture_data->chunks)) return;
+
+    uint32_t slot = dest_comp->chunk_slots[chunk_index];
+    if (slot == UINT32_MAX) return;
+
+    bool was_static = dest_comp->chunk_states[chunk_index] == FE_FRACTURE_CHUNK_STATIC;
+    fe_fracture_body_pool_release(dest_comp->body_pool, slot);
+    dest_comp->chunk_slots[chunk_index] = UINT32_MAX;
+    dest_comp->chunk_states[chunk_index] = FE_FRACTURE_CHUNK_INACTIVE;
+
+    const fe_fracture_mesh_t* fracture = dest_comp->fracture_data;
+    const fe_fracture_chunk_t* chunk = (const fe_fracture_chunk_t*)fe_array_get(fracture->chunks, chunk_index);
+    for (uint32_t k = 0; k < chunk->bond_count; ++k) dest_comp->bond_health[fracture->chunk_bonds[chunk->first_bond + k]] = 0.0f;
+
+    if (was_static) {
+        fe_destruction_update_support(dest_comp, true, (fe_vec3_t){{0.0f, 0.0f, 0.0f}}, 0.0f, 0.0f);
+    }
+}
+
+
+// ----------------------------------------------------------------------
+// 5. PARÇA CİSİM HAVUZU
+// ----------------------------------------------------------------------
+
+/**
+ * Uygulama: fe_fracture_body_pool_create
+ */
+fe_fracture_body_pool_t* fe_fracture_body_pool_create(uint32_t capacity) {
+    fe_fracture_body_pool_t* pool = (fe_fracture_body_pool_t*)fe_mem_calloc(1, sizeof(fe_fracture_body_pool_t));
+    if (!pool) {
+        FE_LOG_FATAL("Kirilma cisim havuzu icin bellek ayrilamadi.");
+        return NULL;
+    }
+    if (capacity == 0) capacity = 1;
+
+    pool->bodies = (fe_rigid_body_t**)fe_mem_calloc(capacity, sizeof(fe_rigid_body_t*));
+    pool->free_slots = (uint32_t*)fe_mem_alloc(capacity * sizeof(uint32_t));
+    pool->slot_states = (uint8_t*)fe_mem_calloc(capacity, sizeof(uint8_t));
+    if (!pool->bodies || !pool->free_slots || !pool->slot_states) {
+        FE_LOG_FATAL("Kirilma cisim havuzu icin bellek ayrilamadi.");
+        fe_fracture_body_pool_destroy(pool);
+        return NULL;
+    }
+    pool->capacity = capacity;
+
+    for (uint32_t i = 0; i < capacity; ++i) {
+        fe_rigid_body_t* rb = fe_rigid_body_create();
+        if (rb) rb->collider = fe_collider_create_box((fe_vec3_t){{0.5f, 0.5f, 0.5f}});
+        if (!rb || !rb->collider) {
+            fe_rigid_body_destroy(rb);
+            fe_fracture_body_pool_destroy(pool);
+            return NULL;
+        }
+        pool->bodies[i] = rb;
+        pool->free_slots[i] = capacity - 1 - i; // İlk alınan yuva 0 olsun
+    }
+    pool->free_count = capacity;
+
+    FE_LOG_INFO("Kirilma cisim havuzu olusturuldu (%u cisim).", capacity);
+    return pool;
+}
+
+/**
+ * Uygulama: fe_fracture_body_pool_destroy
+ */
+void fe_fracture_body_pool_destroy(fe_fracture_body_pool_t* pool) {
+    if (!pool) return;
+
+    if (pool->bodies) {
+        for (uint32_t i = 0; i < pool->capacity; ++i) {
+            if (!pool->bodies[i]) continue;
+            if (pool->slot_states[i] == FE_FRACTURE_SLOT_IN_WORLD) fe_physics_manager_remove_rigid_body(pool->bodies[i]);
+            fe_rigid_body_destroy(pool->bodies[i]);
+        }
+    }
+    fe_mem_free(pool->bodies);
+    fe_mem_free(pool->free_slots);
+    fe_mem_free(pool->slot_states);
+    fe_mem_free(pool);
+}
+
+/**
+ * Uygulama: fe_fracture_body_pool_acquire
+ */
+uint32_t fe_fracture_body_pool_acquire(fe_fracture_body_pool_t* pool) {
+    if (pool->free_count == 0) return UINT32_MAX;
+
+    uint32_t slot = pool->free_slots[--pool->free_count];
+    pool->slot_states[slot] = FE_FRACTURE_SLOT_ACQUIRED;
+    return slot;
+}
+
+/**
+ * Uygulama: fe_fracture_body_pool_release
+ */
+void fe_fracture_body_pool_release(fe_fracture_body_pool_t* pool, uint32_t slot) {
+    if (slot >= pool->capacity || pool->slot_states[slot] == FE_FRACTURE_SLOT_FREE) return;
+
+    if (pool->slot_states[slot] == FE_FRACTURE_SLOT_IN_WORLD) fe_physics_manager_remove_rigid_body(pool->bodies[slot]);
+    pool->slot_states[slot] = FE_FRACTURE_SLOT_FREE;
+    pool->free_slots[pool->free_count++] = slot;
+}
+
+
+// ----------------------------------------------------------------------
+// 6. VORONOİ KIRILMA ÜRETİCİSİ
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Kırpma sırasında tek bir hücrenin çokyüzlüsü.
+ * * Köşeler yüz yüz ardışık tutulur (komşu yüzler köşeleri tekrarlar); dışbükey kırpma için bu yeterlidir.
+ */
+typedef struct fe_fracture_poly {
+    fe_vec3_t* points;
+    uint32_t* face_start;   // face_count + 1 eleman
+    int32_t* face_site;     // -1: girdi yüzeyi, >= 0: yüzü paylaşan komşu site
+    uint32_t point_count;
+    uint32_t face_count;
+    uint32_t point_capacity;
+    uint32_t start_capacity;
+    uint32_t site_capacity;
+} fe_fracture_poly_t;
+
+/**
+ * @brief Üretim boyunca büyüyen çıktılar ve kırpma tamponları.
+ */
+typedef struct fe_fracture_builder {
+    fe_fracture_poly_t poly[2];
+    fe_vec3_t* cap;         // Kırpma düzlemi üzerindeki noktalar (kapak yüzü)
+    float* cap_angle;
+    uint32_t cap_count, cap_capacity, angle_capacity;
+
+    fe_vec3_t* positions;
+    fe_vec3_t* normals;
+    uint32_t vertex_count, position_capacity, normal_capacity;
+    uint32_t* indices;
+    uint32_t index_count, index_capacity;
+    fe_fracture_bond_t* bonds;
+    uint32_t bond_count, bond_capacity;
+
+    fe_vec3_t* plane_normals; // Hücre yüzlerinin cisim çerçevesindeki mutlak normalleri (kutu sığdırma)
+    float* plane_distances;
+    uint32_t plane_capacity, distance_capacity;
+
+    float epsilon;          // Girdi boyutuna göre düzlem toleransı
+} fe_fracture_builder_t;
+
+typedef struct fe_fracture_sort_key {
+    double key;              // Morton kodu veya uzaklığın karesi
+    uint32_t index;
+} fe_fracture_sort_key_t;
+
+static int fe_fracture_compare_keys(const void* a, const void* b) {
+    double ka = ((const fe_fracture_sort_key_t*)a)->key, kb = ((const fe_fracture_sort_key_t*)b)->key;
+    return (ka > kb) - (ka < kb);
+}
+
+/**
+ * @brief Diziyi en az required elemanlık kapasiteye büyütür (ikiye katlayarak).
+ */
+static bool fe_fracture_grow(void** data, uint32_t* capacity, uint32_t required, size_t element_size) {
+    if (required <= *capacity) return true;
+
+    uint32_t new_capacity = *capacity ? *capacity : 64;
+    while (new_capacity < required) new_capacity *= 2;
+    void* grown = fe_mem_realloc(*data, new_capacity * element_size);
+    if (!grown) return false;
+    *data = grown;
+    *capacity = new_capacity;
+    return true;
+}
+
+static void fe_fracture_poly_free(fe_fracture_poly_t* poly) {
+    fe_mem_free(poly->points);
+    fe_mem_free(poly->face_start);
+    fe_mem_free(poly->face_site);
+}
+
+/**
+ * @brief xorshift32; [0, 1) aralığında sayı döndürür.
+ */
+static inline float fe_fracture_random(uint32_t* state) {
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return (float)(x >> 8) * (1.0f / 16777216.0f);
+}
+
+/**
+ * @brief 10 bitlik koordinatın bitlerini üçer aralıkla yayar (Morton kodu için).
+ */
+static inline uint32_t fe_fracture_spread_bits(uint32_t v) {
+    v = (v | (v << 16)) & 0x030000FFu;
+    v = (v | (v << 8)) & 0x0300F00Fu;
+    v = (v | (v << 4)) & 0x030C30C3u;
+    v = (v | (v << 2)) & 0x09249249u;
+    return v;
+}
+
+/**
+ * @brief Nokta dışbükey meshin içinde mi? (Tüm yüz düzlemlerinin arkasında.)
+ */
+static bool fe_fracture_is_inside(const fe_vec3_t* positions, const uint32_t* indices, uint32_t index_count, fe_vec3_t p, float epsilon) {
+    for (uint32_t t = 0; t < index_count; t += 3) {
+        fe_vec3_t a = positions[indices[t]];
+        fe_vec3_t n = fe_vec3_cross(fe_vec3_subtract(positions[indices[t + 1]], a), fe_vec3_subtract(positions[indices[t + 2]], a));
+        float length = fe_vec3_length(n);
+        if (length <= 0.0f) continue;
+        if (fe_vec3_dot(n, fe_vec3_subtract(p, a)) > -epsilon * length) return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Çokyüzlüyü n.x <= d yarı uzayıyla kırpar (Sutherland-Hodgman, yüz yüz).
+ * * Düzlem üzerinde kalan ve kenar kesişiminden çıkan noktalar kapak yüzünü oluşturur; kapak
+ * * noktaları düzlemde açıya göre sıralanır (n etrafında CCW, yani hücrenin dışına bakar).
+ * @return 1: kırpıldı (sonuç out'ta; hücre tümüyle dışarıdaysa face_count = 0), 0: değişmedi, -1: bellek hatası.
+ */
+static int fe_fracture_clip(fe_fracture_builder_t* b, const fe_fracture_poly_t* in, fe_fracture_poly_t* out,
+                            fe_vec3_t n, float d, int32_t site) {
+    float eps = b->epsilon;
+
+    bool any_outside = false;
+    for (uint32_t i = 0; i < in->point_count; ++i) {
+        if (fe_vec3_dot(n, in->points[i]) - d > eps) { any_outside = true; break; }
+    }
+    if (!any_outside) return 0;
+
+    out->point_count = 0;
+    out->face_count = 0;
+    b->cap_count = 0;
+    for (uint32_t f = 0; f < in->face_count; ++f) {
+        uint32_t begin = in->face_start[f], count = in->face_start[f + 1] - begin;
+
+        // Her kenar en fazla iki nokta üretir
+        if (!fe_fracture_grow((void**)&out->points, &out->point_capacity, out->point_count + 2 * count, sizeof(fe_vec3_t)) ||
+            !fe_fracture_grow((void**)&out->face_start, &out->start_capacity, out->face_count + 2, sizeof(uint32_t)) ||
+            !fe_fracture_grow((void**)&out->face_site, &out->site_capacity, out->face_count + 2, sizeof(int32_t)) ||
+            !fe_fracture_grow((void**)&b->cap, &b->cap_capacity, b->cap_count + 2 * count, sizeof(fe_vec3_t))) {
+            return -1;
+        }
+
+        uint32_t start = out->point_count;
+        for (uint32_t k = 0; k < count; ++k) {
+            fe_vec3_t pa = in->points[begin + k];
+            fe_vec3_t pb = in->points[begin + (k + 1) % count];
+            float da = fe_vec3_dot(n, pa) - d;
+            float db = fe_vec3_dot(n, pb) - d;
+
+            if (da <= eps) {
+                out->points[out->point_count++] = pa;
+                if (da >= -eps) b->cap[b->cap_count++] = pa;
+            }
+            if ((da < -eps && db > eps) || (da > eps && db < -eps)) {
+                fe_vec3_t p = fe_vec3_add(pa, fe_vec3_scale(fe_vec3_subtract(pb, pa), da / (da - db)));
+                out->points[out->point_count++] = p;
+                b->cap[b->cap_count++] = p;
+            }
+        }
+
+        if (out->point_count - start >= 3) {
+            out->face_start[out->face_count] = start;
+            out->face_site[out->face_count] = in->face_site[f];
+            out->face_count++;
+        } else {
+            out->point_count = start;
+        }
+    }
+    out->face_start[out->face_count] = out->point_count;
+    if (out->face_count == 0) return 1;
+
+    // Kapak: tekrarlanan noktaları birleştir, düzlemde açıya göre sırala
+    float merge_sq = 16.0f * eps * eps;
+    uint32_t unique = 0;
+    for (uint32_t i = 0; i < b->cap_count; ++i) {
+        bool duplicate = false;
+        for (uint32_t j = 0; j < unique && !duplicate; ++j) {
+            duplicate = fe_vec3_length_sq(fe_vec3_subtract(b->cap[i], b->cap[j])) <= merge_sq;
+        }
+        if (!duplicate) b->cap[unique++] = b->cap[i];
+    }
+    if (unique < 3) return 1;
+
+    if (!fe_fracture_grow((void**)&b->cap_angle, &b->angle_capacity, unique, sizeof(float)) ||
+        !fe_fracture_grow((void**)&out->points, &out->point_capacity, out->point_count + unique, sizeof(fe_vec3_t))) {
+        return -1;
+    }
+
+    fe_vec3_t center = {{0.0f, 0.0f, 0.0f}};
+    for (uint32_t i = 0; i < unique; ++i) center = fe_vec3_add(center, b->cap[i]);
+    center = fe_vec3_scale(center, 1.0f / (float)unique);
+
+    fe_vec3_t u = fe_vec3_normalize(fe_vec3_subtract(b->cap[0], center));
+    fe_vec3_t v = fe_vec3_cross(n, u);
+    for (uint32_t i = 0; i < unique; ++i) {
+        fe_vec3_t r = fe_vec3_subtract(b->cap[i], center);
+        float angle = atan2f(fe_vec3_dot(r, v), fe_vec3_dot(r, u));
+
+        // Eklemeli sıralama (kapaklar birkaç düzine noktadan azdır)
+        fe_vec3_t p = b->cap[i];
+        uint32_t j = i;
+        for (; j > 0 && b->cap_angle[j - 1] > angle; --j) {
+            b->cap_angle[j] = b->cap_angle[j - 1];
+            b->cap[j] = b->cap[j - 1];
+        }
+        b->cap_angle[j] = angle;
+        b->cap[j] = p;
+    }
+
+    uint32_t start = out->point_count;
+    for (uint32_t i = 0; i < unique; ++i) out->points[out->point_count++] = b->cap[i];
+    out->face_start[out->face_count] = start;
+    out->face_site[out->face_count] = site;
+    out->face_count++;
+    out->face_start[out->face_count] = out->point_count;
+    return 1;
+}
+
+/**
+ * @brief Simetrik 3x3 matrisi Jacobi dönmeleriyle köşegenleştirir.
+ * * Çıkışta a köşegendir (özdeğerler); v'nin sütunları özvektörlerdir.
+ */
+static void fe_fracture_jacobi(double a[3][3], double v[3][3]) {
+    for (int i = 0; i < 3; ++i) for (int j = 0; j < 3; ++j) v[i][j] = (i == j) ? 1.0 : 0.0;
+
+    for (int sweep = 0; sweep < 32; ++sweep) {
+        double off = a[0][1] * a[0][1] + a[0][2] * a[0][2] + a[1][2] * a[1][2];
+        double diag = a[0][0] * a[0][0] + a[1][1] * a[1][1] + a[2][2] * a[2][2];
+        if (off <= 1e-24 * diag) break;
+
+        for (int p = 0; p < 2; ++p) {
+            for (int q = p + 1; q < 3; ++q) {
+                if (fabs(a[p][q]) <= 1e-30) continue;
+                double theta = (a[q][q] - a[p][p]) / (2.0 * a[p][q]);
+                double t = (theta >= 0.0 ? 1.0 : -1.0) / (fabs(theta) + sqrt(theta * theta + 1.0));
+                double c = 1.0 / sqrt(t * t + 1.0), s = t * c;
+
+                for (int k = 0; k < 3; ++k) {
+                    double akp = a[k][p], akq = a[k][q];
+                    a[k][p] = c * akp - s * akq;
+                    a[k][q] = s * akp + c * akq;
+                }
+                for (int k = 0; k < 3; ++k) {
+                    double apk = a[p][k], aqk = a[q][k];
+                    a[p][k] = c * apk - s * aqk;
+                    a[q][k] = s * apk + c * aqk;
+                }
+                for (int k = 0; k < 3; ++k) {
+                    double vkp = v[k][p], vkq = v[k][q];
+                    v[k][p] = c * vkp - s * vkq;
+                    v[k][q] = s * vkp + c * vkq;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Dönüş matrisinden (sütunlar: yerel eksenler) birim kuaterniyon.
+ */
+static fe_vec4_t fe_fracture_matrix_to_quat(double r[3][3]) {
+    double trace = r[0][0] + r[1][1] + r[2][2];
+    double x, y, z, w;
+    if (trace > 0.0) {
+        double s = sqrt(trace + 1.0) * 2.0;
+        w = 0.25 * s; x = (r[2][1] - r[1][2]) / s; y = (r[0][2] - r[2][0]) / s; z = (r[1][0] - r[0][1]) / s;
+    } else if (r[0][0] > r[1][1] && r[0][0] > r[2][2]) {
+        double s = sqrt(1.0 + r[0][0] - r[1][1] - r[2][2]) * 2.0;
+        w = (r[2][1] - r[1][2]) / s; x = 0.25 * s; y = (r[0][1] + r[1][0]) / s; z = (r[0][2] + r[2][0]) / s;
+    } else if (r[1][1] > r[2][2]) {
+        double s = sqrt(1.0 + r[1][1] - r[0][0] - r[2][2]) * 2.0;
+        w = (r[0][2] - r[2][0]) / s; x = (r[0][1] + r[1][0]) / s; y = 0.25 * s; z = (r[1][2] + r[2][1]) / s;
+    } else {
+        double s = sqrt(1.0 + r[2][2] - r[0][0] - r[1][1]) * 2.0;
+        w = (r[1][0] - r[0][1]) / s; x = (r[0][2] + r[2][0]) / s; y = (r[1][2] + r[2][1]) / s; z = 0.25 * s;
+    }
+    double length = sqrt(x * x + y * y + z * z + w * w);
+    return (fe_vec4_t){{ (float)(x / length), (float)(y / length), (float)(z / length), (float)(w / length) }};
+}
+
+/**
+ * @brief Merkezi offset'te, yarı boyutları h olan kutunun (asal eksenlerde) hücreye sığması için en büyük çarpan.
+ * * Düzlemler cisim çerçevesindedir: n . x <= mesafe. Çarpan offset'e göre içbükeydir (afin fonksiyonların minimumu).
+ */
+static float fe_fracture_box_fit(const fe_fracture_builder_t* b, uint32_t plane_count, fe_vec3_t offset, fe_vec3_t h) {
+    float fit = INFINITY;
+    for (uint32_t f = 0; f < plane_count; ++f) {
+        fe_vec3_t n = b->plane_normals[f];
+        float support = fabsf(n.x) * h.x + fabsf(n.y) * h.y + fabsf(n.z) * h.z;
+        if (support > 0.0f) fit = fminf(fit, (b->plane_distances[f] - fe_vec3_dot(n, offset)) / support);
+    }
+    return fit;
+}
+
+/**
+ * @brief Verilen merkezde eşdeğer kutunun eksen oranlarını 2^(-1.5 .. 1.5) aralığında tarar; en büyük hacimli sığan kutuyu döndürür.
+ */
+static fe_vec3_t fe_fracture_best_box_shape(const fe_fracture_builder_t* b, uint32_t plane_count, fe_vec3_t offset, fe_vec3_t box) {
+    fe_vec3_t best = {{0.0f, 0.0f, 0.0f}};
+    float best_volume = -1.0f;
+    for (int i = -6; i <= 6; ++i) {
+        for (int j = -6; j <= 6; ++j) {
+            fe_vec3_t shape = {{ box.x * exp2f(0.25f * (float)i), box.y * exp2f(0.25f * (float)j), box.z }};
+            fe_vec3_t candidate = fe_vec3_scale(shape, fmaxf(fe_fracture_box_fit(b, plane_count, offset, shape), 0.0f));
+            float volume = candidate.x * candidate.y * candidate.z;
+            if (volume > best_volume) { best = shape; best_volume = volume; }
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Kırpılmış hücreden parçayı üretir: kütle özellikleri, cisim çerçevesindeki geometri ve
+ * * komşu hücrelerle bağlar (sadece site > chunk_index olan yüzler; bağlar chunk_a'ya göre sıralı çıkar).
+ * * Kütle özellikleri, site merkezli tetrahedronların toplamıdır; kovaryans
+ * * C = det / 120 * (aa^T + bb^T + cc^T + (a+b+c)(a+b+c)^T).
+ * @return Hücre hacimsizse veya bellek yetmezse false.
+ */
+static bool fe_fracture_emit_chunk(fe_fracture_builder_t* b, const fe_fracture_poly_t* cell, fe_vec3_t site, uint32_t chunk_index,
+                                   const fe_fracture_settings_t* settings, float support_y, fe_fracture_chunk_t* out, fe_aabb_t* out_bounds) {
+    // A. Hacim, kütle merkezi ve ikinci moment (site'a göre)
+    double volume = 0.0, first[3] = {0.0, 0.0, 0.0}, second[3][3] = {{0.0}};
+    for (uint32_t f = 0; f < cell->face_count; ++f) {
+        uint32_t begin = cell->face_start[f], count = cell->face_start[f + 1] - begin;
+        fe_vec3_t a = fe_vec3_subtract(cell->points[begin], site);
+        for (uint32_t k = 1; k + 1 < count; ++k) {
+            fe_vec3_t bb = fe_vec3_subtract(cell->points[begin + k], site);
+            fe_vec3_t c = fe_vec3_subtract(cell->points[begin + k + 1], site);
+            double det = fe_vec3_dot(a, fe_vec3_cross(bb, c));
+            fe_vec3_t sum = fe_vec3_add(fe_vec3_add(a, bb), c);
+
+            volume += det / 6.0;
+            for (int r = 0; r < 3; ++r) {
+                first[r] += det / 24.0 * sum.v[r];
+                for (int q = 0; q < 3; ++q) {
+                    second[r][q] += det / 120.0 * ((double)a.v[r] * a.v[q] + (double)bb.v[r] * bb.v[q] + (double)c.v[r] * c.v[q] + (double)sum.v[r] * sum.v[q]);
+                }
+            }
+        }
+    }
+    if (volume <= 1e-12) return false;
+
+    // B. Kütle merkezine taşı, eylemsizlik tensörü I = tr(C) * 1 - C
+    double cm[3] = { first[0] / volume, first[1] / volume, first[2] / volume };
+    double density = settings->density;
+    double inertia[3][3];
+    for (int r = 0; r < 3; ++r) {
+        for (int q = 0; q < 3; ++q) second[r][q] = density * (second[r][q] - volume * cm[r] * cm[q]);
+    }
+    double trace = second[0][0] + second[1][1] + second[2][2];
+    for (int r = 0; r < 3; ++r) {
+        for (int q = 0; q < 3; ++q) inertia[r][q] = (r == q ? trace : 0.0) - second[r][q];
+    }
+
+    // C. Asal eksenler (sağ elli) cisim çerçevesidir
+    double axes[3][3];
+    fe_fracture_jacobi(inertia, axes);
+    double det_axes = axes[0][0] * (axes[1][1] * axes[2][2] - axes[1][2] * axes[2][1])
+                    - axes[0][1] * (axes[1][0] * axes[2][2] - axes[1][2] * axes[2][0])
+                    + axes[0][2] * (axes[1][0] * axes[2][1] - axes[1][1] * axes[2][0]);
+    if (det_axes < 0.0) {
+        for (int r = 0; r < 3; ++r) axes[r][2] = -axes[r][2];
+    }
+
+    float mass = (float)(density * volume);
+    fe_vec3_t principal = {{ (float)inertia[0][0], (float)inertia[1][1], (float)inertia[2][2] }};
+    fe_vec3_t center = fe_vec3_add(site, (fe_vec3_t){{ (float)cm[0], (float)cm[1], (float)cm[2] }});
+
+    out->mesh_id = 0;
+    out->center = center;
+    out->orientation = fe_fracture_matrix_to_quat(axes);
+    out->principal_inertia = principal;
+    out->volume = (float)volume;
+    out->mass = mass;
+    out->is_support = false;
+
+    // Aynı eylemsizliğe sahip kutu: I_x = m/3 * (hy^2 + hz^2) ...
+    float scale = 1.5f / mass;
+    float hx = sqrtf(fmaxf(scale * (principal.y + principal.z - principal.x), 0.0f));
+    float hy = sqrtf(fmaxf(scale * (principal.x + principal.z - principal.y), 0.0f));
+    float hz = sqrtf(fmaxf(scale * (principal.x + principal.y - principal.z), 0.0f));
+    float min_half = 0.05f * cbrtf((float)volume);
+    fe_vec3_t box = {{ fmaxf(hx, min_half), fmaxf(hy, min_half), fmaxf(hz, min_half) }};
+
+    // Çarpışma kutusu hücrenin içine sığdırılır: komşu parçaların kutuları başlangıçta örtüşmez ve
+    // kırılma karesinde çözücü iç içe geçmiş yüzlerce kutuyu birbirinden ayırmaya çalışmaz
+    fe_vec3_t rows[3];
+    fe_physics_quat_to_rows(out->orientation, rows);
+    if (!fe_fracture_grow((void**)&b->plane_normals, &b->plane_capacity, cell->face_count, sizeof(fe_vec3_t)) ||
+        !fe_fracture_grow((void**)&b->plane_distances, &b->distance_capacity, cell->face_count, sizeof(float))) {
+        return false;
+    }
+    uint32_t plane_count = 0;
+    float reach = 0.0f;
+    for (uint32_t f = 0; f < cell->face_count; ++f) {
+        uint32_t begin = cell->face_start[f], count = cell->face_start[f + 1] - begin;
+        fe_vec3_t normal = {{0.0f, 0.0f, 0.0f}};
+        for (uint32_t k = 0; k < count; ++k) reach = fmaxf(reach, fe_vec3_length(fe_vec3_subtract(cell->points[begin + k], center)));
+        for (uint32_t k = 0; k < count; ++k) normal = fe_vec3_add(normal, fe_vec3_cross(cell->points[begin + k], cell->points[begin + (k + 1) % count]));
+        float length = fe_vec3_length(normal);
+        if (length <= 0.0f) continue;
+        normal = fe_vec3_scale(normal, 1.0f / length);
+
+        b->plane_normals[plane_count] = fe_destruction_unrotate(rows, normal);
+        b->plane_distances[plane_count] = fe_vec3_dot(normal, fe_vec3_subtract(cell->points[begin], center));
+        plane_count++;
+    }
+
+    // A. Eksen oranları taranır, sonra kutunun merkezi her eksende altın oran aramasıyla kaydırılır
+    // (çarpan merkeze göre içbükey); iki tur yeterince yakınsar
+    fe_vec3_t box_offset = {{0.0f, 0.0f, 0.0f}};
+    fe_vec3_t shape = box;
+    for (int round = 0; round < 2; ++round) {
+        shape = fe_fracture_best_box_shape(b, plane_count, box_offset, box);
+        for (int sweep = 0; sweep < 1; ++sweep) {
+            for (int axis = 0; axis < 3; ++axis) {
+                const float golden = 0.618034f;
+                float lo = box_offset.v[axis] - reach, hi = box_offset.v[axis] + reach;
+                fe_vec3_t p = box_offset, q = box_offset;
+                for (int iteration = 0; iteration < 16; ++iteration) {
+                    p.v[axis] = hi - golden * (hi - lo);
+                    q.v[axis] = lo + golden * (hi - lo);
+                    if (fe_fracture_box_fit(b, plane_count, p, shape) < fe_fracture_box_fit(b, plane_count, q, shape)) lo = p.v[axis];
+                    else hi = q.v[axis];
+                }
+                fe_vec3_t moved = box_offset;
+                moved.v[axis] = 0.5f * (lo + hi);
+                if (fe_fracture_box_fit(b, plane_count, moved, shape) > fe_fracture_box_fit(b, plane_count, box_offset, shape)) box_offset = moved;
+            }
+        }
+    }
+    fe_vec3_t best = fe_vec3_scale(shape, fmaxf(fe_fracture_box_fit(b, plane_count, box_offset, shape), 0.0f));
+
+    // B. Her eksen, diğerleri sabitken yüz düzlemlerine dayanana kadar büyütülür (|n| . h <= mesafe - n . offset)
+    for (int axis = 0; axis < 3; ++axis) {
+        float limit = INFINITY;
+        for (uint32_t f = 0; f < plane_count; ++f) {
+            fe_vec3_t n = b->plane_normals[f];
+            fe_vec3_t abs_n = {{ fabsf(n.x), fabsf(n.y), fabsf(n.z) }};
+            if (abs_n.v[axis] <= 1e-6f) continue;
+            float rest = fe_vec3_dot(abs_n, best) - abs_n.v[axis] * best.v[axis];
+            limit = fminf(limit, fmaxf(b->plane_distances[f] - fe_vec3_dot(n, box_offset) - rest, 0.0f) / abs_n.v[axis]);
+        }
+        if (limit < INFINITY) best.v[axis] = fmaxf(best.v[axis], limit);
+    }
+    out->collider_offset = box_offset;
+
+    float min_extent = 0.1f * min_half;
+    out->half_extents = (fe_vec3_t){{
+        fmaxf(best.x * settings->collider_scale, min_extent),
+        fmaxf(best.y * settings->collider_scale, min_extent),
+        fmaxf(best.z * settings->collider_scale, min_extent)
+    }};
+
+    // D. Geometri: önce dış yüzeyler, sonra kırılma yüzeyleri; yüzler üçgen yelpazesine bölünür
+
+    out->first_vertex = b->vertex_count;
+    out->first_index = b->index_count;
+    out->radius = 0.0f;
+    out_bounds->min = out_bounds->max = cell->points[0];
+    for (int pass = 0; pass < 2; ++pass) {
+        if (pass == 1) out->surface_index_count = b->index_count - out->first_index;
+
+        for (uint32_t f = 0; f < cell->face_count; ++f) {
+            int32_t neighbour = cell->face_site[f];
+            if ((pass == 0) != (neighbour < 0)) continue;
+
+            uint32_t begin = cell->face_start[f], count = cell->face_start[f + 1] - begin;
+
+            // Newell normali; uzunluğunun yarısı yüz alanıdır
+            fe_vec3_t normal = {{0.0f, 0.0f, 0.0f}};
+            fe_vec3_t face_center = {{0.0f, 0.0f, 0.0f}};
+            for (uint32_t k = 0; k < count; ++k) {
+                fe_vec3_t p = fe_vec3_subtract(cell->points[begin + k], center);
+                fe_vec3_t q = fe_vec3_subtract(cell->points[begin + (k + 1) % count], center);
+                normal = fe_vec3_add(normal, fe_vec3_cross(p, q));
+                face_center = fe_vec3_add(face_center, cell->points[begin + k]);
+            }
+            float area = 0.5f * fe_vec3_length(normal);
+            if (area <= b->epsilon * b->epsilon) continue;
+            normal = fe_vec3_scale(normal, 0.5f / area);
+
+            if (neighbour > (int32_t)chunk_index) {
+                if (!fe_fracture_grow((void**)&b->bonds, &b->bond_capacity, b->bond_count + 1, sizeof(fe_fracture_bond_t))) return false;
+                b->bonds[b->bond_count++] = (fe_fracture_bond_t){ chunk_index, (uint32_t)neighbour, fe_vec3_scale(face_center, 1.0f / (float)count), area };
+            }
+
+            uint32_t vertex_base = b->vertex_count;
+            if (!fe_fracture_grow((void**)&b->positions, &b->position_capacity, vertex_base + count, sizeof(fe_vec3_t)) ||
+                !fe_fracture_grow((void**)&b->normals, &b->normal_capacity, vertex_base + count, sizeof(fe_vec3_t)) ||
+                !fe_fracture_grow((void**)&b->indices, &b->index_capacity, b->index_count + 3 * (count - 2), sizeof(uint32_t))) {
+                return false;
+            }
+
+            fe_vec3_t local_normal = fe_destruction_unrotate(rows, normal);
+            for (uint32_t k = 0; k < count; ++k) {
+                fe_vec3_t p = cell->points[begin + k];
+                fe_vec3_t offset = fe_vec3_subtract(p, center);
+                b->positions[b->vertex_count] = fe_destruction_unrotate(rows, offset);
+                b->normals[b->vertex_count] = local_normal;
+                b->vertex_count++;
+
+                out->radius = fmaxf(out->radius, fe_vec3_length(offset));
+                for (int axis = 0; axis < 3; ++axis) {
+                    out_bounds->min.v[axis] = fminf(out_bounds->min.v[axis], p.v[axis]);
+                    out_bounds->max.v[axis] = fmaxf(out_bounds->max.v[axis], p.v[axis]);
+                }
+                if (p.y <= support_y) out->is_support = true;
+            }
+            for (uint32_t k = 1; k + 1 < count; ++k) {
+                b->indices[b->index_count++] = vertex_base - out->first_vertex;
+                b->indices[b->index_count++] = vertex_base - out->first_vertex + k;
+                b->indices[b->index_count++] = vertex_base - out->first_vertex + k + 1;
+            }
+        }
+    }
+    out->vertex_count = b->vertex_count - out->first_vertex;
+    out->index_count = b->index_count - out->first_index;
+    return true;
+}
+
+/**
+ * Uygulama: fe_fracture_create_default_settings
+ */
+fe_fracture_settings_t fe_fracture_create_default_settings(void) {
+    fe_fracture_settings_t settings;
+    settings.site_count = 64;
+    settings.seed = 1;
+    settings.density = 2400.0f;       // Beton
+    settings.collider_scale = 0.9f;
+    settings.anchor_height = 0.0f;
+    settings.cluster_size = 16;
+    return settings;
+}
+
+/**
+ * Uygulama: fe_fracture_voronoi
+ * * Her hücre için diğer siteler uzaklığa göre sıralanır; ikiortay düzlemi hücrenin en uzak
+ * * köşesinden daha uzaktaysa sonraki siteler hücreyi kesemez ve kırpma durur.
+ */
+fe_fracture_mesh_t* fe_fracture_voronoi(const fe_vec3_t* positions, uint32_t vertex_count,
+                                        const uint32_t* indices, uint32_t index_count,
+                                        const fe_vec3_t* sites, uint32_t site_count,
+                                        const fe_fracture_settings_t* settings) {
+    static uint32_t next_fracture_id = 1;
+
+    if (!positions || !indices || !settings || vertex_count < 4 || index_count < 12 || index_count % 3 != 0) {
+        FE_LOG_ERROR("Voronoi kirilma icin kapali bir ucgen mesh gereklidir.");
+        return NULL;
+    }
+    for (uint32_t i = 0; i < index_count; ++i) {
+        if (indices[i] >= vertex_count) {
+            FE_LOG_ERROR("Voronoi kirilma: gecersiz indeks %u.", indices[i]);
+            return NULL;
+        }
+    }
+
+    // A. Girdi sınırları ve tolerans
+    fe_aabb_t bounds = { positions[0], positions[0] };
+    for (uint32_t i = 1; i < vertex_count; ++i) {
+        for (int axis = 0; axis < 3; ++axis) {
+            bounds.min.v[axis] = fminf(bounds.min.v[axis], positions[i].v[axis]);
+            bounds.max.v[axis] = fmaxf(bounds.max.v[axis], positions[i].v[axis]);
+        }
+    }
+    fe_vec3_t extent = fe_vec3_subtract(bounds.max, bounds.min);
+    float size = fmaxf(extent.x, fmaxf(extent.y, extent.z));
+    if (size <= 0.0f) return NULL;
+
+    fe_fracture_builder_t builder = {0};
+    builder.epsilon = 1e-5f * size;
+
+    // B. Siteler: verilenlerin içeride olanları ya da rastgele üretilenler
+    uint32_t wanted = sites ? site_count : settings->site_count;
+    fe_vec3_t* cell_sites = (fe_vec3_t*)fe_mem_alloc((wanted ? wanted : 1) * sizeof(fe_vec3_t));
+    fe_fracture_sort_key_t* keys = (fe_fracture_sort_key_t*)fe_mem_alloc((wanted ? wanted : 1) * sizeof(fe_fracture_sort_key_t));
+    if (!cell_sites || !keys) {
+        fe_mem_free(cell_sites);
+        fe_mem_free(keys);
+        return NULL;
+    }
+
+    uint32_t count = 0;
+    if (sites) {
+        for (uint32_t i = 0; i < site_count; ++i) {
+            if (fe_fracture_is_inside(positions, indices, index_count, sites[i], builder.epsilon)) cell_sites[count++] = sites[i];
+        }
+        if (count < site_count) FE_LOG_WARN("Voronoi kirilma: %u site meshin disinda, yok sayildi.", site_count - count);
+    } else {
+        uint32_t state = settings->seed ^ 0x9E3779B9u;
+        if (!state) state = 1u; // xorshift sıfırda takılır
+        for (uint32_t attempt = 0; attempt < 64u * wanted && count < wanted; ++attempt) {
+            fe_vec3_t p = {{
+                bounds.min.x + extent.x * fe_fracture_random(&state),
+                bounds.min.y + extent.y * fe_fracture_random(&state),
+                bounds.min.z + extent.z * fe_fracture_random(&state)
+            }};
+            if (fe_fracture_is_inside(positions, indices, index_count, p, builder.epsilon)) cell_sites[count++] = p;
+        }
+    }
+
+    // Morton sırası: yakın hücreler ardışık parçalar olur (kümeler ve bellek yerelliği)
+    for (uint32_t i = 0; i < count; ++i) {
+        uint32_t code = 0;
+        for (int axis = 0; axis < 3; ++axis) {
+            float t = extent.v[axis] > 0.0f ? (cell_sites[i].v[axis] - bounds.min.v[axis]) / extent.v[axis] : 0.0f;
+            uint32_t q = (uint32_t)fminf(fmaxf(t * 1023.0f, 0.0f), 1023.0f);
+            code |= fe_fracture_spread_bits(q) << axis;
+        }
+        keys[i] = (fe_fracture_sort_key_t){ (double)code, i };
+    }
+    qsort(keys, count, sizeof(fe_fracture_sort_key_t), fe_fracture_compare_keys);
+
+    // Aynı konumdaki siteler tek hücreye iner
+    float merge_sq = 16.0f * builder.epsilon * builder.epsilon;
+    fe_vec3_t* sorted_sites = (fe_vec3_t*)fe_mem_alloc((count ? count : 1) * sizeof(fe_vec3_t));
+    uint32_t unique = 0;
+    if (sorted_sites) {
+        for (uint32_t i = 0; i < count; ++i) {
+            fe_vec3_t p = cell_sites[keys[i].index];
+            bool duplicate = false;
+            for (uint32_t j = 0; j < unique && !duplicate; ++j) duplicate = fe_vec3_length_sq(fe_vec3_subtract(p, sorted_sites[j])) <= merge_sq;
+            if (!duplicate) sorted_sites[unique++] = p;
+        }
+    }
+    fe_mem_free(cell_sites);
+    cell_sites = sorted_sites;
+    count = unique;
+
+    fe_fracture_mesh_t* fracture = (fe_fracture_mesh_t*)fe_mem_calloc(1, sizeof(fe_fracture_mesh_t));
+    fe_aabb_t* chunk_bounds = (fe_aabb_t*)fe_mem_alloc((count ? count : 1) * sizeof(fe_aabb_t));
+    fe_fracture_poly_t* base = &builder.poly[0];
+    bool ok = cell_sites && fracture && chunk_bounds && count > 0;
+    if (ok) {
+        fracture->chunks = fe_array_create(sizeof(fe_fracture_chunk_t));
+        ok = fracture->chunks != NULL;
+    }
+
+    // C. Girdi çokyüzlüsü: her üçgen bir yüz
+    fe_fracture_poly_t input = {0};
+    if (ok) {
+        ok = fe_fracture_grow((void**)&input.points, &input.point_capacity, index_count, sizeof(fe_vec3_t)) &&
+             fe_fracture_grow((void**)&input.face_start, &input.start_capacity, index_count / 3 + 1, sizeof(uint32_t)) &&
+             fe_fracture_grow((void**)&input.face_site, &input.site_capacity, index_count / 3 + 1, sizeof(int32_t));
+    }
+    if (ok) {
+        for (uint32_t t = 0; t < index_count; t += 3) {
+            input.face_start[input.face_count] = input.point_count;
+            input.face_site[input.face_count] = -1;
+            input.face_count++;
+            for (int k = 0; k < 3; ++k) input.points[input.point_count++] = positions[indices[t + k]];
+        }
+        input.face_start[input.face_count] = input.point_count;
+    }
+
+    // D. Hücreler
+    float support_y = (settings->anchor_height > 0.0f) ? bounds.min.y + settings->anchor_height : -INFINITY;
+    for (uint32_t i = 0; ok && i < count; ++i) {
+        fe_vec3_t site = cell_sites[i];
+
+        // Girdiyi kopyala
+        ok = fe_fracture_grow((void**)&base->points, &base->point_capacity, input.point_count, sizeof(fe_vec3_t)) &&
+             fe_fracture_grow((void**)&base->face_start, &base->start_capacity, input.face_count + 1, sizeof(uint32_t)) &&
+             fe_fracture_grow((void**)&base->face_site, &base->site_capacity, input.face_count + 1, sizeof(int32_t));
+        if (!ok) break;
+        for (uint32_t k = 0; k < input.point_count; ++k) base->points[k] = input.points[k];
+        for (uint32_t k = 0; k <= input.face_count; ++k) base->face_start[k] = input.face_start[k];
+        for (uint32_t k = 0; k < input.face_count; ++k) base->face_site[k] = -1;
+        base->point_count = input.point_count;
+        base->face_count = input.face_count;
+
+        // Diğer siteleri uzaklığa göre sırala
+        for (uint32_t j = 0; j < count; ++j) keys[j] = (fe_fracture_sort_key_t){ fe_vec3_length_sq(fe_vec3_subtract(cell_sites[j], site)), j };
+        qsort(keys, count, sizeof(fe_fracture_sort_key_t), fe_fracture_compare_keys);
+
+        fe_fracture_poly_t* cell = base;
+        fe_fracture_poly_t* spare = &builder.poly[1];
+        float radius_sq = 0.0f;
+        for (uint32_t k = 0; k < cell->point_count; ++k) radius_sq = fmaxf(radius_sq, fe_vec3_length_sq(fe_vec3_subtract(cell->points[k], site)));
+
+        for (uint32_t k = 1; k < count; ++k) {
+            if (0.25f * keys[k].key > radius_sq) break; // İkiortay hücreye ulaşamaz
+
+            fe_vec3_t other = cell_sites[keys[k].index];
+            fe_vec3_t n = fe_vec3_normalize(fe_vec3_subtract(other, site));
+            float d = fe_vec3_dot(n, fe_vec3_scale(fe_vec3_add(site, other), 0.5f));
+
+            int result = fe_fracture_clip(&builder, cell, spare, n, d, (int32_t)keys[k].index);
+            if (result < 0) { ok = false; break; }
+            if (result == 0) continue;
+
+            fe_fracture_poly_t* swap = cell; cell = spare; spare = swap;
+            if (cell->face_count == 0) break;
+
+            radius_sq = 0.0f;
+            for (uint32_t p = 0; p < cell->point_count; ++p) radius_sq = fmaxf(radius_sq, fe_vec3_length_sq(fe_vec3_subtract(cell->points[p], site)));
+        }
+        if (!ok) break;
+
+        fe_fracture_chunk_t chunk = {0};
+        if (cell->face_count == 0 || !fe_fracture_emit_chunk(&builder, cell, site, i, settings, support_y, &chunk, &chunk_bounds[i])) {
+            FE_LOG_ERROR("Voronoi kirilma: %u. hucre uretilemedi.", i);
+            ok = false;
+            break;
+        }
+        fracture->total_mass += chunk.mass;
+        ok = fe_array_push(fracture->chunks, &chunk);
+    }
+
+    // E. Bağ grafiği (parça başına bağ listesi) ve kümeler
+    if (ok) {
+        fracture->chunk_bonds = (uint32_t*)fe_mem_alloc((builder.bond_count ? 2 * builder.bond_count : 1) * sizeof(uint32_t));
+        uint32_t cluster_size = settings->cluster_size ? settings->cluster_size : 16;
+        fracture->cluster_count = (count + cluster_size - 1) / cluster_size;
+        fracture->clusters = (fe_fracture_cluster_t*)fe_mem_calloc(fracture->cluster_count, sizeof(fe_fracture_cluster_t));
+        ok = fracture->chunk_bonds && fracture->clusters;
+
+        if (ok) {
+            fe_fracture_chunk_t* chunks = (fe_fracture_chunk_t*)fracture->chunks->data;
+            for (uint32_t b = 0; b < builder.bond_count; ++b) {
+                chunks[builder.bonds[b].chunk_a].bond_count++;
+                chunks[builder.bonds[b].chunk_b].bond_count++;
+            }
+            uint32_t offset = 0;
+            for (uint32_t i = 0; i < count; ++i) {
+                chunks[i].first_bond = offset;
+                offset += chunks[i].bond_count;
+                chunks[i].bond_count = 0;
+            }
+            for (uint32_t b = 0; b < builder.bond_count; ++b) {
+                fe_fracture_chunk_t* a = &chunks[builder.bonds[b].chunk_a];
+                fe_fracture_chunk_t* c = &chunks[builder.bonds[b].chunk_b];
+                fracture->chunk_bonds[a->first_bond + a->bond_count++] = b;
+                fracture->chunk_bonds[c->first_bond + c->bond_count++] = b;
+            }
+
+            uint32_t bond = 0;
+            for (uint32_t c = 0; c < fracture->cluster_count; ++c) {
+                fe_fracture_cluster_t* cluster = &fracture->clusters[c];
+                cluster->first_chunk = c * cluster_size;
+                cluster->chunk_count = (count - cluster->first_chunk < cluster_size) ? count - cluster->first_chunk : cluster_size;
+                cluster->bounds = chunk_bounds[cluster->first_chunk];
+                for (uint32_t i = 1; i < cluster->chunk_count; ++i) cluster->bounds = fe_aabb_union(&cluster->bounds, &chunk_bounds[cluster->first_chunk + i]);
+
+                // Bağlar chunk_a'ya göre sıralı: kümenin sahip olduğu bağlar ardışıktır
+                cluster->first_bond = bond;
+                while (bond < builder.bond_count && builder.bonds[bond].chunk_a < cluster->first_chunk + cluster->chunk_count) bond++;
+                cluster->bond_count = bond - cluster->first_bond;
+            }
+        }
+    }
+
+    fe_fracture_poly_free(&builder.poly[0]);
+    fe_fracture_poly_free(&builder.poly[1]);
+    fe_fracture_poly_free(&input);
+    fe_mem_free(builder.cap);
+    fe_mem_free(builder.cap_angle);
+    fe_mem_free(builder.plane_normals);
+    fe_mem_free(builder.plane_distances);
+    fe_mem_free(cell_sites);
+    fe_mem_free(keys);
+    fe_mem_free(chunk_bounds);
+
+    if (fracture) {
+        fracture->positions = builder.positions;
+        fracture->normals = builder.normals;
+        fracture->vertex_count = builder.vertex_count;
+        fracture->indices = builder.indices;
+        fracture->index_count = builder.index_count;
+        fracture->bonds = builder.bonds;
+        fracture->bond_count = builder.bond_count;
+        fracture->bounds = bounds;
+    } else {
+        fe_mem_free(builder.positions);
+        fe_mem_free(builder.normals);
+        fe_mem_free(builder.indices);
+        fe_mem_free(builder.bonds);
+    }
+    if (!ok) {
+        FE_LOG_ERROR("Voronoi kirilma uretilemedi.");
+        fe_fracture_mesh_destroy(fracture);
+        return NULL;
+    }
+
+    fracture->id = next_fracture_id++;
+    FE_LOG_INFO("Voronoi kirilma %u uretildi: %u parca, %u bag, %u kume.", fracture->id, count, fracture->bond_count, fracture->cluster_count);
+    return fracture;
+}
+
+/**
+ * Uygulama: fe_fracture_mesh_destroy
+ */
+void fe_fracture_mesh_destroy(fe_fracture_mesh_t* fracture) {
+    if (!fracture) return;
+
+    if (fracture->chunks) fe_array_destroy(fracture->chunks);
+    fe_mem_free(fracture->positions);
+    fe_mem_free(fracture->normals);
+    fe_mem_free(fracture->indices);
+    fe_mem_free(fracture->bonds);
+    fe_mem_free(fracture->chunk_bonds);
+    fe_mem_free(fracture->clusters);
+    fe_mem_free(fracture);
+}
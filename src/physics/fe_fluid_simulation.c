@@ -2,7 +2,10 @@
 
 #include "physics/fe_fluid_simulation.h"
 #include "utils/fe_logger.h"
+#include "platform/fe_job_system.h" // fe_job_parallel_for
+#include "math/fe_simd.h"           // fe_simd_t, FE_SIMD_WIDTH
 #include <stdlib.h> // malloc, free, rand
+#include <string.h> // memset
 #include <math.h>   // powf, sqrtf, fabsf, M_PI
 
 // Sabitler
@@ -11,55 +14,313 @@
 #define SPH_VISCOSITY (0.02f)
 #define SPH_SMOOTHING_RADIUS (0.1f) // 10 cm
 
+// Komşu ızgarasının izin verilen maksimum hücre sayısı.
+// Hacim çok büyükse hücre boyutu büyütülür (doğruluk korunur, yalnızca aday sayısı artar).
+#define SPH_GRID_MAX_CELLS (1u << 22)
+
+// Bir işe (job) düşen minimum parçacık sayısı.
+// Daha küçük aralıklarda iş dağıtma maliyeti kazancı aşar.
+#define SPH_MIN_PARTICLES_PER_WORKER 2048
+
 // Dahili Çekirdek Fonksiyonları (W) ve Türevleri (Grad W, Lap W)
-// Kübik B-spline çekirdeği varsayılır.
+// Kübik B-spline çekirdeği varsayılır. Sabitler (alpha) h'ye bağlıdır ve geçiş başına
+// bir kez fe_fluid_kernel_constants ile hesaplanır; çift kesinlikli bölme çift başına yapılmaz.
+
+/**
+ * @brief Bir geçişin çekirdek sabitleri.
+ */
+typedef struct fe_fluid_kernel {
+    float h;
+    float h2;
+    float inv_h2;
+    float alpha_density;        // 3D: 15/pi*h3
+    float alpha_grad;           // 3D: -45/pi*h5
+    float alpha_lap;            // 3D: 45/pi*h5
+} fe_fluid_kernel_t;
+
+static fe_fluid_kernel_t fe_fluid_kernel_constants(float h) {
+    fe_fluid_kernel_t k;
+    float h3 = h * h * h;
+    float h5 = h3 * h * h;
+    k.h = h;
+    k.h2 = h * h;
+    k.inv_h2 = 1.0f / k.h2;
+    k.alpha_density = (float)(15.0 / (M_PI * h3));
+    k.alpha_grad = (float)(-45.0 / (M_PI * h5));
+    k.alpha_lap = (float)(45.0 / (M_PI * h5));
+    return k;
+}
 
 /**
  * @brief SPH Yoğunluk Çekirdek Fonksiyonu W(r, h).
- * * r: parçacıklar arasındaki mesafe, h: smoothing_radius.
+ * * r2: parçacıklar arasındaki mesafenin karesi; çekirdek yalnızca q^2'ye bağlı olduğundan karekök gerekmez.
  */
-static float W_density(float r, float h) {
-    if (r < 0.0f || r > h) return 0.0f;
-    float q = r / h;
-    float h2 = h * h;
-    float h3 = h * h2;
-    // Kübik spline çekirdek sabiti (2D: 10/7pi*h2, 3D: 15/pi*h3)
-    const float alpha = 15.0f / (M_PI * h3); 
-    return alpha * (1.0f - q * q) * (1.0f - q * q) * (1.0f - q * q);
+static inline float W_density(float r2, const fe_fluid_kernel_t* k) {
+    if (r2 > k->h2) return 0.0f;
+    float t = 1.0f - r2 * k->inv_h2;
+    return k->alpha_density * t * t * t;
 }
 
 /**
  * @brief SPH Basınç Kuvveti Çekirdek Fonksiyonunun Gradyenti Grad W_pressure(r, h).
  * * Genellikle W'nun bir türevi kullanılır, burada türevlenmiş spline.
  */
-static fe_vec3_t GradW_pressure(fe_vec3_t delta, float r, float h) {
-    if (r < 0.0001f || r > h) return (fe_vec3_t){0};
-    
-    float q = r / h;
-    float h5 = h*h*h*h*h;
-    // Gradyent çekirdek sabiti (3D: 45/pi*h5)
-    const float alpha_grad = -45.0f / (M_PI * h5); 
+static inline fe_vec3_t GradW_pressure(fe_vec3_t delta, float r, const fe_fluid_kernel_t* k) {
+    if (r < 0.0001f || r > k->h) return (fe_vec3_t){0};
     
-    float factor = alpha_grad * (h - r) * (h - r);
-    return fe_vec3_scale(delta, factor / r); // delta/r = normalize(delta)
+    float factor = k->alpha_grad * (k->h - r) * (k->h - r) / r; // delta/r = normalize(delta)
+    return (fe_vec3_t){ .x = delta.x * factor, .y = delta.y * factor, .z = delta.z * factor };
 }
 
 /**
  * @brief SPH Viskozite Kuvveti Çekirdek Fonksiyonunun Laplacien'i Lap W_viscosity(r, h).
  * * Genellikle W'nun ikinci türevi kullanılır.
  */
-static float LapW_viscosity(float r, float h) {
-    if (r > h) return 0.0f;
-    float q = r / h;
-    float h5 = h*h*h*h*h;
-    // Laplacian çekirdek sabiti (3D: 45/pi*h5)
-    const float alpha_lap = 45.0f / (M_PI * h5); 
-    return alpha_lap * (h - r);
+static inline float LapW_viscosity(float r, const fe_fluid_kernel_t* k) {
+    if (r > k->h) return 0.0f;
+    return k->alpha_lap * (k->h - r);
+}
+
+
+
+// ----------------------------------------------------------------------
+// 2. SoA PARÇACIK DEPOSU
+// ----------------------------------------------------------------------
+
+// fe_fluid_store_streams'in döndürdüğü dizi sayısı (yeniden dizme tamponu dahil)
+#define SPH_STORE_STREAM_COUNT 13
+
+/**
+ * @brief Deponun tüm float dizilerinin adreslerini sabit bir sırada döndürür.
+ */
+static size_t fe_fluid_store_streams(fe_fluid_particle_store_t* store, float*** out_streams) {
+    out_streams[0]  = &store->position_x;
+    out_streams[1]  = &store->position_y;
+    out_streams[2]  = &store->position_z;
+    out_streams[3]  = &store->velocity_x;
+    out_streams[4]  = &store->velocity_y;
+    out_streams[5]  = &store->velocity_z;
+    out_streams[6]  = &store->force_x;
+    out_streams[7]  = &store->force_y;
+    out_streams[8]  = &store->force_z;
+    out_streams[9]  = &store->mass;
+    out_streams[10] = &store->density;
+    out_streams[11] = &store->pressure;
+    out_streams[12] = &store->scratch;
+    return SPH_STORE_STREAM_COUNT;
+}
+
+/**
+ * @brief Deponun kapasitesini en az new_capacity olacak şekilde büyütür.
+ * @return Basariliysa true, degilse false (mevcut veriler korunur).
+ */
+static bool fe_fluid_store_reserve(fe_fluid_particle_store_t* store, size_t new_capacity) {
+    if (new_capacity <= store->capacity) return true;
+
+    float** streams[SPH_STORE_STREAM_COUNT];
+    size_t stream_count = fe_fluid_store_streams(store, streams);
+    for (size_t s = 0; s < stream_count; ++s) {
+        float* grown = (float*)realloc(*streams[s], new_capacity * sizeof(float));
+        if (!grown) {
+            FE_LOG_ERROR("Akışkan parçacık deposu büyütülemedi. Kapasite %zu", new_capacity);
+            return false;
+        }
+        *streams[s] = grown;
+    }
+    uint32_t* ids = (uint32_t*)realloc(store->id, new_capacity * sizeof(uint32_t));
+    if (!ids) {
+        FE_LOG_ERROR("Akışkan parçacık deposu büyütülemedi. Kapasite %zu", new_capacity);
+        return false;
+    }
+    store->id = ids;
+    store->capacity = new_capacity;
+    return true;
+}
+
+/**
+ * @brief Deponun tüm dizilerini serbest bırakır.
+ */
+static void fe_fluid_store_release(fe_fluid_particle_store_t* store) {
+    float** streams[SPH_STORE_STREAM_COUNT];
+    size_t stream_count = fe_fluid_store_streams(store, streams);
+    for (size_t s = 0; s < stream_count; ++s) {
+        free(*streams[s]);
+        *streams[s] = NULL;
+    }
+    free(store->id);
+    store->id = NULL;
+    store->count = 0;
+    store->capacity = 0;
+}
+
+
+// ----------------------------------------------------------------------
+// 3. KOMŞU ARAMA IZGARASI (UNIFORM GRID)
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Bir eksendeki konumu [0, dim - 1] aralığına kırpılmış hücre koordinatına çevirir.
+ * * Sınır dışına taşan parçacıklar kenar hücrelere düşer; kırpma komşuluğu bozmaz.
+ */
+static inline uint32_t fe_fluid_grid_axis_cell(float p, float origin, float inv_cell_size, uint32_t dim) {
+    float c = (p - origin) * inv_cell_size;
+    if (!(c > 0.0f)) return 0; // NaN ve negatifler için
+    uint32_t ic = (uint32_t)c;
+    return (ic >= dim) ? dim - 1 : ic;
+}
+
+/**
+ * @brief Izgara belleğini serbest bırakır.
+ */
+static void fe_fluid_grid_destroy(fe_fluid_spatial_grid_t* grid) {
+    if (!grid) return;
+    free(grid->cell_start);
+    free(grid->particle_cells);
+    free(grid->sorted_indices);
+    free(grid);
+}
+
+/**
+ * @brief Deponun kalıcı akışlarını sorted_indices sırasına toplar (gather).
+ * * Yoğunluk, basınç ve kuvvet her adımda yeniden hesaplandığından taşınmaz. Kimlikler
+ * * particle_cells üzerinden kopyalanır; çağıran particle_cells'i sonra yeniden doldurur.
+ */
+static void fe_fluid_store_reorder(fe_fluid_particle_store_t* store, fe_fluid_spatial_grid_t* grid) {
+    float** streams[] = {
+        &store->position_x, &store->position_y, &store->position_z,
+        &store->velocity_x, &store->velocity_y, &store->velocity_z, &store->mass
+    };
+    const uint32_t* order = grid->sorted_indices;
+    size_t count = store->count;
+
+    for (size_t s = 0; s < sizeof(streams) / sizeof(streams[0]); ++s) {
+        const float* src = *streams[s];
+        float* dst = store->scratch;
+        for (size_t k = 0; k < count; ++k) {
+            dst[k] = src[order[k]];
+        }
+        store->scratch = *streams[s];
+        *streams[s] = dst;
+    }
+
+    for (size_t k = 0; k < count; ++k) {
+        grid->particle_cells[k] = store->id[order[k]];
+    }
+    memcpy(store->id, grid->particle_cells, count * sizeof(uint32_t));
+}
+
+/**
+ * @brief Izgarayı hacmin mevcut parçacık konumlarından yeniden kurar (Counting Sort).
+ * * Karmaşıklık: O(n + hücre sayısı). Tamponlar yalnızca büyüdüğünde yeniden tahsis edilir.
+ * * Sıralamadan sonra depo hücre sırasına dizilir: bir hücrenin parçacıkları depoda
+ * * [cell_start[c], cell_start[c + 1]) aralığındadır ve komşu okumaları bitişik olur. Parçacıklar
+ * * adımlar arasında az yer değiştirdiğinden sonraki kurulumların okumaları da büyük ölçüde sıralıdır.
+ * * Seri çalışır; hücre içi sıra önceki depo sırasına göre artan olduğundan sonraki
+ * * paralel geçişler her iş parçacığı sayısında aynı toplama sırasını görür.
+ * @return Başarılıysa true; h pozitif değilse veya bellek yetersizse false (kaba kuvvet yoluna düşülür).
+ */
+static bool fe_fluid_grid_build(fe_fluid_volume_t* volume) {
+    fe_fluid_spatial_grid_t* grid = volume->spatial_hash;
+    fe_fluid_particle_store_t* store = &volume->particles;
+    size_t count = store->count;
+
+    // 1. Izgara boyutlarını belirle (Hücre boyutu >= h)
+    fe_vec3_t extent = fe_vec3_subtract(volume->volume_max, volume->volume_min);
+    float cell_size = volume->smoothing_radius_h;
+    // h <= 0 (veya NaN/sonsuz) ile aşağıdaki ikiye katlama döngüsü hiç bitmez.
+    if (!(cell_size > 0.0f) || !isfinite(cell_size) ||
+        !isfinite(extent.x) || !isfinite(extent.y) || !isfinite(extent.z)) {
+        return false;
+    }
+    uint32_t dim_x, dim_y, dim_z;
+    for (;;) {
+        dim_x = (uint32_t)fmaxf(1.0f, ceilf(extent.x / cell_size));
+        dim_y = (uint32_t)fmaxf(1.0f, ceilf(extent.y / cell_size));
+        dim_z = (uint32_t)fmaxf(1.0f, ceilf(extent.z / cell_size));
+        if ((uint64_t)dim_x * dim_y * dim_z <= SPH_GRID_MAX_CELLS) break;
+        cell_size *= 2.0f;
+    }
+    size_t cell_count = (size_t)dim_x * dim_y * dim_z;
+
+    grid->origin = volume->volume_min;
+    grid->cell_size = cell_size;
+    grid->inv_cell_size = 1.0f / cell_size;
+    grid->dim_x = dim_x;
+    grid->dim_y = dim_y;
+    grid->dim_z = dim_z;
+
+    // 2. Tamponları gerekirse büyüt
+    if (grid->cell_capacity < cell_count) {
+        uint32_t* cell_start = (uint32_t*)realloc(grid->cell_start, (cell_count + 1) * sizeof(uint32_t));
+        if (!cell_start) return false;
+        grid->cell_start = cell_start;
+        grid->cell_capacity = cell_count;
+    }
+    if (grid->particle_capacity < count) {
+        uint32_t* particle_cells = (uint32_t*)realloc(grid->particle_cells, count * sizeof(uint32_t));
+        if (!particle_cells) return false;
+        grid->particle_cells = particle_cells;
+        uint32_t* sorted_indices = (uint32_t*)realloc(grid->sorted_indices, count * sizeof(uint32_t));
+        if (!sorted_indices) return false;
+        grid->sorted_indices = sorted_indices;
+        grid->particle_capacity = count;
+    }
+
+    // 3. Hücre başına parçacık say
+    memset(grid->cell_start, 0, (cell_count + 1) * sizeof(uint32_t));
+    for (size_t i = 0; i < count; ++i) {
+        uint32_t cx = fe_fluid_grid_axis_cell(store->position_x[i], grid->origin.x, grid->inv_cell_size, dim_x);
+        uint32_t cy = fe_fluid_grid_axis_cell(store->position_y[i], grid->origin.y, grid->inv_cell_size, dim_y);
+        uint32_t cz = fe_fluid_grid_axis_cell(store->position_z[i], grid->origin.z, grid->inv_cell_size, dim_z);
+        uint32_t cell = (cz * dim_y + cy) * dim_x + cx;
+        grid->particle_cells[i] = cell;
+        grid->cell_start[cell + 1]++;
+    }
+
+    // 4. Önek toplamı (prefix sum): cell_start[c] = c hücresinin ilk sıralı indeksi
+    for (size_t c = 0; c < cell_count; ++c) {
+        grid->cell_start[c + 1] += grid->cell_start[c];
+    }
+
+    // 5. Dağıtma (scatter). Hücre içi sıra parçacık indeksine göre artandır (deterministik).
+    for (size_t i = 0; i < count; ++i) {
+        uint32_t cell = grid->particle_cells[i];
+        grid->sorted_indices[grid->cell_start[cell]++] = (uint32_t)i;
+    }
+    // Dağıtma cell_start'ı bir hücre kaydırdı; geri al.
+    for (size_t c = cell_count; c > 0; --c) {
+        grid->cell_start[c] = grid->cell_start[c - 1];
+    }
+    grid->cell_start[0] = 0;
+
+    // 6. Depoyu hücre sırasına diz; hücre indeksleri artık depo sırasıyla artar
+    fe_fluid_store_reorder(store, grid);
+    for (size_t c = 0; c < cell_count; ++c) {
+        for (uint32_t k = grid->cell_start[c]; k < grid->cell_start[c + 1]; ++k) {
+            grid->particle_cells[k] = (uint32_t)c;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Bir parçacığın 3x3x3 komşu hücre aralığını hesaplar (sınırlarda kırpılmış).
+ */
+static inline void fe_fluid_grid_neighbor_range(const fe_fluid_spatial_grid_t* grid, uint32_t cell,
+                                                uint32_t lo[3], uint32_t hi[3]) {
+    uint32_t cx = cell % grid->dim_x;
+    uint32_t cy = (cell / grid->dim_x) % grid->dim_y;
+    uint32_t cz = cell / (grid->dim_x * grid->dim_y);
+
+    lo[0] = cx > 0 ? cx - 1 : 0;  hi[0] = cx + 1 < grid->dim_x ? cx + 1 : cx;
+    lo[1] = cy > 0 ? cy - 1 : 0;  hi[1] = cy + 1 < grid->dim_y ? cy + 1 : cy;
+    lo[2] = cz > 0 ? cz - 1 : 0;  hi[2] = cz + 1 < grid->dim_z ? cz + 1 : cz;
 }
 
 
 // ----------------------------------------------------------------------
-// 3. YÖNETİM VE YAŞAM DÖNGÜSÜ
+// 4. YÖNETİM VE YAŞAM DÖNGÜSÜ
 // ----------------------------------------------------------------------
 
 static uint32_t g_next_fluid_id = 1;
@@ -72,7 +333,11 @@ fe_fluid_volume_t* fe_fluid_create_volume(uint32_t particle_count, fe_vec3_t vol
     if (!volume) return NULL;
     
     volume->id = g_next_fluid_id++;
-    volume->particles = fe_array_create(sizeof(fe_fluid_particle_t));
+    if (!fe_fluid_store_reserve(&volume->particles, particle_count > 0 ? particle_count : 1)) {
+        fe_fluid_store_release(&volume->particles);
+        free(volume);
+        return NULL;
+    }
     
     // Varsayılan Ayarlar
     volume->smoothing_radius_h = SPH_SMOOTHING_RADIUS;
@@ -80,6 +345,7 @@ fe_fluid_volume_t* fe_fluid_create_volume(uint32_t particle_count, fe_vec3_t vol
     volume->viscosity_mu = SPH_VISCOSITY;
     volume->stiffness_k = 100.0f; // Sıkıştırılamazlık için yüksek değer
     volume->volume_max = volume_size;
+    volume->worker_count = 1;
 
     // Parçacıkları rastgele/düzenli yerleştirme (Şimdilik rastgele)
     for (uint32_t i = 0; i < particle_count; ++i) {
@@ -89,12 +355,14 @@ fe_fluid_volume_t* fe_fluid_create_volume(uint32_t particle_count, fe_vec3_t vol
         p.position.y = (float)rand() / (float)RAND_MAX * volume_size.y;
         p.position.z = (float)rand() / (float)RAND_MAX * volume_size.z;
         
-        fe_array_push(volume->particles, &p);
+        fe_fluid_add_particle(volume, &p);
     }
     
-    // TODO: Uzamsal Karma Tablosunu Başlat
+    // Uzamsal ızgara: tamponlar ilk adımda, parçacık konumlarına göre tahsis edilir.
+    volume->spatial_hash = (fe_fluid_spatial_grid_t*)calloc(1, sizeof(fe_fluid_spatial_grid_t));
+    volume->use_spatial_hash = (volume->spatial_hash != NULL);
     
-    FE_LOG_INFO("Akışkan Hacmi %u olusturuldu. Parçacik: %zu", volume->id, fe_array_count(volume->particles));
+    FE_LOG_INFO("Akışkan Hacmi %u olusturuldu. Parçacik: %zu", volume->id, volume->particles.count);
     return volume;
 }
 
@@ -103,122 +371,390 @@ fe_fluid_volume_t* fe_fluid_create_volume(uint32_t particle_count, fe_vec3_t vol
  */
 void fe_fluid_destroy_volume(fe_fluid_volume_t* volume) {
     if (volume) {
-        if (volume->particles) fe_array_destroy(volume->particles);
-        // TODO: Uzamsal Karma Tablosunu Serbest Bırak
+        fe_fluid_store_release(&volume->particles);
+        fe_fluid_grid_destroy(volume->spatial_hash);
         free(volume);
     }
 }
 
+/**
+ * Uygulama: fe_fluid_add_particle
+ */
+bool fe_fluid_add_particle(fe_fluid_volume_t* volume, const fe_fluid_particle_t* particle) {
+    if (!volume || !particle) return false;
+
+    fe_fluid_particle_store_t* store = &volume->particles;
+    if (store->count >= store->capacity) {
+        size_t new_capacity = store->capacity ? store->capacity * 2 : 8;
+        if (!fe_fluid_store_reserve(store, new_capacity)) return false;
+    }
+
+    size_t i = store->count++;
+    store->id[i] = (uint32_t)i;
+    store->position_x[i] = particle->position.x;
+    store->position_y[i] = particle->position.y;
+    store->position_z[i] = particle->position.z;
+    store->velocity_x[i] = particle->velocity.x;
+    store->velocity_y[i] = particle->velocity.y;
+    store->velocity_z[i] = particle->velocity.z;
+    store->force_x[i] = particle->force_accumulator.x;
+    store->force_y[i] = particle->force_accumulator.y;
+    store->force_z[i] = particle->force_accumulator.z;
+    store->mass[i] = particle->mass;
+    store->density[i] = particle->density;
+    store->pressure[i] = particle->pressure;
+    return true;
+}
+
+/**
+ * Uygulama: fe_fluid_get_particle
+ */
+bool fe_fluid_get_particle(const fe_fluid_volume_t* volume, size_t index, fe_fluid_particle_t* out_particle) {
+    if (!volume || !out_particle || index >= volume->particles.count) return false;
+
+    const fe_fluid_particle_store_t* store = &volume->particles;
+    out_particle->position = (fe_vec3_t){ .x = store->position_x[index], .y = store->position_y[index], .z = store->position_z[index] };
+    out_particle->velocity = (fe_vec3_t){ .x = store->velocity_x[index], .y = store->velocity_y[index], .z = store->velocity_z[index] };
+    out_particle->force_accumulator = (fe_vec3_t){ .x = store->force_x[index], .y = store->force_y[index], .z = store->force_z[index] };
+    out_particle->mass = store->mass[index];
+    out_particle->density = store->density[index];
+    out_particle->pressure = store->pressure[index];
+    return true;
+}
+
+/**
+ * Uygulama: fe_fluid_set_worker_count
+ */
+void fe_fluid_set_worker_count(fe_fluid_volume_t* volume, uint32_t worker_count) {
+    if (!volume) return;
+    if (worker_count < 1) worker_count = 1;
+    if (worker_count > FE_FLUID_MAX_WORKERS) worker_count = FE_FLUID_MAX_WORKERS;
+    volume->worker_count = worker_count;
+}
+
+
 // ----------------------------------------------------------------------
-// 4. SİMÜLASYON ADIMLARI
+// 5. SİMÜLASYON ADIMLARI (Parçacık aralığı çekirdekleri)
 // ----------------------------------------------------------------------
 
 /**
- * @brief SPH Adim 1: Yoğunluk ve Basıncı Hesapla.
+ * @brief Bir geçişin tüm işlerinin paylaştığı parametreler.
  */
-static void fe_fluid_calculate_density_and_pressure(fe_fluid_volume_t* volume) {
-    size_t count = fe_array_count(volume->particles);
-    float h = volume->smoothing_radius_h;
-    
-    // TODO: Komşu Arama (Uzamsal Karma Tablo kullanımı) burada olmalıdır.
+typedef struct fe_fluid_task {
+    fe_fluid_volume_t* volume;
+    fe_vec3_t gravity;
+    fe_fluid_kernel_t kernel;
+    bool use_grid;
+} fe_fluid_task_t;
+
+#ifdef FE_SIMD_WIDTH
+/**
+ * @brief Bir SIMD kaydının şeritlerini sabit sırada toplar (sonuç iş parçacığı sayısından bağımsız kalır).
+ */
+static inline float fe_fluid_simd_sum(fe_simd_t v) {
+    float lanes[FE_SIMD_WIDTH];
+    fe_simd_store(lanes, v);
+    float sum = 0.0f;
+    for (int l = 0; l < FE_SIMD_WIDTH; ++l) sum += lanes[l];
+    return sum;
+}
+#endif
+
+/**
+ * @brief Depoda bitişik [first, last) parçacıklarının (px, py, pz) noktasındaki yoğunluk katkısı.
+ * * Depo hücre sıralı olduğundan bir ızgara satırının parçacıkları bitişiktir; aralık SIMD ile taranır.
+ */
+static inline float fe_fluid_density_span(const fe_fluid_particle_store_t* s, const fe_fluid_kernel_t* kernel,
+                                          float px, float py, float pz, uint32_t first, uint32_t last) {
+    float density = 0.0f;
+    uint32_t j = first;
+
+#ifdef FE_SIMD_WIDTH
+    if (last - first >= FE_SIMD_WIDTH) {
+        const fe_simd_t vpx = fe_simd_set1(px), vpy = fe_simd_set1(py), vpz = fe_simd_set1(pz);
+        const fe_simd_t h2 = fe_simd_set1(kernel->h2), inv_h2 = fe_simd_set1(kernel->inv_h2);
+        const fe_simd_t alpha = fe_simd_set1(kernel->alpha_density), one = fe_simd_set1(1.0f);
+        fe_simd_t acc = fe_simd_zero();
+        for (; j + FE_SIMD_WIDTH <= last; j += FE_SIMD_WIDTH) {
+            fe_simd_t dx = fe_simd_sub(vpx, fe_simd_load(s->position_x + j));
+            fe_simd_t dy = fe_simd_sub(vpy, fe_simd_load(s->position_y + j));
+            fe_simd_t dz = fe_simd_sub(vpz, fe_simd_load(s->position_z + j));
+            fe_simd_t r2 = fe_simd_add(fe_simd_add(fe_simd_mul(dx, dx), fe_simd_mul(dy, dy)), fe_simd_mul(dz, dz));
+            fe_simd_t t = fe_simd_sub(one, fe_simd_mul(r2, inv_h2));
+            fe_simd_t w = fe_simd_mul(fe_simd_mul(alpha, fe_simd_mul(t, t)), t);
+            acc = fe_simd_add(acc, fe_simd_and(fe_simd_le(r2, h2), fe_simd_mul(fe_simd_load(s->mass + j), w)));
+        }
+        density = fe_fluid_simd_sum(acc);
+    }
+#endif
+
+    for (; j < last; ++j) {
+        float dx = px - s->position_x[j];
+        float dy = py - s->position_y[j];
+        float dz = pz - s->position_z[j];
+        float r2 = dx * dx + dy * dy + dz * dz;
+        if (r2 > kernel->h2) continue;
+
+        // Yoğunluk katkısı: rho = Sum(m * W(r, h))
+        density += s->mass[j] * W_density(r2, kernel);
+    }
+    return density;
+}
+
+/**
+ * @brief SPH Adim 1: [begin, end) aralığındaki parçacıkların yoğunluk ve basıncını hesaplar.
+ * * Yalnızca density[i] ve pressure[i] yazılır; tüm okumalar paylaşılan, değişmeyen verilerdir.
+ */
+static void fe_fluid_density_pressure_range(void* data, uint32_t begin, uint32_t end) {
+    const fe_fluid_task_t* task = (const fe_fluid_task_t*)data;
+    fe_fluid_volume_t* volume = task->volume;
+    fe_fluid_particle_store_t* s = &volume->particles;
+    const fe_fluid_spatial_grid_t* grid = volume->spatial_hash;
+    const fe_fluid_kernel_t* kernel = &task->kernel;
     
-    for (size_t i = 0; i < count; ++i) {
-        fe_fluid_particle_t* pi = (fe_fluid_particle_t*)fe_array_get(volume->particles, i);
-        pi->density = 0.0f;
+    for (size_t i = begin; i < end; ++i) {
+        const float px = s->position_x[i], py = s->position_y[i], pz = s->position_z[i];
+        float density = 0.0f;
         
-        // Basitlik için tüm parçacıklar kontrol edilir (YAVAŞ!)
-        for (size_t j = 0; j < count; ++j) {
-            fe_fluid_particle_t* pj = (fe_fluid_particle_t*)fe_array_get(volume->particles, j);
-
-            fe_vec3_t delta = fe_vec3_subtract(pi->position, pj->position);
-            float r = fe_vec3_length(delta);
-            
-            // Yoğunluk katkısı: rho = Sum(m * W(r, h))
-            pi->density += pj->mass * W_density(r, h);
+        if (task->use_grid) {
+            uint32_t lo[3], hi[3];
+            fe_fluid_grid_neighbor_range(grid, grid->particle_cells[i], lo, hi);
+
+            for (uint32_t cz = lo[2]; cz <= hi[2]; ++cz) {
+                for (uint32_t cy = lo[1]; cy <= hi[1]; ++cy) {
+                    uint32_t row = (cz * grid->dim_y + cy) * grid->dim_x;
+                    // Bir satırdaki ardışık hücreler depoda bitişiktir.
+                    uint32_t first = grid->cell_start[row + lo[0]];
+                    uint32_t last = grid->cell_start[row + hi[0] + 1];
+                    density += fe_fluid_density_span(s, kernel, px, py, pz, first, last);
+                }
+            }
+        } else {
+            // Kaba kuvvet: tüm parçacıklar kontrol edilir (YAVAŞ!)
+            for (size_t j = 0; j < s->count; ++j) {
+                float dx = px - s->position_x[j];
+                float dy = py - s->position_y[j];
+                float dz = pz - s->position_z[j];
+                float r2 = dx * dx + dy * dy + dz * dz;
+                
+                // Yoğunluk katkısı: rho = Sum(m * W(r, h))
+                density += s->mass[j] * W_density(r2, kernel);
+            }
         }
         
         // Basıncı hesapla (İdeal gaz denklemi)
         // P = k * (rho - rho0)
-        pi->pressure = volume->stiffness_k * fmaxf(0.0f, pi->density - volume->rest_density);
+        s->density[i] = density;
+        s->pressure[i] = volume->stiffness_k * fmaxf(0.0f, density - volume->rest_density);
     }
 }
 
 /**
- * @brief SPH Adim 2: Basınç ve Viskozite Kuvvetlerini Hesapla ve Uygula.
+ * @brief i ve j parçacıkları arasındaki basınç ve viskozite katkısını biriktirir.
  */
-static void fe_fluid_calculate_and_apply_forces(fe_fluid_volume_t* volume, fe_vec3_t gravity) {
-    size_t count = fe_array_count(volume->particles);
-    float h = volume->smoothing_radius_h;
+static inline void fe_fluid_accumulate_pair_forces(const fe_fluid_volume_t* volume, const fe_fluid_kernel_t* kernel,
+                                                   size_t i, size_t j, fe_vec3_t* f_pressure, fe_vec3_t* f_viscosity) {
+    const fe_fluid_particle_store_t* s = &volume->particles;
+    fe_vec3_t delta = {
+        .x = s->position_x[i] - s->position_x[j],
+        .y = s->position_y[i] - s->position_y[j],
+        .z = s->position_z[i] - s->position_z[j]
+    };
+    float r2 = delta.x * delta.x + delta.y * delta.y + delta.z * delta.z;
+
+    if (r2 > kernel->h2) return; // Etkileşim yarıçapı dışında
+    float r = sqrtf(r2);
+
+    // A. Basınç Kuvveti (P_i + P_j) / (2 * rho_i * rho_j) * grad W * m_i * m_j
+    float avg_pressure = (s->pressure[i] + s->pressure[j]) * 0.5f;
+    fe_vec3_t grad_w = GradW_pressure(delta, r, kernel);
     
-    for (size_t i = 0; i < count; ++i) {
-        fe_fluid_particle_t* pi = (fe_fluid_particle_t*)fe_array_get(volume->particles, i);
-        
-        pi->force_accumulator = fe_vec3_scale(gravity, pi->mass); // Yerçekimi başlangıç
-
-        fe_vec3_t f_pressure = {0};
-        fe_vec3_t f_viscosity = {0};
-
-        // Basitlik için tüm parçacıklar kontrol edilir
-        for (size_t j = 0; j < count; ++j) {
-            if (i == j) continue; // Kendini atla
-
-            fe_fluid_particle_t* pj = (fe_fluid_particle_t*)fe_array_get(volume->particles, j);
-
-            fe_vec3_t delta = fe_vec3_subtract(pi->position, pj->position);
-            float r = fe_vec3_length(delta);
+    float pressure_scale = -(s->mass[j] / s->density[j]) * avg_pressure;
+    f_pressure->x += grad_w.x * pressure_scale;
+    f_pressure->y += grad_w.y * pressure_scale;
+    f_pressure->z += grad_w.z * pressure_scale;
+
+    // B. Viskozite Kuvveti (Viskozite * (v_j - v_i) / rho_j * Lap W * m_i * m_j)
+    float viscosity_scale = (volume->viscosity_mu * s->mass[j] / s->density[j]) * LapW_viscosity(r, kernel);
+    f_viscosity->x += (s->velocity_x[j] - s->velocity_x[i]) * viscosity_scale;
+    f_viscosity->y += (s->velocity_y[j] - s->velocity_y[i]) * viscosity_scale;
+    f_viscosity->z += (s->velocity_z[j] - s->velocity_z[i]) * viscosity_scale;
+}
 
-            if (r > h) continue; // Etkileşim yarıçapı dışında
+/**
+ * @brief Depoda bitişik [first, last) parçacıklarının i'ye uyguladığı basınç ve viskozite kuvvetlerini biriktirir.
+ * * SIMD kısmında i'nin kendisi dışlanmaz: r = 0 basınç maskesinden düşer, viskozite katkısı (v_i - v_i) sıfırdır.
+ */
+static inline void fe_fluid_forces_span(const fe_fluid_volume_t* volume, const fe_fluid_kernel_t* kernel, size_t i,
+                                        uint32_t first, uint32_t last, fe_vec3_t* f_pressure, fe_vec3_t* f_viscosity) {
+    uint32_t j = first;
+
+#ifdef FE_SIMD_WIDTH
+    if (last - first >= FE_SIMD_WIDTH) {
+        const fe_fluid_particle_store_t* s = &volume->particles;
+        const fe_simd_t px = fe_simd_set1(s->position_x[i]), py = fe_simd_set1(s->position_y[i]), pz = fe_simd_set1(s->position_z[i]);
+        const fe_simd_t vx = fe_simd_set1(s->velocity_x[i]), vy = fe_simd_set1(s->velocity_y[i]), vz = fe_simd_set1(s->velocity_z[i]);
+        const fe_simd_t pressure_i = fe_simd_set1(s->pressure[i]);
+        const fe_simd_t h = fe_simd_set1(kernel->h), h2 = fe_simd_set1(kernel->h2), min_r = fe_simd_set1(0.0001f);
+        const fe_simd_t alpha_grad = fe_simd_set1(kernel->alpha_grad);
+        const fe_simd_t mu_alpha_lap = fe_simd_set1(volume->viscosity_mu * kernel->alpha_lap);
+        const fe_simd_t neg_half = fe_simd_set1(-0.5f);
+        fe_simd_t fpx = fe_simd_zero(), fpy = fe_simd_zero(), fpz = fe_simd_zero();
+        fe_simd_t fvx = fe_simd_zero(), fvy = fe_simd_zero(), fvz = fe_simd_zero();
+
+        for (; j + FE_SIMD_WIDTH <= last; j += FE_SIMD_WIDTH) {
+            fe_simd_t dx = fe_simd_sub(px, fe_simd_load(s->position_x + j));
+            fe_simd_t dy = fe_simd_sub(py, fe_simd_load(s->position_y + j));
+            fe_simd_t dz = fe_simd_sub(pz, fe_simd_load(s->position_z + j));
+            fe_simd_t r2 = fe_simd_add(fe_simd_add(fe_simd_mul(dx, dx), fe_simd_mul(dy, dy)), fe_simd_mul(dz, dz));
+            fe_simd_t inside = fe_simd_le(r2, h2);
+            if (!fe_simd_movemask(inside)) continue;
+
+            fe_simd_t r = fe_simd_sqrt(r2);
+            fe_simd_t h_r = fe_simd_sub(h, r);
+            fe_simd_t m_over_rho = fe_simd_div(fe_simd_load(s->mass + j), fe_simd_load(s->density + j));
+
+            // Basınç: grad W * -(m_j / rho_j) * (P_i + P_j) / 2; r = 0 şeritlerindeki inf/NaN maskeyle silinir
+            fe_simd_t pressure_scale = fe_simd_mul(fe_simd_mul(m_over_rho, neg_half),
+                                                   fe_simd_add(pressure_i, fe_simd_load(s->pressure + j)));
+            fe_simd_t grad = fe_simd_div(fe_simd_mul(fe_simd_mul(alpha_grad, h_r), h_r), r);
+            fe_simd_t pf = fe_simd_and(fe_simd_and(inside, fe_simd_gt(r, min_r)), fe_simd_mul(grad, pressure_scale));
+            fpx = fe_simd_add(fpx, fe_simd_mul(dx, pf));
+            fpy = fe_simd_add(fpy, fe_simd_mul(dy, pf));
+            fpz = fe_simd_add(fpz, fe_simd_mul(dz, pf));
+
+            // Viskozite: mu * (m_j / rho_j) * Lap W * (v_j - v_i)
+            fe_simd_t vf = fe_simd_and(inside, fe_simd_mul(fe_simd_mul(mu_alpha_lap, m_over_rho), h_r));
+            fvx = fe_simd_add(fvx, fe_simd_mul(fe_simd_sub(fe_simd_load(s->velocity_x + j), vx), vf));
+            fvy = fe_simd_add(fvy, fe_simd_mul(fe_simd_sub(fe_simd_load(s->velocity_y + j), vy), vf));
+            fvz = fe_simd_add(fvz, fe_simd_mul(fe_simd_sub(fe_simd_load(s->velocity_z + j), vz), vf));
+        }
+        f_pressure->x += fe_fluid_simd_sum(fpx);
+        f_pressure->y += fe_fluid_simd_sum(fpy);
+        f_pressure->z += fe_fluid_simd_sum(fpz);
+        f_viscosity->x += fe_fluid_simd_sum(fvx);
+        f_viscosity->y += fe_fluid_simd_sum(fvy);
+        f_viscosity->z += fe_fluid_simd_sum(fvz);
+    }
+#endif
 
-            // A. Basınç Kuvveti (P_i + P_j) / (2 * rho_i * rho_j) * grad W * m_i * m_j
-            float avg_pressure = (pi->pressure + pj->pressure) * 0.5f;
-            fe_vec3_t grad_w = GradW_pressure(delta, r, h);
-            
-            fe_vec3_t pressure_term = fe_vec3_scale(grad_w, 
-                -(pj->mass / pj->density) * avg_pressure);
-            f_pressure = fe_vec3_add(f_pressure, pressure_term);
+    for (; j < last; ++j) {
+        if (j == i) continue; // Kendini atla
+        fe_fluid_accumulate_pair_forces(volume, kernel, i, j, f_pressure, f_viscosity);
+    }
+}
 
-            // B. Viskozite Kuvveti (Viskozite * (v_j - v_i) / rho_j * Lap W * m_i * m_j)
-            fe_vec3_t velocity_diff = fe_vec3_subtract(pj->velocity, pi->velocity);
-            float lap_w = LapW_viscosity(r, h);
+/**
+ * @brief SPH Adim 2: [begin, end) aralığındaki parçacıkların basınç ve viskozite kuvvetlerini hesaplar.
+ * * Yalnızca force_*[i] yazılır.
+ */
+static void fe_fluid_forces_range(void* data, uint32_t begin, uint32_t end) {
+    const fe_fluid_task_t* task = (const fe_fluid_task_t*)data;
+    fe_fluid_volume_t* volume = task->volume;
+    fe_fluid_particle_store_t* s = &volume->particles;
+    const fe_fluid_spatial_grid_t* grid = volume->spatial_hash;
+    
+    for (size_t i = begin; i < end; ++i) {
+        fe_vec3_t f_pressure = {0};
+        fe_vec3_t f_viscosity = {0};
 
-            fe_vec3_t viscosity_term = fe_vec3_scale(velocity_diff, 
-                (volume->viscosity_mu * pj->mass / pj->density) * lap_w);
-            f_viscosity = fe_vec3_add(f_viscosity, viscosity_term);
+        if (task->use_grid) {
+            uint32_t lo[3], hi[3];
+            fe_fluid_grid_neighbor_range(grid, grid->particle_cells[i], lo, hi);
+
+            for (uint32_t cz = lo[2]; cz <= hi[2]; ++cz) {
+                for (uint32_t cy = lo[1]; cy <= hi[1]; ++cy) {
+                    uint32_t row = (cz * grid->dim_y + cy) * grid->dim_x;
+                    uint32_t first = grid->cell_start[row + lo[0]];
+                    uint32_t last = grid->cell_start[row + hi[0] + 1];
+                    fe_fluid_forces_span(volume, &task->kernel, i, first, last, &f_pressure, &f_viscosity);
+                }
+            }
+        } else {
+            // Kaba kuvvet: tüm parçacıklar kontrol edilir
+            for (size_t j = 0; j < s->count; ++j) {
+                if (i == j) continue; // Kendini atla
+                fe_fluid_accumulate_pair_forces(volume, &task->kernel, i, j, &f_pressure, &f_viscosity);
+            }
         }
 
-        // Toplam SPH Kuvveti
-        pi->force_accumulator = fe_vec3_add(pi->force_accumulator, f_pressure);
-        pi->force_accumulator = fe_vec3_add(pi->force_accumulator, f_viscosity);
+        // Toplam SPH Kuvveti (Yerçekimi başlangıç + basınç + viskozite)
+        float m = s->mass[i];
+        s->force_x[i] = task->gravity.x * m + f_pressure.x + f_viscosity.x;
+        s->force_y[i] = task->gravity.y * m + f_pressure.y + f_viscosity.y;
+        s->force_z[i] = task->gravity.z * m + f_pressure.z + f_viscosity.z;
     }
 }
 
+/**
+ * @brief Bir aralık çekirdeğini parçacıklar üzerinde en fazla worker_count işe böler.
+ * * İşler iş sisteminin kalıcı işçilerinde çalışır (fe_job_parallel_for); her adımda
+ * * iş parçacığı oluşturulmaz. worker_count 1 ise çekirdek doğrudan çağıranda çalışır.
+ * * Her parçacığın çıktısı aralık sınırlarından bağımsız olduğundan sonuç bit düzeyinde aynıdır.
+ */
+static void fe_fluid_parallel_for(fe_fluid_volume_t* volume, fe_job_range_func_t kernel,
+                                  fe_vec3_t gravity, bool use_grid) {
+    uint32_t count = (uint32_t)volume->particles.count;
+    fe_fluid_task_t task = { .volume = volume, .gravity = gravity, .use_grid = use_grid };
+    task.kernel = fe_fluid_kernel_constants(volume->smoothing_radius_h);
+
+    uint32_t workers = volume->worker_count;
+    if (workers <= 1 || count <= SPH_MIN_PARTICLES_PER_WORKER) {
+        kernel(&task, 0, count);
+        return;
+    }
+
+    uint32_t grain = (count + workers - 1) / workers;
+    if (grain < SPH_MIN_PARTICLES_PER_WORKER) grain = SPH_MIN_PARTICLES_PER_WORKER;
+    fe_job_parallel_for(count, grain, kernel, &task);
+}
+
 /**
  * @brief SPH Adim 3: Hız ve Konumu Güncelle (Entegrasyon)
+ * * SoA diziler üzerinde dallanmasız düz döngü; derleyici tarafından vektörleştirilebilir.
  */
 static void fe_fluid_integrate_and_handle_boundaries(fe_fluid_volume_t* volume, float dt) {
-    size_t count = fe_array_count(volume->particles);
+    fe_fluid_particle_store_t* s = &volume->particles;
+    size_t count = s->count;
 
     for (size_t i = 0; i < count; ++i) {
-        fe_fluid_particle_t* p = (fe_fluid_particle_t*)fe_array_get(volume->particles, i);
-
         // a. Hız Güncelleme (Euler)
-        fe_vec3_t acceleration = fe_vec3_scale(p->force_accumulator, 1.0f / p->mass);
-        p->velocity = fe_vec3_add(p->velocity, fe_vec3_scale(acceleration, dt));
+        float inv_mass_dt = dt / s->mass[i];
+        s->velocity_x[i] += s->force_x[i] * inv_mass_dt;
+        s->velocity_y[i] += s->force_y[i] * inv_mass_dt;
+        s->velocity_z[i] += s->force_z[i] * inv_mass_dt;
 
         // b. Konum Güncelleme
-        p->position = fe_vec3_add(p->position, fe_vec3_scale(p->velocity, dt));
+        s->position_x[i] += s->velocity_x[i] * dt;
+        s->position_y[i] += s->velocity_y[i] * dt;
+        s->position_z[i] += s->velocity_z[i] * dt;
+    }
 
-        // c. Basit Sınır Çarpışması Çözümü (Kutu sınırları)
-        float restitution = 0.5f; // Geri sekme katsayısı
-        
-        if (p->position.x < volume->volume_min.x) {
-            p->position.x = volume->volume_min.x;
-            p->velocity.x *= -restitution;
-        } else if (p->position.x > volume->volume_max.x) {
-            p->position.x = volume->volume_max.x;
-            p->velocity.x *= -restitution;
+    // c. Basit Sınır Çarpışması Çözümü (Kutu sınırları)
+    float restitution = 0.5f; // Geri sekme katsayısı
+
+    for (size_t i = 0; i < count; ++i) {
+        if (s->position_x[i] < volume->volume_min.x) {
+            s->position_x[i] = volume->volume_min.x;
+            s->velocity_x[i] *= -restitution;
+        } else if (s->position_x[i] > volume->volume_max.x) {
+            s->position_x[i] = volume->volume_max.x;
+            s->velocity_x[i] *= -restitution;
+        }
+        if (s->position_y[i] < volume->volume_min.y) {
+            s->position_y[i] = volume->volume_min.y;
+            s->velocity_y[i] *= -restitution;
+        } else if (s->position_y[i] > volume->volume_max.y) {
+            s->position_y[i] = volume->volume_max.y;
+            s->velocity_y[i] *= -restitution;
+        }
+        if (s->position_z[i] < volume->volume_min.z) {
+            s->position_z[i] = volume->volume_min.z;
+            s->velocity_z[i] *= -restitution;
+        } else if (s->position_z[i] > volume->volume_max.z) {
+            s->position_z[i] = volume->volume_max.z;
+            s->velocity_z[i] *= -restitution;
         }
-        // ... Y ve Z için de benzer sınır kontrolleri uygulanır ...
     }
 }
 
@@ -229,16 +765,18 @@ static void fe_fluid_integrate_and_handle_boundaries(fe_fluid_volume_t* volume,
 void fe_fluid_simulate_step(fe_fluid_volume_t* volume, fe_vec3_t gravity, float dt) {
     if (!volume) return;
 
-    // 1. Komşuları Güncelle (TODO: Gerekli ise spatial hash)
+    // 1. Komşu ızgarasını güncelle (adım başına bir kez; iki geçiş de aynı ızgarayı kullanır)
+    bool use_grid = volume->use_spatial_hash && volume->spatial_hash && fe_fluid_grid_build(volume);
+    if (volume->use_spatial_hash && !use_grid) {
+        FE_LOG_WARN("Akışkan Hacmi %u: Komşu ızgarası kurulamadı, kaba kuvvet yoluna dönülüyor.", volume->id);
+    }
     
-    // 2. Yoğunluk ve Basıncı Hesapla
-    fe_fluid_calculate_density_and_pressure(volume);
+    // 2. Yoğunluk ve Basıncı Hesapla (paralel)
+    fe_fluid_parallel_for(volume, fe_fluid_density_pressure_range, gravity, use_grid);
 
-    // 3. Basınç ve Viskozite Kuvvetlerini Hesapla ve Uygula
-    fe_fluid_calculate_and_apply_forces(volume, gravity);
+    // 3. Basınç ve Viskozite Kuvvetlerini Hesapla ve Uygula (paralel; 2. adımın bitmesini bekler)
+    fe_fluid_parallel_for(volume, fe_fluid_forces_range, gravity, use_grid);
 
     // 4. Konum ve Hızı Güncelle + Sınırları Çöz
     fe_fluid_integrate_and_handle_boundaries(volume, dt);
-    
-    
 }
\ No newline at end of file
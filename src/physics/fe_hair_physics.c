@@ -2,8 +2,19 @@
 
 #include "physics/fe_hair_physics.h"
 #include "utils/fe_logger.h"
-#include <stdlib.h> // malloc, free
+#include "memory/fe_memory_manager.h" // fe_mem_calloc, fe_mem_realloc, fe_mem_free
+#include "physics/fe_collider.h" // fe_physics_quat_to_rows
+#include "platform/fe_job_system.h" // fe_job_parallel_for
+#include "math/fe_simd.h" // fe_simd_t, FE_SIMD_WIDTH
 #include <math.h>   // sqrtf, fmaxf, fabsf
+#include <string.h> // memset
+
+// Tek bir iş parçasının çözdüğü kılavuz grubu ve hesapladığı render teli sayısı
+#define FE_HAIR_BATCH_GRAIN 4
+#define FE_HAIR_RENDER_GRAIN 256
+
+// Bunun altındaki parça uzunluklarında yön, dinlenme şeklinden alınır
+#define FE_HAIR_MIN_LENGTH 1e-6f
 
 // ----------------------------------------------------------------------
 // 1. YÖNETİM VE YAŞAM DÖNGÜSÜ
@@ -11,6 +22,15 @@
 
 static uint32_t g_next_hair_comp_id = 1;
 
+/**
+ * @brief Kafa uzayındaki noktayı dünya uzayına taşır (rows: kafa yönelimi).
+ */
+static inline fe_vec3_t fe_hair_to_world(const fe_vec3_t rows[3], fe_vec3_t origin, fe_vec3_t local) {
+    return (fe_vec3_t){{origin.x + fe_vec3_dot(rows[0], local),
+                        origin.y + fe_vec3_dot(rows[1], local),
+                        origin.z + fe_vec3_dot(rows[2], local)}};
+}
+
 /**
  * Uygulama: fe_hair_create_component
  */
@@ -20,7 +40,7 @@ fe_hair_component_t* fe_hair_create_component(fe_rigid_body_t* head_rb) {
         return NULL;
     }
     
-    fe_hair_component_t* comp = (fe_hair_component_t*)calloc(1, sizeof(fe_hair_component_t));
+    fe_hair_component_t* comp = (fe_hair_component_t*)fe_mem_calloc(1, sizeof(fe_hair_component_t));
     if (!comp) return NULL;
     
     comp->id = g_next_hair_comp_id++;
@@ -32,7 +52,10 @@ fe_hair_component_t* fe_hair_create_component(fe_rigid_body_t* head_rb) {
     comp->stiffness_bend = 0.3f;
     comp->damping_factor = 0.98f;
     comp->iteration_count = 3; // Kısıtlama çözücüsü için 3-5 yeterli olabilir.
+    comp->solver_type = FE_HAIR_SOLVER_FTL;
+    comp->ftl_damping = 0.9f;
     comp->is_active = true;
+    comp->render_strands = fe_array_create(sizeof(fe_hair_render_strand_t));
 
     FE_LOG_INFO("Saç Bileseni %u olusturuldu.", comp->id);
     return comp;
@@ -49,7 +72,10 @@ void fe_hair_destroy_component(fe_hair_component_t* comp) {
             if (strand->particles) fe_array_destroy(strand->particles);
         }
         fe_array_destroy(comp->strands);
-        free(comp);
+        fe_array_destroy(comp->render_strands);
+        fe_mem_free(comp->render_positions);
+        fe_mem_free(comp->guides.position);
+        fe_mem_free(comp);
         FE_LOG_TRACE("Saç Bileseni yok edildi.");
     }
 }
@@ -65,6 +91,16 @@ fe_hair_strand_t* fe_hair_add_strand(fe_hair_component_t* comp, fe_vec3_t* initi
 
     fe_hair_strand_t new_strand = {0};
     new_strand.particles = fe_array_create(sizeof(fe_hair_particle_t));
+
+    // Kafa uzayındaki dinlenme konumları: R^T * (p - kafa konumu)
+    fe_vec3_t rows[3];
+    fe_physics_quat_to_rows(comp->head_rb->orientation, rows);
+    for (uint32_t i = 0; i < count; ++i) {
+        fe_vec3_t d = fe_vec3_subtract(initial_positions[i], comp->head_rb->position);
+        for (int k = 0; k < 3; ++k) {
+            new_strand.rest_local[i].v[k] = rows[0].v[k] * d.x + rows[1].v[k] * d.y + rows[2].v[k] * d.z;
+        }
+    }
     
     // Parçacıkları başlat
     for (uint32_t i = 0; i < count; ++i) {
@@ -149,13 +185,13 @@ static void fe_hair_resolve_bend_constraint(fe_hair_particle_t* p1, fe_hair_part
 // ----------------------------------------------------------------------
 
 /**
- * Uygulama: fe_hair_simulate_step
+ * @brief Sıralı PBD adımı (FE_HAIR_SOLVER_PBD).
  */
-void fe_hair_simulate_step(fe_hair_component_t* comp, fe_vec3_t gravity, float dt) {
-    if (!comp->is_active) return;
-    
+static void fe_hair_simulate_step_pbd(fe_hair_component_t* comp, fe_vec3_t gravity, float dt) {
     fe_rigid_body_t* head = comp->head_rb;
     float dt_sq = dt * dt;
+    fe_vec3_t head_rows[3];
+    fe_physics_quat_to_rows(head->orientation, head_rows);
 
     // Her kılavuz telini işle
     for (size_t k = 0; k < fe_array_count(comp->strands); ++k) {
@@ -168,10 +204,8 @@ void fe_hair_simulate_step(fe_hair_component_t* comp, fe_vec3_t gravity, float d
         // Kafa hareketine göre kök noktanın (P0) konumunu güncelle (Kinematik girdi)
         fe_hair_particle_t* root_p = (fe_hair_particle_t*)fe_array_get(strand->particles, 0);
         
-        // Bu pozisyon, kafa rigid body'sinin (head) pozisyonu ve rotasyonu ile hesaplanmalıdır.
-        // Basitçe: root_p->position = fe_transform_from_head(head, root_initial_local_pos);
         root_p->prev_position = root_p->position; // Önceki pozisyonu koru
-        root_p->position = head->position; // Basitleştirilmiş kafa pozisyonu (Gerçekte local transform)
+        root_p->position = fe_hair_to_world(head_rows, head->position, strand->rest_local[0]);
 
 
         // 2. Parçacıkların Yeni Konumunu Tahmin Et (Verlet Entegrasyonu)
@@ -218,6 +252,528 @@ void fe_hair_simulate_step(fe_hair_component_t* comp, fe_vec3_t gravity, float d
         // TODO: Her bir parçacığın kafa rigid body'si ile çarpışmasını kontrol et.
         
     }
-    
-    
-}
\ No newline at end of file
+}
+
+// ----------------------------------------------------------------------
+// 5. FTL ÇÖZÜCÜSÜ
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Kılavuz telleri kayıtlardan şerit düzenine yükler.
+ */
+static bool fe_hair_guides_build(fe_hair_component_t* comp) {
+    fe_hair_guides_t* s = &comp->guides;
+    const uint32_t W = FE_HAIR_BATCH_WIDTH;
+    uint32_t strand_count = (uint32_t)fe_array_count(comp->strands);
+
+    uint32_t stride = 0;
+    for (uint32_t k = 0; k < strand_count; ++k) {
+        const fe_hair_strand_t* strand = (const fe_hair_strand_t*)fe_array_get(comp->strands, k);
+        uint32_t count = (uint32_t)fe_array_count(strand->particles);
+        if (count > stride) stride = count;
+    }
+    uint32_t batch_count = (strand_count + W - 1) / W;
+    uint32_t slots = batch_count * stride;
+
+    // Yuva başına 3 konum + 3 önceki konum + 3 dinlenme vektörü + 1 uzunluk şeridi + 3 düz konum
+    if (slots > s->capacity) {
+        float* block = (float*)fe_mem_realloc(s->position, (size_t)slots * 13 * W * sizeof(float));
+        if (!block) {
+            FE_LOG_ERROR("Sac kilavuz telleri icin bellek ayrilamadi (%u tel).", strand_count);
+            return false;
+        }
+        s->position = block;
+        s->capacity = slots;
+    }
+    size_t lanes = (size_t)slots * 3 * W;
+    s->prev_position = s->position + lanes;
+    s->rest_delta = s->prev_position + lanes;
+    s->rest_length = s->rest_delta + lanes;
+    s->packed = (fe_vec3_t*)(s->rest_length + (size_t)slots * W);
+    if (slots > 0) memset(s->position, 0, (size_t)slots * 10 * W * sizeof(float)); // Düz kopya her güncellemede yazılır
+
+    for (uint32_t k = 0; k < strand_count; ++k) {
+        const fe_hair_strand_t* strand = (const fe_hair_strand_t*)fe_array_get(comp->strands, k);
+        const fe_hair_particle_t* records = (const fe_hair_particle_t*)strand->particles->data;
+        uint32_t count = (uint32_t)fe_array_count(strand->particles);
+        size_t row = (size_t)(k / W) * stride;
+        uint32_t lane = k % W;
+
+        for (uint32_t i = 0; i < stride; ++i) {
+            uint32_t src = i < count ? i : count - 1; // Kısa teller ucun üstünde durur
+            size_t at = (row + i) * 3 * W + lane;
+            fe_vec3_t delta = {{0.0f, 0.0f, 0.0f}};
+            if (i == 0) {
+                delta = strand->rest_local[0];
+            } else if (i < count) {
+                delta = fe_vec3_subtract(strand->rest_local[i], strand->rest_local[i - 1]);
+            }
+            for (uint32_t c = 0; c < 3; ++c) {
+                s->position[at + c * W] = records[src].position.v[c];
+                s->prev_position[at + c * W] = records[src].prev_position.v[c];
+                s->rest_delta[at + c * W] = delta.v[c];
+            }
+            s->rest_length[(row + i) * W + lane] = (i > 0 && i < count) ? strand->rest_lengths[i - 1] : 0.0f;
+        }
+    }
+
+    s->stride = stride;
+    s->batch_count = batch_count;
+    s->built_count = strand_count;
+    return true;
+}
+
+/**
+ * @brief Bir grubun konumlarını tellerin parçacık kayıtlarına geri yazar.
+ */
+static void fe_hair_guides_store(fe_hair_component_t* comp, uint32_t batch) {
+    const fe_hair_guides_t* s = &comp->guides;
+    const uint32_t W = FE_HAIR_BATCH_WIDTH;
+    float inv_dt = 1.0f / s->dt;
+
+    for (uint32_t lane = 0; lane < W && batch * W + lane < s->built_count; ++lane) {
+        fe_hair_strand_t* strand = (fe_hair_strand_t*)fe_array_get(comp->strands, batch * W + lane);
+        fe_hair_particle_t* records = (fe_hair_particle_t*)strand->particles->data;
+        uint32_t count = (uint32_t)fe_array_count(strand->particles);
+        for (uint32_t i = 0; i < count; ++i) {
+            size_t at = ((size_t)batch * s->stride + i) * 3 * W + lane;
+            for (uint32_t c = 0; c < 3; ++c) {
+                records[i].position.v[c] = s->position[at + c * W];
+                records[i].prev_position.v[c] = s->prev_position[at + c * W];
+                records[i].velocity.v[c] = (records[i].position.v[c] - records[i].prev_position.v[c]) * inv_dt;
+            }
+        }
+    }
+}
+
+/*
+ * Dinamik FTL: i. parçacık tahmin edilir (q), kafa uzayındaki dinlenme şekline çekilir, sonra
+ * ebeveyninin (bu adımda zaten yerleşmiş) yönünde dinlenme uzunluğuna taşınır (p). Tel tek geçişte
+ * uzamaz. Düzeltme d_i = p_i - q_i'nin ftl_damping payı ebeveynin hızına eklenir; aksi halde
+ * uzunluk düzeltmesi hızdan silinir ve tel ağır görünür. Hız önceki konumda tutulduğundan
+ * ebeveynin önceki konumu x_{i-1} + ftl_damping * d_i olur. Kök kinematiktir (d eklenmez).
+ */
+
+#ifdef FE_SIMD_WIDTH
+/**
+ * @brief Bir grubun FE_HAIR_BATCH_WIDTH telini kökten uca birlikte çözer (FE_SIMD_WIDTH şerit bir arada).
+ */
+static void fe_hair_ftl_batch(fe_hair_guides_t* s, uint32_t batch) {
+    const uint32_t W = FE_HAIR_BATCH_WIDTH;
+    size_t row = (size_t)batch * s->stride;
+    float dt_sq = s->dt * s->dt;
+
+    fe_simd_t rows[3][3], head[3], gravity[3];
+    for (int a = 0; a < 3; ++a) {
+        for (int b = 0; b < 3; ++b) rows[a][b] = fe_simd_set1(s->head_rows[a].v[b]);
+        head[a] = fe_simd_set1(s->head_position.v[a]);
+        gravity[a] = fe_simd_set1(s->gravity.v[a] * dt_sq);
+    }
+    fe_simd_t damping = fe_simd_set1(s->damping);
+    fe_simd_t stiffness = fe_simd_set1(s->shape_stiffness);
+    fe_simd_t share = fe_simd_set1(s->ftl_damping);
+    fe_simd_t min_length = fe_simd_set1(FE_HAIR_MIN_LENGTH);
+    fe_simd_t zero = fe_simd_zero();
+
+    for (uint32_t lane = 0; lane < W; lane += FE_SIMD_WIDTH) {
+        fe_simd_t parent[3] = { zero, zero, zero }, parent_old[3] = { zero, zero, zero };
+
+        for (uint32_t i = 0; i < s->stride; ++i) {
+            float* pos = s->position + (row + i) * 3 * W + lane;
+            float* prev = s->prev_position + (row + i) * 3 * W + lane;
+            const float* local = s->rest_delta + (row + i) * 3 * W + lane;
+            fe_simd_t lx = fe_simd_load(local), ly = fe_simd_load(local + W), lz = fe_simd_load(local + 2 * W);
+            fe_simd_t x[3], rest[3], p[3];
+            for (int c = 0; c < 3; ++c) {
+                x[c] = fe_simd_load(pos + c * W);
+                rest[c] = fe_simd_add(fe_simd_add(fe_simd_mul(rows[c][0], lx), fe_simd_mul(rows[c][1], ly)), fe_simd_mul(rows[c][2], lz));
+            }
+
+            if (i == 0) {
+                for (int c = 0; c < 3; ++c) p[c] = fe_simd_add(head[c], rest[c]);
+            } else {
+                fe_simd_t length = fe_simd_load(s->rest_length + (row + i) * W + lane);
+                fe_simd_t q[3], dir[3];
+                for (int c = 0; c < 3; ++c) {
+                    fe_simd_t v = fe_simd_sub(x[c], fe_simd_load(prev + c * W));
+                    q[c] = fe_simd_add(fe_simd_add(x[c], fe_simd_mul(v, damping)), gravity[c]);
+                    q[c] = fe_simd_add(q[c], fe_simd_mul(fe_simd_sub(fe_simd_add(parent[c], rest[c]), q[c]), stiffness));
+                    dir[c] = fe_simd_sub(q[c], parent[c]);
+                }
+                fe_simd_t len = fe_simd_sqrt(fe_simd_add(fe_simd_add(fe_simd_mul(dir[0], dir[0]), fe_simd_mul(dir[1], dir[1])),
+                                                         fe_simd_mul(dir[2], dir[2])));
+                fe_simd_t valid = fe_simd_gt(len, min_length);
+                fe_simd_t scale = fe_simd_div(length, fe_simd_max(len, min_length));
+                fe_simd_t lane_share = i > 1 ? fe_simd_and(fe_simd_gt(length, zero), share) : zero; // Dolgu parçacıkları ebeveyni etkilemez
+
+                float* parent_prev = prev - 3 * W;
+                for (int c = 0; c < 3; ++c) {
+                    p[c] = fe_simd_select(valid, fe_simd_add(parent[c], fe_simd_mul(dir[c], scale)), fe_simd_add(parent[c], rest[c]));
+                    fe_simd_store(parent_prev + c * W, fe_simd_add(parent_old[c], fe_simd_mul(fe_simd_sub(p[c], q[c]), lane_share)));
+                }
+            }
+
+            for (int c = 0; c < 3; ++c) {
+                fe_simd_store(pos + c * W, p[c]);
+                parent[c] = p[c];
+                parent_old[c] = x[c];
+            }
+        }
+
+        float* tip_prev = s->prev_position + (row + s->stride - 1) * 3 * W + lane;
+        for (int c = 0; c < 3; ++c) fe_simd_store(tip_prev + c * W, parent_old[c]);
+    }
+}
+#else
+/**
+ * @brief Bir grubun tek bir telini kökten uca çözer (SIMD olmayan hedefler).
+ */
+static void fe_hair_ftl_lane(fe_hair_guides_t* s, uint32_t batch, uint32_t lane) {
+    const uint32_t W = FE_HAIR_BATCH_WIDTH;
+    size_t row = (size_t)batch * s->stride;
+    float dt_sq = s->dt * s->dt;
+    fe_vec3_t parent = {{0.0f, 0.0f, 0.0f}}, parent_old = {{0.0f, 0.0f, 0.0f}};
+
+    for (uint32_t i = 0; i < s->stride; ++i) {
+        size_t at = (row + i) * 3 * W + lane;
+        float length = s->rest_length[(row + i) * W + lane];
+        fe_vec3_t x, prev, local, rest, p;
+        for (uint32_t c = 0; c < 3; ++c) {
+            x.v[c] = s->position[at + c * W];
+            prev.v[c] = s->prev_position[at + c * W];
+            local.v[c] = s->rest_delta[at + c * W];
+        }
+        for (int c = 0; c < 3; ++c) {
+            rest.v[c] = s->head_rows[c].x * local.x + s->head_rows[c].y * local.y + s->head_rows[c].z * local.z;
+        }
+
+        if (i == 0) {
+            p = fe_vec3_add(s->head_position, rest);
+        } else {
+            fe_vec3_t q, dir;
+            for (int c = 0; c < 3; ++c) {
+                q.v[c] = x.v[c] + (x.v[c] - prev.v[c]) * s->damping + s->gravity.v[c] * dt_sq;
+                q.v[c] += (parent.v[c] + rest.v[c] - q.v[c]) * s->shape_stiffness;
+                dir.v[c] = q.v[c] - parent.v[c];
+            }
+            float len = sqrtf(dir.x * dir.x + dir.y * dir.y + dir.z * dir.z);
+            p = len > FE_HAIR_MIN_LENGTH ? fe_vec3_add(parent, fe_vec3_scale(dir, length / len)) : fe_vec3_add(parent, rest);
+
+            float share = (i > 1 && length > 0.0f) ? s->ftl_damping : 0.0f; // Dolgu parçacıkları ebeveyni etkilemez
+            for (uint32_t c = 0; c < 3; ++c) {
+                s->prev_position[at - 3 * W + c * W] = parent_old.v[c] + (p.v[c] - q.v[c]) * share;
+            }
+        }
+
+        for (uint32_t c = 0; c < 3; ++c) s->position[at + c * W] = p.v[c];
+        parent = p;
+        parent_old = x;
+    }
+
+    size_t tip = (row + s->stride - 1) * 3 * W + lane;
+    for (uint32_t c = 0; c < 3; ++c) s->prev_position[tip + c * W] = parent_old.v[c];
+}
+#endif
+
+static void fe_hair_ftl_range(void* data, uint32_t begin, uint32_t end) {
+    fe_hair_component_t* comp = (fe_hair_component_t*)data;
+    for (uint32_t batch = begin; batch < end; ++batch) {
+#ifdef FE_SIMD_WIDTH
+        fe_hair_ftl_batch(&comp->guides, batch);
+#else
+        for (uint32_t lane = 0; lane < FE_HAIR_BATCH_WIDTH; ++lane) fe_hair_ftl_lane(&comp->guides, batch, lane);
+#endif
+        fe_hair_guides_store(comp, batch);
+    }
+}
+
+/**
+ * @brief FTL adımı: kılavuz gruplar iş sistemine dağıtılır.
+ */
+static void fe_hair_simulate_step_ftl(fe_hair_component_t* comp, fe_vec3_t gravity, float dt) {
+    fe_hair_guides_t* s = &comp->guides;
+    if (s->built_count != fe_array_count(comp->strands) && !fe_hair_guides_build(comp)) return;
+    if (s->batch_count == 0) return;
+
+    fe_physics_quat_to_rows(comp->head_rb->orientation, s->head_rows);
+    s->head_position = comp->head_rb->position;
+    s->gravity = gravity;
+    s->dt = dt;
+    s->damping = comp->damping_factor;
+    s->ftl_damping = comp->ftl_damping;
+    s->shape_stiffness = comp->stiffness_bend;
+
+    fe_job_parallel_for(s->batch_count, FE_HAIR_BATCH_GRAIN, fe_hair_ftl_range, comp);
+}
+
+/**
+ * Uygulama: fe_hair_simulate_step
+ */
+void fe_hair_simulate_step(fe_hair_component_t* comp, fe_vec3_t gravity, float dt) {
+    if (!comp || !comp->is_active || dt <= 0.0f) return;
+
+    if (comp->solver_type == FE_HAIR_SOLVER_PBD) {
+        fe_hair_simulate_step_pbd(comp, gravity, dt);
+        comp->guides.built_count = UINT32_MAX; // Kayıtlar değişti: FTL ve render telleri yeniden yükler
+    } else {
+        fe_hair_simulate_step_ftl(comp, gravity, dt);
+    }
+}
+
+// ----------------------------------------------------------------------
+// 6. RENDER TELLERİ
+// ----------------------------------------------------------------------
+
+/**
+ * @brief xorshift32; [0, 1) aralığında sayı döndürür.
+ */
+static inline float fe_hair_random(uint32_t* state) {
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return (float)(x >> 8) * (1.0f / 16777216.0f);
+}
+
+static inline uint32_t fe_hair_random_seed(uint32_t seed) {
+    uint32_t state = seed ^ 0x9E3779B9u;
+    return state ? state : 1u; // xorshift sıfırda takılır
+}
+
+/**
+ * Uygulama: fe_hair_add_render_strands
+ */
+bool fe_hair_add_render_strands(fe_hair_component_t* comp, const fe_hair_render_strand_t* strands, uint32_t count) {
+    if (!comp || (!strands && count > 0)) return false;
+
+    uint32_t guide_count = (uint32_t)fe_array_count(comp->strands);
+    for (uint32_t r = 0; r < count; ++r) {
+        for (uint32_t g = 0; g < FE_HAIR_RENDER_GUIDES; ++g) {
+            if (strands[r].guides[g] >= guide_count) {
+                FE_LOG_ERROR("Render teli %u gecersiz kilavuz tele (%u) bagli.", r, strands[r].guides[g]);
+                return false;
+            }
+        }
+    }
+
+    size_t old_count = comp->render_strands->count;
+    for (uint32_t r = 0; r < count; ++r) {
+        if (!fe_array_push(comp->render_strands, &strands[r])) {
+            comp->render_strands->count = old_count;
+            FE_LOG_ERROR("Render telleri icin bellek ayrilamadi.");
+            return false;
+        }
+    }
+    if (count > 0) comp->render_strands_revision++;
+    return true;
+}
+
+/**
+ * Uygulama: fe_hair_generate_clump_strands
+ */
+uint32_t fe_hair_generate_clump_strands(fe_hair_component_t* comp, uint32_t strands_per_guide, float radius, float clump, uint32_t seed) {
+    if (!comp) return 0;
+
+    uint32_t state = fe_hair_random_seed(seed);
+    uint32_t guide_count = (uint32_t)fe_array_count(comp->strands);
+    uint32_t added = 0;
+    for (uint32_t g = 0; g < guide_count; ++g) {
+        const fe_hair_strand_t* strand = (const fe_hair_strand_t*)fe_array_get(comp->strands, g);
+
+        // Kökteki parçaya dik disk (kafa uzayında)
+        fe_vec3_t axis = fe_vec3_normalize(fe_vec3_subtract(strand->rest_local[1], strand->rest_local[0]));
+        fe_vec3_t helper = fabsf(axis.y) < 0.9f ? (fe_vec3_t){{0.0f, 1.0f, 0.0f}} : (fe_vec3_t){{1.0f, 0.0f, 0.0f}};
+        fe_vec3_t t1 = fe_vec3_normalize(fe_vec3_cross(axis, helper));
+        fe_vec3_t t2 = fe_vec3_cross(axis, t1);
+
+        for (uint32_t j = 0; j < strands_per_guide; ++j) {
+            float r = radius * sqrtf(fe_hair_random(&state)); // Disk üzerinde düzgün dağılım
+            float angle = 6.28318531f * fe_hair_random(&state);
+            fe_hair_render_strand_t rs = {
+                { g, g, g }, { 1.0f, 0.0f, 0.0f },
+                fe_vec3_add(fe_vec3_scale(t1, r * cosf(angle)), fe_vec3_scale(t2, r * sinf(angle))),
+                clump
+            };
+            if (!fe_array_push(comp->render_strands, &rs)) goto done;
+            added++;
+        }
+    }
+
+done:
+    if (added > 0) comp->render_strands_revision++;
+    return added;
+}
+
+/**
+ * Uygulama: fe_hair_generate_barycentric_strands
+ */
+uint32_t fe_hair_generate_barycentric_strands(fe_hair_component_t* comp, const uint32_t* triangles, uint32_t triangle_count,
+                                              uint32_t strands_per_triangle, uint32_t seed) {
+    if (!comp || !triangles) return 0;
+
+    uint32_t state = fe_hair_random_seed(seed);
+    uint32_t guide_count = (uint32_t)fe_array_count(comp->strands);
+    uint32_t added = 0;
+    for (uint32_t t = 0; t < triangle_count; ++t) {
+        const uint32_t* tri = &triangles[3 * t];
+        if (tri[0] >= guide_count || tri[1] >= guide_count || tri[2] >= guide_count) {
+            FE_LOG_WARN("Kilavuz ucgeni %u gecersiz indeks iceriyor, atlandi.", t);
+            continue;
+        }
+        for (uint32_t j = 0; j < strands_per_triangle; ++j) {
+            float u = fe_hair_random(&state), v = fe_hair_random(&state);
+            if (u + v > 1.0f) { // Paralelkenarın dışındaki yarı üçgene geri katla
+                u = 1.0f - u;
+                v = 1.0f - v;
+            }
+            fe_hair_render_strand_t rs = {
+                { tri[0], tri[1], tri[2] }, { 1.0f - u - v, u, v },
+                {{ 0.0f, 0.0f, 0.0f }}, 0.0f
+            };
+            if (!fe_array_push(comp->render_strands, &rs)) goto done;
+            added++;
+        }
+    }
+
+done:
+    if (added > 0) comp->render_strands_revision++;
+    return added;
+}
+
+/**
+ * @brief Kılavuz konumlarını şerit düzeninden tel başına ardışık düzene kopyalar.
+ */
+static void fe_hair_pack_range(void* data, uint32_t begin, uint32_t end) {
+    fe_hair_guides_t* s = (fe_hair_guides_t*)data;
+    const uint32_t W = FE_HAIR_BATCH_WIDTH;
+    for (uint32_t batch = begin; batch < end; ++batch) {
+        for (uint32_t lane = 0; lane < W; ++lane) {
+            fe_vec3_t* out = s->packed + ((size_t)batch * W + lane) * s->stride;
+            for (uint32_t i = 0; i < s->stride; ++i) {
+                const float* in = s->position + ((size_t)batch * s->stride + i) * 3 * W + lane;
+                out[i] = (fe_vec3_t){{in[0], in[W], in[2 * W]}};
+            }
+        }
+    }
+}
+
+#ifdef FE_SIMD_WIDTH
+/**
+ * @brief Bir render telinin [k, k + FE_SIMD_WIDTH) float'larını karıştırır.
+ * * out = w0 * a + w1 * b + w2 * c + tiled * (1 - slope * tepe indeksi); tiled, sapmanın bu kayda düşen desenidir.
+ */
+static inline void fe_hair_blend(float* out, const float* a, const float* b, const float* c, const float* vertex, uint32_t k,
+                                 fe_simd_t w0, fe_simd_t w1, fe_simd_t w2, fe_simd_t slope, fe_simd_t tiled) {
+    fe_simd_t sum = fe_simd_add(fe_simd_add(fe_simd_mul(w0, fe_simd_load(a + k)), fe_simd_mul(w1, fe_simd_load(b + k))),
+                                fe_simd_mul(w2, fe_simd_load(c + k)));
+    fe_simd_t offset = fe_simd_sub(tiled, fe_simd_mul(fe_simd_mul(tiled, slope), fe_simd_load(vertex + k)));
+    fe_simd_store(out + k, fe_simd_add(sum, offset));
+}
+#endif
+
+static void fe_hair_render_range(void* data, uint32_t begin, uint32_t end) {
+    fe_hair_component_t* comp = (fe_hair_component_t*)data;
+    const fe_hair_guides_t* s = &comp->guides;
+    const fe_hair_render_strand_t* strands = (const fe_hair_render_strand_t*)comp->render_strands->data;
+    uint32_t n = s->stride;
+    uint32_t floats = 3 * n;
+
+    // Tel bir float dizisi olarak karıştırılır; k. float'ın tepe indeksi (sapmanın incelmesi için)
+    float vertex[3 * FE_MAX_STRAND_PARTICLES];
+    for (uint32_t k = 0; k < floats; ++k) vertex[k] = (float)(k / 3);
+
+#ifdef FE_SIMD_WIDTH
+    // Dünya sapması 3 float'ta bir tekrarlar; 3 * FE_SIMD_WIDTH float'lık desen üç kayda sığar.
+    // rot[m][j]: kafa uzayındaki m. eksenin dünya bileşenlerinin j. kayıttaki deseni
+    fe_simd_t rot[3][3];
+    float pattern[3 * FE_SIMD_WIDTH];
+    for (uint32_t m = 0; m < 3; ++m) {
+        for (uint32_t q = 0; q < 3 * FE_SIMD_WIDTH; ++q) pattern[q] = s->head_rows[q % 3].v[m];
+        for (uint32_t j = 0; j < 3; ++j) rot[m][j] = fe_simd_load(pattern + j * FE_SIMD_WIDTH);
+    }
+#endif
+
+    for (uint32_t r = begin; r < end; ++r) {
+        const fe_hair_render_strand_t* rs = &strands[r];
+        const float* a = (const float*)(s->packed + (size_t)rs->guides[0] * n);
+        const float* b = (const float*)(s->packed + (size_t)rs->guides[1] * n);
+        const float* c = (const float*)(s->packed + (size_t)rs->guides[2] * n);
+        float w0 = rs->weights[0], w1 = rs->weights[1], w2 = rs->weights[2];
+        float* out = (float*)(comp->render_positions + (size_t)r * n);
+
+        // Demet sapması dünya uzayında; kökte tam, uca doğru (1 - clump) katına iner
+        float offset[3];
+        for (int m = 0; m < 3; ++m) {
+            offset[m] = s->head_rows[m].x * rs->root_offset.x + s->head_rows[m].y * rs->root_offset.y + s->head_rows[m].z * rs->root_offset.z;
+        }
+        float taper = n > 1 ? rs->clump / (float)(n - 1) : 0.0f;
+
+        uint32_t k = 0;
+#ifdef FE_SIMD_WIDTH
+        fe_simd_t lx = fe_simd_set1(rs->root_offset.x), ly = fe_simd_set1(rs->root_offset.y), lz = fe_simd_set1(rs->root_offset.z);
+        fe_simd_t t0 = fe_simd_add(fe_simd_add(fe_simd_mul(rot[0][0], lx), fe_simd_mul(rot[1][0], ly)), fe_simd_mul(rot[2][0], lz));
+        fe_simd_t t1 = fe_simd_add(fe_simd_add(fe_simd_mul(rot[0][1], lx), fe_simd_mul(rot[1][1], ly)), fe_simd_mul(rot[2][1], lz));
+        fe_simd_t t2 = fe_simd_add(fe_simd_add(fe_simd_mul(rot[0][2], lx), fe_simd_mul(rot[1][2], ly)), fe_simd_mul(rot[2][2], lz));
+        fe_simd_t v0 = fe_simd_set1(w0), v1 = fe_simd_set1(w1), v2 = fe_simd_set1(w2);
+        fe_simd_t slope = fe_simd_set1(taper);
+        for (; k + 3 * FE_SIMD_WIDTH <= floats; k += 3 * FE_SIMD_WIDTH) {
+            fe_hair_blend(out, a, b, c, vertex, k, v0, v1, v2, slope, t0);
+            fe_hair_blend(out, a, b, c, vertex, k + FE_SIMD_WIDTH, v0, v1, v2, slope, t1);
+            fe_hair_blend(out, a, b, c, vertex, k + 2 * FE_SIMD_WIDTH, v0, v1, v2, slope, t2);
+        }
+        if (k + FE_SIMD_WIDTH <= floats) {
+            fe_hair_blend(out, a, b, c, vertex, k, v0, v1, v2, slope, t0);
+            k += FE_SIMD_WIDTH;
+            if (k + FE_SIMD_WIDTH <= floats) {
+                fe_hair_blend(out, a, b, c, vertex, k, v0, v1, v2, slope, t1);
+                k += FE_SIMD_WIDTH;
+            }
+        }
+#endif
+        for (; k < floats; ++k) {
+            out[k] = w0 * a[k] + w1 * b[k] + w2 * c[k] + offset[k % 3] * (1.0f - taper * vertex[k]);
+        }
+    }
+}
+
+/**
+ * Uygulama: fe_hair_update_render_guides
+ */
+bool fe_hair_update_render_guides(fe_hair_component_t* comp) {
+    if (!comp) return false;
+
+    fe_hair_guides_t* s = &comp->guides;
+    if (s->built_count != fe_array_count(comp->strands) && !fe_hair_guides_build(comp)) return false;
+
+    // Sapmalar kafanın o anki yönelimiyle döner
+    fe_physics_quat_to_rows(comp->head_rb->orientation, s->head_rows);
+    fe_job_parallel_for(s->batch_count, FE_HAIR_BATCH_GRAIN, fe_hair_pack_range, s);
+    return true;
+}
+
+/**
+ * Uygulama: fe_hair_update_render_strands
+ */
+bool fe_hair_update_render_strands(fe_hair_component_t* comp) {
+    if (!fe_hair_update_render_guides(comp)) return false;
+
+    fe_hair_guides_t* s = &comp->guides;
+    uint32_t render_count = (uint32_t)fe_array_count(comp->render_strands);
+    size_t vertex_count = (size_t)render_count * s->stride;
+    if (vertex_count > comp->render_capacity) {
+        fe_vec3_t* positions = (fe_vec3_t*)fe_mem_realloc(comp->render_positions, vertex_count * sizeof(fe_vec3_t));
+        if (!positions) {
+            FE_LOG_ERROR("Render tel tepeleri icin bellek ayrilamadi (%u tel).", render_count);
+            return false;
+        }
+        comp->render_positions = positions;
+        comp->render_capacity = (uint32_t)vertex_count;
+    }
+    comp->render_vertex_count = s->stride;
+
+    if (render_count == 0) return true;
+
+    fe_job_parallel_for(render_count, FE_HAIR_RENDER_GRAIN, fe_hair_render_range, comp);
+    return true;
+}
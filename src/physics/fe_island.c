@@ -0,0 +1,248 @@
+// src/physics/fe_island.c
+
+#include "physics/fe_island.h"
+#include "utils/fe_logger.h"
+#include "memory/fe_memory_manager.h" // fe_mem_realloc, fe_mem_free
+#include <string.h> // memset, memcpy
+#include <float.h>  // FLT_MAX
+
+#define FE_ISLAND_INITIAL_CAPACITY 256
+
+// ----------------------------------------------------------------------
+// 1. YARDIMCI FONKSİYONLAR
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Cisim bu adımda adalara katılıyor mu? (Uyanık, dinamik ve uyanık listede)
+ */
+static inline bool fe_island_is_member(const fe_rigid_body_t* rb, uint32_t body_count) {
+    return rb->is_awake && !rb->is_kinematic && rb->inverse_mass > 0.0f && rb->awake_index < body_count;
+}
+
+static inline uint32_t fe_island_find(uint32_t* parent, uint32_t i) {
+    while (parent[i] != i) {
+        parent[i] = parent[parent[i]]; // Yol yarılama
+        i = parent[i];
+    }
+    return i;
+}
+
+/**
+ * @brief İki kümeyi birleştirir. Kök her zaman küçük indeks olur (kurulum sırası bunu kullanır).
+ */
+static inline void fe_island_union(uint32_t* parent, uint32_t a, uint32_t b) {
+    uint32_t ra = fe_island_find(parent, a);
+    uint32_t rb = fe_island_find(parent, b);
+    if (ra < rb) {
+        parent[rb] = ra;
+    } else if (rb < ra) {
+        parent[ra] = rb;
+    }
+}
+
+static bool fe_island_grow(uint32_t** array, uint32_t count) {
+    uint32_t* grown = (uint32_t*)fe_mem_realloc(*array, count * sizeof(uint32_t));
+    if (!grown) return false;
+    *array = grown;
+    return true;
+}
+
+static bool fe_island_reserve(fe_island_manager_t* im, uint32_t body_count, uint32_t constraint_count) {
+    if (body_count > im->body_capacity) {
+        uint32_t capacity = im->body_capacity ? im->body_capacity : FE_ISLAND_INITIAL_CAPACITY;
+        while (capacity < body_count) capacity *= 2;
+        // Ada sayısı en fazla cisim sayısı kadardır; başlangıç dizileri bir eleman fazladır.
+        if (!fe_island_grow(&im->parent, capacity) || !fe_island_grow(&im->island_of, capacity) ||
+            !fe_island_grow(&im->body_order, capacity) || !fe_island_grow(&im->body_start, capacity + 1) ||
+            !fe_island_grow(&im->constraint_start, capacity + 1)) {
+            return false;
+        }
+        im->body_capacity = capacity;
+    }
+    if (constraint_count > im->constraint_capacity) {
+        uint32_t capacity = im->constraint_capacity ? im->constraint_capacity : FE_ISLAND_INITIAL_CAPACITY;
+        while (capacity < constraint_count) capacity *= 2;
+        if (!fe_island_grow(&im->constraint_order, capacity)) return false;
+        im->constraint_capacity = capacity;
+    }
+    return true;
+}
+
+/**
+ * @brief Manifoldun ait olduğu ada (simüle edilen ucun adası).
+ */
+static inline uint32_t fe_island_of_constraint(const fe_island_manager_t* im, const fe_contact_constraint_t* c, uint32_t body_count) {
+    const fe_rigid_body_t* owner = fe_island_is_member(c->body_a, body_count) ? c->body_a : c->body_b;
+    return im->island_of[owner->awake_index];
+}
+
+
+// ----------------------------------------------------------------------
+// 2. YÖNETİM UYGULAMALARI
+// ----------------------------------------------------------------------
+
+/**
+ * Uygulama: fe_island_manager_init
+ */
+fe_error_code_t fe_island_manager_init(fe_island_manager_t* im) {
+    if (!im) return FE_ERR_INVALID_ARGUMENT;
+    memset(im, 0, sizeof(*im));
+
+    if (!fe_island_reserve(im, FE_ISLAND_INITIAL_CAPACITY, FE_ISLAND_INITIAL_CAPACITY)) {
+        FE_LOG_ERROR("Ada yoneticisi icin bellek ayrilamadi.");
+        fe_island_manager_destroy(im);
+        return FE_ERR_MEMORY_ALLOCATION;
+    }
+    im->body_start[0] = 0;
+    im->constraint_start[0] = 0;
+    return FE_OK;
+}
+
+/**
+ * Uygulama: fe_island_manager_destroy
+ */
+void fe_island_manager_destroy(fe_island_manager_t* im) {
+    if (!im) return;
+    fe_mem_free(im->parent);
+    fe_mem_free(im->island_of);
+    fe_mem_free(im->body_order);
+    fe_mem_free(im->body_start);
+    fe_mem_free(im->constraint_order);
+    fe_mem_free(im->constraint_start);
+    memset(im, 0, sizeof(*im));
+}
+
+/**
+ * Uygulama: fe_island_manager_build
+ */
+void fe_island_manager_build(fe_island_manager_t* im, uint32_t body_count, const fe_collision_solver_t* solver,
+                             const uint32_t* body_pairs, uint32_t pair_count) {
+    im->island_count = 0;
+
+    uint32_t active_count = 0;
+    const uint32_t* active = fe_collision_solver_get_active(solver, &active_count);
+    if (!fe_island_reserve(im, body_count, active_count)) {
+        FE_LOG_ERROR("Ada yoneticisi: diziler buyutulemedi, adalar kurulamadi.");
+        return;
+    }
+
+    // 1. Birleşim-bul: temas eden iki simüle edilen cismi aynı kümeye al
+    uint32_t* parent = im->parent;
+    for (uint32_t i = 0; i < body_count; ++i) parent[i] = i;
+
+    for (uint32_t k = 0; k < active_count; ++k) {
+        const fe_contact_constraint_t* c = &solver->constraints[active[k]];
+        if (c->point_count == 0) continue;
+        if (fe_island_is_member(c->body_a, body_count) && fe_island_is_member(c->body_b, body_count)) {
+            fe_island_union(parent, c->body_a->awake_index, c->body_b->awake_index);
+        }
+    }
+
+    // Eklemler de birleştirir: bağlı cisimler birlikte uyumalı (biri uyurken diğeri onu çekemez)
+    for (uint32_t k = 0; k < pair_count; ++k) {
+        uint32_t a = body_pairs[2 * k];
+        uint32_t b = body_pairs[2 * k + 1];
+        if (a < body_count && b < body_count) fe_island_union(parent, a, b);
+    }
+
+    // 2. Ada indeksleri: kök her zaman kümenin en küçük yeri olduğundan artan sırada ilk görülür
+    for (uint32_t i = 0; i < body_count; ++i) {
+        uint32_t root = fe_island_find(parent, i);
+        im->island_of[i] = (root == i) ? im->island_count++ : im->island_of[root];
+    }
+    uint32_t island_count = im->island_count;
+
+    // 3. Cisimleri adalara göre grupla (sayma sıralaması; ada içinde sıra korunur)
+    memset(im->body_start, 0, (island_count + 1) * sizeof(uint32_t));
+    for (uint32_t i = 0; i < body_count; ++i) im->body_start[im->island_of[i] + 1]++;
+    for (uint32_t s = 0; s < island_count; ++s) im->body_start[s + 1] += im->body_start[s];
+
+    uint32_t* cursor = parent; // Birleşim-bul ormanı artık gerekmiyor
+    memcpy(cursor, im->body_start, island_count * sizeof(uint32_t));
+    for (uint32_t i = 0; i < body_count; ++i) im->body_order[cursor[im->island_of[i]]++] = i;
+
+    // 4. Manifoldları adalara göre grupla (en az bir ucu simüle edilen ve noktası olanlar)
+    memset(im->constraint_start, 0, (island_count + 1) * sizeof(uint32_t));
+    for (uint32_t k = 0; k < active_count; ++k) {
+        const fe_contact_constraint_t* c = &solver->constraints[active[k]];
+        if (c->point_count == 0) continue;
+        if (!fe_island_is_member(c->body_a, body_count) && !fe_island_is_member(c->body_b, body_count)) continue;
+        im->constraint_start[fe_island_of_constraint(im, c, body_count) + 1]++;
+    }
+    for (uint32_t s = 0; s < island_count; ++s) im->constraint_start[s + 1] += im->constraint_start[s];
+
+    memcpy(cursor, im->constraint_start, island_count * sizeof(uint32_t));
+    for (uint32_t k = 0; k < active_count; ++k) {
+        const fe_contact_constraint_t* c = &solver->constraints[active[k]];
+        if (c->point_count == 0) continue;
+        if (!fe_island_is_member(c->body_a, body_count) && !fe_island_is_member(c->body_b, body_count)) continue;
+        im->constraint_order[cursor[fe_island_of_constraint(im, c, body_count)]++] = active[k];
+    }
+}
+
+/**
+ * Uygulama: fe_island_manager_update_sleep
+ */
+uint32_t fe_island_manager_update_sleep(fe_island_manager_t* im, fe_rigid_body_t* const* bodies, float dt) {
+    const float linear_tolerance_sq = FE_ISLAND_SLEEP_LINEAR_TOLERANCE * FE_ISLAND_SLEEP_LINEAR_TOLERANCE;
+    const float angular_tolerance_sq = FE_ISLAND_SLEEP_ANGULAR_TOLERANCE * FE_ISLAND_SLEEP_ANGULAR_TOLERANCE;
+    uint32_t slept = 0;
+
+    for (uint32_t s = 0; s < im->island_count; ++s) {
+        uint32_t begin = im->body_start[s];
+        uint32_t end = im->body_start[s + 1];
+
+        // Adanın en kısa dinlenme süresi
+        float min_sleep_time = FLT_MAX;
+        for (uint32_t k = begin; k < end; ++k) {
+            fe_rigid_body_t* rb = bodies[im->body_order[k]];
+            if (fe_vec3_length_sq(rb->linear_velocity) > linear_tolerance_sq ||
+                fe_vec3_length_sq(rb->angular_velocity) > angular_tolerance_sq) {
+                rb->sleep_time = 0.0f;
+            } else {
+                rb->sleep_time += dt;
+            }
+            if (rb->sleep_time < min_sleep_time) min_sleep_time = rb->sleep_time;
+        }
+        if (min_sleep_time < FE_ISLAND_TIME_TO_SLEEP) continue;
+
+        // Adayı uyut: cisimleri halka listeye bağla
+        fe_rigid_body_t* first = bodies[im->body_order[begin]];
+        for (uint32_t k = begin; k < end; ++k) {
+            fe_rigid_body_t* rb = bodies[im->body_order[k]];
+            rb->island_next = (k + 1 < end) ? bodies[im->body_order[k + 1]] : first;
+            rb->is_awake = false;
+            rb->sleep_time = 0.0f;
+            rb->linear_velocity = (fe_vec3_t){{0.0f, 0.0f, 0.0f}};
+            rb->angular_velocity = (fe_vec3_t){{0.0f, 0.0f, 0.0f}};
+            rb->total_force = (fe_vec3_t){{0.0f, 0.0f, 0.0f}};
+            rb->total_torque = (fe_vec3_t){{0.0f, 0.0f, 0.0f}};
+        }
+        slept += end - begin;
+    }
+
+    return slept;
+}
+
+/**
+ * Uygulama: fe_island_wake
+ */
+uint32_t fe_island_wake(fe_rigid_body_t* rb, void (*on_wake)(fe_rigid_body_t* rb, void* context), void* context) {
+    // Halka yoksa cisim ya zaten uyanık ya da bir yöneticide değil
+    if (!rb || !rb->island_next) return 0;
+
+    uint32_t woken = 0;
+    fe_rigid_body_t* it = rb;
+    do {
+        fe_rigid_body_t* next = it->island_next;
+        it->island_next = NULL;
+        it->is_awake = true;
+        it->sleep_time = 0.0f;
+        if (on_wake) on_wake(it, context);
+        woken++;
+        it = next;
+    } while (it != rb);
+
+    return woken;
+}
+
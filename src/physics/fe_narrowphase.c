@@ -0,0 +1,574 @@
+// src/physics/fe_narrowphase.c
+
+#include "physics/fe_narrowphase.h"
+#include <math.h>  // sqrtf, fabsf
+#include <float.h> // FLT_MAX
+
+#define FE_NP_EPSILON 1e-6f
+
+// Kutu-kutu SAT'ta kenar ekseninin/B yüzünün seçilmesi için gereken üstünlük (titremeyi önler)
+#define FE_NP_RELATIVE_TOLERANCE 0.95f
+#define FE_NP_ABSOLUTE_TOLERANCE 0.01f
+
+// Kırpılmış poligonun en fazla köşe sayısı (4 köşe + 4 kırpma düzlemi)
+#define FE_NP_MAX_CLIP_VERTICES 8
+
+// ----------------------------------------------------------------------
+// 1. YARDIMCI YAPILAR VE FONKSİYONLAR
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Bir geometrinin dünya uzayındaki yerleşimi (merkez ve yerel eksenler).
+ */
+typedef struct fe_np_frame {
+    fe_vec3_t center;
+    fe_vec3_t axis[3];
+} fe_np_frame_t;
+
+static void fe_np_make_frame(const fe_collider_t* collider, fe_vec3_t position, fe_vec4_t orientation, fe_np_frame_t* out) {
+    fe_vec3_t rows[3];
+    fe_physics_quat_to_rows(orientation, rows);
+    for (int i = 0; i < 3; ++i) {
+        out->axis[i] = (fe_vec3_t){{rows[0].v[i], rows[1].v[i], rows[2].v[i]}};
+        out->center.v[i] = position.v[i] + fe_vec3_dot(rows[i], collider->local_offset);
+    }
+}
+
+static inline fe_vec3_t fe_np_madd(fe_vec3_t a, fe_vec3_t b, float s) {
+    return (fe_vec3_t){{a.x + b.x * s, a.y + b.y * s, a.z + b.z * s}};
+}
+
+static inline float fe_np_clamp(float value, float min, float max) {
+    return value < min ? min : (value > max ? max : value);
+}
+
+/**
+ * @brief İki yüzey noktasının ortasını temas noktası olarak ekler.
+ */
+static void fe_np_push_point(fe_narrowphase_manifold_t* m, fe_vec3_t on_a, fe_vec3_t on_b, float penetration) {
+    if (m->point_count >= FE_NARROWPHASE_MAX_POINTS) return;
+    fe_narrowphase_point_t* p = &m->points[m->point_count++];
+    p->position = fe_vec3_scale(fe_vec3_add(on_a, on_b), 0.5f);
+    p->penetration = penetration;
+}
+
+static void fe_np_capsule_segment(const fe_np_frame_t* frame, float half_height, fe_vec3_t* out_p0, fe_vec3_t* out_p1) {
+    *out_p0 = fe_np_madd(frame->center, frame->axis[1], -half_height);
+    *out_p1 = fe_np_madd(frame->center, frame->axis[1], half_height);
+}
+
+/**
+ * @brief [p0, p1] doğru parçası üzerinde q'ya en yakın noktayı döndürür.
+ */
+static fe_vec3_t fe_np_closest_on_segment(fe_vec3_t p0, fe_vec3_t p1, fe_vec3_t q) {
+    fe_vec3_t d = fe_vec3_subtract(p1, p0);
+    float len_sq = fe_vec3_dot(d, d);
+    float t = (len_sq > FE_NP_EPSILON) ? fe_np_clamp(fe_vec3_dot(fe_vec3_subtract(q, p0), d) / len_sq, 0.0f, 1.0f) : 0.0f;
+    return fe_np_madd(p0, d, t);
+}
+
+/**
+ * @brief İki doğru parçası arasındaki en yakın nokta çiftini bulur.
+ */
+static void fe_np_closest_segments(fe_vec3_t p1, fe_vec3_t q1, fe_vec3_t p2, fe_vec3_t q2, fe_vec3_t* out_c1, fe_vec3_t* out_c2) {
+    fe_vec3_t d1 = fe_vec3_subtract(q1, p1);
+    fe_vec3_t d2 = fe_vec3_subtract(q2, p2);
+    fe_vec3_t r = fe_vec3_subtract(p1, p2);
+    float a = fe_vec3_dot(d1, d1);
+    float e = fe_vec3_dot(d2, d2);
+    float f = fe_vec3_dot(d2, r);
+    float s = 0.0f, t = 0.0f;
+
+    if (a <= FE_NP_EPSILON && e <= FE_NP_EPSILON) {
+        // İki parça da noktaya dejenere
+    } else if (a <= FE_NP_EPSILON) {
+        t = fe_np_clamp(f / e, 0.0f, 1.0f);
+    } else {
+        float c = fe_vec3_dot(d1, r);
+        if (e <= FE_NP_EPSILON) {
+            s = fe_np_clamp(-c / a, 0.0f, 1.0f);
+        } else {
+            float b = fe_vec3_dot(d1, d2);
+            float denom = a * e - b * b;
+            s = (denom > FE_NP_EPSILON) ? fe_np_clamp((b * f - c * e) / denom, 0.0f, 1.0f) : 0.0f;
+            t = (b * s + f) / e;
+            if (t < 0.0f) {
+                t = 0.0f;
+                s = fe_np_clamp(-c / a, 0.0f, 1.0f);
+            } else if (t > 1.0f) {
+                t = 1.0f;
+                s = fe_np_clamp((b - c) / a, 0.0f, 1.0f);
+            }
+        }
+    }
+
+    *out_c1 = fe_np_madd(p1, d1, s);
+    *out_c2 = fe_np_madd(p2, d2, t);
+}
+
+/**
+ * @brief n'ye dik herhangi bir birim vektör (normal tanımsız kaldığında yedek yön için).
+ */
+static fe_vec3_t fe_np_any_perpendicular(fe_vec3_t n) {
+    fe_vec3_t t = (fabsf(n.x) < 0.57735f) ? (fe_vec3_t){{0.0f, n.z, -n.y}} : (fe_vec3_t){{n.y, -n.x, 0.0f}};
+    return fe_vec3_normalize(t);
+}
+
+
+// ----------------------------------------------------------------------
+// 2. KÜRE VE KAPSÜL TEMASLARI
+// ----------------------------------------------------------------------
+
+/**
+ * @brief İki küre arasındaki temas. Normal a'dan b'ye.
+ */
+static void fe_np_sphere_sphere(fe_vec3_t ca, float ra, fe_vec3_t cb, float rb, float margin, fe_narrowphase_manifold_t* m) {
+    fe_vec3_t d = fe_vec3_subtract(cb, ca);
+    float dist_sq = fe_vec3_dot(d, d);
+    float reach = ra + rb + margin;
+    if (dist_sq > reach * reach) return;
+
+    float dist = sqrtf(dist_sq);
+    fe_vec3_t n = (dist > FE_NP_EPSILON) ? fe_vec3_scale(d, 1.0f / dist) : (fe_vec3_t){{0.0f, 1.0f, 0.0f}};
+
+    m->normal = n;
+    fe_np_push_point(m, fe_np_madd(ca, n, ra), fe_np_madd(cb, n, -rb), ra + rb - dist);
+}
+
+/**
+ * @brief Küre ile kutu arasındaki en derin temas.
+ * @param margin Öngörülü temas mesafesi (bu boşluktan yakın yüzeyler temas sayılır).
+ * @param out_normal Küreden kutuya doğru birim normal.
+ * @return Temas (veya öngörülü mesafe içinde yakınlık) varsa true.
+ */
+static bool fe_np_sphere_box_core(fe_vec3_t center, float radius, const fe_np_frame_t* box, fe_vec3_t h, float margin,
+                                  fe_vec3_t* out_normal, fe_vec3_t* out_on_sphere, fe_vec3_t* out_on_box, float* out_penetration) {
+    fe_vec3_t rel = fe_vec3_subtract(center, box->center);
+    float local[3];
+    bool inside = true;
+    for (int i = 0; i < 3; ++i) {
+        local[i] = fe_vec3_dot(rel, box->axis[i]);
+        if (fabsf(local[i]) > h.v[i]) inside = false;
+    }
+
+    if (inside) {
+        // Merkez kutunun içinde: en yakın yüzden dışarı it
+        int axis = 0;
+        float min_depth = FLT_MAX;
+        for (int i = 0; i < 3; ++i) {
+            float depth = h.v[i] - fabsf(local[i]);
+            if (depth < min_depth) {
+                min_depth = depth;
+                axis = i;
+            }
+        }
+        fe_vec3_t outward = fe_vec3_scale(box->axis[axis], local[axis] >= 0.0f ? 1.0f : -1.0f);
+        *out_normal = fe_vec3_negate(outward);
+        *out_on_box = fe_np_madd(center, outward, min_depth);
+        *out_on_sphere = fe_np_madd(center, outward, -radius);
+        *out_penetration = radius + min_depth;
+        return true;
+    }
+
+    fe_vec3_t closest = box->center;
+    for (int i = 0; i < 3; ++i) {
+        closest = fe_np_madd(closest, box->axis[i], fe_np_clamp(local[i], -h.v[i], h.v[i]));
+    }
+    fe_vec3_t diff = fe_vec3_subtract(center, closest);
+    float dist_sq = fe_vec3_dot(diff, diff);
+    float reach = radius + margin;
+    if (dist_sq > reach * reach) return false;
+
+    float dist = sqrtf(dist_sq);
+    fe_vec3_t outward = fe_vec3_scale(diff, 1.0f / dist); // dist > 0: merkez kutunun dışında
+    *out_normal = fe_vec3_negate(outward);
+    *out_on_box = closest;
+    *out_on_sphere = fe_np_madd(center, outward, -radius);
+    *out_penetration = radius - dist;
+    return true;
+}
+
+static void fe_np_sphere_box(fe_vec3_t center, float radius, const fe_np_frame_t* box, fe_vec3_t h, float margin, fe_narrowphase_manifold_t* m) {
+    fe_vec3_t n, on_sphere, on_box;
+    float penetration;
+    if (fe_np_sphere_box_core(center, radius, box, h, margin, &n, &on_sphere, &on_box, &penetration)) {
+        m->normal = n;
+        fe_np_push_point(m, on_sphere, on_box, penetration);
+    }
+}
+
+/**
+ * @brief İki kapsül arasındaki temas. Segmentler neredeyse paralelse iki nokta üretilir
+ * * (yan yana yatan kapsüller tek noktada dönüp durmaz).
+ */
+static void fe_np_capsule_capsule(const fe_np_frame_t* a, float ra, float hha, const fe_np_frame_t* b, float rb, float hhb,
+                                  float margin, fe_narrowphase_manifold_t* m) {
+    fe_vec3_t a0, a1, b0, b1, ca, cb;
+    fe_np_capsule_segment(a, hha, &a0, &a1);
+    fe_np_capsule_segment(b, hhb, &b0, &b1);
+    fe_np_closest_segments(a0, a1, b0, b1, &ca, &cb);
+
+    fe_vec3_t d = fe_vec3_subtract(cb, ca);
+    float dist_sq = fe_vec3_dot(d, d);
+    float reach = ra + rb + margin;
+    if (dist_sq > reach * reach) return;
+
+    float dist = sqrtf(dist_sq);
+    fe_vec3_t n = (dist > FE_NP_EPSILON) ? fe_vec3_scale(d, 1.0f / dist) : fe_np_any_perpendicular(a->axis[1]);
+    m->normal = n;
+
+    if (fabsf(fe_vec3_dot(a->axis[1], b->axis[1])) > 0.98f && hha > FE_NP_EPSILON && hhb > FE_NP_EPSILON) {
+        // Paralel: B'nin uçlarının A üzerindeki izdüşümleri örtüşme aralığının uçlarını verir
+        fe_vec3_t ends[2] = { b0, b1 };
+        fe_vec3_t first_pa = a0;
+        for (int i = 0; i < 2; ++i) {
+            fe_vec3_t pa = fe_np_closest_on_segment(a0, a1, ends[i]);
+            fe_vec3_t pb = fe_np_closest_on_segment(b0, b1, pa);
+            float penetration = ra + rb - fe_vec3_dot(fe_vec3_subtract(pb, pa), n);
+            if (penetration < -margin) continue;
+            if (m->point_count == 1 && fe_vec3_length_sq(fe_vec3_subtract(pa, first_pa)) < 1e-4f) continue;
+            first_pa = pa;
+            fe_np_push_point(m, fe_np_madd(pa, n, ra), fe_np_madd(pb, n, -rb), penetration);
+        }
+        if (m->point_count > 0) return;
+    }
+
+    fe_np_push_point(m, fe_np_madd(ca, n, ra), fe_np_madd(cb, n, -rb), ra + rb - dist);
+}
+
+/**
+ * @brief Kutu (A) ile kapsül (B) arasındaki temas.
+ * * Segmentin iki ucu ve segmentin kutuya en yakın noktası küre-kutu testiyle denenir;
+ * * en derin noktanın normali manifold normali olur.
+ */
+static void fe_np_box_capsule(const fe_np_frame_t* box, fe_vec3_t h, const fe_np_frame_t* capsule, float radius, float half_height,
+                              float margin, fe_narrowphase_manifold_t* m) {
+    fe_vec3_t p0, p1;
+    fe_np_capsule_segment(capsule, half_height, &p0, &p1);
+
+    // Segmentin kutuya en yakın noktası: kutuya sıkıştır / segmente izdüşür (birkaç yineleme yeterli)
+    fe_vec3_t p = fe_vec3_scale(fe_vec3_add(p0, p1), 0.5f);
+    for (int iter = 0; iter < 4; ++iter) {
+        fe_vec3_t rel = fe_vec3_subtract(p, box->center);
+        fe_vec3_t q = box->center;
+        for (int i = 0; i < 3; ++i) {
+            q = fe_np_madd(q, box->axis[i], fe_np_clamp(fe_vec3_dot(rel, box->axis[i]), -h.v[i], h.v[i]));
+        }
+        p = fe_np_closest_on_segment(p0, p1, q);
+    }
+
+    fe_vec3_t candidates[3] = { p0, p1, p };
+    uint32_t candidate_count = 3;
+    if (fe_vec3_length_sq(fe_vec3_subtract(p, p0)) < 1e-4f || fe_vec3_length_sq(fe_vec3_subtract(p, p1)) < 1e-4f) {
+        candidate_count = 2;
+    }
+
+    fe_vec3_t normals[3], on_capsule[3], on_box[3];
+    float penetrations[3];
+    bool hit[3] = { false, false, false };
+    int deepest = -1;
+    for (uint32_t i = 0; i < candidate_count; ++i) {
+        hit[i] = fe_np_sphere_box_core(candidates[i], radius, box, h, margin, &normals[i], &on_capsule[i], &on_box[i], &penetrations[i]);
+        if (hit[i] && (deepest < 0 || penetrations[i] > penetrations[deepest])) {
+            deepest = (int)i;
+        }
+    }
+    if (deepest < 0) return;
+
+    // Normal küreden kutuya bulundu; A (kutu) -> B (kapsül) için ters çevrilir
+    fe_vec3_t n = fe_vec3_negate(normals[deepest]);
+    m->normal = n;
+    for (uint32_t i = 0; i < candidate_count; ++i) {
+        // Çok farklı yöndeki (örn: kutunun başka bir yüzündeki) uçlar bu manifolda katılmaz
+        if (!hit[i] || fe_vec3_dot(fe_vec3_negate(normals[i]), n) < 0.7f) continue;
+        fe_np_push_point(m, on_box[i], on_capsule[i], penetrations[i]);
+    }
+}
+
+
+// ----------------------------------------------------------------------
+// 3. KUTU-KUTU (SAT + KIRPMA)
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Poligonu dot(p - origin, dir) <= offset yarı uzayına kırpar (Sutherland-Hodgman).
+ */
+static uint32_t fe_np_clip(const fe_vec3_t* in, uint32_t in_count, fe_vec3_t origin, fe_vec3_t dir, float offset, fe_vec3_t* out) {
+    uint32_t out_count = 0;
+    if (in_count == 0) return 0;
+
+    fe_vec3_t prev = in[in_count - 1];
+    float prev_dist = fe_vec3_dot(fe_vec3_subtract(prev, origin), dir) - offset;
+    for (uint32_t i = 0; i < in_count; ++i) {
+        fe_vec3_t cur = in[i];
+        float cur_dist = fe_vec3_dot(fe_vec3_subtract(cur, origin), dir) - offset;
+
+        if ((prev_dist <= 0.0f) != (cur_dist <= 0.0f)) {
+            float t = prev_dist / (prev_dist - cur_dist);
+            out[out_count++] = fe_vec3_lerp(prev, cur, t);
+        }
+        if (cur_dist <= 0.0f) {
+            out[out_count++] = cur;
+        }
+        prev = cur;
+        prev_dist = cur_dist;
+    }
+    return out_count;
+}
+
+/**
+ * @brief Referans kutunun yüzü ile gelen (incident) kutunun en ters yüzü arasındaki temaslar.
+ * @param ref_normal Referans yüzün dışa bakan normali (diğer kutuya doğru).
+ */
+static void fe_np_box_face_contacts(const fe_np_frame_t* ref, fe_vec3_t href, int ref_axis, fe_vec3_t ref_normal,
+                                    const fe_np_frame_t* inc, fe_vec3_t hinc, bool ref_is_a, float margin, fe_narrowphase_manifold_t* m) {
+    float ref_sign = fe_vec3_dot(ref_normal, ref->axis[ref_axis]) >= 0.0f ? 1.0f : -1.0f;
+    fe_vec3_t face_center = fe_np_madd(ref->center, ref->axis[ref_axis], ref_sign * href.v[ref_axis]);
+    int u_axis = (ref_axis + 1) % 3;
+    int v_axis = (ref_axis + 2) % 3;
+
+    // Gelen yüz: normali referans normaline en zıt olan yüz
+    int inc_axis = 0;
+    float best = -1.0f;
+    for (int i = 0; i < 3; ++i) {
+        float dp = fabsf(fe_vec3_dot(inc->axis[i], ref_normal));
+        if (dp > best) {
+            best = dp;
+            inc_axis = i;
+        }
+    }
+    float inc_sign = fe_vec3_dot(inc->axis[inc_axis], ref_normal) > 0.0f ? -1.0f : 1.0f;
+    fe_vec3_t inc_center = fe_np_madd(inc->center, inc->axis[inc_axis], inc_sign * hinc.v[inc_axis]);
+    fe_vec3_t e1 = fe_vec3_scale(inc->axis[(inc_axis + 1) % 3], hinc.v[(inc_axis + 1) % 3]);
+    fe_vec3_t e2 = fe_vec3_scale(inc->axis[(inc_axis + 2) % 3], hinc.v[(inc_axis + 2) % 3]);
+
+    fe_vec3_t poly_a[FE_NP_MAX_CLIP_VERTICES], poly_b[FE_NP_MAX_CLIP_VERTICES];
+    poly_a[0] = fe_vec3_add(fe_vec3_add(inc_center, e1), e2);
+    poly_a[1] = fe_vec3_add(fe_vec3_subtract(inc_center, e1), e2);
+    poly_a[2] = fe_vec3_subtract(fe_vec3_subtract(inc_center, e1), e2);
+    poly_a[3] = fe_vec3_subtract(fe_vec3_add(inc_center, e1), e2);
+
+    // Referans yüzün dört yan düzlemine kırp
+    uint32_t count = 4;
+    count = fe_np_clip(poly_a, count, ref->center, ref->axis[u_axis], href.v[u_axis], poly_b);
+    count = fe_np_clip(poly_b, count, ref->center, fe_vec3_negate(ref->axis[u_axis]), href.v[u_axis], poly_a);
+    count = fe_np_clip(poly_a, count, ref->center, ref->axis[v_axis], href.v[v_axis], poly_b);
+    count = fe_np_clip(poly_b, count, ref->center, fe_vec3_negate(ref->axis[v_axis]), href.v[v_axis], poly_a);
+
+    // Referans yüzün altında (veya öngörülü mesafe içinde) kalan köşeler temas noktasıdır
+    fe_vec3_t points[FE_NP_MAX_CLIP_VERTICES];
+    float depths[FE_NP_MAX_CLIP_VERTICES];
+    uint32_t point_count = 0;
+    for (uint32_t i = 0; i < count; ++i) {
+        float depth = fe_vec3_dot(fe_vec3_subtract(face_center, poly_a[i]), ref_normal);
+        if (depth >= -margin) {
+            points[point_count] = poly_a[i];
+            depths[point_count] = depth;
+            point_count++;
+        }
+    }
+    if (point_count == 0) return;
+
+    // 4'ten fazla nokta: en derin nokta, ona en uzak nokta ve bu kenarın iki yanında en geniş
+    // üçgeni kuran iki nokta tutulur (destek alanı korunur).
+    uint32_t keep[FE_NARROWPHASE_MAX_POINTS];
+    uint32_t keep_count = 0;
+    if (point_count <= FE_NARROWPHASE_MAX_POINTS) {
+        for (uint32_t i = 0; i < point_count; ++i) keep[keep_count++] = i;
+    } else {
+        uint32_t i0 = 0;
+        for (uint32_t i = 1; i < point_count; ++i) {
+            if (depths[i] > depths[i0]) i0 = i;
+        }
+        uint32_t i1 = i0;
+        float max_dist = -1.0f;
+        for (uint32_t i = 0; i < point_count; ++i) {
+            float dist = fe_vec3_length_sq(fe_vec3_subtract(points[i], points[i0]));
+            if (dist > max_dist) { max_dist = dist; i1 = i; }
+        }
+        uint32_t i2 = i0, i3 = i0;
+        float max_area = 0.0f, min_area = 0.0f;
+        fe_vec3_t edge = fe_vec3_subtract(points[i1], points[i0]);
+        for (uint32_t i = 0; i < point_count; ++i) {
+            float area = fe_vec3_dot(fe_vec3_cross(edge, fe_vec3_subtract(points[i], points[i0])), ref_normal);
+            if (area > max_area) { max_area = area; i2 = i; }
+            if (area < min_area) { min_area = area; i3 = i; }
+        }
+        keep[keep_count++] = i0;
+        if (i1 != i0) keep[keep_count++] = i1;
+        if (i2 != i0) keep[keep_count++] = i2;
+        if (i3 != i0) keep[keep_count++] = i3;
+    }
+
+    m->normal = ref_is_a ? ref_normal : fe_vec3_negate(ref_normal);
+    for (uint32_t k = 0; k < keep_count; ++k) {
+        uint32_t i = keep[k];
+        fe_vec3_t on_ref = fe_np_madd(points[i], ref_normal, depths[i]);
+        if (ref_is_a) {
+            fe_np_push_point(m, on_ref, points[i], depths[i]);
+        } else {
+            fe_np_push_point(m, points[i], on_ref, depths[i]);
+        }
+    }
+}
+
+static void fe_np_box_box(const fe_np_frame_t* a, fe_vec3_t ha, const fe_np_frame_t* b, fe_vec3_t hb, float margin, fe_narrowphase_manifold_t* m) {
+    fe_vec3_t d = fe_vec3_subtract(b->center, a->center);
+    float abs_r[3][3];
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            abs_r[i][j] = fabsf(fe_vec3_dot(a->axis[i], b->axis[j])) + FE_NP_EPSILON;
+        }
+    }
+
+    // A'nın yüz eksenleri
+    float a_max = -FLT_MAX;
+    int a_axis = 0;
+    for (int i = 0; i < 3; ++i) {
+        float rb = hb.x * abs_r[i][0] + hb.y * abs_r[i][1] + hb.z * abs_r[i][2];
+        float separation = fabsf(fe_vec3_dot(d, a->axis[i])) - (ha.v[i] + rb);
+        if (separation > margin) return;
+        if (separation > a_max) { a_max = separation; a_axis = i; }
+    }
+
+    // B'nin yüz eksenleri
+    float b_max = -FLT_MAX;
+    int b_axis = 0;
+    for (int j = 0; j < 3; ++j) {
+        float ra = ha.x * abs_r[0][j] + ha.y * abs_r[1][j] + ha.z * abs_r[2][j];
+        float separation = fabsf(fe_vec3_dot(d, b->axis[j])) - (ra + hb.v[j]);
+        if (separation > margin) return;
+        if (separation > b_max) { b_max = separation; b_axis = j; }
+    }
+
+    // Kenar-kenar eksenleri (paralel kenarlar atlanır)
+    float e_max = -FLT_MAX;
+    int e_a = 0, e_b = 0;
+    fe_vec3_t e_normal = {{0.0f, 0.0f, 0.0f}};
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            fe_vec3_t axis = fe_vec3_cross(a->axis[i], b->axis[j]);
+            float len = fe_vec3_length(axis);
+            if (len < 1e-4f) continue;
+            axis = fe_vec3_scale(axis, 1.0f / len);
+
+            float ra = 0.0f, rb = 0.0f;
+            for (int k = 0; k < 3; ++k) {
+                ra += ha.v[k] * fabsf(fe_vec3_dot(a->axis[k], axis));
+                rb += hb.v[k] * fabsf(fe_vec3_dot(b->axis[k], axis));
+            }
+            float dist = fe_vec3_dot(d, axis);
+            float separation = fabsf(dist) - (ra + rb);
+            if (separation > margin) return;
+            if (separation > e_max) {
+                e_max = separation;
+                e_a = i;
+                e_b = j;
+                e_normal = (dist < 0.0f) ? fe_vec3_negate(axis) : axis;
+            }
+        }
+    }
+
+    float face_max = (a_max > b_max) ? a_max : b_max;
+    if (FE_NP_RELATIVE_TOLERANCE * e_max > face_max + FE_NP_ABSOLUTE_TOLERANCE) {
+        // Kenar-kenar teması: iki kenar arasındaki en yakın noktalar
+        fe_vec3_t n = e_normal;
+        fe_vec3_t pa = a->center, pb = b->center;
+        for (int k = 0; k < 3; ++k) {
+            if (k != e_a) pa = fe_np_madd(pa, a->axis[k], fe_vec3_dot(a->axis[k], n) > 0.0f ? ha.v[k] : -ha.v[k]);
+            if (k != e_b) pb = fe_np_madd(pb, b->axis[k], fe_vec3_dot(b->axis[k], n) > 0.0f ? -hb.v[k] : hb.v[k]);
+        }
+        fe_vec3_t ca, cb;
+        fe_np_closest_segments(fe_np_madd(pa, a->axis[e_a], -ha.v[e_a]), fe_np_madd(pa, a->axis[e_a], ha.v[e_a]),
+                               fe_np_madd(pb, b->axis[e_b], -hb.v[e_b]), fe_np_madd(pb, b->axis[e_b], hb.v[e_b]),
+                               &ca, &cb);
+        m->normal = n;
+        fe_np_push_point(m, ca, cb, -e_max);
+        return;
+    }
+
+    if (FE_NP_RELATIVE_TOLERANCE * b_max > a_max + FE_NP_ABSOLUTE_TOLERANCE) {
+        // Referans yüz B'de: normal B'den A'ya bakar
+        fe_vec3_t n = b->axis[b_axis];
+        if (fe_vec3_dot(d, n) > 0.0f) n = fe_vec3_negate(n);
+        fe_np_box_face_contacts(b, hb, b_axis, n, a, ha, false, margin, m);
+    } else {
+        fe_vec3_t n = a->axis[a_axis];
+        if (fe_vec3_dot(d, n) < 0.0f) n = fe_vec3_negate(n);
+        fe_np_box_face_contacts(a, ha, a_axis, n, b, hb, true, margin, m);
+    }
+}
+
+
+// ----------------------------------------------------------------------
+// 4. GENEL ARAYÜZ
+// ----------------------------------------------------------------------
+
+/**
+ * Uygulama: fe_narrowphase_collide
+ */
+bool fe_narrowphase_collide(const fe_collider_t* collider_a, fe_vec3_t position_a, fe_vec4_t orientation_a,
+                            const fe_collider_t* collider_b, fe_vec3_t position_b, fe_vec4_t orientation_b,
+                            fe_narrowphase_manifold_t* out_manifold) {
+    return fe_narrowphase_collide_speculative(collider_a, position_a, orientation_a, collider_b, position_b, orientation_b,
+                                              FE_NARROWPHASE_SPECULATIVE_DISTANCE, out_manifold);
+}
+
+/**
+ * Uygulama: fe_narrowphase_collide_speculative
+ */
+bool fe_narrowphase_collide_speculative(const fe_collider_t* collider_a, fe_vec3_t position_a, fe_vec4_t orientation_a,
+                                        const fe_collider_t* collider_b, fe_vec3_t position_b, fe_vec4_t orientation_b,
+                                        float speculative_distance, fe_narrowphase_manifold_t* out_manifold) {
+    out_manifold->point_count = 0;
+    if (!collider_a || !collider_b) return false;
+
+    // Dağıtımı azaltmak için çiftler (küçük tür, büyük tür) sırasına getirilir
+    bool swapped = collider_a->type > collider_b->type;
+    if (swapped) {
+        const fe_collider_t* tc = collider_a; collider_a = collider_b; collider_b = tc;
+        fe_vec3_t tp = position_a; position_a = position_b; position_b = tp;
+        fe_vec4_t tq = orientation_a; orientation_a = orientation_b; orientation_b = tq;
+    }
+
+    fe_np_frame_t a, b;
+    fe_np_make_frame(collider_a, position_a, orientation_a, &a);
+    fe_np_make_frame(collider_b, position_b, orientation_b, &b);
+
+    switch (collider_a->type) {
+        case FE_COLLIDER_SPHERE: {
+            float ra = collider_a->shape.sphere.radius;
+            if (collider_b->type == FE_COLLIDER_SPHERE) {
+                fe_np_sphere_sphere(a.center, ra, b.center, collider_b->shape.sphere.radius, speculative_distance, out_manifold);
+            } else if (collider_b->type == FE_COLLIDER_BOX) {
+                fe_np_sphere_box(a.center, ra, &b, collider_b->shape.box.half_extents, speculative_distance, out_manifold);
+            } else if (collider_b->type == FE_COLLIDER_CAPSULE) {
+                fe_vec3_t b0, b1;
+                fe_np_capsule_segment(&b, collider_b->shape.capsule.half_height, &b0, &b1);
+                fe_vec3_t closest = fe_np_closest_on_segment(b0, b1, a.center);
+                fe_np_sphere_sphere(a.center, ra, closest, collider_b->shape.capsule.radius, speculative_distance, out_manifold);
+            }
+            break;
+        }
+        case FE_COLLIDER_BOX:
+            if (collider_b->type == FE_COLLIDER_BOX) {
+                fe_np_box_box(&a, collider_a->shape.box.half_extents, &b, collider_b->shape.box.half_extents, speculative_distance, out_manifold);
+            } else if (collider_b->type == FE_COLLIDER_CAPSULE) {
+                fe_np_box_capsule(&a, collider_a->shape.box.half_extents, &b,
+                                  collider_b->shape.capsule.radius, collider_b->shape.capsule.half_height, speculative_distance, out_manifold);
+            }
+            break;
+        case FE_COLLIDER_CAPSULE:
+            fe_np_capsule_capsule(&a, collider_a->shape.capsule.radius, collider_a->shape.capsule.half_height,
+                                  &b, collider_b->shape.capsule.radius, collider_b->shape.capsule.half_height, speculative_distance, out_manifold);
+            break;
+        default:
+            break;
+    }
+
+    if (swapped && out_manifold->point_count > 0) {
+        out_manifold->normal = fe_vec3_negate(out_manifold->normal);
+    }
+    return out_manifold->point_count > 0;
+}
+
@@ -3,7 +3,7 @@
 #include "physics/fe_physical_animation_component.h"
 #include "utils/fe_logger.h"
 #include "data_structures/fe_array.h"
-#include <stdlib.h> // malloc, free
+#include "memory/fe_memory_manager.h" // fe_mem_calloc, fe_mem_free
 #include <math.h>   // fminf, fmaxf
 
 // Dahili Kuaterniyon ve Vektör Yardımcı Fonksiyonları (fe_math'ten geldiği varsayılır)
@@ -32,7 +32,7 @@ fe_physical_animation_component_t* fe_physical_anim_create(
     }
 
     fe_physical_animation_component_t* comp = 
-        (fe_physical_animation_component_t*)calloc(1, sizeof(fe_physical_animation_component_t));
+        (fe_physical_animation_component_t*)fe_mem_calloc(1, sizeof(fe_physical_animation_component_t));
         
     if (!comp) {
         FE_LOG_FATAL("Fiziksel Animasyon bileseni icin bellek ayrilamadi.");
@@ -59,7 +59,7 @@ void fe_physical_anim_destroy(fe_physical_animation_component_t* comp) {
         if (comp->target_transforms) {
             fe_array_destroy(comp->target_transforms);
         }
-        free(comp);
+        fe_mem_free(comp);
         FE_LOG_TRACE("Fiziksel Animasyon Bileseni yok edildi.");
     }
 }
@@ -2,12 +2,35 @@
 
 #include "physics/fe_physics_constraint_component.h"
 #include "utils/fe_logger.h"
-#include <stdlib.h> // malloc, free
+#include "memory/fe_memory_manager.h" // fe_mem_calloc, fe_mem_free
 #include <string.h> // memset
 
 // Benzersiz kimlik sayacı
 static uint32_t g_next_constraint_id = 1;
 
+/**
+ * @brief Dünya uzayındaki bir yönü cismin yerel uzayına taşır (R^T * v). Cisim yoksa (dünya) v döner.
+ */
+static fe_vec3_t fe_constraint_to_local(const fe_rigid_body_t* rb, fe_vec3_t v) {
+    if (!rb) return v;
+    fe_vec3_t rows[3];
+    fe_physics_quat_to_rows(rb->orientation, rows);
+    return (fe_vec3_t){{
+        rows[0].x * v.x + rows[1].x * v.y + rows[2].x * v.z,
+        rows[0].y * v.x + rows[1].y * v.y + rows[2].y * v.z,
+        rows[0].z * v.x + rows[1].z * v.y + rows[2].z * v.z
+    }};
+}
+
+/**
+ * @brief Sabit kısıtlamanın hedef bağıl yönelimini cisimlerin güncel yönelimlerinden kaydeder.
+ */
+static void fe_constraint_record_relative_orientation(fe_physics_constraint_component_t* constraint) {
+    fe_vec4_t q_b = constraint->body_b ? constraint->body_b->orientation : (fe_vec4_t){{0.0f, 0.0f, 0.0f, 1.0f}};
+    constraint->properties.fixed_data.relative_orientation =
+        fe_physics_quat_multiply(fe_physics_quat_conjugate(constraint->body_a->orientation), q_b);
+}
+
 
 /**
  * Uygulama: fe_constraint_create
@@ -23,7 +46,7 @@ fe_physics_constraint_component_t* fe_constraint_create(
     }
 
     fe_physics_constraint_component_t* constraint = 
-        (fe_physics_constraint_component_t*)calloc(1, sizeof(fe_physics_constraint_component_t));
+        (fe_physics_constraint_component_t*)fe_mem_calloc(1, sizeof(fe_physics_constraint_component_t));
         
     if (!constraint) {
         FE_LOG_FATAL("Kısıtlama icin bellek ayrilamadi.");
@@ -42,6 +65,13 @@ fe_physics_constraint_component_t* fe_constraint_create(
     if (body_b) {
         constraint->anchor_b_local = (fe_vec3_t){0.0f, 0.0f, 0.0f};
     }
+
+    // Tip'e özgü varsayılanlar: güncel pozlar korunur
+    if (type == FE_CONSTRAINT_HINGE) {
+        fe_constraint_set_hinge_axis(constraint, (fe_vec3_t){{0.0f, 0.0f, 1.0f}});
+    } else if (type == FE_CONSTRAINT_FIXED) {
+        fe_constraint_record_relative_orientation(constraint);
+    }
     
     FE_LOG_TRACE("Kısıtlama %u olusturuldu (Tip: %d).", constraint->id, type);
     return constraint;
@@ -52,7 +82,7 @@ fe_physics_constraint_component_t* fe_constraint_create(
  */
 void fe_constraint_destroy(fe_physics_constraint_component_t* constraint) {
     if (constraint) {
-        free(constraint);
+        fe_mem_free(constraint);
         FE_LOG_TRACE("Kısıtlama yok edildi.");
     }
 }
@@ -77,45 +107,49 @@ void fe_constraint_set_spring_data(
 }
 
 // ----------------------------------------------------------------------
-// Kısıtlama Çözümü (Gelecek - fe_physics_manager tarafından çağrılacak)
+// Bağlama Ayarları
 // ----------------------------------------------------------------------
 
 /**
- * @brief Yalnizca bir yay kısıtlamasi için gerekli kuvveti hesaplar ve uygular.
- * * Bu, kısıtlama çözücünün bir alt adimi olabilir.
+ * Uygulama: fe_constraint_set_anchors
  */
-void fe_constraint_apply_spring_force(fe_physics_constraint_component_t* constraint) {
-    if (!constraint->is_active || constraint->type != FE_CONSTRAINT_SPRING) return;
-    
-    fe_rigid_body_t *rb_a = constraint->body_a;
-    fe_rigid_body_t *rb_b = constraint->body_b;
-    
-    // Basitlik için sadece cisimlerin merkezlerini kullanalım (Anchor'lar kullanılmadan)
-    fe_vec3_t pos_a = rb_a->position;
-    fe_vec3_t pos_b = rb_b ? rb_b->position : (fe_vec3_t){0.0f, 0.0f, 0.0f}; // Eğer B yoksa (Dünyaya sabit)
-
-    fe_vec3_t delta = fe_vec3_subtract(pos_a, pos_b);
-    float current_length = fe_vec3_length(delta);
+void fe_constraint_set_anchors(
+    fe_physics_constraint_component_t* constraint, 
+    fe_vec3_t anchor_a_local, 
+    fe_vec3_t anchor_b_local) 
+{
+    if (!constraint) return;
+    constraint->anchor_a_local = anchor_a_local;
+    constraint->anchor_b_local = anchor_b_local;
+}
 
-    // Yayin uzama miktari: x = L - L0
-    float stretch = current_length - constraint->properties.spring_data.rest_length;
+/**
+ * Uygulama: fe_constraint_set_world_anchor
+ */
+void fe_constraint_set_world_anchor(fe_physics_constraint_component_t* constraint, fe_vec3_t world_point) {
+    if (!constraint) return;
 
-    // Hooke Yasasi: F = -k * x
-    float stiffness_force_mag = -constraint->properties.spring_data.stiffness * stretch;
-    
-    // Kuvvet yönü (normalize edilmiş delta)
-    fe_vec3_t direction = fe_vec3_normalize(delta);
+    constraint->anchor_a_local = fe_constraint_to_local(constraint->body_a, fe_vec3_subtract(world_point, constraint->body_a->position));
+    constraint->anchor_b_local = constraint->body_b
+        ? fe_constraint_to_local(constraint->body_b, fe_vec3_subtract(world_point, constraint->body_b->position))
+        : world_point;
 
-    // Toplam Yay Kuvveti (Basit kuvvet: sadece sertlik)
-    fe_vec3_t spring_force = fe_vec3_scale(direction, stiffness_force_mag);
+    if (constraint->type == FE_CONSTRAINT_FIXED) {
+        fe_constraint_record_relative_orientation(constraint);
+    }
+}
 
-    // Kuvvetleri rigid body'lere uygula
-    fe_rigid_body_apply_force(rb_a, spring_force);
-    
-    if (rb_b) {
-        // İkinci cisme zıt kuvvet uygula
-        fe_rigid_body_apply_force(rb_b, fe_vec3_scale(spring_force, -1.0f));
+/**
+ * Uygulama: fe_constraint_set_hinge_axis
+ */
+void fe_constraint_set_hinge_axis(fe_physics_constraint_component_t* constraint, fe_vec3_t world_axis) {
+    if (!constraint || constraint->type != FE_CONSTRAINT_HINGE) {
+        FE_LOG_WARN("Mentese ekseni atamasi yanlis kısıtlama tipinde deneniyor.");
+        return;
     }
-    
-    // Not: Gerçek bir kısıtlama çözücüde sürtünme (damping) ve kısıtlama çözümü (IMPULSE) kullanılır.
-}
\ No newline at end of file
+    if (fe_vec3_length_sq(world_axis) <= 0.0f) return;
+
+    fe_vec3_t axis = fe_vec3_normalize(world_axis);
+    constraint->properties.hinge_data.axis_a_local = fe_constraint_to_local(constraint->body_a, axis);
+    constraint->properties.hinge_data.axis_b_local = fe_constraint_to_local(constraint->body_b, axis);
+}
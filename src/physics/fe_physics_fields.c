@@ -2,7 +2,7 @@
 
 #include "physics/fe_physics_fields.h"
 #include "utils/fe_logger.h"
-#include <stdlib.h> // malloc, free
+#include "memory/fe_memory_manager.h" // fe_mem_calloc, fe_mem_free
 #include <math.h>   // fmaxf, fminf, sqrtf
 
 // Benzersiz kimlik sayacı
@@ -16,7 +16,7 @@ static uint32_t g_next_field_id = 1;
  * Uygulama: fe_field_create
  */
 fe_physics_field_t* fe_field_create(fe_field_type_t type, fe_field_shape_t shape) {
-    fe_physics_field_t* field = (fe_physics_field_t*)calloc(1, sizeof(fe_physics_field_t));
+    fe_physics_field_t* field = (fe_physics_field_t*)fe_mem_calloc(1, sizeof(fe_physics_field_t));
     
     if (!field) {
         FE_LOG_FATAL("Fizik alani icin bellek ayrilamadi.");
@@ -41,7 +41,7 @@ fe_physics_field_t* fe_field_create(fe_field_type_t type, fe_field_shape_t shape
  */
 void fe_field_destroy(fe_physics_field_t* field) {
     if (field) {
-        free(field);
+        fe_mem_free(field);
         FE_LOG_TRACE("Fizik alani yok edildi.");
     }
 }
@@ -3,6 +3,9 @@
 #include "physics/fe_physics_manager.h"
 #include "utils/fe_logger.h"
 #include "data_structures/fe_array.h" // fe_array_create, fe_array_push, fe_array_count, vb.
+#include "platform/fe_job_system.h" // fe_job_parallel_for
+#include "physics/fe_world.h" // fe_world_create_default_settings
+#include "utils/fe_timer.h" // Adım aşama süreleri
 
 // ----------------------------------------------------------------------
 // 1. GLOBAL YÖNETİCİ DURUMU
@@ -13,6 +16,45 @@ static fe_physics_manager_t g_manager_state = {0};
 // Simülasyon güvenliğini sağlamak için maksimum yinelenme (iteration) sınırı
 #define MAX_PHYSICS_STEPS 5 
 
+// Cisim başına döngülerde tek bir işin işlediği en fazla cisim sayısı
+#define FE_PHYSICS_JOB_GRAIN 64
+
+// Çözümde tek bir işin işlediği en fazla ada sayısı
+#define FE_PHYSICS_ISLAND_GRAIN 16
+
+static inline fe_rigid_body_t** fe_physics_awake_bodies(void) {
+    return (fe_rigid_body_t**)g_manager_state.awake_bodies->data;
+}
+
+static inline uint32_t fe_physics_awake_count(void) {
+    return (uint32_t)fe_array_count(g_manager_state.awake_bodies);
+}
+
+/**
+ * @brief Cismi uyanık listenin sonuna ekler (fe_island_wake geri çağrısı olarak da kullanılır).
+ */
+static void fe_physics_push_awake(fe_rigid_body_t* rb, void* context) {
+    (void)context;
+    if (rb->awake_index != UINT32_MAX) return;
+    rb->awake_index = fe_physics_awake_count();
+    if (!fe_array_push(g_manager_state.awake_bodies, &rb)) rb->awake_index = UINT32_MAX;
+}
+
+/**
+ * @brief Cismi uyanık listeden O(1) çıkarır: yerine son cisim taşınır ve awake_index'i güncellenir.
+ */
+static void fe_physics_remove_awake(fe_rigid_body_t* rb) {
+    fe_rigid_body_t** bodies = fe_physics_awake_bodies();
+    uint32_t index = rb->awake_index;
+    uint32_t last = fe_physics_awake_count() - 1;
+    if (index != last) {
+        bodies[index] = bodies[last];
+        bodies[index]->awake_index = index;
+    }
+    fe_array_pop(g_manager_state.awake_bodies, NULL);
+    rb->awake_index = UINT32_MAX;
+}
+
 // ----------------------------------------------------------------------
 // 2. YAŞAM DÖNGÜSÜ UYGULAMALARI
 // ----------------------------------------------------------------------
@@ -28,7 +70,25 @@ void fe_physics_manager_init(void) {
 
     // Dinamik dizi yapısını başlat
     g_manager_state.rigid_bodies = fe_array_create(sizeof(fe_rigid_body_t*));
+    g_manager_state.awake_bodies = fe_array_create(sizeof(fe_rigid_body_t*));
+    g_manager_state.constraints = fe_array_create(sizeof(fe_physics_constraint_component_t*));
+    g_manager_state.awake_joints = fe_array_create(sizeof(fe_physics_constraint_component_t*));
     g_manager_state.accumulator = 0.0f;
+    g_manager_state.last_step = (fe_physics_step_stats_t){0};
+    g_manager_state.enable_sleeping = fe_world_create_default_settings().enable_sleeping;
+
+    if (fe_broadphase_init(&g_manager_state.broadphase) != FE_OK) {
+        FE_LOG_ERROR("Broadphase baslatilamadi. Carpisma tespiti devre disi.");
+    }
+    if (fe_collision_solver_init(&g_manager_state.solver) != FE_OK) {
+        FE_LOG_ERROR("Carpisma cozucusu baslatilamadi. Temaslar cozulmeyecek.");
+    }
+    if (fe_island_manager_init(&g_manager_state.islands) != FE_OK) {
+        FE_LOG_ERROR("Ada yoneticisi baslatilamadi. Temaslar cozulmeyecek.");
+    }
+    if (fe_constraint_solver_init(&g_manager_state.joint_solver) != FE_OK) {
+        FE_LOG_ERROR("Eklem cozucusu baslatilamadi. Eklemler cozulmeyecek.");
+    }
 
     FE_LOG_INFO("Fizik Yoneticisi baslatildi. Zaman adimi: %f s", FE_PHYSICS_FIXED_DT);
 }
@@ -51,6 +111,38 @@ void fe_physics_manager_shutdown(void) {
         fe_array_destroy(g_manager_state.rigid_bodies);
         g_manager_state.rigid_bodies = NULL;
     }
+
+    // Kısıtlamalar sahiplerine (örn: fe_ragdoll_t) aittir; sadece liste serbest bırakılır
+    if (g_manager_state.constraints) {
+        fe_array_destroy(g_manager_state.constraints);
+        g_manager_state.constraints = NULL;
+    }
+    if (g_manager_state.awake_joints) {
+        fe_array_destroy(g_manager_state.awake_joints);
+        g_manager_state.awake_joints = NULL;
+    }
+    if (g_manager_state.awake_bodies) {
+        fe_array_destroy(g_manager_state.awake_bodies);
+        g_manager_state.awake_bodies = NULL;
+    }
+
+    fe_broadphase_destroy(&g_manager_state.broadphase);
+    fe_collision_solver_destroy(&g_manager_state.solver);
+    fe_island_manager_destroy(&g_manager_state.islands);
+    fe_constraint_solver_destroy(&g_manager_state.joint_solver);
+}
+
+/**
+ * @brief Cismi listeye ve uyanık listeye ekler. Yeni cisimler uyanık başlar.
+ */
+static void fe_physics_register_body(fe_rigid_body_t* rb) {
+    fe_array_push(g_manager_state.rigid_bodies, &rb);
+
+    rb->is_awake = true;
+    rb->sleep_time = 0.0f;
+    rb->island_next = NULL;
+    rb->awake_index = UINT32_MAX;
+    fe_physics_push_awake(rb, NULL);
 }
 
 /**
@@ -58,10 +150,73 @@ void fe_physics_manager_shutdown(void) {
  */
 void fe_physics_manager_add_rigid_body(fe_rigid_body_t* rb) {
     if (!rb) return;
-    fe_array_push(g_manager_state.rigid_bodies, &rb);
+    fe_physics_register_body(rb);
     FE_LOG_TRACE("Rigid Body eklendi. Toplam: %zu", fe_array_count(g_manager_state.rigid_bodies));
 }
 
+/**
+ * Uygulama: fe_physics_manager_add_rigid_bodies
+ */
+void fe_physics_manager_add_rigid_bodies(fe_rigid_body_t* const* bodies, uint32_t count) {
+    uint32_t added = 0;
+    for (uint32_t i = 0; i < count; ++i) {
+        if (!bodies[i]) continue;
+        fe_physics_register_body(bodies[i]);
+        added++;
+    }
+    FE_LOG_TRACE("%u Rigid Body eklendi. Toplam: %zu", added, fe_array_count(g_manager_state.rigid_bodies));
+}
+
+/**
+ * Uygulama: fe_physics_manager_reserve_contacts
+ */
+void fe_physics_manager_reserve_contacts(uint32_t pair_count) {
+    if (!g_manager_state.broadphase.nodes || !g_manager_state.solver.constraints) return;
+    if (!fe_broadphase_reserve_pairs(&g_manager_state.broadphase, pair_count) ||
+        !fe_collision_solver_reserve(&g_manager_state.solver, pair_count)) {
+        FE_LOG_WARN("%u temas cifti icin yer ayrilamadi; kapasite gerektikce buyuyecek.", pair_count);
+    }
+}
+
+/**
+ * @brief Eklemin rb ucundaki listede bir sonraki eklem.
+ */
+static inline fe_physics_constraint_component_t* fe_physics_joint_next(const fe_physics_constraint_component_t* joint, const fe_rigid_body_t* rb) {
+    return joint->joint_next[joint->body_a == rb ? 0 : 1];
+}
+
+/**
+ * @brief Eklemi uçlarının eklem listelerinin başına ekler.
+ */
+static void fe_physics_link_joint(fe_physics_constraint_component_t* joint) {
+    joint->joint_next[0] = joint->body_a->joint_list;
+    joint->body_a->joint_list = joint;
+    if (joint->body_b && joint->body_b != joint->body_a) {
+        joint->joint_next[1] = joint->body_b->joint_list;
+        joint->body_b->joint_list = joint;
+    }
+}
+
+static void fe_physics_unlink_joint_from(fe_physics_constraint_component_t* joint, fe_rigid_body_t* rb) {
+    fe_physics_constraint_component_t** link = &rb->joint_list;
+    while (*link && *link != joint) link = &(*link)->joint_next[(*link)->body_a == rb ? 0 : 1];
+    if (*link) *link = fe_physics_joint_next(joint, rb);
+}
+
+static void fe_physics_unlink_joint(fe_physics_constraint_component_t* joint) {
+    fe_physics_unlink_joint_from(joint, joint->body_a);
+    if (joint->body_b && joint->body_b != joint->body_a) fe_physics_unlink_joint_from(joint, joint->body_b);
+}
+
+/**
+ * @brief Eklemin eklenirken kapattığı cisim çifti temaslarını geri açar.
+ */
+static void fe_physics_unfilter_constraint(const fe_physics_constraint_component_t* constraint) {
+    if (!constraint->collide_connected && constraint->body_b) {
+        fe_collision_solver_restore_pair(&g_manager_state.solver, constraint->body_a, constraint->body_b);
+    }
+}
+
 /**
  * Uygulama: fe_physics_manager_remove_rigid_body
  * Not: fe_array_remove_item veya fe_array_remove_at fonksiyonunun var olduğu varsayılır.
@@ -72,54 +227,510 @@ void fe_physics_manager_remove_rigid_body(fe_rigid_body_t* rb) {
     for (size_t i = 0; i < fe_array_count(g_manager_state.rigid_bodies); ++i) {
         fe_rigid_body_t** rb_ptr = (fe_rigid_body_t**)fe_array_get(g_manager_state.rigid_bodies, i);
         if (rb_ptr && *rb_ptr == rb) {
-            // fe_array_remove_at(g_manager_state.rigid_bodies, i); // Silme işlemi
-            // Basitlik için sadece loglama yapalım, gerçek fe_array implementasyonuna bağlıdır.
+            // Uyuyorsa adasını uyandır (cismin desteklediği komşular düşebilmeli), sonra uyanık listeden çıkar
+            fe_island_wake(rb, fe_physics_push_awake, NULL);
+            if (rb->awake_index != UINT32_MAX) fe_physics_remove_awake(rb);
+
+            // Broadphase vekilini hemen kaldır (çiftleri artık bu cisme işaret etmemeli)
+            if (rb->collider && rb->collider->proxy_id != FE_BROADPHASE_NULL_PROXY) {
+                fe_broadphase_destroy_proxy(&g_manager_state.broadphase, rb->collider->proxy_id);
+                rb->collider->proxy_id = FE_BROADPHASE_NULL_PROXY;
+            }
+            if (g_manager_state.solver.constraints) {
+                fe_collision_solver_remove_body(&g_manager_state.solver, rb);
+            }
+
+            // Cisme bağlı eklemler artık çözülmemeli (sondan başa: kalanların sırası korunur)
+            for (size_t k = fe_array_count(g_manager_state.constraints); k-- > 0;) {
+                fe_physics_constraint_component_t* c = *(fe_physics_constraint_component_t**)fe_array_get(g_manager_state.constraints, k);
+                if (c->body_a == rb || c->body_b == rb) {
+                    FE_LOG_WARN("Kaldirilan cisme bagli kisitlama %u da kaldirildi.", c->id);
+                    fe_physics_unfilter_constraint(c);
+                    fe_physics_unlink_joint(c);
+                    fe_array_remove_at(g_manager_state.constraints, k, NULL);
+                }
+            }
+            // Listeden de çıkar: cisim yeniden eklenebilir (örn: kırılma havuzu) ve kapanışta yönetici onu yok etmez
+            fe_array_remove_at(g_manager_state.rigid_bodies, i, NULL);
             FE_LOG_TRACE("Rigid Body kaldirildi.");
             return;
         }
     }
 }
 
+/**
+ * Uygulama: fe_physics_manager_add_constraint
+ */
+void fe_physics_manager_add_constraint(fe_physics_constraint_component_t* constraint) {
+    if (!constraint || !constraint->body_a || !g_manager_state.constraints) return;
+    fe_array_push(g_manager_state.constraints, &constraint);
+    fe_physics_link_joint(constraint);
+
+    // Eklemle bağlı kemikler eklem noktasında üst üste biner; temasları eklemle çekişmemeli
+    if (!constraint->collide_connected && constraint->body_b) {
+        fe_collision_solver_ignore_pair(&g_manager_state.solver, constraint->body_a, constraint->body_b);
+    }
+
+    fe_physics_manager_wake_rigid_body(constraint->body_a);
+    fe_physics_manager_wake_rigid_body(constraint->body_b);
+    FE_LOG_TRACE("Kisitlama %u eklendi. Toplam: %zu", constraint->id, fe_array_count(g_manager_state.constraints));
+}
+
+/**
+ * Uygulama: fe_physics_manager_remove_constraint
+ */
+void fe_physics_manager_remove_constraint(fe_physics_constraint_component_t* constraint) {
+    if (!constraint || !g_manager_state.constraints) return;
+
+    for (size_t i = 0; i < fe_array_count(g_manager_state.constraints); ++i) {
+        fe_physics_constraint_component_t** c_ptr = (fe_physics_constraint_component_t**)fe_array_get(g_manager_state.constraints, i);
+        if (*c_ptr == constraint) {
+            // Eklemin tuttuğu cisimler serbest kalır; uyuyorlarsa düşebilmeleri için uyandırılır
+            fe_physics_manager_wake_rigid_body(constraint->body_a);
+            fe_physics_manager_wake_rigid_body(constraint->body_b);
+            fe_physics_unfilter_constraint(constraint);
+            fe_physics_unlink_joint(constraint);
+            fe_array_remove_at(g_manager_state.constraints, i, NULL);
+            FE_LOG_TRACE("Kisitlama %u kaldirildi.", constraint->id);
+            return;
+        }
+    }
+}
+
 
 // ----------------------------------------------------------------------
 // 3. SİMÜLASYON ADIMI UYGULAMALARI
 // ----------------------------------------------------------------------
 
 /**
- * Uygulama: fe_physics_manager_step
+ * @brief [begin, end) aralığındaki uyanık cisimlerin hızlarını yerçekimi ve biriken kuvvetlerle günceller (iş sistemi parçası).
+ * * Kayıtlar adımın tek durumudur; her iş sadece kendi aralığındaki cisimlere yazar.
  */
-void fe_physics_manager_step(void) {
-    size_t count = fe_array_count(g_manager_state.rigid_bodies);
-    fe_rigid_body_t** current_rb_ptr;
-
-    // 1. Kuvvetleri Uygula (Yerçekimi gibi sürekli kuvvetler)
-    for (size_t i = 0; i < count; ++i) {
-        current_rb_ptr = (fe_rigid_body_t**)fe_array_get(g_manager_state.rigid_bodies, i);
-        if (!current_rb_ptr || !(*current_rb_ptr) || (*current_rb_ptr)->is_kinematic || !(*current_rb_ptr)->is_awake) continue;
+static void fe_physics_integrate_velocities_range(void* data, uint32_t begin, uint32_t end) {
+    (void)data;
+    fe_rigid_body_t* const* bodies = fe_physics_awake_bodies();
+    const fe_vec3_t gravity = g_manager_state.gravity;
 
-        fe_rigid_body_t* rb = *current_rb_ptr;
+    for (uint32_t i = begin; i < end; ++i) {
+        fe_rigid_body_t* rb = bodies[i];
+        if (!rb->is_awake || rb->is_kinematic) continue;
 
-        // Yerçekimi kuvveti = kütle * yerçekimi vektörü
-        if (rb->mass > 0.0f) {
-            fe_vec3_t gravity_force = fe_vec3_scale(g_manager_state.gravity, rb->mass);
-            fe_rigid_body_apply_force(rb, gravity_force);
+        // Yerçekimi ivme olarak eklenir (kütleden bağımsız): v += (g + F / m) * dt
+        if (rb->inverse_mass > 0.0f) {
+            float s = rb->inverse_mass;
+            rb->linear_velocity.x += (gravity.x + rb->total_force.x * s) * FE_PHYSICS_FIXED_DT;
+            rb->linear_velocity.y += (gravity.y + rb->total_force.y * s) * FE_PHYSICS_FIXED_DT;
+            rb->linear_velocity.z += (gravity.z + rb->total_force.z * s) * FE_PHYSICS_FIXED_DT;
+            rb->total_force = (fe_vec3_t){{0.0f, 0.0f, 0.0f}};
         }
 
         // TODO: fe_physics_fields'dan gelen kuvvetleri uygula
+        // Tork (varsa) dünya eylemsizliğiyle; kuvvet birikimi burada temizlenir
+        fe_rigid_body_integrate_velocity(rb, FE_PHYSICS_FIXED_DT);
+    }
+}
+
+/**
+ * @brief [begin, end) aralığındaki dinamik cisimlerin konumlarını çözülmüş hızlarla ilerletir (iş sistemi parçası).
+ * * Statik cisimler (ters kütle 0) uyanık listede olsalar da taşınmaz.
+ */
+static void fe_physics_integrate_positions_range(void* data, uint32_t begin, uint32_t end) {
+    (void)data;
+    fe_rigid_body_t* const* bodies = fe_physics_awake_bodies();
+    for (uint32_t i = begin; i < end; ++i) {
+        fe_rigid_body_t* rb = bodies[i];
+        if (rb->inverse_mass <= 0.0f) continue;
+        fe_rigid_body_integrate_position(rb, FE_PHYSICS_FIXED_DT);
+    }
+}
+
+/**
+ * @brief Sürekli çarpışmalı cismin AABB'sini adım boyunca süpürdüğü kutuya genişletir.
+ * * Cisim bu adımda en ince yarı kalınlığından az yol alıyorsa ayrık tespit yeterlidir: kutu ve
+ * * öngörülü temas mesafesi değişmez, cisim ek maliyet ödemez.
+ */
+static void fe_physics_sweep_collider(fe_collider_t* collider, fe_vec3_t linear_velocity) {
+    fe_vec3_t displacement = fe_vec3_scale(linear_velocity, FE_PHYSICS_FIXED_DT);
+    float distance = fe_vec3_length(displacement);
+    if (distance <= fe_collider_get_min_extent(collider)) return;
+
+    fe_aabb_t end_aabb = { fe_vec3_add(collider->world_aabb.min, displacement), fe_vec3_add(collider->world_aabb.max, displacement) };
+    collider->world_aabb = fe_aabb_union(&collider->world_aabb, &end_aabb);
+    collider->sweep = displacement;
+}
+
+/**
+ * @brief [begin, end) aralığındaki cisimlerin collider AABB'lerini hesaplar (iş sistemi parçası).
+ */
+static void fe_physics_compute_aabbs_range(void* data, uint32_t begin, uint32_t end) {
+    (void)data;
+    for (size_t i = begin; i < end; ++i) {
+        fe_rigid_body_t* rb = fe_physics_awake_bodies()[i];
+        if (!rb->collider) continue;
+
+        fe_collider_compute_aabb(rb->collider, rb->position, rb->orientation, &rb->collider->world_aabb);
+        rb->collider->sweep = (fe_vec3_t){{0.0f, 0.0f, 0.0f}};
+        if (rb->continuous_collision) {
+            fe_physics_sweep_collider(rb->collider, rb->linear_velocity);
+        }
+    }
+}
+
+/**
+ * @brief Broadphase'i uyanık cisimlerin güncel konumlarıyla günceller ve aday çiftleri üretir.
+ * * AABB'ler paralel hesaplanır; ağaç güncellemesi tek iş parçacığında yapılır (ağaç paylaşımlıdır).
+ * * Şişman kutusunun içinde kalan ve uyuyan cisimler için ağaca dokunulmaz.
+ */
+static void fe_physics_detect_collisions(uint32_t count) {
+    if (!g_manager_state.broadphase.nodes) return;
+
+    fe_job_parallel_for(count, FE_PHYSICS_JOB_GRAIN, fe_physics_compute_aabbs_range, NULL);
+
+    fe_rigid_body_t* const* bodies = fe_physics_awake_bodies();
+    for (uint32_t i = 0; i < count; ++i) {
+        fe_rigid_body_t* rb = bodies[i];
+        if (!rb->collider) continue;
+
+        fe_collider_t* collider = rb->collider;
+        if (collider->proxy_id == FE_BROADPHASE_NULL_PROXY) {
+            // Collider cisim yöneticiye eklendikten sonra da atanabilir
+            collider->proxy_id = fe_broadphase_create_proxy(&g_manager_state.broadphase, &collider->world_aabb, rb);
+        } else if (rb->is_awake) {
+            fe_vec3_t displacement = fe_vec3_scale(rb->linear_velocity, FE_PHYSICS_FIXED_DT);
+            fe_broadphase_move_proxy(&g_manager_state.broadphase, collider->proxy_id, &collider->world_aabb, displacement);
+        }
+    }
+
+    fe_broadphase_update_pairs(&g_manager_state.broadphase);
+
+    // Dar faz: uyanık cisimlerin aday çiftlerinin temas noktaları (kalıcı manifoldlar)
+    if (g_manager_state.solver.constraints) {
+        fe_collision_solver_update_contacts(&g_manager_state.solver, &g_manager_state.broadphase,
+                                            bodies, count);
+    }
+}
+
+/**
+ * @brief Uyanık bir cisme değen uyuyan cisimlerin adalarını uyandırır.
+ * * Etkin manifoldların en az bir ucu uyanıktır; öngörülü temaslar da (boşluk < FE_NARROWPHASE_SPECULATIVE_DISTANCE)
+ * * uyandırır, böylece yaklaşan cisim çözücüye girmeden önce yığın uyanmış olur.
+ */
+static void fe_physics_wake_touching_islands(void) {
+    uint32_t active_count = 0;
+    const uint32_t* active = fe_collision_solver_get_active(&g_manager_state.solver, &active_count);
+
+    for (uint32_t i = 0; i < active_count; ++i) {
+        const fe_contact_constraint_t* c = &g_manager_state.solver.constraints[active[i]];
+        if (c->point_count == 0) continue;
+        if (!c->body_a->is_awake) fe_island_wake(c->body_a, fe_physics_push_awake, NULL);
+        if (!c->body_b->is_awake) fe_island_wake(c->body_b, fe_physics_push_awake, NULL);
+    }
+}
+
+/**
+ * @brief Uyanık cisim eklemle bağlı olduğu cismi hareket ettirebilir mi? (Dinamik ya da hareket eden kinematik)
+ * * Statik cisimler uyanık kalsalar da bağlı oldukları cisimleri uyandırmaz.
+ */
+static inline bool fe_physics_drives_joint(const fe_rigid_body_t* rb) {
+    if (!rb->is_awake) return false;
+    if (!rb->is_kinematic && rb->inverse_mass > 0.0f) return true;
+    return rb->is_kinematic && (fe_vec3_length_sq(rb->linear_velocity) > 0.0f || fe_vec3_length_sq(rb->angular_velocity) > 0.0f);
+}
+
+static inline bool fe_physics_is_sleeping_dynamic(const fe_rigid_body_t* rb) {
+    return !rb->is_awake && !rb->is_kinematic && rb->inverse_mass > 0.0f;
+}
+
+/**
+ * @brief Uyanık bir cisme eklemle bağlı uyuyan cisimlerin adalarını uyandırır.
+ * * Bağlı cisimler aynı adada uyuduğundan bu genelde bir şey yapmaz; uyku sırasında eklenen
+ * * eklemler veya dışarıdan uyandırılan cisimler için gereklidir. Sadece uyanık cisimlerin eklem
+ * * listeleri gezilir (uyananlar listeye eklendikçe onlarınki de).
+ */
+static void fe_physics_wake_jointed_islands(void) {
+    for (uint32_t i = 0; i < fe_physics_awake_count(); ++i) {
+        fe_rigid_body_t* rb = fe_physics_awake_bodies()[i];
+        if (!rb->joint_list || !fe_physics_drives_joint(rb)) continue;
+        for (fe_physics_constraint_component_t* c = rb->joint_list; c; c = fe_physics_joint_next(c, rb)) {
+            if (!c->is_active || !c->body_b) continue;
+            fe_rigid_body_t* other = (c->body_a == rb) ? c->body_b : c->body_a;
+            if (fe_physics_is_sleeping_dynamic(other)) fe_island_wake(other, fe_physics_push_awake, NULL);
+        }
+    }
+}
+
+/**
+ * @brief Uyanık cisimlerin eklemlerini toplar; iki ucu da uyanık eklem listede önce gelen uçtan bir kez alınır.
+ * * Renklendirme ve çözüm sırası bu toplama sırasıdır (uyanık liste sırası deterministiktir).
+ */
+static fe_array_t* fe_physics_collect_awake_joints(void) {
+    fe_array_t* joints = g_manager_state.awake_joints;
+    fe_rigid_body_t* const* bodies = fe_physics_awake_bodies();
+    uint32_t count = fe_physics_awake_count();
+    fe_array_clear(joints);
+
+    for (uint32_t i = 0; i < count; ++i) {
+        fe_rigid_body_t* rb = bodies[i];
+        for (fe_physics_constraint_component_t* c = rb->joint_list; c; c = fe_physics_joint_next(c, rb)) {
+            const fe_rigid_body_t* other = (c->body_a == rb) ? c->body_b : c->body_a;
+            if (other && other->awake_index < i) continue;
+            fe_array_push(joints, &c);
+        }
+    }
+    return joints;
+}
+
+/**
+ * @brief Alt adımlı ada çözümünün bir aşaması (iş sistemi parçalarına verilen bağlam).
+ */
+typedef enum fe_physics_island_phase {
+    FE_PHYSICS_ISLAND_PREPARE,
+    FE_PHYSICS_ISLAND_BEGIN_SUBSTEP,
+    FE_PHYSICS_ISLAND_ITERATE,
+    FE_PHYSICS_ISLAND_END_SUBSTEP,
+    FE_PHYSICS_ISLAND_FINISH
+} fe_physics_island_phase_t;
+
+typedef struct fe_physics_island_task {
+    fe_physics_island_phase_t phase;
+    uint32_t substep;
+} fe_physics_island_task_t;
+
+/**
+ * @brief i. adanın manifoldları ve cisimleri. Ada yöneticisi yoksa tüm uyanık liste tek (temassız) adadır.
+ */
+static const uint32_t* fe_physics_island_lists(uint32_t island, uint32_t* out_constraint_count,
+                                               const uint32_t** out_bodies, uint32_t* out_body_count) {
+    if (g_manager_state.islands.island_count == 0) {
+        *out_constraint_count = 0;
+        *out_bodies = NULL;
+        *out_body_count = fe_physics_awake_count();
+        return NULL;
+    }
+    *out_bodies = fe_island_manager_get_bodies(&g_manager_state.islands, island, out_body_count);
+    return fe_island_manager_get_constraints(&g_manager_state.islands, island, out_constraint_count);
+}
+
+static uint32_t fe_physics_island_job_count(void) {
+    return g_manager_state.islands.island_count ? g_manager_state.islands.island_count : 1;
+}
+
+/**
+ * @brief [begin, end) aralığındaki adaların temaslarını alt adımlarla çözer (iş sistemi parçası).
+ * * Adalar ortak dinamik cisim paylaşmaz; her ada kendi içinde sıralı çözüldüğünden sonuç iş parçacığı sayısından bağımsızdır.
+ */
+static void fe_physics_solve_islands_range(void* data, uint32_t begin, uint32_t end) {
+    (void)data;
+    for (uint32_t i = begin; i < end; ++i) {
+        uint32_t constraint_count = 0, body_count = 0;
+        const uint32_t* bodies = NULL;
+        const uint32_t* indices = fe_physics_island_lists(i, &constraint_count, &bodies, &body_count);
+        fe_collision_solver_resolve_constraints(&g_manager_state.solver, indices, constraint_count, bodies, body_count, g_manager_state.gravity);
+    }
+}
+
+/**
+ * @brief [begin, end) aralığındaki adalarda alt adımlı çözümün tek bir aşamasını yürütür (iş sistemi parçası).
+ */
+static void fe_physics_island_phase_range(void* data, uint32_t begin, uint32_t end) {
+    const fe_physics_island_task_t* task = (const fe_physics_island_task_t*)data;
+    fe_collision_solver_t* solver = &g_manager_state.solver;
+
+    for (uint32_t i = begin; i < end; ++i) {
+        uint32_t constraint_count = 0, body_count = 0;
+        const uint32_t* bodies = NULL;
+        const uint32_t* indices = fe_physics_island_lists(i, &constraint_count, &bodies, &body_count);
+        switch (task->phase) {
+            case FE_PHYSICS_ISLAND_PREPARE:
+                fe_collision_solver_prepare_constraints(solver, indices, constraint_count, bodies, body_count, g_manager_state.gravity);
+                break;
+            case FE_PHYSICS_ISLAND_BEGIN_SUBSTEP:
+                fe_collision_solver_begin_substep(solver, indices, constraint_count, bodies, body_count, g_manager_state.gravity, task->substep);
+                break;
+            case FE_PHYSICS_ISLAND_ITERATE:
+                fe_collision_solver_solve_iteration(solver, indices, constraint_count);
+                break;
+            case FE_PHYSICS_ISLAND_END_SUBSTEP:
+                fe_collision_solver_end_substep(solver, indices, constraint_count, bodies, body_count);
+                break;
+            case FE_PHYSICS_ISLAND_FINISH:
+                fe_collision_solver_finish_constraints(solver, indices, constraint_count);
+                break;
+        }
+    }
+}
+
+static void fe_physics_run_island_phase(fe_physics_island_phase_t phase, uint32_t substep) {
+    fe_physics_island_task_t task = { phase, substep };
+    fe_job_parallel_for(fe_physics_island_job_count(), FE_PHYSICS_ISLAND_GRAIN, fe_physics_island_phase_range, &task);
+}
+
+/**
+ * @brief Eklemleri ve temasları her alt adımda sırayla çözer (önce eklem renkleri, sonra ada temasları).
+ * * Ayrı çözülselerdi zemine değen kemik, üstündeki gövdeyi adım içinde durduramazdı: yere inen
+ * * ragdoll'ların dizleri açılırdı. Temaslar son çözülür, cisimler iç içe geçmez. Eklemlerin
+ * * yinelemeleri alt adımlara bölünür; impulsları adım boyunca birikir ve bir kez sıcak başlatılır.
+ * * Eklemsiz sahneler adaları tek geçişte çözer (ada başına önbellek dostu; daha az eşitleme).
+ */
+static void fe_physics_solve_interleaved(void) {
+    fe_constraint_solver_t* joints = &g_manager_state.joint_solver;
+    fe_collision_solver_t* solver = &g_manager_state.solver;
+
+    // Önce yerçekimi ilk alt adıma indirilir: eklemlerin sıcak başlatması o hızların üzerine uygulanır
+    fe_physics_run_island_phase(FE_PHYSICS_ISLAND_PREPARE, 0);
+    fe_constraint_solver_prepare(joints, solver->velocities, solver->velocity_count, FE_PHYSICS_FIXED_DT);
+
+    uint32_t joint_iterations = (joints->velocity_iterations + solver->substep_count - 1) / solver->substep_count;
+    uint32_t iterations = (joint_iterations > solver->velocity_iterations) ? joint_iterations : solver->velocity_iterations;
+    for (uint32_t substep = 0; substep < solver->substep_count; ++substep) {
+        fe_physics_run_island_phase(FE_PHYSICS_ISLAND_BEGIN_SUBSTEP, substep);
+        for (uint32_t iter = 0; iter < iterations; ++iter) {
+            if (iter < joint_iterations) fe_constraint_solver_solve_iteration(joints);
+            if (iter < solver->velocity_iterations) fe_physics_run_island_phase(FE_PHYSICS_ISLAND_ITERATE, substep);
+        }
+        fe_physics_run_island_phase(FE_PHYSICS_ISLAND_END_SUBSTEP, substep);
+    }
+    fe_physics_run_island_phase(FE_PHYSICS_ISLAND_FINISH, 0);
+}
+
+/**
+ * @brief Uyumuş cisimleri uyanık listeden çıkarır.
+ * * Sondan başa gezilir: çıkarılanın yerine taşınan son cisim zaten denetlenmiştir.
+ * * Dışarıdan is_awake = false yapılan cisimler tek cisimlik uyuyan ada olur; fe_physics_manager_wake_rigid_body ile dönerler.
+ */
+static void fe_physics_compact_awake_bodies(void) {
+    fe_rigid_body_t** bodies = fe_physics_awake_bodies();
+
+    for (uint32_t i = fe_physics_awake_count(); i-- > 0;) {
+        fe_rigid_body_t* rb = bodies[i];
+        if (rb->is_awake) continue;
+        if (!rb->island_next) rb->island_next = rb;
+        fe_physics_remove_awake(rb);
+    }
+}
+
+/**
+ * Uygulama: fe_physics_manager_wake_rigid_body
+ */
+void fe_physics_manager_wake_rigid_body(fe_rigid_body_t* rb) {
+    if (!rb) return;
+    if (rb->island_next) {
+        fe_island_wake(rb, fe_physics_push_awake, NULL);
+    } else if (rb->awake_index != UINT32_MAX) {
+        // Hâlâ uyanık listede (bu adımda dışarıdan uyutulmuş)
+        rb->is_awake = true;
+        rb->sleep_time = 0.0f;
+    }
+}
+
+/**
+ * Uygulama: fe_physics_manager_set_sleeping_enabled
+ */
+void fe_physics_manager_set_sleeping_enabled(bool enabled) {
+    g_manager_state.enable_sleeping = enabled;
+    if (enabled || !g_manager_state.rigid_bodies) return;
+
+    for (size_t i = 0; i < fe_array_count(g_manager_state.rigid_bodies); ++i) {
+        fe_rigid_body_t** rb_ptr = (fe_rigid_body_t**)fe_array_get(g_manager_state.rigid_bodies, i);
+        if (rb_ptr && *rb_ptr) fe_island_wake(*rb_ptr, fe_physics_push_awake, NULL);
     }
+}
+
+/**
+ * Uygulama: fe_physics_manager_get_candidate_pairs
+ */
+const fe_broadphase_pair_t* fe_physics_manager_get_candidate_pairs(uint32_t* out_count) {
+    return fe_broadphase_get_pairs(&g_manager_state.broadphase, out_count);
+}
+
+/**
+ * Uygulama: fe_physics_manager_get_broadphase
+ */
+const fe_broadphase_t* fe_physics_manager_get_broadphase(void) {
+    return &g_manager_state.broadphase;
+}
+
+/**
+ * Uygulama: fe_physics_manager_get_collision_solver
+ */
+fe_collision_solver_t* fe_physics_manager_get_collision_solver(void) {
+    return &g_manager_state.solver;
+}
+
+/**
+ * Uygulama: fe_physics_manager_get_step_stats
+ */
+void fe_physics_manager_get_step_stats(fe_physics_step_stats_t* out_stats) {
+    if (out_stats) *out_stats = g_manager_state.last_step;
+}
+
+/**
+ * Uygulama: fe_physics_manager_step
+ */
+void fe_physics_manager_step(void) {
+    // Uyuyan adalar hiçbir döngüye girmez: adım maliyeti uyanık cisim sayısıyla orantılıdır.
+    // Kayıtlar adımın tek durumudur; aşamalar onları yerinde okur ve yazar (kopya/eşitleme yoktur).
+    if (!g_manager_state.awake_bodies) return;
+    uint32_t count = fe_physics_awake_count();
+    fe_physics_step_stats_t* stats = &g_manager_state.last_step;
+    fe_timer_t timer;
+    fe_timer_start(&timer);
+
+    // 1. Yerçekimi ve biriken kuvvetlerle hızları güncelle
+    fe_job_parallel_for(count, FE_PHYSICS_JOB_GRAIN, fe_physics_integrate_velocities_range, NULL);
 
     // 2. Çarpışma Tespiti ve Çözümü (En karmaşık kısım!)
-    // TODO: fe_collider_manager_detect_collisions();
-    // TODO: fe_collision_solver_resolve_contacts();
+    // Çözücü, kuvvetlerle güncellenmiş hızları düzeltir; konumlar ancak ondan sonra ilerletilir.
+    double detect_start = fe_timer_get_elapsed_s(&timer);
+    fe_physics_detect_collisions(count);
+    double solve_start = fe_timer_get_elapsed_s(&timer);
+    bool solve_contacts = g_manager_state.solver.constraints && g_manager_state.islands.parent;
+    if (solve_contacts) fe_physics_wake_touching_islands();
+    fe_physics_wake_jointed_islands();
+    count = fe_physics_awake_count(); // Uyananlar listenin sonuna eklendi
+    fe_rigid_body_t* const* bodies = fe_physics_awake_bodies();
 
-    // 3. Konum ve Hız Entegrasyonu
-    for (size_t i = 0; i < count; ++i) {
-        current_rb_ptr = (fe_rigid_body_t**)fe_array_get(g_manager_state.rigid_bodies, i);
-        if (!current_rb_ptr || !(*current_rb_ptr) || (*current_rb_ptr)->is_kinematic || !(*current_rb_ptr)->is_awake) continue;
+    // Eklemler renklere ayrılır ve adaları da birleştirir (bağlı cisimler birlikte uyur)
+    uint32_t joint_pair_count = 0;
+    bool solve_joints = g_manager_state.joint_solver.joints && g_manager_state.awake_joints &&
+                        fe_constraint_solver_build(&g_manager_state.joint_solver, fe_physics_collect_awake_joints(), count);
+    const uint32_t* joint_pairs = fe_constraint_solver_get_body_pairs(&g_manager_state.joint_solver, &joint_pair_count);
+    if (g_manager_state.islands.parent) {
+        fe_island_manager_build(&g_manager_state.islands, count, &g_manager_state.solver, joint_pairs, joint_pair_count);
+    }
 
-        // fe_rigid_body_integrate, kuvvetleri kullanır ve temizler.
-        fe_rigid_body_integrate(*current_rb_ptr, FE_PHYSICS_FIXED_DT);
+    // İkisi de aynı hız dizisinde çalışır; her ikisinin sonucu da iş parçacığı sayısından bağımsızdır.
+    // Çözüm alt adımlarla ilerler; konum, alt adımların toplam yer değiştirmesidir (hız olarak yazılır).
+    bool solved = (solve_contacts || solve_joints) &&
+                  fe_collision_solver_load_velocities(&g_manager_state.solver, bodies, count, FE_PHYSICS_FIXED_DT);
+    if (solved) {
+        if (solve_joints && g_manager_state.joint_solver.joint_count > 0) {
+            fe_physics_solve_interleaved();
+        } else {
+            fe_job_parallel_for(fe_physics_island_job_count(), FE_PHYSICS_ISLAND_GRAIN, fe_physics_solve_islands_range, NULL);
+        }
+        fe_collision_solver_store_displacements(&g_manager_state.solver, bodies, count);
+    }
+    double solve_end = fe_timer_get_elapsed_s(&timer);
+
+    // 3. Konum Entegrasyonu, ardından alt adımların son hızları
+    fe_job_parallel_for(count, FE_PHYSICS_JOB_GRAIN, fe_physics_integrate_positions_range, NULL);
+    if (solved) fe_collision_solver_store_velocities(&g_manager_state.solver, bodies, count);
+
+    // 4. Uyku: tüm cisimleri yeterince uzun süre dinlenen adalar uyutulur
+    if (g_manager_state.enable_sleeping && g_manager_state.islands.parent) {
+        fe_island_manager_update_sleep(&g_manager_state.islands, bodies, FE_PHYSICS_FIXED_DT);
     }
+
+    // 5. Uyuyanları uyanık listeden çıkar
+    fe_physics_compact_awake_bodies();
+
+    stats->step_ms = fe_timer_get_elapsed_s(&timer) * 1000.0;
+    stats->detect_ms = (solve_start - detect_start) * 1000.0;
+    stats->solve_ms = (solve_end - solve_start) * 1000.0;
+    stats->awake_bodies = count;
+    stats->active_contacts = g_manager_state.solver.active_count;
+    stats->island_count = g_manager_state.islands.island_count;
     
     FE_LOG_TRACE("Fizik adimi tamamlandi.");
     
@@ -2,7 +2,8 @@
 
 #include "physics/fe_physics_thruster_component.h"
 #include "utils/fe_logger.h"
-#include <stdlib.h> // malloc, free
+#include "memory/fe_memory_manager.h" // fe_mem_calloc, fe_mem_free
+#include "physics/fe_physics_manager.h" // fe_physics_manager_wake_rigid_body
 #include <math.h>   // fmaxf, fminf
 
 // Dahili yardımcı fonksiyonlar için bildirim (fe_vector, fe_matrix kütüphanelerinde olmalıdır)
@@ -30,7 +31,7 @@ fe_physics_thruster_component_t* fe_thruster_create(
     }
     
     fe_physics_thruster_component_t* thruster = 
-        (fe_physics_thruster_component_t*)calloc(1, sizeof(fe_physics_thruster_component_t));
+        (fe_physics_thruster_component_t*)fe_mem_calloc(1, sizeof(fe_physics_thruster_component_t));
         
     if (!thruster) {
         FE_LOG_FATAL("İtici bileseni icin bellek ayrilamadi.");
@@ -57,7 +58,7 @@ fe_physics_thruster_component_t* fe_thruster_create(
  */
 void fe_thruster_destroy(fe_physics_thruster_component_t* thruster) {
     if (thruster) {
-        free(thruster);
+        fe_mem_free(thruster);
         FE_LOG_TRACE("İtici Bileseni yok edildi.");
     }
 }
@@ -70,7 +71,7 @@ void fe_thruster_set_throttle(fe_physics_thruster_component_t* thruster, float f
     thruster->throttle_factor = fminf(1.0f, fmaxf(0.0f, factor));
     // Gaz verilince cismi uyandır
     if (thruster->throttle_factor > 0.0f && thruster->target_body) {
-        thruster->target_body->is_awake = true;
+        fe_physics_manager_wake_rigid_body(thruster->target_body); // Uyuyorsa adasıyla birlikte
     }
 }
 
@@ -2,7 +2,9 @@
 
 #include "physics/fe_radial_force_component.h"
 #include "utils/fe_logger.h"
-#include <stdlib.h> // malloc, free
+#include "memory/fe_memory_manager.h" // fe_mem_calloc, fe_mem_free
+#include "physics/fe_scene_query.h" // fe_scene_query_overlap_sphere
+#include "physics/fe_physics_manager.h" // fe_physics_manager_wake_rigid_body
 #include <math.h>   // powf, fmaxf
 
 // Benzersiz kimlik sayacı
@@ -21,7 +23,7 @@ fe_radial_force_component_t* fe_radial_force_create(
     float strength,
     fe_radial_force_type_t type) 
 {
-    fe_radial_force_component_t* rf = (fe_radial_force_component_t*)calloc(1, sizeof(fe_radial_force_component_t));
+    fe_radial_force_component_t* rf = (fe_radial_force_component_t*)fe_mem_calloc(1, sizeof(fe_radial_force_component_t));
     
     if (!rf) {
         FE_LOG_FATAL("Radyal kuvvet bileseni icin bellek ayrilamadi.");
@@ -47,7 +49,7 @@ fe_radial_force_component_t* fe_radial_force_create(
  */
 void fe_radial_force_destroy(fe_radial_force_component_t* rf_comp) {
     if (rf_comp) {
-        free(rf_comp);
+        fe_mem_free(rf_comp);
         FE_LOG_TRACE("Radyal Kuvvet Bileseni yok edildi.");
     }
 }
@@ -76,23 +78,17 @@ static float fe_radial_force_calculate_factor(const fe_radial_force_component_t*
 }
 
 /**
- * Uygulama: fe_radial_force_apply
+ * @brief Kuvveti/darbeyi tek bir cisme uygular; bileşenin durumunu değiştirmez.
+ * @return Cisim etki alanındaysa ve kuvvet uygulandıysa true.
  */
-void fe_radial_force_apply(
-    fe_radial_force_component_t* rf_comp, 
-    fe_rigid_body_t* rb, 
-    float dt) 
-{
-    if (!rf_comp->is_active || rb->is_kinematic || !rb->is_awake || rb->mass <= 0.0f) return;
+static bool fe_radial_force_apply_to_body(const fe_radial_force_component_t* rf_comp, fe_rigid_body_t* rb) {
+    if (rb->is_kinematic || !rb->is_awake || rb->mass <= 0.0f) return false;
 
-    // Impuls ise ve zaten uygulanmışsa, atla
-    if (rf_comp->type == FE_RF_TYPE_IMPULSE && rf_comp->applied) return;
-    
     // 1. Uzaklık ve Yönü Hesapla
     fe_vec3_t delta = fe_vec3_subtract(rb->position, rf_comp->position);
     float distance = fe_vec3_length(delta);
 
-    if (distance > rf_comp->max_radius) return;
+    if (distance > rf_comp->max_radius) return false;
     
     // 2. Kuvvet Yönünü Normalize Et
     fe_vec3_t direction = fe_vec3_normalize(delta);
@@ -118,10 +114,6 @@ void fe_radial_force_apply(
         fe_vec3_t delta_v = fe_vec3_scale(impulse, rb->inverse_mass);
         rb->linear_velocity = fe_vec3_add(rb->linear_velocity, delta_v);
         
-        // Darbe uygulandı, devre dışı bırak
-        rf_comp->applied = true;
-        rf_comp->is_active = false;
-        
         FE_LOG_TRACE("Impulse uygulandı: Mag=%.2f, RB: %.2f %.2f", magnitude, rb->position.x, rb->position.y);
     } else {
         // Sürekli Kuvvet (F=ma)
@@ -130,4 +122,70 @@ void fe_radial_force_apply(
         // Kuvveti rigid body'nin toplam kuvvet birikimine ekle
         fe_rigid_body_apply_force(rb, force);
     }
+    return true;
+}
+
+/**
+ * Uygulama: fe_radial_force_apply
+ */
+void fe_radial_force_apply(
+    fe_radial_force_component_t* rf_comp, 
+    fe_rigid_body_t* rb, 
+    float dt) 
+{
+    (void)dt;
+    if (!rf_comp->is_active) return;
+
+    // Impuls ise ve zaten uygulanmışsa, atla
+    if (rf_comp->type == FE_RF_TYPE_IMPULSE && rf_comp->applied) return;
+
+    if (fe_radial_force_apply_to_body(rf_comp, rb) && rf_comp->type == FE_RF_TYPE_IMPULSE) {
+        // Darbe uygulandı, devre dışı bırak
+        rf_comp->applied = true;
+        rf_comp->is_active = false;
+    }
+}
+
+typedef struct fe_radial_force_range_context {
+    const fe_radial_force_component_t* rf_comp;
+    uint32_t affected_count;
+} fe_radial_force_range_context_t;
+
+static bool fe_radial_force_range_callback(void* context, uint32_t query_index, fe_rigid_body_t* rb) {
+    (void)query_index;
+    fe_radial_force_range_context_t* ctx = (fe_radial_force_range_context_t*)context;
+
+    // Patlama uyuyan cisimleri de etkiler (kinematik ve statik cisimler uyandırılmaz)
+    if (!rb->is_awake && !rb->is_kinematic && rb->mass > 0.0f) {
+        fe_vec3_t delta = fe_vec3_subtract(rb->position, ctx->rf_comp->position);
+        if (fe_vec3_length(delta) <= ctx->rf_comp->max_radius) fe_physics_manager_wake_rigid_body(rb);
+    }
+
+    if (fe_radial_force_apply_to_body(ctx->rf_comp, rb)) ctx->affected_count++;
+    return true;
+}
+
+/**
+ * Uygulama: fe_radial_force_apply_in_range
+ */
+uint32_t fe_radial_force_apply_in_range(
+    fe_radial_force_component_t* rf_comp,
+    const fe_broadphase_t* broadphase,
+    float dt)
+{
+    (void)dt;
+    if (!rf_comp->is_active || !broadphase) return 0;
+    if (rf_comp->type == FE_RF_TYPE_IMPULSE && rf_comp->applied) return 0;
+
+    fe_radial_force_range_context_t ctx = { rf_comp, 0 };
+    fe_scene_query_overlap_sphere(broadphase, rf_comp->position, rf_comp->max_radius, fe_radial_force_range_callback, &ctx);
+
+    if (rf_comp->type == FE_RF_TYPE_IMPULSE) {
+        // Darbe alandaki tüm cisimlere uygulandı, devre dışı bırak
+        rf_comp->applied = true;
+        rf_comp->is_active = false;
+    }
+
+    FE_LOG_TRACE("Radyal kuvvet %u: %u cisme uygulandi.", rf_comp->id, ctx.affected_count);
+    return ctx.affected_count;
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "physics/fe_ragdoll_physics.h"
 #include "utils/fe_logger.h"
 #include "data_structures/fe_array.h"
+#include "physics/fe_physics_manager.h" // fe_physics_manager_wake_rigid_body, add/remove
 #include <stdlib.h> // malloc, free
 #include <string.h> // memset
 
@@ -41,9 +42,10 @@ fe_ragdoll_t* fe_ragdoll_create(void* character_handle) {
 void fe_ragdoll_destroy(fe_ragdoll_t* ragdoll) {
     if (!ragdoll) return;
     
-    // Önce kısıtlamaları yok et
+    // Önce kısıtlamaları yok et (yönetici artık onları çözmemeli)
     for (size_t i = 0; i < fe_array_count(ragdoll->constraints); ++i) {
         fe_physics_constraint_component_t** c_ptr = (fe_physics_constraint_component_t**)fe_array_get(ragdoll->constraints, i);
+        fe_physics_manager_remove_constraint(*c_ptr);
         fe_constraint_destroy(*c_ptr);
     }
     fe_array_destroy(ragdoll->constraints);
@@ -51,50 +53,81 @@ void fe_ragdoll_destroy(fe_ragdoll_t* ragdoll) {
     // Sonra rigid body'leri yok et
     for (size_t i = 0; i < fe_array_count(ragdoll->rigid_bodies); ++i) {
         fe_rigid_body_t** rb_ptr = (fe_rigid_body_t**)fe_array_get(ragdoll->rigid_bodies, i);
-        // NOT: Ragdoll'daki rigid body'ler fe_physics_manager'dan da kaldirilmalidir.
+        // Yönetici yok edilmiş cisme adım atmamalı (depo, broadphase vekili ve temaslar temizlenir)
+        fe_physics_manager_remove_rigid_body(*rb_ptr);
         fe_rigid_body_destroy(*rb_ptr);
     }
     fe_array_destroy(ragdoll->rigid_bodies);
 
-    free(ragdoll);
     FE_LOG_INFO("Ragdoll %u yok edildi.", ragdoll->id);
+    free(ragdoll);
 }
 
 // ----------------------------------------------------------------------
 // 2. KURULUM VE BAĞLANTI (SETUP)
 // ----------------------------------------------------------------------
 
+/**
+ * @brief Kutu icin yerel eylemsizlik tensoru (yari boyutlardan).
+ */
+static fe_mat4_t fe_ragdoll_box_inertia(float mass, fe_vec3_t half) {
+    fe_mat4_t inertia = FE_MAT4_IDENTITY;
+    inertia.mm[0][0] = mass * (half.y * half.y + half.z * half.z) / 3.0f;
+    inertia.mm[1][1] = mass * (half.x * half.x + half.z * half.z) / 3.0f;
+    inertia.mm[2][2] = mass * (half.x * half.x + half.y * half.y) / 3.0f;
+    return inertia;
+}
+
 /**
  * Uygulama: fe_ragdoll_setup_from_skeleton
- * * Gerçek iskelet verileriyle doldurma işlemi, motorun iskelet sistemine bağlıdır.
+ * * Tanımlar animasyon sisteminin bind pozundan gelir; burada yalnızca fizik temsili kurulur.
  */
-void fe_ragdoll_setup_from_skeleton(fe_ragdoll_t* ragdoll /* Skeletal veri parametreleri */) {
-    // Bu, tipik bir kurulum örneğidir:
-    
-    // 1. Kemikleri Rigid Body Olarak Yarat
-    
-    // fe_rigid_body_t* pelvis_rb = fe_rigid_body_create();
-    // // ... kütle ve tensör ayarları
-    // fe_array_push(ragdoll->rigid_bodies, &pelvis_rb);
-    
-    // fe_rigid_body_t* spine_rb = fe_rigid_body_create();
-    // fe_array_push(ragdoll->rigid_bodies, &spine_rb);
-    
-    // 2. Kısıtlamaları (Eklemleri) Yarat
-    
-    // fe_physics_constraint_component_t* pelvis_spine_joint = fe_constraint_create(
-    //     FE_CONSTRAINT_BALL_AND_SOCKET, pelvis_rb, spine_rb);
-    
-    // // fe_constraint_set_limits(pelvis_spine_joint, ...); // Açı limitlerini ayarla
-    
-    // fe_array_push(ragdoll->constraints, &pelvis_spine_joint);
-    
-    // 3. Rigid Body'leri fe_physics_manager'a ekle (Manager'ın bu fonksiyonu olmalı)
-    // fe_physics_manager_add_rigid_body(pelvis_rb);
-    // fe_physics_manager_add_rigid_body(spine_rb);
-    
+fe_error_code_t fe_ragdoll_setup_from_skeleton(fe_ragdoll_t* ragdoll, const fe_ragdoll_bone_desc_t* bones, uint32_t bone_count) {
+    if (!ragdoll || !bones || bone_count == 0 || bone_count > FE_MAX_RAGDOLL_BONES ||
+        fe_array_count(ragdoll->rigid_bodies) != 0) {
+        return FE_ERR_INVALID_ARGUMENT;
+    }
+    for (uint32_t i = 0; i < bone_count; ++i) {
+        // Ebeveyn önce gelmeli; aksi halde eklem henüz yaratılmamış bir cisme bağlanırdı
+        if (bones[i].parent >= (int32_t)i || (i == 0 && bones[i].parent != -1) || bones[i].mass <= 0.0f) {
+            FE_LOG_ERROR("Ragdoll %u: kemik %u gecersiz (ebeveyn %d, kutle %.2f).", ragdoll->id, i, bones[i].parent, bones[i].mass);
+            return FE_ERR_INVALID_ARGUMENT;
+        }
+    }
+
+    // 1. Kemikleri Rigid Body olarak yarat (devre dışı ragdoll: kinematik, animasyon sürer)
+    fe_rigid_body_t* bodies[FE_MAX_RAGDOLL_BONES];
+    for (uint32_t i = 0; i < bone_count; ++i) {
+        fe_rigid_body_t* rb = fe_rigid_body_create();
+        rb->collider = fe_collider_create_box(bones[i].half_extents);
+        rb->position = bones[i].position;
+        fe_rigid_body_set_mass_properties(rb, bones[i].mass, fe_ragdoll_box_inertia(bones[i].mass, bones[i].half_extents));
+        rb->is_kinematic = true;
+        bodies[i] = rb;
+        fe_array_push(ragdoll->rigid_bodies, &rb);
+    }
+
+    // 2. Kısıtlamaları (eklemleri) bind pozunda yarat
+    for (uint32_t i = 0; i < bone_count; ++i) {
+        if (bones[i].parent < 0) continue;
+        fe_physics_constraint_component_t* joint = fe_constraint_create(bones[i].joint_type, bodies[bones[i].parent], bodies[i]);
+        fe_constraint_set_world_anchor(joint, bones[i].joint_position);
+        if (bones[i].joint_type == FE_CONSTRAINT_HINGE) {
+            fe_constraint_set_hinge_axis(joint, bones[i].hinge_axis);
+        }
+        joint->is_active = false;
+        fe_array_push(ragdoll->constraints, &joint);
+    }
+
+    // 3. Rigid Body'leri ve eklemleri fe_physics_manager'a ekle (eklemler kemik sırasıyla: çözüm sırası)
+    fe_physics_manager_add_rigid_bodies(bodies, bone_count);
+    for (size_t i = 0; i < fe_array_count(ragdoll->constraints); ++i) {
+        fe_physics_manager_add_constraint(*(fe_physics_constraint_component_t**)fe_array_get(ragdoll->constraints, i));
+    }
+
     FE_LOG_DEBUG("Ragdoll iskelet verileri ile kuruldu. Kemik sayisi: %zu, Eklemler: %zu", 
                  fe_array_count(ragdoll->rigid_bodies), fe_array_count(ragdoll->constraints));
+    return FE_OK;
 }
 
 // ----------------------------------------------------------------------
@@ -115,7 +148,7 @@ void fe_ragdoll_activate(fe_ragdoll_t* ragdoll) {
         // Statik kütlesi olmayan cisimler bileşenleri tamamen statik bırakılabilir.
         if (rb->mass > 0.0f) {
             rb->is_kinematic = false; // Fiziğin kontrolüne geç
-            rb->is_awake = true;      // Simülasyonu başlat
+            fe_physics_manager_wake_rigid_body(rb); // Simülasyonu başlat
             
             // TODO: Eğer varsa, karakterin mevcut animasyon pozisyonundan RB'lerin konumunu ve yönelimini ayarla.
             // rb->position = fe_get_bone_world_position(ragdoll->character_handle, i);
@@ -129,7 +162,7 @@ void fe_ragdoll_activate(fe_ragdoll_t* ragdoll) {
     }
     
     ragdoll->is_active = true;
-    FE_LOG_WARNING("Ragdoll %u etkinlestirildi. Fizik kontrolü devraldi.", ragdoll->id);
+    FE_LOG_WARN("Ragdoll %u etkinlestirildi. Fizik kontrolü devraldi.", ragdoll->id);
     
     
 }
@@ -161,5 +194,5 @@ void fe_ragdoll_deactivate(fe_ragdoll_t* ragdoll) {
     }
 
     ragdoll->is_active = false;
-    FE_LOG_WARNING("Ragdoll %u devre disi birakildi. Animasyon kontrolü devraldi.", ragdoll->id);
+    FE_LOG_WARN("Ragdoll %u devre disi birakildi. Animasyon kontrolü devraldi.", ragdoll->id);
 }
\ No newline at end of file
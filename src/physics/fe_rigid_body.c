@@ -2,8 +2,9 @@
 
 #include "physics/fe_rigid_body.h"
 #include "utils/fe_logger.h"
-#include <stdlib.h> // malloc, free
+#include "memory/fe_memory_manager.h" // fe_mem_calloc, fe_mem_free
 #include <string.h> // memcpy
+#include <math.h> // sqrtf
 
 // Dahili yardımcı fonksiyonlar için bildirimler (fe_quaternion.h varsayılarak)
 fe_vec4_t fe_quat_normalize(fe_vec4_t q);
@@ -21,7 +22,7 @@ fe_vec4_t fe_quat_scale(fe_vec4_t q, float s);
  * Uygulama: fe_rigid_body_create
  */
 fe_rigid_body_t* fe_rigid_body_create(void) {
-    fe_rigid_body_t* rb = (fe_rigid_body_t*)calloc(1, sizeof(fe_rigid_body_t));
+    fe_rigid_body_t* rb = (fe_rigid_body_t*)fe_mem_calloc(1, sizeof(fe_rigid_body_t));
     if (!rb) {
         FE_LOG_FATAL("Rigid body icin bellek ayrilamadi.");
         return NULL;
@@ -37,6 +38,7 @@ fe_rigid_body_t* fe_rigid_body_create(void) {
     rb->is_kinematic = false;
     rb->inertia_tensor = FE_MAT4_IDENTITY;
     rb->inverse_inertia_tensor = FE_MAT4_IDENTITY; 
+    rb->awake_index = UINT32_MAX; // Yöneticiye eklenene kadar uyanık listesinde değil
     
     FE_LOG_TRACE("Rigid Body olusturuldu.");
     return rb;
@@ -47,7 +49,8 @@ fe_rigid_body_t* fe_rigid_body_create(void) {
  */
 void fe_rigid_body_destroy(fe_rigid_body_t* rb) {
     if (rb) {
-        free(rb);
+        fe_collider_destroy(rb->collider);
+        fe_mem_free(rb);
         FE_LOG_TRACE("Rigid Body yok edildi.");
     }
 }
@@ -135,65 +138,110 @@ void fe_rigid_body_apply_force_at_point(fe_rigid_body_t* rb, fe_vec3_t force, fe
 // ----------------------------------------------------------------------
 
 /**
- * Uygulama: fe_rigid_body_integrate
- * Simülasyonun kalbi: Hareket denklemlerini çözerek cismin yeni konumunu hesaplar (Basit Euler entegrasyonu).
+ * Uygulama: fe_rigid_body_get_world_inverse_inertia
  */
-void fe_rigid_body_integrate(fe_rigid_body_t* rb, float dt) {
+void fe_rigid_body_get_world_inverse_inertia(const fe_rigid_body_t* rb, fe_vec3_t out_rows[3]) {
+    if (rb->is_kinematic || rb->inverse_mass <= 0.0f) {
+        for (int i = 0; i < 3; ++i) out_rows[i] = (fe_vec3_t){{0.0f, 0.0f, 0.0f}};
+        return;
+    }
+
+    fe_vec3_t r[3];
+    fe_physics_quat_to_rows(rb->orientation, r);
+
+    // Yerel tensörün 3x3 kısmı (simetrik olduğu için satır/sütun düzeni fark etmez)
+    const float (*inv)[4] = rb->inverse_inertia_tensor.mm;
+
+    // M = R * I^-1
+    fe_vec3_t m[3];
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            m[i].v[j] = r[i].x * inv[0][j] + r[i].y * inv[1][j] + r[i].z * inv[2][j];
+        }
+    }
+    // M * R^T
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            out_rows[i].v[j] = m[i].x * r[j].x + m[i].y * r[j].y + m[i].z * r[j].z;
+        }
+    }
+}
+
+/**
+ * Uygulama: fe_rigid_body_integrate_velocity
+ * Yarı-örtük (semi-implicit) Euler'in ilk yarısı: v += (F / m) * dt, w += I^-1 * tau * dt
+ */
+void fe_rigid_body_integrate_velocity(fe_rigid_body_t* rb, float dt) {
     if (!rb->is_awake || rb->is_kinematic) return;
-    
-    // **********************************************
-    // 1. Doğrusal Hareket (Position ve Linear Velocity)
-    // **********************************************
-    
-    // İvme (a) = F / m
-    fe_vec3_t linear_acceleration = fe_vec3_scale(rb->total_force, rb->inverse_mass);
-    
-    // Yeni Hız: v_yeni = v_eski + a * dt
-    rb->linear_velocity = fe_vec3_add(rb->linear_velocity, fe_vec3_scale(linear_acceleration, dt));
-    
+
+    // İvme (a) = F / m; fizik adımı bunu her uyanık cisim için çağırır, vektör işlemleri satır içidir
+    float linear_scale = rb->inverse_mass * dt;
+    rb->linear_velocity.x += rb->total_force.x * linear_scale;
+    rb->linear_velocity.y += rb->total_force.y * linear_scale;
+    rb->linear_velocity.z += rb->total_force.z * linear_scale;
+
+    // Açısal İvme: alpha = I_world^-1 * Tork (torksuz cisimlerde dünya eylemsizliği hesaplanmaz)
+    fe_vec3_t torque = rb->total_torque;
+    if (torque.x != 0.0f || torque.y != 0.0f || torque.z != 0.0f) {
+        fe_vec3_t inv_inertia[3];
+        fe_rigid_body_get_world_inverse_inertia(rb, inv_inertia);
+        for (int i = 0; i < 3; ++i) {
+            rb->angular_velocity.v[i] += (inv_inertia[i].x * torque.x + inv_inertia[i].y * torque.y +
+                                          inv_inertia[i].z * torque.z) * dt;
+        }
+    }
+
+    // Kuvvetleri temizle (bir sonraki adım için)
+    rb->total_force = (fe_vec3_t){{0.0f, 0.0f, 0.0f}};
+    rb->total_torque = (fe_vec3_t){{0.0f, 0.0f, 0.0f}};
+}
+
+/**
+ * Uygulama: fe_rigid_body_integrate_position
+ * Yarı-örtük Euler'in ikinci yarısı: konum, çözücünün düzelttiği yeni hızlarla ilerletilir.
+ */
+void fe_rigid_body_integrate_position(fe_rigid_body_t* rb, float dt) {
+    if (!rb->is_awake || rb->is_kinematic) return;
+
     // Yeni Konum: x_yeni = x_eski + v * dt
-    rb->position = fe_vec3_add(rb->position, fe_vec3_scale(rb->linear_velocity, dt));
+    rb->position.x += rb->linear_velocity.x * dt;
+    rb->position.y += rb->linear_velocity.y * dt;
+    rb->position.z += rb->linear_velocity.z * dt;
+
+    // Yönelim Güncellemesi: q_yeni = q_eski + 0.5 * (w * q_eski) * dt
+    // w dünya uzayında olduğu için soldan çarpılır; w = (wx, wy, wz, 0)
+    fe_vec3_t w = rb->angular_velocity;
+    fe_vec4_t q = rb->orientation;
+    fe_vec4_t dq;
+    dq.x = w.x * q.w + w.y * q.z - w.z * q.y;
+    dq.y = w.y * q.w + w.z * q.x - w.x * q.z;
+    dq.z = w.z * q.w + w.x * q.y - w.y * q.x;
+    dq.w = -w.x * q.x - w.y * q.y - w.z * q.z;
+
+    float half_dt = 0.5f * dt;
+    q.x += dq.x * half_dt;
+    q.y += dq.y * half_dt;
+    q.z += dq.z * half_dt;
+    q.w += dq.w * half_dt;
 
-    // **********************************************
-    // 2. Açısal Hareket (Orientation ve Angular Velocity)
-    // **********************************************
-    
-    // Açısal İvme: alpha = Inverse_I * Tork
-    // Tensör, dünya uzayına dönüştürülmelidir: I_world_inverse = R * I_local_inverse * R^T
-    // NOT: Basitlik için sadece yerel ters tensör çarpımı kullanılmıştır.
-    // fe_mat4_transform_vec3_normal fonksiyonunun T * v olduğunu varsayalım.
-    fe_vec3_t angular_acceleration; 
-    // angular_acceleration = fe_mat4_transform_vec3_normal(rb->inverse_inertia_tensor, rb->total_torque); 
-    // fe_mat4_transform_vec3_normal fonksiyonu mevcut olmadığı için vektör matris çarpımının uygulanması gerekir.
-    // Basit bir yaklaşımla, sadece dönme matrisini kullanarak çarpımı simüle edelim (Gerçekte daha karmaşıktır):
-    
-    // Torkun etkisini açısal hızda biriktir
-    angular_acceleration = fe_vec3_scale(rb->total_torque, 0.1f * rb->inverse_mass); // Çok basit yaklaşımla
-    rb->angular_velocity = fe_vec3_add(rb->angular_velocity, fe_vec3_scale(angular_acceleration, dt));
-    
-    // Yönelim (Quaternion) Güncellemesi: q_yeni = q_eski + (0.5 * q_eski * w) * dt
-    // w: (angular_velocity.x, angular_velocity.y, angular_velocity.z, 0) kuaterni
-    fe_vec4_t w = (fe_vec4_t){rb->angular_velocity.x, rb->angular_velocity.y, rb->angular_velocity.z, 0.0f};
-    fe_vec4_t dq = fe_quat_multiply_vec3(rb->orientation, w);
-    
-    rb->orientation = fe_quat_add(rb->orientation, fe_quat_scale(dq, 0.5f * dt));
-    
     // Yönelimi normalize et (drift'i önler)
-    rb->orientation = fe_quat_normalize(rb->orientation);
-    
-    // **********************************************
-    // 3. Türetilmiş Değerleri Güncelle
-    // **********************************************
-    
+    rb->orientation = fe_quat_normalize(q);
+
     // Render ve çarpışma için dönüş matrisini güncelle
     rb->rotation_matrix = fe_quat_to_mat4(rb->orientation);
+}
+
+/**
+ * Uygulama: fe_rigid_body_integrate
+ * Temas çözümü olmadan tek başına kullanım için: önce hız, sonra konum (yarı-örtük Euler).
+ */
+void fe_rigid_body_integrate(fe_rigid_body_t* rb, float dt) {
+    if (!rb->is_awake || rb->is_kinematic) return;
+
+    fe_rigid_body_integrate_velocity(rb, dt);
+    fe_rigid_body_integrate_position(rb, dt);
 
-    // Kuvvetleri temizle (bir sonraki kare için)
-    fe_rigid_body_clear_forces(rb);
-    
     // TODO: Uyku sistemini kontrol et (Hız sıfıra yakınsa is_awake = false)
-    
-    
 }
 
 // ----------------------------------------------------------------------
@@ -228,9 +276,17 @@ fe_vec4_t fe_quat_multiply_vec3(fe_vec4_t q, fe_vec3_t v) {
     return result;
 }
 
-// Temsili Quaternion'dan Matris'e dönüştürme (fe_matrix.c'de de olmalıdır)
+// Quaternion'dan Matris'e dönüştürme (fe_matrix.c'de de olmalıdır)
+// Sütun-major: (satır r, sütun c) = mm[c][r]
 fe_mat4_t fe_quat_to_mat4(fe_vec4_t q) {
-    // ... dönüştürme formülü buraya gelecektir
-    // Basit yer tutucu olarak Identity döndürülür:
-    return FE_MAT4_IDENTITY; 
+    fe_vec3_t rows[3];
+    fe_physics_quat_to_rows(q, rows);
+
+    fe_mat4_t m = FE_MAT4_IDENTITY;
+    for (int r = 0; r < 3; ++r) {
+        for (int c = 0; c < 3; ++c) {
+            m.mm[c][r] = rows[r].v[c];
+        }
+    }
+    return m;
 }
\ No newline at end of file
@@ -0,0 +1,828 @@
+// src/physics/fe_scene_query.c
+
+#include "physics/fe_scene_query.h"
+#include "physics/fe_narrowphase.h"
+#include "math/fe_simd.h" // fe_simd_t, FE_SIMD_WIDTH
+#include "memory/fe_memory_manager.h" // fe_mem_alloc, fe_mem_free
+#include <math.h>  // sqrtf, fabsf
+#include <float.h> // FLT_MAX
+
+#define FE_SQ_EPSILON 1e-6f
+
+// Dağınık ışınların gezdiği geniş ağacın düğüm başına çocuk sayısı (bir SIMD kaydı; SIMD'siz 4)
+#ifdef FE_SIMD_WIDTH
+    #define FE_SQ_WIDE FE_SIMD_WIDTH
+#else
+    #define FE_SQ_WIDE 4
+#endif
+
+// Geniş ağaç çocuk kodunda yaprak biti (alt bitler broadphase düğüm indeksi)
+#define FE_SQ_WIDE_LEAF 0x80000000u
+
+// Işın yönünün sıfır bileşenleri için ters yön (1/0 yerine; 0 * sonsuz NaN üretmesin diye sonlu)
+#define FE_SQ_INV_DIR_LIMIT 1e30f
+
+// ----------------------------------------------------------------------
+// 1. YARDIMCI FONKSİYONLAR
+// ----------------------------------------------------------------------
+
+static inline bool fe_sq_is_leaf(const fe_broadphase_node_t* node) {
+    return node->child1 == FE_BROADPHASE_NULL_PROXY;
+}
+
+static inline fe_vec3_t fe_sq_madd(fe_vec3_t a, fe_vec3_t b, float s) {
+    return (fe_vec3_t){{a.x + b.x * s, a.y + b.y * s, a.z + b.z * s}};
+}
+
+static inline float fe_sq_inv(float d) {
+    if (fabsf(d) > 1.0f / FE_SQ_INV_DIR_LIMIT) return 1.0f / d;
+    return d < 0.0f ? -FE_SQ_INV_DIR_LIMIT : FE_SQ_INV_DIR_LIMIT;
+}
+
+/**
+ * @brief Işının kutuya giriş mesafesi; kutuya [0, t_max] aralığında girmiyorsa FLT_MAX.
+ */
+static inline float fe_sq_ray_aabb(const fe_aabb_t* box, fe_vec3_t origin, fe_vec3_t inv_dir, float t_max) {
+    float t_near = 0.0f;
+    float t_far = t_max;
+    for (int i = 0; i < 3; ++i) {
+        float t1 = (box->min.v[i] - origin.v[i]) * inv_dir.v[i];
+        float t2 = (box->max.v[i] - origin.v[i]) * inv_dir.v[i];
+        if (t1 > t2) { float tmp = t1; t1 = t2; t2 = tmp; }
+        if (t1 > t_near) t_near = t1;
+        if (t2 < t_far) t_far = t2;
+    }
+    return t_near <= t_far ? t_near : FLT_MAX;
+}
+
+/**
+ * @brief Işının orijinden geçen kürenin yüzeyine giriş mesafesi (o: küre merkezine göre başlangıç).
+ * * Başlangıç kürenin içindeyse veya ışın kürenin dışından geçiyorsa false.
+ */
+static bool fe_sq_ray_sphere_local(fe_vec3_t o, fe_vec3_t d, float radius, float* out_t) {
+    float c = fe_vec3_dot(o, o) - radius * radius;
+    if (c <= 0.0f) return false;
+    float b = fe_vec3_dot(o, d);
+    if (b >= 0.0f) return false; // Küreden uzaklaşıyor
+    float disc = b * b - c;
+    if (disc < 0.0f) return false;
+    *out_t = -b - sqrtf(disc);
+    return true;
+}
+
+/**
+ * @brief Işını bir cismin gerçek geometrisiyle keser.
+ * * Test geometrinin yerel uzayında yapılır; normal ve mesafe dünya uzayına döndürülür.
+ * @param t_max Bundan uzak isabetler yok sayılır.
+ * @return İsabet varsa true (out_t <= t_max).
+ */
+static bool fe_sq_ray_body(const fe_rigid_body_t* rb, fe_vec3_t origin, fe_vec3_t direction, float t_max,
+                           float* out_t, fe_vec3_t* out_normal) {
+    const fe_collider_t* collider = rb->collider;
+    fe_vec3_t rows[3];
+    fe_physics_quat_to_rows(rb->orientation, rows);
+
+    // Geometri merkezi ve yerel uzaya dönüşüm (R^T ile çarpım: sütunlar yerel eksenler)
+    fe_vec3_t center;
+    for (int i = 0; i < 3; ++i) center.v[i] = rb->position.v[i] + fe_vec3_dot(rows[i], collider->local_offset);
+    fe_vec3_t rel = fe_vec3_subtract(origin, center);
+    fe_vec3_t o, d;
+    for (int i = 0; i < 3; ++i) {
+        fe_vec3_t axis = {{rows[0].v[i], rows[1].v[i], rows[2].v[i]}};
+        o.v[i] = fe_vec3_dot(axis, rel);
+        d.v[i] = fe_vec3_dot(axis, direction);
+    }
+
+    float t = FLT_MAX;
+    fe_vec3_t n = {{0.0f, 0.0f, 0.0f}};
+
+    switch (collider->type) {
+        case FE_COLLIDER_SPHERE: {
+            float radius = collider->shape.sphere.radius;
+            if (!fe_sq_ray_sphere_local(o, d, radius, &t)) return false;
+            n = fe_vec3_scale(fe_sq_madd(o, d, t), 1.0f / radius);
+            break;
+        }
+        case FE_COLLIDER_BOX: {
+            fe_vec3_t h = collider->shape.box.half_extents;
+            if (fabsf(o.x) <= h.x && fabsf(o.y) <= h.y && fabsf(o.z) <= h.z) return false;
+            float t_near = 0.0f, t_far = t_max;
+            int axis = -1;
+            for (int i = 0; i < 3; ++i) {
+                if (fabsf(d.v[i]) < FE_SQ_EPSILON) {
+                    if (fabsf(o.v[i]) > h.v[i]) return false; // Dilime paralel ve dışında
+                    continue;
+                }
+                float inv = 1.0f / d.v[i];
+                float t1 = (-h.v[i] - o.v[i]) * inv;
+                float t2 = (h.v[i] - o.v[i]) * inv;
+                if (t1 > t2) { float tmp = t1; t1 = t2; t2 = tmp; }
+                if (t1 > t_near) { t_near = t1; axis = i; }
+                if (t2 < t_far) t_far = t2;
+                if (t_near > t_far) return false;
+            }
+            if (axis < 0) return false;
+            t = t_near;
+            n.v[axis] = d.v[axis] > 0.0f ? -1.0f : 1.0f;
+            break;
+        }
+        case FE_COLLIDER_CAPSULE: {
+            // Kapsül = yan silindir + iki uç küresi; ilk giriş bunların en yakınıdır
+            // (silindirin düz uçları kürelerin içinde kaldığından ayrıca test edilmez).
+            float radius = collider->shape.capsule.radius;
+            float hh = collider->shape.capsule.half_height;
+            float oy = o.y < -hh ? -hh : (o.y > hh ? hh : o.y);
+            fe_vec3_t to_axis = {{o.x, o.y - oy, o.z}};
+            if (fe_vec3_length_sq(to_axis) <= radius * radius) return false;
+
+            float a = d.x * d.x + d.z * d.z;
+            if (a > FE_SQ_EPSILON) {
+                float b = o.x * d.x + o.z * d.z;
+                float c = o.x * o.x + o.z * o.z - radius * radius;
+                float disc = b * b - a * c;
+                if (disc >= 0.0f) {
+                    float tc = (-b - sqrtf(disc)) / a;
+                    float y = o.y + d.y * tc;
+                    if (tc >= 0.0f && y >= -hh && y <= hh) {
+                        t = tc;
+                        n = (fe_vec3_t){{(o.x + d.x * tc) / radius, 0.0f, (o.z + d.z * tc) / radius}};
+                    }
+                }
+            }
+            for (int cap = 0; cap < 2; ++cap) {
+                fe_vec3_t cap_o = {{o.x, o.y - (cap ? hh : -hh), o.z}};
+                float ts;
+                if (fe_sq_ray_sphere_local(cap_o, d, radius, &ts) && ts < t) {
+                    t = ts;
+                    n = fe_vec3_scale(fe_sq_madd(cap_o, d, ts), 1.0f / radius);
+                }
+            }
+            if (t == FLT_MAX) return false;
+            break;
+        }
+        default:
+            return false;
+    }
+
+    if (t < 0.0f || t > t_max) return false;
+
+    // Normali dünya uzayına döndür (R * n)
+    for (int i = 0; i < 3; ++i) out_normal->v[i] = fe_vec3_dot(rows[i], n);
+    *out_t = t;
+    return true;
+}
+
+static inline void fe_sq_fill_hit(fe_query_hit_t* hit, fe_rigid_body_t* rb, fe_vec3_t origin, fe_vec3_t direction,
+                                  float t, fe_vec3_t normal) {
+    hit->body = rb;
+    hit->point = fe_sq_madd(origin, direction, t);
+    hit->normal = normal;
+    hit->distance = t;
+}
+
+
+// ----------------------------------------------------------------------
+// 2. IŞIN SORGULARI
+// ----------------------------------------------------------------------
+
+/**
+ * Uygulama: fe_scene_query_raycast
+ * * Yakın çocuk önce gezilir; bulunan her isabet t_max'ı kısaltıp kalan dalları budar.
+ */
+bool fe_scene_query_raycast(const fe_broadphase_t* bp, const fe_ray_t* ray, fe_query_hit_t* out_hit) {
+    out_hit->body = NULL;
+    if (bp->root == FE_BROADPHASE_NULL_PROXY) return false;
+
+    fe_vec3_t inv_dir = {{fe_sq_inv(ray->direction.x), fe_sq_inv(ray->direction.y), fe_sq_inv(ray->direction.z)}};
+    float t_max = ray->max_distance;
+
+    // Düğümle birlikte giriş mesafesi saklanır: yığından çıkan düğüm, o arada bulunan isabetten uzaksa atlanır
+    uint32_t stack[FE_BROADPHASE_STACK_SIZE];
+    float stack_t[FE_BROADPHASE_STACK_SIZE];
+    uint32_t stack_count = 0;
+    float root_t = fe_sq_ray_aabb(&bp->nodes[bp->root].aabb, ray->origin, inv_dir, t_max);
+    if (root_t == FLT_MAX) return false;
+    stack[stack_count] = bp->root;
+    stack_t[stack_count++] = root_t;
+
+    while (stack_count > 0) {
+        --stack_count;
+        if (stack_t[stack_count] > t_max) continue;
+        const fe_broadphase_node_t* node = &bp->nodes[stack[stack_count]];
+
+        if (fe_sq_is_leaf(node)) {
+            fe_rigid_body_t* rb = (fe_rigid_body_t*)node->user_data;
+            if (rb == ray->ignore_body || !rb->collider) continue;
+            float t;
+            fe_vec3_t normal;
+            if (fe_sq_ray_body(rb, ray->origin, ray->direction, t_max, &t, &normal)) {
+                t_max = t;
+                fe_sq_fill_hit(out_hit, rb, ray->origin, ray->direction, t, normal);
+            }
+            continue;
+        }
+
+        float t1 = fe_sq_ray_aabb(&bp->nodes[node->child1].aabb, ray->origin, inv_dir, t_max);
+        float t2 = fe_sq_ray_aabb(&bp->nodes[node->child2].aabb, ray->origin, inv_dir, t_max);
+        uint32_t near = node->child1, far = node->child2;
+        if (t2 < t1) { float tmp = t1; t1 = t2; t2 = tmp; near = node->child2; far = node->child1; }
+
+        // Uzak çocuk önce yığına konur ki yakın olan önce çıksın
+        if (t2 != FLT_MAX && stack_count < FE_BROADPHASE_STACK_SIZE) { stack[stack_count] = far; stack_t[stack_count++] = t2; }
+        if (t1 != FLT_MAX && stack_count < FE_BROADPHASE_STACK_SIZE) { stack[stack_count] = near; stack_t[stack_count++] = t1; }
+    }
+
+    return out_hit->body != NULL;
+}
+
+/**
+ * @brief Birlikte gezilen ışın paketi (SoA; SIMD yüklemeleri için).
+ * * Boş şeritlerde t_max = -1: hiçbir kutuya girmezler.
+ */
+typedef struct fe_sq_ray_packet {
+    float origin[3][FE_SCENE_QUERY_PACKET_SIZE];
+    float inv_dir[3][FE_SCENE_QUERY_PACKET_SIZE];
+    float t_max[FE_SCENE_QUERY_PACKET_SIZE];
+} fe_sq_ray_packet_t;
+
+/**
+ * @brief Kutuya giren şeritlerin maskesi (bit i: şerit i).
+ */
+static uint32_t fe_sq_packet_test_aabb(const fe_sq_ray_packet_t* packet, const fe_aabb_t* box) {
+    uint32_t mask = 0;
+#ifdef FE_SIMD_WIDTH
+    for (uint32_t base = 0; base < FE_SCENE_QUERY_PACKET_SIZE; base += FE_SIMD_WIDTH) {
+        fe_simd_t t_near = fe_simd_zero();
+        fe_simd_t t_far = fe_simd_load(&packet->t_max[base]);
+        for (int i = 0; i < 3; ++i) {
+            fe_simd_t o = fe_simd_load(&packet->origin[i][base]);
+            fe_simd_t inv = fe_simd_load(&packet->inv_dir[i][base]);
+            fe_simd_t t1 = fe_simd_mul(fe_simd_sub(fe_simd_set1(box->min.v[i]), o), inv);
+            fe_simd_t t2 = fe_simd_mul(fe_simd_sub(fe_simd_set1(box->max.v[i]), o), inv);
+            t_near = fe_simd_max(t_near, fe_simd_min(t1, t2));
+            t_far = fe_simd_min(t_far, fe_simd_max(t1, t2));
+        }
+        mask |= (uint32_t)fe_simd_movemask(fe_simd_le(t_near, t_far)) << base;
+    }
+#else
+    for (uint32_t lane = 0; lane < FE_SCENE_QUERY_PACKET_SIZE; ++lane) {
+        float t_near = 0.0f, t_far = packet->t_max[lane];
+        for (int i = 0; i < 3; ++i) {
+            float t1 = (box->min.v[i] - packet->origin[i][lane]) * packet->inv_dir[i][lane];
+            float t2 = (box->max.v[i] - packet->origin[i][lane]) * packet->inv_dir[i][lane];
+            t_near = fmaxf(t_near, fminf(t1, t2));
+            t_far = fminf(t_far, fmaxf(t1, t2));
+        }
+        if (t_near <= t_far) mask |= 1u << lane;
+    }
+#endif
+    return mask;
+}
+
+/**
+ * @brief Paketin ortalama yönü yeterince uzunsa (ışınlar aynı yöne bakıyorsa) true.
+ * @param out_order_dir Işın yönlerinin toplamı (tutarlı paketlerde çocuk sırası için).
+ */
+static bool fe_sq_packet_is_coherent(const fe_ray_t* rays, uint32_t count, fe_vec3_t* out_order_dir) {
+    fe_vec3_t order_dir = {{0.0f, 0.0f, 0.0f}};
+    for (uint32_t lane = 0; lane < count; ++lane) order_dir = fe_vec3_add(order_dir, rays[lane].direction);
+    *out_order_dir = order_dir;
+    float coherence = FE_SCENE_QUERY_PACKET_COHERENCE * (float)count;
+    return fe_vec3_length_sq(order_dir) >= coherence * coherence;
+}
+
+/**
+ * @brief Tutarlı bir paketi ağaçta gezer. Düğüm, kutusuna giren tek bir şerit kalmadığında budanır.
+ */
+static uint32_t fe_sq_raycast_packet(const fe_broadphase_t* bp, const fe_ray_t* rays, uint32_t count, fe_vec3_t order_dir,
+                                     fe_query_hit_t* out_hits) {
+    fe_sq_ray_packet_t packet;
+
+    for (uint32_t lane = 0; lane < FE_SCENE_QUERY_PACKET_SIZE; ++lane) {
+        if (lane < count) {
+            const fe_ray_t* ray = &rays[lane];
+            for (int i = 0; i < 3; ++i) {
+                packet.origin[i][lane] = ray->origin.v[i];
+                packet.inv_dir[i][lane] = fe_sq_inv(ray->direction.v[i]);
+            }
+            packet.t_max[lane] = ray->max_distance;
+            out_hits[lane].body = NULL;
+        } else {
+            for (int i = 0; i < 3; ++i) {
+                packet.origin[i][lane] = 0.0f;
+                packet.inv_dir[i][lane] = FE_SQ_INV_DIR_LIMIT;
+            }
+            packet.t_max[lane] = -1.0f;
+        }
+    }
+
+    uint32_t stack[FE_BROADPHASE_STACK_SIZE];
+    uint32_t stack_count = 0;
+    stack[stack_count++] = bp->root;
+
+    while (stack_count > 0) {
+        const fe_broadphase_node_t* node = &bp->nodes[stack[--stack_count]];
+        uint32_t mask = fe_sq_packet_test_aabb(&packet, &node->aabb);
+        if (mask == 0) continue;
+
+        if (fe_sq_is_leaf(node)) {
+            fe_rigid_body_t* rb = (fe_rigid_body_t*)node->user_data;
+            if (!rb->collider) continue;
+            for (uint32_t lane = 0; lane < count; ++lane) {
+                if (!(mask & (1u << lane)) || rb == rays[lane].ignore_body) continue;
+                float t;
+                fe_vec3_t normal;
+                if (fe_sq_ray_body(rb, rays[lane].origin, rays[lane].direction, packet.t_max[lane], &t, &normal)) {
+                    packet.t_max[lane] = t;
+                    fe_sq_fill_hit(&out_hits[lane], rb, rays[lane].origin, rays[lane].direction, t, normal);
+                }
+            }
+            continue;
+        }
+
+        if (stack_count + 2 > FE_BROADPHASE_STACK_SIZE) continue;
+
+        // Ortalama yönde geride kalan çocuk önce çıkar (tutarlı paketlerde önce yakın isabetler bulunur)
+        const fe_aabb_t* a1 = &bp->nodes[node->child1].aabb;
+        const fe_aabb_t* a2 = &bp->nodes[node->child2].aabb;
+        float c1 = 0.0f, c2 = 0.0f;
+        for (int i = 0; i < 3; ++i) {
+            c1 += (a1->min.v[i] + a1->max.v[i]) * order_dir.v[i];
+            c2 += (a2->min.v[i] + a2->max.v[i]) * order_dir.v[i];
+        }
+        if (c1 <= c2) {
+            stack[stack_count++] = node->child2;
+            stack[stack_count++] = node->child1;
+        } else {
+            stack[stack_count++] = node->child1;
+            stack[stack_count++] = node->child2;
+        }
+    }
+
+    uint32_t hit_count = 0;
+    for (uint32_t lane = 0; lane < count; ++lane) {
+        if (out_hits[lane].body) hit_count++;
+    }
+    return hit_count;
+}
+
+/**
+ * @brief Dağınık ışınlar için ağacın geniş (FE_SQ_WIDE çocuklu) SoA kopyası.
+ * * İkili ağacın birkaç seviyesi tek düğümde toplanır; tek bir ışın bir düğümün tüm çocuk
+ * * kutularını bir SIMD testinde keser. Toplu çağrı başında kurulur, çağrı sonunda bırakılır.
+ */
+typedef struct fe_sq_wide_node {
+    float min[3][FE_SQ_WIDE];
+    float max[3][FE_SQ_WIDE];
+    uint32_t child[FE_SQ_WIDE];   // FE_SQ_WIDE_LEAF biti: broadphase yaprağı, değilse geniş düğüm indeksi
+    uint32_t child_count;
+} fe_sq_wide_node_t;
+
+typedef struct fe_sq_wide_tree {
+    fe_sq_wide_node_t* nodes;
+    uint32_t node_count;
+} fe_sq_wide_tree_t;
+
+static inline float fe_sq_aabb_area(const fe_aabb_t* box) {
+    fe_vec3_t e = fe_vec3_subtract(box->max, box->min);
+    return e.x * e.y + e.y * e.z + e.z * e.x;
+}
+
+/**
+ * @brief İkili iç düğümü geniş düğüme katlar: en büyük yüzeyli iç çocuk, FE_SQ_WIDE çocuk olana dek açılır.
+ * @return Geniş düğümün indeksi.
+ */
+static uint32_t fe_sq_wide_build_node(fe_sq_wide_tree_t* wide, const fe_broadphase_t* bp, uint32_t binary) {
+    uint32_t frontier[FE_SQ_WIDE];
+    uint32_t frontier_count = 2;
+    frontier[0] = bp->nodes[binary].child1;
+    frontier[1] = bp->nodes[binary].child2;
+
+    while (frontier_count < FE_SQ_WIDE) {
+        int best = -1;
+        float best_area = -1.0f;
+        for (uint32_t k = 0; k < frontier_count; ++k) {
+            const fe_broadphase_node_t* node = &bp->nodes[frontier[k]];
+            if (fe_sq_is_leaf(node)) continue;
+            float area = fe_sq_aabb_area(&node->aabb);
+            if (area > best_area) { best_area = area; best = (int)k; }
+        }
+        if (best < 0) break;
+        const fe_broadphase_node_t* node = &bp->nodes[frontier[best]];
+        frontier[best] = node->child1;
+        frontier[frontier_count++] = node->child2;
+    }
+
+    uint32_t index = wide->node_count++;
+    fe_sq_wide_node_t* out = &wide->nodes[index];
+    out->child_count = frontier_count;
+    for (uint32_t k = 0; k < FE_SQ_WIDE; ++k) {
+        // Boş şeritler maskeyle elenir; kutuları sonlu tutulur ki SIMD testinde NaN oluşmasın
+        const fe_aabb_t* box = (k < frontier_count) ? &bp->nodes[frontier[k]].aabb : &bp->nodes[binary].aabb;
+        for (int i = 0; i < 3; ++i) {
+            out->min[i][k] = box->min.v[i];
+            out->max[i][k] = box->max.v[i];
+        }
+    }
+    for (uint32_t k = 0; k < frontier_count; ++k) {
+        uint32_t child = frontier[k];
+        // Özyineleme düğüm dizisini büyütmez (yer başta ayrıldı); out geçerli kalır
+        out->child[k] = fe_sq_is_leaf(&bp->nodes[child]) ? (child | FE_SQ_WIDE_LEAF) : fe_sq_wide_build_node(wide, bp, child);
+    }
+    return index;
+}
+
+/**
+ * @brief Geniş ağacı kurar. Kök yaprak ise veya bellek yetmezse false (ışınlar ikili ağaçta gezilir).
+ */
+static bool fe_sq_wide_build(fe_sq_wide_tree_t* wide, const fe_broadphase_t* bp) {
+    wide->nodes = NULL;
+    wide->node_count = 0;
+    if (fe_sq_is_leaf(&bp->nodes[bp->root])) return false;
+
+    // Her geniş düğüm en az bir ikili iç düğümü tüketir; iç düğüm sayısı (yaprak - 1) üst sınırdır
+    uint32_t capacity = bp->node_count / 2 + 1;
+    wide->nodes = (fe_sq_wide_node_t*)fe_mem_alloc(capacity * sizeof(fe_sq_wide_node_t));
+    if (!wide->nodes) return false;
+    fe_sq_wide_build_node(wide, bp, bp->root);
+    return true;
+}
+
+/**
+ * @brief Geniş düğümün çocuk kutularına giren şeritlerin maskesi; giriş mesafeleri out_t_near'a yazılır.
+ */
+static inline uint32_t fe_sq_wide_test(const fe_sq_wide_node_t* node, const float origin[3], const float inv_dir[3], float t_max,
+                                       float out_t_near[FE_SQ_WIDE]) {
+    uint32_t mask = 0;
+#ifdef FE_SIMD_WIDTH
+    for (uint32_t base = 0; base < FE_SQ_WIDE; base += FE_SIMD_WIDTH) {
+        fe_simd_t t_near = fe_simd_zero();
+        fe_simd_t t_far = fe_simd_set1(t_max);
+        for (int i = 0; i < 3; ++i) {
+            fe_simd_t o = fe_simd_set1(origin[i]);
+            fe_simd_t inv = fe_simd_set1(inv_dir[i]);
+            fe_simd_t t1 = fe_simd_mul(fe_simd_sub(fe_simd_load(&node->min[i][base]), o), inv);
+            fe_simd_t t2 = fe_simd_mul(fe_simd_sub(fe_simd_load(&node->max[i][base]), o), inv);
+            t_near = fe_simd_max(t_near, fe_simd_min(t1, t2));
+            t_far = fe_simd_min(t_far, fe_simd_max(t1, t2));
+        }
+        fe_simd_store(&out_t_near[base], t_near);
+        mask |= (uint32_t)fe_simd_movemask(fe_simd_le(t_near, t_far)) << base;
+    }
+#else
+    for (uint32_t lane = 0; lane < FE_SQ_WIDE; ++lane) {
+        float t_near = 0.0f, t_far = t_max;
+        for (int i = 0; i < 3; ++i) {
+            float t1 = (node->min[i][lane] - origin[i]) * inv_dir[i];
+            float t2 = (node->max[i][lane] - origin[i]) * inv_dir[i];
+            t_near = fmaxf(t_near, fminf(t1, t2));
+            t_far = fminf(t_far, fmaxf(t1, t2));
+        }
+        out_t_near[lane] = t_near;
+        if (t_near <= t_far) mask |= 1u << lane;
+    }
+#endif
+    return mask & ((1u << node->child_count) - 1u);
+}
+
+/**
+ * @brief Tek ışını geniş ağaçta gezer; sonuç fe_scene_query_raycast ile aynıdır.
+ * * Kesilen çocuklar (yapraklar dahil) uzaktan yakına yığına konur: yakın olan önce çıkar, bulunan
+ * * isabet t_max'ı kısaltıp yığında bekleyen uzak çocukları budar.
+ */
+static bool fe_sq_raycast_wide(const fe_sq_wide_tree_t* wide, const fe_broadphase_t* bp, const fe_ray_t* ray, fe_query_hit_t* out_hit) {
+    out_hit->body = NULL;
+    const float origin[3] = {ray->origin.x, ray->origin.y, ray->origin.z};
+    const float inv_dir[3] = {fe_sq_inv(ray->direction.x), fe_sq_inv(ray->direction.y), fe_sq_inv(ray->direction.z)};
+    float t_max = ray->max_distance;
+
+    uint32_t stack[FE_BROADPHASE_STACK_SIZE];
+    float stack_t[FE_BROADPHASE_STACK_SIZE];
+    uint32_t stack_count = 0;
+    stack[stack_count] = 0;
+    stack_t[stack_count++] = 0.0f;
+
+    while (stack_count > 0) {
+        --stack_count;
+        if (stack_t[stack_count] > t_max) continue;
+        uint32_t entry = stack[stack_count];
+
+        if (entry & FE_SQ_WIDE_LEAF) {
+            fe_rigid_body_t* rb = (fe_rigid_body_t*)bp->nodes[entry & ~FE_SQ_WIDE_LEAF].user_data;
+            if (rb == ray->ignore_body || !rb->collider) continue;
+            float t;
+            fe_vec3_t normal;
+            if (fe_sq_ray_body(rb, ray->origin, ray->direction, t_max, &t, &normal)) {
+                t_max = t;
+                fe_sq_fill_hit(out_hit, rb, ray->origin, ray->direction, t, normal);
+            }
+            continue;
+        }
+
+        const fe_sq_wide_node_t* node = &wide->nodes[entry];
+        float t_near[FE_SQ_WIDE];
+        uint32_t mask = fe_sq_wide_test(node, origin, inv_dir, t_max, t_near);
+        if (mask == 0) continue;
+
+        // Kesilen çocukları mesafeye göre azalan sırada ekle (en fazla FE_SQ_WIDE eleman; araya sokma)
+        uint32_t hit_child[FE_SQ_WIDE];
+        float hit_t[FE_SQ_WIDE];
+        uint32_t hit_count = 0;
+        for (uint32_t lane = 0; lane < FE_SQ_WIDE; ++lane) {
+            if (!(mask & (1u << lane))) continue;
+            uint32_t k = hit_count++;
+            while (k > 0 && hit_t[k - 1] < t_near[lane]) {
+                hit_t[k] = hit_t[k - 1];
+                hit_child[k] = hit_child[k - 1];
+                --k;
+            }
+            hit_t[k] = t_near[lane];
+            hit_child[k] = node->child[lane];
+        }
+        if (stack_count + hit_count > FE_BROADPHASE_STACK_SIZE) continue;
+        for (uint32_t k = 0; k < hit_count; ++k) {
+            stack[stack_count] = hit_child[k];
+            stack_t[stack_count++] = hit_t[k];
+        }
+    }
+
+    return out_hit->body != NULL;
+}
+
+/**
+ * Uygulama: fe_scene_query_raycast_batch
+ * * Tutarlı paketler ikili ağaçta birlikte gezilir. Dağınık paketlerin ışınları tek tek, ama geniş
+ * * ağaçta gezilir; geniş ağaç ilk dağınık pakette, kalan ışınlar kurulum maliyetini karşılıyorsa kurulur.
+ */
+uint32_t fe_scene_query_raycast_batch(const fe_broadphase_t* bp, const fe_ray_t* rays, uint32_t count, fe_query_hit_t* out_hits) {
+    if (bp->root == FE_BROADPHASE_NULL_PROXY) {
+        for (uint32_t i = 0; i < count; ++i) out_hits[i].body = NULL;
+        return 0;
+    }
+
+    fe_sq_wide_tree_t wide = { NULL, 0 };
+    bool wide_tried = false;
+    uint32_t hit_count = 0;
+    for (uint32_t begin = 0; begin < count; begin += FE_SCENE_QUERY_PACKET_SIZE) {
+        uint32_t packet_count = count - begin < FE_SCENE_QUERY_PACKET_SIZE ? count - begin : FE_SCENE_QUERY_PACKET_SIZE;
+        const fe_ray_t* packet = rays + begin;
+        fe_vec3_t order_dir;
+        if (fe_sq_packet_is_coherent(packet, packet_count, &order_dir)) {
+            hit_count += fe_sq_raycast_packet(bp, packet, packet_count, order_dir, out_hits + begin);
+            continue;
+        }
+
+        // Dağınık ışınlar ortak dal paylaşmaz; paket her ışının dallarının birleşimini gezerdi
+        if (!wide_tried) {
+            wide_tried = true;
+            if ((uint64_t)(count - begin) * FE_SCENE_QUERY_WIDE_BUILD_RATIO >= bp->node_count) fe_sq_wide_build(&wide, bp);
+        }
+        for (uint32_t lane = 0; lane < packet_count; ++lane) {
+            bool hit = wide.nodes ? fe_sq_raycast_wide(&wide, bp, &packet[lane], &out_hits[begin + lane])
+                                  : fe_scene_query_raycast(bp, &packet[lane], &out_hits[begin + lane]);
+            if (hit) hit_count++;
+        }
+    }
+    fe_mem_free(wide.nodes);
+    return hit_count;
+}
+
+// ----------------------------------------------------------------------
+// 3. ŞEKİL TARAMASI (SWEEP)
+// ----------------------------------------------------------------------
+
+typedef struct fe_sq_sweep_context {
+    const fe_broadphase_t* bp;
+    const fe_sweep_query_t* query;
+    fe_query_hit_t* hit;
+    float best;                 // Şimdiye kadarki en yakın isabet (yoksa max_distance)
+} fe_sq_sweep_context_t;
+
+/**
+ * @brief Tek bir aday cisme güvenli ilerleme (conservative advancement).
+ * * Öteleme altında iki dışbükey geometri arasındaki mesafe yolun dışbükey bir fonksiyonudur:
+ * * ayırıcı normal boyunca boşluk kapanmıyorsa daha ileride de kapanmaz. Aksi halde şekil,
+ * * boşluğu kapatacak kadar ilerletilir; bu ayırıcı eksen üzerinde hiçbir zaman temasın ötesine geçmez.
+ */
+static bool fe_sq_sweep_callback(void* context, uint32_t proxy_id) {
+    fe_sq_sweep_context_t* ctx = (fe_sq_sweep_context_t*)context;
+    const fe_sweep_query_t* q = ctx->query;
+    fe_rigid_body_t* rb = (fe_rigid_body_t*)fe_broadphase_get_user_data(ctx->bp, proxy_id);
+    if (rb == q->ignore_body || !rb->collider) return true;
+
+    float t = 0.0f;
+    for (uint32_t iter = 0; iter < FE_SCENE_QUERY_SWEEP_ITERATIONS; ++iter) {
+        fe_vec3_t position = fe_sq_madd(q->position, q->direction, t);
+        fe_narrowphase_manifold_t m;
+
+        // Kalan yolda kapanabilecek boşluklar için temas noktası üretilir
+        float reach = ctx->best - t + FE_SCENE_QUERY_SWEEP_TOLERANCE;
+        if (!fe_narrowphase_collide_speculative(q->shape, position, q->orientation,
+                                                rb->collider, rb->position, rb->orientation, reach, &m)) {
+            return true;
+        }
+
+        const fe_narrowphase_point_t* deepest = &m.points[0];
+        for (uint32_t i = 1; i < m.point_count; ++i) {
+            if (m.points[i].penetration > deepest->penetration) deepest = &m.points[i];
+        }
+
+        float separation = -deepest->penetration;
+        float approach = fe_vec3_dot(q->direction, m.normal);
+        if (separation <= FE_SCENE_QUERY_SWEEP_TOLERANCE) {
+            // Kalan boşluk da kapatılır (sıyırarak gelen taramalarda tolerans yolda çok daha uzun bir paya karşılık gelir)
+            float advance = (separation > 0.0f && approach > FE_SQ_EPSILON) ? separation / approach : 0.0f;
+            t += advance;
+            if (t <= ctx->best) {
+                ctx->best = t;
+                ctx->hit->body = rb;
+                ctx->hit->point = fe_sq_madd(deepest->position, q->direction, advance);
+                ctx->hit->normal = fe_vec3_negate(m.normal); // Normal A'dan (şekil) B'ye; isabet normali şekle bakar
+                ctx->hit->distance = t;
+            }
+            return true;
+        }
+
+        if (approach <= FE_SQ_EPSILON) return true; // Boşluk kapanmıyor
+
+        t += separation / approach;
+        if (t > ctx->best) return true;
+    }
+    return true;
+}
+
+/**
+ * Uygulama: fe_scene_query_sweep
+ */
+bool fe_scene_query_sweep(const fe_broadphase_t* bp, const fe_sweep_query_t* query, fe_query_hit_t* out_hit) {
+    out_hit->body = NULL;
+    if (bp->root == FE_BROADPHASE_NULL_PROXY || !query->shape) return false;
+
+    // Adaylar: yolun başındaki ve sonundaki kutuları kapsayan kutu
+    fe_aabb_t start, end;
+    fe_collider_compute_aabb(query->shape, query->position, query->orientation, &start);
+    fe_collider_compute_aabb(query->shape, fe_sq_madd(query->position, query->direction, query->max_distance), query->orientation, &end);
+    fe_aabb_t swept = fe_aabb_union(&start, &end);
+
+    fe_sq_sweep_context_t ctx = { bp, query, out_hit, query->max_distance };
+    fe_broadphase_query(bp, &swept, fe_sq_sweep_callback, &ctx);
+    return out_hit->body != NULL;
+}
+
+/**
+ * Uygulama: fe_scene_query_sweep_batch
+ */
+uint32_t fe_scene_query_sweep_batch(const fe_broadphase_t* bp, const fe_sweep_query_t* queries, uint32_t count, fe_query_hit_t* out_hits) {
+    uint32_t hit_count = 0;
+    for (uint32_t i = 0; i < count; ++i) {
+        if (fe_scene_query_sweep(bp, &queries[i], &out_hits[i])) hit_count++;
+    }
+    return hit_count;
+}
+
+
+// ----------------------------------------------------------------------
+// 4. ÖRTÜŞME (OVERLAP)
+// ----------------------------------------------------------------------
+
+typedef struct fe_sq_overlap_context {
+    const fe_broadphase_t* bp;
+    const fe_collider_t* shape;
+    fe_vec3_t position;
+    fe_vec4_t orientation;
+    uint32_t query_index;
+    fe_scene_query_callback_t callback;
+    void* user_context;
+} fe_sq_overlap_context_t;
+
+/**
+ * @brief Şişman kutusu kesişen adayı gerçek geometriyle doğrular (boşluk payı 0).
+ */
+static bool fe_sq_overlaps_body(const fe_collider_t* shape, fe_vec3_t position, fe_vec4_t orientation, const fe_rigid_body_t* rb) {
+    fe_narrowphase_manifold_t m;
+    return rb->collider &&
+           fe_narrowphase_collide_speculative(shape, position, orientation, rb->collider, rb->position, rb->orientation, 0.0f, &m);
+}
+
+static bool fe_sq_overlap_callback(void* context, uint32_t proxy_id) {
+    fe_sq_overlap_context_t* ctx = (fe_sq_overlap_context_t*)context;
+    fe_rigid_body_t* rb = (fe_rigid_body_t*)fe_broadphase_get_user_data(ctx->bp, proxy_id);
+    if (!fe_sq_overlaps_body(ctx->shape, ctx->position, ctx->orientation, rb)) return true;
+    return ctx->callback(ctx->user_context, ctx->query_index, rb);
+}
+
+/**
+ * Uygulama: fe_scene_query_overlap
+ */
+void fe_scene_query_overlap(const fe_broadphase_t* bp, const fe_collider_t* shape, fe_vec3_t position, fe_vec4_t orientation,
+                            fe_scene_query_callback_t callback, void* context) {
+    if (!shape || !callback) return;
+
+    fe_aabb_t aabb;
+    fe_collider_compute_aabb(shape, position, orientation, &aabb);
+    fe_sq_overlap_context_t ctx = { bp, shape, position, orientation, 0, callback, context };
+    fe_broadphase_query(bp, &aabb, fe_sq_overlap_callback, &ctx);
+}
+
+static inline fe_collider_t fe_sq_make_sphere(float radius) {
+    fe_collider_t sphere = {0};
+    sphere.type = FE_COLLIDER_SPHERE;
+    sphere.shape.sphere.radius = radius;
+    sphere.proxy_id = FE_BROADPHASE_NULL_PROXY;
+    return sphere;
+}
+
+/**
+ * Uygulama: fe_scene_query_overlap_sphere
+ */
+void fe_scene_query_overlap_sphere(const fe_broadphase_t* bp, fe_vec3_t center, float radius,
+                                   fe_scene_query_callback_t callback, void* context) {
+    fe_collider_t sphere = fe_sq_make_sphere(radius);
+    fe_scene_query_overlap(bp, &sphere, center, (fe_vec4_t){{0.0f, 0.0f, 0.0f, 1.0f}}, callback, context);
+}
+
+/**
+ * @brief Birlikte gezilen küre paketi. Boş veya durdurulmuş şeritlerde radius_sq = -1.
+ */
+typedef struct fe_sq_sphere_packet {
+    float center[3][FE_SCENE_QUERY_PACKET_SIZE];
+    float radius_sq[FE_SCENE_QUERY_PACKET_SIZE];
+} fe_sq_sphere_packet_t;
+
+/**
+ * @brief Kutuya değen kürelerin maskesi (kutuya en yakın noktanın uzaklığı <= yarıçap).
+ */
+static uint32_t fe_sq_packet_test_sphere(const fe_sq_sphere_packet_t* packet, const fe_aabb_t* box) {
+    uint32_t mask = 0;
+#ifdef FE_SIMD_WIDTH
+    for (uint32_t base = 0; base < FE_SCENE_QUERY_PACKET_SIZE; base += FE_SIMD_WIDTH) {
+        fe_simd_t dist_sq = fe_simd_zero();
+        for (int i = 0; i < 3; ++i) {
+            fe_simd_t c = fe_simd_load(&packet->center[i][base]);
+            fe_simd_t below = fe_simd_sub(fe_simd_set1(box->min.v[i]), c);
+            fe_simd_t above = fe_simd_sub(c, fe_simd_set1(box->max.v[i]));
+            fe_simd_t d = fe_simd_max(fe_simd_max(below, above), fe_simd_zero());
+            dist_sq = fe_simd_add(dist_sq, fe_simd_mul(d, d));
+        }
+        mask |= (uint32_t)fe_simd_movemask(fe_simd_le(dist_sq, fe_simd_load(&packet->radius_sq[base]))) << base;
+    }
+#else
+    for (uint32_t lane = 0; lane < FE_SCENE_QUERY_PACKET_SIZE; ++lane) {
+        float dist_sq = 0.0f;
+        for (int i = 0; i < 3; ++i) {
+            float c = packet->center[i][lane];
+            float d = fmaxf(fmaxf(box->min.v[i] - c, c - box->max.v[i]), 0.0f);
+            dist_sq += d * d;
+        }
+        if (dist_sq <= packet->radius_sq[lane]) mask |= 1u << lane;
+    }
+#endif
+    return mask;
+}
+
+static void fe_sq_overlap_sphere_packet(const fe_broadphase_t* bp, const fe_sphere_query_t* queries, uint32_t first_index, uint32_t count,
+                                        fe_scene_query_callback_t callback, void* context) {
+    fe_sq_sphere_packet_t packet;
+    for (uint32_t lane = 0; lane < FE_SCENE_QUERY_PACKET_SIZE; ++lane) {
+        bool active = lane < count;
+        for (int i = 0; i < 3; ++i) packet.center[i][lane] = active ? queries[lane].center.v[i] : 0.0f;
+        packet.radius_sq[lane] = active ? queries[lane].radius * queries[lane].radius : -1.0f;
+    }
+
+    uint32_t stack[FE_BROADPHASE_STACK_SIZE];
+    uint32_t stack_count = 0;
+    stack[stack_count++] = bp->root;
+    const fe_vec4_t identity = {{0.0f, 0.0f, 0.0f, 1.0f}};
+
+    while (stack_count > 0) {
+        const fe_broadphase_node_t* node = &bp->nodes[stack[--stack_count]];
+        uint32_t mask = fe_sq_packet_test_sphere(&packet, &node->aabb);
+        if (mask == 0) continue;
+
+        if (fe_sq_is_leaf(node)) {
+            fe_rigid_body_t* rb = (fe_rigid_body_t*)node->user_data;
+            for (uint32_t lane = 0; lane < count; ++lane) {
+                if (!(mask & (1u << lane))) continue;
+                fe_collider_t sphere = fe_sq_make_sphere(queries[lane].radius);
+                if (!fe_sq_overlaps_body(&sphere, queries[lane].center, identity, rb)) continue;
+                if (!callback(context, first_index + lane, rb)) packet.radius_sq[lane] = -1.0f;
+            }
+        } else if (stack_count + 2 <= FE_BROADPHASE_STACK_SIZE) {
+            stack[stack_count++] = node->child1;
+            stack[stack_count++] = node->child2;
+        }
+    }
+}
+
+/**
+ * Uygulama: fe_scene_query_overlap_sphere_batch
+ */
+void fe_scene_query_overlap_sphere_batch(const fe_broadphase_t* bp, const fe_sphere_query_t* queries, uint32_t count,
+                                         fe_scene_query_callback_t callback, void* context) {
+    if (bp->root == FE_BROADPHASE_NULL_PROXY || !callback) return;
+
+    for (uint32_t begin = 0; begin < count; begin += FE_SCENE_QUERY_PACKET_SIZE) {
+        uint32_t packet_count = count - begin < FE_SCENE_QUERY_PACKET_SIZE ? count - begin : FE_SCENE_QUERY_PACKET_SIZE;
+        fe_sq_overlap_sphere_packet(bp, queries + begin, begin, packet_count, callback, context);
+    }
+}
@@ -54,4 +54,4 @@ bool fe_world_is_point_in_bounds(const fe_world_settings_t* settings, fe_vec3_t
     return true;
 }
 
-// TODO: fe_world_raycast_query(ray, max_distance) gibi fonksiyonlar buraya gelecektir.
\ No newline at end of file
+// Işın, şekil taraması ve örtüşme sorguları: physics/fe_scene_query.h (ağaç: fe_physics_manager_get_broadphase).
\ No newline at end of file
@@ -0,0 +1,596 @@
+// src/platform/fe_job_system.c
+
+#include "platform/fe_job_system.h"
+#include "platform/fe_thread.h"
+#include "memory/fe_memory_manager.h" // fe_mem_calloc, fe_mem_thread_shutdown
+#include "utils/fe_logger.h"
+#include <string.h> // memset
+
+#define FE_JOB_DEQUE_MASK ((uint64_t)FE_JOB_DEQUE_CAPACITY - 1)
+
+// ----------------------------------------------------------------------
+// 1. İÇ YAPILAR
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Kuyruktaki tek bir iş. Kuyruklar işleri değer olarak saklar (ayrı iş havuzu yoktur).
+ * * range_func NULL değilse iş, fe_job_parallel_for'un [begin, end) parçasıdır.
+ */
+typedef struct fe_job {
+    fe_job_func_t func;
+    fe_job_range_func_t range_func;
+    void* data;
+    fe_job_counter_t* counter;
+    uint32_t begin;
+    uint32_t end;
+    uint32_t grain;
+    uint32_t padding;
+} fe_job_t;
+
+/**
+ * @brief Chase-Lev iş çalma kuyruğu (sabit kapasiteli).
+ * * bottom'a sadece sahibi yazar (push/pop), top'u çalan iş parçacıkları CAS ile ilerletir.
+ * * Son eleman için sahip ile hırsız arasındaki yarış da top üzerinde CAS ile çözülür.
+ */
+typedef struct fe_job_deque {
+    fe_atomic_u64_t top;
+    uint8_t top_padding[FE_CACHE_LINE_SIZE - sizeof(uint64_t)];
+    fe_atomic_u64_t bottom;
+    uint8_t bottom_padding[FE_CACHE_LINE_SIZE - sizeof(uint64_t)];
+    fe_job_t jobs[FE_JOB_DEQUE_CAPACITY];
+} fe_job_deque_t;
+
+/**
+ * @brief Bir iş parçacığının (ana veya işçi) iş sistemi durumu.
+ */
+typedef struct fe_job_worker {
+    fe_job_deque_t deque;
+    fe_thread_t thread;
+    uint32_t index;
+    uint32_t random_state;          // Kurban seçimi için xorshift durumu
+    // İzleme sayaçları: sadece sahibi yazar
+    fe_atomic_u64_t jobs_executed;
+    fe_atomic_u64_t jobs_stolen;
+    fe_atomic_u64_t steal_attempts;
+    fe_atomic_u64_t sleeps;
+} fe_job_worker_t;
+
+typedef enum fe_job_steal_result {
+    FE_JOB_STEAL_EMPTY,
+    FE_JOB_STEAL_LOST,              // Başka bir iş parçacığı yarışı kazandı (kuyruk boş olmayabilir)
+    FE_JOB_STEAL_SUCCESS
+} fe_job_steal_result_t;
+
+// İş sistemi durumu
+static struct {
+    fe_job_worker_t* workers;       // [thread_count], 0. eleman ana iş parçacığı
+    uint32_t thread_count;
+    bool is_initialized;
+    fe_atomic_u32_t is_running;
+
+    // Uyuyan işçiler
+    fe_mutex_t sleep_mutex;
+    fe_cond_t sleep_cond;
+    fe_atomic_u32_t sleeping_count;
+
+    // İş sistemine ait olmayan iş parçacıklarının gönderdiği işler (kilitli halka)
+    fe_mutex_t shared_mutex;
+    fe_job_t* shared_jobs;          // [FE_JOB_DEQUE_CAPACITY]
+    uint32_t shared_head;
+    fe_atomic_u32_t shared_count;
+} g_job_system;
+
+static FE_THREAD_LOCAL fe_job_worker_t* t_job_worker = NULL;
+
+
+// ----------------------------------------------------------------------
+// 2. KUYRUK İŞLEMLERİ (CHASE-LEV)
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Sahibin kuyruğun altına iş eklemesi.
+ * @return Kuyruk doluysa false.
+ */
+static bool fe_job_deque_push(fe_job_deque_t* deque, const fe_job_t* job) {
+    uint64_t b = deque->bottom;
+    uint64_t t = fe_atomic_load_u64(&deque->top);
+    if (b - t >= FE_JOB_DEQUE_CAPACITY) {
+        return false;
+    }
+    deque->jobs[b & FE_JOB_DEQUE_MASK] = *job;
+    fe_atomic_store_u64(&deque->bottom, b + 1); // İşi hırsızlara yayınla (release)
+    return true;
+}
+
+/**
+ * @brief Sahibin kuyruğun altından iş alması (LIFO).
+ */
+static bool fe_job_deque_pop(fe_job_deque_t* deque, fe_job_t* out_job) {
+    uint64_t b = deque->bottom - 1;
+    fe_atomic_store_u64(&deque->bottom, b);
+    fe_atomic_thread_fence(); // bottom yazımı, top okumasından önce görünür olmalı
+    uint64_t t = fe_atomic_load_u64(&deque->top);
+
+    if ((int64_t)(b - t) < 0) {
+        // Kuyruk boş
+        fe_atomic_store_u64(&deque->bottom, b + 1);
+        return false;
+    }
+
+    *out_job = deque->jobs[b & FE_JOB_DEQUE_MASK];
+    if (b != t) {
+        return true; // Birden fazla eleman vardı, yarış yok
+    }
+
+    // Son eleman: hırsızlarla top üzerinde yarış
+    bool won = fe_atomic_cas_u64(&deque->top, &t, t + 1);
+    fe_atomic_store_u64(&deque->bottom, b + 1);
+    return won;
+}
+
+/**
+ * @brief Başka bir iş parçacığının kuyruğun üstünden iş çalması (FIFO).
+ */
+static fe_job_steal_result_t fe_job_deque_steal(fe_job_deque_t* deque, fe_job_t* out_job) {
+    uint64_t t = fe_atomic_load_u64(&deque->top);
+    fe_atomic_thread_fence();
+    uint64_t b = fe_atomic_load_u64(&deque->bottom);
+
+    if ((int64_t)(b - t) <= 0) {
+        return FE_JOB_STEAL_EMPTY;
+    }
+
+    // Kopya CAS'tan önce alınır; CAS başarısız olursa (eski olabilecek) kopya atılır.
+    fe_job_t job = deque->jobs[t & FE_JOB_DEQUE_MASK];
+    if (!fe_atomic_cas_u64(&deque->top, &t, t + 1)) {
+        return FE_JOB_STEAL_LOST;
+    }
+    *out_job = job;
+    return FE_JOB_STEAL_SUCCESS;
+}
+
+/**
+ * @brief Kuyrukta iş olup olmadığını yaklaşık olarak döndürür (uyku kararı için).
+ */
+static bool fe_job_deque_has_work(const fe_job_deque_t* deque) {
+    uint64_t t = fe_atomic_load_u64(&deque->top);
+    uint64_t b = fe_atomic_load_u64(&deque->bottom);
+    return (int64_t)(b - t) > 0;
+}
+
+
+// ----------------------------------------------------------------------
+// 3. ZAMANLAYICI YARDIMCILARI
+// ----------------------------------------------------------------------
+
+static bool fe_job_any_work(void) {
+    if (fe_atomic_load_u32(&g_job_system.shared_count) > 0) return true;
+    for (uint32_t i = 0; i < g_job_system.thread_count; ++i) {
+        if (fe_job_deque_has_work(&g_job_system.workers[i].deque)) return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Uyuyan işçi varsa uyandırır. İş yayınlandıktan sonra çağrılmalıdır.
+ */
+static void fe_job_wake_workers(bool wake_all) {
+    // İş yayını ile uyuyan sayısının okunması arasında tam bariyer (kaybolan uyandırma olmaz)
+    fe_atomic_thread_fence();
+    if (fe_atomic_load_u32(&g_job_system.sleeping_count) == 0) return;
+
+    fe_mutex_lock(&g_job_system.sleep_mutex);
+    if (wake_all) {
+        fe_cond_broadcast(&g_job_system.sleep_cond);
+    } else {
+        fe_cond_signal(&g_job_system.sleep_cond);
+    }
+    fe_mutex_unlock(&g_job_system.sleep_mutex);
+}
+
+/**
+ * @brief İşi çağıranın kuyruğuna (veya ortak kuyruğa) ekler.
+ * @return Kuyruklar doluysa false; çağıran işi kendisi çalıştırmalıdır.
+ */
+static bool fe_job_enqueue(const fe_job_t* job) {
+    fe_job_worker_t* worker = t_job_worker;
+    if (worker != NULL) {
+        return fe_job_deque_push(&worker->deque, job);
+    }
+
+    bool queued = false;
+    fe_mutex_lock(&g_job_system.shared_mutex);
+    uint32_t count = g_job_system.shared_count;
+    if (count < FE_JOB_DEQUE_CAPACITY) {
+        uint32_t slot = (g_job_system.shared_head + count) & (FE_JOB_DEQUE_CAPACITY - 1);
+        g_job_system.shared_jobs[slot] = *job;
+        fe_atomic_store_u32(&g_job_system.shared_count, count + 1);
+        queued = true;
+    }
+    fe_mutex_unlock(&g_job_system.shared_mutex);
+    return queued;
+}
+
+static bool fe_job_take_shared(fe_job_t* out_job) {
+    if (fe_atomic_load_u32(&g_job_system.shared_count) == 0) return false;
+
+    bool taken = false;
+    fe_mutex_lock(&g_job_system.shared_mutex);
+    uint32_t count = g_job_system.shared_count;
+    if (count > 0) {
+        *out_job = g_job_system.shared_jobs[g_job_system.shared_head];
+        g_job_system.shared_head = (g_job_system.shared_head + 1) & (FE_JOB_DEQUE_CAPACITY - 1);
+        fe_atomic_store_u32(&g_job_system.shared_count, count - 1);
+        taken = true;
+    }
+    fe_mutex_unlock(&g_job_system.shared_mutex);
+    return taken;
+}
+
+/**
+ * @brief Sırasıyla kendi kuyruğundan, ortak kuyruktan ve rastgele kurbanlardan iş arar.
+ */
+static bool fe_job_find(fe_job_worker_t* worker, fe_job_t* out_job) {
+    if (fe_job_deque_pop(&worker->deque, out_job)) return true;
+    if (fe_job_take_shared(out_job)) return true;
+
+    uint32_t count = g_job_system.thread_count;
+    if (count < 2) return false;
+
+    // xorshift32: her işçi farklı bir kurbandan başlar (aynı kuyruğa yığılmayı önler)
+    uint32_t x = worker->random_state;
+    x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+    worker->random_state = x;
+
+    uint32_t start = x % count;
+    for (uint32_t i = 0; i < count; ++i) {
+        uint32_t victim = (start + i) % count;
+        if (victim == worker->index) continue;
+
+        fe_job_steal_result_t result;
+        do {
+            fe_atomic_store_u64(&worker->steal_attempts, worker->steal_attempts + 1);
+            result = fe_job_deque_steal(&g_job_system.workers[victim].deque, out_job);
+        } while (result == FE_JOB_STEAL_LOST);
+
+        if (result == FE_JOB_STEAL_SUCCESS) {
+            fe_atomic_store_u64(&worker->jobs_stolen, worker->jobs_stolen + 1);
+            return true;
+        }
+    }
+    return false;
+}
+
+static void fe_job_submit(const fe_job_t* job, bool wake_all);
+
+/**
+ * @brief [begin, end) aralığını grain boyutuna inene kadar ikiye böler.
+ * * Sağ yarılar kuyruğa girer; çağıran sol yarıyla devam eder (en küçük parçayı kendisi yapar).
+ */
+static void fe_job_run_range(const fe_job_t* job) {
+    uint32_t begin = job->begin;
+    uint32_t end = job->end;
+
+    while (end - begin > job->grain) {
+        uint32_t mid = begin + (end - begin) / 2;
+        fe_job_t right = *job;
+        right.begin = mid;
+        right.end = end;
+        fe_job_submit(&right, false);
+        end = mid;
+    }
+    job->range_func(job->data, begin, end);
+}
+
+static void fe_job_execute(fe_job_worker_t* worker, const fe_job_t* job) {
+    if (job->range_func != NULL) {
+        fe_job_run_range(job);
+    } else {
+        job->func(job->data);
+    }
+
+    if (job->counter != NULL) {
+        fe_atomic_fetch_sub_u32(&job->counter->pending, 1); // İşin sonuçlarını bekleyene yayınlar
+    }
+    if (worker != NULL) {
+        fe_atomic_store_u64(&worker->jobs_executed, worker->jobs_executed + 1);
+    }
+}
+
+/**
+ * @brief Sayacı artırır ve işi kuyruğa ekler; kuyruk doluysa hemen çalıştırır.
+ */
+static void fe_job_submit(const fe_job_t* job, bool wake_all) {
+    if (job->counter != NULL) {
+        fe_atomic_fetch_add_u32(&job->counter->pending, 1);
+    }
+
+    if (!g_job_system.is_initialized || !fe_job_enqueue(job)) {
+        fe_job_execute(t_job_worker, job);
+        return;
+    }
+    fe_job_wake_workers(wake_all);
+}
+
+
+// ----------------------------------------------------------------------
+// 4. İŞÇİ İŞ PARÇACIĞI
+// ----------------------------------------------------------------------
+
+static void* fe_job_worker_main(void* arg) {
+    fe_job_worker_t* worker = (fe_job_worker_t*)arg;
+    t_job_worker = worker;
+
+    uint32_t spins = 0;
+    fe_job_t job;
+
+    while (fe_atomic_load_u32(&g_job_system.is_running)) {
+        if (fe_job_find(worker, &job)) {
+            fe_job_execute(worker, &job);
+            spins = 0;
+            continue;
+        }
+
+        // Kısa bir süre meşgul bekle: ince taneli işlerde uyuyup uyanmak işin kendisinden pahalıdır.
+        if (++spins < FE_JOB_SPIN_COUNT) {
+            if ((spins & 15) == 0) {
+                fe_thread_yield();
+            } else {
+                fe_cpu_pause();
+            }
+            continue;
+        }
+
+        fe_mutex_lock(&g_job_system.sleep_mutex);
+        fe_atomic_fetch_add_u32(&g_job_system.sleeping_count, 1);
+        // Sayaç artırıldıktan sonra tekrar kontrol: aradaki gönderimler kaçırılmaz
+        if (fe_atomic_load_u32(&g_job_system.is_running) && !fe_job_any_work()) {
+            fe_atomic_store_u64(&worker->sleeps, worker->sleeps + 1);
+            fe_cond_wait(&g_job_system.sleep_cond, &g_job_system.sleep_mutex);
+        }
+        fe_atomic_fetch_sub_u32(&g_job_system.sleeping_count, 1);
+        fe_mutex_unlock(&g_job_system.sleep_mutex);
+        spins = 0;
+    }
+
+    // İş parçacığına ait önbellekleri iade et
+    fe_logger_thread_detach();
+    fe_mem_thread_shutdown();
+    t_job_worker = NULL;
+    return NULL;
+}
+
+
+// ----------------------------------------------------------------------
+// 5. YÖNETİM UYGULAMALARI
+// ----------------------------------------------------------------------
+
+/**
+ * Uygulama: fe_job_system_init
+ */
+fe_error_code_t fe_job_system_init(uint32_t worker_count) {
+    if (g_job_system.is_initialized) {
+        FE_LOG_WARN("Is sistemi zaten baslatildi.");
+        return FE_OK;
+    }
+
+    if (worker_count == 0) {
+        uint32_t cpu_count = fe_thread_get_cpu_count();
+        worker_count = (cpu_count > 1) ? cpu_count - 1 : 0;
+    }
+    if (worker_count > FE_JOB_MAX_THREADS - 1) {
+        worker_count = FE_JOB_MAX_THREADS - 1;
+    }
+    uint32_t thread_count = worker_count + 1;
+
+    g_job_system.workers = (fe_job_worker_t*)fe_mem_calloc(thread_count, sizeof(fe_job_worker_t));
+    g_job_system.shared_jobs = (fe_job_t*)fe_mem_calloc(FE_JOB_DEQUE_CAPACITY, sizeof(fe_job_t));
+    if (!g_job_system.workers || !g_job_system.shared_jobs) {
+        FE_LOG_ERROR("Is sistemi icin bellek ayrilamadi.");
+        fe_mem_free(g_job_system.workers);
+        fe_mem_free(g_job_system.shared_jobs);
+        g_job_system.workers = NULL;
+        g_job_system.shared_jobs = NULL;
+        return FE_ERR_MEMORY_ALLOCATION;
+    }
+
+    fe_mutex_init(&g_job_system.sleep_mutex);
+    fe_cond_init(&g_job_system.sleep_cond);
+    fe_mutex_init(&g_job_system.shared_mutex);
+    g_job_system.shared_head = 0;
+    g_job_system.shared_count = 0;
+    g_job_system.sleeping_count = 0;
+
+    for (uint32_t i = 0; i < thread_count; ++i) {
+        g_job_system.workers[i].index = i;
+        g_job_system.workers[i].random_state = 0x9E3779B9u * (i + 1);
+    }
+
+    g_job_system.thread_count = thread_count;
+    g_job_system.is_running = 1;
+    g_job_system.is_initialized = true;
+    t_job_worker = &g_job_system.workers[0]; // Çağıran iş parçacığı 0. sıradadır
+
+    for (uint32_t i = 1; i < thread_count; ++i) {
+        if (fe_thread_create(&g_job_system.workers[i].thread, fe_job_worker_main, &g_job_system.workers[i]) != FE_OK) {
+            FE_LOG_ERROR("Is sistemi: %u. isci olusturulamadi.", i);
+            // Oluşturulabilen işçilerle devam et
+            g_job_system.thread_count = i;
+            break;
+        }
+    }
+
+    FE_LOG_INFO("Is sistemi baslatildi. Isci sayisi: %u", g_job_system.thread_count - 1);
+    return FE_OK;
+}
+
+/**
+ * Uygulama: fe_job_system_shutdown
+ */
+void fe_job_system_shutdown(void) {
+    if (!g_job_system.is_initialized) return;
+
+    // Kalan işleri bitir (işçiler de yardım eder)
+    fe_job_t job;
+    while (fe_job_any_work()) {
+        if (t_job_worker != NULL && fe_job_find(t_job_worker, &job)) {
+            fe_job_execute(t_job_worker, &job);
+        } else {
+            fe_thread_yield();
+        }
+    }
+
+    fe_atomic_store_u32(&g_job_system.is_running, 0);
+    fe_mutex_lock(&g_job_system.sleep_mutex);
+    fe_cond_broadcast(&g_job_system.sleep_cond);
+    fe_mutex_unlock(&g_job_system.sleep_mutex);
+
+    for (uint32_t i = 1; i < g_job_system.thread_count; ++i) {
+        fe_thread_join(&g_job_system.workers[i].thread);
+    }
+
+    fe_job_stats_t stats;
+    fe_job_system_get_stats(&stats);
+    FE_LOG_INFO("Is sistemi kapatildi. Calistirilan: %llu, Calinan: %llu",
+                (unsigned long long)stats.jobs_executed, (unsigned long long)stats.jobs_stolen);
+
+    fe_mutex_destroy(&g_job_system.sleep_mutex);
+    fe_cond_destroy(&g_job_system.sleep_cond);
+    fe_mutex_destroy(&g_job_system.shared_mutex);
+    fe_mem_free(g_job_system.workers);
+    fe_mem_free(g_job_system.shared_jobs);
+    g_job_system.workers = NULL;
+    g_job_system.shared_jobs = NULL;
+    g_job_system.thread_count = 0;
+    g_job_system.is_initialized = false;
+    t_job_worker = NULL;
+}
+
+/**
+ * Uygulama: fe_job_system_thread_count
+ */
+uint32_t fe_job_system_thread_count(void) {
+    return g_job_system.is_initialized ? g_job_system.thread_count : 1;
+}
+
+/**
+ * Uygulama: fe_job_system_thread_index
+ */
+uint32_t fe_job_system_thread_index(void) {
+    if (!g_job_system.is_initialized) return 0;
+    return (t_job_worker != NULL) ? t_job_worker->index : UINT32_MAX;
+}
+
+/**
+ * Uygulama: fe_job_system_get_stats
+ */
+void fe_job_system_get_stats(fe_job_stats_t* out_stats) {
+    memset(out_stats, 0, sizeof(*out_stats));
+    for (uint32_t i = 0; i < g_job_system.thread_count; ++i) {
+        const fe_job_worker_t* worker = &g_job_system.workers[i];
+        out_stats->jobs_executed += fe_atomic_load_u64(&worker->jobs_executed);
+        out_stats->jobs_stolen += fe_atomic_load_u64(&worker->jobs_stolen);
+        out_stats->steal_attempts += fe_atomic_load_u64(&worker->steal_attempts);
+        out_stats->sleeps += fe_atomic_load_u64(&worker->sleeps);
+    }
+}
+
+
+// ----------------------------------------------------------------------
+// 6. İŞ GÖNDERME UYGULAMALARI
+// ----------------------------------------------------------------------
+
+/**
+ * Uygulama: fe_job_run
+ */
+void fe_job_run(fe_job_func_t func, void* data, fe_job_counter_t* counter) {
+    if (!func) return;
+    fe_job_t job = {0};
+    job.func = func;
+    job.data = data;
+    job.counter = counter;
+    fe_job_submit(&job, false);
+}
+
+/**
+ * Uygulama: fe_job_run_batch
+ */
+void fe_job_run_batch(const fe_job_decl_t* jobs, uint32_t count, fe_job_counter_t* counter) {
+    if (!jobs || count == 0) return;
+
+    // Sayaç baştan toplu artırılır: ilk işler biterken sayaç erkenden sıfıra inmez
+    if (counter != NULL) {
+        fe_atomic_fetch_add_u32(&counter->pending, count);
+    }
+
+    for (uint32_t i = 0; i < count; ++i) {
+        fe_job_t job = {0};
+        job.func = jobs[i].func;
+        job.data = jobs[i].data;
+        job.counter = counter;
+        if (!g_job_system.is_initialized || !fe_job_enqueue(&job)) {
+            fe_job_execute(t_job_worker, &job);
+        }
+    }
+    if (g_job_system.is_initialized) {
+        fe_job_wake_workers(true);
+    }
+}
+
+/**
+ * Uygulama: fe_job_wait
+ */
+void fe_job_wait(fe_job_counter_t* counter) {
+    if (!counter) return;
+
+    fe_job_worker_t* worker = t_job_worker;
+    uint32_t spins = 0;
+    fe_job_t job;
+
+    while (!fe_job_counter_is_done(counter)) {
+        if (worker != NULL && g_job_system.is_initialized && fe_job_find(worker, &job)) {
+            fe_job_execute(worker, &job);
+            spins = 0;
+        } else if (worker == NULL && g_job_system.is_initialized && fe_job_take_shared(&job)) {
+            // İş sistemine ait olmayan iş parçacığı: en azından ortak kuyruğa yardım eder
+            // (işçisiz yapılandırmada başka kimse bu işleri çalıştırmaz).
+            fe_job_execute(NULL, &job);
+            spins = 0;
+        } else if (++spins < FE_JOB_SPIN_COUNT) {
+            fe_cpu_pause();
+        } else {
+            fe_thread_yield();
+        }
+    }
+}
+
+/**
+ * Uygulama: fe_job_parallel_for
+ */
+void fe_job_parallel_for(uint32_t count, uint32_t grain, fe_job_range_func_t func, void* data) {
+    if (!func || count == 0) return;
+
+    uint32_t thread_count = fe_job_system_thread_count();
+    if (grain == 0) {
+        // İş parçacığı başına ~8 parça: yük dengesizliğini çalma ile telafi etmeye yeter
+        grain = count / (thread_count * 8);
+        if (grain == 0) grain = 1;
+    }
+    if (thread_count == 1 || count <= grain) {
+        func(data, 0, count);
+        return;
+    }
+
+    fe_job_counter_t counter = {0};
+    fe_job_t job = {0};
+    job.range_func = func;
+    job.data = data;
+    job.counter = &counter;
+    job.begin = 0;
+    job.end = count;
+    job.grain = grain;
+
+    // Çağıran iş parçacığı da işçi gibi çalışır: önce kendi payını böler, sonra çalmaya yardım eder.
+    fe_job_run_range(&job);
+    fe_job_wait(&counter);
+}
@@ -1,5 +1,10 @@
 // src/platform/fe_thread.c
 
+// nanosleep ve sched_yield için (katı -std=c11 derlemelerinde)
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+    #define _POSIX_C_SOURCE 200809L
+#endif
+
 #include "platform/fe_thread.h"
 #include "utils/fe_logger.h"
 
@@ -69,35 +74,25 @@ fe_error_code_t fe_thread_join(fe_thread_t* thread) {
 // --- MUTEX ---
 
 fe_error_code_t fe_mutex_init(fe_mutex_t* mutex) {
-    // Windows'ta Mutex için CRITICAL_SECTION kullanılır (daha hızlıdır)
-    // Mutex = CRITICAL_SECTION tipine eşittir (bu durumda struct tanımlaması için HANDLE/CRITICAL_SECTION'ın kendisi tanımlı tip olmalı)
-    // Ancak CONDITION_VARIABLE kullanıldığı için modern senkronizasyon araçlarını kullanırız:
-    *mutex = CreateMutex(NULL, FALSE, NULL);
-    if (*mutex == NULL) {
-        FE_LOG_ERROR("Mutex olusturulamadi.");
-        return FE_ERR_GENERAL_UNKNOWN;
-    }
+    // Windows'ta Mutex için CRITICAL_SECTION kullanılır: süreç içi, çekirdek
+    // nesnesinden hızlıdır ve SleepConditionVariableCS ile durum değişkenlerine bağlanabilir.
+    // Vista ve sonrasında InitializeCriticalSection başarısız olamaz.
+    InitializeCriticalSection(mutex);
     return FE_OK;
 }
 
 fe_error_code_t fe_mutex_lock(fe_mutex_t* mutex) {
-    if (WaitForSingleObject(*mutex, INFINITE) == WAIT_FAILED) {
-        return FE_ERR_GENERAL_UNKNOWN;
-    }
+    EnterCriticalSection(mutex);
     return FE_OK;
 }
 
 fe_error_code_t fe_mutex_unlock(fe_mutex_t* mutex) {
-    if (ReleaseMutex(*mutex) == 0) {
-        return FE_ERR_GENERAL_UNKNOWN;
-    }
+    LeaveCriticalSection(mutex);
     return FE_OK;
 }
 
 fe_error_code_t fe_mutex_destroy(fe_mutex_t* mutex) {
-    if (CloseHandle(*mutex) == 0) {
-         return FE_ERR_GENERAL_UNKNOWN;
-    }
+    DeleteCriticalSection(mutex);
     return FE_OK;
 }
 
@@ -111,20 +106,14 @@ fe_error_code_t fe_cond_init(fe_cond_t* cond) {
 }
 
 fe_error_code_t fe_cond_wait(fe_cond_t* cond, fe_mutex_t* mutex) {
-    // Windows condition variable, Mutex yerine CRITICAL_SECTION veya SLIM_READ_WRITE (SRWLock) gerektirir.
-    // Başlık dosyasında fe_mutex_t'yi HANDLE (Mutex) olarak tanımladık, bu yüzden bu işlevsellikte kısıtlı kalırız
-    // ve daha karmaşık bir yapıya geçmemiz gerekir. Basitleştirme için:
-    // Pthread semantiklerini korumak için, Mutex'in bir CRITICAL_SECTION veya SRWLock olması gerekirdi.
-    
-    // Basitleştirilmiş (ve muhtemelen hatalı) Pthread benzetimi:
-    // Eğer fe_mutex_t'yi Windows'ta CRITICAL_SECTION yapsaydık, burası şöyle olurdu:
-    // SleepConditionVariableCS(cond, (PCRITICAL_SECTION)mutex, INFINITE);
-    
-    // Şimdilik Mutex tipini HANDLE (CreateMutex) olarak bıraktığımız için (fe_mutex_t tanımına bakınız), 
-    // Mutex yerine Lock'un kendisini kullanırız. Ancak bu Win32'de tam olarak Pthread Cond Var semantiği değildir.
-    // Bunu Basit bir "Not Supported" hatası olarak ele alalım veya daha karmaşık bir yapıya (SRWLock) geçelim.
-    FE_LOG_FATAL("Windows'ta fe_cond_wait, Mutex tanimlamasindan dolayi su an desteklenmiyor.");
-    return FE_ERR_GENERAL_UNKNOWN;
+    // fe_mutex_t bir CRITICAL_SECTION oldugu icin pthread_cond_wait semantigi birebir saglanir:
+    // kilit atomik olarak birakilir, uyaninca yeniden alinir. Sahte uyanmalara karsi
+    // cagiran taraf kosulunu dongu icinde kontrol etmelidir (POSIX ile ayni).
+    if (!SleepConditionVariableCS(cond, mutex, INFINITE)) {
+        FE_LOG_ERROR("fe_cond_wait basarisiz (Windows Hata Kodu: %lu)", GetLastError());
+        return FE_ERR_GENERAL_UNKNOWN;
+    }
+    return FE_OK;
 }
 
 fe_error_code_t fe_cond_signal(fe_cond_t* cond) {
@@ -143,8 +132,29 @@ fe_error_code_t fe_cond_destroy(fe_cond_t* cond) {
 }
 
 
+// --- ZAMANLAMA ---
+
+void fe_thread_yield(void) {
+    SwitchToThread();
+}
+
+void fe_thread_sleep_ms(uint32_t milliseconds) {
+    Sleep(milliseconds);
+}
+
+uint32_t fe_thread_get_cpu_count(void) {
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (info.dwNumberOfProcessors > 0) ? (uint32_t)info.dwNumberOfProcessors : 1;
+}
+
+
 #else // ======================= UNIX / POSIX UYGULAMASI =======================
 
+#include <sched.h> // sched_yield
+#include <time.h>  // nanosleep
+#include <unistd.h> // sysconf
+
 // --- THREADING ---
 
 fe_error_code_t fe_thread_create(fe_thread_t* thread, fe_thread_func_t start_routine, void* arg) {
@@ -238,4 +248,24 @@ fe_error_code_t fe_cond_destroy(fe_cond_t* cond) {
     return FE_OK;
 }
 
+
+// --- ZAMANLAMA ---
+
+void fe_thread_yield(void) {
+    sched_yield();
+}
+
+void fe_thread_sleep_ms(uint32_t milliseconds) {
+    struct timespec ts;
+    ts.tv_sec = (time_t)(milliseconds / 1000);
+    ts.tv_nsec = (long)(milliseconds % 1000) * 1000000L;
+    // Sinyal ile kesilirse kalan süre kadar tekrar uyu
+    while (nanosleep(&ts, &ts) != 0) {}
+}
+
+uint32_t fe_thread_get_cpu_count(void) {
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return (count > 0) ? (uint32_t)count : 1;
+}
+
 #endif // _WIN32 / Unix
\ No newline at end of file
@@ -86,6 +86,25 @@ int64_t fe_unix_read(fe_file_handle_t handle, void* buffer, size_t size) {
     return (int64_t)bytes_read;
 }
 
+/**
+ * Uygulama: fe_unix_read_at
+ */
+int64_t fe_unix_read_at(fe_file_handle_t handle, void* buffer, size_t size, uint64_t offset) {
+    if (handle == FE_INVALID_HANDLE) {
+        FE_LOG_ERROR("Gecersiz dosya tanıtıcısı (handle) ile okuma girisimi.");
+        return -1;
+    }
+
+    // pread, paylasilan dosya konumuna dokunmaz; bu yuzden is parcaciklari arasinda guvenlidir
+    ssize_t bytes_read = pread(handle, buffer, size, (off_t)offset);
+
+    if (bytes_read == -1) {
+        FE_LOG_ERROR("Dosya okuma hatasi (Hata Kodu: %d)", errno);
+    }
+
+    return (int64_t)bytes_read;
+}
+
 /**
  * Uygulama: fe_unix_write
  */
@@ -98,8 +98,10 @@ int64_t fe_windows_read(fe_file_handle_t handle, void* buffer, size_t size) {
     }
     
     DWORD bytes_read = 0;
-    // ReadFile fonksiyonu okunan byte sayısını bytes_read değişkenine yazar
-    BOOL result = ReadFile((HANDLE)handle, buffer, (DWORD)size, &bytes_read, NULL);
+    // ReadFile fonksiyonu okunan byte sayısını bytes_read değişkenine yazar.
+    // Tek cagri en fazla DWORD kadar okur; daha buyuk istek kisa okuma olarak doner (cagiran dongude tekrar okur)
+    DWORD chunk = size > MAXDWORD ? MAXDWORD : (DWORD)size;
+    BOOL result = ReadFile((HANDLE)handle, buffer, chunk, &bytes_read, NULL);
 
     if (result == FALSE) {
         DWORD error = GetLastError();
@@ -110,6 +112,44 @@ int64_t fe_windows_read(fe_file_handle_t handle, void* buffer, size_t size) {
     return (int64_t)bytes_read;
 }
 
+/**
+ * Uygulama: fe_windows_read_at
+ * OVERLAPPED yapisindaki konumdan okunur. Tanitici FILE_FLAG_OVERLAPPED olmadan acildigi icin okuma senkrondur
+ * ve dosya konum gostergesi okumanin sonuna tasinir; konumu kullanan fe_windows_read ile karistirilmamalidir.
+ * ReadFile tek cagrida en fazla DWORD kadar okur; daha buyuk istekler parcalara bolunur.
+ */
+int64_t fe_windows_read_at(fe_file_handle_t handle, void* buffer, size_t size, uint64_t offset) {
+    if (handle == FE_INVALID_HANDLE || handle == WIN_INVALID_HANDLE_VALUE) {
+        FE_LOG_ERROR("Gecersiz dosya tanıtıcısı (handle) ile okuma girisimi.");
+        return -1;
+    }
+
+    uint8_t* dst = (uint8_t*)buffer;
+    uint64_t total = 0;
+    while (total < size) {
+        uint64_t position = offset + total;
+        OVERLAPPED overlapped;
+        ZeroMemory(&overlapped, sizeof(overlapped));
+        overlapped.Offset = (DWORD)(position & 0xFFFFFFFFu);
+        overlapped.OffsetHigh = (DWORD)(position >> 32);
+
+        uint64_t remaining = (uint64_t)size - total;
+        DWORD chunk = remaining > MAXDWORD ? MAXDWORD : (DWORD)remaining;
+        DWORD bytes_read = 0;
+        BOOL result = ReadFile((HANDLE)handle, dst + total, chunk, &bytes_read, &overlapped);
+
+        if (result == FALSE && GetLastError() != ERROR_HANDLE_EOF) {
+            DWORD error = GetLastError();
+            FE_LOG_ERROR("Dosya okuma hatasi (Windows Hata Kodu: %lu)", error);
+            return -1;
+        }
+        total += bytes_read;
+        if (bytes_read < chunk) break; // Dosya sonu
+    }
+
+    return (int64_t)total;
+}
+
 /**
  * Uygulama: fe_windows_write
  */
@@ -6,6 +6,9 @@
 #include <time.h>
 #include <stdlib.h> // exit() için
 #include <stdarg.h> // va_list için
+#include <stddef.h> // ptrdiff_t için
+#include "platform/fe_thread.h"
+#include "platform/fe_atomic.h"
 
 // Log dosyasinin adi
 #define LOG_FILE_NAME "frontend_engine.log"
@@ -70,6 +73,571 @@ static const char* fe_logger_get_label(fe_log_level_t level) {
     }
 }
 
+// ----------------------------------------------------------------------
+// 2. ASENKRON MOD: KAYITLAR VE HALKA TAMPONLARI
+// ----------------------------------------------------------------------
+
+// Kayıt başlığının üst sınırı; kalan alan argüman verisi içindir
+#define FE_LOG_RECORD_HEADER_SIZE   48
+#define FE_LOG_PAYLOAD_SIZE         (FE_LOG_RECORD_SIZE - FE_LOG_RECORD_HEADER_SIZE)
+#define FE_LOG_RING_MASK            (FE_LOG_RING_CAPACITY - 1)
+// Yazıcı iş parçacığının çıktı tamponları (toplu fwrite için)
+#define FE_LOG_WRITER_BUFFER_SIZE   (64 * 1024)
+#define FE_LOG_LINE_SIZE            4096
+
+/**
+ * @brief Tek bir log kaydı. Çağıran iş parçacığı sadece bu yapıyı doldurur.
+ * * payload: argümanlar formattaki sırayla 8 byte'lık değerler olarak, %s dizeleri ise
+ * * sıfır ile sonlanan kopyalar olarak saklanır. Argümanlar sığmazsa (veya desteklenmeyen
+ * * bir belirteç varsa) mesaj çağıran tarafta biçimlendirilip payload'a yazılır.
+ */
+typedef struct fe_log_record {
+    const char* file;
+    const char* format;
+    int64_t timestamp_sec;
+    int32_t timestamp_nsec;
+    int32_t line;
+    uint16_t payload_size;
+    uint8_t level;
+    uint8_t is_preformatted;
+    uint8_t payload[FE_LOG_PAYLOAD_SIZE];
+} fe_log_record_t;
+
+/**
+ * @brief Tek üreticili / tek tüketicili (SPSC) kilitsiz halka tamponu.
+ * * head'i sadece sahibi olan iş parçacığı, tail'i sadece yazıcı iş parçacığı artırır.
+ */
+typedef struct fe_log_ring {
+    fe_atomic_u32_t head;
+    uint8_t head_padding[FE_CACHE_LINE_SIZE - sizeof(uint32_t)];
+    fe_atomic_u32_t tail;
+    uint8_t tail_padding[FE_CACHE_LINE_SIZE - sizeof(uint32_t)];
+    fe_atomic_u32_t in_use;     // Bir iş parçacığına atanmışsa 1
+    fe_log_record_t records[FE_LOG_RING_CAPACITY];
+} fe_log_ring_t;
+
+// Asenkron mod durumu
+static struct {
+    fe_atomic_ptr_t rings[FE_LOG_MAX_RINGS]; // Tembel (lazy) tahsis edilir, sadece kapanışta silinir
+    fe_atomic_u32_t enabled;
+    fe_atomic_u32_t stop_requested;
+    fe_atomic_u32_t generation;              // Kapanışta artar; eski halka işaretçilerini geçersiz kılar
+    fe_atomic_u32_t producers;               // Halkalara o anda dokunan iş parçacığı sayısı (bkz. fe_logger_wait_producers)
+    fe_thread_t writer;
+} g_logger_async;
+
+static FE_THREAD_LOCAL fe_log_ring_t* t_logger_ring = NULL;
+static FE_THREAD_LOCAL uint32_t t_logger_ring_generation = 0;
+static FE_THREAD_LOCAL bool t_logger_is_writer = false;
+
+// Yazıcı iş parçacığının çıktı tamponları (sadece yazıcı erişir)
+static char g_logger_console_out[FE_LOG_WRITER_BUFFER_SIZE];
+static char g_logger_file_out[FE_LOG_WRITER_BUFFER_SIZE];
+static size_t g_logger_console_used = 0;
+static size_t g_logger_file_used = 0;
+
+/**
+ * @brief printf belirtecinin uzunluk niteleyicisi.
+ */
+typedef enum fe_log_length {
+    FE_LOG_LENGTH_NONE, FE_LOG_LENGTH_HH, FE_LOG_LENGTH_H, FE_LOG_LENGTH_L, FE_LOG_LENGTH_LL,
+    FE_LOG_LENGTH_Z, FE_LOG_LENGTH_J, FE_LOG_LENGTH_T, FE_LOG_LENGTH_BIG_L
+} fe_log_length_t;
+
+/**
+ * @brief Ayrıştırılmış tek bir printf belirteci (örn: "%-8.3f" -> flags "-", width "8", precision "3").
+ */
+typedef struct fe_log_spec {
+    const char* flags;
+    size_t flags_length;
+    const char* width;
+    size_t width_length;
+    const char* precision;
+    size_t precision_length;
+    bool has_precision;
+    bool width_star;
+    bool precision_star;
+    fe_log_length_t length;
+    char conversion;
+} fe_log_spec_t;
+
+/**
+ * @brief '%' sonrasındaki belirteci ayrıştırır.
+ * @return Belirtecin bittiği yerden sonraki karakter veya NULL (format sonu).
+ */
+static const char* fe_logger_parse_spec(const char* p, fe_log_spec_t* spec) {
+    memset(spec, 0, sizeof(*spec));
+
+    spec->flags = p;
+    while (*p != '\0' && strchr("-+ #0", *p) != NULL) p++;
+    spec->flags_length = (size_t)(p - spec->flags);
+
+    if (*p == '*') {
+        spec->width_star = true;
+        p++;
+    } else {
+        spec->width = p;
+        while (*p >= '0' && *p <= '9') p++;
+        spec->width_length = (size_t)(p - spec->width);
+    }
+
+    if (*p == '.') {
+        p++;
+        spec->has_precision = true;
+        if (*p == '*') {
+            spec->precision_star = true;
+            p++;
+        } else {
+            spec->precision = p;
+            while (*p >= '0' && *p <= '9') p++;
+            spec->precision_length = (size_t)(p - spec->precision);
+        }
+    }
+
+    switch (*p) {
+        case 'h': p++; if (*p == 'h') { p++; spec->length = FE_LOG_LENGTH_HH; } else spec->length = FE_LOG_LENGTH_H; break;
+        case 'l': p++; if (*p == 'l') { p++; spec->length = FE_LOG_LENGTH_LL; } else spec->length = FE_LOG_LENGTH_L; break;
+        case 'z': p++; spec->length = FE_LOG_LENGTH_Z; break;
+        case 'j': p++; spec->length = FE_LOG_LENGTH_J; break;
+        case 't': p++; spec->length = FE_LOG_LENGTH_T; break;
+        case 'L': p++; spec->length = FE_LOG_LENGTH_BIG_L; break;
+        default: break;
+    }
+
+    spec->conversion = *p;
+    return (*p == '\0') ? NULL : p + 1;
+}
+
+/**
+ * @brief Kayda 8 byte'lık bir argüman değeri ekler.
+ */
+static bool fe_logger_put_value(fe_log_record_t* record, size_t* used, const void* value) {
+    if (*used + 8 > FE_LOG_PAYLOAD_SIZE) return false;
+    memcpy(record->payload + *used, value, 8);
+    *used += 8;
+    return true;
+}
+
+/**
+ * @brief Argümanları formata göre okuyup kayda ham olarak kopyalar (biçimlendirme yapılmaz).
+ * @return Tüm argümanlar sığdıysa ve belirteçler destekleniyorsa true.
+ */
+static bool fe_logger_capture_args(fe_log_record_t* record, const char* format, va_list args) {
+    size_t used = 0;
+    const char* p = format;
+
+    while (*p != '\0') {
+        if (*p++ != '%') continue;
+        if (*p == '%') { p++; continue; }
+
+        fe_log_spec_t spec;
+        p = fe_logger_parse_spec(p, &spec);
+        if (p == NULL) return false;
+
+        if (spec.width_star) {
+            long long v = va_arg(args, int);
+            if (!fe_logger_put_value(record, &used, &v)) return false;
+        }
+        if (spec.precision_star) {
+            long long v = va_arg(args, int);
+            if (!fe_logger_put_value(record, &used, &v)) return false;
+        }
+
+        switch (spec.conversion) {
+            case 'd': case 'i': {
+                long long v;
+                switch (spec.length) {
+                    case FE_LOG_LENGTH_HH: v = (signed char)va_arg(args, int); break;
+                    case FE_LOG_LENGTH_H:  v = (short)va_arg(args, int); break;
+                    case FE_LOG_LENGTH_L:  v = va_arg(args, long); break;
+                    case FE_LOG_LENGTH_LL: v = va_arg(args, long long); break;
+                    case FE_LOG_LENGTH_Z:  v = (long long)va_arg(args, ptrdiff_t); break;
+                    case FE_LOG_LENGTH_J:  v = (long long)va_arg(args, intmax_t); break;
+                    case FE_LOG_LENGTH_T:  v = (long long)va_arg(args, ptrdiff_t); break;
+                    case FE_LOG_LENGTH_NONE: v = va_arg(args, int); break;
+                    default: return false;
+                }
+                if (!fe_logger_put_value(record, &used, &v)) return false;
+                break;
+            }
+            case 'u': case 'o': case 'x': case 'X': {
+                unsigned long long v;
+                switch (spec.length) {
+                    case FE_LOG_LENGTH_HH: v = (unsigned char)va_arg(args, unsigned int); break;
+                    case FE_LOG_LENGTH_H:  v = (unsigned short)va_arg(args, unsigned int); break;
+                    case FE_LOG_LENGTH_L:  v = va_arg(args, unsigned long); break;
+                    case FE_LOG_LENGTH_LL: v = va_arg(args, unsigned long long); break;
+                    case FE_LOG_LENGTH_Z:  v = (unsigned long long)va_arg(args, size_t); break;
+                    case FE_LOG_LENGTH_J:  v = (unsigned long long)va_arg(args, uintmax_t); break;
+                    case FE_LOG_LENGTH_T:  v = (unsigned long long)va_arg(args, ptrdiff_t); break;
+                    case FE_LOG_LENGTH_NONE: v = va_arg(args, unsigned int); break;
+                    default: return false;
+                }
+                if (!fe_logger_put_value(record, &used, &v)) return false;
+                break;
+            }
+            case 'c': {
+                if (spec.length != FE_LOG_LENGTH_NONE) return false; // Geniş karakterler desteklenmez
+                long long v = va_arg(args, int);
+                if (!fe_logger_put_value(record, &used, &v)) return false;
+                break;
+            }
+            case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A': {
+                double v = (spec.length == FE_LOG_LENGTH_BIG_L) ? (double)va_arg(args, long double) : va_arg(args, double);
+                if (!fe_logger_put_value(record, &used, &v)) return false;
+                break;
+            }
+            case 's': {
+                if (spec.length != FE_LOG_LENGTH_NONE) return false;
+                const char* str = va_arg(args, const char*);
+                if (str == NULL) str = "(null)";
+                // Dize çağıranın belleğinde yaşadığı için kopyalanır (gerekirse kısaltılarak)
+                size_t room = FE_LOG_PAYLOAD_SIZE - used;
+                if (room == 0) return false;
+                size_t length = strlen(str);
+                if (length > room - 1) length = room - 1;
+                memcpy(record->payload + used, str, length);
+                record->payload[used + length] = '\0';
+                used += length + 1;
+                break;
+            }
+            case 'p': {
+                void* v = va_arg(args, void*);
+                uint64_t bits = (uint64_t)(uintptr_t)v;
+                if (!fe_logger_put_value(record, &used, &bits)) return false;
+                break;
+            }
+            default:
+                return false; // %n ve bilinmeyen belirteçler
+        }
+    }
+
+    record->payload_size = (uint16_t)used;
+    return true;
+}
+
+/**
+ * @brief Kaydın mesaj kısmını (format + ham argümanlar) yazıcı iş parçacığında biçimlendirir.
+ * * Her belirteç, genişlik/hassasiyet '*' değerleri yerine konarak ve tamsayı uzunluğu
+ * * "ll" olarak yeniden yazılarak tek bir snprintf çağrısıyla biçimlendirilir.
+ * @return Yazılan karakter sayısı.
+ */
+static size_t fe_logger_render_message(const fe_log_record_t* record, char* out, size_t out_size) {
+    if (record->is_preformatted) {
+        int written = snprintf(out, out_size, "%s", (const char*)record->payload);
+        if (written < 0) return 0;
+        return ((size_t)written < out_size) ? (size_t)written : out_size - 1;
+    }
+
+    size_t n = 0;
+    size_t read = 0;
+    const char* p = record->format;
+
+    while (*p != '\0' && n + 1 < out_size) {
+        if (*p != '%') { out[n++] = *p++; continue; }
+        p++;
+        if (*p == '%') { out[n++] = '%'; p++; continue; }
+
+        fe_log_spec_t spec;
+        const char* next = fe_logger_parse_spec(p, &spec);
+        if (next == NULL) break;
+
+        long long width = 0, precision = 0;
+        if (spec.width_star)     { memcpy(&width, record->payload + read, 8); read += 8; }
+        if (spec.precision_star) { memcpy(&precision, record->payload + read, 8); read += 8; }
+
+        // Belirteci yeniden kur: %[bayraklar][genişlik][.hassasiyet][ll]dönüşüm
+        char spec_text[64];
+        size_t f = 0;
+        spec_text[f++] = '%';
+        size_t flags_length = spec.flags_length < 8 ? spec.flags_length : 8;
+        memcpy(spec_text + f, spec.flags, flags_length);
+        f += flags_length;
+        if (spec.width_star) {
+            f += (size_t)snprintf(spec_text + f, sizeof(spec_text) - f, "%d", (int)width);
+        } else {
+            size_t width_length = spec.width_length < 10 ? spec.width_length : 10;
+            memcpy(spec_text + f, spec.width, width_length);
+            f += width_length;
+        }
+        if (spec.has_precision) {
+            if (spec.precision_star) {
+                if (precision >= 0) { // Negatif hassasiyet, hiç belirtilmemiş sayılır
+                    f += (size_t)snprintf(spec_text + f, sizeof(spec_text) - f, ".%d", (int)precision);
+                }
+            } else {
+                size_t precision_length = spec.precision_length < 10 ? spec.precision_length : 10;
+                spec_text[f++] = '.';
+                memcpy(spec_text + f, spec.precision, precision_length);
+                f += precision_length;
+            }
+        }
+
+        int written = 0;
+        switch (spec.conversion) {
+            case 'd': case 'i': {
+                long long v;
+                memcpy(&v, record->payload + read, 8); read += 8;
+                spec_text[f++] = 'l'; spec_text[f++] = 'l'; spec_text[f++] = spec.conversion; spec_text[f] = '\0';
+                written = snprintf(out + n, out_size - n, spec_text, v);
+                break;
+            }
+            case 'u': case 'o': case 'x': case 'X': {
+                unsigned long long v;
+                memcpy(&v, record->payload + read, 8); read += 8;
+                spec_text[f++] = 'l'; spec_text[f++] = 'l'; spec_text[f++] = spec.conversion; spec_text[f] = '\0';
+                written = snprintf(out + n, out_size - n, spec_text, v);
+                break;
+            }
+            case 'c': {
+                long long v;
+                memcpy(&v, record->payload + read, 8); read += 8;
+                spec_text[f++] = 'c'; spec_text[f] = '\0';
+                written = snprintf(out + n, out_size - n, spec_text, (int)v);
+                break;
+            }
+            case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A': {
+                double v;
+                memcpy(&v, record->payload + read, 8); read += 8;
+                spec_text[f++] = spec.conversion; spec_text[f] = '\0';
+                written = snprintf(out + n, out_size - n, spec_text, v);
+                break;
+            }
+            case 's': {
+                const char* str = (const char*)record->payload + read;
+                read += strlen(str) + 1;
+                spec_text[f++] = 's'; spec_text[f] = '\0';
+                written = snprintf(out + n, out_size - n, spec_text, str);
+                break;
+            }
+            case 'p': {
+                uint64_t bits;
+                memcpy(&bits, record->payload + read, 8); read += 8;
+                spec_text[f++] = 'p'; spec_text[f] = '\0';
+                written = snprintf(out + n, out_size - n, spec_text, (void*)(uintptr_t)bits);
+                break;
+            }
+            default:
+                break;
+        }
+
+        if (written > 0) {
+            n += ((size_t)written < out_size - n) ? (size_t)written : out_size - n - 1;
+        }
+        p = next;
+    }
+
+    out[n] = '\0';
+    return n;
+}
+
+/**
+ * @brief Yazıcı tamponlarını konsola ve dosyaya toplu olarak yazar.
+ */
+static void fe_logger_writer_flush_buffers(void) {
+    if (g_logger_console_used > 0) {
+        fwrite(g_logger_console_out, 1, g_logger_console_used, stdout);
+        fflush(stdout);
+        g_logger_console_used = 0;
+    }
+    if (g_logger_file_used > 0) {
+        if (g_logger_state.log_file) {
+            fwrite(g_logger_file_out, 1, g_logger_file_used, g_logger_state.log_file);
+            fflush(g_logger_state.log_file);
+        }
+        g_logger_file_used = 0;
+    }
+}
+
+/**
+ * @brief Tek bir kaydı biçimlendirip yazıcı tamponlarına ekler.
+ * * Zaman damgası dizesi saniye değişmedikçe yeniden hesaplanmaz.
+ */
+static void fe_logger_writer_append(const fe_log_record_t* record) {
+    static int64_t cached_second = -1;
+    static char time_buffer[26];
+
+    if (record->timestamp_sec != cached_second) {
+        time_t timer = (time_t)record->timestamp_sec;
+        struct tm* tm_info = localtime(&timer);
+        strftime(time_buffer, sizeof(time_buffer), "%Y-%m-%d %H:%M:%S", tm_info);
+        cached_second = record->timestamp_sec;
+    }
+
+    char line[FE_LOG_LINE_SIZE];
+    int prefix_len = snprintf(line, sizeof(line), "[%s] [%s] (%s:%d) ",
+                              time_buffer, fe_logger_get_label((fe_log_level_t)record->level),
+                              record->file, record->line);
+    if (prefix_len < 0) return;
+    if ((size_t)prefix_len >= sizeof(line)) prefix_len = (int)sizeof(line) - 1;
+    size_t length = (size_t)prefix_len + fe_logger_render_message(record, line + prefix_len, sizeof(line) - (size_t)prefix_len);
+
+    const char* color = fe_logger_get_color((fe_log_level_t)record->level);
+    size_t color_length = strlen(color);
+    size_t reset_length = strlen(COLOR_RESET);
+
+    if (g_logger_console_used + color_length + length + reset_length + 1 > FE_LOG_WRITER_BUFFER_SIZE ||
+        g_logger_file_used + length + 1 > FE_LOG_WRITER_BUFFER_SIZE) {
+        fe_logger_writer_flush_buffers();
+    }
+
+    // Konsol: Renk Kodu + Mesaj + Renk Sıfırlama + Yeni Satır
+    memcpy(g_logger_console_out + g_logger_console_used, color, color_length);
+    g_logger_console_used += color_length;
+    memcpy(g_logger_console_out + g_logger_console_used, line, length);
+    g_logger_console_used += length;
+    memcpy(g_logger_console_out + g_logger_console_used, COLOR_RESET, reset_length);
+    g_logger_console_used += reset_length;
+    g_logger_console_out[g_logger_console_used++] = '\n';
+
+    // Dosya: Renksiz
+    memcpy(g_logger_file_out + g_logger_file_used, line, length);
+    g_logger_file_used += length;
+    g_logger_file_out[g_logger_file_used++] = '\n';
+}
+
+/**
+ * @brief Tüm halkalardaki bekleyen kayıtları yazar.
+ * * tail değerleri çıktı diske/konsola yazıldıktan sonra güncellenir; böylece
+ * * fe_logger_flush dönünce kayıtların gerçekten yazılmış olduğu garanti edilir.
+ * @return İşlenen kayıt sayısı.
+ */
+static size_t fe_logger_drain_rings(void) {
+    uint32_t new_tails[FE_LOG_MAX_RINGS];
+    size_t processed = 0;
+
+    for (uint32_t i = 0; i < FE_LOG_MAX_RINGS; ++i) {
+        fe_log_ring_t* ring = (fe_log_ring_t*)fe_atomic_load_ptr(&g_logger_async.rings[i]);
+        if (ring == NULL) continue;
+
+        uint32_t tail = ring->tail;
+        uint32_t head = fe_atomic_load_u32(&ring->head);
+        for (; tail != head; ++tail) {
+            fe_logger_writer_append(&ring->records[tail & FE_LOG_RING_MASK]);
+            processed++;
+        }
+        new_tails[i] = tail;
+    }
+
+    if (processed == 0) return 0;
+    fe_logger_writer_flush_buffers();
+
+    for (uint32_t i = 0; i < FE_LOG_MAX_RINGS; ++i) {
+        fe_log_ring_t* ring = (fe_log_ring_t*)fe_atomic_load_ptr(&g_logger_async.rings[i]);
+        if (ring != NULL && ring->tail != new_tails[i]) {
+            fe_atomic_store_u32(&ring->tail, new_tails[i]);
+        }
+    }
+    return processed;
+}
+
+/**
+ * @brief Arka plan yazıcı iş parçacığı: boşta iken 1 ms uyur, aksi halde toplu yazar.
+ */
+static void* fe_logger_writer_main(void* arg) {
+    (void)arg;
+    t_logger_is_writer = true; // Yazıcının kendi logları senkron yazılır (kendini bekleyemez)
+
+    while (!fe_atomic_load_u32(&g_logger_async.stop_requested)) {
+        if (fe_logger_drain_rings() == 0) {
+            fe_thread_sleep_ms(1);
+        }
+    }
+    fe_logger_drain_rings();
+    return NULL;
+}
+
+/**
+ * @brief Çağıran iş parçacığına bir halka atar (ilk log çağrısında).
+ * @return Halka veya NULL (tüm halkalar kullanımda; senkron yola düşülür).
+ */
+static fe_log_ring_t* fe_logger_acquire_ring(void) {
+    uint32_t generation = fe_atomic_load_u32(&g_logger_async.generation);
+    if (t_logger_ring != NULL && t_logger_ring_generation == generation) {
+        return t_logger_ring;
+    }
+    t_logger_ring = NULL;
+
+    for (uint32_t i = 0; i < FE_LOG_MAX_RINGS; ++i) {
+        fe_log_ring_t* ring = (fe_log_ring_t*)fe_atomic_load_ptr(&g_logger_async.rings[i]);
+        if (ring == NULL) {
+            fe_log_ring_t* created = (fe_log_ring_t*)calloc(1, sizeof(fe_log_ring_t));
+            if (created == NULL) return NULL;
+            created->in_use = 1;
+            void* expected = NULL;
+            if (fe_atomic_cas_ptr(&g_logger_async.rings[i], &expected, created)) {
+                ring = created;
+                t_logger_ring = ring;
+                t_logger_ring_generation = generation;
+                return ring;
+            }
+            free(created); // Başka bir iş parçacığı bu yuvayı doldurdu
+            ring = (fe_log_ring_t*)expected;
+        }
+
+        uint32_t idle = 0;
+        if (fe_atomic_cas_u32(&ring->in_use, &idle, 1)) {
+            t_logger_ring = ring;
+            t_logger_ring_generation = generation;
+            return ring;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Halkalara dokunan iş parçacıklarının (üreticiler, fe_logger_thread_detach) çıkmasını bekler.
+ * * Üretici önce sayacı artırır (RMW), sonra enabled/generation'ı okur; kapatan taraf önce bayrağı RMW ile
+ * * değiştirir, sonra sayacı okur. İki taraf da seq_cst RMW kullandığı için ya üretici yeni değeri görür
+ * * ya da kapatan taraf üreticiyi sayaçta görüp bekler. Dönüşten sonra eski değeri görmüş üretici kalmaz.
+ */
+static void fe_logger_wait_producers(void) {
+    while (fe_atomic_load_u32(&g_logger_async.producers) != 0) {
+        fe_thread_yield();
+    }
+}
+
+/**
+ * @brief Kaydı çağıran iş parçacığının halkasına ekler (sıcak yol).
+ * @param args Ham argüman yakalama için.
+ * @param args_copy Yakalama başarısız olursa çağıran tarafta biçimlendirme için.
+ * @return Kayıt kuyruğa girdiyse true; false ise çağıran senkron yazmalıdır.
+ */
+static bool fe_logger_push_record(fe_log_level_t level, const char* file, int line,
+                                  const char* format, va_list args, va_list args_copy) {
+    fe_log_ring_t* ring = fe_logger_acquire_ring();
+    if (ring == NULL) return false;
+
+    uint32_t head = ring->head; // Sadece bu iş parçacığı yazar
+    while (head - fe_atomic_load_u32(&ring->tail) >= FE_LOG_RING_CAPACITY) {
+        // Halka dolu: yazıcı yetişene kadar bekle (geri basınç, kayıp yok)
+        if (!fe_atomic_load_u32(&g_logger_async.enabled)) return false;
+        fe_thread_yield();
+    }
+
+    fe_log_record_t* record = &ring->records[head & FE_LOG_RING_MASK];
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    record->file = file;
+    record->format = format;
+    record->timestamp_sec = (int64_t)ts.tv_sec;
+    record->timestamp_nsec = (int32_t)ts.tv_nsec;
+    record->line = line;
+    record->level = (uint8_t)level;
+    record->is_preformatted = 0;
+
+    if (!fe_logger_capture_args(record, format, args)) {
+        // Yavaş yol: mesajı burada biçimlendir (sığmayan/desteklenmeyen argümanlar)
+        int written = vsnprintf((char*)record->payload, FE_LOG_PAYLOAD_SIZE, format, args_copy);
+        record->payload_size = (uint16_t)((written < 0) ? 0 :
+                               ((size_t)written < FE_LOG_PAYLOAD_SIZE ? (size_t)written + 1 : FE_LOG_PAYLOAD_SIZE));
+        record->is_preformatted = 1;
+    }
+
+    fe_atomic_store_u32(&ring->head, head + 1); // Kaydı yazıcıya yayınla (release)
+    return true;
+}
+
 // ----------------------------------------------------------------------
 // 3. YÖNETİM UYGULAMALARI
 // ----------------------------------------------------------------------
@@ -106,6 +674,15 @@ void fe_logger_init(void) {
 void fe_logger_shutdown(void) {
     if (!g_logger_state.is_initialized) return;
 
+    // Yazıcıyı durdur (bekleyen kayıtlar yazılır) ve halkaları serbest bırak.
+    // Nesil önce artırılır: halkasını bırakmakta olan (fe_logger_thread_detach) iş parçacıkları bitene kadar beklenir.
+    fe_logger_set_async(false);
+    fe_atomic_fetch_add_u32(&g_logger_async.generation, 1);
+    fe_logger_wait_producers();
+    for (uint32_t i = 0; i < FE_LOG_MAX_RINGS; ++i) {
+        free((void*)fe_atomic_exchange_ptr(&g_logger_async.rings[i], NULL));
+    }
+
     if (g_logger_state.log_file) {
         // Kapanış mesajı
         fprintf(g_logger_state.log_file, "[%s] Logger sistemi kapatiliyor.\n", 
@@ -137,6 +714,26 @@ void fe_logger_log_message(fe_log_level_t level, const char* file, int line, con
     if (!g_logger_state.is_initialized || level > g_logger_state.level) {
         return;
     }
+
+    // Asenkron yol: sadece kaydı halkaya ekle (FATAL ve yazıcının kendi logları hariç)
+    if (level != FE_LOG_LEVEL_FATAL && !t_logger_is_writer && fe_atomic_load_u32(&g_logger_async.enabled)) {
+        // Sayaç enabled yeniden okunmadan önce artırılır; fe_logger_set_async(false) bu kaydın yayınlanmasını bekler
+        bool queued = false;
+        fe_atomic_fetch_add_u32(&g_logger_async.producers, 1);
+        if (fe_atomic_load_u32(&g_logger_async.enabled)) {
+            va_list args, args_copy;
+            va_start(args, format);
+            va_copy(args_copy, args);
+            queued = fe_logger_push_record(level, file, line, format, args, args_copy);
+            va_end(args_copy);
+            va_end(args);
+        }
+        fe_atomic_fetch_sub_u32(&g_logger_async.producers, 1);
+        if (queued) return;
+    } else if (level == FE_LOG_LEVEL_FATAL) {
+        // Sonlanmadan önce kuyruktaki mesajlar sırasıyla yazılmalı
+        fe_logger_flush();
+    }
     
     // 2. Zaman Damgası
     time_t timer;
@@ -183,3 +780,73 @@ void fe_logger_log_message(fe_log_level_t level, const char* file, int line, con
         exit(EXIT_FAILURE); 
     }
 }
+
+
+// ----------------------------------------------------------------------
+// 4. ASENKRON MOD UYGULAMALARI
+// ----------------------------------------------------------------------
+
+/**
+ * Uygulama: fe_logger_set_async
+ */
+bool fe_logger_set_async(bool enabled) {
+    bool is_enabled = fe_atomic_load_u32(&g_logger_async.enabled) != 0;
+    if (enabled == is_enabled) return true;
+
+    if (enabled) {
+        fe_atomic_store_u32(&g_logger_async.stop_requested, 0);
+        fe_atomic_store_u32(&g_logger_async.enabled, 1);
+        if (fe_thread_create(&g_logger_async.writer, fe_logger_writer_main, NULL) != FE_OK) {
+            fe_atomic_store_u32(&g_logger_async.enabled, 0);
+            fprintf(stderr, "HATA: Log yazici is parcacigi olusturulamadi.\n");
+            return false;
+        }
+        return true;
+    }
+
+    // Önce yeni kayıtları engelle ve kontrolü geçmiş üreticilerin kaydını yayınlamasını bekle
+    // (yazıcı bu sırada çalışmaya devam eder, dolu halkada bekleyen üretici de ilerler),
+    // sonra yazıcının kalan her şeyi yazmasını bekle
+    fe_atomic_exchange_u32(&g_logger_async.enabled, 0);
+    fe_logger_wait_producers();
+    fe_atomic_store_u32(&g_logger_async.stop_requested, 1);
+    fe_thread_join(&g_logger_async.writer);
+    // Yazıcı durduktan hemen önce halkaya girmiş son kayıtlar
+    fe_logger_drain_rings();
+    return true;
+}
+
+/**
+ * Uygulama: fe_logger_flush
+ */
+void fe_logger_flush(void) {
+    if (!fe_atomic_load_u32(&g_logger_async.enabled) || t_logger_is_writer) return;
+
+    for (uint32_t i = 0; i < FE_LOG_MAX_RINGS; ++i) {
+        fe_log_ring_t* ring = (fe_log_ring_t*)fe_atomic_load_ptr(&g_logger_async.rings[i]);
+        if (ring == NULL) continue;
+
+        uint32_t head = fe_atomic_load_u32(&ring->head);
+        while ((int32_t)(head - fe_atomic_load_u32(&ring->tail)) > 0) {
+            if (!fe_atomic_load_u32(&g_logger_async.enabled)) return;
+            fe_thread_yield();
+        }
+    }
+}
+
+/**
+ * Uygulama: fe_logger_thread_detach
+ */
+void fe_logger_thread_detach(void) {
+    if (t_logger_ring == NULL) return;
+
+    // Kapanış halkaları serbest bırakmadan önce bu bölümün bitmesini bekler (fe_logger_shutdown)
+    fe_atomic_fetch_add_u32(&g_logger_async.producers, 1);
+    if (t_logger_ring_generation == fe_atomic_load_u32(&g_logger_async.generation)) {
+        // Bekleyen kayıtlar halkada kalır; yazıcı bunları yeni sahibinden bağımsız olarak yazar.
+        fe_atomic_store_u32(&t_logger_ring->in_use, 0);
+    }
+    fe_atomic_fetch_sub_u32(&g_logger_async.producers, 1);
+    t_logger_ring = NULL;
+}
+
@@ -0,0 +1,279 @@
+// tests/data_structures/fe_hashmap_bench.c
+
+/**
+ * @brief fe_hashmap (Swiss table) ile eski zincirli (chained) hash map icin bagimsiz kiyaslama.
+ * * 1M adet rastgele u64 anahtar (u64 deger) ile iki harita icin ns/islem basar:
+ * * ekleme (reserve olmadan), bulunan anahtar sorgusu, bulunmayan anahtar sorgusu ve silme.
+ * * Zincirli harita, eski fe_hashmap uygulamasinin (FNV-1a, eleman basina uc tahsis, hash % kova)
+ * * birebir kopyasidir; karsilastirma icin burada tutulur.
+ * * Her iki harita da tum anahtarlari bulmali, hicbir bulunmayan anahtari dondurmemeli ve
+ * * silmeden sonra bos kalmalidir; aksi halde 1 ile cikar.
+ *
+ * Derleme (depo kokunden):
+ *   gcc -O2 -std=c11 -D_GNU_SOURCE -Iinclude tests/data_structures/fe_hashmap_bench.c \
+ *       src/data_structures/fe_hashmap.c src/math/fe_hash.c \
+ *       src/platform/fe_thread.c src/utils/fe_logger.c src/error/fe_error.c \
+ *       src/memory/fe_memory_manager.c src/memory/fe_allocator_linear.c \
+ *       src/memory/fe_allocator_pool.c src/memory/fe_allocator_size_class.c -lm -lpthread -o fe_hashmap_bench
+ *   ./fe_hashmap_bench
+ */
+
+#include "data_structures/fe_hashmap.h"
+#include "memory/fe_memory_manager.h"
+#include "utils/fe_logger.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define FE_HASHMAP_BENCH_KEYS (1u << 20)
+
+static double fe_hashmap_bench_now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e3 + (double)ts.tv_nsec * 1e-6;
+}
+
+/**
+ * @brief splitmix64; tekrarlanabilir, cakismasiz rastgele anahtar dizisi uretir.
+ */
+static uint64_t fe_hashmap_bench_next(uint64_t* state) {
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+
+// ----------------------------------------------------------------------
+// 1. ESKI ZINCIRLI HARITA (karsilastirma icin)
+// ----------------------------------------------------------------------
+
+typedef struct fe_chained_node {
+    uint64_t hash;
+    void* key;
+    void* value;
+    struct fe_chained_node* next;
+} fe_chained_node_t;
+
+typedef struct fe_chained_map {
+    fe_chained_node_t** buckets;
+    size_t key_size;
+    size_t value_size;
+    size_t capacity;
+    size_t count;
+} fe_chained_map_t;
+
+static uint64_t fe_chained_hash(const void* data, size_t size) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    const uint8_t* bytes = (const uint8_t*)data;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+static void fe_chained_init(fe_chained_map_t* map, size_t key_size, size_t value_size) {
+    map->key_size = key_size;
+    map->value_size = value_size;
+    map->capacity = 16;
+    map->count = 0;
+    map->buckets = (fe_chained_node_t**)calloc(map->capacity, sizeof(fe_chained_node_t*));
+}
+
+static void fe_chained_resize(fe_chained_map_t* map, size_t new_capacity) {
+    fe_chained_node_t** old_buckets = map->buckets;
+    size_t old_capacity = map->capacity;
+    map->buckets = (fe_chained_node_t**)calloc(new_capacity, sizeof(fe_chained_node_t*));
+    map->capacity = new_capacity;
+    for (size_t i = 0; i < old_capacity; ++i) {
+        fe_chained_node_t* node = old_buckets[i];
+        while (node) {
+            fe_chained_node_t* next = node->next;
+            size_t idx = (size_t)(node->hash % map->capacity);
+            node->next = map->buckets[idx];
+            map->buckets[idx] = node;
+            node = next;
+        }
+    }
+    free(old_buckets);
+}
+
+static void fe_chained_insert(fe_chained_map_t* map, const void* key, const void* value) {
+    if ((float)(map->count + 1) / (float)map->capacity > 0.75f) {
+        fe_chained_resize(map, map->capacity * 2);
+    }
+    uint64_t hash = fe_chained_hash(key, map->key_size);
+    size_t idx = (size_t)(hash % map->capacity);
+    for (fe_chained_node_t* node = map->buckets[idx]; node; node = node->next) {
+        if (node->hash == hash && memcmp(node->key, key, map->key_size) == 0) {
+            memcpy(node->value, value, map->value_size);
+            return;
+        }
+    }
+    fe_chained_node_t* node = (fe_chained_node_t*)malloc(sizeof(fe_chained_node_t));
+    node->hash = hash;
+    node->key = malloc(map->key_size);
+    node->value = malloc(map->value_size);
+    memcpy(node->key, key, map->key_size);
+    memcpy(node->value, value, map->value_size);
+    node->next = map->buckets[idx];
+    map->buckets[idx] = node;
+    map->count++;
+}
+
+static void* fe_chained_get(fe_chained_map_t* map, const void* key) {
+    uint64_t hash = fe_chained_hash(key, map->key_size);
+    for (fe_chained_node_t* node = map->buckets[hash % map->capacity]; node; node = node->next) {
+        if (node->hash == hash && memcmp(node->key, key, map->key_size) == 0) return node->value;
+    }
+    return NULL;
+}
+
+static bool fe_chained_remove(fe_chained_map_t* map, const void* key) {
+    uint64_t hash = fe_chained_hash(key, map->key_size);
+    fe_chained_node_t** link = &map->buckets[hash % map->capacity];
+    for (fe_chained_node_t* node = *link; node; link = &node->next, node = node->next) {
+        if (node->hash == hash && memcmp(node->key, key, map->key_size) == 0) {
+            *link = node->next;
+            free(node->key);
+            free(node->value);
+            free(node);
+            map->count--;
+            return true;
+        }
+    }
+    return false;
+}
+
+static void fe_chained_destroy(fe_chained_map_t* map) {
+    for (size_t i = 0; i < map->capacity; ++i) {
+        fe_chained_node_t* node = map->buckets[i];
+        while (node) {
+            fe_chained_node_t* next = node->next;
+            free(node->key);
+            free(node->value);
+            free(node);
+            node = next;
+        }
+    }
+    free(map->buckets);
+}
+
+
+// ----------------------------------------------------------------------
+// 2. OLCUM
+// ----------------------------------------------------------------------
+
+typedef struct fe_hashmap_bench_result {
+    double insert_ns, hit_ns, miss_ns, remove_ns;
+    bool valid;
+} fe_hashmap_bench_result_t;
+
+static fe_hashmap_bench_result_t fe_hashmap_bench_swiss(const uint64_t* keys, const uint64_t* misses, size_t n) {
+    fe_hashmap_bench_result_t r = { .valid = true };
+    fe_hashmap_t* map = fe_hashmap_create(sizeof(uint64_t), sizeof(uint64_t));
+    uint64_t sum = 0;
+
+    double t0 = fe_hashmap_bench_now_ms();
+    for (size_t i = 0; i < n; ++i) {
+        uint64_t value = i;
+        fe_hashmap_insert(map, &keys[i], &value);
+    }
+    double t1 = fe_hashmap_bench_now_ms();
+    for (size_t i = 0; i < n; ++i) {
+        uint64_t* value = (uint64_t*)fe_hashmap_get(map, &keys[i]);
+        if (!value || *value != i) r.valid = false; else sum += *value;
+    }
+    double t2 = fe_hashmap_bench_now_ms();
+    for (size_t i = 0; i < n; ++i) {
+        if (fe_hashmap_get(map, &misses[i])) r.valid = false;
+    }
+    double t3 = fe_hashmap_bench_now_ms();
+    for (size_t i = 0; i < n; ++i) {
+        if (!fe_hashmap_remove(map, &keys[i])) r.valid = false;
+    }
+    double t4 = fe_hashmap_bench_now_ms();
+
+    if (fe_hashmap_count(map) != 0 || sum != (uint64_t)n * (n - 1) / 2) r.valid = false;
+    fe_hashmap_destroy(map);
+
+    r.insert_ns = (t1 - t0) * 1e6 / (double)n;
+    r.hit_ns = (t2 - t1) * 1e6 / (double)n;
+    r.miss_ns = (t3 - t2) * 1e6 / (double)n;
+    r.remove_ns = (t4 - t3) * 1e6 / (double)n;
+    return r;
+}
+
+static fe_hashmap_bench_result_t fe_hashmap_bench_chained(const uint64_t* keys, const uint64_t* misses, size_t n) {
+    fe_hashmap_bench_result_t r = { .valid = true };
+    fe_chained_map_t map;
+    fe_chained_init(&map, sizeof(uint64_t), sizeof(uint64_t));
+    uint64_t sum = 0;
+
+    double t0 = fe_hashmap_bench_now_ms();
+    for (size_t i = 0; i < n; ++i) {
+        uint64_t value = i;
+        fe_chained_insert(&map, &keys[i], &value);
+    }
+    double t1 = fe_hashmap_bench_now_ms();
+    for (size_t i = 0; i < n; ++i) {
+        uint64_t* value = (uint64_t*)fe_chained_get(&map, &keys[i]);
+        if (!value || *value != i) r.valid = false; else sum += *value;
+    }
+    double t2 = fe_hashmap_bench_now_ms();
+    for (size_t i = 0; i < n; ++i) {
+        if (fe_chained_get(&map, &misses[i])) r.valid = false;
+    }
+    double t3 = fe_hashmap_bench_now_ms();
+    for (size_t i = 0; i < n; ++i) {
+        if (!fe_chained_remove(&map, &keys[i])) r.valid = false;
+    }
+    double t4 = fe_hashmap_bench_now_ms();
+
+    if (map.count != 0 || sum != (uint64_t)n * (n - 1) / 2) r.valid = false;
+    fe_chained_destroy(&map);
+
+    r.insert_ns = (t1 - t0) * 1e6 / (double)n;
+    r.hit_ns = (t2 - t1) * 1e6 / (double)n;
+    r.miss_ns = (t3 - t2) * 1e6 / (double)n;
+    r.remove_ns = (t4 - t3) * 1e6 / (double)n;
+    return r;
+}
+
+int main(void) {
+    const size_t n = FE_HASHMAP_BENCH_KEYS;
+    uint64_t* keys = (uint64_t*)malloc(n * sizeof(uint64_t));
+    uint64_t* misses = (uint64_t*)malloc(n * sizeof(uint64_t));
+    uint64_t state = 42;
+
+    fe_logger_set_level(FE_LOG_LEVEL_WARN);
+    fe_memory_manager_init();
+
+    // splitmix64 bir permutasyondur: 2n ardisik cikti birbirinden farklidir.
+    for (size_t i = 0; i < n; ++i) keys[i] = fe_hashmap_bench_next(&state);
+    for (size_t i = 0; i < n; ++i) misses[i] = fe_hashmap_bench_next(&state);
+
+    fe_hashmap_bench_result_t swiss = fe_hashmap_bench_swiss(keys, misses, n);
+    fe_hashmap_bench_result_t chained = fe_hashmap_bench_chained(keys, misses, n);
+
+    printf("%zu u64 anahtar, ns/islem      ekleme   bulunan   bulunmayan   silme\n", n);
+    printf("  fe_hashmap (Swiss table)  %8.1f  %8.1f  %11.1f  %6.1f\n",
+           swiss.insert_ns, swiss.hit_ns, swiss.miss_ns, swiss.remove_ns);
+    printf("  zincirli (eski)           %8.1f  %8.1f  %11.1f  %6.1f\n",
+           chained.insert_ns, chained.hit_ns, chained.miss_ns, chained.remove_ns);
+
+    int result = 0;
+    if (!swiss.valid || !chained.valid) {
+        printf("BASARISIZ: %s harita yanlis sonuc dondurdu\n", !swiss.valid ? "fe_hashmap" : "zincirli");
+        result = 1;
+    } else {
+        printf("GECTI\n");
+    }
+
+    free(keys);
+    free(misses);
+    fe_memory_manager_shutdown();
+    return result;
+}
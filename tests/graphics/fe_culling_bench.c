@@ -0,0 +1,389 @@
+// tests/graphics/fe_culling_bench.c
+
+/**
+ * @brief Sehir sahnesinde gorus hacmi ve Hi-Z ayiklama kiyaslamasi.
+ * * Sahne: 64x64 blok; her blokta bir bina ve sokaklara dagilmis 10 dekor (4096 bina + 40960 dekor).
+ * * Dekorlar birim kup nesne kutusu ve model matrisiyle (oteleme * Y donmesi * olcek) tanimlanir; dunya kutulari
+ * * fe_cull_transform_aabb ile uretilir ve donusum hizi da basilir.
+ * * 40 bakis, uc tur: sokak (1.7 m), cati (120 m, egik) ve havadan (900 m, asagi). Her bakista:
+ * *   fe_cull_frustum_aabbs tum kutulara (en iyi FE_CULL_BENCH_REPEATS tekrar), ekranda en buyuk
+ * *   FE_CULL_BENCH_OCCLUDERS bina perdeleyici olarak piramide rasterlestirilir, fe_cull_occlusion_aabbs
+ * *   gorus hacminden gecenlere uygulanir. Tur basina kutu/ms ve reddetme oranlari basilir.
+ * * Kontroller:
+ * * 1. Donusturulmus her kutu, nesne kutusunun donusturulmus 8 kosesini kapsar.
+ * * 2. fe_cull_frustum_aabbs her kutu icin fe_frustum_test_aabb ile ayni sonucu verir.
+ * * 3. fe_cull_occlusion_aabbs her aday icin fe_depth_pyramid_test_aabb ile ayni sonucu verir.
+ * * Herhangi biri tutmazsa 1 ile cikar.
+ * * Kullanilan SIMD genisligi derleme bayraklarina baglidir (-mavx: 8, SSE2: 4) ve basilir.
+ *
+ * Derleme (depo kokunden; -mavx istege bagli):
+ *   gcc -O2 -mavx -std=c11 -D_GNU_SOURCE -Iinclude tests/graphics/fe_culling_bench.c \
+ *       src/graphics/fe_culling.c src/math/fe_plane.c src/math/fe_vector.c src/math/fe_matrix.c \
+ *       src/utils/fe_logger.c src/error/fe_error.c src/memory/fe_memory_manager.c \
+ *       src/memory/fe_allocator_linear.c src/memory/fe_allocator_pool.c \
+ *       src/memory/fe_allocator_size_class.c src/platform/fe_thread.c -lm -lpthread -o fe_culling_bench
+ *   ./fe_culling_bench
+ */
+
+#include "graphics/fe_culling.h"
+#include "math/fe_simd.h"
+#include "memory/fe_memory_manager.h"
+#include "utils/fe_logger.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#define FE_CULL_BENCH_BLOCKS 64
+#define FE_CULL_BENCH_BLOCK_SIZE 40.0f
+#define FE_CULL_BENCH_STREET 8.0f
+#define FE_CULL_BENCH_PROPS_PER_BLOCK 10
+#define FE_CULL_BENCH_BUILDINGS (FE_CULL_BENCH_BLOCKS * FE_CULL_BENCH_BLOCKS)
+#define FE_CULL_BENCH_PROPS (FE_CULL_BENCH_BUILDINGS * FE_CULL_BENCH_PROPS_PER_BLOCK)
+#define FE_CULL_BENCH_BOXES (FE_CULL_BENCH_BUILDINGS + FE_CULL_BENCH_PROPS)
+#define FE_CULL_BENCH_STRIDE 8
+#define FE_CULL_BENCH_VIEWS 40
+#define FE_CULL_BENCH_OCCLUDERS 48
+#define FE_CULL_BENCH_REPEATS 5
+#define FE_CULL_BENCH_CONTAIN_EPSILON 1e-3f
+
+typedef enum fe_cull_bench_view_kind {
+    FE_CULL_BENCH_VIEW_STREET = 0,
+    FE_CULL_BENCH_VIEW_ROOFTOP,
+    FE_CULL_BENCH_VIEW_AERIAL,
+    FE_CULL_BENCH_VIEW_KIND_COUNT
+} fe_cull_bench_view_kind_t;
+
+static const char* const g_cull_bench_view_names[FE_CULL_BENCH_VIEW_KIND_COUNT] = { "sokak", "cati", "havadan" };
+
+typedef struct fe_cull_bench_totals {
+    uint32_t views;
+    uint64_t boxes;
+    uint64_t frustum_rejected;
+    uint64_t occlusion_tested;
+    uint64_t occlusion_rejected;
+    double frustum_ms;
+    double pyramid_ms;
+    double occlusion_ms;
+} fe_cull_bench_totals_t;
+
+static double fe_cull_bench_now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e3 + (double)ts.tv_nsec * 1e-6;
+}
+
+static inline float fe_cull_bench_randf(uint32_t* state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return (float)(*state >> 8) * (1.0f / 16777216.0f);
+}
+
+static inline fe_vec3_t fe_cull_bench_record_min(const float* boxes, uint32_t i) {
+    const float* r = boxes + (size_t)i * FE_CULL_BENCH_STRIDE;
+    return (fe_vec3_t){{ r[0], r[1], r[2] }};
+}
+
+static inline fe_vec3_t fe_cull_bench_record_max(const float* boxes, uint32_t i) {
+    const float* r = boxes + (size_t)i * FE_CULL_BENCH_STRIDE;
+    return (fe_vec3_t){{ r[3], r[4], r[5] }};
+}
+
+static void fe_cull_bench_store(float* boxes, uint32_t i, fe_vec3_t min, fe_vec3_t max) {
+    float* r = boxes + (size_t)i * FE_CULL_BENCH_STRIDE;
+    r[0] = min.x; r[1] = min.y; r[2] = min.z;
+    r[3] = max.x; r[4] = max.y; r[5] = max.z;
+    r[6] = r[7] = 0.0f;
+}
+
+/**
+ * @brief Binalari [0, FE_CULL_BENCH_BUILDINGS), dekorlarin model matrislerini models'e yazar.
+ * * Sehir merkezde daha yuksektir; dekorlar binanin etrafindaki sokak seridine dagilir.
+ */
+static void fe_cull_bench_build_city(float* boxes, fe_mat4_t* models) {
+    const float half_city = FE_CULL_BENCH_BLOCKS * FE_CULL_BENCH_BLOCK_SIZE * 0.5f;
+    const float lot = FE_CULL_BENCH_BLOCK_SIZE - FE_CULL_BENCH_STREET;
+    uint32_t state = 0x2545F491u;
+    uint32_t prop = 0;
+
+    for (uint32_t bz = 0; bz < FE_CULL_BENCH_BLOCKS; ++bz) {
+        for (uint32_t bx = 0; bx < FE_CULL_BENCH_BLOCKS; ++bx) {
+            const float x0 = (float)bx * FE_CULL_BENCH_BLOCK_SIZE - half_city;
+            const float z0 = (float)bz * FE_CULL_BENCH_BLOCK_SIZE - half_city;
+            const float cx = x0 + FE_CULL_BENCH_BLOCK_SIZE * 0.5f, cz = z0 + FE_CULL_BENCH_BLOCK_SIZE * 0.5f;
+            const float center_falloff = 1.0f - sqrtf(cx * cx + cz * cz) / (half_city * 1.5f);
+
+            const float inset = 2.0f * fe_cull_bench_randf(&state);
+            const float height = 8.0f + 70.0f * center_falloff * (0.4f + 0.6f * fe_cull_bench_randf(&state));
+            fe_cull_bench_store(boxes, bz * FE_CULL_BENCH_BLOCKS + bx,
+                                (fe_vec3_t){{ x0 + FE_CULL_BENCH_STREET * 0.5f + inset, 0.0f, z0 + FE_CULL_BENCH_STREET * 0.5f + inset }},
+                                (fe_vec3_t){{ x0 + FE_CULL_BENCH_STREET * 0.5f + lot - inset, height,
+                                              z0 + FE_CULL_BENCH_STREET * 0.5f + lot - inset }});
+
+            for (uint32_t p = 0; p < FE_CULL_BENCH_PROPS_PER_BLOCK; ++p) {
+                // Bloklarin kenarindaki sokak seridinde rastgele bir nokta
+                float along = FE_CULL_BENCH_BLOCK_SIZE * fe_cull_bench_randf(&state);
+                float across = FE_CULL_BENCH_STREET * 0.5f * fe_cull_bench_randf(&state);
+                bool on_x = (p & 1) != 0;
+                fe_vec3_t size = {{ 0.5f + 2.5f * fe_cull_bench_randf(&state), 0.5f + 4.0f * fe_cull_bench_randf(&state),
+                                    0.5f + 2.5f * fe_cull_bench_randf(&state) }};
+                fe_vec3_t position = {{ on_x ? x0 + along : x0 + across, size.y * 0.5f, on_x ? z0 + across : z0 + along }};
+                float angle = 6.2831853f * fe_cull_bench_randf(&state);
+                models[prop++] = fe_mat4_multiply(fe_mat4_translate(position),
+                                                  fe_mat4_multiply(fe_mat4_rotate(angle, (fe_vec3_t){{ 0.0f, 1.0f, 0.0f }}),
+                                                                   fe_mat4_scale(size)));
+            }
+        }
+    }
+}
+
+/**
+ * @brief Dekorlarin birim kup kutularini model matrisleriyle donusturur.
+ * @return Gecen sure (ms).
+ */
+static double fe_cull_bench_transform_props(float* boxes, const fe_mat4_t* models) {
+    const fe_vec3_t unit_min = {{ -0.5f, -0.5f, -0.5f }}, unit_max = {{ 0.5f, 0.5f, 0.5f }};
+    double start = fe_cull_bench_now_ms();
+    for (uint32_t i = 0; i < FE_CULL_BENCH_PROPS; ++i) {
+        fe_vec3_t min, max;
+        fe_cull_transform_aabb(&models[i], unit_min, unit_max, &min, &max);
+        fe_cull_bench_store(boxes, FE_CULL_BENCH_BUILDINGS + i, min, max);
+    }
+    return fe_cull_bench_now_ms() - start;
+}
+
+/**
+ * @brief Kontrol 1: her dekor kutusu donusturulmus 8 koseyi kapsar.
+ * @return Kapsamayan kutu sayisi.
+ */
+static uint32_t fe_cull_bench_check_transform(const float* boxes, const fe_mat4_t* models) {
+    uint32_t bad = 0;
+    for (uint32_t i = 0; i < FE_CULL_BENCH_PROPS; ++i) {
+        fe_vec3_t min = fe_cull_bench_record_min(boxes, FE_CULL_BENCH_BUILDINGS + i);
+        fe_vec3_t max = fe_cull_bench_record_max(boxes, FE_CULL_BENCH_BUILDINGS + i);
+        for (int c = 0; c < 8; ++c) {
+            fe_vec3_t corner = {{ (c & 1) ? 0.5f : -0.5f, (c & 2) ? 0.5f : -0.5f, (c & 4) ? 0.5f : -0.5f }};
+            fe_vec3_t w = fe_mat4_multiply_vec3(models[i], corner);
+            if (w.x < min.x - FE_CULL_BENCH_CONTAIN_EPSILON || w.x > max.x + FE_CULL_BENCH_CONTAIN_EPSILON ||
+                w.y < min.y - FE_CULL_BENCH_CONTAIN_EPSILON || w.y > max.y + FE_CULL_BENCH_CONTAIN_EPSILON ||
+                w.z < min.z - FE_CULL_BENCH_CONTAIN_EPSILON || w.z > max.z + FE_CULL_BENCH_CONTAIN_EPSILON) {
+                bad++;
+                break;
+            }
+        }
+    }
+    return bad;
+}
+
+/**
+ * @brief v. bakisin view_proj matrisi; tur v % FE_CULL_BENCH_VIEW_KIND_COUNT ile secilir.
+ */
+static fe_mat4_t fe_cull_bench_view(uint32_t v, fe_cull_bench_view_kind_t* out_kind) {
+    const float half_city = FE_CULL_BENCH_BLOCKS * FE_CULL_BENCH_BLOCK_SIZE * 0.5f;
+    const fe_vec3_t up = {{ 0.0f, 1.0f, 0.0f }};
+    const float heading = 6.2831853f * (float)v / FE_CULL_BENCH_VIEWS;
+    const fe_vec3_t dir = {{ cosf(heading), 0.0f, sinf(heading) }};
+    fe_vec3_t eye, target;
+
+    *out_kind = (fe_cull_bench_view_kind_t)(v % FE_CULL_BENCH_VIEW_KIND_COUNT);
+    switch (*out_kind) {
+        case FE_CULL_BENCH_VIEW_STREET: {
+            // Bir sokak kavsaginda, sokak boyunca
+            float street = (float)((v * 7) % FE_CULL_BENCH_BLOCKS) * FE_CULL_BENCH_BLOCK_SIZE - half_city;
+            float cross = (float)((v * 13) % FE_CULL_BENCH_BLOCKS) * FE_CULL_BENCH_BLOCK_SIZE - half_city;
+            eye = (fe_vec3_t){{ street, 1.7f, cross }};
+            fe_vec3_t axis = (v & 1) ? (fe_vec3_t){{ 1.0f, 0.0f, 0.0f }} : (fe_vec3_t){{ 0.0f, 0.0f, 1.0f }};
+            target = fe_vec3_add(eye, fe_vec3_add(axis, fe_vec3_scale(dir, 0.1f)));
+            break;
+        }
+        case FE_CULL_BENCH_VIEW_ROOFTOP:
+            eye = (fe_vec3_t){{ dir.x * half_city * 0.5f, 120.0f, dir.z * half_city * 0.5f }};
+            target = (fe_vec3_t){{ eye.x - dir.x * 300.0f, 20.0f, eye.z - dir.z * 300.0f }};
+            break;
+        default:
+            eye = (fe_vec3_t){{ dir.x * half_city * 0.3f, 900.0f, dir.z * half_city * 0.3f }};
+            target = (fe_vec3_t){{ 0.0f, 0.0f, 0.0f }};
+            break;
+    }
+    fe_mat4_t proj = fe_mat4_perspective(1.0471976f, (float)FE_CULL_PYRAMID_DEFAULT_WIDTH / FE_CULL_PYRAMID_DEFAULT_HEIGHT,
+                                         0.5f, 4000.0f);
+    return fe_mat4_multiply(proj, fe_mat4_look_at(eye, target, up));
+}
+
+/**
+ * @brief Gorus hacminden gecen binalardan ekranda en buyuk gorunenleri secer (kosegen / uzaklik).
+ * @return Secilen perdeleyici sayisi.
+ */
+static uint32_t fe_cull_bench_pick_occluders(const float* boxes, const uint32_t* visible, uint32_t visible_count,
+                                             const fe_mat4_t* view_proj, uint32_t* out_occluders) {
+    float best_score[FE_CULL_BENCH_OCCLUDERS];
+    uint32_t count = 0;
+    for (uint32_t k = 0; k < visible_count; ++k) {
+        uint32_t i = visible[k];
+        if (i >= FE_CULL_BENCH_BUILDINGS) break; // Indeksler artan sirada; binalar once gelir
+        fe_vec3_t min = fe_cull_bench_record_min(boxes, i), max = fe_cull_bench_record_max(boxes, i);
+        fe_vec3_t center = fe_vec3_scale(fe_vec3_add(min, max), 0.5f);
+        fe_vec4_t clip = fe_mat4_multiply_vec4(*view_proj, (fe_vec4_t){{ center.x, center.y, center.z, 1.0f }});
+        float distance = clip.w > 1.0f ? clip.w : 1.0f;
+        float score = fe_vec3_length(fe_vec3_subtract(max, min)) / distance;
+
+        uint32_t slot = count < FE_CULL_BENCH_OCCLUDERS ? count++ : FE_CULL_BENCH_OCCLUDERS;
+        if (slot == FE_CULL_BENCH_OCCLUDERS) {
+            if (score <= best_score[FE_CULL_BENCH_OCCLUDERS - 1]) continue;
+            slot = FE_CULL_BENCH_OCCLUDERS - 1;
+        }
+        while (slot > 0 && best_score[slot - 1] < score) {
+            best_score[slot] = best_score[slot - 1];
+            out_occluders[slot] = out_occluders[slot - 1];
+            --slot;
+        }
+        best_score[slot] = score;
+        out_occluders[slot] = i;
+    }
+    return count;
+}
+
+int main(void) {
+    float* boxes = (float*)malloc(sizeof(float) * FE_CULL_BENCH_STRIDE * FE_CULL_BENCH_BOXES);
+    fe_mat4_t* models = (fe_mat4_t*)malloc(sizeof(fe_mat4_t) * FE_CULL_BENCH_PROPS);
+    uint32_t* visible = (uint32_t*)malloc(sizeof(uint32_t) * FE_CULL_BENCH_BOXES);
+    uint32_t* unoccluded = (uint32_t*)malloc(sizeof(uint32_t) * FE_CULL_BENCH_BOXES);
+    uint8_t* flags = (uint8_t*)malloc(FE_CULL_BENCH_BOXES);
+    fe_cull_bench_totals_t totals[FE_CULL_BENCH_VIEW_KIND_COUNT];
+    uint32_t frustum_mismatch = 0, occlusion_mismatch = 0;
+    int failures = 0;
+
+    fe_logger_set_level(FE_LOG_LEVEL_WARN);
+    fe_memory_manager_init();
+    memset(totals, 0, sizeof(totals));
+
+#ifdef FE_SIMD_WIDTH
+    printf("SIMD genisligi: %d\n", FE_SIMD_WIDTH);
+#else
+    printf("SIMD genisligi: yok (skaler)\n");
+#endif
+
+    fe_cull_bench_build_city(boxes, models);
+    double transform_ms = 1e30;
+    for (int r = 0; r < FE_CULL_BENCH_REPEATS; ++r) {
+        double ms = fe_cull_bench_transform_props(boxes, models);
+        if (ms < transform_ms) transform_ms = ms;
+    }
+    uint32_t uncontained = fe_cull_bench_check_transform(boxes, models);
+    printf("%u bina + %u dekor = %u kutu, %d bakis, %d perdeleyici, piramit %dx%d\n", FE_CULL_BENCH_BUILDINGS,
+           FE_CULL_BENCH_PROPS, FE_CULL_BENCH_BOXES, FE_CULL_BENCH_VIEWS, FE_CULL_BENCH_OCCLUDERS,
+           FE_CULL_PYRAMID_DEFAULT_WIDTH, FE_CULL_PYRAMID_DEFAULT_HEIGHT);
+    printf("  model donusumu: %.0f kutu/ms\n", FE_CULL_BENCH_PROPS / (transform_ms > 0.0 ? transform_ms : 1e-6));
+    if (uncontained != 0) {
+        printf("  BASARISIZ: %u donusturulmus kutu kendi koselerini kapsamiyor\n", uncontained);
+        failures++;
+    }
+
+    fe_depth_pyramid_t* pyramid = fe_depth_pyramid_create(FE_CULL_PYRAMID_DEFAULT_WIDTH, FE_CULL_PYRAMID_DEFAULT_HEIGHT);
+    if (!pyramid) {
+        printf("  BASARISIZ: derinlik piramidi olusturulamadi\n");
+        return 1;
+    }
+
+    for (uint32_t v = 0; v < FE_CULL_BENCH_VIEWS; ++v) {
+        fe_cull_bench_view_kind_t kind;
+        fe_mat4_t view_proj = fe_cull_bench_view(v, &kind);
+        fe_frustum_t frustum;
+        fe_frustum_from_matrix(&frustum, &view_proj);
+        fe_cull_bench_totals_t* t = &totals[kind];
+
+        uint32_t visible_count = 0;
+        double best = 1e30;
+        for (int r = 0; r < FE_CULL_BENCH_REPEATS; ++r) {
+            double start = fe_cull_bench_now_ms();
+            visible_count = fe_cull_frustum_aabbs(&frustum, boxes, FE_CULL_BENCH_STRIDE, FE_CULL_BENCH_BOXES, visible);
+            double ms = fe_cull_bench_now_ms() - start;
+            if (ms < best) best = ms;
+        }
+        t->frustum_ms += best;
+
+        // Kontrol 2
+        memset(flags, 0, FE_CULL_BENCH_BOXES);
+        for (uint32_t k = 0; k < visible_count; ++k) flags[visible[k]] = 1;
+        for (uint32_t i = 0; i < FE_CULL_BENCH_BOXES; ++i) {
+            bool scalar = fe_frustum_test_aabb(&frustum, fe_cull_bench_record_min(boxes, i), fe_cull_bench_record_max(boxes, i));
+            if (scalar != (flags[i] != 0)) frustum_mismatch++;
+        }
+
+        uint32_t occluders[FE_CULL_BENCH_OCCLUDERS];
+        uint32_t occluder_count = fe_cull_bench_pick_occluders(boxes, visible, visible_count, &view_proj, occluders);
+        best = 1e30;
+        for (int r = 0; r < FE_CULL_BENCH_REPEATS; ++r) {
+            double start = fe_cull_bench_now_ms();
+            fe_depth_pyramid_begin(pyramid, &view_proj);
+            for (uint32_t o = 0; o < occluder_count; ++o) {
+                fe_depth_pyramid_rasterize_box(pyramid, fe_cull_bench_record_min(boxes, occluders[o]),
+                                               fe_cull_bench_record_max(boxes, occluders[o]));
+            }
+            fe_depth_pyramid_build(pyramid);
+            double ms = fe_cull_bench_now_ms() - start;
+            if (ms < best) best = ms;
+        }
+        t->pyramid_ms += best;
+
+        uint32_t unoccluded_count = 0;
+        best = 1e30;
+        for (int r = 0; r < FE_CULL_BENCH_REPEATS; ++r) {
+            double start = fe_cull_bench_now_ms();
+            unoccluded_count = fe_cull_occlusion_aabbs(pyramid, boxes, FE_CULL_BENCH_STRIDE, visible, visible_count, unoccluded);
+            double ms = fe_cull_bench_now_ms() - start;
+            if (ms < best) best = ms;
+        }
+        t->occlusion_ms += best;
+
+        // Kontrol 3
+        memset(flags, 0, FE_CULL_BENCH_BOXES);
+        for (uint32_t k = 0; k < unoccluded_count; ++k) flags[unoccluded[k]] = 1;
+        for (uint32_t k = 0; k < visible_count; ++k) {
+            uint32_t i = visible[k];
+            bool scalar = fe_depth_pyramid_test_aabb(pyramid, fe_cull_bench_record_min(boxes, i), fe_cull_bench_record_max(boxes, i));
+            if (scalar != (flags[i] != 0)) occlusion_mismatch++;
+        }
+
+        t->views++;
+        t->boxes += FE_CULL_BENCH_BOXES;
+        t->frustum_rejected += FE_CULL_BENCH_BOXES - visible_count;
+        t->occlusion_tested += visible_count;
+        t->occlusion_rejected += visible_count - unoccluded_count;
+    }
+
+    printf("bakis     sayi   hacim kutu/ms   piramit ms   Hi-Z kutu/ms   hacim reddi   Hi-Z reddi   cizilen\n");
+    for (int k = 0; k < FE_CULL_BENCH_VIEW_KIND_COUNT; ++k) {
+        const fe_cull_bench_totals_t* t = &totals[k];
+        if (t->views == 0) continue;
+        double drawn = (double)(t->occlusion_tested - t->occlusion_rejected);
+        printf("  %-7s %4u   %13.0f   %10.3f   %12.0f   %10.1f%%   %9.1f%%   %6.1f%%\n", g_cull_bench_view_names[k], t->views,
+               (double)t->boxes / (t->frustum_ms > 0.0 ? t->frustum_ms : 1e-6), t->pyramid_ms / t->views,
+               (double)t->occlusion_tested / (t->occlusion_ms > 0.0 ? t->occlusion_ms : 1e-6),
+               100.0 * (double)t->frustum_rejected / (double)t->boxes,
+               100.0 * (double)t->occlusion_rejected / (double)t->boxes, 100.0 * drawn / (double)t->boxes);
+    }
+
+    if (frustum_mismatch != 0) {
+        printf("  BASARISIZ: toplu gorus hacmi testi %u kutuda skaler testten ayristi\n", frustum_mismatch);
+        failures++;
+    }
+    if (occlusion_mismatch != 0) {
+        printf("  BASARISIZ: toplu Hi-Z testi %u kutuda skaler testten ayristi\n", occlusion_mismatch);
+        failures++;
+    }
+
+    fe_depth_pyramid_destroy(pyramid);
+    fe_memory_manager_shutdown();
+    free(flags);
+    free(unoccluded);
+    free(visible);
+    free(models);
+    free(boxes);
+    if (failures == 0) {
+        printf("GECTI\n");
+    }
+    return failures ? 1 : 0;
+}
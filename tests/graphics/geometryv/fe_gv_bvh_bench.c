@@ -0,0 +1,315 @@
+// tests/graphics/geometryv/fe_gv_bvh_bench.c
+
+/**
+ * @brief GeometryV kume BVH'si insa kiyaslamasi: 1M kume kutusu.
+ * * Iki dagilim: 100 m kupte rastgele kutular ve 1000 nesnenin yuzeyine dizilmis kumeler (sahne benzeri).
+ * * Her dagilim icin fe_gv_bvh_build FE_GV_BVH_BENCH_REPEATS kez calistirilir; en iyi insa suresi ve
+ * * fe_gv_bvh_sah_cost basilir. Kalite referansi: Morton sirasinda ortadan bolunmus agacin SAH maliyeti.
+ * * Kontroller:
+ * * 1. cluster_order bir permutasyondur ve yapraklar [0, kume sayisi) araligini tam bir kez kapsar.
+ * * 2. Her cocuk kutusu kendi alt agacinin kumelerini kapsar; dugum dizisi FE_CACHE_LINE_SIZE hizalidir.
+ * * 3. SAH maliyeti Morton ortadan bolme referansindan dusuktur.
+ * * 4. En iyi insa suresi FE_GV_BVH_BENCH_BUDGET_MS'yi asmaz.
+ * * 5. Isci verilmisse, iscili ve iscisiz insa ayni dugum dizisini uretir.
+ * * Herhangi biri tutmazsa 1 ile cikar.
+ *
+ * Derleme (depo kokunden):
+ *   gcc -O2 -std=c11 -D_GNU_SOURCE -Iinclude tests/graphics/geometryv/fe_gv_bvh_bench.c \
+ *       src/graphics/geometryv/fe_gv_bvh.c \
+ *       src/math/fe_vector.c src/platform/fe_job_system.c src/platform/fe_thread.c \
+ *       src/utils/fe_logger.c src/error/fe_error.c src/memory/fe_memory_manager.c \
+ *       src/memory/fe_allocator_linear.c src/memory/fe_allocator_pool.c \
+ *       src/memory/fe_allocator_size_class.c -lm -lpthread -o fe_gv_bvh_bench
+ *   ./fe_gv_bvh_bench [isci_sayisi]
+ */
+
+#include "graphics/geometryv/fe_gv_bvh.h"
+#include "memory/fe_memory_manager.h"
+#include "platform/fe_atomic.h" // FE_CACHE_LINE_SIZE
+#include "platform/fe_job_system.h"
+#include "utils/fe_logger.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#define FE_GV_BVH_BENCH_CLUSTERS 1000000
+#define FE_GV_BVH_BENCH_OBJECTS 1000
+#define FE_GV_BVH_BENCH_REPEATS 5
+#define FE_GV_BVH_BENCH_BUDGET_MS 500.0
+
+typedef struct fe_gv_bvh_bench_key {
+    uint32_t code;
+    uint32_t index;
+} fe_gv_bvh_bench_key_t;
+
+static double fe_gv_bvh_bench_now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e3 + (double)ts.tv_nsec * 1e-6;
+}
+
+static inline float fe_gv_bvh_bench_randf(uint32_t* state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return (float)(*state >> 8) * (1.0f / 16777216.0f);
+}
+
+static void fe_gv_bvh_bench_box(fe_gv_cluster_t* cluster, fe_vec3_t center, float half) {
+    memset(cluster, 0, sizeof(*cluster));
+    cluster->aabb_min = (fe_vec3_t){{center.x - half, center.y - half, center.z - half}};
+    cluster->aabb_max = (fe_vec3_t){{center.x + half, center.y + half, center.z + half}};
+    cluster->triangle_count = 128;
+}
+
+static void fe_gv_bvh_bench_random(fe_gv_cluster_t* clusters, uint32_t count) {
+    uint32_t state = 0x2545F491u;
+    for (uint32_t i = 0; i < count; ++i) {
+        fe_vec3_t c = {{100.0f * fe_gv_bvh_bench_randf(&state), 100.0f * fe_gv_bvh_bench_randf(&state),
+                        100.0f * fe_gv_bvh_bench_randf(&state)}};
+        fe_gv_bvh_bench_box(&clusters[i], c, 0.05f + 0.45f * fe_gv_bvh_bench_randf(&state));
+    }
+}
+
+/**
+ * @brief 1 km x 1 km alana dagilmis nesneler; her nesnenin kumeleri kendi kuresinin yuzeyindedir.
+ */
+static void fe_gv_bvh_bench_scene(fe_gv_cluster_t* clusters, uint32_t count) {
+    uint32_t state = 0x68E31DA4u;
+    uint32_t per_object = count / FE_GV_BVH_BENCH_OBJECTS;
+    for (uint32_t o = 0; o < FE_GV_BVH_BENCH_OBJECTS; ++o) {
+        fe_vec3_t origin = {{1000.0f * fe_gv_bvh_bench_randf(&state), 0.0f, 1000.0f * fe_gv_bvh_bench_randf(&state)}};
+        float radius = 2.0f + 18.0f * fe_gv_bvh_bench_randf(&state);
+        origin.y = radius;
+        uint32_t last = (o + 1 == FE_GV_BVH_BENCH_OBJECTS) ? count : (o + 1) * per_object;
+        for (uint32_t i = o * per_object; i < last; ++i) {
+            float z = 2.0f * fe_gv_bvh_bench_randf(&state) - 1.0f;
+            float phi = 6.2831853f * fe_gv_bvh_bench_randf(&state);
+            float s = sqrtf(1.0f - z * z);
+            fe_vec3_t c = {{origin.x + radius * s * cosf(phi), origin.y + radius * z, origin.z + radius * s * sinf(phi)}};
+            fe_gv_bvh_bench_box(&clusters[i], c, radius * 0.04f);
+        }
+    }
+}
+
+static uint32_t fe_gv_bvh_bench_expand(uint32_t v) {
+    v = (v * 0x00010001u) & 0xFF0000FFu;
+    v = (v * 0x00000101u) & 0x0F00F00Fu;
+    v = (v * 0x00000011u) & 0xC30C30C3u;
+    v = (v * 0x00000005u) & 0x49249249u;
+    return v;
+}
+
+static int fe_gv_bvh_bench_compare_keys(const void* a, const void* b) {
+    const fe_gv_bvh_bench_key_t* ka = (const fe_gv_bvh_bench_key_t*)a;
+    const fe_gv_bvh_bench_key_t* kb = (const fe_gv_bvh_bench_key_t*)b;
+    if (ka->code != kb->code) return ka->code < kb->code ? -1 : 1;
+    return ka->index < kb->index ? -1 : (ka->index > kb->index);
+}
+
+static void fe_gv_bvh_bench_range_bounds(const fe_gv_cluster_t* clusters, const fe_gv_bvh_bench_key_t* keys,
+                                         uint32_t first, uint32_t count, fe_vec3_t* out_min, fe_vec3_t* out_max) {
+    fe_vec3_t mn = {{INFINITY, INFINITY, INFINITY}}, mx = {{-INFINITY, -INFINITY, -INFINITY}};
+    for (uint32_t i = first; i < first + count; ++i) {
+        const fe_gv_cluster_t* c = &clusters[keys[i].index];
+        for (int a = 0; a < 3; ++a) {
+            mn.v[a] = fminf(mn.v[a], c->aabb_min.v[a]);
+            mx.v[a] = fmaxf(mx.v[a], c->aabb_max.v[a]);
+        }
+    }
+    *out_min = mn;
+    *out_max = mx;
+}
+
+/**
+ * @brief Referans: Morton sirasindaki araligi her seviyede ortadan bolen agac (ayni dugum bicimiyle).
+ * @return Yazilan dugumun indeksi.
+ */
+static uint32_t fe_gv_bvh_bench_median_node(const fe_gv_cluster_t* clusters, const fe_gv_bvh_bench_key_t* keys,
+                                            uint32_t first, uint32_t count, fe_gv_bvh_node_t* nodes, uint32_t* node_count) {
+    uint32_t index = (*node_count)++;
+    uint32_t half = count / 2;
+    uint32_t ranges[2][2] = {{first, half}, {first + half, count - half}};
+    for (int k = 0; k < 2; ++k) {
+        fe_gv_bvh_bench_range_bounds(clusters, keys, ranges[k][0], ranges[k][1], &nodes[index].child_min[k], &nodes[index].child_max[k]);
+        if (ranges[k][1] <= FE_GV_BVH_MAX_LEAF_CLUSTERS) {
+            nodes[index].child[k] = ranges[k][0];
+            nodes[index].child_count[k] = ranges[k][1];
+        } else {
+            nodes[index].child_count[k] = 0;
+            nodes[index].child[k] = fe_gv_bvh_bench_median_node(clusters, keys, ranges[k][0], ranges[k][1], nodes, node_count);
+        }
+    }
+    return index;
+}
+
+static float fe_gv_bvh_bench_median_cost(const fe_gv_cluster_t* clusters, uint32_t count) {
+    fe_gv_bvh_bench_key_t* keys = (fe_gv_bvh_bench_key_t*)malloc(sizeof(fe_gv_bvh_bench_key_t) * count);
+    fe_gv_bvh_node_t* nodes = (fe_gv_bvh_node_t*)malloc(sizeof(fe_gv_bvh_node_t) * count);
+    if (!keys || !nodes) {
+        free(keys);
+        free(nodes);
+        return INFINITY;
+    }
+
+    fe_vec3_t mn, mx;
+    for (uint32_t i = 0; i < count; ++i) keys[i].index = i;
+    fe_gv_bvh_bench_range_bounds(clusters, keys, 0, count, &mn, &mx);
+    for (uint32_t i = 0; i < count; ++i) {
+        uint32_t code = 0;
+        for (int a = 0; a < 3; ++a) {
+            float center = 0.5f * (clusters[i].aabb_min.v[a] + clusters[i].aabb_max.v[a]);
+            float t = (center - mn.v[a]) / fmaxf(mx.v[a] - mn.v[a], 1e-6f);
+            uint32_t q = (uint32_t)fminf(fmaxf(t * 1024.0f, 0.0f), 1023.0f);
+            code |= fe_gv_bvh_bench_expand(q) << (2 - a);
+        }
+        keys[i].code = code;
+    }
+    qsort(keys, count, sizeof(fe_gv_bvh_bench_key_t), fe_gv_bvh_bench_compare_keys);
+
+    uint32_t node_count = 0;
+    fe_gv_bvh_bench_median_node(clusters, keys, 0, count, nodes, &node_count);
+    float cost = fe_gv_bvh_sah_cost(nodes, node_count);
+    free(keys);
+    free(nodes);
+    return cost;
+}
+
+/**
+ * @brief Alt agaci gezer: yaprak kapsamini isaretler, cocuk kutularinin kumeleri kapsadigini kontrol eder.
+ * @return Ihlal sayisi.
+ */
+static uint32_t fe_gv_bvh_bench_check_node(const fe_gv_bvh_t* bvh, const fe_gv_cluster_t* clusters, uint32_t node,
+                                           fe_vec3_t box_min, fe_vec3_t box_max, uint8_t* covered, uint32_t depth) {
+    if (node >= bvh->node_count || depth > 64) return 1;
+    uint32_t violations = 0;
+    const fe_gv_bvh_node_t* n = &bvh->nodes[node];
+    for (int k = 0; k < 2; ++k) {
+        if (n->child[k] == FE_GV_BVH_INVALID) continue;
+        for (int a = 0; a < 3; ++a) {
+            if (n->child_min[k].v[a] < box_min.v[a] || n->child_max[k].v[a] > box_max.v[a]) violations++;
+        }
+        if (n->child_count[k] == 0) {
+            violations += fe_gv_bvh_bench_check_node(bvh, clusters, n->child[k], n->child_min[k], n->child_max[k], covered, depth + 1);
+            continue;
+        }
+        for (uint32_t i = n->child[k]; i < n->child[k] + n->child_count[k]; ++i) {
+            if (i >= bvh->cluster_count || covered[i]++) {
+                violations++;
+                continue;
+            }
+            const fe_gv_cluster_t* c = &clusters[bvh->cluster_order[i]];
+            for (int a = 0; a < 3; ++a) {
+                if (c->aabb_min.v[a] < n->child_min[k].v[a] || c->aabb_max.v[a] > n->child_max[k].v[a]) violations++;
+            }
+        }
+    }
+    return violations;
+}
+
+static uint32_t fe_gv_bvh_bench_check(const fe_gv_bvh_t* bvh, const fe_gv_cluster_t* clusters, uint32_t count) {
+    uint32_t violations = 0;
+    uint8_t* seen = (uint8_t*)calloc(count, 1);
+    uint8_t* covered = (uint8_t*)calloc(count, 1);
+    if (!seen || !covered || bvh->cluster_count != count) {
+        free(seen);
+        free(covered);
+        return 1;
+    }
+    if (((uintptr_t)bvh->nodes & (FE_CACHE_LINE_SIZE - 1)) != 0) violations++;
+    for (uint32_t i = 0; i < count; ++i) {
+        if (bvh->cluster_order[i] >= count || seen[bvh->cluster_order[i]]++) violations++;
+    }
+    violations += fe_gv_bvh_bench_check_node(bvh, clusters, 0, bvh->bounds_min, bvh->bounds_max, covered, 0);
+    for (uint32_t i = 0; i < count; ++i) {
+        if (!covered[i]) violations++;
+    }
+    free(seen);
+    free(covered);
+    return violations;
+}
+
+/**
+ * @brief En iyi FE_GV_BVH_BENCH_REPEATS insa suresini olcer; son agac out_bvh'de kalir.
+ */
+static bool fe_gv_bvh_bench_build(const fe_gv_cluster_t* clusters, uint32_t count, fe_gv_bvh_t* out_bvh, double* out_ms) {
+    double best = 1e30;
+    memset(out_bvh, 0, sizeof(*out_bvh));
+    for (int r = 0; r < FE_GV_BVH_BENCH_REPEATS; ++r) {
+        fe_gv_bvh_free(out_bvh);
+        double start = fe_gv_bvh_bench_now_ms();
+        if (!fe_gv_bvh_build(clusters, count, out_bvh)) return false;
+        double elapsed = fe_gv_bvh_bench_now_ms() - start;
+        if (elapsed < best) best = elapsed;
+    }
+    *out_ms = best;
+    return true;
+}
+
+int main(int argc, char** argv) {
+    uint32_t workers = (argc > 1) ? (uint32_t)atoi(argv[1]) : 0;
+    const uint32_t count = FE_GV_BVH_BENCH_CLUSTERS;
+    int result = 0;
+
+    fe_logger_set_level(FE_LOG_LEVEL_WARN);
+    fe_memory_manager_init();
+
+    fe_gv_cluster_t* clusters = (fe_gv_cluster_t*)malloc(sizeof(fe_gv_cluster_t) * count);
+    if (!clusters) return 1;
+
+    const char* names[2] = {"rastgele", "sahne"};
+    for (int d = 0; d < 2; ++d) {
+        if (d == 0) fe_gv_bvh_bench_random(clusters, count);
+        else fe_gv_bvh_bench_scene(clusters, count);
+
+        fe_gv_bvh_t bvh, reference;
+        double build_ms;
+        fe_job_system_init(workers);
+        bool built = fe_gv_bvh_bench_build(clusters, count, &bvh, &build_ms);
+        uint32_t threads = fe_job_system_thread_count();
+        fe_job_system_shutdown();
+        if (!built) {
+            printf("BASARISIZ: %s BVH insasi\n", names[d]);
+            return 1;
+        }
+
+        uint32_t violations = fe_gv_bvh_bench_check(&bvh, clusters, count);
+        float cost = fe_gv_bvh_sah_cost(bvh.nodes, bvh.node_count);
+        float median_cost = fe_gv_bvh_bench_median_cost(clusters, count);
+        printf("  %-8s: %u kume, %u dugum, insa %.0f ms (%u is parcacigi), SAH %.1f (Morton ortadan bolme %.1f)\n",
+               names[d], count, bvh.node_count, build_ms, threads, cost, median_cost);
+
+        if (violations > 0) {
+            printf("BASARISIZ: %u agac yapisi ihlali\n", violations);
+            result = 1;
+        }
+        if (!(cost < median_cost)) {
+            printf("BASARISIZ: SAH maliyeti ortadan bolmeden iyi degil\n");
+            result = 1;
+        }
+        if (build_ms > FE_GV_BVH_BENCH_BUDGET_MS) {
+            printf("BASARISIZ: insa %.0f ms butcesini asti\n", FE_GV_BVH_BENCH_BUDGET_MS);
+            result = 1;
+        }
+
+        // Iscisiz insa ayni agaci vermeli
+        if (workers > 0) {
+            if (!fe_gv_bvh_build(clusters, count, &reference)) return 1;
+            if (reference.node_count != bvh.node_count ||
+                memcmp(reference.nodes, bvh.nodes, sizeof(fe_gv_bvh_node_t) * bvh.node_count) != 0 ||
+                memcmp(reference.cluster_order, bvh.cluster_order, sizeof(uint32_t) * count) != 0) {
+                printf("BASARISIZ: agac is parcacigi sayisina bagli\n");
+                result = 1;
+            }
+            fe_gv_bvh_free(&reference);
+        }
+        fe_gv_bvh_free(&bvh);
+    }
+    if (result == 0) printf("GECTI\n");
+
+    free(clusters);
+    fe_memory_manager_shutdown();
+    return result;
+}
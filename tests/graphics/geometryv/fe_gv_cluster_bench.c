@@ -0,0 +1,236 @@
+// tests/graphics/geometryv/fe_gv_cluster_bench.c
+
+/**
+ * @brief GeometryV kume insasi kiyaslamasi: ~1M ucgenlik puruzlu kure.
+ * * fe_gv_cluster_build FE_GV_CLUSTER_BENCH_REPEATS kez calistirilir; en iyi sureden saniyede kume ve ucgen,
+ * * ayrica ortalama kume AABB hacmi basilir. Karsilastirma icin ayni ucgenler indeks sirasinda her
+ * * FE_GV_CLUSTER_MAX_TRIANGLES ucgende bir kesilir (eski yol, gercek AABB ile). Kontroller:
+ * * 1. Tum ucgenler kumelere dagitilir; her kume 1..FE_GV_CLUSTER_MAX_TRIANGLES ucgen tutar ve AABB'si ucgenlerini kapsar.
+ * * 2. Ortalama AABB hacmi indeks sirasinda kesmekten kucuktur.
+ * * 3. Ucgen sirasi karistirildiginda ortalama hacim %10'dan fazla bozulmaz (kumeleme indeks sirasina dayanmaz).
+ * * Herhangi biri tutmazsa 1 ile cikar.
+ *
+ * Derleme (depo kokunden):
+ *   gcc -O2 -std=c11 -D_GNU_SOURCE -Iinclude tests/graphics/geometryv/fe_gv_cluster_bench.c \
+ *       src/graphics/geometryv/fe_gv_cluster_builder.c \
+ *       src/math/fe_hash.c src/math/fe_vector.c src/platform/fe_job_system.c src/platform/fe_thread.c \
+ *       src/utils/fe_logger.c src/error/fe_error.c src/memory/fe_memory_manager.c \
+ *       src/memory/fe_allocator_linear.c src/memory/fe_allocator_pool.c \
+ *       src/memory/fe_allocator_size_class.c -lm -lpthread -o fe_gv_cluster_bench
+ *   ./fe_gv_cluster_bench [isci_sayisi]
+ */
+
+#include "graphics/geometryv/fe_gv_cluster_builder.h"
+#include "memory/fe_memory_manager.h"
+#include "platform/fe_job_system.h"
+#include "utils/fe_logger.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#define FE_GV_CLUSTER_BENCH_RINGS 500
+#define FE_GV_CLUSTER_BENCH_SEGMENTS 1000  // 500 x 1000 x 2 = 1M ucgen
+#define FE_GV_CLUSTER_BENCH_REPEATS 3
+#define FE_GV_CLUSTER_BENCH_SHUFFLE_TOLERANCE 1.10
+
+static double fe_gv_cluster_bench_now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e3 + (double)ts.tv_nsec * 1e-6;
+}
+
+static inline uint32_t fe_gv_cluster_bench_rand(uint32_t* state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+/**
+ * @brief Enlem/boylam izgarasindan puruzlu birim kure (CPU verisi dolu, GPU kaynagi yok).
+ */
+static fe_mesh_t* fe_gv_cluster_bench_sphere(uint32_t rings, uint32_t segments) {
+    fe_mesh_t* mesh = (fe_mesh_t*)calloc(1, sizeof(fe_mesh_t));
+    if (!mesh) return NULL;
+    mesh->vertex_count = (rings + 1) * (segments + 1);
+    mesh->index_count = rings * segments * 6;
+    mesh->vertices = (fe_vertex_t*)calloc(mesh->vertex_count, sizeof(fe_vertex_t));
+    mesh->indices = (uint32_t*)malloc(sizeof(uint32_t) * mesh->index_count);
+    if (!mesh->vertices || !mesh->indices) return mesh;
+
+    const float pi = 3.14159265f;
+    for (uint32_t i = 0; i <= rings; ++i) {
+        float theta = pi * (float)i / (float)rings;
+        for (uint32_t j = 0; j <= segments; ++j) {
+            float phi = 2.0f * pi * (float)j / (float)segments;
+            float r = 1.0f + 0.03f * sinf(7.0f * theta) * cosf(11.0f * phi) + 0.01f * sinf(31.0f * theta + 23.0f * phi);
+            float* p = mesh->vertices[i * (segments + 1) + j].position;
+            p[0] = r * sinf(theta) * cosf(phi);
+            p[1] = r * cosf(theta);
+            p[2] = r * sinf(theta) * sinf(phi);
+        }
+    }
+    uint32_t k = 0;
+    for (uint32_t i = 0; i < rings; ++i) {
+        for (uint32_t j = 0; j < segments; ++j) {
+            uint32_t a = i * (segments + 1) + j, b = a + 1, c = a + segments + 1, d = c + 1;
+            mesh->indices[k++] = a; mesh->indices[k++] = b; mesh->indices[k++] = c;
+            mesh->indices[k++] = b; mesh->indices[k++] = d; mesh->indices[k++] = c;
+        }
+    }
+    return mesh;
+}
+
+static void fe_gv_cluster_bench_shuffle(fe_mesh_t* mesh) {
+    uint32_t state = 0x9E3779B9u;
+    uint32_t triangles = mesh->index_count / 3;
+    for (uint32_t i = triangles - 1; i > 0; --i) {
+        uint32_t j = fe_gv_cluster_bench_rand(&state) % (i + 1);
+        for (int v = 0; v < 3; ++v) {
+            uint32_t tmp = mesh->indices[i * 3 + v];
+            mesh->indices[i * 3 + v] = mesh->indices[j * 3 + v];
+            mesh->indices[j * 3 + v] = tmp;
+        }
+    }
+}
+
+static double fe_gv_cluster_bench_volume(fe_vec3_t mn, fe_vec3_t mx) {
+    return (double)(mx.x - mn.x) * (double)(mx.y - mn.y) * (double)(mx.z - mn.z);
+}
+
+/**
+ * @brief Eski yol: indeks sirasinda her FE_GV_CLUSTER_MAX_TRIANGLES ucgende kesip gercek AABB'lerin ortalama hacmi.
+ */
+static double fe_gv_cluster_bench_naive_volume(const fe_mesh_t* mesh) {
+    uint32_t triangles = mesh->index_count / 3;
+    double total = 0.0;
+    uint32_t count = 0;
+    for (uint32_t first = 0; first < triangles; first += FE_GV_CLUSTER_MAX_TRIANGLES, ++count) {
+        fe_vec3_t mn = {{INFINITY, INFINITY, INFINITY}}, mx = {{-INFINITY, -INFINITY, -INFINITY}};
+        uint32_t last = first + FE_GV_CLUSTER_MAX_TRIANGLES < triangles ? first + FE_GV_CLUSTER_MAX_TRIANGLES : triangles;
+        for (uint32_t i = first * 3; i < last * 3; ++i) {
+            const float* p = mesh->vertices[mesh->indices[i]].position;
+            for (int a = 0; a < 3; ++a) {
+                mn.v[a] = fminf(mn.v[a], p[a]);
+                mx.v[a] = fmaxf(mx.v[a], p[a]);
+            }
+        }
+        total += fe_gv_cluster_bench_volume(mn, mx);
+    }
+    return total / count;
+}
+
+/**
+ * @brief Kume kurallarini kontrol eder ve ortalama AABB hacmini dondurur; ihlaller out_violations'a yazilir.
+ */
+static double fe_gv_cluster_bench_check(const fe_gv_cluster_geometry_t* geometry, uint32_t* out_violations) {
+    uint32_t violations = 0, covered = 0;
+    double total = 0.0;
+    for (uint32_t c = 0; c < geometry->cluster_count; ++c) {
+        const fe_gv_cluster_t* cluster = &geometry->clusters[c];
+        if (cluster->triangle_count == 0 || cluster->triangle_count > FE_GV_CLUSTER_MAX_TRIANGLES ||
+            cluster->first_triangle_idx != covered) {
+            violations++;
+        }
+        for (uint32_t t = 0; t < cluster->triangle_count && cluster->first_triangle_idx + t < geometry->triangle_count; ++t) {
+            const fe_gpu_triangle_t* tri = &geometry->triangles[cluster->first_triangle_idx + t];
+            const fe_vec3_t* points[3] = {&tri->p1, &tri->p2, &tri->p3};
+            for (int k = 0; k < 3; ++k) {
+                for (int a = 0; a < 3; ++a) {
+                    if (points[k]->v[a] < cluster->aabb_min.v[a] || points[k]->v[a] > cluster->aabb_max.v[a]) {
+                        violations++;
+                        k = 3;
+                        break;
+                    }
+                }
+            }
+        }
+        covered += cluster->triangle_count;
+        total += fe_gv_cluster_bench_volume(cluster->aabb_min, cluster->aabb_max);
+    }
+    if (covered != geometry->triangle_count) violations++;
+    *out_violations = violations;
+    return geometry->cluster_count ? total / geometry->cluster_count : 0.0;
+}
+
+/**
+ * @brief En iyi FE_GV_CLUSTER_BENCH_REPEATS sureyi olcer; son kosunun sonucu out_geometry'de kalir.
+ */
+static bool fe_gv_cluster_bench_build(const fe_mesh_t* mesh, fe_gv_cluster_geometry_t* out_geometry, double* out_ms) {
+    const fe_mesh_t* meshes[1] = {mesh};
+    double best = 1e30;
+    memset(out_geometry, 0, sizeof(*out_geometry));
+    for (int r = 0; r < FE_GV_CLUSTER_BENCH_REPEATS; ++r) {
+        fe_gv_cluster_geometry_free(out_geometry);
+        double start = fe_gv_cluster_bench_now_ms();
+        if (!fe_gv_cluster_build(meshes, 1, out_geometry)) return false;
+        double elapsed = fe_gv_cluster_bench_now_ms() - start;
+        if (elapsed < best) best = elapsed;
+    }
+    *out_ms = best;
+    return true;
+}
+
+int main(int argc, char** argv) {
+    uint32_t workers = (argc > 1) ? (uint32_t)atoi(argv[1]) : 0;
+    int result = 0;
+
+    fe_logger_set_level(FE_LOG_LEVEL_WARN);
+    fe_memory_manager_init();
+    fe_job_system_init(workers);
+
+    fe_mesh_t* mesh = fe_gv_cluster_bench_sphere(FE_GV_CLUSTER_BENCH_RINGS, FE_GV_CLUSTER_BENCH_SEGMENTS);
+    if (!mesh || !mesh->indices || !mesh->vertices) {
+        printf("BASARISIZ: mesh olusturulamadi\n");
+        return 1;
+    }
+    printf("puruzlu kure: %u ucgen, %u is parcacigi\n", mesh->index_count / 3, fe_job_system_thread_count());
+
+    const char* names[2] = {"indeks sirasi", "karisik sira"};
+    double built[2], naive[2];
+    for (int pass = 0; pass < 2; ++pass) {
+        if (pass == 1) fe_gv_cluster_bench_shuffle(mesh);
+
+        fe_gv_cluster_geometry_t geometry;
+        double build_ms;
+        if (!fe_gv_cluster_bench_build(mesh, &geometry, &build_ms)) {
+            printf("BASARISIZ: kumeleme\n");
+            return 1;
+        }
+        uint32_t violations, full = 0;
+        built[pass] = fe_gv_cluster_bench_check(&geometry, &violations);
+        naive[pass] = fe_gv_cluster_bench_naive_volume(mesh);
+        for (uint32_t c = 0; c < geometry.cluster_count; ++c) {
+            if (geometry.clusters[c].triangle_count == FE_GV_CLUSTER_MAX_TRIANGLES) full++;
+        }
+
+        printf("  %-13s: %.0f ms, %u kume (%%%.0f dolu), %.0f kume/s, %.2fM ucgen/s\n", names[pass], build_ms,
+               geometry.cluster_count, 100.0 * full / geometry.cluster_count, geometry.cluster_count * 1e3 / build_ms,
+               geometry.triangle_count * 1e-3 / build_ms);
+        printf("  %-13s  ortalama AABB hacmi %.3e (her %d ucgende kesme: %.3e)\n", "", built[pass],
+               FE_GV_CLUSTER_MAX_TRIANGLES, naive[pass]);
+        if (violations > 0) {
+            printf("BASARISIZ: %u kume kurali ihlali\n", violations);
+            result = 1;
+        }
+        if (built[pass] >= naive[pass]) {
+            printf("BASARISIZ: kumeler indeks sirasinda kesmekten siki degil\n");
+            result = 1;
+        }
+        fe_gv_cluster_geometry_free(&geometry);
+    }
+    if (built[1] > FE_GV_CLUSTER_BENCH_SHUFFLE_TOLERANCE * built[0]) {
+        printf("BASARISIZ: karisik sirada ortalama hacim %.2f kat bozuldu\n", built[1] / built[0]);
+        result = 1;
+    }
+    if (result == 0) printf("GECTI\n");
+
+    free(mesh->vertices);
+    free(mesh->indices);
+    free(mesh);
+    fe_job_system_shutdown();
+    fe_memory_manager_shutdown();
+    return result;
+}
@@ -0,0 +1,279 @@
+// tests/graphics/geometryv/fe_gv_lod_test.c
+
+/**
+ * @brief Kume LOD DAG'i ve ekran uzayi hatasina gore CPU secimi icin bagimsiz test.
+ * * ~1M ucgenlik bir arazi karosu kumelenir ve DAG'i kurulur (cevrimdisi adim; sure raporlanir).
+ * * Sahne karonun 10x10 ornegidir (~100M ucgen); her ornek icin kamera ornek uzayina tasinip
+ * * fe_gv_lod_select cagrilir. Kontroller:
+ * * 1. DAG yapisi: grup hatasi >= uye hatasi, grup kuresi uyeleri kapsar, her grubun ilk ciktisi dogru.
+ * * 2. Secim, her kumeyi tek tek test eden dogrusal referansla ayni kesiti verir (kameraya en yakin 2x2 ornek).
+ * * 3. Kesit delik birakmaz: secilen ucgenlerin alani karonun alaninin %90-%105'i arasindadir.
+ * * 4. 1080p'de secilen ucgen sayisi sahnenin %10'undan azdir.
+ * * Herhangi biri tutmazsa 1 ile cikar.
+ *
+ * Derleme (depo kokunden):
+ *   gcc -O2 -std=c11 -D_GNU_SOURCE -Iinclude tests/graphics/geometryv/fe_gv_lod_test.c \
+ *       src/graphics/geometryv/fe_gv_lod.c src/graphics/geometryv/fe_gv_cluster_builder.c \
+ *       src/math/fe_hash.c src/math/fe_vector.c src/platform/fe_job_system.c src/platform/fe_thread.c \
+ *       src/utils/fe_logger.c src/error/fe_error.c src/memory/fe_memory_manager.c \
+ *       src/memory/fe_allocator_linear.c src/memory/fe_allocator_pool.c \
+ *       src/memory/fe_allocator_size_class.c -lm -lpthread -o fe_gv_lod_test
+ *   ./fe_gv_lod_test [isci_sayisi]
+ */
+
+#include "graphics/geometryv/fe_gv_lod.h"
+#include "graphics/geometryv/fe_gv_cluster_builder.h"
+#include "memory/fe_memory_manager.h"
+#include "platform/fe_job_system.h"
+#include "utils/fe_logger.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#define FE_GV_LOD_TEST_QUADS 708      // 708x708 dortgen = 1002528 ucgen
+#define FE_GV_LOD_TEST_TILE_SIZE 200.0f
+#define FE_GV_LOD_TEST_GRID 10        // 10x10 ornek = ~100M ucgen
+#define FE_GV_LOD_TEST_FOV 1.0f
+#define FE_GV_LOD_TEST_ERROR_PIXELS 1.0f
+
+typedef struct fe_gv_lod_test_view {
+    float x, y, z;
+    const char* name;
+} fe_gv_lod_test_view_t;
+
+static double fe_gv_lod_test_now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e3 + (double)ts.tv_nsec * 1e-6;
+}
+
+static float fe_gv_lod_test_height(float x, float z) {
+    return 3.0f * sinf(x * 0.05f) * cosf(z * 0.043f) + 1.2f * sinf(x * 0.21f + 1.0f) * sinf(z * 0.17f) +
+           0.3f * sinf(x * 1.3f) * cosf(z * 1.1f) + 0.08f * sinf(x * 5.1f + z * 4.3f);
+}
+
+/**
+ * @brief n x n dortgenlik yukseklik alani karosu (CPU verisi dolu, GPU kaynagi yok).
+ */
+static fe_mesh_t* fe_gv_lod_test_terrain(uint32_t n, float size) {
+    fe_mesh_t* mesh = (fe_mesh_t*)calloc(1, sizeof(fe_mesh_t));
+    if (!mesh) return NULL;
+    mesh->vertex_count = (n + 1) * (n + 1);
+    mesh->index_count = n * n * 6;
+    mesh->vertices = (fe_vertex_t*)calloc(mesh->vertex_count, sizeof(fe_vertex_t));
+    mesh->indices = (uint32_t*)malloc(sizeof(uint32_t) * mesh->index_count);
+    if (!mesh->vertices || !mesh->indices) return mesh;
+
+    for (uint32_t i = 0; i <= n; ++i) {
+        for (uint32_t j = 0; j <= n; ++j) {
+            float* p = mesh->vertices[i * (n + 1) + j].position;
+            p[0] = size * (float)j / (float)n;
+            p[2] = size * (float)i / (float)n;
+            p[1] = fe_gv_lod_test_height(p[0], p[2]);
+        }
+    }
+    uint32_t k = 0;
+    for (uint32_t i = 0; i < n; ++i) {
+        for (uint32_t j = 0; j < n; ++j) {
+            uint32_t a = i * (n + 1) + j, b = a + 1, c = a + n + 1, d = c + 1;
+            mesh->indices[k++] = a; mesh->indices[k++] = c; mesh->indices[k++] = b;
+            mesh->indices[k++] = b; mesh->indices[k++] = c; mesh->indices[k++] = d;
+        }
+    }
+    return mesh;
+}
+
+static double fe_gv_lod_test_area(const fe_gpu_triangle_t* tri) {
+    fe_vec3_t u = fe_vec3_subtract(tri->p2, tri->p1), v = fe_vec3_subtract(tri->p3, tri->p1);
+    return 0.5 * (double)fe_vec3_length(fe_vec3_cross(u, v));
+}
+
+static fe_camera3d_t fe_gv_lod_test_camera(float x, float y, float z) {
+    fe_camera3d_t camera;
+    memset(&camera, 0, sizeof(camera));
+    camera.position = (fe_vec3_t){{x, y, z}};
+    camera.fov_y = FE_GV_LOD_TEST_FOV;
+    camera.near_plane = 0.1f;
+    camera.far_plane = 1e5f;
+    return camera;
+}
+
+/**
+ * @brief DAG yapisal kurallarini kontrol eder; ihlal sayisini dondurur.
+ */
+static uint32_t fe_gv_lod_test_check_dag(const fe_gv_lod_dag_t* dag) {
+    uint32_t violations = 0;
+    for (uint32_t c = 0; c < dag->geometry.cluster_count; ++c) {
+        const fe_gv_lod_cluster_t* lod = &dag->cluster_lod[c];
+        if (lod->group == FE_GV_LOD_NONE) continue;
+        const fe_gv_lod_group_t* group = &dag->groups[lod->group];
+        if (group->error < lod->error) violations++;
+        float reach = fe_vec3_length(fe_vec3_subtract(group->center, lod->center)) + lod->radius;
+        if (reach > group->radius * 1.0001f + 1e-4f) violations++;
+        if (c < group->first_member || c >= group->first_member + group->member_count) violations++;
+    }
+    for (uint32_t g = 0; g < dag->group_count; ++g) {
+        uint32_t first = dag->groups[g].first_output;
+        if (first == FE_GV_LOD_NONE || dag->cluster_lod[first].source_group != g) {
+            violations++;
+            continue;
+        }
+        for (uint32_t c = 0; c < first; ++c) {
+            if (dag->cluster_lod[c].source_group == g) { violations++; break; }
+        }
+    }
+    return violations;
+}
+
+static float fe_gv_lod_test_projected(fe_vec3_t center, float radius, float error, const fe_camera3d_t* camera, float scale) {
+    float distance = fe_vec3_length(fe_vec3_subtract(center, camera->position)) - radius;
+    if (distance < camera->near_plane) distance = camera->near_plane;
+    return error * scale / distance;
+}
+
+/**
+ * @brief Dogrusal referans: kume kendi hatasi esigin altinda (veya seviye 0) ve ebeveyn hatasi ustundeyse secilir.
+ * @param marks Kume basina 1/0 yazilir.
+ * @return Secilen kume sayisi; toplam ucgen sayisi out_triangles'a yazilir.
+ */
+static uint32_t fe_gv_lod_test_linear(const fe_gv_lod_dag_t* dag, const fe_camera3d_t* camera, float screen_height,
+                                      uint8_t* marks, uint32_t* out_triangles) {
+    float scale = screen_height / (2.0f * tanf(0.5f * camera->fov_y));
+    uint32_t count = 0, triangles = 0;
+    for (uint32_t c = 0; c < dag->geometry.cluster_count; ++c) {
+        const fe_gv_lod_cluster_t* lod = &dag->cluster_lod[c];
+        float own = fe_gv_lod_test_projected(lod->center, lod->radius, lod->error, camera, scale);
+        float parent = INFINITY;
+        if (lod->group != FE_GV_LOD_NONE) {
+            const fe_gv_lod_group_t* group = &dag->groups[lod->group];
+            parent = fe_gv_lod_test_projected(group->center, group->radius, group->error, camera, scale);
+        }
+        marks[c] = (lod->source_group == FE_GV_LOD_NONE || own <= FE_GV_LOD_TEST_ERROR_PIXELS) &&
+                   parent > FE_GV_LOD_TEST_ERROR_PIXELS;
+        if (marks[c]) {
+            count++;
+            triangles += dag->geometry.clusters[c].triangle_count;
+        }
+    }
+    *out_triangles = triangles;
+    return count;
+}
+
+int main(int argc, char** argv) {
+    uint32_t workers = (argc > 1) ? (uint32_t)atoi(argv[1]) : 0;
+    static const fe_gv_lod_test_view_t views[] = {
+        {1000.0f, 8.0f, 1000.0f, "merkez alcak"},
+        {50.0f, 5.0f, 50.0f, "kose alcak"},
+        {1000.0f, 300.0f, 1000.0f, "yuksek"},
+        {-500.0f, 20.0f, 1000.0f, "disarida"},
+    };
+    static const float heights[] = {720.0f, 1080.0f, 2160.0f};
+    int result = 0;
+
+    fe_logger_set_level(FE_LOG_LEVEL_WARN);
+    fe_memory_manager_init();
+    fe_job_system_init(workers);
+
+    fe_mesh_t* mesh = fe_gv_lod_test_terrain(FE_GV_LOD_TEST_QUADS, FE_GV_LOD_TEST_TILE_SIZE);
+    const fe_mesh_t* meshes[1] = {mesh};
+    fe_gv_cluster_geometry_t base;
+    fe_gv_lod_dag_t dag;
+    double t0 = fe_gv_lod_test_now_ms();
+    if (!mesh || !mesh->indices || !fe_gv_cluster_build(meshes, 1, &base)) {
+        printf("BASARISIZ: kumeleme\n");
+        return 1;
+    }
+    double t1 = fe_gv_lod_test_now_ms();
+    if (!fe_gv_lod_build(&base, &dag)) {
+        printf("BASARISIZ: DAG insasi\n");
+        return 1;
+    }
+    double t2 = fe_gv_lod_test_now_ms();
+    printf("karo: %u ucgen, %u kume (kumeleme %.0f ms) -> DAG %u seviye, %u kume, %u grup (insa %.0f ms, cevrimdisi)\n",
+           base.triangle_count, base.cluster_count, t1 - t0, dag.level_count, dag.geometry.cluster_count,
+           dag.group_count, t2 - t1);
+
+    uint32_t violations = fe_gv_lod_test_check_dag(&dag);
+    if (violations > 0) {
+        printf("BASARISIZ: %u DAG yapi ihlali\n", violations);
+        result = 1;
+    }
+
+    double tile_area = 0.0;
+    for (uint32_t i = 0; i < base.triangle_count; ++i) tile_area += fe_gv_lod_test_area(&base.triangles[i]);
+    double scene_triangles = (double)FE_GV_LOD_TEST_GRID * FE_GV_LOD_TEST_GRID * base.triangle_count;
+    printf("sahne: %dx%d ornek = %.1fM ucgen\n", FE_GV_LOD_TEST_GRID, FE_GV_LOD_TEST_GRID, scene_triangles * 1e-6);
+
+    fe_gv_lod_selection_t selection;
+    memset(&selection, 0, sizeof(selection));
+    uint8_t* marks = (uint8_t*)malloc(dag.geometry.cluster_count);
+    if (!marks) return 1;
+
+    for (size_t v = 0; v < sizeof(views) / sizeof(views[0]); ++v) {
+        for (size_t h = 0; h < sizeof(heights) / sizeof(heights[0]); ++h) {
+            fe_gv_lod_settings_t settings = {FE_GV_LOD_TEST_ERROR_PIXELS, heights[h], NULL};
+            uint64_t triangles = 0, clusters = 0;
+            uint32_t mismatches = 0;
+            double select_ms = 0.0, area = 0.0;
+
+            for (int ix = 0; ix < FE_GV_LOD_TEST_GRID; ++ix) {
+                for (int iz = 0; iz < FE_GV_LOD_TEST_GRID; ++iz) {
+                    // Ornek kaydirmasi yerine kamera ornek uzayina tasinir
+                    fe_camera3d_t camera = fe_gv_lod_test_camera(views[v].x - (float)ix * FE_GV_LOD_TEST_TILE_SIZE, views[v].y,
+                                                                 views[v].z - (float)iz * FE_GV_LOD_TEST_TILE_SIZE);
+                    double s0 = fe_gv_lod_test_now_ms();
+                    if (!fe_gv_lod_select(&dag, &camera, &settings, &selection)) mismatches++;
+                    select_ms += fe_gv_lod_test_now_ms() - s0;
+                    triangles += selection.triangle_count;
+                    clusters += selection.cluster_count;
+                    if (ix >= 2 || iz >= 2) continue;
+
+                    uint32_t reference_triangles, hits = 0;
+                    uint32_t reference = fe_gv_lod_test_linear(&dag, &camera, heights[h], marks, &reference_triangles);
+                    for (uint32_t i = 0; i < selection.cluster_count; ++i) hits += marks[selection.clusters[i]];
+                    if (reference != selection.cluster_count || hits != reference || reference_triangles != selection.triangle_count) {
+                        mismatches++;
+                    }
+                    if (ix != 0 || iz != 0) continue;
+                    for (uint32_t i = 0; i < selection.cluster_count; ++i) {
+                        const fe_gv_cluster_t* cluster = &dag.geometry.clusters[selection.clusters[i]];
+                        for (uint32_t k = 0; k < cluster->triangle_count; ++k) {
+                            area += fe_gv_lod_test_area(&dag.geometry.triangles[cluster->first_triangle_idx + k]);
+                        }
+                    }
+                }
+            }
+
+            double share = (double)triangles / scene_triangles;
+            printf("  %-12s %4.0fp: %9llu ucgen (%%%5.2f) %7llu kume, secim %.2f ms, alan %.4f, referans farki %u\n",
+                   views[v].name, heights[h], (unsigned long long)triangles, 100.0 * share, (unsigned long long)clusters,
+                   select_ms, area / tile_area, mismatches);
+            if (mismatches > 0) {
+                printf("BASARISIZ: secim dogrusal referansla uyusmuyor\n");
+                result = 1;
+            }
+            if (area < 0.90 * tile_area || area > 1.05 * tile_area) {
+                printf("BASARISIZ: kesit karonun alanini korumuyor\n");
+                result = 1;
+            }
+            if (heights[h] == 1080.0f && share >= 0.10) {
+                printf("BASARISIZ: 1080p secimi sahnenin %%10'unu asiyor\n");
+                result = 1;
+            }
+        }
+    }
+    if (result == 0) printf("GECTI\n");
+
+    free(marks);
+    fe_gv_lod_selection_free(&selection);
+    fe_gv_lod_dag_free(&dag);
+    fe_gv_cluster_geometry_free(&base);
+    free(mesh->vertices);
+    free(mesh->indices);
+    free(mesh);
+    fe_job_system_shutdown();
+    fe_memory_manager_shutdown();
+    return result;
+}
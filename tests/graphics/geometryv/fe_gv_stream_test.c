@@ -0,0 +1,247 @@
+// tests/graphics/geometryv/fe_gv_stream_test.c
+
+/**
+ * @brief GeometryV sayfa akisi icin GPU'suz (headless) test; betikli kamera yolu uzerinde.
+ * * ~1M ucgenlik arazi karosunun DAG'i kurulur ve akis dosyasina yazilir (cevrimdisi adim).
+ * * Dosya farkli butcelerle acilir; kamera 600 kare boyunca karonun uzerinden alcaktan gecip yukselir
+ * * (kare basina 4 ms bekleme, I/O is parcacigi fe_cond_wait ile uyanir). Her karenin sonunda o karede istenen
+ * * okumalar fe_gv_stream_wait_loads ile beklenir: soguk onbellekte diskin hizi ne olursa olsun kesit ayni
+ * * karelerde tamamlanir, kontroller zamanlamaya baglanmaz. Her butce icin isabet/iska,
+ * * yukleme gecikmesi (ortalama, p50, p95, en buyuk) ve kare guncelleme suresi raporlanir. Kontroller:
+ * * 1. Hicbir okuma basarisiz olmaz ve yerlesik kumelerin ucgenleri DAG'dakiyle bayt bayt aynidir; hicbir kesit
+ * *    fe_gv_stream_max_cut_clusters sinirini asmaz (sahne Cluster SSBO'yu bu boyutta ayirir).
+ * * 2. Dosyanin tamami sigiyorsa: isabet >= %95, karelerin >= %90'inda kesit eksiksizdir ve
+ * *    kamera durduktan sonra kesit 100 kare icinde tamamlanir.
+ * * Herhangi biri tutmazsa 1 ile cikar.
+ *
+ * Derleme (depo kokunden):
+ *   gcc -O2 -std=c11 -D_GNU_SOURCE -Iinclude tests/graphics/geometryv/fe_gv_stream_test.c \
+ *       src/graphics/geometryv/fe_gv_stream.c src/graphics/geometryv/fe_gv_lod.c \
+ *       src/graphics/geometryv/fe_gv_cluster_builder.c src/math/fe_hash.c src/math/fe_vector.c \
+ *       src/platform/fe_job_system.c src/platform/fe_thread.c src/platform/fe_unix_io.c src/utils/fe_timer.c \
+ *       src/utils/fe_logger.c src/error/fe_error.c src/memory/fe_memory_manager.c \
+ *       src/memory/fe_allocator_linear.c src/memory/fe_allocator_pool.c \
+ *       src/memory/fe_allocator_size_class.c -lm -lpthread -o fe_gv_stream_test
+ *   ./fe_gv_stream_test [akis_dosyasi]
+ */
+
+#include "graphics/geometryv/fe_gv_stream.h"
+#include "graphics/geometryv/fe_gv_cluster_builder.h"
+#include "memory/fe_memory_manager.h"
+#include "platform/fe_job_system.h"
+#include "utils/fe_logger.h"
+#include "utils/fe_timer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#define FE_GV_STREAM_TEST_QUADS 708      // 708x708 dortgen = 1002528 ucgen
+#define FE_GV_STREAM_TEST_TILE_SIZE 400.0f
+#define FE_GV_STREAM_TEST_FRAMES 600
+#define FE_GV_STREAM_TEST_SETTLE_FRAMES 100
+#define FE_GV_STREAM_TEST_FRAME_SLEEP_US 4000
+#define FE_GV_STREAM_TEST_CHECK_EVERY 50
+
+static double fe_gv_stream_test_now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e3 + (double)ts.tv_nsec * 1e-6;
+}
+
+static float fe_gv_stream_test_height(float x, float z) {
+    return 3.0f * sinf(x * 0.05f) * cosf(z * 0.043f) + 1.2f * sinf(x * 0.21f + 1.0f) * sinf(z * 0.17f) +
+           0.3f * sinf(x * 1.3f) * cosf(z * 1.1f) + 0.08f * sinf(x * 5.1f + z * 4.3f);
+}
+
+/**
+ * @brief n x n dortgenlik yukseklik alani karosu (CPU verisi dolu, GPU kaynagi yok).
+ */
+static fe_mesh_t* fe_gv_stream_test_terrain(uint32_t n, float size) {
+    fe_mesh_t* mesh = (fe_mesh_t*)calloc(1, sizeof(fe_mesh_t));
+    if (!mesh) return NULL;
+    mesh->vertex_count = (n + 1) * (n + 1);
+    mesh->index_count = n * n * 6;
+    mesh->vertices = (fe_vertex_t*)calloc(mesh->vertex_count, sizeof(fe_vertex_t));
+    mesh->indices = (uint32_t*)malloc(sizeof(uint32_t) * mesh->index_count);
+    if (!mesh->vertices || !mesh->indices) return mesh;
+
+    for (uint32_t i = 0; i <= n; ++i) {
+        for (uint32_t j = 0; j <= n; ++j) {
+            float* p = mesh->vertices[i * (n + 1) + j].position;
+            p[0] = size * (float)j / (float)n;
+            p[2] = size * (float)i / (float)n;
+            p[1] = fe_gv_stream_test_height(p[0], p[2]);
+        }
+    }
+    uint32_t k = 0;
+    for (uint32_t i = 0; i < n; ++i) {
+        for (uint32_t j = 0; j < n; ++j) {
+            uint32_t a = i * (n + 1) + j, b = a + 1, c = a + n + 1, d = c + 1;
+            mesh->indices[k++] = a; mesh->indices[k++] = c; mesh->indices[k++] = b;
+            mesh->indices[k++] = b; mesh->indices[k++] = c; mesh->indices[k++] = d;
+        }
+    }
+    return mesh;
+}
+
+/**
+ * @brief Betikli kamera: karo boyunca alcaktan kivrilarak gecer, son %30'da yukselir.
+ */
+static fe_camera3d_t fe_gv_stream_test_camera(int frame) {
+    fe_camera3d_t camera;
+    memset(&camera, 0, sizeof(camera));
+    float t = (float)frame / (float)FE_GV_STREAM_TEST_FRAMES;
+    float climb = t > 0.7f ? (t - 0.7f) * 600.0f : 0.0f;
+    camera.position = (fe_vec3_t){{FE_GV_STREAM_TEST_TILE_SIZE * (0.05f + 0.9f * t), 6.0f + climb,
+                                   FE_GV_STREAM_TEST_TILE_SIZE * (0.5f + 0.35f * sinf(t * 9.42478f))}};
+    camera.fov_y = 1.0f;
+    camera.near_plane = 0.1f;
+    camera.far_plane = 1e5f;
+    return camera;
+}
+
+static void fe_gv_stream_test_upload(void* user_data, uint32_t slot, const fe_gpu_triangle_t* triangles, uint32_t triangle_count) {
+    (void)slot;
+    (void)triangles;
+    *(uint64_t*)user_data += triangle_count;
+}
+
+/**
+ * @brief Kesitteki kumelerin yerlesik ucgenlerini DAG'la karsilastirir; uyusmayan kume sayisini dondurur.
+ */
+static uint32_t fe_gv_stream_test_verify(const fe_gv_stream_t* stream, const fe_gv_lod_dag_t* dag, uint32_t* checked) {
+    uint32_t bad = 0;
+    for (uint32_t i = 0; i < stream->selection.cluster_count; ++i) {
+        uint32_t cluster = stream->selection.clusters[i];
+        const fe_gv_cluster_t* expected = &dag->geometry.clusters[cluster];
+        const fe_gpu_triangle_t* triangles = fe_gv_stream_cluster_triangles(stream, cluster);
+        (*checked)++;
+        if (!triangles || memcmp(triangles, dag->geometry.triangles + expected->first_triangle_idx,
+                                 sizeof(fe_gpu_triangle_t) * expected->triangle_count) != 0) {
+            bad++;
+        }
+    }
+    return bad;
+}
+
+int main(int argc, char** argv) {
+    const char* path = (argc > 1) ? argv[1] : "fe_gv_stream_test.fgvs";
+    static const uint64_t budgets_mb[] = {32, 64, 128};
+    const fe_gv_lod_settings_t settings = {1.0f, 1080.0f, NULL};
+    int result = 0;
+
+    fe_logger_set_level(FE_LOG_LEVEL_WARN);
+    fe_memory_manager_init();
+    fe_timer_system_init();
+    fe_job_system_init(0);
+
+    // 1. Cevrimdisi adim: kumeleme, DAG, akis dosyasi
+    fe_mesh_t* mesh = fe_gv_stream_test_terrain(FE_GV_STREAM_TEST_QUADS, FE_GV_STREAM_TEST_TILE_SIZE);
+    const fe_mesh_t* meshes[1] = {mesh};
+    fe_gv_cluster_geometry_t base;
+    fe_gv_lod_dag_t dag;
+    if (!mesh || !mesh->indices || !fe_gv_cluster_build(meshes, 1, &base) || !fe_gv_lod_build(&base, &dag)) {
+        printf("BASARISIZ: DAG insasi\n");
+        return 1;
+    }
+    if (!fe_gv_stream_write(&dag, path)) {
+        printf("BASARISIZ: akis dosyasi yazilamadi: %s\n", path);
+        return 1;
+    }
+    int fd = open(path, O_RDONLY);
+    double file_mb = fd >= 0 ? (double)lseek(fd, 0, SEEK_END) / 1048576.0 : 0.0;
+    printf("DAG: %u -> %u ucgen, %u kume, %u seviye; dosya %.1f MB\n", base.triangle_count, dag.geometry.triangle_count,
+           dag.geometry.cluster_count, dag.level_count, file_mb);
+
+    // 2. Her butce icin betikli kamera yolu
+    for (size_t b = 0; b < sizeof(budgets_mb) / sizeof(budgets_mb[0]); ++b) {
+        if (fd >= 0) posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED); // Soguk isletim sistemi onbellegi
+
+        uint64_t uploaded = 0;
+        fe_gv_stream_t* stream = fe_gv_stream_open(path, budgets_mb[b] << 20, fe_gv_stream_test_upload, &uploaded);
+        if (!stream) {
+            printf("BASARISIZ: akis acilamadi (%llu MB)\n", (unsigned long long)budgets_mb[b]);
+            result = 1;
+            continue;
+        }
+
+        double update_sum = 0.0, update_max = 0.0;
+        uint32_t complete_frames = 0, bad = 0, checked = 0, largest_cut = 0;
+        uint32_t max_cut = fe_gv_stream_max_cut_clusters(stream);
+        for (int f = 0; f < FE_GV_STREAM_TEST_FRAMES; ++f) {
+            fe_camera3d_t camera = fe_gv_stream_test_camera(f);
+            double t0 = fe_gv_stream_test_now_ms();
+            fe_gv_stream_update(stream, &camera, &settings);
+            double elapsed = fe_gv_stream_test_now_ms() - t0;
+            update_sum += elapsed;
+            if (elapsed > update_max) update_max = elapsed;
+            if (stream->selection.missing_count == 0) complete_frames++;
+            if (stream->selection.cluster_count > largest_cut) largest_cut = stream->selection.cluster_count;
+            if (f % FE_GV_STREAM_TEST_CHECK_EVERY == 0) bad += fe_gv_stream_test_verify(stream, &dag, &checked);
+            usleep(FE_GV_STREAM_TEST_FRAME_SLEEP_US);
+            fe_gv_stream_wait_loads(stream);
+        }
+
+        // Kamera son konumunda durur; eksik sayfalar gelene kadar beklenir
+        fe_camera3d_t still = fe_gv_stream_test_camera(FE_GV_STREAM_TEST_FRAMES - 1);
+        int settle = 0;
+        while (settle < FE_GV_STREAM_TEST_SETTLE_FRAMES) {
+            fe_gv_stream_update(stream, &still, &settings);
+            if (stream->selection.missing_count == 0) break;
+            usleep(FE_GV_STREAM_TEST_FRAME_SLEEP_US);
+            fe_gv_stream_wait_loads(stream);
+            settle++;
+        }
+        bad += fe_gv_stream_test_verify(stream, &dag, &checked);
+
+        const fe_gv_stream_stats_t* stats = &stream->stats;
+        uint64_t lookups = stats->page_hits + stats->page_misses;
+        double hit_rate = lookups > 0 ? (double)stats->page_hits / (double)lookups : 0.0;
+        uint64_t loads = stats->loads_completed > 0 ? stats->loads_completed : 1;
+        bool fits = (double)budgets_mb[b] >= file_mb;
+        printf("butce %3llu MB (%u yuva): isabet %%%.2f (%llu), iska %llu, yukleme %llu, atilan %llu, okunan %.0f MB\n",
+               (unsigned long long)budgets_mb[b], stream->slot_count, 100.0 * hit_rate,
+               (unsigned long long)stats->page_hits, (unsigned long long)stats->page_misses,
+               (unsigned long long)stats->loads_completed, (unsigned long long)stats->evictions,
+               (double)stats->bytes_read / 1048576.0);
+        printf("    gecikme ort %.2f p50<=%.2f p95<=%.2f en buyuk %.2f ms; guncelleme ort %.3f en buyuk %.2f ms\n",
+               stats->latency_sum_ms / (double)loads, fe_gv_stream_latency_percentile(stats, 0.5),
+               fe_gv_stream_latency_percentile(stats, 0.95), stats->latency_max_ms,
+               update_sum / FE_GV_STREAM_TEST_FRAMES, update_max);
+        printf("    eksiksiz kare %u/%d, durduktan sonra %s (%d kare), kontrol %u/%u hatali\n", complete_frames,
+               FE_GV_STREAM_TEST_FRAMES, settle < FE_GV_STREAM_TEST_SETTLE_FRAMES ? "tamamlandi" : "tamamlanmadi",
+               settle, bad, checked);
+        printf("    en buyuk kesit %u kume (sinir %u)\n", largest_cut, max_cut);
+
+        if (stats->load_failures > 0 || bad > 0) {
+            printf("BASARISIZ: okuma hatasi veya bozuk yerlesik veri\n");
+            result = 1;
+        }
+        if (largest_cut > max_cut) {
+            printf("BASARISIZ: kesit fe_gv_stream_max_cut_clusters sinirini asti\n");
+            result = 1;
+        }
+        if (fits && (hit_rate < 0.95 || complete_frames < FE_GV_STREAM_TEST_FRAMES * 9 / 10 ||
+                     settle >= FE_GV_STREAM_TEST_SETTLE_FRAMES)) {
+            printf("BASARISIZ: dosya sigdigi halde kesit yetismiyor\n");
+            result = 1;
+        }
+        fe_gv_stream_close(stream);
+    }
+    if (result == 0) printf("GECTI\n");
+
+    if (fd >= 0) close(fd);
+    remove(path);
+    fe_gv_lod_dag_free(&dag);
+    fe_gv_cluster_geometry_free(&base);
+    free(mesh->vertices);
+    free(mesh->indices);
+    free(mesh);
+    fe_job_system_shutdown();
+    fe_memory_manager_shutdown();
+    return result;
+}
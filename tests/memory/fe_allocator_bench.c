@@ -0,0 +1,143 @@
+// tests/memory/fe_allocator_bench.c
+
+/**
+ * @brief Boyut sinifli genel ayirici (fe_mem_alloc/fe_mem_free) icin bagimsiz kiyaslama.
+ * * 1, 4 ve 16 is parcacigi icin saniyedeki tahsis+serbest birakma islemini, libc malloc/free ile
+ * * karsilastirmali basar. Her is parcacigi 256 canli yuva uzerinde rastgele 1 B - 4 KB tahsis/serbest
+ * * birakma yapar.
+ * * Her blok sahibinin imzasiyla doldurulur ve serbest birakilmadan once kontrol edilir; iki is
+ * * parcacigina ayni blok verilirse veya bloklar ortusurse imza bozulur ve 1 ile cikar.
+ * * Mantiksal cekirdekten fazla is parcacigi olan satirlar isaretlenir (olcum paralel olceklemeyi
+ * * degil, is parcacigi basina maliyet ve cekisme ek yukunu gosterir).
+ *
+ * Derleme (depo kokunden):
+ *   gcc -O2 -std=c11 -D_GNU_SOURCE -Iinclude tests/memory/fe_allocator_bench.c \
+ *       src/memory/fe_memory_manager.c src/memory/fe_allocator_linear.c src/memory/fe_allocator_pool.c \
+ *       src/memory/fe_allocator_size_class.c src/platform/fe_thread.c src/utils/fe_logger.c \
+ *       src/error/fe_error.c -lpthread -o fe_allocator_bench
+ *   ./fe_allocator_bench
+ */
+
+#include "memory/fe_memory_manager.h"
+#include "platform/fe_thread.h"
+#include "utils/fe_logger.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define FE_ALLOC_BENCH_SLOTS 256
+#define FE_ALLOC_BENCH_OPS_PER_THREAD 2000000
+#define FE_ALLOC_BENCH_MAX_SIZE 4096
+#define FE_ALLOC_BENCH_MAX_THREADS 16
+
+typedef struct fe_alloc_bench_worker {
+    bool use_fe_mem;
+    uint32_t seed;
+    uint32_t corrupted;
+    fe_thread_t thread;
+} fe_alloc_bench_worker_t;
+
+static double fe_alloc_bench_now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e3 + (double)ts.tv_nsec * 1e-6;
+}
+
+static inline uint32_t fe_alloc_bench_rand(uint32_t* state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+/**
+ * @brief Blogun ilk ve son baytinin sahibin imzasini tasidigini kontrol eder.
+ */
+static inline bool fe_alloc_bench_check(const uint8_t* block, size_t size, uint8_t tag) {
+    return block[0] == tag && block[size - 1] == tag;
+}
+
+static void* fe_alloc_bench_thread(void* arg) {
+    fe_alloc_bench_worker_t* worker = (fe_alloc_bench_worker_t*)arg;
+    uint8_t* blocks[FE_ALLOC_BENCH_SLOTS] = {0};
+    size_t sizes[FE_ALLOC_BENCH_SLOTS] = {0};
+    uint32_t state = worker->seed;
+    uint8_t tag = (uint8_t)(worker->seed * 31u + 7u);
+
+    for (uint32_t op = 0; op < FE_ALLOC_BENCH_OPS_PER_THREAD; ++op) {
+        uint32_t r = fe_alloc_bench_rand(&state);
+        uint32_t slot = r % FE_ALLOC_BENCH_SLOTS;
+        if (blocks[slot]) {
+            if (!fe_alloc_bench_check(blocks[slot], sizes[slot], tag)) worker->corrupted++;
+            if (worker->use_fe_mem) fe_mem_free(blocks[slot]); else free(blocks[slot]);
+            blocks[slot] = NULL;
+        } else {
+            size_t size = 1 + (fe_alloc_bench_rand(&state) % FE_ALLOC_BENCH_MAX_SIZE);
+            uint8_t* block = (uint8_t*)(worker->use_fe_mem ? fe_mem_alloc(size) : malloc(size));
+            if (!block) { worker->corrupted++; continue; }
+            block[0] = tag;
+            block[size - 1] = tag;
+            blocks[slot] = block;
+            sizes[slot] = size;
+        }
+    }
+
+    for (uint32_t slot = 0; slot < FE_ALLOC_BENCH_SLOTS; ++slot) {
+        if (!blocks[slot]) continue;
+        if (!fe_alloc_bench_check(blocks[slot], sizes[slot], tag)) worker->corrupted++;
+        if (worker->use_fe_mem) fe_mem_free(blocks[slot]); else free(blocks[slot]);
+    }
+    if (worker->use_fe_mem) fe_mem_thread_shutdown();
+    return NULL;
+}
+
+/**
+ * @brief thread_count is parcacigini calistirir ve toplam milyon islem/saniye dondurur.
+ */
+static double fe_alloc_bench_run(uint32_t thread_count, bool use_fe_mem, uint32_t* out_corrupted) {
+    fe_alloc_bench_worker_t workers[FE_ALLOC_BENCH_MAX_THREADS];
+    double start = fe_alloc_bench_now_ms();
+    for (uint32_t t = 0; t < thread_count; ++t) {
+        workers[t] = (fe_alloc_bench_worker_t){ .use_fe_mem = use_fe_mem, .seed = 0x9E3779B9u * (t + 1) };
+        if (fe_thread_create(&workers[t].thread, fe_alloc_bench_thread, &workers[t]) != FE_OK) {
+            fprintf(stderr, "is parcacigi olusturulamadi\n");
+            exit(1);
+        }
+    }
+    for (uint32_t t = 0; t < thread_count; ++t) {
+        fe_thread_join(&workers[t].thread);
+        *out_corrupted += workers[t].corrupted;
+    }
+    double elapsed_ms = fe_alloc_bench_now_ms() - start;
+    return (double)thread_count * FE_ALLOC_BENCH_OPS_PER_THREAD / (elapsed_ms * 1e3);
+}
+
+int main(void) {
+    static const uint32_t thread_counts[] = {1, 4, 16};
+    uint32_t cpu_count = fe_thread_get_cpu_count();
+    uint32_t corrupted = 0;
+
+    fe_logger_set_level(FE_LOG_LEVEL_WARN);
+    if (fe_memory_manager_init() != FE_OK) {
+        fprintf(stderr, "bellek yoneticisi baslatilamadi\n");
+        return 1;
+    }
+
+    printf("mantiksal cekirdek: %u\n", cpu_count);
+    printf("is parcacigi   fe_mem M islem/s   malloc M islem/s\n");
+    for (size_t t = 0; t < sizeof(thread_counts) / sizeof(thread_counts[0]); ++t) {
+        double fe_mem = fe_alloc_bench_run(thread_counts[t], true, &corrupted);
+        double libc = fe_alloc_bench_run(thread_counts[t], false, &corrupted);
+        printf("  %10u   %16.1f   %16.1f%s\n", thread_counts[t], fe_mem, libc,
+               thread_counts[t] > cpu_count ? "  (cekirdekten fazla)" : "");
+    }
+
+    fe_memory_manager_shutdown();
+    if (corrupted) {
+        printf("BASARISIZ: %u blok bozuk veya tahsis edilemedi\n", corrupted);
+        return 1;
+    }
+    printf("GECTI\n");
+    return 0;
+}
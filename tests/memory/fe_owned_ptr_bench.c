@@ -0,0 +1,196 @@
+// tests/memory/fe_owned_ptr_bench.c
+
+/**
+ * @brief Atomik fe_owned_ptr referans sayaci ve kilitsiz havuz serbest listesi icin cekisme kiyaslamasi.
+ * * 1. 1, 4 ve 16 is parcacigi ayni blogu klonlayip birakir; saniyedeki klon+birakma ciftini basar.
+ * *    Sonunda referans sayaci tekrar 1 olmalidir.
+ * * 2. Ayni is parcacigi sayilariyla karisik tahsis/klon/birakma stresi: her blok sahibinin imzasini
+ * *    tasir ve birakilmadan once kontrol edilir. Sonunda havuz tamamen bosalmali ve serbest listede
+ * *    tum bloklar bulunmalidir.
+ * * Herhangi bir kontrol tutmazsa 1 ile cikar. Mantiksal cekirdekten fazla is parcacigi olan satirlar
+ * * isaretlenir (olcum cekirdekler arasi onbellek trafigini degil, ek yuku gosterir).
+ * * -DNDEBUG ile derlenmelidir: aksi halde FE_LOG_TRACE cagrilari derlenir ve olcumu belirler.
+ *
+ * Derleme (depo kokunden):
+ *   gcc -O2 -std=c11 -D_GNU_SOURCE -DNDEBUG -Iinclude tests/memory/fe_owned_ptr_bench.c \
+ *       src/memory/fe_allocator_pool.c src/platform/fe_thread.c src/utils/fe_logger.c \
+ *       src/error/fe_error.c src/memory/fe_memory_manager.c src/memory/fe_allocator_linear.c \
+ *       src/memory/fe_allocator_size_class.c -lpthread -o fe_owned_ptr_bench
+ *   ./fe_owned_ptr_bench
+ */
+
+#include "memory/fe_allocator_pool.h"
+#include "platform/fe_thread.h"
+#include "utils/fe_logger.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define FE_OWNED_BENCH_MAX_THREADS 16
+#define FE_OWNED_BENCH_SHARED_PAIRS 4000000
+#define FE_OWNED_BENCH_STRESS_OPS 1000000
+#define FE_OWNED_BENCH_STRESS_SLOTS 64
+#define FE_OWNED_BENCH_BLOCK_COUNT 4096
+#define FE_OWNED_BENCH_CHUNK_SIZE 64
+
+typedef struct fe_owned_bench_worker {
+    fe_allocator_pool_t* pool;
+    fe_owned_ptr_t shared;
+    uint32_t seed;
+    uint32_t errors;
+    fe_thread_t thread;
+} fe_owned_bench_worker_t;
+
+static double fe_owned_bench_now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e3 + (double)ts.tv_nsec * 1e-6;
+}
+
+static inline uint32_t fe_owned_bench_rand(uint32_t* state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+/**
+ * @brief Paylasilan blogu klonlar ve birakir.
+ */
+static void* fe_owned_bench_shared_thread(void* arg) {
+    fe_owned_bench_worker_t* worker = (fe_owned_bench_worker_t*)arg;
+    for (uint32_t i = 0; i < FE_OWNED_BENCH_SHARED_PAIRS; ++i) {
+        fe_owned_ptr_t copy = fe_owned_ptr_clone(&worker->shared);
+        if (copy.data != worker->shared.data) worker->errors++;
+        fe_owned_ptr_release(copy);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Rastgele yuvalarda tahsis, klon ve birakma yapar; her blok sahibin imzasini tasir.
+ */
+static void* fe_owned_bench_stress_thread(void* arg) {
+    fe_owned_bench_worker_t* worker = (fe_owned_bench_worker_t*)arg;
+    fe_owned_ptr_t slots[FE_OWNED_BENCH_STRESS_SLOTS] = {0};
+    uint32_t state = worker->seed;
+
+    for (uint32_t op = 0; op < FE_OWNED_BENCH_STRESS_OPS; ++op) {
+        uint32_t r = fe_owned_bench_rand(&state);
+        fe_owned_ptr_t* slot = &slots[r % FE_OWNED_BENCH_STRESS_SLOTS];
+        if (slot->data) {
+            if (*(uint32_t*)slot->data != worker->seed) worker->errors++;
+            if (r & 0x100) {
+                // Klon + iki birakma: blok ancak ikincisinde havuza doner
+                fe_owned_ptr_t copy = fe_owned_ptr_clone(slot);
+                fe_owned_ptr_release(*slot);
+                if (*(uint32_t*)copy.data != worker->seed) worker->errors++;
+                fe_owned_ptr_release(copy);
+            } else {
+                fe_owned_ptr_release(*slot);
+            }
+            slot->data = NULL;
+        } else {
+            *slot = fe_pool_allocate(worker->pool);
+            if (slot->data) *(uint32_t*)slot->data = worker->seed;
+        }
+    }
+    for (uint32_t s = 0; s < FE_OWNED_BENCH_STRESS_SLOTS; ++s) {
+        if (slots[s].data) fe_owned_ptr_release(slots[s]);
+    }
+    return NULL;
+}
+
+/**
+ * @brief thread_count is parcacigini calistirir ve toplam milyon islem/saniye dondurur.
+ */
+static double fe_owned_bench_run(uint32_t thread_count, fe_thread_func_t func, fe_allocator_pool_t* pool,
+                                 fe_owned_ptr_t shared, uint32_t ops_per_thread, uint32_t* out_errors) {
+    fe_owned_bench_worker_t workers[FE_OWNED_BENCH_MAX_THREADS];
+    double start = fe_owned_bench_now_ms();
+    for (uint32_t t = 0; t < thread_count; ++t) {
+        workers[t] = (fe_owned_bench_worker_t){ .pool = pool, .shared = shared, .seed = 0x9E3779B9u * (t + 1) };
+        if (fe_thread_create(&workers[t].thread, func, &workers[t]) != FE_OK) {
+            fprintf(stderr, "is parcacigi olusturulamadi\n");
+            exit(1);
+        }
+    }
+    for (uint32_t t = 0; t < thread_count; ++t) {
+        fe_thread_join(&workers[t].thread);
+        *out_errors += workers[t].errors;
+    }
+    double elapsed_ms = fe_owned_bench_now_ms() - start;
+    return (double)thread_count * ops_per_thread / (elapsed_ms * 1e3);
+}
+
+/**
+ * @brief Serbest listedeki blok sayisini sayar (yalnizca tek is parcacigindan, sessiz durumda).
+ */
+static size_t fe_owned_bench_free_blocks(fe_allocator_pool_t* pool) {
+    size_t count = 0;
+    fe_owned_ptr_t* taken = (fe_owned_ptr_t*)malloc((pool->block_count + 1) * sizeof(fe_owned_ptr_t));
+    while (count <= pool->block_count) {
+        fe_owned_ptr_t p = fe_pool_allocate(pool);
+        if (!p.data) break;
+        taken[count++] = p;
+    }
+    for (size_t i = 0; i < count; ++i) fe_owned_ptr_release(taken[i]);
+    free(taken);
+    return count;
+}
+
+int main(void) {
+    static const uint32_t thread_counts[] = {1, 4, 16};
+    uint32_t cpu_count = fe_thread_get_cpu_count();
+    uint32_t errors = 0;
+    int result = 0;
+
+    fe_logger_set_level(FE_LOG_LEVEL_WARN);
+    fe_allocator_pool_t pool;
+    if (fe_pool_init(&pool, FE_OWNED_BENCH_BLOCK_COUNT * (FE_OWNED_BENCH_CHUNK_SIZE + sizeof(fe_block_metadata_t)),
+                     FE_OWNED_BENCH_CHUNK_SIZE, NULL) != FE_OK) {
+        fprintf(stderr, "havuz baslatilamadi\n");
+        return 1;
+    }
+    size_t block_count = pool.block_count;
+
+    printf("mantiksal cekirdek: %u, havuz blogu: %zu\n", cpu_count, block_count);
+    printf("is parcacigi   paylasilan klon+birakma M cift/s   karisik stres M islem/s\n");
+    for (size_t t = 0; t < sizeof(thread_counts) / sizeof(thread_counts[0]); ++t) {
+        uint32_t threads = thread_counts[t];
+
+        fe_owned_ptr_t shared = fe_pool_allocate(&pool);
+        double shared_rate = fe_owned_bench_run(threads, fe_owned_bench_shared_thread, &pool, shared,
+                                                FE_OWNED_BENCH_SHARED_PAIRS, &errors);
+        uint32_t final_count = fe_atomic_load_u32(&shared.metadata->ref_count);
+        if (final_count != 1) {
+            printf("BASARISIZ: %u is parcacigindan sonra referans sayaci %u (beklenen 1)\n", threads, final_count);
+            result = 1;
+        }
+        fe_owned_ptr_release(shared);
+
+        double stress_rate = fe_owned_bench_run(threads, fe_owned_bench_stress_thread, &pool, shared,
+                                                FE_OWNED_BENCH_STRESS_OPS, &errors);
+        size_t allocated = (size_t)fe_atomic_load_u64(&pool.allocated_count);
+        size_t free_blocks = fe_owned_bench_free_blocks(&pool);
+        if (allocated != 0 || free_blocks != block_count) {
+            printf("BASARISIZ: %u is parcacigindan sonra tahsisli %zu, serbest %zu / %zu\n",
+                   threads, allocated, free_blocks, block_count);
+            result = 1;
+        }
+
+        printf("  %10u   %33.1f   %23.1f%s\n", threads, shared_rate, stress_rate,
+               threads > cpu_count ? "  (cekirdekten fazla)" : "");
+    }
+
+    fe_pool_destroy(&pool);
+    if (errors) {
+        printf("BASARISIZ: %u bozuk blok veya yanlis klon\n", errors);
+        result = 1;
+    }
+    if (result == 0) {
+        printf("GECTI\n");
+    }
+    return result;
+}
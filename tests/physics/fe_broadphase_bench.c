@@ -0,0 +1,219 @@
+// tests/physics/fe_broadphase_bench.c
+
+/**
+ * @brief Dinamik AABB agaci broadphase'i icin bagimsiz kiyaslama.
+ * * Sahne: 1k, 10k ve 50k kure (r = 0.25-0.75 m), 60x60x60 m kutu icinde rastgele hizlarla (0-8 m/s)
+ * * hareket eder ve duvarlardan seker; 60 Hz sabit adim.
+ * * Her boyut icin iki durum olculur: tum cisimler hareketli ve yalnizca %10'u hareketli.
+ * * 1. Adim basina ortalama/ortanca/p95 ms (tum move_proxy cagrilari + fe_broadphase_update_pairs),
+ * *    yeniden eklenen vekil sayisi ve aday cift sayisini basar. Cisimlerin kutulari olcumun disinda hesaplanir.
+ * * 2. Son adimdan sonra cift listesi kaba kuvvet (n^2) ile bulunan, sisman kutulari kesisen ciftlerle
+ * *    birebir ayni olmali; her cift bir kez ve proxy_a < proxy_b ile listelenmeli.
+ * * 3. Tum cisimleri hareketli 10k sahnenin ortalamasi FE_BP_BENCH_BUDGET_MS'yi (1 ms) asmamali. Bu durum
+ * *    FE_BP_BENCH_BUDGET_REPEATS kez olculur ve en dusuk ortalama alinir (paylasimli makinedeki
+ * *    zamanlayici gurultusu olcumu yalnizca buyutur).
+ * * Kontrollerden biri tutmazsa 1 ile cikar.
+ *
+ * Derleme (depo kokunden):
+ *   gcc -O2 -std=c11 -D_GNU_SOURCE -Iinclude tests/physics/fe_broadphase_bench.c src/physics/fe_broadphase.c \
+ *       src/math/fe_vector.c src/platform/fe_thread.c src/utils/fe_logger.c src/error/fe_error.c \
+ *       src/memory/fe_memory_manager.c src/memory/fe_allocator_linear.c src/memory/fe_allocator_pool.c \
+ *       src/memory/fe_allocator_size_class.c -lm -lpthread -o fe_broadphase_bench
+ *   ./fe_broadphase_bench
+ */
+
+#include "physics/fe_broadphase.h"
+#include "memory/fe_memory_manager.h"
+#include "utils/fe_logger.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define FE_BP_BENCH_WARMUP_STEPS 30
+#define FE_BP_BENCH_TIMED_STEPS 120
+#define FE_BP_BENCH_WORLD_HALF 30.0f
+#define FE_BP_BENCH_MAX_SPEED 8.0f
+#define FE_BP_BENCH_DT (1.0f / 60.0f)
+#define FE_BP_BENCH_BUDGET_MS 1.0
+#define FE_BP_BENCH_BUDGET_REPEATS 3
+
+typedef struct fe_bp_bench_body {
+    fe_vec3_t position;
+    fe_vec3_t velocity;
+    float radius;
+    uint32_t proxy;
+} fe_bp_bench_body_t;
+
+static double fe_bp_bench_now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e3 + (double)ts.tv_nsec * 1e-6;
+}
+
+static inline float fe_bp_bench_randf(uint32_t* state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return (float)(*state >> 8) * (1.0f / 16777216.0f);
+}
+
+static int fe_bp_bench_compare(const void* a, const void* b) {
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+static fe_aabb_t fe_bp_bench_body_aabb(const fe_bp_bench_body_t* body) {
+    fe_vec3_t extent = {{body->radius, body->radius, body->radius}};
+    return (fe_aabb_t){ fe_vec3_subtract(body->position, extent), fe_vec3_add(body->position, extent) };
+}
+
+/**
+ * @brief Cismi bir adim ilerletir ve dunya kutusunun duvarlarindan sektirir.
+ */
+static void fe_bp_bench_advance(fe_bp_bench_body_t* body) {
+    for (int axis = 0; axis < 3; ++axis) {
+        float limit = FE_BP_BENCH_WORLD_HALF - body->radius;
+        body->position.v[axis] += body->velocity.v[axis] * FE_BP_BENCH_DT;
+        if (body->position.v[axis] > limit || body->position.v[axis] < -limit) {
+            body->position.v[axis] = body->position.v[axis] > 0.0f ? limit : -limit;
+            body->velocity.v[axis] = -body->velocity.v[axis];
+        }
+    }
+}
+
+/**
+ * @brief Cift listesini kaba kuvvetle bulunan kesisen sisman kutu ciftleriyle karsilastirir.
+ */
+static bool fe_bp_bench_verify(const fe_broadphase_t* bp, const fe_bp_bench_body_t* bodies, uint32_t count) {
+    uint32_t pair_count = 0;
+    const fe_broadphase_pair_t* pairs = fe_broadphase_get_pairs(bp, &pair_count);
+
+    for (uint32_t i = 0; i < pair_count; ++i) {
+        if (pairs[i].proxy_a >= pairs[i].proxy_b ||
+            !fe_aabb_overlaps(fe_broadphase_get_fat_aabb(bp, pairs[i].proxy_a),
+                              fe_broadphase_get_fat_aabb(bp, pairs[i].proxy_b))) {
+            printf("  BASARISIZ: gecersiz cift (%u, %u)\n", pairs[i].proxy_a, pairs[i].proxy_b);
+            return false;
+        }
+    }
+
+    uint64_t expected = 0;
+    for (uint32_t i = 0; i < count; ++i) {
+        const fe_aabb_t* a = fe_broadphase_get_fat_aabb(bp, bodies[i].proxy);
+        for (uint32_t j = i + 1; j < count; ++j) {
+            if (fe_aabb_overlaps(a, fe_broadphase_get_fat_aabb(bp, bodies[j].proxy))) ++expected;
+        }
+    }
+    // Listelenen her cift gecerli ve kesisen ciftler kadar cift var: kayip ve tekrar yok
+    if (expected != pair_count) {
+        printf("  BASARISIZ: %u aday cift, kaba kuvvet %llu\n", pair_count, (unsigned long long)expected);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief count cisimlik sahneyi kurar, isitir ve olcer.
+ * @param moving_fraction Her adimda hareket eden cisimlerin orani (geri kalanlar duruyor).
+ */
+static bool fe_bp_bench_run(uint32_t count, float moving_fraction, double* out_mean, double* out_median, double* out_p95,
+                            double* out_reinserted, double* out_pairs) {
+    fe_bp_bench_body_t* bodies = (fe_bp_bench_body_t*)malloc(sizeof(fe_bp_bench_body_t) * count);
+    fe_aabb_t* aabbs = (fe_aabb_t*)malloc(sizeof(fe_aabb_t) * count);
+    fe_vec3_t* displacements = (fe_vec3_t*)malloc(sizeof(fe_vec3_t) * count);
+    double samples[FE_BP_BENCH_TIMED_STEPS];
+    uint32_t state = 0x2545F491u ^ count;
+    uint32_t moving = (uint32_t)((float)count * moving_fraction);
+    fe_broadphase_t bp;
+    fe_broadphase_init(&bp);
+
+    for (uint32_t i = 0; i < count; ++i) {
+        fe_bp_bench_body_t* body = &bodies[i];
+        body->radius = 0.25f + 0.5f * fe_bp_bench_randf(&state);
+        for (int axis = 0; axis < 3; ++axis) {
+            body->position.v[axis] = (fe_bp_bench_randf(&state) * 2.0f - 1.0f) * (FE_BP_BENCH_WORLD_HALF - 1.0f);
+            body->velocity.v[axis] = (fe_bp_bench_randf(&state) * 2.0f - 1.0f) * FE_BP_BENCH_MAX_SPEED * 0.57735f;
+        }
+        fe_aabb_t aabb = fe_bp_bench_body_aabb(body);
+        body->proxy = fe_broadphase_create_proxy(&bp, &aabb, body);
+    }
+    fe_broadphase_update_pairs(&bp);
+
+    uint64_t reinserted = 0, pairs = 0;
+    double total = 0.0;
+    for (int step = 0; step < FE_BP_BENCH_WARMUP_STEPS + FE_BP_BENCH_TIMED_STEPS; ++step) {
+        // Cisim hareketi ve kutularin hesabi broadphase'in maliyeti degildir; olcumun disinda tutulur
+        for (uint32_t i = 0; i < moving; ++i) {
+            fe_bp_bench_advance(&bodies[i]);
+            aabbs[i] = fe_bp_bench_body_aabb(&bodies[i]);
+            displacements[i] = fe_vec3_scale(bodies[i].velocity, FE_BP_BENCH_DT);
+        }
+
+        double start = fe_bp_bench_now_ms();
+        uint32_t moved = 0;
+        for (uint32_t i = 0; i < moving; ++i) {
+            if (fe_broadphase_move_proxy(&bp, bodies[i].proxy, &aabbs[i], displacements[i])) ++moved;
+        }
+        fe_broadphase_update_pairs(&bp);
+        double elapsed = fe_bp_bench_now_ms() - start;
+
+        if (step >= FE_BP_BENCH_WARMUP_STEPS) {
+            samples[step - FE_BP_BENCH_WARMUP_STEPS] = elapsed;
+            total += elapsed;
+            reinserted += moved;
+            pairs += bp.pair_count;
+        }
+    }
+
+    qsort(samples, FE_BP_BENCH_TIMED_STEPS, sizeof(double), fe_bp_bench_compare);
+    *out_mean = total / FE_BP_BENCH_TIMED_STEPS;
+    *out_median = samples[FE_BP_BENCH_TIMED_STEPS / 2];
+    *out_p95 = samples[(FE_BP_BENCH_TIMED_STEPS * 95) / 100];
+    *out_reinserted = (double)reinserted / FE_BP_BENCH_TIMED_STEPS;
+    *out_pairs = (double)pairs / FE_BP_BENCH_TIMED_STEPS;
+
+    bool ok = fe_bp_bench_verify(&bp, bodies, count);
+    fe_broadphase_destroy(&bp);
+    free(displacements);
+    free(aabbs);
+    free(bodies);
+    return ok;
+}
+
+int main(void) {
+    static const uint32_t counts[] = {1000, 10000, 50000};
+    static const float fractions[] = {1.0f, 0.1f};
+    int result = 0;
+
+    fe_logger_set_level(FE_LOG_LEVEL_WARN);
+    fe_memory_manager_init();
+
+    printf("cisim    hareketli   ort ms   ortanca ms   p95 ms   yeniden eklenen/adim   aday cift\n");
+    for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]); ++c) {
+        for (size_t f = 0; f < sizeof(fractions) / sizeof(fractions[0]); ++f) {
+            double mean, median, p95, reinserted, pairs;
+            if (!fe_bp_bench_run(counts[c], fractions[f], &mean, &median, &p95, &reinserted, &pairs)) result = 1;
+            printf("  %6u   %8.0f%%   %6.3f   %10.3f   %6.3f   %20.0f   %9.0f\n", counts[c], fractions[f] * 100.0f,
+                   mean, median, p95, reinserted, pairs);
+        }
+    }
+
+    // 3. Butce: 10k cisim, hepsi hareketli; tekrarlarin en dusuk ortalamasi
+    double budget_mean = 0.0;
+    for (int repeat = 0; repeat < FE_BP_BENCH_BUDGET_REPEATS; ++repeat) {
+        double mean, median, p95, reinserted, pairs;
+        if (!fe_bp_bench_run(10000, 1.0f, &mean, &median, &p95, &reinserted, &pairs)) result = 1;
+        if (repeat == 0 || mean < budget_mean) budget_mean = mean;
+    }
+    printf("10k hareketli cisim: ortalama %.3f ms/adim (hedef %.1f ms)\n", budget_mean, FE_BP_BENCH_BUDGET_MS);
+    if (budget_mean > FE_BP_BENCH_BUDGET_MS) {
+        printf("BASARISIZ: 10k hareketli cisim %.1f ms butcesini asti\n", FE_BP_BENCH_BUDGET_MS);
+        result = 1;
+    }
+    fe_memory_manager_shutdown();
+    if (result == 0) {
+        printf("GECTI\n");
+    }
+    return result;
+}
@@ -0,0 +1,228 @@
+// tests/physics/fe_ccd_test.c
+
+/**
+ * @brief Surekli carpisma (continuous_collision) icin kendini dogrulayan test.
+ * * Sahne: 400 adet 9 mm / 8 g mermi, 30 m ileride 2 cm kalinliginda duvar, 60 Hz sabit adim.
+ * * Kontroller (herhangi biri tutmazsa 1 ile cikar):
+ * * 1. Ayrik (discrete) modda mermiler duvari delip gecer (senaryo gercekten tunel uretir).
+ * * 2. CCD ile duz, 45 derece egik ve 500 kg dinamik duvarda, 60 ve 1000 m/s hizlarda hic mermi gecmez.
+ * * 3. Yavas (0.2 m/s) bayrakli cisimler ayrik yol ile bit bit ayni durumu uretir.
+ * * 4. Her senaryoda CCD'nin ucus adimlarindaki ek maliyeti (ccd - ayrik ms/adim) FE_CCD_TEST_MAX_OVERHEAD_MS'i
+ * *    asmaz. Ayrik adim 1 ms'nin altinda oldugundan oran yerine mutlak fark sinirlanir.
+ * * Ayrica ucus sirasindaki ve 30 adimlik ortalama ms/adim degerlerini, ve 60x60 duran (bayraksiz)
+ * * kutu eklenmis sahnede iki modun arka plan maliyetini basar.
+ *
+ * Derleme (depo kokunden):
+ *   gcc -O2 -std=c11 -D_GNU_SOURCE -Iinclude tests/physics/fe_ccd_test.c \
+ *       src/physics/fe_physics_manager.c src/physics/fe_island.c \
+ *       src/physics/fe_world.c src/physics/fe_rigid_body.c src/physics/fe_collider.c \
+ *       src/physics/fe_broadphase.c src/physics/fe_narrowphase.c src/physics/fe_collision_solver.c \
+ *       src/physics/fe_physical_materials.c src/physics/fe_constraint_solver.c \
+ *       src/physics/fe_physics_constraint_component.c src/data_structures/fe_array.c \
+ *       src/data_structures/fe_hashmap.c src/math/fe_hash.c src/math/fe_vector.c \
+ *       src/math/fe_matrix.c src/platform/fe_job_system.c src/platform/fe_thread.c \
+ *       src/utils/fe_logger.c src/error/fe_error.c src/memory/fe_memory_manager.c \
+ *       src/memory/fe_allocator_linear.c src/memory/fe_allocator_pool.c \
+ *       src/memory/fe_allocator_size_class.c src/utils/fe_timer.c -lm -lpthread -o fe_ccd_test
+ */
+
+#include "physics/fe_physics_manager.h"
+#include "memory/fe_memory_manager.h"
+#include "utils/fe_logger.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#define FE_CCD_TEST_BULLETS 400
+#define FE_CCD_TEST_STEPS 30
+#define FE_CCD_TEST_FLIGHT_STEPS 8
+#define FE_CCD_TEST_BULLET_RADIUS 0.0045f
+#define FE_CCD_TEST_BULLET_MASS 0.008f
+#define FE_CCD_TEST_WALL_HALF_THICKNESS 0.01f
+#define FE_CCD_TEST_WALL_DISTANCE 30.0f
+#define FE_CCD_TEST_BACKGROUND_SIDE 60
+#define FE_CCD_TEST_MAX_OVERHEAD_MS 2.0
+
+typedef enum fe_ccd_test_wall {
+    FE_CCD_TEST_WALL_STATIC = 0,
+    FE_CCD_TEST_WALL_ANGLED,  // Y ekseni etrafinda 45 derece
+    FE_CCD_TEST_WALL_DYNAMIC  // 500 kg, zemine oturmayan serbest duvar
+} fe_ccd_test_wall_t;
+
+typedef struct fe_ccd_test_result {
+    uint32_t tunnelled;      // Duvarin arkasina gecen mermi sayisi
+    float max_penetration;   // Duvarin on yuzunden iceri en derin nokta (m)
+    double flight_ms;        // Ilk FE_CCD_TEST_FLIGHT_STEPS adimin ortalamasi
+    double total_ms;         // Tum adimlarin ortalamasi
+    float positions[FE_CCD_TEST_BULLETS][3];
+    float velocities[FE_CCD_TEST_BULLETS][3];
+} fe_ccd_test_result_t;
+
+static double fe_ccd_test_now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e3 + (double)ts.tv_nsec * 1e-6;
+}
+
+static fe_mat4_t fe_ccd_test_diagonal_inertia(float value) {
+    fe_mat4_t inertia = FE_MAT4_IDENTITY;
+    for (int i = 0; i < 3; ++i) {
+        inertia.mm[i][i] = value;
+    }
+    return inertia;
+}
+
+/**
+ * @brief Sahneyi kurar, FE_CCD_TEST_STEPS adim calistirir ve mermileri duvar duzlemine gore olcer.
+ * @param background_side Mermilerin arkasina dizilen duran kutu izgarasinin kenari (0 = yok).
+ */
+static void fe_ccd_test_run(bool continuous, fe_ccd_test_wall_t wall_mode, float speed, uint32_t background_side,
+                            fe_ccd_test_result_t* out) {
+    fe_physics_manager_init();
+    fe_physics_manager_set_sleeping_enabled(false);
+
+    fe_rigid_body_t* ground = fe_rigid_body_create();
+    ground->collider = fe_collider_create_box((fe_vec3_t){{200.0f, 1.0f, 200.0f}});
+    ground->position = (fe_vec3_t){{0.0f, -1.0f, 0.0f}};
+    fe_rigid_body_set_mass_properties(ground, 0.0f, FE_MAT4_IDENTITY);
+    fe_physics_manager_add_rigid_body(ground);
+
+    float angle = (wall_mode == FE_CCD_TEST_WALL_ANGLED) ? 0.7853982f : 0.0f;
+    bool dynamic = (wall_mode == FE_CCD_TEST_WALL_DYNAMIC);
+    fe_rigid_body_t* wall = fe_rigid_body_create();
+    wall->collider = fe_collider_create_box((fe_vec3_t){{40.0f, dynamic ? 9.0f : 40.0f, FE_CCD_TEST_WALL_HALF_THICKNESS}});
+    wall->position = (fe_vec3_t){{0.0f, dynamic ? 14.0f : 20.0f, FE_CCD_TEST_WALL_DISTANCE}};
+    wall->orientation = (fe_vec4_t){{0.0f, sinf(angle * 0.5f), 0.0f, cosf(angle * 0.5f)}};
+    if (dynamic) {
+        fe_rigid_body_set_mass_properties(wall, 500.0f, fe_ccd_test_diagonal_inertia(5000.0f));
+    } else {
+        fe_rigid_body_set_mass_properties(wall, 0.0f, FE_MAT4_IDENTITY);
+    }
+    fe_physics_manager_add_rigid_body(wall);
+    const fe_vec3_t wall_normal = {{sinf(angle), 0.0f, cosf(angle)}};
+
+    const float box_half = 0.5f;
+    fe_mat4_t box_inertia = fe_ccd_test_diagonal_inertia((8.0f * box_half * box_half) / 12.0f);
+    for (uint32_t x = 0; x < background_side; ++x) {
+        for (uint32_t z = 0; z < background_side; ++z) {
+            fe_rigid_body_t* box = fe_rigid_body_create();
+            box->collider = fe_collider_create_box((fe_vec3_t){{box_half, box_half, box_half}});
+            box->position = (fe_vec3_t){{((float)x - (float)(background_side / 2)) * 1.6f, box_half + 0.01f,
+                                         -20.0f - (float)z * 1.6f}};
+            fe_rigid_body_set_mass_properties(box, 1.0f, box_inertia);
+            fe_physics_manager_add_rigid_body(box);
+        }
+    }
+
+    // Mermiler duvara varmadan once sahnenin oturmasi icin birkac adim
+    for (int i = 0; i < 10; ++i) {
+        fe_physics_manager_step();
+    }
+
+    const float r = FE_CCD_TEST_BULLET_RADIUS;
+    const float m = FE_CCD_TEST_BULLET_MASS;
+    fe_mat4_t bullet_inertia = fe_ccd_test_diagonal_inertia(0.4f * m * r * r);
+    fe_rigid_body_t* bullets[FE_CCD_TEST_BULLETS];
+    const int side = 20; // 20 x 20 = FE_CCD_TEST_BULLETS
+    for (int i = 0; i < FE_CCD_TEST_BULLETS; ++i) {
+        fe_rigid_body_t* b = fe_rigid_body_create();
+        b->collider = fe_collider_create_sphere(r);
+        b->position = (fe_vec3_t){{(float)(i % side - side / 2) * 0.25f + 0.013f * (float)(i % 7),
+                                   10.0f + (float)(i / side) * 0.25f,
+                                   0.37f * (float)(i % 5)}};
+        b->linear_velocity = (fe_vec3_t){{0.0f, 0.0f, speed}};
+        b->continuous_collision = continuous;
+        fe_rigid_body_set_mass_properties(b, m, bullet_inertia);
+        fe_physics_manager_add_rigid_body(b);
+        bullets[i] = b;
+    }
+
+    double total = 0.0, flight = 0.0;
+    for (int s = 0; s < FE_CCD_TEST_STEPS; ++s) {
+        double start = fe_ccd_test_now_ms();
+        fe_physics_manager_step();
+        double elapsed = fe_ccd_test_now_ms() - start;
+        total += elapsed;
+        if (s < FE_CCD_TEST_FLIGHT_STEPS) flight += elapsed;
+    }
+
+    memset(out, 0, sizeof(*out));
+    for (int i = 0; i < FE_CCD_TEST_BULLETS; ++i) {
+        const fe_rigid_body_t* b = bullets[i];
+        float side_distance = fe_vec3_dot(fe_vec3_subtract(b->position, wall->position), wall_normal);
+        if (side_distance > 0.0f) {
+            out->tunnelled++;
+        } else {
+            float penetration = side_distance + FE_CCD_TEST_WALL_HALF_THICKNESS + r;
+            if (penetration > out->max_penetration) out->max_penetration = penetration;
+        }
+        memcpy(out->positions[i], b->position.v, sizeof(out->positions[i]));
+        memcpy(out->velocities[i], b->linear_velocity.v, sizeof(out->velocities[i]));
+    }
+    out->flight_ms = flight / FE_CCD_TEST_FLIGHT_STEPS;
+    out->total_ms = total / FE_CCD_TEST_STEPS;
+
+    fe_physics_manager_shutdown(); // Cisimleri de yok eder
+}
+
+int main(void) {
+    static const struct {
+        const char* name;
+        fe_ccd_test_wall_t wall;
+        float speed;
+    } cases[] = {
+        {"duz duvar, 500 m/s",      FE_CCD_TEST_WALL_STATIC,  500.0f},
+        {"45 derece, 500 m/s",      FE_CCD_TEST_WALL_ANGLED,  500.0f},
+        {"dinamik 500 kg, 500 m/s", FE_CCD_TEST_WALL_DYNAMIC, 500.0f},
+        {"duz duvar, 60 m/s",       FE_CCD_TEST_WALL_STATIC,   60.0f},
+        {"duz duvar, 1000 m/s",     FE_CCD_TEST_WALL_STATIC, 1000.0f},
+    };
+    static fe_ccd_test_result_t discrete, continuous;
+    int failures = 0;
+
+    fe_logger_set_level(FE_LOG_LEVEL_WARN);
+    fe_memory_manager_init();
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); ++i) {
+        fe_ccd_test_run(false, cases[i].wall, cases[i].speed, 0, &discrete);
+        fe_ccd_test_run(true, cases[i].wall, cases[i].speed, 0, &continuous);
+        printf("%-24s ayrik: %3u/%d gecti | ccd: %3u/%d gecti, en derin %.4f m, ucus %.3f ms/adim (ayrik %.3f), ort %.3f ms/adim\n",
+               cases[i].name, discrete.tunnelled, FE_CCD_TEST_BULLETS, continuous.tunnelled, FE_CCD_TEST_BULLETS,
+               continuous.max_penetration, continuous.flight_ms, discrete.flight_ms, continuous.total_ms);
+        if (i == 0 && discrete.tunnelled == 0) {
+            printf("  BASARISIZ: ayrik modda tunel yok, senaryo hicbir seyi dogrulamiyor\n");
+            failures++;
+        }
+        if (continuous.tunnelled != 0) {
+            printf("  BASARISIZ: ccd ile %u mermi duvardan gecti\n", continuous.tunnelled);
+            failures++;
+        }
+        if (continuous.flight_ms - discrete.flight_ms > FE_CCD_TEST_MAX_OVERHEAD_MS) {
+            printf("  BASARISIZ: ccd ucus adimi ayriktan %.3f ms pahali (en fazla %.1f ms)\n",
+                   continuous.flight_ms - discrete.flight_ms, FE_CCD_TEST_MAX_OVERHEAD_MS);
+            failures++;
+        }
+    }
+
+    // Yavas bayrakli cisimler ayrik yolu kullanmali: durum bit bit ayni olmali
+    fe_ccd_test_run(false, FE_CCD_TEST_WALL_STATIC, 0.2f, 0, &discrete);
+    fe_ccd_test_run(true, FE_CCD_TEST_WALL_STATIC, 0.2f, 0, &continuous);
+    bool identical = memcmp(discrete.positions, continuous.positions, sizeof(discrete.positions)) == 0 &&
+                     memcmp(discrete.velocities, continuous.velocities, sizeof(discrete.velocities)) == 0;
+    printf("0.2 m/s bayrakli == ayrik: %s\n", identical ? "evet" : "hayir");
+    if (!identical) failures++;
+
+    // Arka plan maliyeti: bayraksiz duran kutular iki modda da ayni yoldan gecer (sadece rapor)
+    fe_ccd_test_run(false, FE_CCD_TEST_WALL_STATIC, 500.0f, FE_CCD_TEST_BACKGROUND_SIDE, &discrete);
+    fe_ccd_test_run(true, FE_CCD_TEST_WALL_STATIC, 500.0f, FE_CCD_TEST_BACKGROUND_SIDE, &continuous);
+    printf("%d duran kutu ile: ayrik %.2f ms/adim, ccd %.2f ms/adim (ccd %u/%d gecti)\n",
+           FE_CCD_TEST_BACKGROUND_SIDE * FE_CCD_TEST_BACKGROUND_SIDE, discrete.total_ms, continuous.total_ms,
+           continuous.tunnelled, FE_CCD_TEST_BULLETS);
+    if (continuous.tunnelled != 0) failures++;
+
+    fe_memory_manager_shutdown();
+    printf("%s\n", failures ? "BASARISIZ" : "GECTI");
+    return failures ? 1 : 0;
+}
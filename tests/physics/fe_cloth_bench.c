@@ -0,0 +1,119 @@
+// tests/physics/fe_cloth_bench.c
+
+/**
+ * @brief XPBD kumas cozucusu icin bagimsiz kiyaslama (benchmark).
+ * * 1. Izgara boyutu x iterasyon sayisi icin ms/adim tablosu basar.
+ * * 2. 256x256 bayragi 8 iterasyonla 60 Hz butcesine (16.6 ms) karsi olcer; isci sayisi
+ * *    argumanla verilir (varsayilan 3 isci + ana is parcacigi = 4 cekirdek, 0 = islemci sayisi - 1).
+ * * Makinede is parcacigi sayisi kadar mantiksal cekirdek varsa butce asildiginda 1 ile cikar;
+ * * daha az cekirdekte sayi yine basilir ama kontrol atlanir (olcum temsili degildir).
+ *
+ * Derleme (depo kokunden):
+ *   gcc -O2 -mavx -std=c11 -D_GNU_SOURCE -Iinclude tests/physics/fe_cloth_bench.c \
+ *       src/physics/fe_cloth_physics.c src/physics/fe_collider.c src/physics/fe_broadphase.c \
+ *       src/data_structures/fe_array.c src/data_structures/fe_hashmap.c src/math/fe_hash.c \
+ *       src/math/fe_vector.c src/platform/fe_job_system.c src/platform/fe_thread.c \
+ *       src/utils/fe_logger.c src/error/fe_error.c src/memory/fe_memory_manager.c \
+ *       src/memory/fe_allocator_linear.c src/memory/fe_allocator_pool.c \
+ *       src/memory/fe_allocator_size_class.c -lm -lpthread -o fe_cloth_bench
+ *   ./fe_cloth_bench [isci_sayisi]
+ */
+
+#include "physics/fe_cloth_physics.h"
+#include "memory/fe_memory_manager.h"
+#include "platform/fe_job_system.h"
+#include "platform/fe_thread.h"
+#include "utils/fe_logger.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define FE_CLOTH_BENCH_WARMUP_STEPS 30
+#define FE_CLOTH_BENCH_TIMED_STEPS 60
+#define FE_CLOTH_BENCH_BUDGET_MS (1000.0 / 60.0)
+
+static double fe_cloth_bench_now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e3 + (double)ts.tv_nsec * 1e-6;
+}
+
+static int fe_cloth_bench_compare(const void* a, const void* b) {
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Sol kenari sabitlenmis n x n bayrak kurar, isitir ve olculen adimlarin ortanca/p95 suresini dondurur.
+ */
+static void fe_cloth_bench_run(uint32_t n, uint32_t iterations, double* out_median, double* out_p95) {
+    const fe_vec3_t gravity = {{0.0f, -9.81f, 0.0f}};
+    const float dt = 1.0f / 60.0f;
+    double samples[FE_CLOTH_BENCH_TIMED_STEPS];
+
+    fe_cloth_t* cloth = fe_cloth_create_plane(n, n, 2.0f, 2.0f);
+    cloth->constraint_iterations = iterations;
+    for (uint32_t row = 0; row < n; ++row) {
+        fe_cloth_fix_particle(cloth, row * n);
+    }
+
+    for (int i = 0; i < FE_CLOTH_BENCH_WARMUP_STEPS; ++i) {
+        fe_cloth_simulate_step(cloth, gravity, dt);
+    }
+    for (int i = 0; i < FE_CLOTH_BENCH_TIMED_STEPS; ++i) {
+        double start = fe_cloth_bench_now_ms();
+        fe_cloth_simulate_step(cloth, gravity, dt);
+        samples[i] = fe_cloth_bench_now_ms() - start;
+    }
+    fe_cloth_destroy(cloth);
+
+    qsort(samples, FE_CLOTH_BENCH_TIMED_STEPS, sizeof(double), fe_cloth_bench_compare);
+    *out_median = samples[FE_CLOTH_BENCH_TIMED_STEPS / 2];
+    *out_p95 = samples[(FE_CLOTH_BENCH_TIMED_STEPS * 95) / 100];
+}
+
+int main(int argc, char** argv) {
+    uint32_t workers = (argc > 1) ? (uint32_t)atoi(argv[1]) : 3;
+    uint32_t cpu_count = fe_thread_get_cpu_count();
+    static const uint32_t sizes[] = {32, 64, 128, 256};
+    static const uint32_t iteration_counts[] = {4, 8, 16};
+    double median, p95;
+
+    fe_logger_set_level(FE_LOG_LEVEL_WARN);
+    fe_memory_manager_init();
+    if (fe_job_system_init(workers) != FE_OK) {
+        fprintf(stderr, "is sistemi baslatilamadi\n");
+        return 1;
+    }
+    uint32_t threads = fe_job_system_thread_count();
+    printf("is parcacigi: %u (isci + ana), mantiksal cekirdek: %u\n", threads, cpu_count);
+
+    printf("ms/adim (ortanca)   it 4     it 8     it 16\n");
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+        printf("  %3ux%-3u        ", sizes[s], sizes[s]);
+        for (size_t i = 0; i < sizeof(iteration_counts) / sizeof(iteration_counts[0]); ++i) {
+            fe_cloth_bench_run(sizes[s], iteration_counts[i], &median, &p95);
+            printf(" %7.2f ", median);
+        }
+        printf("\n");
+    }
+
+    fe_cloth_bench_run(256, 8, &median, &p95);
+    printf("256x256, 8 iterasyon: ortanca %.2f ms, p95 %.2f ms (butce %.2f ms)\n",
+           median, p95, FE_CLOTH_BENCH_BUDGET_MS);
+
+    int result = 0;
+    if (cpu_count < threads) {
+        printf("ATLANDI: %u cekirdekte %u is parcacigi; 60 Hz kontrolu temsili degil\n",
+               cpu_count, threads);
+    } else if (median > FE_CLOTH_BENCH_BUDGET_MS) {
+        printf("BASARISIZ: 256x256 bayrak 60 Hz butcesini asiyor\n");
+        result = 1;
+    } else {
+        printf("GECTI\n");
+    }
+
+    fe_job_system_shutdown();
+    fe_memory_manager_shutdown();
+    return result;
+}
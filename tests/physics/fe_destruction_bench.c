@@ -0,0 +1,244 @@
+// tests/physics/fe_destruction_bench.c
+
+/**
+ * @brief 500 parcali duvar icin kirilma karesi kiyaslamasi.
+ * * Sahne: statik zemin uzerinde 3 x 2 x 0.6 m beton duvar (dis bukey kutu), 500 Voronoi parcasi, 60 Hz.
+ * * 1. Uretim: fe_fracture_voronoi suresi; parca hacimlerinin toplami duvarin hacmine (3.6 m^3) %1 icinde esit olmali.
+ * * 2. Tam kirilma (FE_DESTRUCT_BENCH_REPEATS tekrar): fe_destruction_perform + ilk fizik adimi (kirilma karesi),
+ * *    sonraki adimlarin ortalamasi ve en kotusu basilir; 500 parcanin hepsi dinamik olmali ve ilki dahil her
+ * *    tekrarin kirilma karesi de sonraki en kotu adimi da FE_DESTRUCT_BENCH_MAX_BREAK_MS butcesini asmamali.
+ * * 3. Kismi hasar: destekli (anchor_height 0.2 m) ayni duvarda kose hasari; bazi parcalar dinamik olmali,
+ * *    statik kalanlar 60 adim sonra yerinden oynamamali.
+ * * Herhangi bir kontrol tutmazsa 1 ile cikar.
+ *
+ * Derleme (depo kokunden):
+ *   gcc -O2 -std=c11 -D_GNU_SOURCE -Iinclude tests/physics/fe_destruction_bench.c \
+ *       src/physics/fe_destruction_system.c \
+ *       src/physics/fe_physics_manager.c src/physics/fe_island.c \
+ *       src/physics/fe_world.c src/physics/fe_rigid_body.c src/physics/fe_collider.c \
+ *       src/physics/fe_broadphase.c src/physics/fe_narrowphase.c src/physics/fe_collision_solver.c \
+ *       src/physics/fe_physical_materials.c src/physics/fe_constraint_solver.c \
+ *       src/physics/fe_physics_constraint_component.c src/data_structures/fe_array.c \
+ *       src/data_structures/fe_hashmap.c src/math/fe_hash.c src/math/fe_vector.c \
+ *       src/math/fe_matrix.c src/platform/fe_job_system.c src/platform/fe_thread.c \
+ *       src/utils/fe_logger.c src/error/fe_error.c src/memory/fe_memory_manager.c \
+ *       src/memory/fe_allocator_linear.c src/memory/fe_allocator_pool.c \
+ *       src/memory/fe_allocator_size_class.c src/utils/fe_timer.c -lm -lpthread -o fe_destruction_bench
+ *   ./fe_destruction_bench
+ */
+
+#include "physics/fe_destruction_system.h"
+#include "physics/fe_physics_manager.h"
+#include "memory/fe_memory_manager.h"
+#include "utils/fe_logger.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+
+#define FE_DESTRUCT_BENCH_CHUNKS 500
+#define FE_DESTRUCT_BENCH_STEPS 60
+#define FE_DESTRUCT_BENCH_REPEATS 3
+#define FE_DESTRUCT_BENCH_MAX_BREAK_MS 16.0
+#define FE_DESTRUCT_BENCH_VOLUME_TOLERANCE 0.01f
+#define FE_DESTRUCT_BENCH_STATIC_DRIFT 1e-4f
+
+static const fe_vec3_t g_destruct_bench_half = {{1.5f, 1.0f, 0.3f}};
+
+static double fe_destruct_bench_now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e3 + (double)ts.tv_nsec * 1e-6;
+}
+
+/**
+ * @brief Duvar kutusunun 8 kosesini ve disa bakan CCW 12 ucgenini doldurur.
+ */
+static void fe_destruct_bench_box_mesh(fe_vec3_t positions[8], uint32_t indices[36]) {
+    static const uint32_t faces[36] = {
+        0, 2, 1, 0, 3, 2,   // -Z
+        4, 5, 6, 4, 6, 7,   // +Z
+        0, 1, 5, 0, 5, 4,   // -Y
+        3, 7, 6, 3, 6, 2,   // +Y
+        0, 4, 7, 0, 7, 3,   // -X
+        1, 2, 6, 1, 6, 5    // +X
+    };
+    const fe_vec3_t h = g_destruct_bench_half;
+    for (uint32_t i = 0; i < 8; ++i) {
+        positions[i] = (fe_vec3_t){{(i & 1) ^ ((i >> 1) & 1) ? h.x : -h.x, (i & 2) ? h.y : -h.y, (i & 4) ? h.z : -h.z}};
+    }
+    for (uint32_t i = 0; i < 36; ++i) indices[i] = faces[i];
+}
+
+/**
+ * @brief Duvarin hedef cismini olusturur ve yoneticiye ekler (tabani y = 0'da).
+ */
+static fe_rigid_body_t* fe_destruct_bench_target(void) {
+    fe_rigid_body_t* wall = fe_rigid_body_create();
+    wall->collider = fe_collider_create_box(g_destruct_bench_half);
+    wall->position = (fe_vec3_t){{0.0f, g_destruct_bench_half.y, 0.0f}};
+    fe_rigid_body_set_mass_properties(wall, 0.0f, FE_MAT4_IDENTITY);
+    fe_physics_manager_add_rigid_body(wall);
+    return wall;
+}
+
+static void fe_destruct_bench_ground(void) {
+    fe_rigid_body_t* ground = fe_rigid_body_create();
+    ground->collider = fe_collider_create_box((fe_vec3_t){{20.0f, 1.0f, 20.0f}});
+    ground->position = (fe_vec3_t){{0.0f, -1.0f, 0.0f}};
+    fe_rigid_body_set_mass_properties(ground, 0.0f, FE_MAT4_IDENTITY);
+    fe_physics_manager_add_rigid_body(ground);
+}
+
+static uint32_t fe_destruct_bench_count(const fe_destructible_component_t* comp, uint8_t state) {
+    uint32_t count = 0;
+    uint32_t chunk_count = (uint32_t)fe_array_count(comp->fracture_data->chunks);
+    for (uint32_t i = 0; i < chunk_count; ++i) {
+        if (comp->chunk_states[i] == state) ++count;
+    }
+    return count;
+}
+
+typedef struct fe_destruct_bench_break {
+    double break_ms;
+    double step_ms;
+    double worst_step_ms;
+    uint32_t dynamic_count;
+    uint32_t contacts;
+} fe_destruct_bench_break_t;
+
+/**
+ * @brief Yeni bir dunyada duvari tumden kirar; havuz bilesenle birlikte olusur, kirilma karesinde bellek ayrilmaz.
+ */
+static void fe_destruct_bench_full_break(fe_fracture_mesh_t* fracture, fe_destruct_bench_break_t* out) {
+    fe_physics_manager_init();
+    fe_destruct_bench_ground();
+    fe_rigid_body_t* wall = fe_destruct_bench_target();
+    fe_destructible_component_t* comp = fe_destruction_create_component(wall, fracture, NULL, 100.0f, 10.0f);
+    fe_physics_manager_step();
+
+    double start = fe_destruct_bench_now_ms();
+    fe_destruction_perform(comp);
+    fe_physics_manager_step();
+    out->break_ms = fe_destruct_bench_now_ms() - start;
+
+    double total = 0.0;
+    out->worst_step_ms = 0.0;
+    fe_physics_step_stats_t stats = {0};
+    for (int s = 0; s < FE_DESTRUCT_BENCH_STEPS; ++s) {
+        fe_physics_manager_step();
+        fe_physics_manager_get_step_stats(&stats);
+        total += stats.step_ms;
+        if (stats.step_ms > out->worst_step_ms) out->worst_step_ms = stats.step_ms;
+    }
+    out->step_ms = total / FE_DESTRUCT_BENCH_STEPS;
+    out->dynamic_count = fe_destruct_bench_count(comp, FE_FRACTURE_CHUNK_DYNAMIC);
+    out->contacts = stats.active_contacts;
+
+    fe_destruction_destroy_component(comp);
+    fe_physics_manager_shutdown();
+    fe_rigid_body_destroy(wall);
+}
+
+int main(void) {
+    fe_vec3_t positions[8];
+    uint32_t indices[36];
+    int failures = 0;
+
+    fe_logger_set_level(FE_LOG_LEVEL_WARN);
+    fe_memory_manager_init();
+    fe_destruct_bench_box_mesh(positions, indices);
+
+    // 1. Uretim
+    fe_fracture_settings_t settings = fe_fracture_create_default_settings();
+    settings.site_count = FE_DESTRUCT_BENCH_CHUNKS;
+    double start = fe_destruct_bench_now_ms();
+    fe_fracture_mesh_t* fracture = fe_fracture_voronoi(positions, 8, indices, 36, NULL, settings.site_count, &settings);
+    double generate_ms = fe_destruct_bench_now_ms() - start;
+    if (!fracture) {
+        printf("  BASARISIZ: Voronoi uretimi basarisiz\n");
+        fe_memory_manager_shutdown();
+        return 1;
+    }
+
+    uint32_t chunk_count = (uint32_t)fe_array_count(fracture->chunks);
+    float volume = 0.0f;
+    for (uint32_t i = 0; i < chunk_count; ++i) {
+        volume += ((const fe_fracture_chunk_t*)fe_array_get(fracture->chunks, i))->volume;
+    }
+    const float expected_volume = 8.0f * g_destruct_bench_half.x * g_destruct_bench_half.y * g_destruct_bench_half.z;
+    printf("%u parca, %u bag, %u kume\n", chunk_count, fracture->bond_count, fracture->cluster_count);
+    printf("  uretim:          %8.2f ms, hacim %.4f m^3 (beklenen %.4f)\n", generate_ms, volume, expected_volume);
+    if (chunk_count != FE_DESTRUCT_BENCH_CHUNKS || fabsf(volume - expected_volume) > FE_DESTRUCT_BENCH_VOLUME_TOLERANCE * expected_volume) {
+        printf("  BASARISIZ: parca sayisi veya hacim tutmuyor\n");
+        failures++;
+    }
+
+    // 2. Tam kirilma: ayni veriyle FE_DESTRUCT_BENCH_REPEATS kez; butce ilki dahil her tekrara uygulanir
+    for (int r = 0; r < FE_DESTRUCT_BENCH_REPEATS; ++r) {
+        fe_destruct_bench_break_t run;
+        fe_destruct_bench_full_break(fracture, &run);
+        printf("  kirilma karesi:  %8.2f ms (perform + ilk adim), sonraki adimlar %.2f ms/adim (en kotu %.2f), %u dinamik, %u temas\n",
+               run.break_ms, run.step_ms, run.worst_step_ms, run.dynamic_count, run.contacts);
+        if (run.dynamic_count != chunk_count) {
+            printf("  BASARISIZ: %u/%u parca dinamik\n", run.dynamic_count, chunk_count);
+            failures++;
+        }
+        if (run.break_ms > FE_DESTRUCT_BENCH_MAX_BREAK_MS || run.worst_step_ms > FE_DESTRUCT_BENCH_MAX_BREAK_MS) {
+            printf("  BASARISIZ: tekrar %d butceyi (%.0f ms) asti\n", r + 1, FE_DESTRUCT_BENCH_MAX_BREAK_MS);
+            failures++;
+        }
+    }
+    fe_fracture_mesh_destroy(fracture);
+
+    // 3. Kismi hasar: tabana yakin parcalar destektir, ust kose hasar alir
+    settings.anchor_height = 0.2f;
+    fracture = fe_fracture_voronoi(positions, 8, indices, 36, NULL, settings.site_count, &settings);
+    fe_physics_manager_init();
+    fe_destruct_bench_ground();
+    fe_rigid_body_t* wall = fe_destruct_bench_target();
+    fe_destructible_component_t* comp = fe_destruction_create_component(wall, fracture, NULL, 100.0f, 10.0f);
+    fe_physics_manager_step();
+
+    fe_vec3_t corner = {{g_destruct_bench_half.x, 2.0f * g_destruct_bench_half.y, 0.0f}};
+    start = fe_destruct_bench_now_ms();
+    uint32_t released = fe_destruction_apply_damage(comp, corner, 0.8f, 1e6f);
+    fe_physics_manager_step();
+    double damage_ms = fe_destruct_bench_now_ms() - start;
+
+    // Statik parcalarin baslangic konumlari (kirilmadan sonra dunyada statik cisim olarak dururlar)
+    fe_vec3_t* rest = (fe_vec3_t*)malloc(sizeof(fe_vec3_t) * chunk_count);
+    for (uint32_t i = 0; i < chunk_count; ++i) {
+        if (comp->chunk_states[i] == FE_FRACTURE_CHUNK_STATIC) rest[i] = comp->body_pool->bodies[comp->chunk_slots[i]]->position;
+    }
+    for (int s = 0; s < FE_DESTRUCT_BENCH_STEPS; ++s) fe_physics_manager_step();
+
+    float max_drift = 0.0f;
+    for (uint32_t i = 0; i < chunk_count; ++i) {
+        if (comp->chunk_states[i] != FE_FRACTURE_CHUNK_STATIC) continue;
+        float drift = fe_vec3_length(fe_vec3_subtract(comp->body_pool->bodies[comp->chunk_slots[i]]->position, rest[i]));
+        if (drift > max_drift) max_drift = drift;
+    }
+    uint32_t static_count = fe_destruct_bench_count(comp, FE_FRACTURE_CHUNK_STATIC);
+    printf("  kismi hasar:     %8.2f ms (hasar + ilk adim), %u dinamik, %u statik, statik kayma %.2e m\n",
+           damage_ms, released, static_count, max_drift);
+    if (released == 0 || static_count == 0) {
+        printf("  BASARISIZ: kismi hasar duvari bolmedi\n");
+        failures++;
+    }
+    if (max_drift > FE_DESTRUCT_BENCH_STATIC_DRIFT) {
+        printf("  BASARISIZ: statik parcalar yerinden oynadi\n");
+        failures++;
+    }
+
+    free(rest);
+    fe_destruction_destroy_component(comp);
+    fe_physics_manager_shutdown();
+    fe_rigid_body_destroy(wall);
+    fe_fracture_mesh_destroy(fracture);
+    fe_memory_manager_shutdown();
+    if (failures == 0) {
+        printf("GECTI\n");
+    }
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,190 @@
+// tests/physics/fe_fluid_bench.c
+
+/**
+ * @brief SPH akiskan cozucusu icin bagimsiz kiyaslama (benchmark).
+ * * 1. 10k/50k/100k/200k parcacik icin uniform grid ve O(n^2) kaba kuvvet yollarinin ms/adim degerlerini basar.
+ * *    Kaba kuvvet 200k'da dakikalar surer; yalnizca "--brute-all" argumaniyla olculur.
+ * * 2. 10k parcacikta iki yolun yogunluklari karsilastirilir; goreli fark 1e-4'u asarsa 1 ile cikar.
+ * *    Grid yolu depoyu hucre sirasina dizdiginden parcaciklar id ile eslestirilir.
+ * * 3. Yercekimi altinda 21 adim sonra tum parcaciklar hacim sinirlari icinde olmalidir.
+ * * 4. smoothing_radius_h = 0 ile adim donmelidir (izgara reddeder, kaba kuvvet yoluna dusulur).
+ * * 5. 1-16 is parcacigi icin 50k parcacikta ms/adim ve hizlanma tablosu basar (is sistemi her satirda
+ * *    yeniden baslatilir). Tum satirlar bit duzeyinde ayni yogunlugu uretmelidir; uretmezse 1 ile cikar.
+ * *    Mantiksal cekirdekten fazla is parcacigi olan satirlar isaretlenir (olcum temsili degildir).
+ * * Parcaciklar hacme rastgele dagitilir; hacim parcacik basina ~30 komsu dusecek sekilde olceklenir.
+ *
+ * Derleme (depo kokunden):
+ *   gcc -O2 -std=c11 -D_GNU_SOURCE -Iinclude tests/physics/fe_fluid_bench.c \
+ *       src/physics/fe_fluid_simulation.c src/math/fe_vector.c src/platform/fe_job_system.c \
+ *       src/platform/fe_thread.c src/utils/fe_logger.c src/error/fe_error.c src/memory/fe_memory_manager.c \
+ *       src/memory/fe_allocator_linear.c src/memory/fe_allocator_pool.c \
+ *       src/memory/fe_allocator_size_class.c -lm -lpthread -o fe_fluid_bench
+ *   ./fe_fluid_bench [--brute-all]
+ */
+
+#include "physics/fe_fluid_simulation.h"
+#include "memory/fe_memory_manager.h"
+#include "platform/fe_job_system.h"
+#include "platform/fe_thread.h"
+#include "utils/fe_logger.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#define FE_FLUID_BENCH_GRID_STEPS 10
+#define FE_FLUID_BENCH_BOUNDARY_STEPS 20
+#define FE_FLUID_BENCH_NEIGHBORS 30.0f
+#define FE_FLUID_BENCH_DENSITY_TOLERANCE 1e-4f
+#define FE_FLUID_BENCH_SCALING_PARTICLES 50000
+#define FE_FLUID_BENCH_SCALING_STEPS 5
+
+static double fe_fluid_bench_now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e3 + (double)ts.tv_nsec * 1e-6;
+}
+
+/**
+ * @brief Parcacik basina ~FE_FLUID_BENCH_NEIGHBORS komsu dusecek kup hacim olusturur.
+ * * Tohum sabittir; ayni n icin iki cagri ayni parcaciklari uretir.
+ */
+static fe_fluid_volume_t* fe_fluid_bench_create(uint32_t n) {
+    const float h = 0.1f;
+    float sphere = 4.0f / 3.0f * (float)M_PI * h * h * h;
+    float side = cbrtf((float)n * sphere / FE_FLUID_BENCH_NEIGHBORS);
+    srand(1234);
+    return fe_fluid_create_volume(n, (fe_vec3_t){{side, side, side}});
+}
+
+/**
+ * @brief Hacmi steps adim ilerletir ve ortalama ms/adim dondurur.
+ */
+static double fe_fluid_bench_run(fe_fluid_volume_t* volume, int steps) {
+    const fe_vec3_t gravity = {{0.0f, -9.81f, 0.0f}};
+    const float dt = 1.0f / 120.0f;
+    double start = fe_fluid_bench_now_ms();
+    for (int i = 0; i < steps; ++i) {
+        fe_fluid_simulate_step(volume, gravity, dt);
+    }
+    return (fe_fluid_bench_now_ms() - start) / (double)steps;
+}
+
+int main(int argc, char** argv) {
+    bool brute_all = (argc > 1 && strcmp(argv[1], "--brute-all") == 0);
+    static const uint32_t sizes[] = {10000, 50000, 100000, 200000};
+    int result = 0;
+
+    fe_logger_set_level(FE_LOG_LEVEL_WARN);
+    fe_memory_manager_init();
+
+    // 1. ms/adim: grid ve kaba kuvvet
+    printf("parcacik    grid ms/adim   kaba kuvvet ms/adim   hizlanma\n");
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+        fe_fluid_volume_t* volume = fe_fluid_bench_create(sizes[s]);
+        double grid_ms = fe_fluid_bench_run(volume, FE_FLUID_BENCH_GRID_STEPS);
+        fe_fluid_destroy_volume(volume);
+
+        printf("  %7u   %10.2f", sizes[s], grid_ms);
+        if (sizes[s] <= 50000 || brute_all) {
+            volume = fe_fluid_bench_create(sizes[s]);
+            volume->use_spatial_hash = false;
+            double brute_ms = fe_fluid_bench_run(volume, 1);
+            fe_fluid_destroy_volume(volume);
+            printf("   %19.2f   %7.1fx\n", brute_ms, brute_ms / grid_ms);
+        } else {
+            printf("   %19s\n", "atlandi");
+        }
+    }
+
+    // 2. Dogruluk: ayni baslangicta iki yolun yogunluklari
+    fe_fluid_volume_t* grid_volume = fe_fluid_bench_create(10000);
+    fe_fluid_volume_t* brute_volume = fe_fluid_bench_create(10000);
+    brute_volume->use_spatial_hash = false;
+    fe_fluid_bench_run(grid_volume, 1);
+    fe_fluid_bench_run(brute_volume, 1);
+    float max_relative = 0.0f;
+    for (size_t i = 0; i < grid_volume->particles.count; ++i) {
+        float a = grid_volume->particles.density[i];
+        float b = brute_volume->particles.density[grid_volume->particles.id[i]];
+        float relative = fabsf(a - b) / fmaxf(fabsf(b), 1e-12f);
+        if (relative > max_relative) max_relative = relative;
+    }
+    fe_fluid_destroy_volume(brute_volume);
+    printf("yogunluk (grid / kaba kuvvet), en buyuk goreli fark: %.2e\n", max_relative);
+    if (!(max_relative <= FE_FLUID_BENCH_DENSITY_TOLERANCE)) {
+        printf("BASARISIZ: grid ve kaba kuvvet yogunluklari ayrisiyor\n");
+        result = 1;
+    }
+
+    // 3. Sinirlar: yercekimi altinda parcaciklar hacimde kalmali
+    fe_fluid_bench_run(grid_volume, FE_FLUID_BENCH_BOUNDARY_STEPS);
+    size_t outside = 0;
+    const fe_fluid_particle_store_t* store = &grid_volume->particles;
+    for (size_t i = 0; i < store->count; ++i) {
+        if (store->position_x[i] < grid_volume->volume_min.x || store->position_x[i] > grid_volume->volume_max.x ||
+            store->position_y[i] < grid_volume->volume_min.y || store->position_y[i] > grid_volume->volume_max.y ||
+            store->position_z[i] < grid_volume->volume_min.z || store->position_z[i] > grid_volume->volume_max.z) {
+            ++outside;
+        }
+    }
+    fe_fluid_destroy_volume(grid_volume);
+    printf("%d adim sonra hacim disindaki parcacik: %zu\n", 1 + FE_FLUID_BENCH_BOUNDARY_STEPS, outside);
+    if (outside > 0) {
+        printf("BASARISIZ: parcaciklar hacim sinirlarindan tasiyor\n");
+        result = 1;
+    }
+
+    // 4. Gecersiz h: izgara kurulumu sonsuz donguye girmemeli
+    fe_fluid_volume_t* degenerate = fe_fluid_bench_create(1000);
+    degenerate->smoothing_radius_h = 0.0f;
+    fe_logger_set_level(FE_LOG_LEVEL_ERROR);
+    fe_fluid_bench_run(degenerate, 1);
+    fe_logger_set_level(FE_LOG_LEVEL_WARN);
+    fe_fluid_destroy_volume(degenerate);
+    printf("h = 0 ile adim tamamlandi\n");
+
+    // 5. Is parcacigi olceklemesi
+    static const uint32_t thread_counts[] = {1, 2, 4, 8, 12, 16};
+    uint32_t cpu_count = fe_thread_get_cpu_count();
+    float* reference_density = NULL;
+    double serial_ms = 0.0;
+    bool identical = true;
+    printf("%u parcacik, mantiksal cekirdek: %u\n", FE_FLUID_BENCH_SCALING_PARTICLES, cpu_count);
+    printf("is parcacigi   ms/adim   hizlanma\n");
+    for (size_t t = 0; t < sizeof(thread_counts) / sizeof(thread_counts[0]); ++t) {
+        uint32_t threads = thread_counts[t];
+        if (fe_job_system_init(threads - 1) != FE_OK) {
+            fprintf(stderr, "is sistemi baslatilamadi\n");
+            return 1;
+        }
+        fe_fluid_volume_t* volume = fe_fluid_bench_create(FE_FLUID_BENCH_SCALING_PARTICLES);
+        fe_fluid_set_worker_count(volume, threads);
+        double ms = fe_fluid_bench_run(volume, FE_FLUID_BENCH_SCALING_STEPS);
+        fe_job_system_shutdown();
+
+        if (!reference_density) {
+            serial_ms = ms;
+            reference_density = (float*)malloc(volume->particles.count * sizeof(float));
+            memcpy(reference_density, volume->particles.density, volume->particles.count * sizeof(float));
+        } else if (memcmp(reference_density, volume->particles.density, volume->particles.count * sizeof(float)) != 0) {
+            identical = false;
+        }
+        fe_fluid_destroy_volume(volume);
+        printf("  %10u   %7.2f   %7.2fx%s\n", threads, ms, serial_ms / ms,
+               threads > cpu_count ? "  (cekirdekten fazla)" : "");
+    }
+    free(reference_density);
+    if (!identical) {
+        printf("BASARISIZ: sonuc is parcacigi sayisina bagli\n");
+        result = 1;
+    }
+
+    if (result == 0) {
+        printf("GECTI\n");
+    }
+
+    fe_memory_manager_shutdown();
+    return result;
+}
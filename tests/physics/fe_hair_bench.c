@@ -0,0 +1,191 @@
+// tests/physics/fe_hair_bench.c
+
+/**
+ * @brief Kilavuz tel saci icin bagimsiz kiyaslama (benchmark).
+ * * 1k kilavuz (24 parcacik) ve 100k demet teli, sallanan bir kafada:
+ * * 1. Gercek kare basina CPU maliyetinin 1 ms butcesinde kaldigini kontrol eder. Sac GPU'da karistirilarak
+ * *    cizilir (fe_hair_renderer_update): CPU her kare kilavuz adimini (fe_hair_simulate_step), kilavuz
+ * *    hazirligini (fe_hair_update_render_guides) ve kilavuz tamponunun yuklenmesini yapar. Yukleme,
+ * *    guides.packed'in bir hazirlama tamponuna kopyalanmasiyla olculur (glBufferSubData'nin CPU payi).
+ * * 2. CPU yedeginin (fe_hair_update_render_strands) sonucunu, hair_blend.comp'un okudugu duz duzenle
+ * *    (tel basina FE_HAIR_RENDERER_STRAND_WORDS kelime, kilavuz basina stride * 3 float) hesaplanan
+ * *    formulle karsilastirir; boylece hem formul hem shader'in tampon duzeni dogrulanir.
+ * * 3. CPU yedeginin genisletme suresini basar (cizim yolunda degildir; zorlanmaz).
+ * * Kare maliyeti butceyi asarsa veya formul tutmazsa 1 ile cikar.
+ *
+ * Derleme (depo kokunden):
+ *   gcc -O2 -mavx -std=c11 -D_GNU_SOURCE -Iinclude tests/physics/fe_hair_bench.c \
+ *       src/physics/fe_hair_physics.c src/data_structures/fe_array.c src/math/fe_vector.c \
+ *       src/platform/fe_job_system.c src/platform/fe_thread.c src/utils/fe_logger.c \
+ *       src/error/fe_error.c src/memory/fe_memory_manager.c src/memory/fe_allocator_linear.c \
+ *       src/memory/fe_allocator_pool.c src/memory/fe_allocator_size_class.c -lm -lpthread -o fe_hair_bench
+ *   ./fe_hair_bench [isci_sayisi]
+ */
+
+#include "physics/fe_hair_physics.h"
+#include "graphics/fe_hair_renderer.h" // FE_HAIR_RENDERER_STRAND_WORDS (yalnizca baslik)
+#include "physics/fe_rigid_body.h"
+#include "memory/fe_memory_manager.h"
+#include "platform/fe_job_system.h"
+#include "utils/fe_logger.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+#include <time.h>
+
+#define FE_HAIR_BENCH_GUIDES 1000
+#define FE_HAIR_BENCH_PARTICLES 24
+#define FE_HAIR_BENCH_STRANDS_PER_GUIDE 100
+#define FE_HAIR_BENCH_WARMUP_STEPS 20
+#define FE_HAIR_BENCH_TIMED_STEPS 100
+#define FE_HAIR_BENCH_BUDGET_MS 1.0
+
+static double fe_hair_bench_now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e3 + (double)ts.tv_nsec * 1e-6;
+}
+
+static int fe_hair_bench_compare(const void* a, const void* b) {
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+static double fe_hair_bench_median(double* samples, int count) {
+    qsort(samples, (size_t)count, sizeof(double), fe_hair_bench_compare);
+    return samples[count / 2];
+}
+
+/**
+ * @brief Kafanin ust yarikuresine (altin aci dagilimi) duz kilavuz teller ekler.
+ */
+static void fe_hair_bench_add_guides(fe_hair_component_t* comp, const fe_rigid_body_t* head) {
+    fe_vec3_t points[FE_HAIR_BENCH_PARTICLES];
+    for (uint32_t g = 0; g < FE_HAIR_BENCH_GUIDES; ++g) {
+        float y = 1.0f - ((float)g + 0.5f) / FE_HAIR_BENCH_GUIDES;
+        float r = sqrtf(1.0f - y * y), angle = (float)g * 2.39996323f;
+        fe_vec3_t dir = {{r * cosf(angle), y, r * sinf(angle)}};
+        for (uint32_t i = 0; i < FE_HAIR_BENCH_PARTICLES; ++i) {
+            float t = 0.1f + 0.0125f * (float)i;
+            points[i] = fe_vec3_add(head->position, fe_vec3_scale(dir, t));
+        }
+        fe_hair_add_strand(comp, points, FE_HAIR_BENCH_PARTICLES);
+    }
+}
+
+static float fe_hair_bench_word_float(uint32_t word) {
+    float f;
+    memcpy(&f, &word, sizeof(f));
+    return f;
+}
+
+/**
+ * @brief fe_hair_update_render_guides'ta belgelenen formulu hair_blend.comp gibi hesaplar ve
+ * * render_positions ile en buyuk farki dondurur (her 97. tel). Tel tablosu ve kilavuzlar,
+ * * GPU'ya yuklendikleri haliyle duz kelime/float dizisi olarak okunur.
+ */
+static float fe_hair_bench_check_formula(const fe_hair_component_t* comp) {
+    const fe_hair_guides_t* s = &comp->guides;
+    const uint32_t* strand_data = (const uint32_t*)comp->render_strands->data;
+    const float* guide_data = (const float*)s->packed;
+    uint32_t n = s->stride;
+    float worst = 0.0f;
+    for (size_t r = 0; r < comp->render_strands->count; r += 97) {
+        const uint32_t* words = strand_data + r * FE_HAIR_RENDERER_STRAND_WORDS;
+        fe_vec3_t local = {{fe_hair_bench_word_float(words[6]), fe_hair_bench_word_float(words[7]), fe_hair_bench_word_float(words[8])}};
+        float clump = fe_hair_bench_word_float(words[9]);
+        for (uint32_t i = 0; i < n; ++i) {
+            float taper = 1.0f - clump * (float)i / (float)(n - 1);
+            for (int c = 0; c < 3; ++c) {
+                float expected = 0.0f;
+                for (int j = 0; j < FE_HAIR_RENDER_GUIDES; ++j) {
+                    expected += fe_hair_bench_word_float(words[3 + j]) * guide_data[((size_t)words[j] * n + i) * 3 + c];
+                }
+                expected += fe_vec3_dot(s->head_rows[c], local) * taper;
+                float actual = comp->render_positions[r * n + i].v[c];
+                if (fabsf(actual - expected) > worst) worst = fabsf(actual - expected);
+            }
+        }
+    }
+    return worst;
+}
+
+int main(int argc, char** argv) {
+    uint32_t workers = (argc > 1) ? (uint32_t)atoi(argv[1]) : 0;
+    const fe_vec3_t gravity = {{0.0f, -9.81f, 0.0f}};
+    const float dt = 1.0f / 60.0f;
+    double step_ms[FE_HAIR_BENCH_TIMED_STEPS], guides_ms[FE_HAIR_BENCH_TIMED_STEPS], upload_ms[FE_HAIR_BENCH_TIMED_STEPS];
+    double frame_ms[FE_HAIR_BENCH_TIMED_STEPS], expand_ms[FE_HAIR_BENCH_TIMED_STEPS];
+    float formula_error = 0.0f;
+
+    fe_logger_set_level(FE_LOG_LEVEL_WARN);
+    fe_memory_manager_init();
+    fe_job_system_init(workers);
+
+    fe_rigid_body_t head = {0};
+    head.position = (fe_vec3_t){{0.0f, 1.7f, 0.0f}};
+    head.orientation = (fe_vec4_t){{0.0f, 0.0f, 0.0f, 1.0f}};
+    fe_hair_component_t* comp = fe_hair_create_component(&head);
+    fe_hair_bench_add_guides(comp, &head);
+    uint32_t render_count = fe_hair_generate_clump_strands(comp, FE_HAIR_BENCH_STRANDS_PER_GUIDE, 0.01f, 0.6f, 7);
+    size_t guide_bytes = sizeof(fe_vec3_t) * FE_HAIR_BENCH_GUIDES * FE_HAIR_BENCH_PARTICLES;
+    void* staging = malloc(guide_bytes);
+
+    for (int s = 0; s < FE_HAIR_BENCH_WARMUP_STEPS + FE_HAIR_BENCH_TIMED_STEPS; ++s) {
+        // Kafa yana sallanir ve Y ekseni etrafinda doner
+        float t = (float)s * dt, angle = 0.4f * sinf(4.0f * t);
+        head.position.x = 0.05f * sinf(6.0f * t);
+        head.orientation = (fe_vec4_t){{0.0f, sinf(angle * 0.5f), 0.0f, cosf(angle * 0.5f)}};
+
+        double t0 = fe_hair_bench_now_ms();
+        fe_hair_simulate_step(comp, gravity, dt);
+        double t1 = fe_hair_bench_now_ms();
+        fe_hair_update_render_guides(comp);
+        double t2 = fe_hair_bench_now_ms();
+        memcpy(staging, comp->guides.packed, guide_bytes);
+        double t3 = fe_hair_bench_now_ms();
+        fe_hair_update_render_strands(comp);
+        double t4 = fe_hair_bench_now_ms();
+
+        if (s >= FE_HAIR_BENCH_WARMUP_STEPS) {
+            int k = s - FE_HAIR_BENCH_WARMUP_STEPS;
+            step_ms[k] = t1 - t0;
+            guides_ms[k] = t2 - t1;
+            upload_ms[k] = t3 - t2;
+            frame_ms[k] = t3 - t0;
+            expand_ms[k] = t4 - t3;
+        }
+        float error = fe_hair_bench_check_formula(comp);
+        if (error > formula_error) formula_error = error;
+    }
+
+    double step = fe_hair_bench_median(step_ms, FE_HAIR_BENCH_TIMED_STEPS);
+    double guides = fe_hair_bench_median(guides_ms, FE_HAIR_BENCH_TIMED_STEPS);
+    double upload = fe_hair_bench_median(upload_ms, FE_HAIR_BENCH_TIMED_STEPS);
+    double frame = fe_hair_bench_median(frame_ms, FE_HAIR_BENCH_TIMED_STEPS);
+    double expand = fe_hair_bench_median(expand_ms, FE_HAIR_BENCH_TIMED_STEPS);
+    printf("is parcacigi: %u, %d kilavuz x %d parcacik, %u render teli x %u tepe\n", fe_job_system_thread_count(),
+           FE_HAIR_BENCH_GUIDES, FE_HAIR_BENCH_PARTICLES, render_count, comp->render_vertex_count);
+    printf("kilavuz adimi %.3f ms, kilavuz hazirligi %.3f ms, kilavuz yuklemesi (%zu KB) %.3f ms\n", step, guides,
+           guide_bytes / 1024, upload);
+    printf("kare basina CPU maliyeti (GPU karistirmasi): %.3f ms (butce %.1f ms)\n", frame, FE_HAIR_BENCH_BUDGET_MS);
+    printf("CPU yedegi: render telleri genisletmesi %.3f ms, formul farki %.2e\n", expand, formula_error);
+
+    int result = 0;
+    if (frame > FE_HAIR_BENCH_BUDGET_MS) {
+        printf("BASARISIZ: kare basina CPU maliyeti butceyi asiyor\n");
+        result = 1;
+    }
+    if (formula_error > 1e-5f) {
+        printf("BASARISIZ: render_positions belgelenen formulle uyusmuyor\n");
+        result = 1;
+    }
+    if (result == 0) printf("GECTI\n");
+
+    free(staging);
+    fe_hair_destroy_component(comp);
+    fe_job_system_shutdown();
+    fe_memory_manager_shutdown();
+    return result;
+}
@@ -0,0 +1,185 @@
+// tests/physics/fe_integration_bench.c
+
+/**
+ * @brief Sadece entegrasyon kiyaslamasi: SoA cisim deposu (SSE/AVX) ve kayit basina isaretci dongusu.
+ * * 1k, 10k ve 100k cisim, rastgele dogrusal/acisal hizlar ve kosegen olmayan eylemsizlik, yercekimi.
+ * * Her boyut icin adim basina (hiz + konum entegrasyonu) saniyede milyon cisim degil, ms basina cisim basar:
+ * * 1. Isaretci dongusu: fe_rigid_body_t* dizisi uzerinde yercekimi kuvveti + fe_rigid_body_integrate;
+ * *    fizik adiminin uyanik cisimlerde kayitlar uzerinde yerinde yaptigi is budur.
+ * * 2. Depo: fe_body_store_integrate_velocities + fe_body_store_integrate_positions (durum depoda yasarsa).
+ * * 3. Depo + yukleme/geri yazma: kayitlar ana durum kalip her adim depoyla esitlenseydi odenecek
+ * *    maliyet (fe_body_store_load_range ve save_range dahil); adim bu yuzden depoyu kullanmaz.
+ * * Dogruluk: 60 adim sonra iki yolun konumlari 1 mm, yonelimleri 1e-4 icinde ayni olmali; aksi halde 1 ile cikar.
+ * * Kullanilan SIMD genisligi derleme bayraklarina baglidir (-mavx: 8, SSE2: 4) ve basilir.
+ *
+ * Derleme (depo kokunden; -mavx istege bagli):
+ *   gcc -O2 -mavx -std=c11 -D_GNU_SOURCE -Iinclude tests/physics/fe_integration_bench.c \
+ *       src/physics/fe_body_store.c src/physics/fe_rigid_body.c src/physics/fe_collider.c src/physics/fe_physical_materials.c \
+ *       src/math/fe_vector.c src/math/fe_matrix.c src/utils/fe_logger.c src/error/fe_error.c \
+ *       src/platform/fe_thread.c src/memory/fe_memory_manager.c src/memory/fe_allocator_linear.c \
+ *       src/memory/fe_allocator_pool.c src/memory/fe_allocator_size_class.c -lm -lpthread -o fe_integration_bench
+ *   ./fe_integration_bench
+ */
+
+#include "physics/fe_body_store.h"
+#include "physics/fe_rigid_body.h"
+#include "math/fe_simd.h"
+#include "memory/fe_memory_manager.h"
+#include "utils/fe_logger.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+
+#define FE_INTEGRATE_BENCH_STEPS 60
+#define FE_INTEGRATE_BENCH_REPEATS 5
+#define FE_INTEGRATE_BENCH_DT (1.0f / 60.0f)
+#define FE_INTEGRATE_BENCH_POSITION_TOLERANCE 1e-3f
+#define FE_INTEGRATE_BENCH_ORIENTATION_TOLERANCE 1e-4f
+
+static const fe_vec3_t g_integrate_bench_gravity = {{0.0f, -9.81f, 0.0f}};
+
+static double fe_integrate_bench_now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e3 + (double)ts.tv_nsec * 1e-6;
+}
+
+static inline float fe_integrate_bench_randf(uint32_t* state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return (float)(*state >> 8) * (1.0f / 16777216.0f) * 2.0f - 1.0f;
+}
+
+/**
+ * @brief Ayni tohumla ayni durumu ureten count cisim olusturur.
+ */
+static fe_rigid_body_t** fe_integrate_bench_create(uint32_t count) {
+    fe_rigid_body_t** bodies = (fe_rigid_body_t**)malloc(sizeof(fe_rigid_body_t*) * count);
+    uint32_t state = 0x6C8E9CF5u;
+    for (uint32_t i = 0; i < count; ++i) {
+        fe_rigid_body_t* rb = fe_rigid_body_create();
+        fe_mat4_t inertia = FE_MAT4_IDENTITY;
+        inertia.mm[0][0] = 1.0f + 0.5f * fe_integrate_bench_randf(&state);
+        inertia.mm[1][1] = 1.5f + 0.5f * fe_integrate_bench_randf(&state);
+        inertia.mm[2][2] = 2.0f + 0.5f * fe_integrate_bench_randf(&state);
+        fe_rigid_body_set_mass_properties(rb, 2.0f, inertia);
+        rb->position = (fe_vec3_t){{100.0f * fe_integrate_bench_randf(&state), 50.0f, 100.0f * fe_integrate_bench_randf(&state)}};
+        rb->linear_velocity = (fe_vec3_t){{5.0f * fe_integrate_bench_randf(&state), 5.0f * fe_integrate_bench_randf(&state),
+                                           5.0f * fe_integrate_bench_randf(&state)}};
+        rb->angular_velocity = (fe_vec3_t){{3.0f * fe_integrate_bench_randf(&state), 3.0f * fe_integrate_bench_randf(&state),
+                                            3.0f * fe_integrate_bench_randf(&state)}};
+        bodies[i] = rb;
+    }
+    return bodies;
+}
+
+static void fe_integrate_bench_destroy(fe_rigid_body_t** bodies, uint32_t count) {
+    for (uint32_t i = 0; i < count; ++i) fe_rigid_body_destroy(bodies[i]);
+    free(bodies);
+}
+
+/**
+ * @brief Fizik adiminin yolu: her cisim icin yercekimi kuvveti ve fe_rigid_body_integrate.
+ */
+static void fe_integrate_bench_pointer_step(fe_rigid_body_t** bodies, uint32_t count) {
+    for (uint32_t i = 0; i < count; ++i) {
+        fe_rigid_body_t* rb = bodies[i];
+        fe_rigid_body_apply_force(rb, fe_vec3_scale(g_integrate_bench_gravity, rb->mass));
+        fe_rigid_body_integrate(rb, FE_INTEGRATE_BENCH_DT);
+    }
+}
+
+static void fe_integrate_bench_store_step(fe_body_store_t* store, bool with_load_save) {
+    if (with_load_save) fe_body_store_load_range(store, 0, store->count);
+    fe_body_store_integrate_velocities(store, 0, store->count, g_integrate_bench_gravity, FE_INTEGRATE_BENCH_DT);
+    fe_body_store_integrate_positions(store, 0, store->count, FE_INTEGRATE_BENCH_DT);
+    if (with_load_save) fe_body_store_save_range(store, 0, store->count);
+}
+
+/**
+ * @brief Uc yolu olcer (en iyi FE_INTEGRATE_BENCH_REPEATS tekrar) ve sonuclari karsilastirir.
+ * @return Iki yolun sonucu tolerans icindeyse true.
+ */
+static bool fe_integrate_bench_run(uint32_t count, double out_bodies_per_ms[3]) {
+    fe_rigid_body_t** pointer_bodies = fe_integrate_bench_create(count);
+    fe_rigid_body_t** store_bodies = fe_integrate_bench_create(count);
+    fe_body_store_t store;
+    fe_body_store_init(&store, count);
+    for (uint32_t i = 0; i < count; ++i) fe_body_store_add(&store, store_bodies[i]);
+
+    double best[3] = {1e30, 1e30, 1e30};
+    for (int r = 0; r < FE_INTEGRATE_BENCH_REPEATS; ++r) {
+        double start = fe_integrate_bench_now_ms();
+        for (int s = 0; s < FE_INTEGRATE_BENCH_STEPS; ++s) fe_integrate_bench_pointer_step(pointer_bodies, count);
+        double pointer_ms = fe_integrate_bench_now_ms() - start;
+
+        start = fe_integrate_bench_now_ms();
+        for (int s = 0; s < FE_INTEGRATE_BENCH_STEPS; ++s) fe_integrate_bench_store_step(&store, false);
+        double store_ms = fe_integrate_bench_now_ms() - start;
+
+        start = fe_integrate_bench_now_ms();
+        for (int s = 0; s < FE_INTEGRATE_BENCH_STEPS; ++s) fe_integrate_bench_store_step(&store, true);
+        double load_save_ms = fe_integrate_bench_now_ms() - start;
+
+        if (pointer_ms < best[0]) best[0] = pointer_ms;
+        if (store_ms < best[1]) best[1] = store_ms;
+        if (load_save_ms < best[2]) best[2] = load_save_ms;
+
+    }
+    for (int k = 0; k < 3; ++k) {
+        out_bodies_per_ms[k] = (double)count * FE_INTEGRATE_BENCH_STEPS / best[k];
+    }
+
+    // Yuklemesiz adimlar kayitlara yazilmaz ve sonraki load_range ile atilir; kayitlar her tekrarda
+    // yalnizca yukle/yaz adimlari kadar ilerler, yani isaretci yoluyla ayni sayida adim
+    float max_position = 0.0f, max_orientation = 0.0f;
+    for (uint32_t i = 0; i < count; ++i) {
+        const fe_rigid_body_t* a = pointer_bodies[i];
+        const fe_rigid_body_t* b = store_bodies[i];
+        float dp = fe_vec3_length(fe_vec3_subtract(a->position, b->position));
+        float dot = fabsf(a->orientation.x * b->orientation.x + a->orientation.y * b->orientation.y +
+                          a->orientation.z * b->orientation.z + a->orientation.w * b->orientation.w);
+        if (dp > max_position) max_position = dp;
+        if (1.0f - dot > max_orientation) max_orientation = 1.0f - dot;
+    }
+
+    fe_body_store_destroy(&store);
+    fe_integrate_bench_destroy(pointer_bodies, count);
+    fe_integrate_bench_destroy(store_bodies, count);
+
+    if (max_position > FE_INTEGRATE_BENCH_POSITION_TOLERANCE || max_orientation > FE_INTEGRATE_BENCH_ORIENTATION_TOLERANCE) {
+        printf("  BASARISIZ: %u cisimde yollar ayristi (konum %.2e m, yonelim 1-|q.q| %.2e)\n",
+               count, max_position, max_orientation);
+        return false;
+    }
+    return true;
+}
+
+int main(void) {
+    static const uint32_t counts[] = {1000, 10000, 100000};
+    int failures = 0;
+
+    fe_logger_set_level(FE_LOG_LEVEL_WARN);
+    fe_memory_manager_init();
+
+#ifdef FE_SIMD_WIDTH
+    printf("SIMD genisligi: %d\n", FE_SIMD_WIDTH);
+#else
+    printf("SIMD genisligi: yok (skaler)\n");
+#endif
+    printf("cisim     isaretci cisim/ms   depo cisim/ms   depo+yukle/yaz cisim/ms   hizlanma\n");
+    for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]); ++c) {
+        double rate[3];
+        if (!fe_integrate_bench_run(counts[c], rate)) failures++;
+        printf("  %6u   %17.0f   %13.0f   %23.0f   %6.1fx / %.1fx\n", counts[c], rate[0], rate[1], rate[2],
+               rate[1] / rate[0], rate[2] / rate[0]);
+    }
+
+    fe_memory_manager_shutdown();
+    if (failures == 0) {
+        printf("GECTI\n");
+    }
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,228 @@
+// tests/physics/fe_ragdoll_bench.c
+
+/**
+ * @brief 500 ragdoll uzerinde eklem cozucusu (graf boyamali, fe_job_parallel_for) kiyaslamasi.
+ * * Sahne: statik zemin uzerinde 25x20 izgarada 500 ragdoll; her biri 12 kemik ve 11 eklem
+ * * (bilye-yuva ve mentese), fe_ragdoll_setup_from_skeleton ile kurulur, etkinlestirilir ve 1 m
+ * * yukseklikten duser. 60 Hz sabit adim, uyku kapali; 150 adim, ilk 30 adim olcume katilmaz.
+ * * 1, 2, 4 ve 8 is parcacigi (isci + ana) icin:
+ * * 1. Ortalama cozum ms/adim (fe_physics_step_stats_t::solve_ms), toplam ms/adim ve 1 is
+ * *    parcacigina gore cozum hizlanmasini basar. Mantiksal cekirdekten fazla is parcacigi olan
+ * *    satirlar isaretlenir (duvar saati hizlanmasi beklenmez).
+ * * 2. Son durum tum is parcacigi sayilarinda 1 is parcacikli kosuyla bit bit ayni olmali.
+ * * 3. Son adimda en buyuk eklem acilmasi 10 cm'yi asmamali ve hicbir kemik zeminin altina inmemeli.
+ * *    Govde altinda kalan kollarda temas ve eklem birbiriyle yarisir; dirseklerde birkac cm
+ * *    acilma 8 yinelemede beklenir, sinir kopan eklemleri yakalamak icindir.
+ * * Kontrol tutmazsa 1 ile cikar. fe_ragdoll_destroy cisimleri yoneticiden kaldirarak yok eder.
+ *
+ * Derleme (depo kokunden):
+ *   gcc -O2 -std=c11 -D_GNU_SOURCE -Iinclude tests/physics/fe_ragdoll_bench.c \
+ *       src/physics/fe_ragdoll_physics.c src/physics/fe_physics_manager.c src/physics/fe_island.c \
+ *       src/physics/fe_world.c src/physics/fe_rigid_body.c \
+ *       src/physics/fe_collider.c src/physics/fe_broadphase.c src/physics/fe_narrowphase.c \
+ *       src/physics/fe_collision_solver.c src/physics/fe_physical_materials.c \
+ *       src/physics/fe_constraint_solver.c src/physics/fe_physics_constraint_component.c \
+ *       src/data_structures/fe_array.c src/data_structures/fe_hashmap.c src/math/fe_hash.c \
+ *       src/math/fe_vector.c src/math/fe_matrix.c src/platform/fe_job_system.c src/platform/fe_thread.c \
+ *       src/utils/fe_logger.c src/error/fe_error.c src/memory/fe_memory_manager.c \
+ *       src/memory/fe_allocator_linear.c src/memory/fe_allocator_pool.c \
+ *       src/memory/fe_allocator_size_class.c src/utils/fe_timer.c -lm -lpthread -o fe_ragdoll_bench
+ *   ./fe_ragdoll_bench
+ */
+
+#include "physics/fe_ragdoll_physics.h"
+#include "physics/fe_physics_manager.h"
+#include "memory/fe_memory_manager.h"
+#include "platform/fe_job_system.h"
+#include "platform/fe_thread.h"
+#include "utils/fe_logger.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define FE_RAGDOLL_BENCH_COLUMNS 25
+#define FE_RAGDOLL_BENCH_ROWS 20
+#define FE_RAGDOLL_BENCH_COUNT (FE_RAGDOLL_BENCH_COLUMNS * FE_RAGDOLL_BENCH_ROWS)
+#define FE_RAGDOLL_BENCH_BONES 12
+#define FE_RAGDOLL_BENCH_SPACING 3.0f
+#define FE_RAGDOLL_BENCH_DROP 1.0f
+#define FE_RAGDOLL_BENCH_WARMUP_STEPS 30
+#define FE_RAGDOLL_BENCH_TIMED_STEPS 120
+#define FE_RAGDOLL_BENCH_MAX_JOINT_ERROR 0.10f
+#define FE_RAGDOLL_BENCH_BODY_COUNT (FE_RAGDOLL_BENCH_COUNT * FE_RAGDOLL_BENCH_BONES)
+
+typedef struct fe_ragdoll_bench_result {
+    double solve_ms;
+    double step_ms;
+    float max_joint_error;     // Son adimda eklem noktalarinin en buyuk ayrilmasi (m)
+    float min_height;          // Son adimda en alcak kemik merkezinin yuksekligi (m)
+    fe_vec3_t* positions;      // Son konumlar (kemik sirasiyla, bit bit karsilastirma icin)
+} fe_ragdoll_bench_result_t;
+
+/**
+ * @brief Ayakta duran bir insan iskeleti; (x, z) tabanda, ayaklar y = base_y'de.
+ */
+static void fe_ragdoll_bench_skeleton(fe_ragdoll_bone_desc_t* bones, float x, float base_y, float z) {
+    // ebeveyn, merkez, yari boyut, kutle, eklem, eklem noktasi (tabana gore), mentese ekseni
+    // (T pozu: dirsekler y, dizler x ekseni etrafinda bukulur)
+    static const struct {
+        int32_t parent;
+        float cx, cy, hx, hy, hz, mass;
+        fe_constraint_type_t joint;
+        float jx, jy;
+        float ax, ay, az;
+    } layout[FE_RAGDOLL_BENCH_BONES] = {
+        {-1,  0.00f, 1.00f, 0.15f, 0.10f, 0.10f, 10.0f, FE_CONSTRAINT_BALL_AND_SOCKET,  0.00f, 0.00f, 0.0f, 0.0f, 0.0f}, // pelvis
+        { 0,  0.00f, 1.25f, 0.14f, 0.15f, 0.09f,  8.0f, FE_CONSTRAINT_BALL_AND_SOCKET,  0.00f, 1.10f, 0.0f, 0.0f, 0.0f}, // omurga
+        { 1,  0.00f, 1.52f, 0.18f, 0.12f, 0.10f, 10.0f, FE_CONSTRAINT_BALL_AND_SOCKET,  0.00f, 1.40f, 0.0f, 0.0f, 0.0f}, // gogus
+        { 2,  0.00f, 1.76f, 0.10f, 0.12f, 0.10f,  5.0f, FE_CONSTRAINT_BALL_AND_SOCKET,  0.00f, 1.64f, 0.0f, 0.0f, 0.0f}, // bas
+        { 2, -0.33f, 1.58f, 0.13f, 0.05f, 0.05f,  2.5f, FE_CONSTRAINT_BALL_AND_SOCKET, -0.20f, 1.58f, 0.0f, 0.0f, 0.0f}, // sol ust kol
+        { 4, -0.59f, 1.58f, 0.13f, 0.04f, 0.04f,  1.5f, FE_CONSTRAINT_HINGE,           -0.46f, 1.58f, 0.0f, 1.0f, 0.0f}, // sol on kol
+        { 2,  0.33f, 1.58f, 0.13f, 0.05f, 0.05f,  2.5f, FE_CONSTRAINT_BALL_AND_SOCKET,  0.20f, 1.58f, 0.0f, 0.0f, 0.0f}, // sag ust kol
+        { 6,  0.59f, 1.58f, 0.13f, 0.04f, 0.04f,  1.5f, FE_CONSTRAINT_HINGE,            0.46f, 1.58f, 0.0f, 1.0f, 0.0f}, // sag on kol
+        { 0, -0.10f, 0.69f, 0.07f, 0.21f, 0.07f,  7.0f, FE_CONSTRAINT_BALL_AND_SOCKET, -0.10f, 0.90f, 0.0f, 0.0f, 0.0f}, // sol uyluk
+        { 8, -0.10f, 0.24f, 0.06f, 0.22f, 0.06f,  4.0f, FE_CONSTRAINT_HINGE,           -0.10f, 0.47f, 1.0f, 0.0f, 0.0f}, // sol baldir
+        { 0,  0.10f, 0.69f, 0.07f, 0.21f, 0.07f,  7.0f, FE_CONSTRAINT_BALL_AND_SOCKET,  0.10f, 0.90f, 0.0f, 0.0f, 0.0f}, // sag uyluk
+        {10,  0.10f, 0.24f, 0.06f, 0.22f, 0.06f,  4.0f, FE_CONSTRAINT_HINGE,            0.10f, 0.47f, 1.0f, 0.0f, 0.0f}, // sag baldir
+    };
+    for (uint32_t i = 0; i < FE_RAGDOLL_BENCH_BONES; ++i) {
+        fe_ragdoll_bone_desc_t* bone = &bones[i];
+        bone->parent = layout[i].parent;
+        bone->position = (fe_vec3_t){{x + layout[i].cx, base_y + layout[i].cy, z}};
+        bone->half_extents = (fe_vec3_t){{layout[i].hx, layout[i].hy, layout[i].hz}};
+        bone->mass = layout[i].mass;
+        bone->joint_type = layout[i].joint;
+        bone->joint_position = (fe_vec3_t){{x + layout[i].jx, base_y + layout[i].jy, z}};
+        bone->hinge_axis = (fe_vec3_t){{layout[i].ax, layout[i].ay, layout[i].az}};
+    }
+}
+
+static fe_vec3_t fe_ragdoll_bench_rotate(fe_vec4_t q, fe_vec3_t v) {
+    fe_vec3_t u = {{q.x, q.y, q.z}};
+    fe_vec3_t t = fe_vec3_scale(fe_vec3_cross(u, v), 2.0f);
+    return fe_vec3_add(fe_vec3_add(v, fe_vec3_scale(t, q.w)), fe_vec3_cross(u, t));
+}
+
+/**
+ * @brief Iki cisimli eklemin dunya uzayindaki baglama noktalari arasindaki mesafe.
+ */
+static float fe_ragdoll_bench_joint_error(const fe_physics_constraint_component_t* joint) {
+    const fe_rigid_body_t* a = joint->body_a;
+    const fe_rigid_body_t* b = joint->body_b;
+    fe_vec3_t pa = fe_vec3_add(a->position, fe_ragdoll_bench_rotate(a->orientation, joint->anchor_a_local));
+    fe_vec3_t pb = fe_vec3_add(b->position, fe_ragdoll_bench_rotate(b->orientation, joint->anchor_b_local));
+    return fe_vec3_length(fe_vec3_subtract(pa, pb));
+}
+
+/**
+ * @brief threads is parcacigiyla sahneyi kurar, simule eder ve olcer.
+ */
+static bool fe_ragdoll_bench_run(uint32_t threads, fe_ragdoll_bench_result_t* out) {
+    if (fe_job_system_init(threads - 1) != FE_OK) {
+        printf("  BASARISIZ: is sistemi %u is parcacigiyla baslatilamadi\n", threads);
+        return false;
+    }
+    fe_physics_manager_init();
+    fe_physics_manager_set_sleeping_enabled(false);
+
+    fe_rigid_body_t* ground = fe_rigid_body_create();
+    ground->collider = fe_collider_create_box((fe_vec3_t){{100.0f, 1.0f, 100.0f}});
+    ground->position = (fe_vec3_t){{0.0f, -1.0f, 0.0f}};
+    fe_rigid_body_set_mass_properties(ground, 0.0f, FE_MAT4_IDENTITY);
+    fe_physics_manager_add_rigid_body(ground);
+
+    fe_ragdoll_t** ragdolls = (fe_ragdoll_t**)malloc(sizeof(fe_ragdoll_t*) * FE_RAGDOLL_BENCH_COUNT);
+    fe_ragdoll_bone_desc_t bones[FE_RAGDOLL_BENCH_BONES];
+    for (uint32_t i = 0; i < FE_RAGDOLL_BENCH_COUNT; ++i) {
+        float x = ((float)(i % FE_RAGDOLL_BENCH_COLUMNS) - FE_RAGDOLL_BENCH_COLUMNS * 0.5f) * FE_RAGDOLL_BENCH_SPACING;
+        float z = ((float)(i / FE_RAGDOLL_BENCH_COLUMNS) - FE_RAGDOLL_BENCH_ROWS * 0.5f) * FE_RAGDOLL_BENCH_SPACING;
+        fe_ragdoll_bench_skeleton(bones, x, FE_RAGDOLL_BENCH_DROP, z);
+        ragdolls[i] = fe_ragdoll_create(NULL);
+        if (fe_ragdoll_setup_from_skeleton(ragdolls[i], bones, FE_RAGDOLL_BENCH_BONES) != FE_OK) {
+            printf("  BASARISIZ: ragdoll %u kurulamadi\n", i);
+            return false;
+        }
+        fe_ragdoll_activate(ragdolls[i]);
+        // Her ragdoll farkli yone devrilsin diye gogse kucuk bir yatay hiz
+        fe_rigid_body_t* chest = *(fe_rigid_body_t**)fe_array_get(ragdolls[i]->rigid_bodies, 2);
+        chest->linear_velocity = (fe_vec3_t){{0.5f * cosf((float)i), 0.0f, 0.5f * sinf((float)i)}};
+    }
+
+    double solve = 0.0, step = 0.0;
+    for (int s = 0; s < FE_RAGDOLL_BENCH_WARMUP_STEPS + FE_RAGDOLL_BENCH_TIMED_STEPS; ++s) {
+        fe_physics_manager_step();
+        if (s < FE_RAGDOLL_BENCH_WARMUP_STEPS) continue;
+        fe_physics_step_stats_t stats;
+        fe_physics_manager_get_step_stats(&stats);
+        solve += stats.solve_ms;
+        step += stats.step_ms;
+    }
+    out->solve_ms = solve / FE_RAGDOLL_BENCH_TIMED_STEPS;
+    out->step_ms = step / FE_RAGDOLL_BENCH_TIMED_STEPS;
+
+    out->max_joint_error = 0.0f;
+    out->min_height = 1e30f;
+    out->positions = (fe_vec3_t*)malloc(sizeof(fe_vec3_t) * FE_RAGDOLL_BENCH_BODY_COUNT);
+    for (uint32_t i = 0; i < FE_RAGDOLL_BENCH_COUNT; ++i) {
+        for (size_t j = 0; j < fe_array_count(ragdolls[i]->constraints); ++j) {
+            float error = fe_ragdoll_bench_joint_error(*(fe_physics_constraint_component_t**)fe_array_get(ragdolls[i]->constraints, j));
+            if (error > out->max_joint_error) out->max_joint_error = error;
+        }
+        for (uint32_t j = 0; j < FE_RAGDOLL_BENCH_BONES; ++j) {
+            const fe_rigid_body_t* rb = *(fe_rigid_body_t**)fe_array_get(ragdolls[i]->rigid_bodies, j);
+            out->positions[i * FE_RAGDOLL_BENCH_BONES + j] = rb->position;
+            if (rb->position.y < out->min_height) out->min_height = rb->position.y;
+        }
+        fe_ragdoll_destroy(ragdolls[i]);
+    }
+    free(ragdolls);
+
+    fe_physics_manager_shutdown();
+    fe_job_system_shutdown();
+    return true;
+}
+
+int main(void) {
+    static const uint32_t thread_counts[] = {1, 2, 4, 8};
+    fe_ragdoll_bench_result_t results[sizeof(thread_counts) / sizeof(thread_counts[0])];
+    uint32_t cpu_count = fe_thread_get_cpu_count();
+    int failures = 0;
+
+    fe_logger_set_level(FE_LOG_LEVEL_WARN);
+    fe_memory_manager_init();
+
+    printf("%u ragdoll, %u kemik, %u eklem; mantiksal cekirdek: %u\n", FE_RAGDOLL_BENCH_COUNT,
+           FE_RAGDOLL_BENCH_BODY_COUNT, FE_RAGDOLL_BENCH_COUNT * (FE_RAGDOLL_BENCH_BONES - 1), cpu_count);
+    printf("is parcacigi   cozum ms   adim ms   hizlanma   eklem acilmasi   en alcak kemik\n");
+    for (size_t t = 0; t < sizeof(thread_counts) / sizeof(thread_counts[0]); ++t) {
+        fe_ragdoll_bench_result_t* r = &results[t];
+        if (!fe_ragdoll_bench_run(thread_counts[t], r)) {
+            fe_memory_manager_shutdown();
+            return 1;
+        }
+        printf("  %10u   %8.3f   %7.3f   %7.2fx   %12.4f m   %12.3f m%s\n", thread_counts[t], r->solve_ms, r->step_ms,
+               results[0].solve_ms / r->solve_ms, r->max_joint_error, r->min_height,
+               thread_counts[t] > cpu_count ? "  (cekirdekten fazla)" : "");
+
+        if (r->max_joint_error > FE_RAGDOLL_BENCH_MAX_JOINT_ERROR) {
+            printf("  BASARISIZ: eklem acilmasi %.4f m (en fazla %.2f m)\n", r->max_joint_error, FE_RAGDOLL_BENCH_MAX_JOINT_ERROR);
+            failures++;
+        }
+        if (r->min_height < 0.0f) {
+            printf("  BASARISIZ: kemik zeminin altina indi (y = %.3f m)\n", r->min_height);
+            failures++;
+        }
+        if (t > 0 && memcmp(r->positions, results[0].positions, sizeof(fe_vec3_t) * FE_RAGDOLL_BENCH_BODY_COUNT) != 0) {
+            printf("  BASARISIZ: %u is parcacigiyla sonuc 1 is parcacikli kosudan farkli\n", thread_counts[t]);
+            failures++;
+        }
+    }
+
+    for (size_t t = 0; t < sizeof(thread_counts) / sizeof(thread_counts[0]); ++t) free(results[t].positions);
+    fe_memory_manager_shutdown();
+    if (failures == 0) {
+        printf("GECTI\n");
+    }
+    return failures ? 1 : 0;
+}
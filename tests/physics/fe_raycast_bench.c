@@ -0,0 +1,246 @@
+// tests/physics/fe_raycast_bench.c
+
+/**
+ * @brief Sahne sorgulari icin 100k isin / 10k cisim kiyaslamasi (fe_scene_query_raycast ve _batch).
+ * * Sahne: 200x200x20 m bolgede 10k statik cisim (kure, donuk kutu ve kapsul karisik), her biri
+ * * gercek AABB'siyle broadphase agacina eklenir.
+ * * Iki isin kumesi, 100k isin, en fazla 50 m:
+ * * - Tutarli: 8 isinlik yelpazeler (ayni baslangic, birkac derece acilan yonler; gorus kontrolu/EQS gibi).
+ * * - Rastgele: her isinin baslangici ve yonu bagimsiz (isinlar tek tek, genis agacta gezilir).
+ * * 1. Her kume icin tek isin dongusu ve toplu (paketli, SIMD) cozum icin en iyi 3 kosuda ms ve ms basina
+ * *    isin basar; kullanilan SIMD genisligi derleme bayraklarina baglidir (-mavx: 8, SSE2: 4).
+ * * 2. Toplu sonuclar tum isinlarda tek isin sonuclariyla ayni olmali (ayni cisim, mesafe 1e-4 m icinde).
+ * * 3. Tek isin sonuclari %1'lik ornekte kaba kuvvetle (her cisim tek basina bir agacta) ayni olmali.
+ * * 4. Toplu cozum tek isin dongusunden en az FE_RAY_BENCH_MIN_SPEEDUP_COHERENT (tutarli) ve
+ * *    FE_RAY_BENCH_MIN_SPEEDUP_RANDOM (rastgele) kat hizli olmali.
+ * * Kontrol tutmazsa 1 ile cikar.
+ *
+ * Derleme (depo kokunden; -mavx istege bagli):
+ *   gcc -O2 -mavx -std=c11 -D_GNU_SOURCE -Iinclude tests/physics/fe_raycast_bench.c \
+ *       src/physics/fe_scene_query.c src/physics/fe_narrowphase.c src/physics/fe_broadphase.c \
+ *       src/physics/fe_collider.c src/physics/fe_rigid_body.c src/physics/fe_physical_materials.c \
+ *       src/data_structures/fe_hashmap.c src/math/fe_hash.c src/math/fe_vector.c src/math/fe_matrix.c \
+ *       src/platform/fe_thread.c src/utils/fe_logger.c src/error/fe_error.c src/memory/fe_memory_manager.c \
+ *       src/memory/fe_allocator_linear.c src/memory/fe_allocator_pool.c \
+ *       src/memory/fe_allocator_size_class.c -lm -lpthread -o fe_raycast_bench
+ *   ./fe_raycast_bench
+ */
+
+#include "physics/fe_scene_query.h"
+#include "math/fe_simd.h"
+#include "memory/fe_memory_manager.h"
+#include "utils/fe_logger.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <float.h>
+#include <time.h>
+
+#define FE_RAY_BENCH_BODIES 10000
+#define FE_RAY_BENCH_RAYS 100000
+#define FE_RAY_BENCH_MAX_DISTANCE 50.0f
+#define FE_RAY_BENCH_WORLD_HALF 100.0f
+#define FE_RAY_BENCH_WORLD_HEIGHT 20.0f
+#define FE_RAY_BENCH_FAN_SPREAD 0.05f
+#define FE_RAY_BENCH_REPEATS 3
+#define FE_RAY_BENCH_BRUTE_STRIDE 100
+#define FE_RAY_BENCH_DISTANCE_TOLERANCE 1e-4f
+#define FE_RAY_BENCH_MIN_SPEEDUP_COHERENT 1.5
+#define FE_RAY_BENCH_MIN_SPEEDUP_RANDOM 1.3
+
+static double fe_ray_bench_now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e3 + (double)ts.tv_nsec * 1e-6;
+}
+
+static inline float fe_ray_bench_randf(uint32_t* state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return (float)(*state >> 8) * (1.0f / 16777216.0f);
+}
+
+static fe_vec3_t fe_ray_bench_random_direction(uint32_t* state) {
+    for (;;) {
+        fe_vec3_t d = {{fe_ray_bench_randf(state) * 2.0f - 1.0f, fe_ray_bench_randf(state) * 2.0f - 1.0f,
+                        fe_ray_bench_randf(state) * 2.0f - 1.0f}};
+        float len = fe_vec3_length(d);
+        if (len > 0.1f && len <= 1.0f) return fe_vec3_scale(d, 1.0f / len);
+    }
+}
+
+static fe_vec3_t fe_ray_bench_random_point(uint32_t* state) {
+    return (fe_vec3_t){{(fe_ray_bench_randf(state) * 2.0f - 1.0f) * FE_RAY_BENCH_WORLD_HALF,
+                        fe_ray_bench_randf(state) * FE_RAY_BENCH_WORLD_HEIGHT,
+                        (fe_ray_bench_randf(state) * 2.0f - 1.0f) * FE_RAY_BENCH_WORLD_HALF}};
+}
+
+/**
+ * @brief Karisik statik cisimleri olusturur ve agaca ekler.
+ */
+static void fe_ray_bench_build(fe_broadphase_t* bp, fe_rigid_body_t** bodies) {
+    uint32_t state = 0x1B873593u;
+    for (uint32_t i = 0; i < FE_RAY_BENCH_BODIES; ++i) {
+        fe_rigid_body_t* rb = fe_rigid_body_create();
+        float size = 0.3f + 1.2f * fe_ray_bench_randf(&state);
+        switch (i % 3) {
+            case 0: rb->collider = fe_collider_create_sphere(size); break;
+            case 1: rb->collider = fe_collider_create_box((fe_vec3_t){{size, 0.5f * size + 0.2f, 0.7f * size}}); break;
+            default: rb->collider = fe_collider_create_capsule(0.4f * size, size); break;
+        }
+        rb->position = fe_ray_bench_random_point(&state);
+        fe_vec3_t axis = fe_ray_bench_random_direction(&state);
+        float half_angle = fe_ray_bench_randf(&state) * 3.14159265f * 0.5f;
+        float s = sinf(half_angle);
+        rb->orientation = (fe_vec4_t){{axis.x * s, axis.y * s, axis.z * s, cosf(half_angle)}};
+        fe_rigid_body_set_mass_properties(rb, 0.0f, FE_MAT4_IDENTITY);
+        fe_collider_compute_aabb(rb->collider, rb->position, rb->orientation, &rb->collider->world_aabb);
+        rb->collider->proxy_id = fe_broadphase_create_proxy(bp, &rb->collider->world_aabb, rb);
+        bodies[i] = rb;
+    }
+}
+
+/**
+ * @brief coherent ise 8'li yelpazeler, degilse bagimsiz isinlar uretir.
+ */
+static void fe_ray_bench_make_rays(fe_ray_t* rays, bool coherent) {
+    uint32_t state = coherent ? 0x85EBCA6Bu : 0xC2B2AE35u;
+    fe_vec3_t origin = {{0.0f, 0.0f, 0.0f}}, forward = {{1.0f, 0.0f, 0.0f}};
+    for (uint32_t i = 0; i < FE_RAY_BENCH_RAYS; ++i) {
+        fe_ray_t* ray = &rays[i];
+        if (!coherent || i % FE_SCENE_QUERY_PACKET_SIZE == 0) {
+            origin = fe_ray_bench_random_point(&state);
+            forward = fe_ray_bench_random_direction(&state);
+        }
+        fe_vec3_t direction = forward;
+        if (coherent) {
+            fe_vec3_t jitter = fe_vec3_scale(fe_ray_bench_random_direction(&state), FE_RAY_BENCH_FAN_SPREAD);
+            direction = fe_vec3_normalize(fe_vec3_add(forward, jitter));
+        }
+        ray->origin = origin;
+        ray->direction = direction;
+        ray->max_distance = FE_RAY_BENCH_MAX_DISTANCE * (0.5f + 0.5f * fe_ray_bench_randf(&state));
+        ray->ignore_body = NULL;
+    }
+}
+
+static bool fe_ray_bench_same_hit(const fe_query_hit_t* a, const fe_query_hit_t* b) {
+    if (a->body != b->body) return false;
+    return !a->body || fabsf(a->distance - b->distance) <= FE_RAY_BENCH_DISTANCE_TOLERANCE;
+}
+
+/**
+ * @brief Her FE_RAY_BENCH_BRUTE_STRIDE'inci isini her cisme tek tek (tek yaprakli agacta) atar.
+ * @return Uyusmayan isin sayisi.
+ */
+static uint32_t fe_ray_bench_brute_force(const fe_ray_t* rays, const fe_query_hit_t* hits, fe_rigid_body_t** bodies) {
+    const uint32_t sample = FE_RAY_BENCH_RAYS / FE_RAY_BENCH_BRUTE_STRIDE;
+    fe_query_hit_t* best = (fe_query_hit_t*)calloc(sample, sizeof(fe_query_hit_t));
+    for (uint32_t k = 0; k < sample; ++k) best[k].distance = FLT_MAX;
+
+    fe_broadphase_t single;
+    fe_broadphase_init(&single);
+    for (uint32_t i = 0; i < FE_RAY_BENCH_BODIES; ++i) {
+        uint32_t proxy = fe_broadphase_create_proxy(&single, &bodies[i]->collider->world_aabb, bodies[i]);
+        for (uint32_t k = 0; k < sample; ++k) {
+            fe_query_hit_t hit;
+            if (fe_scene_query_raycast(&single, &rays[k * FE_RAY_BENCH_BRUTE_STRIDE], &hit) && hit.distance < best[k].distance) {
+                best[k] = hit;
+            }
+        }
+        fe_broadphase_destroy_proxy(&single, proxy);
+    }
+    fe_broadphase_destroy(&single);
+
+    uint32_t mismatches = 0;
+    for (uint32_t k = 0; k < sample; ++k) {
+        if (!fe_ray_bench_same_hit(&best[k], &hits[k * FE_RAY_BENCH_BRUTE_STRIDE])) mismatches++;
+    }
+    free(best);
+    return mismatches;
+}
+
+/**
+ * @brief Bir isin kumesini iki yolla olcer ve dogrular.
+ * @return Basarisiz kontrol sayisi.
+ */
+static int fe_ray_bench_run(const char* name, const fe_broadphase_t* bp, fe_rigid_body_t** bodies, bool coherent, double min_speedup) {
+    fe_ray_t* rays = (fe_ray_t*)malloc(sizeof(fe_ray_t) * FE_RAY_BENCH_RAYS);
+    fe_query_hit_t* single_hits = (fe_query_hit_t*)malloc(sizeof(fe_query_hit_t) * FE_RAY_BENCH_RAYS);
+    fe_query_hit_t* batch_hits = (fe_query_hit_t*)malloc(sizeof(fe_query_hit_t) * FE_RAY_BENCH_RAYS);
+    fe_ray_bench_make_rays(rays, coherent);
+
+    double single_ms = 1e30, batch_ms = 1e30;
+    uint32_t hit_count = 0;
+    for (int r = 0; r < FE_RAY_BENCH_REPEATS; ++r) {
+        double start = fe_ray_bench_now_ms();
+        for (uint32_t i = 0; i < FE_RAY_BENCH_RAYS; ++i) {
+            if (!fe_scene_query_raycast(bp, &rays[i], &single_hits[i])) single_hits[i].body = NULL;
+        }
+        double elapsed = fe_ray_bench_now_ms() - start;
+        if (elapsed < single_ms) single_ms = elapsed;
+
+        start = fe_ray_bench_now_ms();
+        hit_count = fe_scene_query_raycast_batch(bp, rays, FE_RAY_BENCH_RAYS, batch_hits);
+        elapsed = fe_ray_bench_now_ms() - start;
+        if (elapsed < batch_ms) batch_ms = elapsed;
+    }
+
+    printf("  %-9s  %9.1f  %10.0f   %8.1f  %10.0f   %6.2fx   %5.1f%%\n", name, single_ms, FE_RAY_BENCH_RAYS / single_ms,
+           batch_ms, FE_RAY_BENCH_RAYS / batch_ms, single_ms / batch_ms, 100.0 * hit_count / FE_RAY_BENCH_RAYS);
+
+    int failures = 0;
+    if (single_ms / batch_ms < min_speedup) {
+        printf("  BASARISIZ: toplu hizlanma %.2fx (en az %.2fx)\n", single_ms / batch_ms, min_speedup);
+        failures++;
+    }
+    uint32_t batch_mismatches = 0;
+    for (uint32_t i = 0; i < FE_RAY_BENCH_RAYS; ++i) {
+        if (!fe_ray_bench_same_hit(&single_hits[i], &batch_hits[i])) batch_mismatches++;
+    }
+    if (batch_mismatches != 0) {
+        printf("  BASARISIZ: %u isinda toplu sonuc tek isin sonucundan farkli\n", batch_mismatches);
+        failures++;
+    }
+    uint32_t brute_mismatches = fe_ray_bench_brute_force(rays, single_hits, bodies);
+    if (brute_mismatches != 0) {
+        printf("  BASARISIZ: %u ornek isinda tek isin sonucu kaba kuvvetten farkli\n", brute_mismatches);
+        failures++;
+    }
+
+    free(batch_hits);
+    free(single_hits);
+    free(rays);
+    return failures;
+}
+
+int main(void) {
+    fe_rigid_body_t** bodies = (fe_rigid_body_t**)malloc(sizeof(fe_rigid_body_t*) * FE_RAY_BENCH_BODIES);
+    fe_broadphase_t bp;
+    int failures = 0;
+
+    fe_logger_set_level(FE_LOG_LEVEL_WARN);
+    fe_memory_manager_init();
+    fe_broadphase_init(&bp);
+    fe_ray_bench_build(&bp, bodies);
+
+#ifdef FE_SIMD_WIDTH
+    printf("SIMD genisligi: %d\n", FE_SIMD_WIDTH);
+#else
+    printf("SIMD genisligi: yok (skaler)\n");
+#endif
+    printf("%d cisim, %d isin (en fazla %.0f m)\n", FE_RAY_BENCH_BODIES, FE_RAY_BENCH_RAYS, FE_RAY_BENCH_MAX_DISTANCE);
+    printf("  kume        tek ms   tek isin/ms   toplu ms  toplu isin/ms   hizlanma   isabet\n");
+    failures += fe_ray_bench_run("tutarli", &bp, bodies, true, FE_RAY_BENCH_MIN_SPEEDUP_COHERENT);
+    failures += fe_ray_bench_run("rastgele", &bp, bodies, false, FE_RAY_BENCH_MIN_SPEEDUP_RANDOM);
+
+    fe_broadphase_destroy(&bp);
+    for (uint32_t i = 0; i < FE_RAY_BENCH_BODIES; ++i) fe_rigid_body_destroy(bodies[i]);
+    free(bodies);
+    fe_memory_manager_shutdown();
+    if (failures == 0) {
+        printf("GECTI\n");
+    }
+    return failures ? 1 : 0;
+}
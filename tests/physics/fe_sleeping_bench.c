@@ -0,0 +1,193 @@
+// tests/physics/fe_sleeping_bench.c
+
+/**
+ * @brief Ada uykusu icin 20k cisimlik oturmus sahne kiyaslamasi.
+ * * Sahne: statik zemin uzerinde 100x100 sutun, her sutunda ust uste 2 kutu (20000 dinamik cisim);
+ * * sutunlar birbirine degmez (her sutun ayri bir adadir). 60 Hz sabit adim.
+ * * Uyku acik ve kapali iki kosu: 3 s oturma, ardindan 60 adim olcum.
+ * * 1. Olcum adimlarinda ortalama ms/adim, uyanik cisim ve ada sayisini basar.
+ * * 2. Uyku acikken tum cisimler uyumali ve adim suresi uyku kapaliyken olcule en az 10 kat dusmeli.
+ * *    Tamamen uyuyan sahnenin adimi FE_SLEEP_BENCH_ASLEEP_BUDGET_MS'yi asmamali: adim cift, manifold
+ * *    ve eklem listelerini degil uyanik cisimleri gezer, maliyeti sahne boyutundan bagimsizdir.
+ * * 3. Bir sutunun ust kutusu uyandirilip itildiginde sadece o sutunun 2 kutusu uyanmali; tekrar
+ * *    oturduklarinda yeniden uyumalidir.
+ * * Herhangi bir kontrol tutmazsa 1 ile cikar.
+ *
+ * Derleme (depo kokunden):
+ *   gcc -O2 -std=c11 -D_GNU_SOURCE -Iinclude tests/physics/fe_sleeping_bench.c \
+ *       src/physics/fe_physics_manager.c src/physics/fe_island.c \
+ *       src/physics/fe_world.c src/physics/fe_rigid_body.c src/physics/fe_collider.c \
+ *       src/physics/fe_broadphase.c src/physics/fe_narrowphase.c src/physics/fe_collision_solver.c \
+ *       src/physics/fe_physical_materials.c src/physics/fe_constraint_solver.c \
+ *       src/physics/fe_physics_constraint_component.c src/data_structures/fe_array.c \
+ *       src/data_structures/fe_hashmap.c src/math/fe_hash.c src/math/fe_vector.c \
+ *       src/math/fe_matrix.c src/platform/fe_job_system.c src/platform/fe_thread.c \
+ *       src/utils/fe_logger.c src/error/fe_error.c src/memory/fe_memory_manager.c \
+ *       src/memory/fe_allocator_linear.c src/memory/fe_allocator_pool.c \
+ *       src/memory/fe_allocator_size_class.c src/utils/fe_timer.c -lm -lpthread -o fe_sleeping_bench
+ *   ./fe_sleeping_bench
+ */
+
+#include "physics/fe_physics_manager.h"
+#include "memory/fe_memory_manager.h"
+#include "utils/fe_logger.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define FE_SLEEP_BENCH_SIDE 100
+#define FE_SLEEP_BENCH_STACK 2
+#define FE_SLEEP_BENCH_BODIES (FE_SLEEP_BENCH_SIDE * FE_SLEEP_BENCH_SIDE * FE_SLEEP_BENCH_STACK)
+#define FE_SLEEP_BENCH_SETTLE_STEPS 180
+#define FE_SLEEP_BENCH_TIMED_STEPS 60
+#define FE_SLEEP_BENCH_MIN_SPEEDUP 10.0
+#define FE_SLEEP_BENCH_ASLEEP_BUDGET_MS 0.01
+#define FE_SLEEP_BENCH_BOX_HALF 0.5f
+#define FE_SLEEP_BENCH_SPACING 1.5f
+
+typedef struct fe_sleep_bench_result {
+    double step_ms;
+    uint32_t awake_bodies;
+    uint32_t island_count;
+} fe_sleep_bench_result_t;
+
+static fe_mat4_t fe_sleep_bench_box_inertia(float mass, float half) {
+    fe_mat4_t inertia = FE_MAT4_IDENTITY;
+    float value = mass * (2.0f * half) * (2.0f * half) / 6.0f;
+    for (int i = 0; i < 3; ++i) {
+        inertia.mm[i][i] = value;
+    }
+    return inertia;
+}
+
+static uint32_t fe_sleep_bench_count_awake(fe_rigid_body_t** bodies) {
+    uint32_t awake = 0;
+    for (uint32_t i = 0; i < FE_SLEEP_BENCH_BODIES; ++i) {
+        if (bodies[i]->is_awake) ++awake;
+    }
+    return awake;
+}
+
+/**
+ * @brief Sahneyi kurar (yonetici baslatilmis olmali); bodies dizisi sutun sutun doldurulur.
+ */
+static void fe_sleep_bench_build(fe_rigid_body_t** bodies) {
+    const float h = FE_SLEEP_BENCH_BOX_HALF;
+    const float extent = FE_SLEEP_BENCH_SIDE * FE_SLEEP_BENCH_SPACING * 0.5f;
+
+    fe_rigid_body_t* ground = fe_rigid_body_create();
+    ground->collider = fe_collider_create_box((fe_vec3_t){{extent + 10.0f, 1.0f, extent + 10.0f}});
+    ground->position = (fe_vec3_t){{0.0f, -1.0f, 0.0f}};
+    fe_rigid_body_set_mass_properties(ground, 0.0f, FE_MAT4_IDENTITY);
+    fe_physics_manager_add_rigid_body(ground);
+
+    const fe_mat4_t inertia = fe_sleep_bench_box_inertia(1.0f, h);
+    uint32_t index = 0;
+    for (uint32_t x = 0; x < FE_SLEEP_BENCH_SIDE; ++x) {
+        for (uint32_t z = 0; z < FE_SLEEP_BENCH_SIDE; ++z) {
+            for (uint32_t level = 0; level < FE_SLEEP_BENCH_STACK; ++level) {
+                fe_rigid_body_t* box = fe_rigid_body_create();
+                box->collider = fe_collider_create_box((fe_vec3_t){{h, h, h}});
+                box->position = (fe_vec3_t){{(float)x * FE_SLEEP_BENCH_SPACING - extent,
+                                             h + (float)level * (2.0f * h + 0.005f),
+                                             (float)z * FE_SLEEP_BENCH_SPACING - extent}};
+                fe_rigid_body_set_mass_properties(box, 1.0f, inertia);
+                bodies[index++] = box;
+            }
+        }
+    }
+    fe_physics_manager_add_rigid_bodies(bodies, FE_SLEEP_BENCH_BODIES);
+}
+
+/**
+ * @brief Sahneyi oturtur ve FE_SLEEP_BENCH_TIMED_STEPS adimi olcer.
+ */
+static void fe_sleep_bench_measure(fe_sleep_bench_result_t* out) {
+    for (int s = 0; s < FE_SLEEP_BENCH_SETTLE_STEPS; ++s) {
+        fe_physics_manager_step();
+    }
+
+    fe_physics_step_stats_t stats = {0};
+    double total = 0.0;
+    for (int s = 0; s < FE_SLEEP_BENCH_TIMED_STEPS; ++s) {
+        fe_physics_manager_step();
+        fe_physics_manager_get_step_stats(&stats);
+        total += stats.step_ms;
+    }
+    out->step_ms = total / FE_SLEEP_BENCH_TIMED_STEPS;
+    out->awake_bodies = stats.awake_bodies;
+    out->island_count = stats.island_count;
+}
+
+int main(void) {
+    fe_rigid_body_t** bodies = (fe_rigid_body_t**)malloc(sizeof(fe_rigid_body_t*) * FE_SLEEP_BENCH_BODIES);
+    fe_sleep_bench_result_t awake_run, sleep_run;
+    int failures = 0;
+
+    fe_logger_set_level(FE_LOG_LEVEL_WARN);
+    fe_memory_manager_init();
+
+    // Uyku kapali: her adimda 20k cisim entegre edilir ve tum temaslar cozulur
+    fe_physics_manager_init();
+    fe_physics_manager_set_sleeping_enabled(false);
+    fe_sleep_bench_build(bodies);
+    fe_sleep_bench_measure(&awake_run);
+    fe_physics_manager_shutdown();
+
+    // Uyku acik
+    fe_physics_manager_init();
+    fe_physics_manager_set_sleeping_enabled(true);
+    fe_sleep_bench_build(bodies);
+    fe_sleep_bench_measure(&sleep_run);
+    uint32_t sleeping_awake = fe_sleep_bench_count_awake(bodies);
+
+    printf("%u dinamik cisim, %d sutun\n", FE_SLEEP_BENCH_BODIES, FE_SLEEP_BENCH_SIDE * FE_SLEEP_BENCH_SIDE);
+    printf("  uyku kapali: %8.3f ms/adim, %5u uyanik cisim, %5u ada\n",
+           awake_run.step_ms, awake_run.awake_bodies, awake_run.island_count);
+    printf("  uyku acik:   %8.4f ms/adim, %5u uyanik cisim, %5u ada (%.0fx)\n",
+           sleep_run.step_ms, sleep_run.awake_bodies, sleep_run.island_count,
+           awake_run.step_ms / (sleep_run.step_ms > 0.0 ? sleep_run.step_ms : 1e-6));
+
+    if (sleeping_awake != 0) {
+        printf("  BASARISIZ: oturmus sahnede %u cisim hala uyanik\n", sleeping_awake);
+        failures++;
+    }
+    if (awake_run.step_ms < FE_SLEEP_BENCH_MIN_SPEEDUP * sleep_run.step_ms) {
+        printf("  BASARISIZ: uyku adim suresini %.0f kat dusurmedi\n", FE_SLEEP_BENCH_MIN_SPEEDUP);
+        failures++;
+    }
+    if (sleep_run.step_ms > FE_SLEEP_BENCH_ASLEEP_BUDGET_MS) {
+        printf("  BASARISIZ: uyuyan sahnenin adimi %.4f ms (butce %.2f ms)\n", sleep_run.step_ms, FE_SLEEP_BENCH_ASLEEP_BUDGET_MS);
+        failures++;
+    }
+
+    // Tek sutunu uyandir ve it: sadece o ada uyanmali, sonra tekrar uyumali
+    fe_rigid_body_t* top = bodies[(FE_SLEEP_BENCH_SIDE * FE_SLEEP_BENCH_SIDE / 2) * FE_SLEEP_BENCH_STACK + 1];
+    fe_physics_manager_wake_rigid_body(top);
+    top->linear_velocity = (fe_vec3_t){{0.3f, 0.0f, 0.0f}};
+    fe_physics_manager_step();
+    uint32_t woken = fe_sleep_bench_count_awake(bodies);
+    fe_physics_step_stats_t stats;
+    fe_physics_manager_get_step_stats(&stats);
+    printf("  bir sutun itildi: %u uyanik cisim, %.3f ms/adim\n", woken, stats.step_ms);
+    if (woken != FE_SLEEP_BENCH_STACK) {
+        printf("  BASARISIZ: %u cisim uyandi (beklenen %d)\n", woken, FE_SLEEP_BENCH_STACK);
+        failures++;
+    }
+
+    for (int s = 0; s < FE_SLEEP_BENCH_SETTLE_STEPS; ++s) {
+        fe_physics_manager_step();
+    }
+    uint32_t still_awake = fe_sleep_bench_count_awake(bodies);
+    if (still_awake != 0) {
+        printf("  BASARISIZ: itilen sutun %d adimda uyumadi (%u uyanik)\n", FE_SLEEP_BENCH_SETTLE_STEPS, still_awake);
+        failures++;
+    }
+
+    fe_physics_manager_shutdown();
+    fe_memory_manager_shutdown();
+    free(bodies);
+    if (failures == 0) {
+        printf("GECTI\n");
+    }
+    return failures ? 1 : 0;
+}
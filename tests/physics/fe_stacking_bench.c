@@ -0,0 +1,175 @@
+// tests/physics/fe_stacking_bench.c
+
+/**
+ * @brief Piramit yigini uzerinde temas cozucusu (alt adimli ardisik impuls + sicak baslatma) kiyaslamasi.
+ * * Sahne: tabaninda 10, 20 ve 30 kutu (1 m) olan 2B piramitler (55, 210 ve 465 kutu), statik zemin,
+ * * 60 Hz sabit adim, uyku kapali (cozucu her adim tum yigini cozer). 5 s (300 adim) simule edilir.
+ * * Her piramit icin sicak baslatma acik/kapali ve farkli alt adim basina hiz yinelemeleriyle
+ * * (alt adim sayisi FE_SOLVER_SUBSTEPS):
+ * * 1. Ortalama cozum ms/adim (fe_physics_step_stats_t::solve_ms) ve toplam ms/adim basar.
+ * * 2. Kararlilik: herhangi bir kutunun baslangictan en buyuk yatay kaymasi, tepe kutunun cokmesi
+ * *    ve son adimdaki en buyuk hiz.
+ * * Ayakta kalma: kayma < 5 cm, tepe cokmesi < 5 cm ve son hiz < 0.05 m/s. Kontroller (tutmazsa 1 ile cikar):
+ * * - Varsayilan ayarlarla (sicak baslatma, FE_SOLVER_VELOCITY_ITERATIONS) 10, 20 ve 30 tabanli
+ * *   piramitlerin hepsi ayakta kalir.
+ * * - Varsayilan ayarlarla 30 tabanli piramidin cozumu FE_STACK_BENCH_BASE30_BUDGET_MS altinda kalir.
+ * * Diger satirlar (sicak baslatmasiz, 1 ve 4 yineleme) karsilastirma icindir ve kontrol edilmez.
+ *
+ * Derleme (depo kokunden):
+ *   gcc -O2 -std=c11 -D_GNU_SOURCE -Iinclude tests/physics/fe_stacking_bench.c \
+ *       src/physics/fe_physics_manager.c src/physics/fe_island.c \
+ *       src/physics/fe_world.c src/physics/fe_rigid_body.c src/physics/fe_collider.c \
+ *       src/physics/fe_broadphase.c src/physics/fe_narrowphase.c src/physics/fe_collision_solver.c \
+ *       src/physics/fe_physical_materials.c src/physics/fe_constraint_solver.c \
+ *       src/physics/fe_physics_constraint_component.c src/data_structures/fe_array.c \
+ *       src/data_structures/fe_hashmap.c src/math/fe_hash.c src/math/fe_vector.c \
+ *       src/math/fe_matrix.c src/platform/fe_job_system.c src/platform/fe_thread.c \
+ *       src/utils/fe_logger.c src/error/fe_error.c src/memory/fe_memory_manager.c \
+ *       src/memory/fe_allocator_linear.c src/memory/fe_allocator_pool.c \
+ *       src/memory/fe_allocator_size_class.c src/utils/fe_timer.c -lm -lpthread -o fe_stacking_bench
+ *   ./fe_stacking_bench
+ */
+
+#include "physics/fe_physics_manager.h"
+#include "memory/fe_memory_manager.h"
+#include "utils/fe_logger.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#define FE_STACK_BENCH_STEPS 300
+#define FE_STACK_BENCH_BOX_HALF 0.5f
+#define FE_STACK_BENCH_MAX_DRIFT 0.05f
+#define FE_STACK_BENCH_MAX_SAG 0.05f
+#define FE_STACK_BENCH_MAX_SPEED 0.05f
+#define FE_STACK_BENCH_BASE30_BUDGET_MS 8.0
+
+typedef struct fe_stack_bench_result {
+    double solve_ms;
+    double step_ms;
+    float max_drift;        // En buyuk yatay kayma (m)
+    float top_sag;          // Tepe kutunun baslangica gore cokmesi (m, yukselirse negatif)
+    float max_speed;        // Son adimdaki en buyuk dogrusal hiz (m/s)
+} fe_stack_bench_result_t;
+
+static fe_mat4_t fe_stack_bench_box_inertia(float mass, float half) {
+    fe_mat4_t inertia = FE_MAT4_IDENTITY;
+    float value = mass * (2.0f * half) * (2.0f * half) / 6.0f;
+    for (int i = 0; i < 3; ++i) {
+        inertia.mm[i][i] = value;
+    }
+    return inertia;
+}
+
+/**
+ * @brief base kutu tabanli piramidi kurar, FE_STACK_BENCH_STEPS adim simule eder ve olcer.
+ */
+static void fe_stack_bench_run(uint32_t base, bool warm_starting, uint32_t iterations, fe_stack_bench_result_t* out) {
+    const float h = FE_STACK_BENCH_BOX_HALF;
+    uint32_t box_count = base * (base + 1) / 2;
+    fe_rigid_body_t** boxes = (fe_rigid_body_t**)malloc(sizeof(fe_rigid_body_t*) * box_count);
+    fe_vec3_t* start = (fe_vec3_t*)malloc(sizeof(fe_vec3_t) * box_count);
+
+    fe_physics_manager_init();
+    fe_physics_manager_set_sleeping_enabled(false);
+    fe_collision_solver_t* solver = fe_physics_manager_get_collision_solver();
+    solver->warm_starting = warm_starting;
+    solver->velocity_iterations = iterations;
+
+    fe_rigid_body_t* ground = fe_rigid_body_create();
+    ground->collider = fe_collider_create_box((fe_vec3_t){{100.0f, 1.0f, 100.0f}});
+    ground->position = (fe_vec3_t){{0.0f, -1.0f, 0.0f}};
+    fe_rigid_body_set_mass_properties(ground, 0.0f, FE_MAT4_IDENTITY);
+    fe_physics_manager_add_rigid_body(ground);
+
+    // Her sira bir oncekinin ustune yarim kutu kaydirilarak dizilir; kutular arasinda 1 cm bosluk
+    const fe_mat4_t inertia = fe_stack_bench_box_inertia(1.0f, h);
+    uint32_t index = 0;
+    for (uint32_t row = 0; row < base; ++row) {
+        uint32_t row_count = base - row;
+        float x0 = -((float)row_count - 1.0f) * (h + 0.005f);
+        for (uint32_t i = 0; i < row_count; ++i) {
+            fe_rigid_body_t* box = fe_rigid_body_create();
+            box->collider = fe_collider_create_box((fe_vec3_t){{h, h, h}});
+            box->position = (fe_vec3_t){{x0 + (float)i * (2.0f * h + 0.01f), h + (float)row * 2.0f * h, 0.0f}};
+            fe_rigid_body_set_mass_properties(box, 1.0f, inertia);
+            fe_physics_manager_add_rigid_body(box);
+            start[index] = box->position;
+            boxes[index++] = box;
+        }
+    }
+
+    double solve = 0.0, step = 0.0;
+    for (int s = 0; s < FE_STACK_BENCH_STEPS; ++s) {
+        fe_physics_manager_step();
+        fe_physics_step_stats_t stats;
+        fe_physics_manager_get_step_stats(&stats);
+        solve += stats.solve_ms;
+        step += stats.step_ms;
+    }
+
+    out->solve_ms = solve / FE_STACK_BENCH_STEPS;
+    out->step_ms = step / FE_STACK_BENCH_STEPS;
+    out->max_drift = 0.0f;
+    out->max_speed = 0.0f;
+    for (uint32_t i = 0; i < box_count; ++i) {
+        float dx = boxes[i]->position.x - start[i].x;
+        float dz = boxes[i]->position.z - start[i].z;
+        float drift = sqrtf(dx * dx + dz * dz);
+        float speed = fe_vec3_length(boxes[i]->linear_velocity);
+        if (drift > out->max_drift) out->max_drift = drift;
+        if (speed > out->max_speed) out->max_speed = speed;
+    }
+    out->top_sag = start[box_count - 1].y - boxes[box_count - 1]->position.y;
+
+    fe_physics_manager_shutdown(); // Cisimleri de yok eder
+    free(start);
+    free(boxes);
+}
+
+int main(void) {
+    static const uint32_t bases[] = {10, 20, 30};
+    static const struct {
+        bool warm_starting;
+        uint32_t iterations;       // Alt adim basina
+        bool checked;              // Tum piramitler ayakta kalmali
+    } configs[] = {
+        {true,  FE_SOLVER_VELOCITY_ITERATIONS, true},
+        {true,  1, false},
+        {true,  4, false},
+        {false, FE_SOLVER_VELOCITY_ITERATIONS, false},
+    };
+    int failures = 0;
+
+    fe_logger_set_level(FE_LOG_LEVEL_WARN);
+    fe_memory_manager_init();
+
+    printf("%u alt adim\n", (unsigned)FE_SOLVER_SUBSTEPS);
+    printf("taban  kutu  sicak  yineleme   cozum ms  adim ms   en buyuk kayma  tepe cokmesi  son hiz\n");
+    for (size_t b = 0; b < sizeof(bases) / sizeof(bases[0]); ++b) {
+        for (size_t c = 0; c < sizeof(configs) / sizeof(configs[0]); ++c) {
+            fe_stack_bench_result_t r;
+            fe_stack_bench_run(bases[b], configs[c].warm_starting, configs[c].iterations, &r);
+            printf("  %3u  %4u  %5s  %8u   %8.3f  %7.3f   %12.4f m  %10.4f m  %5.3f m/s\n",
+                   bases[b], bases[b] * (bases[b] + 1) / 2, configs[c].warm_starting ? "acik" : "kapali",
+                   configs[c].iterations, r.solve_ms, r.step_ms, r.max_drift, r.top_sag, r.max_speed);
+
+            bool standing = r.max_drift <= FE_STACK_BENCH_MAX_DRIFT && fabsf(r.top_sag) <= FE_STACK_BENCH_MAX_SAG &&
+                            r.max_speed <= FE_STACK_BENCH_MAX_SPEED;
+            if (configs[c].checked && !standing) {
+                printf("  BASARISIZ: %u yinelemeyle %u tabanli piramit ayakta kalmadi\n", configs[c].iterations, bases[b]);
+                failures++;
+            }
+            if (configs[c].checked && bases[b] == 30 && r.solve_ms > FE_STACK_BENCH_BASE30_BUDGET_MS) {
+                printf("  BASARISIZ: 30 tabanli piramit cozumu %.3f ms (butce %.1f ms)\n", r.solve_ms, FE_STACK_BENCH_BASE30_BUDGET_MS);
+                failures++;
+            }
+        }
+    }
+
+    fe_memory_manager_shutdown();
+    if (failures == 0) {
+        printf("GECTI\n");
+    }
+    return failures ? 1 : 0;
+}
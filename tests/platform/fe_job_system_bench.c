@@ -0,0 +1,201 @@
+// tests/platform/fe_job_system_bench.c
+
+/**
+ * @brief Is calan (work-stealing) is sistemi icin bagimsiz kiyaslama.
+ * * 1, 2, 4 ve 8 is parcacigi (ana + isciler) icin:
+ * * 1. 100k adet ~1 us'lik is: is basina sure ve calinarak calistirilan islerin orani.
+ * * 2. 400 adet ~1 ms'lik kaba is: is basina sure ve calinma orani.
+ * * Dogruluk kontrolleri (herhangi biri tutmazsa 1 ile cikar):
+ * * - Her is tam bir kez calisir (toplam kontrolu).
+ * * - fe_job_parallel_for 1M elemanin her birine tam bir kez dokunur.
+ * * - Is icinden fe_job_wait ile ic ice bekleme kilitlenmez ve tum alt isler biter.
+ * * - Is sistemine ait olmayan bir is parcacigindan gonderilen isler calisir.
+ * * Mantiksal cekirdekten fazla is parcacigi olan satirlar isaretlenir (duvar saati hizlanmasi beklenmez).
+ *
+ * Derleme (depo kokunden):
+ *   gcc -O2 -std=c11 -D_GNU_SOURCE -Iinclude tests/platform/fe_job_system_bench.c \
+ *       src/platform/fe_job_system.c src/platform/fe_thread.c src/utils/fe_logger.c src/error/fe_error.c \
+ *       src/memory/fe_memory_manager.c src/memory/fe_allocator_linear.c src/memory/fe_allocator_pool.c \
+ *       src/memory/fe_allocator_size_class.c -lpthread -o fe_job_system_bench
+ *   ./fe_job_system_bench
+ */
+
+#include "platform/fe_job_system.h"
+#include "platform/fe_thread.h"
+#include "memory/fe_memory_manager.h"
+#include "utils/fe_logger.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define FE_JOB_BENCH_FINE_JOBS 100000
+#define FE_JOB_BENCH_FINE_US 1.0
+#define FE_JOB_BENCH_COARSE_JOBS 400
+#define FE_JOB_BENCH_COARSE_US 1000.0
+#define FE_JOB_BENCH_FOR_COUNT (1u << 20)
+#define FE_JOB_BENCH_NESTED_PARENTS 64
+#define FE_JOB_BENCH_NESTED_CHILDREN 64
+#define FE_JOB_BENCH_BATCH 256
+
+static fe_atomic_u64_t g_job_bench_sum;
+
+static double fe_job_bench_now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e6 + (double)ts.tv_nsec * 1e-3;
+}
+
+/**
+ * @brief Verilen sure kadar mesgul bekler (is yukunu taklit eder).
+ */
+static void fe_job_bench_spin(double microseconds) {
+    double end = fe_job_bench_now_us() + microseconds;
+    while (fe_job_bench_now_us() < end) {
+    }
+}
+
+static void fe_job_bench_fine_job(void* data) {
+    fe_job_bench_spin(FE_JOB_BENCH_FINE_US);
+    fe_atomic_fetch_add_u64(&g_job_bench_sum, (uint64_t)(uintptr_t)data);
+}
+
+static void fe_job_bench_coarse_job(void* data) {
+    fe_job_bench_spin(FE_JOB_BENCH_COARSE_US);
+    fe_atomic_fetch_add_u64(&g_job_bench_sum, (uint64_t)(uintptr_t)data);
+}
+
+static void fe_job_bench_for_range(void* data, uint32_t begin, uint32_t end) {
+    uint8_t* touched = (uint8_t*)data;
+    for (uint32_t i = begin; i < end; ++i) touched[i]++;
+}
+
+static void fe_job_bench_nested_child(void* data) {
+    (void)data;
+    fe_atomic_fetch_add_u64(&g_job_bench_sum, 1);
+}
+
+static void fe_job_bench_nested_parent(void* data) {
+    (void)data;
+    fe_job_counter_t counter = {0};
+    for (uint32_t i = 0; i < FE_JOB_BENCH_NESTED_CHILDREN; ++i) {
+        fe_job_run(fe_job_bench_nested_child, NULL, &counter);
+    }
+    fe_job_wait(&counter);
+}
+
+typedef struct fe_job_bench_external {
+    fe_job_counter_t counter;
+    fe_thread_t thread;
+} fe_job_bench_external_t;
+
+static void* fe_job_bench_external_thread(void* arg) {
+    fe_job_bench_external_t* external = (fe_job_bench_external_t*)arg;
+    for (uintptr_t i = 1; i <= 1000; ++i) {
+        fe_job_run(fe_job_bench_fine_job, (void*)i, &external->counter);
+    }
+    return NULL;
+}
+
+/**
+ * @brief job_count isi FE_JOB_BENCH_BATCH'lik gruplar halinde gonderir ve hepsini bekler.
+ * * Her isin verisi 1..job_count'tur; toplam kontrol edilir.
+ * @return Is basina us; *out_stolen calinan islerin oranini alir.
+ */
+static double fe_job_bench_run_jobs(fe_job_func_t func, uint32_t job_count, double* out_stolen, bool* io_ok) {
+    fe_job_stats_t before, after;
+    fe_job_decl_t decls[FE_JOB_BENCH_BATCH];
+    fe_job_counter_t counter = {0};
+
+    fe_atomic_store_u64(&g_job_bench_sum, 0);
+    fe_job_system_get_stats(&before);
+    double start = fe_job_bench_now_us();
+    for (uint32_t first = 0; first < job_count; first += FE_JOB_BENCH_BATCH) {
+        uint32_t count = job_count - first < FE_JOB_BENCH_BATCH ? job_count - first : FE_JOB_BENCH_BATCH;
+        for (uint32_t i = 0; i < count; ++i) {
+            decls[i] = (fe_job_decl_t){ func, (void*)(uintptr_t)(first + i + 1) };
+        }
+        fe_job_run_batch(decls, count, &counter);
+    }
+    fe_job_wait(&counter);
+    double elapsed = fe_job_bench_now_us() - start;
+    fe_job_system_get_stats(&after);
+
+    uint64_t expected = (uint64_t)job_count * (job_count + 1) / 2;
+    if (fe_atomic_load_u64(&g_job_bench_sum) != expected) *io_ok = false;
+    uint64_t executed = after.jobs_executed - before.jobs_executed;
+    *out_stolen = executed ? (double)(after.jobs_stolen - before.jobs_stolen) / (double)executed : 0.0;
+    return elapsed / job_count;
+}
+
+/**
+ * @brief parallel_for, ic ice bekleme ve dis is parcacigindan gonderim kontrolleri.
+ */
+static bool fe_job_bench_check_correctness(uint8_t* touched) {
+    bool ok = true;
+
+    memset(touched, 0, FE_JOB_BENCH_FOR_COUNT);
+    fe_job_parallel_for(FE_JOB_BENCH_FOR_COUNT, 0, fe_job_bench_for_range, touched);
+    for (uint32_t i = 0; i < FE_JOB_BENCH_FOR_COUNT; ++i) {
+        if (touched[i] != 1) { ok = false; break; }
+    }
+
+    fe_atomic_store_u64(&g_job_bench_sum, 0);
+    fe_job_counter_t parents = {0};
+    for (uint32_t i = 0; i < FE_JOB_BENCH_NESTED_PARENTS; ++i) {
+        fe_job_run(fe_job_bench_nested_parent, NULL, &parents);
+    }
+    fe_job_wait(&parents);
+    if (fe_atomic_load_u64(&g_job_bench_sum) != FE_JOB_BENCH_NESTED_PARENTS * FE_JOB_BENCH_NESTED_CHILDREN) ok = false;
+
+    fe_atomic_store_u64(&g_job_bench_sum, 0);
+    fe_job_bench_external_t external = {0};
+    if (fe_thread_create(&external.thread, fe_job_bench_external_thread, &external) != FE_OK) return false;
+    fe_thread_join(&external.thread);
+    fe_job_wait(&external.counter);
+    if (fe_atomic_load_u64(&g_job_bench_sum) != 1000ull * 1001 / 2) ok = false;
+
+    return ok;
+}
+
+int main(void) {
+    static const uint32_t thread_counts[] = {1, 2, 4, 8};
+    uint32_t cpu_count = fe_thread_get_cpu_count();
+    uint8_t* touched = (uint8_t*)malloc(FE_JOB_BENCH_FOR_COUNT);
+    int result = 0;
+
+    fe_logger_set_level(FE_LOG_LEVEL_WARN);
+    fe_memory_manager_init();
+
+    printf("mantiksal cekirdek: %u\n", cpu_count);
+    printf("is parcacigi   1 us x %uk: us/is  calinan   1 ms x %u: ms/is  calinan   dogruluk\n",
+           FE_JOB_BENCH_FINE_JOBS / 1000, FE_JOB_BENCH_COARSE_JOBS);
+    for (size_t t = 0; t < sizeof(thread_counts) / sizeof(thread_counts[0]); ++t) {
+        uint32_t threads = thread_counts[t];
+        if (fe_job_system_init(threads - 1) != FE_OK) {
+            fprintf(stderr, "is sistemi baslatilamadi\n");
+            return 1;
+        }
+
+        bool ok = true;
+        double fine_stolen, coarse_stolen;
+        double fine_us = fe_job_bench_run_jobs(fe_job_bench_fine_job, FE_JOB_BENCH_FINE_JOBS, &fine_stolen, &ok);
+        double coarse_us = fe_job_bench_run_jobs(fe_job_bench_coarse_job, FE_JOB_BENCH_COARSE_JOBS, &coarse_stolen, &ok);
+        ok = fe_job_bench_check_correctness(touched) && ok;
+        fe_job_system_shutdown();
+
+        printf("  %10u   %20.2f  %6.1f%%   %17.3f  %6.1f%%   %s%s\n", threads,
+               fine_us, fine_stolen * 100.0, coarse_us / 1000.0, coarse_stolen * 100.0,
+               ok ? "tamam" : "HATA", threads > cpu_count ? "  (cekirdekten fazla)" : "");
+        if (!ok) result = 1;
+    }
+
+    free(touched);
+    fe_memory_manager_shutdown();
+    if (result != 0) {
+        printf("BASARISIZ: is kaybedildi veya iki kez calisti\n");
+    } else {
+        printf("GECTI\n");
+    }
+    return result;
+}
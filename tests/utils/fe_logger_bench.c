@@ -0,0 +1,119 @@
+// tests/utils/fe_logger_bench.c
+
+/**
+ * @brief Senkron ve asenkron logger icin cagri basina maliyet (ns/cagri) kiyaslamasi.
+ * * Her kare 1000 FE_LOG_INFO cagrisi yapar; kareler arasinda fe_logger_flush cagrilir. Olculen sure
+ * * yalnizca cagiran is parcacigindaki suredir (flush haric).
+ * * 1. Senkron ve asenkron mod icin ns/cagri basar.
+ * * 2. Derleme zamaninda atilan FE_LOG_TRACE: argumanlari hic degerlendirilmemeli (sayac 0 kalmali).
+ * * 3. Iki moddaki tum kayitlar ciktida bulunmalidir (asenkron modda kayit kaybolmaz).
+ * * Herhangi bir kontrol tutmazsa 1 ile cikar.
+ * * stdout (log ciktisi) gecici bir dosyaya yonlendirilir; o dosya ve logger'in log dosyasi sonunda silinir.
+ * * Sonuclar stderr'e yazilir.
+ * * Bu dosya FE_LOG_COMPILE_LEVEL=3 (INFO) ile derlenir; logger'in kendisi derleme bayraklarindan etkilenmez.
+ *
+ * Derleme (depo kokunden):
+ *   gcc -O2 -std=c11 -D_GNU_SOURCE -Iinclude tests/utils/fe_logger_bench.c src/utils/fe_logger.c \
+ *       src/platform/fe_thread.c src/error/fe_error.c -lpthread -o fe_logger_bench
+ *   ./fe_logger_bench
+ */
+
+#define FE_LOG_COMPILE_LEVEL 3 // INFO: TRACE ve DEBUG bu dosyada derlenmez
+
+#include "utils/fe_logger.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define FE_LOGGER_BENCH_FRAMES 50
+#define FE_LOGGER_BENCH_CALLS_PER_FRAME 1000
+#define FE_LOGGER_BENCH_OUTPUT "fe_logger_bench.out"
+#define FE_LOGGER_BENCH_MARKER "bench-kaydi"
+#define FE_LOGGER_BENCH_LOG_FILE "frontend_engine.log" // fe_logger.c LOG_FILE_NAME
+
+static double fe_logger_bench_now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e3 + (double)ts.tv_nsec * 1e-6;
+}
+
+/**
+ * @brief FE_LOGGER_BENCH_FRAMES kare log yazar ve cagiran is parcacigindaki ortalama ns/cagri dondurur.
+ */
+static double fe_logger_bench_frames(const char* mode) {
+    double total_ms = 0.0;
+    for (int frame = 0; frame < FE_LOGGER_BENCH_FRAMES; ++frame) {
+        double start = fe_logger_bench_now_ms();
+        for (int i = 0; i < FE_LOGGER_BENCH_CALLS_PER_FRAME; ++i) {
+            FE_LOG_INFO(FE_LOGGER_BENCH_MARKER " %s kare %d, cagri %d, deger %.3f", mode, frame, i, i * 0.5);
+        }
+        total_ms += fe_logger_bench_now_ms() - start;
+        fe_logger_flush();
+    }
+    return total_ms * 1e6 / (FE_LOGGER_BENCH_FRAMES * FE_LOGGER_BENCH_CALLS_PER_FRAME);
+}
+
+static int fe_logger_bench_side_effect(int* counter) {
+    return ++*counter;
+}
+
+int main(void) {
+    int result = 0;
+    if (!freopen(FE_LOGGER_BENCH_OUTPUT, "w", stdout)) {
+        fprintf(stderr, "cikti dosyasi acilamadi\n");
+        return 1;
+    }
+    fe_logger_init();
+    fe_logger_set_level(FE_LOG_LEVEL_INFO);
+
+    // 1. Senkron ve asenkron ns/cagri
+    double sync_ns = fe_logger_bench_frames("senkron");
+    if (!fe_logger_set_async(true)) {
+        fprintf(stderr, "asenkron mod acilamadi\n");
+        return 1;
+    }
+    double async_ns = fe_logger_bench_frames("asenkron");
+    fe_logger_set_async(false);
+
+    // 2. Atilan TRACE: argumanlar degerlendirilmemeli
+    int evaluated = 0;
+    double start = fe_logger_bench_now_ms();
+    for (int i = 0; i < FE_LOGGER_BENCH_CALLS_PER_FRAME; ++i) {
+        FE_LOG_TRACE("atilan %d", fe_logger_bench_side_effect(&evaluated));
+    }
+    double stripped_ns = (fe_logger_bench_now_ms() - start) * 1e6 / FE_LOGGER_BENCH_CALLS_PER_FRAME;
+    fflush(stdout);
+
+    // 3. Tum kayitlar ciktida olmali
+    FILE* output = fopen(FE_LOGGER_BENCH_OUTPUT, "r");
+    char line[1024];
+    long lines = 0;
+    while (output && fgets(line, sizeof(line), output)) {
+        if (strstr(line, FE_LOGGER_BENCH_MARKER)) ++lines;
+    }
+    if (output) fclose(output);
+    remove(FE_LOGGER_BENCH_OUTPUT);
+
+    const long expected = 2L * FE_LOGGER_BENCH_FRAMES * FE_LOGGER_BENCH_CALLS_PER_FRAME;
+    fprintf(stderr, "kare basina %d FE_LOG_INFO, %d kare\n", FE_LOGGER_BENCH_CALLS_PER_FRAME, FE_LOGGER_BENCH_FRAMES);
+    fprintf(stderr, "  senkron              %8.1f ns/cagri\n", sync_ns);
+    fprintf(stderr, "  asenkron (cagiran)   %8.1f ns/cagri\n", async_ns);
+    fprintf(stderr, "  atilan FE_LOG_TRACE  %8.1f ns/cagri (degerlendirilen arguman: %d)\n", stripped_ns, evaluated);
+    fprintf(stderr, "  yazilan kayit: %ld / %ld\n", lines, expected);
+
+    if (evaluated != 0) {
+        fprintf(stderr, "BASARISIZ: atilan FE_LOG_TRACE argumanlari degerlendirildi\n");
+        result = 1;
+    }
+    if (lines != expected) {
+        fprintf(stderr, "BASARISIZ: kayit kaybi\n");
+        result = 1;
+    }
+    if (result == 0) {
+        fprintf(stderr, "GECTI\n");
+    }
+    fe_logger_shutdown();
+    remove(FE_LOGGER_BENCH_LOG_FILE);
+    return result;
+}